@@ -34,6 +34,7 @@ public class HCIEditor : ModuleRules
 				"AssetRegistry",    // 资产路径与类型校验
 				"AssetTools",       // Redirector FixupReferencers
 				"DirectoryWatcher", // External ingest batch watcher (Stage N)
+				"SourceControl",    // 写步骤批量签出预检
 				"Json",             // JSON 解析支持
 				"HTTP",             // LLM 调试探针
 				"EditorScriptingUtilities", // UEditorAssetLibrary (Stage I ToolAction)
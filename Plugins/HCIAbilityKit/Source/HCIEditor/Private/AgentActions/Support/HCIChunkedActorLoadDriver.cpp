@@ -0,0 +1,127 @@
+#include "AgentActions/Support/HCIChunkedActorLoadDriver.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogHCIChunkedActorLoad, Log, All);
+
+namespace
+{
+static bool HCI_IsOverMemoryCeiling(const uint64 UsedPhysicalMB, const int32 MemoryCeilingMB)
+{
+	return MemoryCeilingMB > 0 && UsedPhysicalMB > static_cast<uint64>(MemoryCeilingMB);
+}
+} // namespace
+
+void FHCIChunkedActorLoadDriver::Run(
+	const TArray<FGuid>& PendingGuids,
+	const int32 BatchSize,
+	const int32 MemoryCeilingMB,
+	const FHCIChunkedActorLoadHooks& Hooks,
+	FHCIChunkedActorLoadStats& OutStats)
+{
+	const int32 SafeBatchSize = FMath::Max(1, BatchSize);
+	const int32 EstimatedBatchCount = FMath::DivideAndRoundUp(PendingGuids.Num(), SafeBatchSize);
+
+	// Guids of a batch cut short by the ceiling are loaded first by the next batch.
+	TArray<FGuid> Deferred;
+	int32 NextPending = 0;
+	TArray<FGuid> Batch;
+	Batch.Reserve(SafeBatchSize);
+	TSet<FGuid> Visited;
+	Visited.Reserve(SafeBatchSize);
+
+	while (Deferred.Num() > 0 || NextPending < PendingGuids.Num())
+	{
+		if (Hooks.OnBatchBegin)
+		{
+			Hooks.OnBatchBegin();
+		}
+		if (Hooks.ShouldCancel())
+		{
+			OutStats.Status = TEXT("cancelled");
+			return;
+		}
+		if (Hooks.IsFull())
+		{
+			OutStats.Status = TEXT("max_actor_count_reached");
+			return;
+		}
+
+		Batch.Reset();
+		const int32 FromDeferred = FMath::Min(SafeBatchSize, Deferred.Num());
+		Batch.Append(Deferred.GetData(), FromDeferred);
+		Deferred.RemoveAt(0, FromDeferred, EAllowShrinking::No);
+		const int32 FromPending = FMath::Min(SafeBatchSize - FromDeferred, PendingGuids.Num() - NextPending);
+		Batch.Append(PendingGuids.GetData() + NextPending, FromPending);
+		NextPending += FromPending;
+
+		Visited.Reset();
+		bool bCancelled = false;
+		bool bFull = false;
+		bool bOverCeiling = false;
+		Hooks.LoadBatch(Batch, [&](const FGuid& Guid)
+		{
+			Visited.Add(Guid);
+			++OutStats.LoadedActorCount;
+			const uint64 UsedPhysicalMB = Hooks.GetUsedPhysicalMB();
+			OutStats.PeakUsedPhysicalMB = FMath::Max(OutStats.PeakUsedPhysicalMB, UsedPhysicalMB);
+
+			bFull = Hooks.IsFull();
+			bCancelled = !bFull && Hooks.ShouldCancel();
+			bOverCeiling = !bFull && !bCancelled && HCI_IsOverMemoryCeiling(UsedPhysicalMB, MemoryCeilingMB);
+			return !bFull && !bCancelled && !bOverCeiling;
+		});
+		++OutStats.LoadedBatchCount;
+
+		const bool bWorkLeft = Deferred.Num() > 0 || NextPending < PendingGuids.Num() || Visited.Num() < Batch.Num();
+		if (bCancelled)
+		{
+			OutStats.Status = TEXT("cancelled");
+			return;
+		}
+		if (bFull)
+		{
+			if (bWorkLeft)
+			{
+				OutStats.Status = TEXT("max_actor_count_reached");
+			}
+			return;
+		}
+
+		uint64 UsedPhysicalMB = Hooks.GetUsedPhysicalMB();
+		OutStats.PeakUsedPhysicalMB = FMath::Max(OutStats.PeakUsedPhysicalMB, UsedPhysicalMB);
+		if (bOverCeiling || HCI_IsOverMemoryCeiling(UsedPhysicalMB, MemoryCeilingMB) || Hooks.ShouldForceCollect())
+		{
+			Hooks.CollectGarbage();
+			UsedPhysicalMB = Hooks.GetUsedPhysicalMB();
+			if (HCI_IsOverMemoryCeiling(UsedPhysicalMB, MemoryCeilingMB))
+			{
+				OutStats.Status = TEXT("memory_ceiling_reached");
+				return;
+			}
+		}
+
+		// A ceiling cut happens after at least one visit, so retrying the rest of the batch makes progress.
+		// Without a cut, unvisited guids are actors that failed to load and are not retried.
+		if (bOverCeiling)
+		{
+			TArray<FGuid> Unvisited;
+			for (const FGuid& Guid : Batch)
+			{
+				if (!Visited.Contains(Guid))
+				{
+					Unvisited.Add(Guid);
+				}
+			}
+			Deferred.Insert(Unvisited, 0);
+		}
+
+		UE_LOG(
+			LogHCIChunkedActorLoad,
+			Display,
+			TEXT("[HCI][ScanLevelMeshRisks] wp_batch=%d/%d loaded=%d deferred=%d used_physical_mb=%llu"),
+			OutStats.LoadedBatchCount,
+			EstimatedBatchCount,
+			OutStats.LoadedActorCount,
+			Deferred.Num(),
+			UsedPhysicalMB);
+	}
+}
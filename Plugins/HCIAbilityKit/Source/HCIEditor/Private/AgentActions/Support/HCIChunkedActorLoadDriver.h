@@ -0,0 +1,41 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Hooks through which FHCIChunkedActorLoadDriver reaches World Partition, memory stats and the UI.
+struct FHCIChunkedActorLoadHooks
+{
+	// Loads BatchGuids and, after each actor is loaded and scanned, calls Visit with its guid; stops loading as soon
+	// as Visit returns false. Everything the batch loaded must be released by the time it returns.
+	TFunction<void(TConstArrayView<FGuid> /*BatchGuids*/, TFunctionRef<bool(const FGuid&)> /*Visit*/)> LoadBatch;
+	TFunction<bool()> IsFull;
+	TFunction<bool()> ShouldCancel;
+	TFunction<uint64()> GetUsedPhysicalMB;
+	// True when collection is worth forcing even under the ceiling (engine memory pressure).
+	TFunction<bool()> ShouldForceCollect;
+	TFunction<void()> CollectGarbage;
+	TFunction<void()> OnBatchBegin;
+};
+
+struct FHCIChunkedActorLoadStats
+{
+	FString Status = TEXT("completed");
+	int32 LoadedBatchCount = 0;
+	int32 LoadedActorCount = 0;
+	uint64 PeakUsedPhysicalMB = 0;
+};
+
+// Batched load loop of the chunked World Partition scan in ScanLevelMeshRisks. Guids are loaded BatchSize at a time,
+// and cancellation, the actor cap and the memory ceiling are checked after every single load. A load that crosses the
+// ceiling ends its batch early; once the batch is released and garbage is collected the scan either stops with
+// "memory_ceiling_reached" or, if usage dropped back under the ceiling, loads the rest of that batch next.
+class FHCIChunkedActorLoadDriver
+{
+public:
+	static void Run(
+		const TArray<FGuid>& PendingGuids,
+		int32 BatchSize,
+		int32 MemoryCeilingMB,
+		const FHCIChunkedActorLoadHooks& Hooks,
+		FHCIChunkedActorLoadStats& OutStats);
+};
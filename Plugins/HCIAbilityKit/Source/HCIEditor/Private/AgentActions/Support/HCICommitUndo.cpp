@@ -0,0 +1,525 @@
+#include "AgentActions/Support/HCICommitUndo.h"
+
+#include "Agent/Executor/HCIAgentExecutionGate.h"
+#include "Agent/Planner/HCIAgentPlan.h"
+#include "Agent/Tools/HCIToolRegistry.h"
+#include "Containers/Ticker.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "PackageTools.h"
+#include "ScopedTransaction.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+#include "UObject/UObjectGlobals.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogHCICommitUndo, Log, All);
+
+namespace
+{
+static TAutoConsoleVariable<int32> CVarHCIUndoMemoryCeilingMB(
+	TEXT("HCI.Undo.MemoryCeilingMB"),
+	512,
+	TEXT("Estimated undo footprint above which an HCI commit backs up package files instead of recording in-memory undo state."),
+	ECVF_Default);
+
+// Rough in-memory cost of one FHCIPropertyDeltaChange record (object + two short exported values).
+static constexpr int64 HCIUndoDeltaBytesPerAsset = 256;
+// Used when a package file cannot be found (e.g. assets created by the commit itself).
+static constexpr int64 HCIUndoUnknownSnapshotBytes = 1024 * 1024;
+
+static bool HCI_ToolHasCompactDelta(const FName ToolName)
+{
+	return ToolName == TEXT("SetTextureMaxSize") || ToolName == TEXT("SetMeshLODGroup");
+}
+
+static bool HCI_IsTemplateText(const FString& Text)
+{
+	return Text.Contains(TEXT("{{")) && Text.Contains(TEXT("}}"));
+}
+
+// Keyword and LLM plans pass scan results to write steps as "{{sN.asset_paths}}"; the count is only known
+// after the executor resolved the step.
+static bool HCI_StepHasTemplatedTargets(const FHCIAgentPlanStep& Step)
+{
+	if (!Step.Args.IsValid())
+	{
+		return false;
+	}
+
+	FString Text;
+	if ((Step.Args->TryGetStringField(TEXT("asset_paths"), Text) || Step.Args->TryGetStringField(TEXT("asset_path"), Text)) &&
+		HCI_IsTemplateText(Text))
+	{
+		return true;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* AssetPaths = nullptr;
+	if (Step.Args->TryGetArrayField(TEXT("asset_paths"), AssetPaths) && AssetPaths)
+	{
+		for (const TSharedPtr<FJsonValue>& Value : *AssetPaths)
+		{
+			if (Value.IsValid() && Value->TryGetString(Text) && HCI_IsTemplateText(Text))
+			{
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+static void HCI_CollectStepObjectPaths(const FHCIAgentPlanStep& Step, TArray<FString>& OutObjectPaths)
+{
+	if (!Step.Args.IsValid())
+	{
+		return;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* AssetPaths = nullptr;
+	if (Step.Args->TryGetArrayField(TEXT("asset_paths"), AssetPaths) && AssetPaths)
+	{
+		for (const TSharedPtr<FJsonValue>& Value : *AssetPaths)
+		{
+			FString ObjectPath;
+			if (Value.IsValid() && Value->TryGetString(ObjectPath) && !ObjectPath.IsEmpty() && !HCI_IsTemplateText(ObjectPath))
+			{
+				OutObjectPaths.Add(ObjectPath);
+			}
+		}
+	}
+
+	FString AssetPath;
+	if (Step.Args->TryGetStringField(TEXT("asset_path"), AssetPath) && !AssetPath.IsEmpty() && !HCI_IsTemplateText(AssetPath))
+	{
+		OutObjectPaths.Add(AssetPath);
+	}
+}
+
+static int64 HCI_GetPackageFileSize(const FString& ObjectPath)
+{
+	const FString PackageName = FPackageName::ObjectPathToPackageName(ObjectPath);
+	FString Filename;
+	if (!FPackageName::IsValidLongPackageName(PackageName) || !FPackageName::DoesPackageExist(PackageName, &Filename))
+	{
+		return HCIUndoUnknownSnapshotBytes;
+	}
+	const int64 FileSize = IFileManager::Get().FileSize(*Filename);
+	return FileSize > 0 ? FileSize : HCIUndoUnknownSnapshotBytes;
+}
+
+static void HCI_AddStepToEstimate(const FHCIAgentPlanStep& Step, FHCICommitUndoEstimate& InOutEstimate)
+{
+	TArray<FString> ObjectPaths;
+	HCI_CollectStepObjectPaths(Step, ObjectPaths);
+	if (HCI_ToolHasCompactDelta(Step.ToolName))
+	{
+		// Delta records do not depend on the package size, so the package files are not stat-ed.
+		InOutEstimate.DeltaAssets += ObjectPaths.Num();
+		InOutEstimate.EstimatedBytes += HCIUndoDeltaBytesPerAsset * ObjectPaths.Num();
+		return;
+	}
+
+	for (const FString& ObjectPath : ObjectPaths)
+	{
+		const int64 SnapshotBytes = HCI_GetPackageFileSize(ObjectPath);
+		++InOutEstimate.SnapshotAssets;
+		InOutEstimate.FullSnapshotBytes += SnapshotBytes;
+		InOutEstimate.EstimatedBytes += SnapshotBytes;
+	}
+}
+
+static EHCICommitUndoMode HCI_PickCommitUndoMode(const FHCICommitUndoEstimate& Estimate)
+{
+	return (Estimate.CeilingBytes > 0 && Estimate.EstimatedBytes > Estimate.CeilingBytes)
+		? EHCICommitUndoMode::PackageBackup
+		: EHCICommitUndoMode::PropertyDelta;
+}
+
+static bool HCI_IsWriteStep(const FHCIAgentPlanStep& Step)
+{
+	const FHCIToolDescriptor* Tool = FHCIToolRegistry::GetReadOnly().FindTool(Step.ToolName);
+	return Tool && FHCIAgentExecutionGate::IsWriteLikeCapability(Tool->Capability);
+}
+
+static const TCHAR* HCI_CommitUndoModeToString(const EHCICommitUndoMode Mode)
+{
+	switch (Mode)
+	{
+	case EHCICommitUndoMode::FullSnapshot:
+		return TEXT("full_snapshot");
+	case EHCICommitUndoMode::PropertyDelta:
+		return TEXT("property_delta");
+	case EHCICommitUndoMode::PackageBackup:
+		return TEXT("package_backup");
+	default:
+		return TEXT("unknown");
+	}
+}
+
+// Single undo record for a PackageBackup commit. Undo copies the pre-commit files back and reloads the
+// packages; redo does the same with the post-commit files. The copy and reload run on the next tick so
+// packages are never reloaded from inside the transaction system.
+class FHCIPackageBackupChange final : public FCommandChange
+{
+public:
+	explicit FHCIPackageBackupChange(TArray<FHCICommitPackageBackup> InBackups)
+		: Backups(MoveTemp(InBackups))
+	{
+	}
+
+	virtual void Apply(UObject* Object) override
+	{
+		ScheduleRestore(false);
+	}
+
+	virtual void Revert(UObject* Object) override
+	{
+		ScheduleRestore(true);
+	}
+
+	virtual FString ToString() const override
+	{
+		return FString::Printf(TEXT("HCI package backup (%d packages)"), Backups.Num());
+	}
+
+private:
+	void ScheduleRestore(const bool bRestoreBefore) const
+	{
+		FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+			[Backups = Backups, bRestoreBefore](float)
+			{
+				RestorePackages(Backups, bRestoreBefore);
+				return false;
+			}));
+	}
+
+	static void RestorePackages(const TArray<FHCICommitPackageBackup>& Backups, const bool bRestoreBefore)
+	{
+		TArray<UPackage*> PackagesToReload;
+		int32 RestoredCount = 0;
+		for (const FHCICommitPackageBackup& Backup : Backups)
+		{
+			UPackage* Package = FindPackage(nullptr, *Backup.PackageName);
+			if (Package)
+			{
+				ResetLoaders(Package);
+			}
+
+			const FString& SourceFilename = bRestoreBefore ? Backup.BeforeFilename : Backup.AfterFilename;
+			if (IFileManager::Get().Copy(*Backup.PackageFilename, *SourceFilename, true, true) != COPY_OK)
+			{
+				UE_LOG(LogHCICommitUndo, Warning, TEXT("[HCI][CommitUndo] restore_failed package=%s source=%s"), *Backup.PackageName, *SourceFilename);
+				continue;
+			}
+
+			++RestoredCount;
+			if (Package)
+			{
+				PackagesToReload.Add(Package);
+			}
+		}
+
+		if (PackagesToReload.Num() > 0)
+		{
+			UPackageTools::ReloadPackages(PackagesToReload);
+		}
+		UE_LOG(
+			LogHCICommitUndo,
+			Display,
+			TEXT("[HCI][CommitUndo] package_restore direction=%s restored=%d reloaded=%d"),
+			bRestoreBefore ? TEXT("undo") : TEXT("redo"),
+			RestoredCount,
+			PackagesToReload.Num());
+	}
+
+	TArray<FHCICommitPackageBackup> Backups;
+};
+} // namespace
+
+FHCICommitUndoScope* FHCICommitUndoScope::ActiveScope = nullptr;
+
+FHCIPropertyDeltaChange::FHCIPropertyDeltaChange(FName InPropertyName, FString InBeforeText, FString InAfterText)
+	: PropertyName(InPropertyName)
+	, BeforeText(MoveTemp(InBeforeText))
+	, AfterText(MoveTemp(InAfterText))
+{
+}
+
+void FHCIPropertyDeltaChange::Apply(UObject* Object)
+{
+	SetValue(Object, AfterText);
+}
+
+void FHCIPropertyDeltaChange::Revert(UObject* Object)
+{
+	SetValue(Object, BeforeText);
+}
+
+FString FHCIPropertyDeltaChange::ToString() const
+{
+	return FString::Printf(TEXT("HCI %s: %s -> %s"), *PropertyName.ToString(), *BeforeText, *AfterText);
+}
+
+void FHCIPropertyDeltaChange::SetValue(UObject* Object, const FString& ValueText) const
+{
+	FProperty* Property = Object ? FindFProperty<FProperty>(Object->GetClass(), PropertyName) : nullptr;
+	if (!Property)
+	{
+		return;
+	}
+
+	Object->PreEditChange(Property);
+	Property->ImportText_Direct(*ValueText, Property->ContainerPtrToValuePtr<void>(Object), Object, PPF_None);
+	FPropertyChangedEvent ChangedEvent(Property);
+	Object->PostEditChangeProperty(ChangedEvent);
+	Object->MarkPackageDirty();
+}
+
+FHCICommitUndoEstimate FHCICommitUndoScope::Estimate(const FHCIAgentPlan& Plan, const int64 CeilingBytes)
+{
+	FHCICommitUndoEstimate Result;
+	Result.CeilingBytes = CeilingBytes;
+	for (const FHCIAgentPlanStep& Step : Plan.Steps)
+	{
+		if (!HCI_IsWriteStep(Step))
+		{
+			continue;
+		}
+		if (HCI_StepHasTemplatedTargets(Step))
+		{
+			++Result.DeferredSteps;
+			continue;
+		}
+		HCI_AddStepToEstimate(Step, Result);
+	}
+
+	Result.Mode = HCI_PickCommitUndoMode(Result);
+	return Result;
+}
+
+int64 FHCICommitUndoScope::GetConfiguredCeilingBytes()
+{
+	return static_cast<int64>(FMath::Max(0, CVarHCIUndoMemoryCeilingMB.GetValueOnGameThread())) * 1024 * 1024;
+}
+
+EHCICommitUndoMode FHCICommitUndoScope::GetActiveMode()
+{
+	return ActiveScope ? ActiveScope->UndoEstimate.Mode : EHCICommitUndoMode::FullSnapshot;
+}
+
+void FHCICommitUndoScope::RecordPropertyChange(UObject* Object, const FName PropertyName, TFunctionRef<void()> Mutate)
+{
+	check(IsInGameThread());
+	check(Object);
+
+	FProperty* Property = FindFProperty<FProperty>(Object->GetClass(), PropertyName);
+	const EHCICommitUndoMode Mode = GetActiveMode();
+	if (Mode == EHCICommitUndoMode::PackageBackup)
+	{
+		ActiveScope->BackupPackage(Object->GetPackage());
+		Mutate();
+		Object->MarkPackageDirty();
+		return;
+	}
+
+	if (Mode == EHCICommitUndoMode::FullSnapshot || !Property || GUndo == nullptr)
+	{
+		Object->Modify();
+		Mutate();
+		return;
+	}
+
+	FString BeforeText;
+	FString AfterText;
+	const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(Object);
+	Property->ExportTextItem_Direct(BeforeText, ValuePtr, nullptr, Object, PPF_None);
+	Mutate();
+	Property->ExportTextItem_Direct(AfterText, ValuePtr, nullptr, Object, PPF_None);
+	GUndo->StoreUndo(Object, MakeUnique<FHCIPropertyDeltaChange>(PropertyName, MoveTemp(BeforeText), MoveTemp(AfterText)));
+	Object->MarkPackageDirty();
+	++ActiveScope->RecordedDeltas;
+}
+
+void FHCICommitUndoScope::ModifyObject(UObject* Object)
+{
+	check(IsInGameThread());
+	check(Object);
+
+	if (GetActiveMode() == EHCICommitUndoMode::PackageBackup)
+	{
+		ActiveScope->BackupPackage(Object->GetPackage());
+		Object->MarkPackageDirty();
+		return;
+	}
+	Object->Modify();
+}
+
+FHCICommitUndoScope::FHCICommitUndoScope(const FHCIAgentPlan& Plan, const FText& Description)
+	: UndoEstimate(Estimate(Plan, GetConfiguredCeilingBytes()))
+	, RequestId(Plan.RequestId)
+{
+	check(IsInGameThread());
+
+	Transaction = MakeUnique<FScopedTransaction>(TEXT("HCI"), Description, nullptr, true);
+	BackupRoot = FPaths::Combine(
+		FPaths::ProjectSavedDir(),
+		TEXT("HCI/UndoBackups"),
+		FString::Printf(TEXT("%s_%lld"), *FPaths::MakeValidFileName(RequestId), FDateTime::UtcNow().GetTicks()));
+	for (const FHCIAgentPlanStep& Step : Plan.Steps)
+	{
+		if (HCI_IsWriteStep(Step) && HCI_StepHasTemplatedTargets(Step))
+		{
+			DeferredStepIds.Add(Step.StepId);
+		}
+	}
+	PreviousScope = ActiveScope;
+	ActiveScope = this;
+
+	UE_LOG(
+		LogHCICommitUndo,
+		Display,
+		TEXT("[HCI][CommitUndo] begin request_id=%s mode=%s delta_assets=%d snapshot_assets=%d deferred_steps=%d estimated_mb=%.1f full_snapshot_mb=%.1f ceiling_mb=%.1f"),
+		*RequestId,
+		HCI_CommitUndoModeToString(UndoEstimate.Mode),
+		UndoEstimate.DeltaAssets,
+		UndoEstimate.SnapshotAssets,
+		UndoEstimate.DeferredSteps,
+		UndoEstimate.EstimatedBytes / (1024.0 * 1024.0),
+		UndoEstimate.FullSnapshotBytes / (1024.0 * 1024.0),
+		UndoEstimate.CeilingBytes / (1024.0 * 1024.0));
+}
+
+FHCICommitUndoScope::~FHCICommitUndoScope()
+{
+	ActiveScope = PreviousScope;
+	if (UndoEstimate.Mode == EHCICommitUndoMode::PackageBackup)
+	{
+		FinalizePackageBackups();
+	}
+	Transaction.Reset();
+
+	UE_LOG(
+		LogHCICommitUndo,
+		Display,
+		TEXT("[HCI][CommitUndo] end request_id=%s mode=%s deltas=%d backed_up_packages=%d"),
+		*RequestId,
+		HCI_CommitUndoModeToString(UndoEstimate.Mode),
+		RecordedDeltas,
+		PackageBackups.Num());
+}
+
+void FHCICommitUndoScope::NoteResolvedStep(const FHCIAgentPlanStep& ResolvedStep)
+{
+	check(IsInGameThread());
+	if (ActiveScope)
+	{
+		ActiveScope->AccountDeferredStep(ResolvedStep);
+	}
+}
+
+void FHCICommitUndoScope::AccountDeferredStep(const FHCIAgentPlanStep& ResolvedStep)
+{
+	if (DeferredStepIds.Remove(ResolvedStep.StepId) == 0)
+	{
+		return;
+	}
+
+	HCI_AddStepToEstimate(ResolvedStep, UndoEstimate);
+	if (UndoEstimate.Mode != EHCICommitUndoMode::PropertyDelta || HCI_PickCommitUndoMode(UndoEstimate) != EHCICommitUndoMode::PackageBackup)
+	{
+		return;
+	}
+
+	// Deltas already recorded stay in the transaction; writes from here on back up their packages instead.
+	UndoEstimate.Mode = EHCICommitUndoMode::PackageBackup;
+	UE_LOG(
+		LogHCICommitUndo,
+		Display,
+		TEXT("[HCI][CommitUndo] mode_switch request_id=%s step_id=%s mode=%s delta_assets=%d snapshot_assets=%d estimated_mb=%.1f ceiling_mb=%.1f deltas_before_switch=%d"),
+		*RequestId,
+		*ResolvedStep.StepId,
+		HCI_CommitUndoModeToString(UndoEstimate.Mode),
+		UndoEstimate.DeltaAssets,
+		UndoEstimate.SnapshotAssets,
+		UndoEstimate.EstimatedBytes / (1024.0 * 1024.0),
+		UndoEstimate.CeilingBytes / (1024.0 * 1024.0),
+		RecordedDeltas);
+}
+
+void FHCICommitUndoScope::BackupPackage(UPackage* Package)
+{
+	if (!Package)
+	{
+		return;
+	}
+
+	bool bAlreadyBackedUp = false;
+	BackedUpPackages.Add(Package->GetFName(), &bAlreadyBackedUp);
+	if (bAlreadyBackedUp)
+	{
+		return;
+	}
+
+	// Packages created by this commit have no file yet; there is nothing to restore them to.
+	const FString PackageName = Package->GetName();
+	FString PackageFilename;
+	if (!FPackageName::DoesPackageExist(PackageName, &PackageFilename))
+	{
+		return;
+	}
+
+	FHCICommitPackageBackup& Backup = PackageBackups.AddDefaulted_GetRef();
+	Backup.PackageName = PackageName;
+	Backup.PackageFilename = FPaths::ConvertRelativePathToFull(PackageFilename);
+	const FString RelativeName = PackageName.RightChop(1) + FPaths::GetExtension(PackageFilename, true);
+	Backup.BeforeFilename = FPaths::Combine(BackupRoot, TEXT("before"), RelativeName);
+	Backup.AfterFilename = FPaths::Combine(BackupRoot, TEXT("after"), RelativeName);
+
+	// Unsaved edits live only in memory; copying the file would make undo roll back past them.
+	bool bBackedUp = false;
+	if (Package->IsDirty())
+	{
+		FSavePackageArgs SaveArgs;
+		SaveArgs.TopLevelFlags = RF_Standalone;
+		SaveArgs.SaveFlags = SAVE_KeepDirty;
+		bBackedUp = UPackage::SavePackage(Package, nullptr, *Backup.BeforeFilename, SaveArgs);
+	}
+	else
+	{
+		bBackedUp = IFileManager::Get().Copy(*Backup.BeforeFilename, *Backup.PackageFilename, true, true) == COPY_OK;
+	}
+	if (!bBackedUp)
+	{
+		UE_LOG(LogHCICommitUndo, Warning, TEXT("[HCI][CommitUndo] backup_failed package=%s"), *PackageName);
+		PackageBackups.Pop();
+	}
+}
+
+void FHCICommitUndoScope::FinalizePackageBackups()
+{
+	for (const FHCICommitPackageBackup& Backup : PackageBackups)
+	{
+		// Wired tools save as they go; anything still dirty is written straight to the backup location.
+		UPackage* Package = FindPackage(nullptr, *Backup.PackageName);
+		if (Package && Package->IsDirty())
+		{
+			FSavePackageArgs SaveArgs;
+			SaveArgs.TopLevelFlags = RF_Standalone;
+			SaveArgs.SaveFlags = SAVE_KeepDirty;
+			UPackage::SavePackage(Package, nullptr, *Backup.AfterFilename, SaveArgs);
+		}
+		else
+		{
+			IFileManager::Get().Copy(*Backup.AfterFilename, *Backup.PackageFilename, true, true);
+		}
+	}
+
+	if (GUndo && PackageBackups.Num() > 0)
+	{
+		// The transient package is never reloaded or collected, so it is a stable owner for the record.
+		GUndo->StoreUndo(GetTransientPackage(), MakeUnique<FHCIPackageBackupChange>(PackageBackups));
+	}
+}
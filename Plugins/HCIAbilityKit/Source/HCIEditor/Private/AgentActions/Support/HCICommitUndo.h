@@ -0,0 +1,104 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/Change.h"
+
+struct FHCIAgentPlan;
+struct FHCIAgentPlanStep;
+class FScopedTransaction;
+
+// How the business transaction of one approved commit records its undo state.
+enum class EHCICommitUndoMode : uint8
+{
+	// No commit scope active: tools fall back to plain Modify().
+	FullSnapshot,
+	// Known property writes are stored as compact before/after deltas; other writes still use Modify().
+	PropertyDelta,
+	// The estimate exceeded the memory ceiling: touched package files are copied to Saved/ before the first
+	// write and restored on undo, so the transaction buffer only holds a single file-level change.
+	PackageBackup
+};
+
+struct HCIEDITOR_API FHCICommitUndoEstimate
+{
+	int32 DeltaAssets = 0;
+	int32 SnapshotAssets = 0;
+	int64 FullSnapshotBytes = 0;
+	int64 EstimatedBytes = 0;
+	int64 CeilingBytes = 0;
+	// Write steps whose asset_paths/asset_path are pipeline templates ({{sN.asset_paths}}); they are counted
+	// once their resolved args are known, see FHCICommitUndoScope::NoteResolvedStep.
+	int32 DeferredSteps = 0;
+	EHCICommitUndoMode Mode = EHCICommitUndoMode::PropertyDelta;
+};
+
+struct FHCICommitPackageBackup
+{
+	FString PackageName;
+	FString PackageFilename;
+	FString BeforeFilename;
+	FString AfterFilename;
+};
+
+// Undo record for one property of one object, holding exported-text values instead of a full object snapshot.
+class HCIEDITOR_API FHCIPropertyDeltaChange final : public FCommandChange
+{
+public:
+	FHCIPropertyDeltaChange(FName InPropertyName, FString InBeforeText, FString InAfterText);
+
+	virtual void Apply(UObject* Object) override;
+	virtual void Revert(UObject* Object) override;
+	virtual FString ToString() const override;
+
+private:
+	void SetValue(UObject* Object, const FString& ValueText) const;
+
+	FName PropertyName;
+	FString BeforeText;
+	FString AfterText;
+};
+
+// Owns the HCI business transaction of a commit together with its undo mode. Wired tools route writes
+// through RecordPropertyChange / ModifyObject so the same code works with and without an active scope.
+class HCIEDITOR_API FHCICommitUndoScope
+{
+public:
+	// Estimates the undo footprint of Plan's write steps with literal targets: compact deltas for tools with
+	// known property writes, the on-disk package size for everything else. Mode becomes PackageBackup above
+	// CeilingBytes.
+	static FHCICommitUndoEstimate Estimate(const FHCIAgentPlan& Plan, int64 CeilingBytes);
+	static int64 GetConfiguredCeilingBytes();
+
+	static EHCICommitUndoMode GetActiveMode();
+
+	// Game thread only. Object must be a loaded asset; Mutate performs the actual write of PropertyName.
+	static void RecordPropertyChange(UObject* Object, FName PropertyName, TFunctionRef<void()> Mutate);
+	// For writes without a known compact delta.
+	static void ModifyObject(UObject* Object);
+	// Executor hook, called with a step's resolved args before its tool action runs. Adds deferred steps to the
+	// active scope's estimate and switches it to PackageBackup for the remaining writes once over the ceiling.
+	static void NoteResolvedStep(const FHCIAgentPlanStep& ResolvedStep);
+
+	FHCICommitUndoScope(const FHCIAgentPlan& Plan, const FText& Description);
+	~FHCICommitUndoScope();
+
+	EHCICommitUndoMode GetMode() const { return UndoEstimate.Mode; }
+
+private:
+	void AccountDeferredStep(const FHCIAgentPlanStep& ResolvedStep);
+	void BackupPackage(UPackage* Package);
+	void FinalizePackageBackups();
+
+	TUniquePtr<FScopedTransaction> Transaction;
+	FHCICommitUndoEstimate UndoEstimate;
+	FString RequestId;
+	FString BackupRoot;
+	TArray<FHCICommitPackageBackup> PackageBackups;
+	TSet<FName> BackedUpPackages;
+	TSet<FString> DeferredStepIds;
+	int32 RecordedDeltas = 0;
+	// Scopes nest (e.g. a preview-window commit while a sliced run is in flight); the innermost one is active.
+	FHCICommitUndoScope* PreviousScope = nullptr;
+
+	static FHCICommitUndoScope* ActiveScope;
+};
@@ -0,0 +1,387 @@
+#include "AgentActions/Support/HCILevelMeshScanIndex.h"
+
+#include "Components/StaticMeshComponent.h"
+#include "Editor.h"
+#include "Engine/Engine.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CoreDelegates.h"
+#include "UObject/UObjectGlobals.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogHCILevelMeshScanIndex, Log, All);
+
+namespace
+{
+constexpr int32 HCILevelMeshScanIndexMinCompactSlots = 1024;
+
+// GetTypeHash(FString) is case-insensitive, matching the IgnoreCase compares used for actor_names.
+static void HCI_ComputeActorNameHashes(const AActor& Actor, uint32 (&OutHashes)[3])
+{
+	OutHashes[0] = GetTypeHash(Actor.GetActorLabel());
+	OutHashes[1] = GetTypeHash(Actor.GetName());
+	OutHashes[2] = GetTypeHash(Actor.GetPathName());
+}
+
+static bool HCI_ActorMatchesName(const AActor& Actor, const FString& RequestedName)
+{
+	return Actor.GetActorLabel().Equals(RequestedName, ESearchCase::IgnoreCase) ||
+		Actor.GetName().Equals(RequestedName, ESearchCase::IgnoreCase) ||
+		Actor.GetPathName().Equals(RequestedName, ESearchCase::IgnoreCase);
+}
+} // namespace
+
+FHCILevelMeshScanIndex& FHCILevelMeshScanIndex::Get()
+{
+	static FHCILevelMeshScanIndex Instance;
+	return Instance;
+}
+
+void FHCILevelMeshScanIndex::SyncToWorld(UWorld* World)
+{
+	if (!World)
+	{
+		return;
+	}
+
+	BindDelegates();
+
+	if (bNeedsRebuild || IndexedWorld.Get() != World)
+	{
+		Rebuild(World);
+		return;
+	}
+
+	if (DirtyActors.Num() > 0)
+	{
+		for (const TObjectKey<AActor>& ActorKey : DirtyActors)
+		{
+			if (const int32* SlotIndex = SlotByActor.Find(ActorKey))
+			{
+				RefreshEntry(Slots[*SlotIndex]);
+			}
+		}
+		DirtyActors.Reset();
+	}
+
+	CompactIfSparse();
+}
+
+void FHCILevelMeshScanIndex::Invalidate()
+{
+	bNeedsRebuild = true;
+}
+
+void FHCILevelMeshScanIndex::Shutdown()
+{
+	UnbindDelegates();
+	Reset();
+	IndexedWorld.Reset();
+	bNeedsRebuild = true;
+}
+
+void FHCILevelMeshScanIndex::GetAllActors(TArray<AActor*>& OutActors) const
+{
+	OutActors.Reset(LiveActorCount);
+	for (const FActorEntry& Entry : Slots)
+	{
+		if (AActor* Actor = Entry.Actor.Get())
+		{
+			OutActors.Add(Actor);
+		}
+	}
+}
+
+void FHCILevelMeshScanIndex::FindActorsByNames(const TArray<FString>& Names, TArray<AActor*>& OutActors) const
+{
+	OutActors.Reset();
+
+	TArray<int32> MatchedSlots;
+	for (const FString& Name : Names)
+	{
+		const uint32 NameHash = GetTypeHash(Name);
+		for (TMultiMap<uint32, int32>::TConstKeyIterator It = SlotsByNameHash.CreateConstKeyIterator(NameHash); It; ++It)
+		{
+			const AActor* Actor = Slots[It.Value()].Actor.Get();
+			if (Actor && HCI_ActorMatchesName(*Actor, Name))
+			{
+				MatchedSlots.AddUnique(It.Value());
+			}
+		}
+	}
+
+	MatchedSlots.Sort();
+	OutActors.Reserve(MatchedSlots.Num());
+	for (const int32 SlotIndex : MatchedSlots)
+	{
+		OutActors.Add(Slots[SlotIndex].Actor.Get());
+	}
+}
+
+void FHCILevelMeshScanIndex::GatherMeshComponents(AActor* Actor, TArray<UStaticMeshComponent*>& OutComponents)
+{
+	OutComponents.Reset();
+	if (!Actor)
+	{
+		return;
+	}
+
+	const int32* SlotIndex = IsIndexedWorldActor(Actor) ? SlotByActor.Find(Actor) : nullptr;
+	if (!SlotIndex)
+	{
+		Actor->GetComponents<UStaticMeshComponent>(OutComponents);
+		return;
+	}
+
+	FActorEntry& Entry = Slots[*SlotIndex];
+	for (const TWeakObjectPtr<UStaticMeshComponent>& Component : Entry.MeshComponents)
+	{
+		UStaticMeshComponent* Resolved = Component.Get();
+		if (!Resolved || Resolved->GetOwner() != Actor)
+		{
+			// Construction scripts recreate components without an actor-level event; resync this entry.
+			RefreshEntry(Entry);
+			Actor->GetComponents<UStaticMeshComponent>(OutComponents);
+			return;
+		}
+		OutComponents.Add(Resolved);
+	}
+}
+
+void FHCILevelMeshScanIndex::BindDelegates()
+{
+	if (bDelegatesBound || !GEngine)
+	{
+		return;
+	}
+
+	LevelActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(this, &FHCILevelMeshScanIndex::HandleLevelActorAdded);
+	LevelActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FHCILevelMeshScanIndex::HandleLevelActorDeleted);
+	if (GEditor)
+	{
+		ActorMovedHandle = GEditor->OnActorMoved().AddRaw(this, &FHCILevelMeshScanIndex::HandleActorChanged);
+	}
+	ActorLabelChangedHandle = FCoreDelegates::OnActorLabelChanged.AddRaw(this, &FHCILevelMeshScanIndex::HandleActorLabelChanged);
+	LoadedActorAddedHandle = ULevel::OnLoadedActorAddedToLevelEvent.AddRaw(this, &FHCILevelMeshScanIndex::HandleLoadedActorAdded);
+	LoadedActorRemovedHandle = ULevel::OnLoadedActorRemovedFromLevelEvent.AddRaw(this, &FHCILevelMeshScanIndex::HandleLoadedActorRemoved);
+	ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FHCILevelMeshScanIndex::HandleObjectPropertyChanged);
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddRaw(this, &FHCILevelMeshScanIndex::HandleLevelsChanged);
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddRaw(this, &FHCILevelMeshScanIndex::HandleLevelsChanged);
+	bDelegatesBound = true;
+}
+
+void FHCILevelMeshScanIndex::UnbindDelegates()
+{
+	if (!bDelegatesBound)
+	{
+		return;
+	}
+
+	if (GEngine)
+	{
+		GEngine->OnLevelActorAdded().Remove(LevelActorAddedHandle);
+		GEngine->OnLevelActorDeleted().Remove(LevelActorDeletedHandle);
+	}
+	if (GEditor)
+	{
+		GEditor->OnActorMoved().Remove(ActorMovedHandle);
+	}
+	FCoreDelegates::OnActorLabelChanged.Remove(ActorLabelChangedHandle);
+	ULevel::OnLoadedActorAddedToLevelEvent.Remove(LoadedActorAddedHandle);
+	ULevel::OnLoadedActorRemovedFromLevelEvent.Remove(LoadedActorRemovedHandle);
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+	bDelegatesBound = false;
+}
+
+void FHCILevelMeshScanIndex::Reset()
+{
+	Slots.Reset();
+	SlotByActor.Reset();
+	SlotsByNameHash.Reset();
+	DirtyActors.Reset();
+	LiveActorCount = 0;
+}
+
+void FHCILevelMeshScanIndex::Rebuild(UWorld* World)
+{
+	const double StartSeconds = FPlatformTime::Seconds();
+	Reset();
+	IndexedWorld = World;
+	bNeedsRebuild = false;
+	++RebuildCount;
+
+	for (TActorIterator<AActor> It(World); It; ++It)
+	{
+		AddActor(*It);
+	}
+
+	UE_LOG(
+		LogHCILevelMeshScanIndex,
+		Display,
+		TEXT("[HCI][LevelMeshScanIndex] rebuild world=%s actors=%d elapsed_ms=%.2f"),
+		*World->GetName(),
+		LiveActorCount,
+		(FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+}
+
+void FHCILevelMeshScanIndex::AddActor(AActor* Actor)
+{
+	if (!Actor || SlotByActor.Contains(Actor))
+	{
+		return;
+	}
+
+	const int32 SlotIndex = Slots.AddDefaulted();
+	Slots[SlotIndex].Actor = Actor;
+	SlotByActor.Add(Actor, SlotIndex);
+	++LiveActorCount;
+	RefreshEntry(Slots[SlotIndex]);
+}
+
+void FHCILevelMeshScanIndex::RemoveActor(const AActor* Actor)
+{
+	int32 SlotIndex = INDEX_NONE;
+	if (!Actor || !SlotByActor.RemoveAndCopyValue(Actor, SlotIndex))
+	{
+		return;
+	}
+
+	RemoveNameHashes(SlotIndex);
+	Slots[SlotIndex] = FActorEntry();
+	DirtyActors.Remove(Actor);
+	--LiveActorCount;
+}
+
+void FHCILevelMeshScanIndex::RefreshEntry(FActorEntry& Entry)
+{
+	const int32 SlotIndex = static_cast<int32>(&Entry - Slots.GetData());
+	RemoveNameHashes(SlotIndex);
+	Entry.MeshComponents.Reset();
+
+	AActor* Actor = Entry.Actor.Get();
+	if (!Actor)
+	{
+		return;
+	}
+
+	TArray<UStaticMeshComponent*> Components;
+	Actor->GetComponents<UStaticMeshComponent>(Components);
+	Entry.MeshComponents.Reserve(Components.Num());
+	for (UStaticMeshComponent* Component : Components)
+	{
+		Entry.MeshComponents.Add(Component);
+	}
+
+	HCI_ComputeActorNameHashes(*Actor, Entry.NameHashes);
+	AddNameHashes(SlotIndex);
+}
+
+void FHCILevelMeshScanIndex::AddNameHashes(const int32 SlotIndex)
+{
+	for (const uint32 NameHash : Slots[SlotIndex].NameHashes)
+	{
+		SlotsByNameHash.AddUnique(NameHash, SlotIndex);
+	}
+}
+
+void FHCILevelMeshScanIndex::RemoveNameHashes(const int32 SlotIndex)
+{
+	for (const uint32 NameHash : Slots[SlotIndex].NameHashes)
+	{
+		SlotsByNameHash.Remove(NameHash, SlotIndex);
+	}
+}
+
+void FHCILevelMeshScanIndex::CompactIfSparse()
+{
+	const int32 DeadSlotCount = Slots.Num() - LiveActorCount;
+	if (DeadSlotCount < HCILevelMeshScanIndexMinCompactSlots || DeadSlotCount * 2 < Slots.Num())
+	{
+		return;
+	}
+
+	TArray<FActorEntry> LiveSlots;
+	LiveSlots.Reserve(LiveActorCount);
+	SlotByActor.Reset();
+	SlotsByNameHash.Reset();
+	for (FActorEntry& Entry : Slots)
+	{
+		if (AActor* Actor = Entry.Actor.Get())
+		{
+			const int32 SlotIndex = LiveSlots.Add(MoveTemp(Entry));
+			SlotByActor.Add(Actor, SlotIndex);
+		}
+	}
+	Slots = MoveTemp(LiveSlots);
+	LiveActorCount = Slots.Num();
+	for (int32 SlotIndex = 0; SlotIndex < Slots.Num(); ++SlotIndex)
+	{
+		AddNameHashes(SlotIndex);
+	}
+}
+
+bool FHCILevelMeshScanIndex::IsIndexedWorldActor(const AActor* Actor) const
+{
+	return Actor && !bNeedsRebuild && IndexedWorld.IsValid() && Actor->GetWorld() == IndexedWorld.Get();
+}
+
+void FHCILevelMeshScanIndex::HandleLevelActorAdded(AActor* Actor)
+{
+	if (IsIndexedWorldActor(Actor))
+	{
+		AddActor(Actor);
+		// Components can still change during spawn finalization; re-gather on the next scan.
+		DirtyActors.Add(Actor);
+	}
+}
+
+void FHCILevelMeshScanIndex::HandleLevelActorDeleted(AActor* Actor)
+{
+	RemoveActor(Actor);
+}
+
+void FHCILevelMeshScanIndex::HandleActorChanged(AActor* Actor)
+{
+	if (Actor && SlotByActor.Contains(Actor))
+	{
+		DirtyActors.Add(Actor);
+	}
+}
+
+void FHCILevelMeshScanIndex::HandleActorLabelChanged(AActor* Actor)
+{
+	HandleActorChanged(Actor);
+}
+
+void FHCILevelMeshScanIndex::HandleLoadedActorAdded(AActor& Actor)
+{
+	HandleLevelActorAdded(&Actor);
+}
+
+void FHCILevelMeshScanIndex::HandleLoadedActorRemoved(AActor& Actor)
+{
+	RemoveActor(&Actor);
+}
+
+void FHCILevelMeshScanIndex::HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event)
+{
+	if (AActor* Actor = Cast<AActor>(Object))
+	{
+		HandleActorChanged(Actor);
+	}
+	else if (const UActorComponent* Component = Cast<UActorComponent>(Object))
+	{
+		HandleActorChanged(Component->GetOwner());
+	}
+}
+
+void FHCILevelMeshScanIndex::HandleLevelsChanged(ULevel* Level, UWorld* World)
+{
+	if (World && World == IndexedWorld.Get())
+	{
+		bNeedsRebuild = true;
+	}
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtr.h"
+
+class AActor;
+class ULevel;
+class UObject;
+class UStaticMeshComponent;
+class UWorld;
+struct FPropertyChangedEvent;
+
+// Per-world actor index used by ScanLevelMeshRisks. Keeps actor order, static mesh components and
+// case-insensitive name hashes current through level actor add/delete/move events so a scan does not
+// walk every actor and component of a large world again.
+class FHCILevelMeshScanIndex
+{
+public:
+	static FHCILevelMeshScanIndex& Get();
+
+	// Rebuilds when World is not the indexed world (or the index was invalidated), then refreshes dirty actors.
+	void SyncToWorld(UWorld* World);
+	void Invalidate();
+	void Shutdown();
+
+	int32 GetActorCount() const { return LiveActorCount; }
+	int32 GetRebuildCount() const { return RebuildCount; }
+
+	// Both return actors in index (iteration) order.
+	void GetAllActors(TArray<AActor*>& OutActors) const;
+	void FindActorsByNames(const TArray<FString>& Names, TArray<AActor*>& OutActors) const;
+
+	// Uses the cached component list when the actor is indexed and clean; falls back to GetComponents otherwise.
+	void GatherMeshComponents(AActor* Actor, TArray<UStaticMeshComponent*>& OutComponents);
+
+private:
+	struct FActorEntry
+	{
+		TWeakObjectPtr<AActor> Actor;
+		TArray<TWeakObjectPtr<UStaticMeshComponent>> MeshComponents;
+		uint32 NameHashes[3] = {0, 0, 0};
+	};
+
+	void BindDelegates();
+	void UnbindDelegates();
+	void Reset();
+	void Rebuild(UWorld* World);
+	void AddActor(AActor* Actor);
+	void RemoveActor(const AActor* Actor);
+	void RefreshEntry(FActorEntry& Entry);
+	void AddNameHashes(int32 SlotIndex);
+	void RemoveNameHashes(int32 SlotIndex);
+	void CompactIfSparse();
+	bool IsIndexedWorldActor(const AActor* Actor) const;
+
+	void HandleLevelActorAdded(AActor* Actor);
+	void HandleLevelActorDeleted(AActor* Actor);
+	void HandleActorChanged(AActor* Actor);
+	void HandleActorLabelChanged(AActor* Actor);
+	void HandleLoadedActorAdded(AActor& Actor);
+	void HandleLoadedActorRemoved(AActor& Actor);
+	void HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event);
+	void HandleLevelsChanged(ULevel* Level, UWorld* World);
+
+	TWeakObjectPtr<UWorld> IndexedWorld;
+	// Removed actors leave a null slot so iteration order stays stable; compacted when sparse.
+	TArray<FActorEntry> Slots;
+	TMap<TObjectKey<AActor>, int32> SlotByActor;
+	TMultiMap<uint32, int32> SlotsByNameHash;
+	TSet<TObjectKey<AActor>> DirtyActors;
+	int32 LiveActorCount = 0;
+	int32 RebuildCount = 0;
+	bool bNeedsRebuild = true;
+	bool bDelegatesBound = false;
+
+	FDelegateHandle LevelActorAddedHandle;
+	FDelegateHandle LevelActorDeletedHandle;
+	FDelegateHandle ActorMovedHandle;
+	FDelegateHandle ActorLabelChangedHandle;
+	FDelegateHandle LoadedActorAddedHandle;
+	FDelegateHandle LoadedActorRemovedHandle;
+	FDelegateHandle ObjectPropertyChangedHandle;
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle LevelRemovedHandle;
+};
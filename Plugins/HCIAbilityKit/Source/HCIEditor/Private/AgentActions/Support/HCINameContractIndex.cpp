@@ -0,0 +1,458 @@
+#include "AgentActions/Support/HCINameContractIndex.h"
+
+#include "AgentActions/Support/HCIAssetNamingRules.h"
+#include "AgentActions/Support/HCIAssetPathUtils.h"
+
+#include "Engine/StaticMesh.h"
+#include "Engine/Texture2D.h"
+
+namespace
+{
+constexpr int32 HCINameContractMaxClassifiedNames = 200000;
+constexpr int32 HCINameContractMaxCachedGroupings = 4;
+
+static void HCI_ParseStrictContract(const FString& AssetName, const TArray<FString>& Parts, FHCINameContractClassification& InOut)
+{
+	if (AssetName.StartsWith(TEXT("SM_")) && AssetName.Len() > 3)
+	{
+		const FString Id = HCIAssetNamingRules::SanitizeIdentifier(AssetName.Mid(3).TrimStartAndEnd());
+		if (!Id.IsEmpty())
+		{
+			InOut.Kind = EHCINameContractKind::Mesh;
+			InOut.Id = Id;
+			return;
+		}
+	}
+
+	// T_<ID>_<ROLE>
+	if (!AssetName.StartsWith(TEXT("T_")) || AssetName.Len() <= 2 || Parts.Num() < 3)
+	{
+		return;
+	}
+
+	const FString Role = Parts.Last().ToUpper();
+	EHCITextureRole StrictRole = EHCITextureRole::Unknown;
+	if (Role == TEXT("BC"))
+	{
+		StrictRole = EHCITextureRole::BC;
+	}
+	else if (Role == TEXT("N"))
+	{
+		StrictRole = EHCITextureRole::N;
+	}
+	else if (Role == TEXT("ORM") || Role == TEXT("RMA") || Role == TEXT("ARM"))
+	{
+		StrictRole = EHCITextureRole::ORM;
+	}
+	else
+	{
+		return;
+	}
+
+	FString Id;
+	for (int32 Index = 1; Index < Parts.Num() - 1; ++Index)
+	{
+		if (!Id.IsEmpty())
+		{
+			Id += TEXT("_");
+		}
+		Id += Parts[Index];
+	}
+	Id = HCIAssetNamingRules::SanitizeIdentifier(Id);
+	if (Id.IsEmpty())
+	{
+		return;
+	}
+
+	InOut.Kind = EHCINameContractKind::Texture;
+	InOut.Id = MoveTemp(Id);
+	InOut.StrictRole = StrictRole;
+}
+
+static FString HCI_BuildStrictContractOrphanReason(const FString& AssetName, const TArray<FString>& Parts)
+{
+	if (AssetName.StartsWith(TEXT("T_")))
+	{
+		const FString Tail = Parts.Num() > 0 ? Parts.Last().ToUpper() : FString();
+		if (Tail == TEXT("COLOR") || Tail == TEXT("BASECOLOR") || Tail == TEXT("ALBEDO") || Tail == TEXT("DIFFUSE"))
+		{
+			return TEXT("贴图后缀不满足契约（末尾为 Color，期望: _BC）");
+		}
+		if (Tail == TEXT("NORMAL") || Tail == TEXT("NORMALMAP"))
+		{
+			return TEXT("贴图后缀不满足契约（末尾为 Normal，期望: _N）");
+		}
+		if (Tail.Contains(TEXT("ORM")) || Tail.Contains(TEXT("RMA")) || Tail.Contains(TEXT("ARM")))
+		{
+			return TEXT("贴图后缀不满足契约（期望: _ORM 或 _RMA）");
+		}
+		return TEXT("贴图命名不满足严格契约（期望: T_<ID>_BC / T_<ID>_N / T_<ID>_ORM）");
+	}
+
+	if (AssetName.StartsWith(TEXT("SM_")))
+	{
+		return TEXT("Mesh 命名不满足严格契约（期望: SM_<ID>）");
+	}
+
+	return TEXT("命名不满足严格契约（期望: SM_<ID> 或 T_<ID>_BC/N/ORM）");
+}
+
+static EHCITextureRole HCI_DetectLooseTextureRole(const FString& NameLower)
+{
+	auto HasToken = [&NameLower](const TCHAR* Token)
+	{
+		return NameLower.Contains(Token, ESearchCase::CaseSensitive);
+	};
+
+	// Prefer explicit suffix-like tokens.
+	if (HasToken(TEXT("_orm")) || HasToken(TEXT("occlusionroughnessmetallic")) || HasToken(TEXT("_rma")) || HasToken(TEXT("_mrao")) || HasToken(TEXT("_aorm")))
+	{
+		return EHCITextureRole::ORM;
+	}
+	if (HasToken(TEXT("_bc")) || HasToken(TEXT("basecolor")) || HasToken(TEXT("albedo")) || HasToken(TEXT("diffuse")) || HasToken(TEXT("_col")) || HasToken(TEXT("_color")))
+	{
+		return EHCITextureRole::BC;
+	}
+	if (HasToken(TEXT("_n")) || HasToken(TEXT("normal")) || HasToken(TEXT("_nrm")) || HasToken(TEXT("_nor")))
+	{
+		return EHCITextureRole::N;
+	}
+	return EHCITextureRole::Unknown;
+}
+
+static int32 HCI_LooseTextureRoleQuality(const FString& NameLower, const EHCITextureRole Role)
+{
+	switch (Role)
+	{
+	case EHCITextureRole::BC:
+		if (NameLower.EndsWith(TEXT("_bc")) || NameLower.Contains(TEXT("_bc_")))
+		{
+			return 3;
+		}
+		if (NameLower.Contains(TEXT("basecolor")) || NameLower.Contains(TEXT("albedo")))
+		{
+			return 2;
+		}
+		if (NameLower.Contains(TEXT("diffuse")) || NameLower.Contains(TEXT("color")))
+		{
+			return 1;
+		}
+		return 0;
+	case EHCITextureRole::N:
+		if (NameLower.EndsWith(TEXT("_n")) || NameLower.Contains(TEXT("_n_")))
+		{
+			return 3;
+		}
+		if (NameLower.Contains(TEXT("normal")))
+		{
+			return 2;
+		}
+		return 0;
+	case EHCITextureRole::ORM:
+		if (NameLower.EndsWith(TEXT("_orm")) || NameLower.Contains(TEXT("_orm_")))
+		{
+			return 3;
+		}
+		if (NameLower.Contains(TEXT("occlusionroughnessmetallic")) || NameLower.Contains(TEXT("_rma")) || NameLower.Contains(TEXT("_mrao")))
+		{
+			return 2;
+		}
+		return 0;
+	default:
+		return 0;
+	}
+}
+
+static FString HCI_ExtractAssetNameFromObjectOrAssetPath(const FString& InPath)
+{
+	FString PackagePath;
+	FString AssetName;
+	if (HCIAssetPathUtils::TrySplitObjectPath(InPath, PackagePath, AssetName))
+	{
+		return AssetName;
+	}
+	return FString();
+}
+
+static uint32 HCI_HashAssetPaths(const TArray<FString>& AssetPaths)
+{
+	uint32 Hash = GetTypeHash(AssetPaths.Num());
+	for (const FString& Path : AssetPaths)
+	{
+		Hash = HashCombineFast(Hash, FCrc::StrCrc32(*Path));
+	}
+	return Hash;
+}
+
+static bool HCI_AssetPathsEqual(const TArray<FString>& Lhs, const TArray<FString>& Rhs)
+{
+	if (Lhs.Num() != Rhs.Num())
+	{
+		return false;
+	}
+	for (int32 Index = 0; Index < Lhs.Num(); ++Index)
+	{
+		if (!Lhs[Index].Equals(Rhs[Index], ESearchCase::CaseSensitive))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+static void HCI_SortedUnique(TArray<FString>& InOut)
+{
+	InOut.Sort([](const FString& A, const FString& B) { return A < B; });
+	for (int32 Index = InOut.Num() - 1; Index > 0; --Index)
+	{
+		if (InOut[Index].Equals(InOut[Index - 1], ESearchCase::CaseSensitive))
+		{
+			InOut.RemoveAt(Index, 1, EAllowShrinking::No);
+		}
+	}
+}
+} // namespace
+
+FHCINameContractIndex& FHCINameContractIndex::Get()
+{
+	static FHCINameContractIndex Instance;
+	return Instance;
+}
+
+FString FHCINameContractIndex::RoleToString(const EHCITextureRole Role)
+{
+	switch (Role)
+	{
+	case EHCITextureRole::BC:
+		return TEXT("BC");
+	case EHCITextureRole::N:
+		return TEXT("N");
+	case EHCITextureRole::ORM:
+		return TEXT("ORM");
+	default:
+		return TEXT("Unknown");
+	}
+}
+
+FHCINameContractClassification FHCINameContractIndex::ClassifyName(const FString& AssetName)
+{
+	FHCINameContractClassification Out;
+
+	TArray<FString> Parts;
+	AssetName.ParseIntoArray(Parts, TEXT("_"), true);
+	HCI_ParseStrictContract(AssetName, Parts, Out);
+	if (Out.Kind == EHCINameContractKind::None)
+	{
+		Out.OrphanReason = HCI_BuildStrictContractOrphanReason(AssetName, Parts);
+	}
+
+	const FString NameLower = AssetName.ToLower();
+	Out.LooseRole = HCI_DetectLooseTextureRole(NameLower);
+	Out.LooseRoleQuality = HCI_LooseTextureRoleQuality(NameLower, Out.LooseRole);
+	return Out;
+}
+
+const FHCINameContractClassification& FHCINameContractIndex::Classify(const FString& AssetName)
+{
+	if (const FHCINameContractClassification* Cached = ClassificationByName.Find(AssetName))
+	{
+		return *Cached;
+	}
+	if (ClassificationByName.Num() >= HCINameContractMaxClassifiedNames)
+	{
+		ClassificationByName.Reset();
+	}
+	return ClassificationByName.Add(AssetName, ClassifyName(AssetName));
+}
+
+TSharedRef<const FHCINameContractGrouping> FHCINameContractIndex::GetGrouping(const TArray<FString>& AssetPaths, bool* bOutFromCache)
+{
+	const uint32 PathsHash = HCI_HashAssetPaths(AssetPaths);
+	for (int32 Index = RecentGroupings.Num() - 1; Index >= 0; --Index)
+	{
+		FCachedGrouping& Cached = RecentGroupings[Index];
+		if (Cached.PathsHash == PathsHash && HCI_AssetPathsEqual(Cached.AssetPaths, AssetPaths))
+		{
+			const TSharedRef<const FHCINameContractGrouping> Grouping = Cached.Grouping.ToSharedRef();
+			if (Index != RecentGroupings.Num() - 1)
+			{
+				FCachedGrouping Moved = MoveTemp(Cached);
+				RecentGroupings.RemoveAt(Index, 1, EAllowShrinking::No);
+				RecentGroupings.Add(MoveTemp(Moved));
+			}
+			if (bOutFromCache)
+			{
+				*bOutFromCache = true;
+			}
+			return Grouping;
+		}
+	}
+
+	const TSharedRef<const FHCINameContractGrouping> Grouping = BuildGrouping(AssetPaths);
+	if (RecentGroupings.Num() >= HCINameContractMaxCachedGroupings)
+	{
+		RecentGroupings.RemoveAt(0, 1, EAllowShrinking::No);
+	}
+	FCachedGrouping& Slot = RecentGroupings.AddDefaulted_GetRef();
+	Slot.PathsHash = PathsHash;
+	Slot.AssetPaths = AssetPaths;
+	Slot.Grouping = Grouping;
+	if (bOutFromCache)
+	{
+		*bOutFromCache = false;
+	}
+	return Grouping;
+}
+
+bool FHCINameContractIndex::ResolveGroupAssets(
+	const TArray<FHCINameContractGroup>& Groups,
+	const TFunctionRef<UObject*(const FString&)> LoadAsset,
+	TArray<FHCINameContractGroupAssets>& OutAssets,
+	FString& OutFailedPath)
+{
+	OutAssets.Reset(Groups.Num());
+	OutFailedPath.Reset();
+	for (const FHCINameContractGroup& Group : Groups)
+	{
+		FHCINameContractGroupAssets& Assets = OutAssets.AddDefaulted_GetRef();
+		Assets.Mesh = Cast<UStaticMesh>(LoadAsset(Group.MeshObjectPath));
+		Assets.TextureBC = Cast<UTexture2D>(LoadAsset(Group.TextureBCObjectPath));
+		Assets.TextureN = Cast<UTexture2D>(LoadAsset(Group.TextureNObjectPath));
+		Assets.TextureORM = Cast<UTexture2D>(LoadAsset(Group.TextureORMObjectPath));
+		OutFailedPath = !Assets.Mesh ? Group.MeshObjectPath
+			: !Assets.TextureBC ? Group.TextureBCObjectPath
+			: !Assets.TextureN ? Group.TextureNObjectPath
+			: !Assets.TextureORM ? Group.TextureORMObjectPath
+			: FString();
+		if (!OutFailedPath.IsEmpty())
+		{
+			OutAssets.Reset();
+			return false;
+		}
+	}
+	return true;
+}
+
+void FHCINameContractIndex::Reset()
+{
+	ClassificationByName.Reset();
+	RecentGroupings.Reset();
+}
+
+TSharedRef<const FHCINameContractGrouping> FHCINameContractIndex::BuildGrouping(const TArray<FString>& AssetPaths)
+{
+	++GroupingBuildCount;
+	const TSharedRef<FHCINameContractGrouping> Out = MakeShared<FHCINameContractGrouping>();
+
+	TArray<FHCINameContractGroup> Groups;
+	TMap<FString, int32> GroupIndexById;
+	TSet<FString> OrphanSet;
+	TSet<FString> UnresolvedSet;
+
+	for (const FString& Path : AssetPaths)
+	{
+		const FString AssetName = HCI_ExtractAssetNameFromObjectOrAssetPath(Path);
+		if (AssetName.IsEmpty())
+		{
+			continue;
+		}
+
+		const FHCINameContractClassification& Classification = Classify(AssetName);
+		if (Classification.Kind == EHCINameContractKind::None)
+		{
+			// Not matching strict contract (common in real projects): treat as orphan so artists can locate & fix.
+			OrphanSet.Add(Path);
+			if (!Out->OrphanReasonByPath.Contains(Path))
+			{
+				Out->OrphanReasonByPath.Add(Path, Classification.OrphanReason);
+			}
+			continue;
+		}
+
+		int32& GroupIndex = GroupIndexById.FindOrAdd(Classification.Id, INDEX_NONE);
+		if (GroupIndex == INDEX_NONE)
+		{
+			GroupIndex = Groups.AddDefaulted();
+		}
+		FHCINameContractGroup& Group = Groups[GroupIndex];
+		Group.Id = Classification.Id;
+
+		if (Classification.Kind == EHCINameContractKind::Mesh)
+		{
+			if (!Group.MeshObjectPath.IsEmpty() && !Group.MeshObjectPath.Equals(Path, ESearchCase::CaseSensitive))
+			{
+				Out->MissingGroups.Add(FString::Printf(TEXT("%s (duplicate_mesh)"), *Classification.Id));
+				continue;
+			}
+			Group.MeshObjectPath = Path;
+			continue;
+		}
+
+		switch (Classification.StrictRole)
+		{
+		case EHCITextureRole::BC:
+			Group.TextureBCObjectPath = Path;
+			break;
+		case EHCITextureRole::N:
+			Group.TextureNObjectPath = Path;
+			break;
+		case EHCITextureRole::ORM:
+			Group.TextureORMObjectPath = Path;
+			break;
+		default:
+			break;
+		}
+	}
+
+	Out->ReadyGroups.Reserve(Groups.Num());
+	for (FHCINameContractGroup& Group : Groups)
+	{
+		if (Group.MeshObjectPath.IsEmpty())
+		{
+			// Textures that look contract-ish but have no mesh partner are also orphans in practice.
+			const FString Reason = FString::Printf(TEXT("贴图疑似契约（ID=%s），但缺少配对 Mesh：SM_%s"), *Group.Id, *Group.Id);
+			for (const FString* TexturePath : {&Group.TextureBCObjectPath, &Group.TextureNObjectPath, &Group.TextureORMObjectPath})
+			{
+				if (!TexturePath->IsEmpty())
+				{
+					OrphanSet.Add(*TexturePath);
+					Out->OrphanReasonByPath.FindOrAdd(*TexturePath) = Reason;
+				}
+			}
+			continue;
+		}
+
+		if (Group.TextureBCObjectPath.IsEmpty() || Group.TextureNObjectPath.IsEmpty() || Group.TextureORMObjectPath.IsEmpty())
+		{
+			TArray<FString> MissingRoles;
+			if (Group.TextureBCObjectPath.IsEmpty()) { MissingRoles.Add(TEXT("BC")); }
+			if (Group.TextureNObjectPath.IsEmpty()) { MissingRoles.Add(TEXT("N")); }
+			if (Group.TextureORMObjectPath.IsEmpty()) { MissingRoles.Add(TEXT("ORM")); }
+			const FString MissingLabel = MissingRoles.Num() > 0 ? FString::Join(MissingRoles, TEXT("/")) : TEXT("BC/N/ORM");
+
+			// Partial match: we found a mesh (and maybe some textures), but cannot complete a full PBR set.
+			UnresolvedSet.Add(Group.MeshObjectPath);
+			Out->UnresolvedReasonByPath.FindOrAdd(Group.MeshObjectPath) = FString::Printf(TEXT("Mesh ID=%s 缺少贴图：T_%s_%s"), *Group.Id, *Group.Id, *MissingLabel);
+			const FString TextureReason = FString::Printf(TEXT("该组 ID=%s 缺少贴图：%s"), *Group.Id, *MissingLabel);
+			for (const FString* TexturePath : {&Group.TextureBCObjectPath, &Group.TextureNObjectPath, &Group.TextureORMObjectPath})
+			{
+				if (!TexturePath->IsEmpty())
+				{
+					UnresolvedSet.Add(*TexturePath);
+					Out->UnresolvedReasonByPath.FindOrAdd(*TexturePath) = TextureReason;
+				}
+			}
+
+			Out->MissingGroups.Add(FString::Printf(TEXT("%s (missing_textures)"), *Group.Id));
+			continue;
+		}
+
+		Out->ReadyGroups.Add(MoveTemp(Group));
+	}
+
+	Out->OrphanAssets = OrphanSet.Array();
+	Out->UnresolvedAssets = UnresolvedSet.Array();
+	HCI_SortedUnique(Out->OrphanAssets);
+	HCI_SortedUnique(Out->UnresolvedAssets);
+	return Out;
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UStaticMesh;
+class UTexture2D;
+
+enum class EHCITextureRole : uint8
+{
+	Unknown = 0,
+	BC,
+	N,
+	ORM
+};
+
+enum class EHCINameContractKind : uint8
+{
+	None = 0,
+	Mesh,
+	Texture
+};
+
+// Everything derived from one asset name; computed once per distinct name.
+struct FHCINameContractClassification
+{
+	// Strict contract: SM_<ID> or T_<ID>_<BC|N|ORM|RMA|ARM>.
+	EHCINameContractKind Kind = EHCINameContractKind::None;
+	FString Id;
+	EHCITextureRole StrictRole = EHCITextureRole::Unknown;
+	// Empty when the name satisfies the strict contract.
+	FString OrphanReason;
+
+	// Loose token heuristics (MatLink fixtures): role and how explicit the role token is (0..3).
+	EHCITextureRole LooseRole = EHCITextureRole::Unknown;
+	int32 LooseRoleQuality = 0;
+};
+
+struct FHCINameContractGroup
+{
+	FString Id;
+	FString MeshObjectPath;
+	FString TextureBCObjectPath;
+	FString TextureNObjectPath;
+	FString TextureORMObjectPath;
+};
+
+// Loaded assets of one ready group.
+struct FHCINameContractGroupAssets
+{
+	UStaticMesh* Mesh = nullptr;
+	UTexture2D* TextureBC = nullptr;
+	UTexture2D* TextureN = nullptr;
+	UTexture2D* TextureORM = nullptr;
+};
+
+// Grouping of one asset_paths input; a pure function of the path list.
+struct FHCINameContractGrouping
+{
+	TArray<FHCINameContractGroup> ReadyGroups;
+	TArray<FString> MissingGroups;
+	// Sorted, unique.
+	TArray<FString> OrphanAssets;
+	TArray<FString> UnresolvedAssets;
+	TMap<FString, FString> OrphanReasonByPath;
+	TMap<FString, FString> UnresolvedReasonByPath;
+};
+
+// Shared name-contract index for AutoMaterialSetupByNameContract and the MatLink fixtures. Names are
+// tokenized and classified once; groupings are kept for the last few inputs so a dry-run followed by
+// execute on the same folder groups only once.
+class FHCINameContractIndex
+{
+public:
+	static FHCINameContractIndex& Get();
+
+	static FString RoleToString(EHCITextureRole Role);
+	static FHCINameContractClassification ClassifyName(const FString& AssetName);
+
+	// Cached ClassifyName; the reference is valid until the next Classify call.
+	const FHCINameContractClassification& Classify(const FString& AssetName);
+	TSharedRef<const FHCINameContractGrouping> GetGrouping(const TArray<FString>& AssetPaths, bool* bOutFromCache = nullptr);
+
+	// Loads the mesh and textures of every group up front, so a commit either has all of them or writes nothing.
+	// On failure OutAssets is empty and OutFailedPath is the first path that did not load as the expected class.
+	static bool ResolveGroupAssets(
+		const TArray<FHCINameContractGroup>& Groups,
+		TFunctionRef<UObject*(const FString&)> LoadAsset,
+		TArray<FHCINameContractGroupAssets>& OutAssets,
+		FString& OutFailedPath);
+
+	void Reset();
+	int32 GetClassifiedNameCount() const { return ClassificationByName.Num(); }
+	int32 GetGroupingBuildCount() const { return GroupingBuildCount; }
+
+private:
+	// Asset names are classified verbatim; the default FString key funcs would fold SM_Rock and SM_ROCK.
+	struct FCaseSensitiveNameKeyFuncs : TDefaultMapKeyFuncs<FString, FHCINameContractClassification, false>
+	{
+		static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+		static uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32(*Key); }
+	};
+
+	struct FCachedGrouping
+	{
+		uint32 PathsHash = 0;
+		TArray<FString> AssetPaths;
+		TSharedPtr<const FHCINameContractGrouping> Grouping;
+	};
+
+	TSharedRef<const FHCINameContractGrouping> BuildGrouping(const TArray<FString>& AssetPaths);
+
+	TMap<FString, FHCINameContractClassification, FDefaultSetAllocator, FCaseSensitiveNameKeyFuncs> ClassificationByName;
+	// Most recent last.
+	TArray<FCachedGrouping> RecentGroupings;
+	int32 GroupingBuildCount = 0;
+};
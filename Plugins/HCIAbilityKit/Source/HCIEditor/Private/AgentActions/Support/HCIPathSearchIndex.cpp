@@ -0,0 +1,356 @@
+#include "AgentActions/Support/HCIPathSearchIndex.h"
+
+#include "AgentActions/Support/HCIAssetPathUtils.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Modules/ModuleManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogHCIPathSearchIndex, Log, All);
+
+namespace
+{
+constexpr int32 HCIPathSearchTrigramLength = 3;
+// Leaves shorter than this never count as "keyword contains leaf" (see HCI_ScoreNormalized).
+constexpr int32 HCIPathSearchMinLeafInKeywordLength = 3;
+
+static uint64 HCI_MakeTrigramKey(const TCHAR* Chars)
+{
+	return (static_cast<uint64>(Chars[0]) << 42) | (static_cast<uint64>(Chars[1]) << 21) | static_cast<uint64>(Chars[2]);
+}
+
+static int32 HCI_ScoreNormalized(
+	const FString& LeafNormalized,
+	const FString& PathNormalized,
+	const bool bEndsWithLeaf,
+	const FString& KeywordNormalized)
+{
+	if (KeywordNormalized.IsEmpty())
+	{
+		return 0;
+	}
+
+	const bool bLeafExact = (LeafNormalized == KeywordNormalized);
+	const bool bLeafContainsKeyword = LeafNormalized.Contains(KeywordNormalized);
+	const bool bKeywordContainsLeaf = (LeafNormalized.Len() >= HCIPathSearchMinLeafInKeywordLength) && KeywordNormalized.Contains(LeafNormalized);
+	const bool bPathContainsKeyword = PathNormalized.Contains(KeywordNormalized);
+	if (!bLeafExact && !bLeafContainsKeyword && !bKeywordContainsLeaf && !bPathContainsKeyword)
+	{
+		return 0;
+	}
+
+	int32 Score = 0;
+	if (bLeafExact)
+	{
+		Score += 1400;
+	}
+	if (LeafNormalized.StartsWith(KeywordNormalized))
+	{
+		Score += 700;
+	}
+	if (bLeafContainsKeyword)
+	{
+		Score += 550;
+	}
+	if (bKeywordContainsLeaf)
+	{
+		Score += 500;
+	}
+	if (bPathContainsKeyword)
+	{
+		Score += 350;
+	}
+	if (bEndsWithLeaf)
+	{
+		Score += 250;
+	}
+	Score += FMath::Min(80, KeywordNormalized.Len() * 4);
+	return Score;
+}
+} // namespace
+
+FHCIPathSearchIndex& FHCIPathSearchIndex::Get()
+{
+	static FHCIPathSearchIndex Instance;
+	return Instance;
+}
+
+FString FHCIPathSearchIndex::NormalizeFuzzyToken(const FString& Text)
+{
+	FString Normalized = Text.ToLower();
+	Normalized.ReplaceInline(TEXT("_"), TEXT(""), ESearchCase::CaseSensitive);
+	Normalized.ReplaceInline(TEXT(" "), TEXT(""), ESearchCase::CaseSensitive);
+	Normalized.ReplaceInline(TEXT("-"), TEXT(""), ESearchCase::CaseSensitive);
+	return Normalized;
+}
+
+int32 FHCIPathSearchIndex::ComputePathKeywordScore(const FString& Path, const FString& Keyword)
+{
+	const FString Leaf = HCIAssetPathUtils::GetDirectoryLeafName(Path);
+	return HCI_ScoreNormalized(
+		NormalizeFuzzyToken(Leaf),
+		NormalizeFuzzyToken(Path),
+		Path.EndsWith(Leaf),
+		NormalizeFuzzyToken(Keyword));
+}
+
+void FHCIPathSearchIndex::EnsureBoundToAssetRegistry()
+{
+	if (bBoundToAssetRegistry)
+	{
+		return;
+	}
+
+	IAssetRegistry& Registry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	PathAddedHandle = Registry.OnPathAdded().AddRaw(this, &FHCIPathSearchIndex::HandlePathAdded);
+	PathRemovedHandle = Registry.OnPathRemoved().AddRaw(this, &FHCIPathSearchIndex::HandlePathRemoved);
+	bBoundToAssetRegistry = true;
+
+	const double StartSeconds = FPlatformTime::Seconds();
+	Registry.EnumerateAllCachedPaths([this](FName PathName)
+	{
+		AddPath(PathName.ToString());
+		return true;
+	});
+
+	// Discovery continues in the background; paths it finds arrive through OnPathAdded.
+	if (!Registry.IsSearchAllAssets())
+	{
+		Registry.SearchAllAssets(false);
+	}
+
+	UE_LOG(
+		LogHCIPathSearchIndex,
+		Display,
+		TEXT("[HCI][PathSearchIndex] seeded paths=%d segments=%d discovery_complete=%s elapsed_ms=%.2f"),
+		GetPathCount(),
+		Segments.Num(),
+		IsDiscoveryComplete() ? TEXT("true") : TEXT("false"),
+		(FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+}
+
+void FHCIPathSearchIndex::Shutdown()
+{
+	if (bBoundToAssetRegistry && FModuleManager::Get().IsModuleLoaded(TEXT("AssetRegistry")))
+	{
+		IAssetRegistry& Registry = FModuleManager::GetModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+		Registry.OnPathAdded().Remove(PathAddedHandle);
+		Registry.OnPathRemoved().Remove(PathRemovedHandle);
+	}
+	bBoundToAssetRegistry = false;
+	Reset();
+}
+
+bool FHCIPathSearchIndex::IsDiscoveryComplete() const
+{
+	if (!FModuleManager::Get().IsModuleLoaded(TEXT("AssetRegistry")))
+	{
+		return false;
+	}
+	return !FModuleManager::GetModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get().IsLoadingAssets();
+}
+
+void FHCIPathSearchIndex::AddPath(const FString& Path)
+{
+	if (!Path.StartsWith(TEXT("/Game/")) || PathIdByPath.Contains(Path))
+	{
+		return;
+	}
+
+	FPathEntry Entry;
+	Entry.Path = Path;
+	Entry.NormalizedPath = NormalizeFuzzyToken(Path);
+	const FString Leaf = HCIAssetPathUtils::GetDirectoryLeafName(Path);
+	Entry.bEndsWithLeaf = Path.EndsWith(Leaf);
+
+	TArray<FString> NormalizedSegments;
+	Entry.NormalizedPath.ParseIntoArray(NormalizedSegments, TEXT("/"), true);
+	for (const FString& Segment : NormalizedSegments)
+	{
+		Entry.SegmentIds.AddUnique(InternSegment(Segment));
+	}
+	Entry.LeafSegmentId = InternSegment(NormalizeFuzzyToken(Leaf));
+	Entry.SegmentIds.AddUnique(Entry.LeafSegmentId);
+
+	const int32 PathId = Paths.Add(MoveTemp(Entry));
+	const FPathEntry& Added = Paths[PathId];
+	PathIdByPath.Add(Added.Path, PathId);
+	for (const int32 SegmentId : Added.SegmentIds)
+	{
+		Segments[SegmentId].PathIds.Add(PathId);
+	}
+	Segments[Added.LeafSegmentId].LeafPathIds.Add(PathId);
+}
+
+void FHCIPathSearchIndex::RemovePath(const FString& Path)
+{
+	int32 PathId = INDEX_NONE;
+	if (!PathIdByPath.RemoveAndCopyValue(Path, PathId))
+	{
+		return;
+	}
+
+	const FPathEntry& Entry = Paths[PathId];
+	for (const int32 SegmentId : Entry.SegmentIds)
+	{
+		Segments[SegmentId].PathIds.Remove(PathId);
+	}
+	Segments[Entry.LeafSegmentId].LeafPathIds.Remove(PathId);
+	Paths.RemoveAt(PathId);
+}
+
+void FHCIPathSearchIndex::Reset()
+{
+	Paths.Empty();
+	PathIdByPath.Empty();
+	Segments.Empty();
+	SegmentIdByText.Empty();
+	SegmentIdsByTrigram.Empty();
+}
+
+void FHCIPathSearchIndex::Query(const TArray<FString>& Keywords, TArray<FHCIPathSearchMatch>& OutMatches, int32* OutCandidateCount) const
+{
+	OutMatches.Reset();
+
+	TArray<FString> NormalizedKeywords;
+	NormalizedKeywords.Reserve(Keywords.Num());
+	TSet<int32> CandidatePathIds;
+	for (const FString& Keyword : Keywords)
+	{
+		const FString& Normalized = NormalizedKeywords.Add_GetRef(NormalizeFuzzyToken(Keyword));
+		if (!Normalized.IsEmpty())
+		{
+			CollectCandidates(Normalized, CandidatePathIds);
+		}
+	}
+	if (OutCandidateCount)
+	{
+		*OutCandidateCount = CandidatePathIds.Num();
+	}
+
+	for (const int32 PathId : CandidatePathIds)
+	{
+		const FPathEntry& Entry = Paths[PathId];
+		const FString& LeafNormalized = Segments[Entry.LeafSegmentId].Normalized;
+		int32 BestScore = 0;
+		int32 BestKeywordIndex = INDEX_NONE;
+		for (int32 KeywordIndex = 0; KeywordIndex < NormalizedKeywords.Num(); ++KeywordIndex)
+		{
+			const int32 Score = HCI_ScoreNormalized(LeafNormalized, Entry.NormalizedPath, Entry.bEndsWithLeaf, NormalizedKeywords[KeywordIndex]);
+			if (Score > BestScore)
+			{
+				BestScore = Score;
+				BestKeywordIndex = KeywordIndex;
+			}
+		}
+		if (BestScore <= 0)
+		{
+			continue;
+		}
+
+		FHCIPathSearchMatch& Match = OutMatches.AddDefaulted_GetRef();
+		Match.Path = Entry.Path;
+		Match.Score = BestScore;
+		Match.MatchedKeyword = Keywords[BestKeywordIndex];
+	}
+}
+
+int32 FHCIPathSearchIndex::InternSegment(const FString& Normalized)
+{
+	if (const int32* Existing = SegmentIdByText.Find(Normalized))
+	{
+		return *Existing;
+	}
+
+	const int32 SegmentId = Segments.AddDefaulted();
+	Segments[SegmentId].Normalized = Normalized;
+	SegmentIdByText.Add(Normalized, SegmentId);
+
+	TSet<uint64, DefaultKeyFuncs<uint64>, TInlineSetAllocator<32>> SeenTrigrams;
+	for (int32 Start = 0; Start + HCIPathSearchTrigramLength <= Normalized.Len(); ++Start)
+	{
+		const uint64 TrigramKey = HCI_MakeTrigramKey(*Normalized + Start);
+		bool bAlreadySeen = false;
+		SeenTrigrams.Add(TrigramKey, &bAlreadySeen);
+		if (!bAlreadySeen)
+		{
+			SegmentIdsByTrigram.FindOrAdd(TrigramKey).Add(SegmentId);
+		}
+	}
+	return SegmentId;
+}
+
+void FHCIPathSearchIndex::CollectCandidates(const FString& KeywordNormalized, TSet<int32>& OutPathIds) const
+{
+	// Normalization never produces '/', so a keyword containing one can span segments: score everything.
+	if (KeywordNormalized.Contains(TEXT("/"), ESearchCase::CaseSensitive))
+	{
+		for (TSparseArray<FPathEntry>::TConstIterator It(Paths); It; ++It)
+		{
+			OutPathIds.Add(It.GetIndex());
+		}
+		return;
+	}
+
+	// Paths with a segment containing the keyword (covers leaf-exact/leaf-contains/path-contains).
+	if (KeywordNormalized.Len() >= HCIPathSearchTrigramLength)
+	{
+		const TArray<int32>* Shortest = nullptr;
+		for (int32 Start = 0; Start + HCIPathSearchTrigramLength <= KeywordNormalized.Len(); ++Start)
+		{
+			const TArray<int32>* Postings = SegmentIdsByTrigram.Find(HCI_MakeTrigramKey(*KeywordNormalized + Start));
+			if (!Postings)
+			{
+				Shortest = nullptr;
+				break;
+			}
+			if (!Shortest || Postings->Num() < Shortest->Num())
+			{
+				Shortest = Postings;
+			}
+		}
+		if (Shortest)
+		{
+			for (const int32 SegmentId : *Shortest)
+			{
+				const FSegment& Segment = Segments[SegmentId];
+				if (Segment.PathIds.Num() > 0 && Segment.Normalized.Contains(KeywordNormalized))
+				{
+					OutPathIds.Append(Segment.PathIds);
+				}
+			}
+		}
+	}
+	else
+	{
+		for (const FSegment& Segment : Segments)
+		{
+			if (Segment.PathIds.Num() > 0 && Segment.Normalized.Contains(KeywordNormalized))
+			{
+				OutPathIds.Append(Segment.PathIds);
+			}
+		}
+	}
+
+	// Paths whose leaf is a substring of the keyword.
+	for (int32 Start = 0; Start < KeywordNormalized.Len(); ++Start)
+	{
+		for (int32 Length = HCIPathSearchMinLeafInKeywordLength; Start + Length <= KeywordNormalized.Len(); ++Length)
+		{
+			if (const int32* SegmentId = SegmentIdByText.Find(KeywordNormalized.Mid(Start, Length)))
+			{
+				OutPathIds.Append(Segments[*SegmentId].LeafPathIds);
+			}
+		}
+	}
+}
+
+void FHCIPathSearchIndex::HandlePathAdded(const FString& Path)
+{
+	AddPath(Path);
+}
+
+void FHCIPathSearchIndex::HandlePathRemoved(const FString& Path)
+{
+	RemovePath(Path);
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FHCIPathSearchMatch
+{
+	FString Path;
+	int32 Score = 0;
+	FString MatchedKeyword;
+};
+
+// Persistent /Game/ directory index for SearchPath. Paths are normalized once on insert and their
+// segments are posted into a trigram index, so a fuzzy lookup only scores paths that can match.
+// The registry-backed instance follows AssetRegistry path added/removed events and never waits on
+// discovery; queries during discovery see the paths gathered so far.
+class FHCIPathSearchIndex
+{
+public:
+	static FHCIPathSearchIndex& Get();
+
+	static FString NormalizeFuzzyToken(const FString& Text);
+	// Reference scorer; Query() returns exactly the paths this scores above zero.
+	static int32 ComputePathKeywordScore(const FString& Path, const FString& Keyword);
+
+	// Seeds from the registry's cached paths on first use, subscribes to path events and starts async discovery.
+	void EnsureBoundToAssetRegistry();
+	void Shutdown();
+	bool IsDiscoveryComplete() const;
+
+	void AddPath(const FString& Path);
+	void RemovePath(const FString& Path);
+	void Reset();
+	int32 GetPathCount() const { return PathIdByPath.Num(); }
+
+	// Scores every candidate path against all keywords and keeps the best keyword per path.
+	void Query(const TArray<FString>& Keywords, TArray<FHCIPathSearchMatch>& OutMatches, int32* OutCandidateCount = nullptr) const;
+
+private:
+	struct FPathEntry
+	{
+		FString Path;
+		FString NormalizedPath;
+		TArray<int32> SegmentIds;
+		int32 LeafSegmentId = INDEX_NONE;
+		bool bEndsWithLeaf = true;
+	};
+
+	struct FSegment
+	{
+		FString Normalized;
+		TSet<int32> PathIds;
+		TSet<int32> LeafPathIds;
+	};
+
+	int32 InternSegment(const FString& Normalized);
+	void CollectCandidates(const FString& KeywordNormalized, TSet<int32>& OutPathIds) const;
+
+	void HandlePathAdded(const FString& Path);
+	void HandlePathRemoved(const FString& Path);
+
+	TSparseArray<FPathEntry> Paths;
+	TMap<FString, int32> PathIdByPath;
+	TArray<FSegment> Segments;
+	TMap<FString, int32> SegmentIdByText;
+	TMap<uint64, TArray<int32>> SegmentIdsByTrigram;
+
+	bool bBoundToAssetRegistry = false;
+	FDelegateHandle PathAddedHandle;
+	FDelegateHandle PathRemovedHandle;
+};
@@ -0,0 +1,196 @@
+#include "AgentActions/Support/HCIProposalArtifact.h"
+
+#include "AssetRegistry/AssetData.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "HAL/FileManager.h"
+#include "IO/IoHash.h"
+#include "Misc/PackageName.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+static const TCHAR* const HCIProposalArtifactPrefix = TEXT("hcipa1:");
+}
+
+FHCIProposalArtifact::FHCIProposalArtifact(const FName InToolName, const FString& InContext)
+	: ToolName(InToolName)
+	, Context(InContext)
+{
+}
+
+FString FHCIProposalArtifact::ComputePackageFingerprint(const FString& ObjectOrPackagePath)
+{
+	const FString PackageName = FPackageName::ObjectPathToPackageName(ObjectOrPackagePath);
+	if (!FPackageName::IsValidLongPackageName(PackageName))
+	{
+		return TEXT("invalid");
+	}
+
+	if (const UPackage* Package = FindPackage(nullptr, *PackageName))
+	{
+		if (Package->IsDirty())
+		{
+			return FString::Printf(TEXT("dirty:%llu"), FPlatformTime::Cycles64());
+		}
+	}
+
+	const TOptional<FAssetPackageData> PackageData = IAssetRegistry::GetChecked().GetAssetPackageDataCopy(FName(*PackageName));
+	FString Filename;
+	FDateTime TimeStamp = FDateTime::MinValue();
+	if (FPackageName::TryConvertLongPackageNameToFilename(PackageName, Filename, FPackageName::GetAssetPackageExtension()))
+	{
+		TimeStamp = IFileManager::Get().GetTimeStamp(*Filename);
+	}
+
+	if (!PackageData.IsSet() && TimeStamp == FDateTime::MinValue())
+	{
+		return TEXT("missing");
+	}
+
+	return FString::Printf(
+		TEXT("%s:%lld:%lld"),
+		PackageData.IsSet() ? *LexToString(PackageData->GetPackageSavedHash()) : TEXT("-"),
+		PackageData.IsSet() ? PackageData->DiskSize : -1ll,
+		TimeStamp.GetTicks());
+}
+
+bool FHCIProposalArtifact::Load(const FString& Text)
+{
+	EntriesByKey.Reset();
+	bConsuming = !Text.IsEmpty();
+	bRejected = false;
+	if (!bConsuming)
+	{
+		return false;
+	}
+
+	// hcipa1:<crc32 hex>:<json>
+	FString Body;
+	FString CrcText;
+	if (!Text.StartsWith(HCIProposalArtifactPrefix, ESearchCase::CaseSensitive) ||
+		!Text.RightChop(FCString::Strlen(HCIProposalArtifactPrefix)).Split(TEXT(":"), &CrcText, &Body) ||
+		CrcText != FString::Printf(TEXT("%08x"), FCrc::StrCrc32(*Body)))
+	{
+		bRejected = true;
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> Root;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Body);
+	FString ArtifactTool;
+	FString ArtifactContext;
+	const TArray<TSharedPtr<FJsonValue>>* Entries = nullptr;
+	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid() ||
+		!Root->TryGetStringField(TEXT("tool"), ArtifactTool) || ArtifactTool != ToolName.ToString() ||
+		!Root->TryGetStringField(TEXT("context"), ArtifactContext) || ArtifactContext != Context ||
+		!Root->TryGetArrayField(TEXT("entries"), Entries) || Entries == nullptr)
+	{
+		bRejected = true;
+		return false;
+	}
+
+	for (const TSharedPtr<FJsonValue>& Value : *Entries)
+	{
+		const TSharedPtr<FJsonObject>* EntryObject = nullptr;
+		if (!Value.IsValid() || !Value->TryGetObject(EntryObject) || EntryObject == nullptr)
+		{
+			continue;
+		}
+
+		FString Key;
+		FEntry Entry;
+		const TSharedPtr<FJsonObject>* Payload = nullptr;
+		if ((*EntryObject)->TryGetStringField(TEXT("k"), Key) &&
+			(*EntryObject)->TryGetStringField(TEXT("f"), Entry.Fingerprint) &&
+			(*EntryObject)->TryGetObjectField(TEXT("p"), Payload) && Payload != nullptr)
+		{
+			Entry.Payload = *Payload;
+			EntriesByKey.Add(MoveTemp(Key), MoveTemp(Entry));
+		}
+	}
+	return true;
+}
+
+void FHCIProposalArtifact::AddEntry(const FString& Key, const FString& Fingerprint, const TSharedRef<FJsonObject>& Payload)
+{
+	FEntry& Entry = EntriesByKey.FindOrAdd(Key);
+	Entry.Fingerprint = Fingerprint;
+	Entry.Payload = Payload;
+}
+
+TSharedPtr<FJsonObject> FHCIProposalArtifact::FindFresh(const FString& Key, const FString& CurrentFingerprint)
+{
+	if (!bConsuming)
+	{
+		return nullptr;
+	}
+
+	const FEntry* Entry = EntriesByKey.Find(Key);
+	if (Entry == nullptr || Entry->Fingerprint != CurrentFingerprint)
+	{
+		++RecomputedCount;
+		return nullptr;
+	}
+	++ReusedCount;
+	return Entry->Payload;
+}
+
+FString FHCIProposalArtifact::Serialize() const
+{
+	TArray<TSharedPtr<FJsonValue>> Entries;
+	Entries.Reserve(EntriesByKey.Num());
+	for (const TPair<FString, FEntry>& Pair : EntriesByKey)
+	{
+		const TSharedRef<FJsonObject> EntryObject = MakeShared<FJsonObject>();
+		EntryObject->SetStringField(TEXT("k"), Pair.Key);
+		EntryObject->SetStringField(TEXT("f"), Pair.Value.Fingerprint);
+		EntryObject->SetObjectField(TEXT("p"), Pair.Value.Payload);
+		Entries.Add(MakeShared<FJsonValueObject>(EntryObject));
+	}
+
+	const TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetStringField(TEXT("tool"), ToolName.ToString());
+	Root->SetStringField(TEXT("context"), Context);
+	Root->SetArrayField(TEXT("entries"), Entries);
+
+	FString Body;
+	const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+		TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Body);
+	FJsonSerializer::Serialize(Root, Writer);
+	return FString::Printf(TEXT("%s%08x:%s"), HCIProposalArtifactPrefix, FCrc::StrCrc32(*Body), *Body);
+}
+
+void FHCIProposalArtifact::WriteToResult(FHCIAgentToolActionResult& OutResult, const bool bIsDryRun) const
+{
+	if (bIsDryRun)
+	{
+		if (EntriesByKey.Num() <= 0)
+		{
+			return;
+		}
+		OutResult.ProposalArtifact = Serialize();
+		OutResult.Evidence.Add(TEXT("proposal_artifact_entries"), FString::FromInt(EntriesByKey.Num()));
+		OutResult.Evidence.Add(
+			TEXT("proposal_artifact_hash"),
+			OutResult.ProposalArtifact.Mid(FCString::Strlen(HCIProposalArtifactPrefix), 8));
+		return;
+	}
+
+	if (!bConsuming)
+	{
+		return;
+	}
+	OutResult.Evidence.Add(TEXT("artifact_reused_count"), FString::FromInt(ReusedCount));
+	OutResult.Evidence.Add(TEXT("artifact_recomputed_count"), FString::FromInt(RecomputedCount));
+	if (bRejected)
+	{
+		OutResult.Evidence.Add(TEXT("artifact_rejected"), TEXT("true"));
+	}
+}
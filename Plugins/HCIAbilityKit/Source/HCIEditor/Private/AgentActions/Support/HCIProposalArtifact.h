@@ -0,0 +1,57 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Agent/Tools/HCIAgentToolAction.h"
+
+class FJsonObject;
+
+// Dry-run proposal of one tool step, handed to Execute of the same step through the executor. Each entry
+// holds the discovery result for one key (usually a source object path) together with the fingerprint of
+// the asset state it was computed from, so Execute reuses fresh entries and recomputes only stale ones.
+// The serialized text is opaque to the executor and carries a CRC so a damaged artifact is rejected whole.
+class HCIEDITOR_API FHCIProposalArtifact
+{
+public:
+	// Context covers inputs outside the step args (config, rules); an artifact with another context is ignored.
+	FHCIProposalArtifact(FName InToolName, const FString& InContext);
+
+	// Asset registry package data (saved hash, disk size) plus the package file timestamp. Dirty packages get
+	// a fingerprint that never matches, because their in-memory state is not covered by either value.
+	static FString ComputePackageFingerprint(const FString& ObjectOrPackagePath);
+
+	// Execute: loads the artifact from Request.ProposalArtifact. Returns false (and keeps no entries) when the
+	// text is empty, corrupted, or was emitted by another tool or context.
+	bool Load(const FString& Text);
+
+	// Payload is kept by reference; later writes to it are still serialized.
+	void AddEntry(const FString& Key, const FString& Fingerprint, const TSharedRef<FJsonObject>& Payload);
+
+	// Payload of Key when it was recorded with CurrentFingerprint; counts reused and recomputed lookups.
+	TSharedPtr<FJsonObject> FindFresh(const FString& Key, const FString& CurrentFingerprint);
+
+	// DryRun: stores the serialized artifact and proposal_artifact_hash / proposal_artifact_entries.
+	// Execute (with an artifact in the request): artifact_reused_count / artifact_recomputed_count.
+	void WriteToResult(FHCIAgentToolActionResult& OutResult, bool bIsDryRun) const;
+
+	int32 Num() const { return EntriesByKey.Num(); }
+	int32 GetReusedCount() const { return ReusedCount; }
+	int32 GetRecomputedCount() const { return RecomputedCount; }
+
+	FString Serialize() const;
+
+private:
+	struct FEntry
+	{
+		FString Fingerprint;
+		TSharedPtr<FJsonObject> Payload;
+	};
+
+	FName ToolName;
+	FString Context;
+	TMap<FString, FEntry> EntriesByKey;
+	bool bConsuming = false;
+	bool bRejected = false;
+	int32 ReusedCount = 0;
+	int32 RecomputedCount = 0;
+};
@@ -0,0 +1,72 @@
+#include "AgentActions/Support/HCISessionResultCache.h"
+
+#include "AssetRegistry/AssetData.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Modules/ModuleManager.h"
+
+namespace
+{
+struct FHCISessionResultCacheState
+{
+	TSharedPtr<FHCIAgentReadOnlyResultCache> Cache;
+	FDelegateHandle AssetAddedHandle;
+	FDelegateHandle AssetRemovedHandle;
+	FDelegateHandle AssetRenamedHandle;
+	FDelegateHandle AssetUpdatedHandle;
+	FDelegateHandle PathAddedHandle;
+	FDelegateHandle PathRemovedHandle;
+};
+
+static FHCISessionResultCacheState& HCI_GetSessionResultCacheState()
+{
+	static FHCISessionResultCacheState State;
+	return State;
+}
+
+static void HCI_BumpSessionResultCache()
+{
+	if (const TSharedPtr<FHCIAgentReadOnlyResultCache>& Cache = HCI_GetSessionResultCacheState().Cache)
+	{
+		Cache->BumpGeneration();
+	}
+}
+} // namespace
+
+TSharedRef<FHCIAgentReadOnlyResultCache> FHCISessionResultCache::Get()
+{
+	check(IsInGameThread());
+
+	FHCISessionResultCacheState& State = HCI_GetSessionResultCacheState();
+	if (State.Cache.IsValid())
+	{
+		return State.Cache.ToSharedRef();
+	}
+
+	State.Cache = MakeShared<FHCIAgentReadOnlyResultCache>();
+	IAssetRegistry& Registry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	State.AssetAddedHandle = Registry.OnAssetAdded().AddLambda([](const FAssetData&) { HCI_BumpSessionResultCache(); });
+	State.AssetRemovedHandle = Registry.OnAssetRemoved().AddLambda([](const FAssetData&) { HCI_BumpSessionResultCache(); });
+	State.AssetRenamedHandle = Registry.OnAssetRenamed().AddLambda([](const FAssetData&, const FString&) { HCI_BumpSessionResultCache(); });
+	State.AssetUpdatedHandle = Registry.OnAssetUpdated().AddLambda([](const FAssetData&) { HCI_BumpSessionResultCache(); });
+	// SearchPath and directory scans also answer from the folder tree, which changes without any asset event.
+	State.PathAddedHandle = Registry.OnPathAdded().AddLambda([](const FString&) { HCI_BumpSessionResultCache(); });
+	State.PathRemovedHandle = Registry.OnPathRemoved().AddLambda([](const FString&) { HCI_BumpSessionResultCache(); });
+	return State.Cache.ToSharedRef();
+}
+
+void FHCISessionResultCache::Shutdown()
+{
+	FHCISessionResultCacheState& State = HCI_GetSessionResultCacheState();
+	if (State.Cache.IsValid() && FModuleManager::Get().IsModuleLoaded(TEXT("AssetRegistry")))
+	{
+		IAssetRegistry& Registry = FModuleManager::GetModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+		Registry.OnAssetAdded().Remove(State.AssetAddedHandle);
+		Registry.OnAssetRemoved().Remove(State.AssetRemovedHandle);
+		Registry.OnAssetRenamed().Remove(State.AssetRenamedHandle);
+		Registry.OnAssetUpdated().Remove(State.AssetUpdatedHandle);
+		Registry.OnPathAdded().Remove(State.PathAddedHandle);
+		Registry.OnPathRemoved().Remove(State.PathRemovedHandle);
+	}
+	State = FHCISessionResultCacheState();
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Agent/Executor/HCIAgentReadOnlyResultCache.h"
+
+// Editor-session owner of the executor's read-only result cache. The first call binds the AssetRegistry
+// asset added/removed/renamed/updated and path added/removed events to BumpGeneration, so any asset or
+// folder change invalidates memoized scans. Shutdown() unbinds them and drops the cache.
+class FHCISessionResultCache
+{
+public:
+	static TSharedRef<FHCIAgentReadOnlyResultCache> Get();
+	static void Shutdown();
+};
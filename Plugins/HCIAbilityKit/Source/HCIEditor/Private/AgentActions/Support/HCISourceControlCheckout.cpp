@@ -0,0 +1,96 @@
+#include "AgentActions/Support/HCISourceControlCheckout.h"
+
+#include "ISourceControlModule.h"
+#include "ISourceControlProvider.h"
+#include "SourceControlHelpers.h"
+#include "SourceControlOperations.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogHCISourceControlCheckout, Log, All);
+
+bool FHCIEditorSourceControlCheckout::IsProviderAvailable()
+{
+	ISourceControlModule& SourceControlModule = ISourceControlModule::Get();
+	return SourceControlModule.IsEnabled() && SourceControlModule.GetProvider().IsAvailable();
+}
+
+void FHCIEditorSourceControlCheckout::CheckOutPackages(
+	const TArray<FString>& PackageNames,
+	TMap<FString, FString>& OutFailureReasonByPackage)
+{
+	if (PackageNames.Num() == 0)
+	{
+		return;
+	}
+
+	ISourceControlProvider& Provider = ISourceControlModule::Get().GetProvider();
+	const TArray<FString> Filenames = SourceControlHelpers::PackageFilenames(PackageNames);
+	check(Filenames.Num() == PackageNames.Num());
+
+	// One status round trip for the whole batch, then decide per file from the refreshed cache.
+	Provider.Execute(ISourceControlOperation::Create<FUpdateStatus>(), Filenames);
+
+	TArray<FString> FilesToCheckOut;
+	TArray<int32> PackageIndexByCheckout;
+	for (int32 Index = 0; Index < Filenames.Num(); ++Index)
+	{
+		const FSourceControlStatePtr State = Provider.GetState(Filenames[Index], EStateCacheUsage::Use);
+		if (!State.IsValid())
+		{
+			OutFailureReasonByPackage.Add(PackageNames[Index], TEXT("source_control_state_unavailable"));
+			continue;
+		}
+		if (State->IsCheckedOut() || State->IsAdded() || !State->IsSourceControlled())
+		{
+			continue;
+		}
+
+		FString OtherUser;
+		if (State->IsCheckedOutOther(&OtherUser))
+		{
+			OutFailureReasonByPackage.Add(PackageNames[Index], FString::Printf(TEXT("checked_out_by_other_user:%s"), *OtherUser));
+		}
+		else if (!State->IsCurrent())
+		{
+			OutFailureReasonByPackage.Add(PackageNames[Index], TEXT("not_at_head_revision"));
+		}
+		else if (!State->CanCheckout())
+		{
+			OutFailureReasonByPackage.Add(PackageNames[Index], TEXT("checkout_not_allowed"));
+		}
+		else
+		{
+			FilesToCheckOut.Add(Filenames[Index]);
+			PackageIndexByCheckout.Add(Index);
+		}
+	}
+
+	if (FilesToCheckOut.Num() == 0)
+	{
+		return;
+	}
+
+	const ECommandResult::Type CommandResult = Provider.Execute(ISourceControlOperation::Create<FCheckOut>(), FilesToCheckOut);
+	int32 FailedCount = 0;
+	for (int32 CheckoutIndex = 0; CheckoutIndex < FilesToCheckOut.Num(); ++CheckoutIndex)
+	{
+		const FSourceControlStatePtr State = Provider.GetState(FilesToCheckOut[CheckoutIndex], EStateCacheUsage::Use);
+		if (State.IsValid() && State->IsCheckedOut())
+		{
+			continue;
+		}
+
+		++FailedCount;
+		OutFailureReasonByPackage.Add(
+			PackageNames[PackageIndexByCheckout[CheckoutIndex]],
+			CommandResult == ECommandResult::Succeeded ? TEXT("checkout_not_applied") : TEXT("checkout_command_failed"));
+	}
+
+	UE_LOG(
+		LogHCISourceControlCheckout,
+		Display,
+		TEXT("[HCI][SourceControl] checkout provider=%s packages=%d requested=%d failed=%d"),
+		*Provider.GetName().ToString(),
+		PackageNames.Num(),
+		FilesToCheckOut.Num(),
+		FailedCount);
+}
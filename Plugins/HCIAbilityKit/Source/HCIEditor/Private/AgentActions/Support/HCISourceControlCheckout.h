@@ -0,0 +1,18 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Agent/Executor/HCIAgentSourceControlCheckout.h"
+
+// Binds the executor's batched checkout seam to the editor's ISourceControlProvider: one status
+// refresh and one FCheckOut operation per batch, whatever the number of packages.
+class FHCIEditorSourceControlCheckout final : public IHCIAgentSourceControlCheckout
+{
+public:
+	// True when a provider is enabled and reachable; otherwise commits stay in offline local mode.
+	static bool IsProviderAvailable();
+
+	virtual void CheckOutPackages(
+		const TArray<FString>& PackageNames,
+		TMap<FString, FString>& OutFailureReasonByPackage) override;
+};
@@ -31,6 +31,19 @@ void FHCIToolActionEvidenceBuilder::SetSucceeded(
 	OutResult.EstimatedAffectedCount = EstimatedAffectedCount;
 }
 
+void FHCIToolActionEvidenceBuilder::MarkCancelled(
+	FHCIAgentToolActionResult& OutResult,
+	int32 ProcessedCount,
+	int32 TotalCount)
+{
+	OutResult.bSucceeded = false;
+	OutResult.ErrorCode = HCIAgentExecutorCancelledErrorCode;
+	OutResult.Reason = TEXT("cancelled_by_user");
+	AddEvidenceInt(OutResult, TEXT("processed_count"), ProcessedCount);
+	AddEvidenceInt(OutResult, TEXT("remaining_count"), FMath::Max(0, TotalCount - ProcessedCount));
+	OutResult.Evidence.Add(TEXT("result"), OutResult.Reason);
+}
+
 void FHCIToolActionEvidenceBuilder::AddEvidenceInt(
 	FHCIAgentToolActionResult& OutResult,
 	const TCHAR* Key,
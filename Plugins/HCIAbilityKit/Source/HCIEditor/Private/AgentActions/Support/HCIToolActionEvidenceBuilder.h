@@ -19,6 +19,12 @@ public:
 		const TCHAR* Reason,
 		int32 EstimatedAffectedCount = 0);
 
+	// Turns a result built from the assets processed so far into an E4013 partial result.
+	static void MarkCancelled(
+		FHCIAgentToolActionResult& OutResult,
+		int32 ProcessedCount,
+		int32 TotalCount);
+
 	static void AddEvidenceInt(
 		FHCIAgentToolActionResult& OutResult,
 		const TCHAR* Key,
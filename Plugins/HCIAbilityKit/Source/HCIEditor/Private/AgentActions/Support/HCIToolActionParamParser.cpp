@@ -85,6 +85,15 @@ bool FHCIToolActionParamParser::TryGetOptionalStringArray(const TCHAR* Field, TA
 	return true;
 }
 
+bool FHCIToolActionParamParser::TryGetOptionalInt(const TCHAR* Field, int32& InOutValue) const
+{
+	if (!Args.IsValid() || !Args->HasField(Field))
+	{
+		return true;
+	}
+	return Args->TryGetNumberField(Field, InOutValue);
+}
+
 bool FHCIToolActionParamParser::TryGetOptionalStringFieldRaw(const TCHAR* Field, FString& OutValue) const
 {
 	OutValue.Reset();
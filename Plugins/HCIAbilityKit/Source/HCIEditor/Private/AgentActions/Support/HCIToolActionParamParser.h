@@ -13,6 +13,8 @@ public:
 	bool TryGetRequiredInt(const TCHAR* Field, int32& OutValue) const;
 	bool TryGetRequiredStringArray(const TCHAR* Field, TArray<FString>& OutValue) const;
 	bool TryGetOptionalStringArray(const TCHAR* Field, TArray<FString>& OutValue) const;
+	// Leaves InOutValue untouched when the field is absent; fails only when present but not a number.
+	bool TryGetOptionalInt(const TCHAR* Field, int32& InOutValue) const;
 
 	// Optional helper for the common "directory" arg.
 	// NOTE: This intentionally does NOT trim the value (保持历史语义：带空格会视为无效并回退默认值)。
@@ -1,12 +1,15 @@
 #include "AgentActions/ToolActions/HCIToolActionFactories.h"
 
-#include "AgentActions/Support/HCIAssetNamingRules.h"
 #include "AgentActions/Support/HCIAssetPathUtils.h"
+#include "AgentActions/Support/HCICommitUndo.h"
+#include "AgentActions/Support/HCINameContractIndex.h"
+#include "AgentActions/Support/HCIProposalArtifact.h"
 #include "AgentActions/Support/HCIToolActionEvidenceBuilder.h"
 #include "AgentActions/Support/HCIToolActionParamParser.h"
 
 #include "AssetToolsModule.h"
 #include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
 #include "EditorAssetLibrary.h"
 #include "Engine/StaticMesh.h"
 #include "Engine/Texture2D.h"
@@ -15,11 +18,13 @@
 #include "Framework/Notifications/NotificationManager.h"
 #include "Materials/Material.h"
 #include "Materials/MaterialInstanceConstant.h"
+#include "MaterialShared.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "Modules/ModuleManager.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
+#include "ShaderCompiler.h"
 #include "Widgets/Notifications/SNotificationList.h"
 
 namespace
@@ -53,15 +58,6 @@ private:
 		TArray<FString> TextureParameterNames;
 	};
 
-	struct FHCIContractGroup
-	{
-		FString Id;
-		FString MeshObjectPath;
-		FString TextureBCObjectPath;
-		FString TextureNObjectPath;
-		FString TextureORMObjectPath;
-	};
-
 	static bool HCI_TryLoadMatLinkFixtureReport(FHCIMatLinkFixtureReport& OutReport)
 	{
 		OutReport = FHCIMatLinkFixtureReport();
@@ -116,95 +112,6 @@ private:
 		return FString();
 	}
 
-	static bool HCI_TryParseContractMeshId(const FString& AssetName, FString& OutId)
-	{
-		OutId.Reset();
-		if (!AssetName.StartsWith(TEXT("SM_")) || AssetName.Len() <= 3)
-		{
-			return false;
-		}
-
-		OutId = AssetName.Mid(3);
-		OutId.TrimStartAndEndInline();
-		OutId = HCIAssetNamingRules::SanitizeIdentifier(OutId);
-		return !OutId.IsEmpty();
-	}
-
-	static bool HCI_TryParseContractTextureIdAndRole(const FString& AssetName, FString& OutId, FString& OutRole)
-	{
-		OutId.Reset();
-		OutRole.Reset();
-
-		if (!AssetName.StartsWith(TEXT("T_")) || AssetName.Len() <= 2)
-		{
-			return false;
-		}
-
-		TArray<FString> Parts;
-		AssetName.ParseIntoArray(Parts, TEXT("_"), true);
-		if (Parts.Num() < 3)
-		{
-			return false;
-		}
-
-		// T_<ID>_<ROLE>
-		const FString Role = Parts.Last().ToUpper();
-		if (!(Role == TEXT("BC") || Role == TEXT("N") || Role == TEXT("ORM") || Role == TEXT("RMA") || Role == TEXT("ARM")))
-		{
-			return false;
-		}
-
-		FString Id;
-		for (int32 Index = 1; Index < Parts.Num() - 1; ++Index)
-		{
-			if (!Id.IsEmpty())
-			{
-				Id += TEXT("_");
-			}
-			Id += Parts[Index];
-		}
-
-		Id = HCIAssetNamingRules::SanitizeIdentifier(Id);
-		if (Id.IsEmpty())
-		{
-			return false;
-		}
-
-		OutId = MoveTemp(Id);
-		OutRole = (Role == TEXT("RMA") || Role == TEXT("ARM")) ? TEXT("ORM") : Role;
-		return true;
-	}
-
-	static FString HCI_BuildStrictContractOrphanReason(const FString& AssetName)
-	{
-		if (AssetName.StartsWith(TEXT("T_")))
-		{
-			TArray<FString> Parts;
-			AssetName.ParseIntoArray(Parts, TEXT("_"), true);
-			const FString Tail = Parts.Num() > 0 ? Parts.Last().ToUpper() : FString();
-			if (Tail == TEXT("COLOR") || Tail == TEXT("BASECOLOR") || Tail == TEXT("ALBEDO") || Tail == TEXT("DIFFUSE"))
-			{
-				return TEXT("贴图后缀不满足契约（末尾为 Color，期望: _BC）");
-			}
-			if (Tail == TEXT("NORMAL") || Tail == TEXT("NORMALMAP"))
-			{
-				return TEXT("贴图后缀不满足契约（末尾为 Normal，期望: _N）");
-			}
-			if (Tail.Contains(TEXT("ORM")) || Tail.Contains(TEXT("RMA")) || Tail.Contains(TEXT("ARM")))
-			{
-				return TEXT("贴图后缀不满足契约（期望: _ORM 或 _RMA）");
-			}
-			return TEXT("贴图命名不满足严格契约（期望: T_<ID>_BC / T_<ID>_N / T_<ID>_ORM）");
-		}
-
-		if (AssetName.StartsWith(TEXT("SM_")))
-		{
-			return TEXT("Mesh 命名不满足严格契约（期望: SM_<ID>）");
-		}
-
-		return TEXT("命名不满足严格契约（期望: SM_<ID> 或 T_<ID>_BC/N/ORM）");
-	}
-
 	static FString HCI_BuildReasonEvidenceString(const TMap<FString, FString>& ReasonByPath)
 	{
 		if (ReasonByPath.Num() <= 0)
@@ -374,15 +281,43 @@ private:
 			return false;
 		}
 
-		// If report doesn't provide param names (or is missing), fall back to scanning the master.
+		// If report doesn't provide param names (or is missing), fall back to scanning the master. The scan is
+		// kept in the proposal artifact so a commit after a dry run skips it while the master is unchanged.
+		// Contract grouping needs no artifact entry: it depends only on asset names and is cached by input.
+		FHCIProposalArtifact Artifact(TEXT("AutoMaterialSetupByNameContract"), MasterMaterialPath);
+		if (!bIsDryRun)
+		{
+			Artifact.Load(Request.ProposalArtifact);
+		}
 		if (ParamNameCandidates.Num() <= 0)
 		{
-			TArray<FMaterialParameterInfo> TextureParams;
-			TArray<FGuid> TextureParamGuids;
-			MasterMaterial->GetAllTextureParameterInfo(TextureParams, TextureParamGuids);
-			for (const FMaterialParameterInfo& Info : TextureParams)
+			const FString MasterFingerprint = FHCIProposalArtifact::ComputePackageFingerprint(MasterMaterialPath);
+			const TArray<TSharedPtr<FJsonValue>>* CachedParams = nullptr;
+			const TSharedPtr<FJsonObject> Cached = Artifact.FindFresh(MasterMaterialPath, MasterFingerprint);
+			if (Cached.IsValid() && Cached->TryGetArrayField(TEXT("texture_params"), CachedParams) && CachedParams != nullptr)
+			{
+				for (const TSharedPtr<FJsonValue>& Value : *CachedParams)
+				{
+					ParamNameCandidates.Add(Value->AsString());
+				}
+			}
+			else
 			{
-				ParamNameCandidates.Add(Info.Name.ToString());
+				TArray<FMaterialParameterInfo> TextureParams;
+				TArray<FGuid> TextureParamGuids;
+				MasterMaterial->GetAllTextureParameterInfo(TextureParams, TextureParamGuids);
+				TArray<TSharedPtr<FJsonValue>> ParamValues;
+				for (const FMaterialParameterInfo& Info : TextureParams)
+				{
+					ParamNameCandidates.Add(Info.Name.ToString());
+					ParamValues.Add(MakeShared<FJsonValueString>(Info.Name.ToString()));
+				}
+				if (bIsDryRun)
+				{
+					const TSharedRef<FJsonObject> Payload = MakeShared<FJsonObject>();
+					Payload->SetArrayField(TEXT("texture_params"), ParamValues);
+					Artifact.AddEntry(MasterMaterialPath, MasterFingerprint, Payload);
+				}
 			}
 		}
 
@@ -402,156 +337,16 @@ private:
 			return false;
 		}
 
-		// Build strict contract groups.
-		TMap<FString, FHCIContractGroup> GroupsById;
-		TArray<FString> MissingGroups;
-		TArray<FString> OrphanAssets;
-		TSet<FString> UnresolvedAssetSet;
-		TMap<FString, FString> OrphanReasonByPath;
-		TMap<FString, FString> UnresolvedReasonByPath;
-
-		for (const FString& Path : AssetPaths)
-		{
-			const FString AssetName = HCI_ExtractAssetNameFromObjectOrAssetPath(Path);
-			if (AssetName.IsEmpty())
-			{
-				continue;
-			}
-
-			FString Id;
-			if (HCI_TryParseContractMeshId(AssetName, Id))
-			{
-				FHCIContractGroup& Group = GroupsById.FindOrAdd(Id);
-				Group.Id = Id;
-				if (!Group.MeshObjectPath.IsEmpty() && !Group.MeshObjectPath.Equals(Path, ESearchCase::CaseSensitive))
-				{
-					MissingGroups.Add(FString::Printf(TEXT("%s (duplicate_mesh)"), *Id));
-					continue;
-				}
-				Group.MeshObjectPath = Path;
-				continue;
-			}
-
-			FString Role;
-			if (HCI_TryParseContractTextureIdAndRole(AssetName, Id, Role))
-			{
-				FHCIContractGroup& Group = GroupsById.FindOrAdd(Id);
-				Group.Id = Id;
-				if (Role == TEXT("BC"))
-				{
-					Group.TextureBCObjectPath = Path;
-				}
-				else if (Role == TEXT("N"))
-				{
-					Group.TextureNObjectPath = Path;
-				}
-				else if (Role == TEXT("ORM"))
-				{
-					Group.TextureORMObjectPath = Path;
-				}
-				continue;
-			}
-
-			// Not matching strict contract (common in real projects): treat as orphan so artists can locate & fix.
-			if (!Path.IsEmpty())
-			{
-				OrphanAssets.Add(Path);
-				if (!OrphanReasonByPath.Contains(Path))
-				{
-					OrphanReasonByPath.Add(Path, HCI_BuildStrictContractOrphanReason(AssetName));
-				}
-			}
-		}
-
-		// Textures that look contract-ish but have no mesh partner are also orphans in practice.
-		for (const TPair<FString, FHCIContractGroup>& Pair : GroupsById)
-		{
-			const FHCIContractGroup& Group = Pair.Value;
-			if (!Group.MeshObjectPath.IsEmpty())
-			{
-				continue;
-			}
-			if (!Group.TextureBCObjectPath.IsEmpty())
-			{
-				OrphanAssets.AddUnique(Group.TextureBCObjectPath);
-				OrphanReasonByPath.FindOrAdd(Group.TextureBCObjectPath) = FString::Printf(TEXT("贴图疑似契约（ID=%s），但缺少配对 Mesh：SM_%s"), *Group.Id, *Group.Id);
-			}
-			if (!Group.TextureNObjectPath.IsEmpty())
-			{
-				OrphanAssets.AddUnique(Group.TextureNObjectPath);
-				OrphanReasonByPath.FindOrAdd(Group.TextureNObjectPath) = FString::Printf(TEXT("贴图疑似契约（ID=%s），但缺少配对 Mesh：SM_%s"), *Group.Id, *Group.Id);
-			}
-			if (!Group.TextureORMObjectPath.IsEmpty())
-			{
-				OrphanAssets.AddUnique(Group.TextureORMObjectPath);
-				OrphanReasonByPath.FindOrAdd(Group.TextureORMObjectPath) = FString::Printf(TEXT("贴图疑似契约（ID=%s），但缺少配对 Mesh：SM_%s"), *Group.Id, *Group.Id);
-			}
-		}
-
-		TArray<FHCIContractGroup> ReadyGroups;
-		ReadyGroups.Reserve(GroupsById.Num());
-		for (const TPair<FString, FHCIContractGroup>& Pair : GroupsById)
-		{
-			const FHCIContractGroup& Group = Pair.Value;
-			if (Group.MeshObjectPath.IsEmpty())
-			{
-				continue;
-			}
-			if (Group.TextureBCObjectPath.IsEmpty() || Group.TextureNObjectPath.IsEmpty() || Group.TextureORMObjectPath.IsEmpty())
-			{
-				TArray<FString> MissingRoles;
-				if (Group.TextureBCObjectPath.IsEmpty()) { MissingRoles.Add(TEXT("BC")); }
-				if (Group.TextureNObjectPath.IsEmpty()) { MissingRoles.Add(TEXT("N")); }
-				if (Group.TextureORMObjectPath.IsEmpty()) { MissingRoles.Add(TEXT("ORM")); }
-				const FString MissingLabel = MissingRoles.Num() > 0 ? FString::Join(MissingRoles, TEXT("/")) : TEXT("BC/N/ORM");
-
-				// Partial match: we found a mesh (and maybe some textures), but cannot complete a full PBR set.
-				UnresolvedAssetSet.Add(Group.MeshObjectPath);
-				UnresolvedReasonByPath.FindOrAdd(Group.MeshObjectPath) = FString::Printf(TEXT("Mesh ID=%s 缺少贴图：T_%s_%s"), *Group.Id, *Group.Id, *MissingLabel);
-				if (!Group.TextureBCObjectPath.IsEmpty())
-				{
-					UnresolvedAssetSet.Add(Group.TextureBCObjectPath);
-					UnresolvedReasonByPath.FindOrAdd(Group.TextureBCObjectPath) = FString::Printf(TEXT("该组 ID=%s 缺少贴图：%s"), *Group.Id, *MissingLabel);
-				}
-				if (!Group.TextureNObjectPath.IsEmpty())
-				{
-					UnresolvedAssetSet.Add(Group.TextureNObjectPath);
-					UnresolvedReasonByPath.FindOrAdd(Group.TextureNObjectPath) = FString::Printf(TEXT("该组 ID=%s 缺少贴图：%s"), *Group.Id, *MissingLabel);
-				}
-				if (!Group.TextureORMObjectPath.IsEmpty())
-				{
-					UnresolvedAssetSet.Add(Group.TextureORMObjectPath);
-					UnresolvedReasonByPath.FindOrAdd(Group.TextureORMObjectPath) = FString::Printf(TEXT("该组 ID=%s 缺少贴图：%s"), *Group.Id, *MissingLabel);
-				}
-
-				MissingGroups.Add(FString::Printf(TEXT("%s (missing_textures)"), *Group.Id));
-				continue;
-			}
-			ReadyGroups.Add(Group);
-		}
-
-		TArray<FString> UnresolvedAssets;
-		UnresolvedAssets.Reserve(UnresolvedAssetSet.Num());
-		for (const FString& P : UnresolvedAssetSet)
-		{
-			UnresolvedAssets.Add(P);
-		}
-		UnresolvedAssets.Sort([](const FString& A, const FString& B) { return A < B; });
-		OrphanAssets.Sort([](const FString& A, const FString& B) { return A < B; });
-		for (int32 Index = OrphanAssets.Num() - 1; Index > 0; --Index)
-		{
-			if (OrphanAssets[Index].Equals(OrphanAssets[Index - 1], ESearchCase::CaseSensitive))
-			{
-				OrphanAssets.RemoveAt(Index, 1, false);
-			}
-		}
-		for (int32 Index = UnresolvedAssets.Num() - 1; Index > 0; --Index)
-		{
-			if (UnresolvedAssets[Index].Equals(UnresolvedAssets[Index - 1], ESearchCase::CaseSensitive))
-			{
-				UnresolvedAssets.RemoveAt(Index, 1, false);
-			}
-		}
+		// Strict contract grouping is shared with the MatLink fixtures and cached per asset_paths input,
+		// so execute after a dry-run on the same selection does not regroup.
+		bool bGroupingFromCache = false;
+		const TSharedRef<const FHCINameContractGrouping> Grouping = FHCINameContractIndex::Get().GetGrouping(AssetPaths, &bGroupingFromCache);
+		const TArray<FHCINameContractGroup>& ReadyGroups = Grouping->ReadyGroups;
+		const TArray<FString>& MissingGroups = Grouping->MissingGroups;
+		const TArray<FString>& OrphanAssets = Grouping->OrphanAssets;
+		const TArray<FString>& UnresolvedAssets = Grouping->UnresolvedAssets;
+		const TMap<FString, FString>& OrphanReasonByPath = Grouping->OrphanReasonByPath;
+		const TMap<FString, FString>& UnresolvedReasonByPath = Grouping->UnresolvedReasonByPath;
 
 		if (ReadyGroups.Num() <= 0)
 		{
@@ -580,7 +375,7 @@ private:
 		TArray<FString> ProposedAssignments;
 		TArray<FString> ProposedBindings;
 
-		for (const FHCIContractGroup& Group : ReadyGroups)
+		for (const FHCINameContractGroup& Group : ReadyGroups)
 		{
 			const FString MiName = FString::Printf(TEXT("MI_%s"), *Group.Id);
 			const FString MiPackagePath = FString::Printf(TEXT("%s/%s"), *MaterialsDir, *MiName);
@@ -613,6 +408,7 @@ private:
 			OutResult.Evidence.Add(TEXT("target_root"), TargetRoot);
 			OutResult.Evidence.Add(TEXT("master_material_path"), MasterMaterialPath);
 			OutResult.Evidence.Add(TEXT("group_count"), FString::FromInt(ReadyGroups.Num()));
+			OutResult.Evidence.Add(TEXT("grouping_cached"), bGroupingFromCache ? TEXT("true") : TEXT("false"));
 			OutResult.Evidence.Add(TEXT("proposed_material_instances"), ProposedInstances.Num() > 0 ? FString::Join(ProposedInstances, TEXT(" | ")) : TEXT("none"));
 			OutResult.Evidence.Add(TEXT("proposed_mesh_assignments"), ProposedAssignments.Num() > 0 ? FString::Join(ProposedAssignments, TEXT(" | ")) : TEXT("none"));
 			OutResult.Evidence.Add(TEXT("proposed_parameter_bindings"), ProposedBindings.Num() > 0 ? FString::Join(ProposedBindings, TEXT(" | ")) : TEXT("none"));
@@ -622,6 +418,7 @@ private:
 			OutResult.Evidence.Add(TEXT("orphan_asset_reasons"), HCI_BuildReasonEvidenceString(OrphanReasonByPath));
 			OutResult.Evidence.Add(TEXT("unresolved_asset_reasons"), HCI_BuildReasonEvidenceString(UnresolvedReasonByPath));
 			OutResult.Evidence.Add(TEXT("result"), OutResult.Reason);
+			Artifact.WriteToResult(OutResult, true);
 			return true;
 		}
 
@@ -668,7 +465,7 @@ private:
 		Notify.Start(FString::Printf(TEXT("Auto-Material：准备中... (groups=%d)"), ReadyGroups.Num()));
 
 		// Preflight: ensure destination doesn't already exist, and required assets load as expected.
-		for (const FHCIContractGroup& Group : ReadyGroups)
+		for (const FHCINameContractGroup& Group : ReadyGroups)
 		{
 			const FString MiName = FString::Printf(TEXT("MI_%s"), *Group.Id);
 			const FString MiAssetPath = FString::Printf(TEXT("%s/Materials/%s"), *TargetRoot, *MiName);
@@ -691,26 +488,36 @@ private:
 				return false;
 			}
 
-			if (!Cast<UStaticMesh>(UEditorAssetLibrary::LoadAsset(Group.MeshObjectPath)) ||
-				!Cast<UTexture2D>(UEditorAssetLibrary::LoadAsset(Group.TextureBCObjectPath)) ||
-				!Cast<UTexture2D>(UEditorAssetLibrary::LoadAsset(Group.TextureNObjectPath)) ||
-				!Cast<UTexture2D>(UEditorAssetLibrary::LoadAsset(Group.TextureORMObjectPath)))
-			{
-				Notify.Finish(false, TEXT("完成：Auto-Material（失败）"));
-				OutResult = FHCIAgentToolActionResult();
-				OutResult.bSucceeded = false;
-				OutResult.ErrorCode = TEXT("E4405");
-				OutResult.Reason = TEXT("required_assets_load_failed");
-				OutResult.Evidence.Add(TEXT("target_root"), TargetRoot);
-				OutResult.Evidence.Add(TEXT("master_material_path"), MasterMaterialPath);
-				OutResult.Evidence.Add(TEXT("group_count"), FString::FromInt(ReadyGroups.Num()));
-				OutResult.Evidence.Add(TEXT("orphan_assets"), OrphanAssets.Num() > 0 ? FString::Join(OrphanAssets, TEXT(" | ")) : TEXT("none"));
-				OutResult.Evidence.Add(TEXT("unresolved_assets"), UnresolvedAssets.Num() > 0 ? FString::Join(UnresolvedAssets, TEXT(" | ")) : TEXT("none"));
-				OutResult.Evidence.Add(TEXT("orphan_asset_reasons"), HCI_BuildReasonEvidenceString(OrphanReasonByPath));
-				OutResult.Evidence.Add(TEXT("unresolved_asset_reasons"), HCI_BuildReasonEvidenceString(UnresolvedReasonByPath));
-				OutResult.Evidence.Add(TEXT("result"), OutResult.Reason);
-				return false;
-			}
+		}
+
+		// Every mesh and texture is loaded before the first instance is created; the pointers are reused below so a
+		// mesh that fails to load cannot leave instances behind without an assignment.
+		TArray<FHCINameContractGroupAssets> GroupAssets;
+		FString FailedAssetPath;
+		if (!FHCINameContractIndex::ResolveGroupAssets(
+				ReadyGroups,
+				[](const FString& ObjectPath)
+				{
+					return UEditorAssetLibrary::LoadAsset(ObjectPath);
+				},
+				GroupAssets,
+				FailedAssetPath))
+		{
+			Notify.Finish(false, TEXT("完成：Auto-Material（失败）"));
+			OutResult = FHCIAgentToolActionResult();
+			OutResult.bSucceeded = false;
+			OutResult.ErrorCode = TEXT("E4405");
+			OutResult.Reason = TEXT("required_assets_load_failed");
+			OutResult.Evidence.Add(TEXT("target_root"), TargetRoot);
+			OutResult.Evidence.Add(TEXT("master_material_path"), MasterMaterialPath);
+			OutResult.Evidence.Add(TEXT("group_count"), FString::FromInt(ReadyGroups.Num()));
+			OutResult.Evidence.Add(TEXT("orphan_assets"), OrphanAssets.Num() > 0 ? FString::Join(OrphanAssets, TEXT(" | ")) : TEXT("none"));
+			OutResult.Evidence.Add(TEXT("unresolved_assets"), UnresolvedAssets.Num() > 0 ? FString::Join(UnresolvedAssets, TEXT(" | ")) : TEXT("none"));
+			OutResult.Evidence.Add(TEXT("orphan_asset_reasons"), HCI_BuildReasonEvidenceString(OrphanReasonByPath));
+			OutResult.Evidence.Add(TEXT("unresolved_asset_reasons"), HCI_BuildReasonEvidenceString(UnresolvedReasonByPath));
+			OutResult.Evidence.Add(TEXT("failed_assets"), FailedAssetPath);
+			OutResult.Evidence.Add(TEXT("result"), OutResult.Reason);
+			return false;
 		}
 
 		UEditorAssetLibrary::MakeDirectory(MaterialsDir);
@@ -719,38 +526,44 @@ private:
 		TArray<FString> AppliedAssignments;
 		TArray<FString> FailedRows;
 
+		// Batched pipeline: create every instance first, then one material update pass, mesh assignment,
+		// a single shader-compile wait and one save call for all touched packages.
+		TArray<UMaterialInstanceConstant*> CreatedMIs;
+		CreatedMIs.Reserve(ReadyGroups.Num());
+		IAssetTools& AssetTools = FModuleManager::LoadModuleChecked<FAssetToolsModule>("AssetTools").Get();
+
+		double PhaseStartSeconds = FPlatformTime::Seconds();
 		int32 Completed = 0;
-		for (const FHCIContractGroup& Group : ReadyGroups)
+		bool bCancelled = false;
+		for (const FHCINameContractGroup& Group : ReadyGroups)
 		{
 			++Completed;
-			Notify.Update(FString::Printf(TEXT("Auto-Material：执行中... (%d/%d)"), Completed, ReadyGroups.Num()));
+			Notify.Update(FString::Printf(TEXT("Auto-Material：创建材质实例... (%d/%d)"), Completed, ReadyGroups.Num()));
 			// Keep editor UI responsive during batch operations.
 			FSlateApplication::Get().PumpMessages();
 
 			const FString MiName = FString::Printf(TEXT("MI_%s"), *Group.Id);
-			const FString MiDir = MaterialsDir;
 
 			UMaterialInstanceConstantFactoryNew* Factory = NewObject<UMaterialInstanceConstantFactoryNew>();
 			Factory->InitialParent = MasterMaterial;
 
-			UObject* Created = FModuleManager::LoadModuleChecked<FAssetToolsModule>("AssetTools").Get().CreateAsset(
+			UMaterialInstanceConstant* MI = Cast<UMaterialInstanceConstant>(AssetTools.CreateAsset(
 				MiName,
-				MiDir,
+				MaterialsDir,
 				UMaterialInstanceConstant::StaticClass(),
-				Factory);
-
-			UMaterialInstanceConstant* MI = Cast<UMaterialInstanceConstant>(Created);
+				Factory));
 			if (!MI)
 			{
 				FailedRows.Add(FString::Printf(TEXT("%s (create_mi_failed)"), *MiName));
 				break;
 			}
 
-			UTexture* TexBC = Cast<UTexture>(UEditorAssetLibrary::LoadAsset(Group.TextureBCObjectPath));
-			UTexture* TexN = Cast<UTexture>(UEditorAssetLibrary::LoadAsset(Group.TextureNObjectPath));
-			UTexture* TexORM = Cast<UTexture>(UEditorAssetLibrary::LoadAsset(Group.TextureORMObjectPath));
+			const FHCINameContractGroupAssets& Assets = GroupAssets[Completed - 1];
+			UTexture* TexBC = Assets.TextureBC;
+			UTexture* TexN = Assets.TextureN;
+			UTexture* TexORM = Assets.TextureORM;
 
-			MI->Modify();
+			FHCICommitUndoScope::ModifyObject(MI);
 			for (const FName& Param : BaseColorParams)
 			{
 				MI->SetTextureParameterValueEditorOnly(FMaterialParameterInfo(Param), TexBC);
@@ -763,24 +576,66 @@ private:
 			{
 				MI->SetTextureParameterValueEditorOnly(FMaterialParameterInfo(Param), TexORM);
 			}
-			MI->PostEditChange();
-			UEditorAssetLibrary::SaveLoadedAsset(MI, false);
-
+			CreatedMIs.Add(MI);
 			CreatedInstances.Add(MI->GetPathName());
 
-			UStaticMesh* Mesh = Cast<UStaticMesh>(UEditorAssetLibrary::LoadAsset(Group.MeshObjectPath));
-			if (!Mesh)
+			// Groups created so far still get their mesh assignment and save below; the rest are skipped.
+			if (Request.ShouldStopAfterAsset(Completed, ReadyGroups.Num()))
 			{
-				FailedRows.Add(FString::Printf(TEXT("%s (mesh_load_failed)"), *Group.MeshObjectPath));
+				bCancelled = true;
 				break;
 			}
+		}
+		const double CreateMs = (FPlatformTime::Seconds() - PhaseStartSeconds) * 1000.0;
+
+		// Deferred PostEditChange: the update context recreates render state once for all instances.
+		PhaseStartSeconds = FPlatformTime::Seconds();
+		Notify.Update(FString::Printf(TEXT("Auto-Material：更新材质实例... (%d)"), CreatedMIs.Num()));
+		{
+			FMaterialUpdateContext UpdateContext;
+			for (UMaterialInstanceConstant* MI : CreatedMIs)
+			{
+				MI->PostEditChange();
+				UpdateContext.AddMaterialInstance(MI);
+			}
+		}
+		const double PostEditMs = (FPlatformTime::Seconds() - PhaseStartSeconds) * 1000.0;
+
+		PhaseStartSeconds = FPlatformTime::Seconds();
+		TArray<UObject*> ObjectsToSave;
+		ObjectsToSave.Reserve(CreatedMIs.Num() * 2);
+		for (UMaterialInstanceConstant* MI : CreatedMIs)
+		{
+			ObjectsToSave.Add(MI);
+		}
+		for (int32 Index = 0; Index < CreatedMIs.Num(); ++Index)
+		{
+			UMaterialInstanceConstant* MI = CreatedMIs[Index];
+			UStaticMesh* Mesh = GroupAssets[Index].Mesh;
 
-			Mesh->Modify();
+			// SetMaterial already sends a StaticMaterials property change; a bare PostEditChange would rebuild the mesh.
+			FHCICommitUndoScope::ModifyObject(Mesh);
 			Mesh->SetMaterial(0, MI);
-			Mesh->PostEditChange();
-			UEditorAssetLibrary::SaveLoadedAsset(Mesh, false);
+			ObjectsToSave.Add(Mesh);
 			AppliedAssignments.Add(FString::Printf(TEXT("%s (Slot0) -> %s"), *Mesh->GetPathName(), *MI->GetPathName()));
 		}
+		const double AssignMs = (FPlatformTime::Seconds() - PhaseStartSeconds) * 1000.0;
+
+		PhaseStartSeconds = FPlatformTime::Seconds();
+		Notify.Update(TEXT("Auto-Material：等待着色器编译..."));
+		if (GShaderCompilingManager)
+		{
+			GShaderCompilingManager->FinishAllCompilation();
+		}
+		const double ShaderWaitMs = (FPlatformTime::Seconds() - PhaseStartSeconds) * 1000.0;
+
+		PhaseStartSeconds = FPlatformTime::Seconds();
+		Notify.Update(FString::Printf(TEXT("Auto-Material：保存资产... (%d)"), ObjectsToSave.Num()));
+		if (ObjectsToSave.Num() > 0 && !UEditorAssetLibrary::SaveLoadedAssets(ObjectsToSave, false))
+		{
+			FailedRows.Add(FString::Printf(TEXT("batch_save_failed (%d assets)"), ObjectsToSave.Num()));
+		}
+		const double SaveMs = (FPlatformTime::Seconds() - PhaseStartSeconds) * 1000.0;
 
 		OutResult = FHCIAgentToolActionResult();
 		const bool bAllOk = FailedRows.Num() == 0;
@@ -791,6 +646,7 @@ private:
 		OutResult.Evidence.Add(TEXT("target_root"), TargetRoot);
 		OutResult.Evidence.Add(TEXT("master_material_path"), MasterMaterialPath);
 		OutResult.Evidence.Add(TEXT("group_count"), FString::FromInt(ReadyGroups.Num()));
+		OutResult.Evidence.Add(TEXT("grouping_cached"), bGroupingFromCache ? TEXT("true") : TEXT("false"));
 		OutResult.Evidence.Add(TEXT("proposed_material_instances"), ProposedInstances.Num() > 0 ? FString::Join(ProposedInstances, TEXT(" | ")) : TEXT("none"));
 		OutResult.Evidence.Add(TEXT("proposed_mesh_assignments"), ProposedAssignments.Num() > 0 ? FString::Join(ProposedAssignments, TEXT(" | ")) : TEXT("none"));
 		OutResult.Evidence.Add(TEXT("proposed_parameter_bindings"), ProposedBindings.Num() > 0 ? FString::Join(ProposedBindings, TEXT(" | ")) : TEXT("none"));
@@ -800,13 +656,24 @@ private:
 		OutResult.Evidence.Add(TEXT("orphan_asset_reasons"), HCI_BuildReasonEvidenceString(OrphanReasonByPath));
 		OutResult.Evidence.Add(TEXT("unresolved_asset_reasons"), HCI_BuildReasonEvidenceString(UnresolvedReasonByPath));
 		OutResult.Evidence.Add(TEXT("result"), OutResult.Reason);
+		OutResult.Evidence.Add(TEXT("saved_asset_count"), FString::FromInt(ObjectsToSave.Num()));
+		OutResult.Evidence.Add(TEXT("phase_create_ms"), FString::Printf(TEXT("%.3f"), CreateMs));
+		OutResult.Evidence.Add(TEXT("phase_post_edit_ms"), FString::Printf(TEXT("%.3f"), PostEditMs));
+		OutResult.Evidence.Add(TEXT("phase_assign_ms"), FString::Printf(TEXT("%.3f"), AssignMs));
+		OutResult.Evidence.Add(TEXT("phase_shader_wait_ms"), FString::Printf(TEXT("%.3f"), ShaderWaitMs));
+		OutResult.Evidence.Add(TEXT("phase_save_ms"), FString::Printf(TEXT("%.3f"), SaveMs));
 		if (FailedRows.Num() > 0)
 		{
 			OutResult.Evidence.Add(TEXT("failed_assets"), FString::Join(FailedRows, TEXT(" | ")));
 		}
+		Artifact.WriteToResult(OutResult, false);
+		if (bCancelled)
+		{
+			FHCIToolActionEvidenceBuilder::MarkCancelled(OutResult, Completed, ReadyGroups.Num());
+		}
 
-		Notify.Finish(bAllOk, bAllOk ? TEXT("完成：Auto-Material") : TEXT("完成：Auto-Material（失败）"));
-		return bAllOk;
+		Notify.Finish(OutResult.bSucceeded, OutResult.bSucceeded ? TEXT("完成：Auto-Material") : TEXT("完成：Auto-Material（失败）"));
+		return OutResult.bSucceeded;
 	}
 };
 }
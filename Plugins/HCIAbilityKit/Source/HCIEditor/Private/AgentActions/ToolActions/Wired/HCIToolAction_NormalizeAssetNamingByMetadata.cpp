@@ -2,12 +2,14 @@
 
 #include "AgentActions/Support/HCIAssetNamingRules.h"
 #include "AgentActions/Support/HCIAssetPathUtils.h"
+#include "AgentActions/Support/HCIProposalArtifact.h"
 #include "AgentActions/Support/HCIToolActionAssetPathNormalizer.h"
 #include "AgentActions/Support/HCIToolActionEvidenceBuilder.h"
 #include "AgentActions/Support/HCIToolActionParamParser.h"
 #include "AgentActions/ToolActions/Wired/Internal/HCINormalizeAssetNamingByMetadata_Internal.h"
 
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "Dom/JsonValue.h"
 #include "EditorAssetLibrary.h"
 #include "Framework/Application/SlateApplication.h"
 #include "Framework/Notifications/NotificationManager.h"
@@ -53,6 +55,119 @@ private:
 		bool bNeedsMove = false;
 	};
 
+	struct FHCINormalizeItem
+	{
+		FString SourceAssetPath;
+		FString SourceObjectPath;
+		FString SourcePackagePath;
+		FString SourceAssetName;
+		FName PackageName;
+		FString Prefix;
+		FString BaseNameFromMetadata;
+		EHCITextureRole TextureRole = EHCITextureRole::Unknown;
+		FString GroupNameFromName;
+		FString EffectiveGroupName;
+		bool bIsAnchor = false;
+		bool bIsShared = false;
+	};
+
+	// Registry lookup and metadata parse for one item. The result is written to OutPayload (the item's proposal
+	// artifact entry): either "failed_row" or package/prefix/base/role/group.
+	static void HCI_DiscoverNormalizeItem(
+		IAssetRegistry& AssetRegistry,
+		const FHCIAssetRoutingRules& RoutingRules,
+		const FString& MetadataSource,
+		const FHCINormalizeItem& Item,
+		FJsonObject& OutPayload)
+	{
+		const FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(Item.SourceObjectPath));
+		if (!AssetData.IsValid())
+		{
+			// Fallback: confirm existence via editor library so user gets a clearer error.
+			OutPayload.SetStringField(
+				TEXT("failed_row"),
+				!UEditorAssetLibrary::DoesAssetExist(Item.SourceAssetPath)
+					? FString::Printf(TEXT("%s (not_found)"), *Item.SourceAssetPath)
+					: FString::Printf(TEXT("%s (asset_registry_missing)"), *Item.SourceObjectPath));
+			return;
+		}
+
+		const FString Prefix = HCIAssetNamingRules::DeriveClassPrefixFromAssetData(AssetData);
+
+		FString BaseNameFromMetadata;
+		FString FailureReason;
+		if (!HCI_TryBuildNormalizedNameBaseFromAssetData(
+				AssetData,
+				MetadataSource,
+				Prefix,
+				Item.SourceAssetName,
+				BaseNameFromMetadata,
+				FailureReason))
+		{
+			OutPayload.SetStringField(TEXT("failed_row"), FString::Printf(TEXT("%s (%s)"), *Item.SourceObjectPath, *FailureReason));
+			return;
+		}
+
+		TArray<FString> Tokens;
+		BaseNameFromMetadata.ParseIntoArray(Tokens, TEXT("_"), true);
+		TArray<FString> TokensLower;
+		TokensLower.Reserve(Tokens.Num());
+		for (const FString& Tok : Tokens)
+		{
+			TokensLower.Add(Tok.ToLower());
+		}
+
+		EHCITextureRole TextureRole = EHCITextureRole::Unknown;
+		if (Prefix == TEXT("T"))
+		{
+			TextureRole = HCI_DetectTextureRoleFromTokens(TokensLower);
+			if (TextureRole != EHCITextureRole::Unknown && TokensLower.Num() > 0)
+			{
+				TokensLower.Pop();
+			}
+		}
+
+		HCI_TrimCommonTrailingNoiseTokens(TokensLower);
+
+		FString GroupSanitized;
+		if (TokensLower.Num() > 0)
+		{
+			GroupSanitized = FString::Join(TokensLower, TEXT("_"));
+		}
+		if (GroupSanitized.IsEmpty())
+		{
+			GroupSanitized = BaseNameFromMetadata;
+		}
+
+		FString GroupName = HCIAssetNamingRules::SanitizeIdentifier(GroupSanitized);
+		if (RoutingRules.bGroupNamePascalCase)
+		{
+			GroupName = HCI_ToPascalCase(GroupName);
+			GroupName = HCIAssetNamingRules::SanitizeIdentifier(GroupName);
+		}
+		if (GroupName.IsEmpty())
+		{
+			GroupName = TEXT("Asset");
+		}
+
+		OutPayload.SetStringField(TEXT("package"), AssetData.PackageName.ToString());
+		OutPayload.SetStringField(TEXT("prefix"), Prefix);
+		OutPayload.SetStringField(TEXT("base"), BaseNameFromMetadata);
+		OutPayload.SetNumberField(TEXT("role"), static_cast<int32>(TextureRole));
+		OutPayload.SetStringField(TEXT("group"), GroupName);
+	}
+
+	static void HCI_ApplyNormalizeItemPayload(const FJsonObject& Payload, FHCINormalizeItem& Item)
+	{
+		Item.PackageName = FName(*Payload.GetStringField(TEXT("package")));
+		Item.Prefix = Payload.GetStringField(TEXT("prefix"));
+		Item.BaseNameFromMetadata = Payload.GetStringField(TEXT("base"));
+		Item.TextureRole = static_cast<EHCITextureRole>(Payload.GetIntegerField(TEXT("role")));
+		Item.GroupNameFromName = Payload.GetStringField(TEXT("group"));
+		Item.EffectiveGroupName = Item.GroupNameFromName;
+		Item.bIsAnchor = (Item.Prefix == TEXT("SM") || Item.Prefix == TEXT("SK"));
+	}
+
 	static bool HCI_TryFindAvailableDestination(
 		const FString& SourceObjectPath,
 		const FString& DestinationDir,
@@ -219,27 +334,24 @@ private:
 		FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
 		IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
 
-		struct FHCINormalizeItem
-		{
-			FString SourceAssetPath;
-			FString SourceObjectPath;
-			FString SourcePackagePath;
-			FString SourceAssetName;
-			FName PackageName;
-			FAssetData AssetData;
-			FString Prefix;
-			FString BaseNameFromMetadata;
-			EHCITextureRole TextureRole = EHCITextureRole::Unknown;
-			FString GroupNameFromName;
-			FString EffectiveGroupName;
-			bool bIsAnchor = false;
-			bool bIsShared = false;
-		};
-
 		TArray<FHCINormalizeItem> Items;
 		Items.Reserve(AssetPaths.Num());
 		TSet<FName> SelectionPackages;
 
+		// Discovery (registry lookup, metadata parse, dependency query) is recorded per item in the proposal
+		// artifact. A commit after a dry run reuses every entry whose package is unchanged and recomputes the rest.
+		FHCIProposalArtifact Artifact(
+			TEXT("NormalizeAssetNamingByMetadata"),
+			RoutingRules.bGroupNamePascalCase ? TEXT("pascal_case") : TEXT("verbatim"));
+		if (!bIsDryRun)
+		{
+			Artifact.Load(Request.ProposalArtifact);
+		}
+		TMap<FName, TSharedRef<FJsonObject>> PayloadByPackage;
+		// Dependencies stored in the artifact are limited to the requested packages, not just the resolved ones,
+		// so an item that resolves only at commit time is still linked from reused entries.
+		TSet<FName> RequestedPackages;
+
 		Notify.Update(TEXT("阶段：解析资产列表与元数据..."));
 		for (const FString& RawPath : AssetPaths)
 		{
@@ -252,85 +364,30 @@ private:
 				FailedRows.Add(FString::Printf(TEXT("%s (invalid_object_path)"), *Item.SourceObjectPath));
 				continue;
 			}
+			RequestedPackages.Add(FName(*Item.SourcePackagePath));
 
-			Item.AssetData = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(Item.SourceObjectPath));
-			if (!Item.AssetData.IsValid())
+			const FString Fingerprint = FHCIProposalArtifact::ComputePackageFingerprint(Item.SourceObjectPath);
+			TSharedPtr<FJsonObject> Payload = Artifact.FindFresh(Item.SourceObjectPath, Fingerprint);
+			if (!Payload.IsValid())
 			{
-				// Fallback: confirm existence via editor library so user gets a clearer error.
-				if (!UEditorAssetLibrary::DoesAssetExist(Item.SourceAssetPath))
-				{
-					FailedRows.Add(FString::Printf(TEXT("%s (not_found)"), *Item.SourceAssetPath));
-				}
-				else
-				{
-					FailedRows.Add(FString::Printf(TEXT("%s (asset_registry_missing)"), *Item.SourceObjectPath));
-				}
-				continue;
-			}
-
-			Item.PackageName = Item.AssetData.PackageName;
-			SelectionPackages.Add(Item.PackageName);
-
-			Item.Prefix = HCIAssetNamingRules::DeriveClassPrefixFromAssetData(Item.AssetData);
-			Item.bIsAnchor = (Item.Prefix == TEXT("SM") || Item.Prefix == TEXT("SK"));
-
-			FString FailureReason;
-			if (!HCI_TryBuildNormalizedNameBaseFromAssetData(
-					Item.AssetData,
-					MetadataSource,
-					Item.Prefix,
-					Item.SourceAssetName,
-					Item.BaseNameFromMetadata,
-					FailureReason))
-			{
-				FailedRows.Add(FString::Printf(TEXT("%s (%s)"), *Item.SourceObjectPath, *FailureReason));
-				continue;
+				Payload = MakeShared<FJsonObject>();
+				HCI_DiscoverNormalizeItem(AssetRegistry, RoutingRules, MetadataSource, Item, *Payload);
 			}
-
-			TArray<FString> Tokens;
-			Item.BaseNameFromMetadata.ParseIntoArray(Tokens, TEXT("_"), true);
-			TArray<FString> TokensLower;
-			TokensLower.Reserve(Tokens.Num());
-			for (const FString& Tok : Tokens)
+			if (bIsDryRun)
 			{
-				TokensLower.Add(Tok.ToLower());
+				Artifact.AddEntry(Item.SourceObjectPath, Fingerprint, Payload.ToSharedRef());
 			}
 
-			Item.TextureRole = EHCITextureRole::Unknown;
-			if (Item.Prefix == TEXT("T"))
+			FString FailedRow;
+			if (Payload->TryGetStringField(TEXT("failed_row"), FailedRow))
 			{
-				Item.TextureRole = HCI_DetectTextureRoleFromTokens(TokensLower);
-				if (Item.TextureRole != EHCITextureRole::Unknown && TokensLower.Num() > 0)
-				{
-					TokensLower.Pop();
-				}
-			}
-
-			HCI_TrimCommonTrailingNoiseTokens(TokensLower);
-
-			FString GroupSanitized;
-			if (TokensLower.Num() > 0)
-			{
-				GroupSanitized = FString::Join(TokensLower, TEXT("_"));
-			}
-			if (GroupSanitized.IsEmpty())
-			{
-				GroupSanitized = Item.BaseNameFromMetadata;
-			}
-
-			FString GroupName = HCIAssetNamingRules::SanitizeIdentifier(GroupSanitized);
-			if (RoutingRules.bGroupNamePascalCase)
-			{
-				GroupName = HCI_ToPascalCase(GroupName);
-				GroupName = HCIAssetNamingRules::SanitizeIdentifier(GroupName);
-			}
-			if (GroupName.IsEmpty())
-			{
-				GroupName = TEXT("Asset");
+				FailedRows.Add(MoveTemp(FailedRow));
+				continue;
 			}
 
-			Item.GroupNameFromName = GroupName;
-			Item.EffectiveGroupName = GroupName;
+			HCI_ApplyNormalizeItemPayload(*Payload, Item);
+			SelectionPackages.Add(Item.PackageName);
+			PayloadByPackage.Add(Item.PackageName, Payload.ToSharedRef());
 			Items.Add(MoveTemp(Item));
 		}
 
@@ -358,12 +415,33 @@ private:
 
 				for (const FName& Pkg : SelectionPackages)
 				{
+					const TSharedRef<FJsonObject>& Payload = PayloadByPackage.FindChecked(Pkg);
 					TArray<FName> Deps;
-					AssetRegistry.GetDependencies(
-						Pkg,
-						Deps,
-						UE::AssetRegistry::EDependencyCategory::Package,
-						UE::AssetRegistry::FDependencyQuery(UE::AssetRegistry::EDependencyQuery::Hard));
+					const TArray<TSharedPtr<FJsonValue>>* CachedDeps = nullptr;
+					if (Payload->TryGetArrayField(TEXT("deps"), CachedDeps) && CachedDeps != nullptr)
+					{
+						for (const TSharedPtr<FJsonValue>& Dep : *CachedDeps)
+						{
+							Deps.Add(FName(*Dep->AsString()));
+						}
+					}
+					else
+					{
+						AssetRegistry.GetDependencies(
+							Pkg,
+							Deps,
+							UE::AssetRegistry::EDependencyCategory::Package,
+							UE::AssetRegistry::FDependencyQuery(UE::AssetRegistry::EDependencyQuery::Hard));
+						Deps.RemoveAll([&RequestedPackages](const FName& Dep) { return !RequestedPackages.Contains(Dep); });
+
+						TArray<TSharedPtr<FJsonValue>> DepValues;
+						DepValues.Reserve(Deps.Num());
+						for (const FName& Dep : Deps)
+						{
+							DepValues.Add(MakeShared<FJsonValueString>(Dep.ToString()));
+						}
+						Payload->SetArrayField(TEXT("deps"), DepValues);
+					}
 					Deps.RemoveAll([&SelectionPackages](const FName& Dep) { return !SelectionPackages.Contains(Dep); });
 					DepsByPkg.Add(Pkg, MoveTemp(Deps));
 				}
@@ -558,6 +636,9 @@ private:
 
 		Notify.Update(FString::Printf(TEXT("阶段：已生成提案 (proposals=%d)"), Proposals.Num()));
 		int32 AppliedCount = 0;
+		// Only the move/rename loop is cancellable; moves already applied stay inside the business transaction.
+		int32 ProcessedCount = 0;
+		bool bCancelled = false;
 		if (!bIsDryRun && Proposals.Num() > 0)
 		{
 			Notify.Update(FString::Printf(TEXT("阶段：执行移动/重命名... (ops=%d)"), Proposals.Num()));
@@ -583,14 +664,23 @@ private:
 				if (!HCI_MoveAssetWithAssetTools(Proposal.SourceObjectPath, Proposal.DestinationObjectPath))
 				{
 					FailedRows.Add(FString::Printf(TEXT("%s (rename_move_failed)"), *Proposal.SourceObjectPath));
-					continue;
 				}
-				++AppliedCount;
-				if ((AppliedCount % 10) == 0)
+				else
+				{
+					++AppliedCount;
+					if ((AppliedCount % 10) == 0)
+					{
+						Notify.Update(FString::Printf(TEXT("阶段：执行移动/重命名... (%d/%d)"), AppliedCount, Proposals.Num()));
+						// Keep editor UI responsive during large batch operations.
+						FSlateApplication::Get().PumpMessages();
+					}
+				}
+
+				++ProcessedCount;
+				if (Request.ShouldStopAfterAsset(ProcessedCount, Proposals.Num()))
 				{
-					Notify.Update(FString::Printf(TEXT("阶段：执行移动/重命名... (%d/%d)"), AppliedCount, Proposals.Num()));
-					// Keep editor UI responsive during large batch operations.
-					FSlateApplication::Get().PumpMessages();
+					bCancelled = true;
+					break;
 				}
 			}
 		}
@@ -615,6 +705,11 @@ private:
 		{
 			OutResult.Evidence.Add(TEXT("failed_assets"), FString::Join(FailedRows, TEXT(" | ")));
 		}
+		Artifact.WriteToResult(OutResult, bIsDryRun);
+		if (bCancelled)
+		{
+			FHCIToolActionEvidenceBuilder::MarkCancelled(OutResult, ProcessedCount, Proposals.Num());
+		}
 
 		Notify.Finish(
 			OutResult.bSucceeded,
@@ -87,6 +87,12 @@ public:
 			return true;
 		}
 
+		if (Request.IsCancelRequested())
+		{
+			FHCIToolActionEvidenceBuilder::MarkCancelled(OutResult, 0, 1);
+			return false;
+		}
+
 		const int32 DotIndex = DestinationAssetPath.Find(TEXT("."), ESearchCase::CaseSensitive, ESearchDir::FromStart);
 		const FString DestinationPackagePath = (DotIndex == INDEX_NONE) ? DestinationAssetPath : DestinationAssetPath.Left(DotIndex);
 		const FString DestinationDir = HCIAssetPathUtils::GetDirectoryFromPackagePath(DestinationPackagePath);
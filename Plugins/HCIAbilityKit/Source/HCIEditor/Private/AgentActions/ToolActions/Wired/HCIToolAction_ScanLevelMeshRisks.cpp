@@ -1,16 +1,518 @@
 #include "AgentActions/ToolActions/HCIToolActionFactories.h"
 
+#include "AgentActions/Support/HCIChunkedActorLoadDriver.h"
+#include "AgentActions/Support/HCILevelMeshScanIndex.h"
 #include "AgentActions/Support/HCIToolActionEvidenceBuilder.h"
 #include "AgentActions/Support/HCIToolActionParamParser.h"
 
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
 #include "Components/StaticMeshComponent.h"
 #include "Editor.h"
 #include "Engine/Selection.h"
-#include "EngineUtils.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "HAL/PlatformMemory.h"
+#include "Materials/MaterialInterface.h"
+#include "Misc/ScopedSlowTask.h"
 #include "PhysicsEngine/BodySetup.h"
+#include "UObject/ObjectKey.h"
+#include "WorldPartition/WorldPartition.h"
+#include "WorldPartition/WorldPartitionActorDescInstance.h"
+#include "WorldPartition/WorldPartitionHelpers.h"
 
 namespace
 {
+constexpr int32 HCIDefaultWorldPartitionBatchSize = 256;
+
+// Mesh-level answers are shared by every component that renders the same UStaticMesh, so one scan
+// evaluates BodySetup and default slot materials once per unique mesh instead of once per instance.
+// Keys carry the object serial so chunked scans stay correct when meshes are collected between batches.
+struct FHCIMeshRiskScanMemo
+{
+	TMap<TObjectKey<UStaticMesh>, bool> CollisionInvalidByMesh;
+	TMap<TObjectKey<UStaticMesh>, bool> DefaultMaterialByMesh;
+	TMap<TObjectKey<UMaterialInterface>, bool> DefaultLikeByMaterial;
+
+	int32 GetUniqueMeshCount() const
+	{
+		return FMath::Max(CollisionInvalidByMesh.Num(), DefaultMaterialByMesh.Num());
+	}
+
+	bool IsMeshCollisionInvalid(UStaticMesh* StaticMesh)
+	{
+		if (const bool* Cached = CollisionInvalidByMesh.Find(StaticMesh))
+		{
+			return *Cached;
+		}
+
+		bool bMeshCollisionInvalid = false;
+		UBodySetup* BodySetup = StaticMesh->GetBodySetup();
+		if (!BodySetup)
+		{
+			bMeshCollisionInvalid = true;
+		}
+		else
+		{
+			const bool bHasPrimitives = BodySetup->AggGeom.GetElementCount() > 0;
+			const bool bIsComplexAsSimple =
+				BodySetup->CollisionTraceFlag == ECollisionTraceFlag::CTF_UseComplexAsSimple;
+			const bool bCollideAll = BodySetup->bMeshCollideAll;
+			bMeshCollisionInvalid = !bHasPrimitives && !bIsComplexAsSimple && !bCollideAll;
+		}
+		return CollisionInvalidByMesh.Add(StaticMesh, bMeshCollisionInvalid);
+	}
+
+	bool HasDefaultMaterial(UStaticMeshComponent* Component, UStaticMesh* StaticMesh)
+	{
+		for (const UMaterialInterface* OverrideMaterial : Component->OverrideMaterials)
+		{
+			if (OverrideMaterial)
+			{
+				return EvaluateComponentSlots(Component);
+			}
+		}
+		return HasDefaultMeshMaterial(StaticMesh);
+	}
+
+	// Answer for a component without material overrides: every slot resolves to the mesh's own material.
+	bool HasDefaultMeshMaterial(UStaticMesh* StaticMesh)
+	{
+		if (const bool* Cached = DefaultMaterialByMesh.Find(StaticMesh))
+		{
+			return *Cached;
+		}
+
+		const int32 NumMaterials = StaticMesh->GetStaticMaterials().Num();
+		bool bHasDefaultMaterial = NumMaterials == 0;
+		for (int32 MaterialIndex = 0; MaterialIndex < NumMaterials && !bHasDefaultMaterial; ++MaterialIndex)
+		{
+			bHasDefaultMaterial = IsDefaultLikeMaterial(StaticMesh->GetMaterial(MaterialIndex));
+		}
+		return DefaultMaterialByMesh.Add(StaticMesh, bHasDefaultMaterial);
+	}
+
+private:
+	bool EvaluateComponentSlots(UStaticMeshComponent* Component)
+	{
+		const int32 NumMaterials = Component->GetNumMaterials();
+		if (NumMaterials == 0)
+		{
+			return true;
+		}
+
+		for (int32 MaterialIndex = 0; MaterialIndex < NumMaterials; ++MaterialIndex)
+		{
+			if (IsDefaultLikeMaterial(Component->GetMaterial(MaterialIndex)))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool IsDefaultLikeMaterial(UMaterialInterface* Material)
+	{
+		if (!Material)
+		{
+			return true;
+		}
+		if (const bool* Cached = DefaultLikeByMaterial.Find(Material))
+		{
+			return *Cached;
+		}
+
+		const FString MaterialName = Material->GetName();
+		const bool bDefaultLike =
+			MaterialName.Contains(TEXT("Default")) ||
+			MaterialName.Contains(TEXT("WorldGrid")) ||
+			MaterialName.Contains(TEXT("BasicShape")) ||
+			Material->GetPathName().StartsWith(TEXT("/Engine/"));
+		return DefaultLikeByMaterial.Add(Material, bDefaultLike);
+	}
+};
+
+struct FHCILevelMeshRiskAccumulator
+{
+	bool bCheckMissingCollision = false;
+	bool bCheckDefaultMaterial = false;
+	int32 MaxActorCount = 0;
+	int32 ScannedCount = 0;
+	FHCIMeshRiskScanMemo MeshMemo;
+
+	TArray<FString> RiskyActorNames;
+	TArray<FString> RiskyActorPaths;
+	TArray<FString> RiskIssueDetails;
+	TArray<FString> MissingCollisionActors;
+	TArray<FString> DefaultMaterialActors;
+
+	bool IsFull() const
+	{
+		return MaxActorCount > 0 && ScannedCount >= MaxActorCount;
+	}
+
+	void ScanActor(AActor* Actor, FHCILevelMeshScanIndex& ScanIndex)
+	{
+		if (!Actor)
+		{
+			return;
+		}
+
+		ScanIndex.GatherMeshComponents(Actor, MeshComponents);
+		if (MeshComponents.Num() == 0)
+		{
+			return;
+		}
+
+		bool bHasValidStaticMeshComponent = false;
+		for (UStaticMeshComponent* Comp : MeshComponents)
+		{
+			if (Comp && Comp->GetStaticMesh())
+			{
+				bHasValidStaticMeshComponent = true;
+				break;
+			}
+		}
+		if (!bHasValidStaticMeshComponent)
+		{
+			return;
+		}
+
+		// Count only actors that actually have scanable static meshes.
+		++ScannedCount;
+
+		bool bMissingCollisionForActor = false;
+		bool bDefaultMaterialForActor = false;
+		FString RiskReason;
+
+		for (UStaticMeshComponent* SMC : MeshComponents)
+		{
+			if (!SMC)
+			{
+				continue;
+			}
+
+			UStaticMesh* SM = SMC->GetStaticMesh();
+			if (!SM)
+			{
+				continue;
+			}
+
+			if (bCheckMissingCollision && !bMissingCollisionForActor)
+			{
+				const bool bComponentCollisionDisabled =
+					(SMC->GetCollisionEnabled() == ECollisionEnabled::NoCollision) || !SMC->IsCollisionEnabled();
+
+				if (bComponentCollisionDisabled || MeshMemo.IsMeshCollisionInvalid(SM))
+				{
+					bMissingCollisionForActor = true;
+					RiskReason += TEXT("[MissingCollision]");
+				}
+			}
+
+			if (bCheckDefaultMaterial && !bDefaultMaterialForActor)
+			{
+				if (MeshMemo.HasDefaultMaterial(SMC, SM))
+				{
+					bDefaultMaterialForActor = true;
+					RiskReason += TEXT("[DefaultMaterial]");
+				}
+			}
+
+			if ((!bCheckMissingCollision || bMissingCollisionForActor) &&
+				(!bCheckDefaultMaterial || bDefaultMaterialForActor))
+			{
+				break;
+			}
+		}
+
+		AddRisk(Actor->GetActorLabel(), Actor->GetPathName(), bMissingCollisionForActor, bDefaultMaterialForActor, RiskReason);
+	}
+
+	void AddRisk(
+		const FString& ActorLabel,
+		const FString& ActorPath,
+		const bool bMissingCollision,
+		const bool bDefaultMaterial,
+		const FString& RiskReason)
+	{
+		if (!bMissingCollision && !bDefaultMaterial)
+		{
+			return;
+		}
+
+		if (bMissingCollision)
+		{
+			MissingCollisionActors.Add(ActorLabel);
+		}
+		if (bDefaultMaterial)
+		{
+			DefaultMaterialActors.Add(ActorLabel);
+		}
+
+		const FString Reason = RiskReason.IsEmpty() ? FString(TEXT("-")) : RiskReason;
+		RiskyActorNames.Add(FString::Printf(TEXT("%s %s"), *ActorLabel, *Reason));
+		RiskyActorPaths.Add(ActorPath);
+		RiskIssueDetails.Add(Reason);
+	}
+
+private:
+	TArray<UStaticMeshComponent*> MeshComponents;
+};
+
+struct FHCIWorldPartitionScanStats
+{
+	FString Status = TEXT("completed");
+	int32 TotalActorDescCount = 0;
+	int32 CandidateActorDescCount = 0;
+	int32 MetadataResolvedCount = 0;
+	int32 LoadedBatchCount = 0;
+	int32 LoadedActorCount = 0;
+	uint64 PeakUsedPhysicalMB = 0;
+};
+
+static bool HCI_DescMatchesName(const FWorldPartitionActorDescInstance& Desc, const TArray<FString>& RequestedActorNames)
+{
+	if (RequestedActorNames.Num() == 0)
+	{
+		return true;
+	}
+
+	const FString ActorLabel = Desc.GetActorLabel().ToString();
+	const FString ActorName = Desc.GetActorName().ToString();
+	const FString ActorPath = Desc.GetActorSoftPath().ToString();
+	return RequestedActorNames.ContainsByPredicate(
+		[&ActorLabel, &ActorName, &ActorPath](const FString& RequestedName)
+		{
+			return ActorLabel.Equals(RequestedName, ESearchCase::IgnoreCase) ||
+				ActorName.Equals(RequestedName, ESearchCase::IgnoreCase) ||
+				ActorPath.Equals(RequestedName, ESearchCase::IgnoreCase);
+		});
+}
+
+static uint64 HCI_GetUsedPhysicalMB()
+{
+	return FPlatformMemory::GetStats().UsedPhysical / (1024ull * 1024ull);
+}
+
+// Plain AStaticMeshActors saved one-file-per-actor hard-reference exactly their mesh and override
+// materials, so mesh-level verdicts can sometimes settle the actor without loading it.
+static bool HCI_TryResolveDescFromMetadata(
+	const FWorldPartitionActorDescInstance& Desc,
+	IAssetRegistry& AssetRegistry,
+	FHCILevelMeshRiskAccumulator& Accumulator)
+{
+	if (Desc.GetActorNativeClass() != AStaticMeshActor::StaticClass() || Desc.GetBaseClass().IsValid())
+	{
+		return false;
+	}
+
+	TArray<FName> Dependencies;
+	AssetRegistry.GetDependencies(
+		Desc.GetActorPackage(),
+		Dependencies,
+		UE::AssetRegistry::EDependencyCategory::Package,
+		UE::AssetRegistry::EDependencyQuery::Hard);
+
+	FSoftObjectPath MeshPath;
+	int32 MeshCount = 0;
+	bool bHasMaterialOverride = false;
+	TArray<FAssetData> PackageAssets;
+	for (const FName& Dependency : Dependencies)
+	{
+		PackageAssets.Reset();
+		AssetRegistry.GetAssetsByPackageName(Dependency, PackageAssets, true);
+		for (const FAssetData& AssetData : PackageAssets)
+		{
+			const UClass* AssetClass = AssetData.GetClass();
+			if (!AssetClass)
+			{
+				continue;
+			}
+			if (AssetClass->IsChildOf(UStaticMesh::StaticClass()))
+			{
+				MeshPath = AssetData.GetSoftObjectPath();
+				++MeshCount;
+			}
+			else if (AssetClass->IsChildOf(UMaterialInterface::StaticClass()))
+			{
+				bHasMaterialOverride = true;
+			}
+		}
+	}
+	if (MeshCount != 1 || (Accumulator.bCheckDefaultMaterial && bHasMaterialOverride))
+	{
+		return false;
+	}
+
+	UStaticMesh* StaticMesh = Cast<UStaticMesh>(MeshPath.TryLoad());
+	if (!StaticMesh)
+	{
+		return false;
+	}
+
+	// A valid mesh body cannot clear the component-level collision flag, which only the loaded actor knows.
+	const bool bMeshCollisionInvalid = Accumulator.bCheckMissingCollision && Accumulator.MeshMemo.IsMeshCollisionInvalid(StaticMesh);
+	if (Accumulator.bCheckMissingCollision && !bMeshCollisionInvalid)
+	{
+		return false;
+	}
+	const bool bDefaultMaterial = Accumulator.bCheckDefaultMaterial && Accumulator.MeshMemo.HasDefaultMeshMaterial(StaticMesh);
+
+	FString RiskReason;
+	if (bMeshCollisionInvalid)
+	{
+		RiskReason += TEXT("[MissingCollision]");
+	}
+	if (bDefaultMaterial)
+	{
+		RiskReason += TEXT("[DefaultMaterial]");
+	}
+
+	++Accumulator.ScannedCount;
+	Accumulator.AddRisk(
+		Desc.GetActorLabel().ToString(),
+		Desc.GetActorSoftPath().ToString(),
+		bMeshCollisionInvalid,
+		bDefaultMaterial,
+		RiskReason);
+	return true;
+}
+
+// Scans every actor descriptor of a World Partition map. Loaded actors are scanned in place, plain
+// static mesh actors are settled from metadata where possible, and the rest are loaded in bounded
+// batches by FHCIChunkedActorLoadDriver, which checks cancellation and the memory ceiling after every load.
+static void HCI_ScanWorldPartitionChunked(
+	const FHCIAgentToolActionRequest& Request,
+	UWorldPartition* WorldPartition,
+	const TArray<FString>& RequestedActorNames,
+	const int32 BatchSize,
+	const int32 MemoryCeilingMB,
+	FHCILevelMeshScanIndex& ScanIndex,
+	FHCILevelMeshRiskAccumulator& Accumulator,
+	FHCIWorldPartitionScanStats& OutStats)
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+
+	TArray<AActor*> LoadedActors;
+	TArray<const FWorldPartitionActorDescInstance*> UnloadedDescs;
+	FWorldPartitionHelpers::ForEachActorDescInstance(
+		WorldPartition,
+		[&](const FWorldPartitionActorDescInstance* Desc)
+		{
+			++OutStats.TotalActorDescCount;
+			if (Desc && HCI_DescMatchesName(*Desc, RequestedActorNames))
+			{
+				if (AActor* LoadedActor = Desc->GetActor())
+				{
+					LoadedActors.Add(LoadedActor);
+				}
+				else
+				{
+					UnloadedDescs.Add(Desc);
+				}
+			}
+			return true;
+		});
+	OutStats.CandidateActorDescCount = LoadedActors.Num() + UnloadedDescs.Num();
+
+	const int32 EstimatedBatchCount = FMath::DivideAndRoundUp(UnloadedDescs.Num(), FMath::Max(1, BatchSize));
+	FScopedSlowTask SlowTask(
+		static_cast<float>(2 + EstimatedBatchCount),
+		NSLOCTEXT("HCIAbilityKit", "ScanLevelMeshRisksChunked", "Scanning World Partition actors for mesh risks..."));
+	SlowTask.MakeDialog(true);
+	const auto ShouldCancel = [&SlowTask, &Request]()
+	{
+		return Request.IsCancelRequested() || SlowTask.ShouldCancel();
+	};
+
+	SlowTask.EnterProgressFrame(1.0f);
+	for (AActor* Actor : LoadedActors)
+	{
+		if (Accumulator.IsFull())
+		{
+			OutStats.Status = TEXT("max_actor_count_reached");
+			return;
+		}
+		if (ShouldCancel())
+		{
+			OutStats.Status = TEXT("cancelled");
+			return;
+		}
+		Accumulator.ScanActor(Actor, ScanIndex);
+	}
+
+	SlowTask.EnterProgressFrame(1.0f);
+	TArray<FGuid> PendingGuids;
+	PendingGuids.Reserve(UnloadedDescs.Num());
+	for (const FWorldPartitionActorDescInstance* Desc : UnloadedDescs)
+	{
+		if (Accumulator.IsFull())
+		{
+			OutStats.Status = TEXT("max_actor_count_reached");
+			return;
+		}
+		if (ShouldCancel())
+		{
+			OutStats.Status = TEXT("cancelled");
+			return;
+		}
+		if (HCI_TryResolveDescFromMetadata(*Desc, AssetRegistry, Accumulator))
+		{
+			++OutStats.MetadataResolvedCount;
+		}
+		else
+		{
+			PendingGuids.Add(Desc->GetGuid());
+		}
+	}
+
+	FHCIChunkedActorLoadHooks Hooks;
+	Hooks.LoadBatch = [&](const TConstArrayView<FGuid> BatchGuids, const TFunctionRef<bool(const FGuid&)> Visit)
+	{
+		FWorldPartitionHelpers::FForEachActorWithLoadingParams LoadParams;
+		LoadParams.ActorGuids.Append(BatchGuids.GetData(), BatchGuids.Num());
+		// References taken for this batch are released when ForEachActorWithLoading returns.
+		FWorldPartitionHelpers::ForEachActorWithLoading(
+			WorldPartition,
+			[&](const FWorldPartitionActorDescInstance* Desc)
+			{
+				if (!Desc)
+				{
+					return true;
+				}
+				Accumulator.ScanActor(Desc->GetActor(), ScanIndex);
+				return Visit(Desc->GetGuid());
+			},
+			LoadParams);
+	};
+	Hooks.IsFull = [&Accumulator]()
+	{
+		return Accumulator.IsFull();
+	};
+	Hooks.ShouldCancel = ShouldCancel;
+	Hooks.GetUsedPhysicalMB = &HCI_GetUsedPhysicalMB;
+	Hooks.ShouldForceCollect = []()
+	{
+		return FWorldPartitionHelpers::HasExceededMaxMemory();
+	};
+	Hooks.CollectGarbage = []()
+	{
+		FWorldPartitionHelpers::DoCollectGarbage();
+	};
+	Hooks.OnBatchBegin = [&SlowTask]()
+	{
+		SlowTask.EnterProgressFrame(1.0f);
+	};
+
+	FHCIChunkedActorLoadStats LoadStats;
+	FHCIChunkedActorLoadDriver::Run(PendingGuids, BatchSize, MemoryCeilingMB, Hooks, LoadStats);
+	OutStats.Status = LoadStats.Status;
+	OutStats.LoadedBatchCount = LoadStats.LoadedBatchCount;
+	OutStats.LoadedActorCount = LoadStats.LoadedActorCount;
+	OutStats.PeakUsedPhysicalMB = LoadStats.PeakUsedPhysicalMB;
+}
+
 class FHCIScanLevelMeshRisksToolAction final : public IHCIAgentToolAction
 {
 public:
@@ -42,6 +544,9 @@ private:
 		TArray<FString> Checks;
 		TArray<FString> RequestedActorNames;
 		int32 MaxActorCount = 0;
+		FString PartitionMode = TEXT("loaded_only");
+		int32 BatchSize = HCIDefaultWorldPartitionBatchSize;
+		int32 MemoryCeilingMB = 0;
 		const FHCIToolActionParamParser Params(Request.Args);
 		if (!Params.TryGetRequiredString(TEXT("scope"), Scope) ||
 			!Params.TryGetRequiredStringArray(TEXT("checks"), Checks) ||
@@ -67,6 +572,24 @@ private:
 			return false;
 		}
 
+		FString PartitionModeArg;
+		if (Params.TryGetOptionalStringFieldRaw(TEXT("partition_mode"), PartitionModeArg))
+		{
+			PartitionMode = PartitionModeArg.TrimStartAndEnd();
+		}
+		if ((PartitionMode != TEXT("loaded_only") && PartitionMode != TEXT("chunked")) ||
+			!Params.TryGetOptionalInt(TEXT("wp_batch_size"), BatchSize) ||
+			!Params.TryGetOptionalInt(TEXT("memory_ceiling_mb"), MemoryCeilingMB) ||
+			BatchSize <= 0 ||
+			MemoryCeilingMB < 0)
+		{
+			OutResult = FHCIAgentToolActionResult();
+			OutResult.bSucceeded = false;
+			OutResult.ErrorCode = TEXT("E4002");
+			OutResult.Reason = TEXT("invalid_partition_args");
+			return false;
+		}
+
 		UWorld* World = nullptr;
 		if (GEditor)
 		{
@@ -85,6 +608,41 @@ private:
 			return false;
 		}
 
+		FHCILevelMeshScanIndex& ScanIndex = FHCILevelMeshScanIndex::Get();
+		ScanIndex.SyncToWorld(World);
+
+		FHCILevelMeshRiskAccumulator Accumulator;
+		Accumulator.bCheckMissingCollision = Checks.Contains(TEXT("missing_collision"));
+		Accumulator.bCheckDefaultMaterial = Checks.Contains(TEXT("default_material"));
+		Accumulator.MaxActorCount = MaxActorCount;
+
+		UWorldPartition* WorldPartition = World->GetWorldPartition();
+		if (Scope == TEXT("all") && PartitionMode == TEXT("chunked") && WorldPartition)
+		{
+			FHCIWorldPartitionScanStats Stats;
+			HCI_ScanWorldPartitionChunked(
+				Request,
+				WorldPartition,
+				RequestedActorNames,
+				BatchSize,
+				MemoryCeilingMB,
+				ScanIndex,
+				Accumulator,
+				Stats);
+			ScanIndex.SyncToWorld(World);
+
+			WriteEvidence(OutResult, Scope, RequestedActorNames, Stats.CandidateActorDescCount, *World, Accumulator);
+			OutResult.Evidence.Add(TEXT("partition_mode"), PartitionMode);
+			OutResult.Evidence.Add(TEXT("wp_status"), Stats.Status);
+			OutResult.Evidence.Add(TEXT("wp_total_actor_descs"), FString::FromInt(Stats.TotalActorDescCount));
+			OutResult.Evidence.Add(TEXT("wp_metadata_resolved_count"), FString::FromInt(Stats.MetadataResolvedCount));
+			OutResult.Evidence.Add(TEXT("wp_loaded_actor_count"), FString::FromInt(Stats.LoadedActorCount));
+			OutResult.Evidence.Add(TEXT("wp_loaded_batch_count"), FString::FromInt(Stats.LoadedBatchCount));
+			OutResult.Evidence.Add(TEXT("wp_peak_used_physical_mb"), LexToString(Stats.PeakUsedPhysicalMB));
+			OutResult.Evidence.Add(TEXT("unique_mesh_count"), FString::FromInt(Accumulator.MeshMemo.GetUniqueMeshCount()));
+			return true;
+		}
+
 		TArray<AActor*> ActorsToScan;
 		if (Scope == TEXT("selected"))
 		{
@@ -120,15 +678,16 @@ private:
 				return false;
 			}
 		}
+		else if (RequestedActorNames.Num() > 0) // "all", filtered through the name hash index
+		{
+			ScanIndex.FindActorsByNames(RequestedActorNames, ActorsToScan);
+		}
 		else // "all"
 		{
-			for (TActorIterator<AActor> It(World); It; ++It)
-			{
-				ActorsToScan.Add(*It);
-			}
+			ScanIndex.GetAllActors(ActorsToScan);
 		}
 
-		if (RequestedActorNames.Num() > 0)
+		if (Scope == TEXT("selected") && RequestedActorNames.Num() > 0)
 		{
 			TArray<AActor*> FilteredActors;
 			FilteredActors.Reserve(ActorsToScan.Num());
@@ -157,165 +716,44 @@ private:
 			ActorsToScan = MoveTemp(FilteredActors);
 		}
 
-		const bool bCheckMissingCollision = Checks.Contains(TEXT("missing_collision"));
-		const bool bCheckDefaultMaterial = Checks.Contains(TEXT("default_material"));
-
-		TArray<FString> RiskyActorNames;
-		TArray<FString> RiskyActorPaths;
-		TArray<FString> RiskIssueDetails;
-		TArray<FString> MissingCollisionActors;
-		TArray<FString> DefaultMaterialActors;
-		int32 ScannedCount = 0;
-
 		for (AActor* Actor : ActorsToScan)
 		{
-			if (MaxActorCount > 0 && ScannedCount >= MaxActorCount)
+			if (Accumulator.IsFull())
 			{
 				break;
 			}
+			Accumulator.ScanActor(Actor, ScanIndex);
+		}
 
-			TArray<UStaticMeshComponent*> MeshComponents;
-			Actor->GetComponents<UStaticMeshComponent>(MeshComponents);
-			if (MeshComponents.Num() == 0)
-			{
-				continue;
-			}
-
-			bool bHasValidStaticMeshComponent = false;
-			for (UStaticMeshComponent* Comp : MeshComponents)
-			{
-				if (Comp && Comp->GetStaticMesh())
-				{
-					bHasValidStaticMeshComponent = true;
-					break;
-				}
-			}
-			if (!bHasValidStaticMeshComponent)
-			{
-				continue;
-			}
-
-			// Count only actors that actually have scanable static meshes.
-			++ScannedCount;
-
-			bool bHasRisk = false;
-			bool bMissingCollisionForActor = false;
-			bool bDefaultMaterialForActor = false;
-			TArray<FString> ActorRiskTags;
-			const FString ActorLabel = Actor->GetActorLabel();
-
-			for (UStaticMeshComponent* SMC : MeshComponents)
-			{
-				if (!SMC)
-				{
-					continue;
-				}
-
-				UStaticMesh* SM = SMC->GetStaticMesh();
-				if (!SM)
-				{
-					continue;
-				}
-
-				if (bCheckMissingCollision && !bMissingCollisionForActor)
-				{
-					const bool bComponentCollisionDisabled =
-						(SMC->GetCollisionEnabled() == ECollisionEnabled::NoCollision) || !SMC->IsCollisionEnabled();
-
-					bool bMeshCollisionInvalid = false;
-					UBodySetup* BodySetup = SM->GetBodySetup();
-					if (!BodySetup)
-					{
-						bMeshCollisionInvalid = true;
-					}
-					else
-					{
-						const bool bHasPrimitives = BodySetup->AggGeom.GetElementCount() > 0;
-						const bool bIsComplexAsSimple =
-							BodySetup->CollisionTraceFlag == ECollisionTraceFlag::CTF_UseComplexAsSimple;
-						const bool bCollideAll = BodySetup->bMeshCollideAll;
-						bMeshCollisionInvalid = !bHasPrimitives && !bIsComplexAsSimple && !bCollideAll;
-					}
-
-					if (bComponentCollisionDisabled || bMeshCollisionInvalid)
-					{
-						bHasRisk = true;
-						bMissingCollisionForActor = true;
-						ActorRiskTags.Add(TEXT("[MissingCollision]"));
-					}
-				}
-
-				if (bCheckDefaultMaterial && !bDefaultMaterialForActor)
-				{
-					bool bHasDefaultMat = false;
-					const int32 NumMaterials = SMC->GetNumMaterials();
-					if (NumMaterials == 0)
-					{
-						bHasDefaultMat = true;
-					}
-					else
-					{
-						for (int32 MaterialIndex = 0; MaterialIndex < NumMaterials; ++MaterialIndex)
-						{
-							UMaterialInterface* Mat = SMC->GetMaterial(MaterialIndex);
-							if (!Mat ||
-								Mat->GetName().Contains(TEXT("Default")) ||
-								Mat->GetName().Contains(TEXT("WorldGrid")) ||
-								Mat->GetName().Contains(TEXT("BasicShape")) ||
-								Mat->GetPathName().StartsWith(TEXT("/Engine/")))
-							{
-								bHasDefaultMat = true;
-								break;
-							}
-						}
-					}
-
-					if (bHasDefaultMat)
-					{
-						bHasRisk = true;
-						bDefaultMaterialForActor = true;
-						ActorRiskTags.Add(TEXT("[DefaultMaterial]"));
-					}
-				}
-
-				if ((!bCheckMissingCollision || bMissingCollisionForActor) &&
-					(!bCheckDefaultMaterial || bDefaultMaterialForActor))
-				{
-					break;
-				}
-			}
-
-			if (bHasRisk)
-			{
-				if (bMissingCollisionForActor)
-				{
-					MissingCollisionActors.Add(ActorLabel);
-				}
-				if (bDefaultMaterialForActor)
-				{
-					DefaultMaterialActors.Add(ActorLabel);
-				}
-
-				const FString RiskReason =
-					ActorRiskTags.Num() > 0 ? FString::Join(ActorRiskTags, TEXT("")) : TEXT("-");
-				RiskyActorNames.Add(FString::Printf(TEXT("%s %s"), *ActorLabel, *RiskReason));
-				RiskyActorPaths.Add(Actor->GetPathName());
-				RiskIssueDetails.Add(RiskReason);
-			}
+		WriteEvidence(OutResult, Scope, RequestedActorNames, ActorsToScan.Num(), *World, Accumulator);
+		if (PartitionMode == TEXT("chunked"))
+		{
+			// Requested on a non-partitioned world (or a selection): every candidate was already loaded.
+			OutResult.Evidence.Add(TEXT("partition_mode"), TEXT("loaded_only"));
 		}
+		return true;
+	}
 
+	static void WriteEvidence(
+		FHCIAgentToolActionResult& OutResult,
+		const FString& Scope,
+		const TArray<FString>& RequestedActorNames,
+		const int32 CandidateActorCount,
+		const UWorld& World,
+		const FHCILevelMeshRiskAccumulator& Accumulator)
+	{
 		OutResult = FHCIAgentToolActionResult();
 		OutResult.bSucceeded = true;
 		OutResult.Reason = TEXT("scan_level_mesh_risks_ok");
-		OutResult.EstimatedAffectedCount = RiskyActorNames.Num();
+		OutResult.EstimatedAffectedCount = Accumulator.RiskyActorNames.Num();
 
 		OutResult.Evidence.Add(TEXT("scope"), Scope);
 		OutResult.Evidence.Add(TEXT("requested_actor_count"), FString::FromInt(RequestedActorNames.Num()));
-		OutResult.Evidence.Add(TEXT("candidate_actor_count"), FString::FromInt(ActorsToScan.Num()));
-		OutResult.Evidence.Add(TEXT("scanned_count"), FString::FromInt(ScannedCount));
-		OutResult.Evidence.Add(TEXT("risky_count"), FString::FromInt(RiskyActorNames.Num()));
+		OutResult.Evidence.Add(TEXT("candidate_actor_count"), FString::FromInt(CandidateActorCount));
+		OutResult.Evidence.Add(TEXT("scanned_count"), FString::FromInt(Accumulator.ScannedCount));
+		OutResult.Evidence.Add(TEXT("risky_count"), FString::FromInt(Accumulator.RiskyActorNames.Num()));
 
-		FString ReportSummary = FString::Printf(TEXT("Scanned %d actors in world '%s', found %d with risks."), ScannedCount, *World->GetName(), RiskyActorNames.Num());
+		FString ReportSummary = FString::Printf(TEXT("Scanned %d actors in world '%s', found %d with risks."), Accumulator.ScannedCount, *World.GetName(), Accumulator.RiskyActorNames.Num());
 		OutResult.Evidence.Add(TEXT("risk_summary"), ReportSummary);
 
 		if (RequestedActorNames.Num() > 0)
@@ -323,9 +761,10 @@ private:
 			OutResult.Evidence.Add(TEXT("actor_names"), FString::Join(RequestedActorNames, TEXT(" | ")));
 		}
 
-		FString AffectedActorsStr = RiskyActorNames.Num() > 0 ? FString::Join(RiskyActorNames, TEXT(" | ")) : TEXT("none");
+		const TArray<FString>& RiskIssueDetails = Accumulator.RiskIssueDetails;
+		FString AffectedActorsStr = Accumulator.RiskyActorNames.Num() > 0 ? FString::Join(Accumulator.RiskyActorNames, TEXT(" | ")) : TEXT("none");
 		OutResult.Evidence.Add(TEXT("risky_actors"), AffectedActorsStr);
-		OutResult.Evidence.Add(TEXT("actor_path"), RiskyActorPaths.Num() > 0 ? RiskyActorPaths[0] : TEXT("-"));
+		OutResult.Evidence.Add(TEXT("actor_path"), Accumulator.RiskyActorPaths.Num() > 0 ? Accumulator.RiskyActorPaths[0] : TEXT("-"));
 		OutResult.Evidence.Add(TEXT("issue"), RiskIssueDetails.Num() > 0 ? RiskIssueDetails[0] : TEXT("none"));
 		OutResult.Evidence.Add(
 			TEXT("evidence"),
@@ -333,18 +772,18 @@ private:
 				? FString::Printf(TEXT("risk_issues=%s"), *FString::Join(RiskIssueDetails, TEXT(" | ")))
 				: TEXT("risk_issues=none"));
 
-		if (MissingCollisionActors.Num() > 0)
+		if (Accumulator.MissingCollisionActors.Num() > 0)
 		{
-			OutResult.Evidence.Add(TEXT("missing_collision_actors"), FString::Join(MissingCollisionActors, TEXT(" | ")));
+			OutResult.Evidence.Add(TEXT("missing_collision_actors"), FString::Join(Accumulator.MissingCollisionActors, TEXT(" | ")));
 		}
 		else
 		{
 			OutResult.Evidence.Add(TEXT("missing_collision_actors"), TEXT("none"));
 		}
 
-		if (DefaultMaterialActors.Num() > 0)
+		if (Accumulator.DefaultMaterialActors.Num() > 0)
 		{
-			OutResult.Evidence.Add(TEXT("default_material_actors"), FString::Join(DefaultMaterialActors, TEXT(" | ")));
+			OutResult.Evidence.Add(TEXT("default_material_actors"), FString::Join(Accumulator.DefaultMaterialActors, TEXT(" | ")));
 		}
 		else
 		{
@@ -352,7 +791,6 @@ private:
 		}
 
 		OutResult.Evidence.Add(TEXT("result"), TEXT("scan_level_mesh_risks_ok"));
-		return true;
 	}
 };
 }
@@ -361,4 +799,3 @@ TSharedPtr<IHCIAgentToolAction> HCIToolActionFactories::MakeScanLevelMeshRisksTo
 {
 	return MakeShared<FHCIScanLevelMeshRisksToolAction>();
 }
-
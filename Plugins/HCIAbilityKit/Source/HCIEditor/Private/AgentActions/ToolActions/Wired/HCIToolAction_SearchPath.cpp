@@ -1,28 +1,18 @@
 #include "AgentActions/ToolActions/HCIToolActionFactories.h"
 
-#include "AgentActions/Support/HCIAssetPathUtils.h"
+#include "AgentActions/Support/HCIPathSearchIndex.h"
 #include "AgentActions/Support/HCIToolActionEvidenceBuilder.h"
 #include "AgentActions/Support/HCIToolActionParamParser.h"
 
-#include "AssetRegistry/AssetRegistryModule.h"
-#include "Modules/ModuleManager.h"
+#include "HAL/PlatformTime.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogHCIAgentToolActions, Log, All);
 
 namespace
 {
-static FString HCI_GetDirectoryLeafName(const FString& Path)
-{
-	return HCIAssetPathUtils::GetDirectoryLeafName(Path);
-}
-
 static FString HCI_NormalizeFuzzyToken(const FString& Text)
 {
-	FString Normalized = Text.ToLower();
-	Normalized.ReplaceInline(TEXT("_"), TEXT(""), ESearchCase::CaseSensitive);
-	Normalized.ReplaceInline(TEXT(" "), TEXT(""), ESearchCase::CaseSensitive);
-	Normalized.ReplaceInline(TEXT("-"), TEXT(""), ESearchCase::CaseSensitive);
-	return Normalized;
+	return FHCIPathSearchIndex::NormalizeFuzzyToken(Text);
 }
 
 static void HCI_AddUniqueSearchKeyword(TArray<FString>& OutKeywords, const FString& Keyword)
@@ -117,56 +107,6 @@ static bool HCI_TryResolveSemanticFallbackDirectory(const TArray<FString>& Searc
 	return false;
 }
 
-static int32 HCI_ComputePathKeywordScore(const FString& Path, const FString& Keyword)
-{
-	const FString KeywordNormalized = HCI_NormalizeFuzzyToken(Keyword);
-	const FString PathNormalized = HCI_NormalizeFuzzyToken(Path);
-	const FString Leaf = HCI_GetDirectoryLeafName(Path);
-	const FString LeafNormalized = HCI_NormalizeFuzzyToken(Leaf);
-
-	if (KeywordNormalized.IsEmpty())
-	{
-		return 0;
-	}
-
-	const bool bLeafExact = (LeafNormalized == KeywordNormalized);
-	const bool bLeafContainsKeyword = LeafNormalized.Contains(KeywordNormalized);
-	const bool bKeywordContainsLeaf = (LeafNormalized.Len() >= 3) && KeywordNormalized.Contains(LeafNormalized);
-	const bool bPathContainsKeyword = PathNormalized.Contains(KeywordNormalized);
-	if (!bLeafExact && !bLeafContainsKeyword && !bKeywordContainsLeaf && !bPathContainsKeyword)
-	{
-		return 0;
-	}
-
-	int32 Score = 0;
-	if (bLeafExact)
-	{
-		Score += 1400;
-	}
-	if (LeafNormalized.StartsWith(KeywordNormalized))
-	{
-		Score += 700;
-	}
-	if (bLeafContainsKeyword)
-	{
-		Score += 550;
-	}
-	if (bKeywordContainsLeaf)
-	{
-		Score += 500;
-	}
-	if (bPathContainsKeyword)
-	{
-		Score += 350;
-	}
-	if (Path.EndsWith(Leaf))
-	{
-		Score += 250;
-	}
-	Score += FMath::Min(80, KeywordNormalized.Len() * 4);
-	return Score;
-}
-
 class FHCISearchPathToolAction final : public IHCIAgentToolAction
 {
 public:
@@ -190,13 +130,6 @@ public:
 	}
 
 private:
-	struct FHCIPathCandidate
-	{
-		FString Path;
-		int32 Score = 0;
-		FString MatchedKeyword;
-	};
-
 	static bool RunInternal(
 		const FHCIAgentToolActionRequest& Request,
 		FHCIAgentToolActionResult& OutResult)
@@ -208,75 +141,21 @@ private:
 			return FHCIToolActionEvidenceBuilder::FailRequiredArgMissing(OutResult);
 		}
 
-		FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
-		IAssetRegistry& Registry = AssetRegistryModule.Get();
-
-		if (!Registry.IsSearchAllAssets())
-		{
-			UE_LOG(
-				LogHCIAgentToolActions,
-				Display,
-				TEXT("[HCI][SearchPath] search_all_assets=start keyword=\"%s\""),
-				*Keyword);
-			Registry.SearchAllAssets(true);
-		}
-
-		if (Registry.IsLoadingAssets())
-		{
-			Registry.WaitForCompletion();
-		}
+		// The index seeds itself from cached paths and follows registry events; it never waits on discovery.
+		FHCIPathSearchIndex& PathIndex = FHCIPathSearchIndex::Get();
+		PathIndex.EnsureBoundToAssetRegistry();
+		const bool bPathIndexReady = PathIndex.IsDiscoveryComplete();
 
-		TArray<FHCIPathCandidate> Candidates;
-		int32 ScannedGamePathCount = 0;
+		const double QueryStartSeconds = FPlatformTime::Seconds();
 		const FString KeywordNormalized = HCI_NormalizeFuzzyToken(Keyword);
 		const TArray<FString> SearchKeywords = HCI_ExpandSearchKeywords(Keyword);
 		const FString ExpandedKeywordsLog = FString::Join(SearchKeywords, TEXT("|"));
-		Registry.EnumerateAllCachedPaths([&](FName PathName)
-		{
-			const FString Path = PathName.ToString();
-			if (!Path.StartsWith(TEXT("/Game/")))
-			{
-				return true;
-			}
-			++ScannedGamePathCount;
-
-			const FString LeafName = HCI_GetDirectoryLeafName(Path);
-			const FString LeafNormalized = HCI_NormalizeFuzzyToken(LeafName);
-			int32 BestScore = 0;
-			FString BestKeyword;
-			for (const FString& SearchKeyword : SearchKeywords)
-			{
-				const int32 Score = HCI_ComputePathKeywordScore(Path, SearchKeyword);
-				if (Score > BestScore)
-				{
-					BestScore = Score;
-					BestKeyword = SearchKeyword;
-				}
-			}
-			if (BestScore <= 0)
-			{
-				return true;
-			}
-
-			FHCIPathCandidate& Candidate = Candidates.AddDefaulted_GetRef();
-			Candidate.Path = Path;
-			Candidate.Score = BestScore;
-			Candidate.MatchedKeyword = BestKeyword;
-			UE_LOG(
-				LogHCIAgentToolActions,
-				Display,
-				TEXT("[HCI][SearchPath] keyword=\"%s\" normalized=\"%s\" matched_keyword=\"%s\" matched_path=\"%s\" leaf=\"%s\" leaf_normalized=\"%s\" score=%d"),
-				*Keyword,
-				*KeywordNormalized,
-				*BestKeyword,
-				*Path,
-				*LeafName,
-				*LeafNormalized,
-				BestScore);
-			return true;
-		});
+		TArray<FHCIPathSearchMatch> Candidates;
+		int32 CandidatePathCount = 0;
+		PathIndex.Query(SearchKeywords, Candidates, &CandidatePathCount);
+		const int32 ScannedGamePathCount = PathIndex.GetPathCount();
 
-		Candidates.Sort([](const FHCIPathCandidate& A, const FHCIPathCandidate& B)
+		Candidates.Sort([](const FHCIPathSearchMatch& A, const FHCIPathSearchMatch& B)
 		{
 			if (A.Score != B.Score)
 			{
@@ -291,14 +170,24 @@ private:
 
 		TArray<FString> MatchedDirectories;
 		MatchedDirectories.Reserve(3);
-		for (const FHCIPathCandidate& Candidate : Candidates)
+		for (const FHCIPathSearchMatch& Candidate : Candidates)
 		{
 			if (MatchedDirectories.Num() >= 3)
 			{
 				break;
 			}
 			MatchedDirectories.Add(Candidate.Path);
+			UE_LOG(
+				LogHCIAgentToolActions,
+				Verbose,
+				TEXT("[HCI][SearchPath] keyword=\"%s\" normalized=\"%s\" matched_keyword=\"%s\" matched_path=\"%s\" score=%d"),
+				*Keyword,
+				*KeywordNormalized,
+				*Candidate.MatchedKeyword,
+				*Candidate.Path,
+				Candidate.Score);
 		}
+		const double QueryMs = (FPlatformTime::Seconds() - QueryStartSeconds) * 1000.0;
 
 		FString SemanticFallbackDirectory;
 		const bool bUsedSemanticFallback = (MatchedDirectories.Num() == 0) &&
@@ -329,6 +218,9 @@ private:
 		OutResult.Evidence.Add(TEXT("semantic_fallback_directory"), bUsedSemanticFallback ? SemanticFallbackDirectory : TEXT("-"));
 		OutResult.Evidence.Add(TEXT("keyword_normalized"), KeywordNormalized);
 		OutResult.Evidence.Add(TEXT("scanned_game_paths"), FString::FromInt(ScannedGamePathCount));
+		OutResult.Evidence.Add(TEXT("candidate_path_count"), FString::FromInt(CandidatePathCount));
+		OutResult.Evidence.Add(TEXT("path_index_ready"), bPathIndexReady ? TEXT("true") : TEXT("false"));
+		OutResult.Evidence.Add(TEXT("query_ms"), FString::Printf(TEXT("%.3f"), QueryMs));
 		for (int32 Index = 0; Index < MatchedDirectories.Num(); ++Index)
 		{
 			OutResult.Evidence.Add(
@@ -339,11 +231,14 @@ private:
 		UE_LOG(
 			LogHCIAgentToolActions,
 			Display,
-			TEXT("[HCI][SearchPath] done keyword=\"%s\" normalized=\"%s\" expanded=\"%s\" scanned_game_paths=%d matched_count=%d best_directory=\"%s\""),
+			TEXT("[HCI][SearchPath] done keyword=\"%s\" normalized=\"%s\" expanded=\"%s\" scanned_game_paths=%d candidate_paths=%d index_ready=%s query_ms=%.3f matched_count=%d best_directory=\"%s\""),
 			*Keyword,
 			*KeywordNormalized,
 			*ExpandedKeywordsLog,
 			ScannedGamePathCount,
+			CandidatePathCount,
+			bPathIndexReady ? TEXT("true") : TEXT("false"),
+			QueryMs,
 			MatchedDirectories.Num(),
 			MatchedDirectories.Num() > 0 ? *MatchedDirectories[0] : TEXT("-"));
 		return true;
@@ -1,9 +1,12 @@
 #include "AgentActions/ToolActions/HCIToolActionFactories.h"
 
+#include "AgentActions/Support/HCICommitUndo.h"
+#include "AgentActions/Support/HCIProposalArtifact.h"
 #include "AgentActions/Support/HCIToolActionAssetPathNormalizer.h"
 #include "AgentActions/Support/HCIToolActionEvidenceBuilder.h"
 #include "AgentActions/Support/HCIToolActionParamParser.h"
 
+#include "Dom/JsonObject.h"
 #include "EditorAssetLibrary.h"
 #include "Engine/StaticMesh.h"
 
@@ -32,6 +35,44 @@ public:
 	}
 
 	private:
+	// Discovery verdicts stored in the proposal artifact.
+	static constexpr const TCHAR* VerdictPending = TEXT("pending");
+	static constexpr const TCHAR* VerdictUnchanged = TEXT("unchanged");
+
+	// Returns VerdictPending (OutMesh set), VerdictUnchanged, or a failure reason.
+	static FString HCI_DiscoverMesh(
+		const FString& AssetPath,
+		const FString& ObjectPath,
+		const FName LODGroupName,
+		UStaticMesh*& OutMesh)
+	{
+		OutMesh = nullptr;
+		if (!UEditorAssetLibrary::DoesAssetExist(AssetPath))
+		{
+			return TEXT("not_found");
+		}
+
+		UObject* Asset = LoadObject<UObject>(nullptr, *ObjectPath);
+		UStaticMesh* Mesh = Cast<UStaticMesh>(Asset);
+		if (!Mesh)
+		{
+			return TEXT("not_staticmesh");
+		}
+
+		if (Mesh->NaniteSettings.bEnabled)
+		{
+			return TEXT("nanite_enabled_blocked");
+		}
+
+		if (Mesh->LODGroup == LODGroupName)
+		{
+			return VerdictUnchanged;
+		}
+
+		OutMesh = Mesh;
+		return VerdictPending;
+	}
+
 	static bool RunInternal(
 		const FHCIAgentToolActionRequest& Request,
 		FHCIAgentToolActionResult& OutResult,
@@ -58,35 +99,51 @@ public:
 		};
 		TArray<FHCIPendingLodUpdate> PendingUpdates;
 
+		// A commit after a dry run only loads meshes whose verdict was "pending" and whose package is unchanged;
+		// unchanged and failed entries are taken from the artifact without touching the asset.
+		FHCIProposalArtifact Artifact(TEXT("SetMeshLODGroup"), LODGroup);
+		if (!bIsDryRun)
+		{
+			Artifact.Load(Request.ProposalArtifact);
+		}
+
 		for (const FString& Path : AssetPaths)
 		{
 			FString AssetPath;
 			FString ObjectPath;
 			FHCIToolActionAssetPathNormalizer::NormalizeAssetPathVariants(Path, AssetPath, ObjectPath);
 
-			if (!UEditorAssetLibrary::DoesAssetExist(AssetPath))
+			const FString Fingerprint = FHCIProposalArtifact::ComputePackageFingerprint(ObjectPath);
+			FString Verdict;
+			UStaticMesh* Mesh = nullptr;
+			if (const TSharedPtr<FJsonObject> Cached = Artifact.FindFresh(ObjectPath, Fingerprint))
 			{
-				FailedAssets.Add(FString::Printf(TEXT("%s (not_found)"), *AssetPath));
-				continue;
+				Cached->TryGetStringField(TEXT("verdict"), Verdict);
+				if (Verdict == VerdictPending)
+				{
+					Mesh = LoadObject<UStaticMesh>(nullptr, *ObjectPath);
+					Verdict = Mesh ? Verdict : FString();
+				}
 			}
-
-			UObject* Asset = LoadObject<UObject>(nullptr, *ObjectPath);
-			UStaticMesh* Mesh = Cast<UStaticMesh>(Asset);
-			if (!Mesh)
+			if (Verdict.IsEmpty())
 			{
-				FailedAssets.Add(FString::Printf(TEXT("%s (not_staticmesh)"), *AssetPath));
-				continue;
+				Verdict = HCI_DiscoverMesh(AssetPath, ObjectPath, LODGroupName, Mesh);
+			}
+			if (bIsDryRun)
+			{
+				const TSharedRef<FJsonObject> Payload = MakeShared<FJsonObject>();
+				Payload->SetStringField(TEXT("verdict"), Verdict);
+				Artifact.AddEntry(ObjectPath, Fingerprint, Payload);
 			}
 
-			if (Mesh->NaniteSettings.bEnabled)
+			if (Verdict == VerdictUnchanged)
 			{
-				bNaniteBlocked = true;
-				FailedAssets.Add(FString::Printf(TEXT("%s (nanite_enabled_blocked)"), *AssetPath));
 				continue;
 			}
-
-			if (Mesh->LODGroup == LODGroupName)
+			if (Verdict != VerdictPending)
 			{
+				bNaniteBlocked |= Verdict == TEXT("nanite_enabled_blocked");
+				FailedAssets.Add(FString::Printf(TEXT("%s (%s)"), *AssetPath, *Verdict));
 				continue;
 			}
 
@@ -108,26 +165,43 @@ public:
 			FHCIToolActionEvidenceBuilder::AddEvidenceInt(OutResult, TEXT("failed_count"), FailedAssets.Num());
 			OutResult.Evidence.Add(TEXT("failed_assets"), FString::Join(FailedAssets, TEXT(" | ")));
 			OutResult.Evidence.Add(TEXT("result"), TEXT("lod_tool_nanite_enabled_blocked"));
+			Artifact.WriteToResult(OutResult, bIsDryRun);
 			return false;
 		}
 
+		// Validation above is all-or-nothing (Nanite blocks the whole step); only the write loop is cancellable.
+		int32 ProcessedCount = 0;
+		bool bCancelled = false;
 		for (const FHCIPendingLodUpdate& Update : PendingUpdates)
 		{
 			if (!Update.Mesh)
 			{
 				FailedAssets.Add(TEXT("<invalid_mesh_ptr> (null_mesh_object)"));
-				continue;
 			}
-
-			if (!bIsDryRun)
+			else
 			{
-				Update.Mesh->Modify();
-				Update.Mesh->LODGroup = LODGroupName;
-				Update.Mesh->PostEditChange();
-				UEditorAssetLibrary::SaveAsset(Update.AssetPath, false);
+				if (!bIsDryRun)
+				{
+					UStaticMesh* Mesh = Update.Mesh;
+					FHCICommitUndoScope::RecordPropertyChange(
+						Mesh,
+						GET_MEMBER_NAME_CHECKED(UStaticMesh, LODGroup),
+						[Mesh, &LODGroupName]()
+						{
+							Mesh->LODGroup = LODGroupName;
+						});
+					Mesh->PostEditChange();
+					UEditorAssetLibrary::SaveAsset(Update.AssetPath, false);
+				}
+				ModifiedAssets.Add(Update.AssetPath);
 			}
 
-			ModifiedAssets.Add(Update.AssetPath);
+			++ProcessedCount;
+			if (Request.ShouldStopAfterAsset(ProcessedCount, PendingUpdates.Num()))
+			{
+				bCancelled = true;
+				break;
+			}
 		}
 
 		OutResult = FHCIAgentToolActionResult();
@@ -150,6 +224,11 @@ public:
 		}
 		
 		OutResult.Evidence.Add(TEXT("result"), OutResult.Reason);
+		Artifact.WriteToResult(OutResult, bIsDryRun);
+		if (bCancelled)
+		{
+			FHCIToolActionEvidenceBuilder::MarkCancelled(OutResult, ProcessedCount, PendingUpdates.Num());
+		}
 		return OutResult.bSucceeded;
 	}
 };
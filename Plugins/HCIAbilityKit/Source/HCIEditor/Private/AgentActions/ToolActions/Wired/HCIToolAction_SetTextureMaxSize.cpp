@@ -1,5 +1,6 @@
 #include "AgentActions/ToolActions/HCIToolActionFactories.h"
 
+#include "AgentActions/Support/HCICommitUndo.h"
 #include "AgentActions/Support/HCIToolActionAssetPathNormalizer.h"
 #include "AgentActions/Support/HCIToolActionEvidenceBuilder.h"
 #include "AgentActions/Support/HCIToolActionParamParser.h"
@@ -48,8 +49,11 @@ private:
 
 		TArray<FString> ModifiedAssets;
 		TArray<FString> FailedAssets;
+		int32 ProcessedCount = 0;
+		bool bCancelled = false;
 
-		for (const FString& Path : AssetPaths)
+		// Polled after each asset, so the last batch reports TotalAssets/TotalAssets.
+		const auto ProcessAsset = [&](const FString& Path)
 		{
 			FString AssetPath;
 			FString ObjectPath;
@@ -58,7 +62,7 @@ private:
 			if (!UEditorAssetLibrary::DoesAssetExist(AssetPath))
 			{
 				FailedAssets.Add(FString::Printf(TEXT("%s (not_found)"), *AssetPath));
-				continue;
+				return;
 			}
 
 			UObject* Asset = LoadObject<UObject>(nullptr, *ObjectPath);
@@ -66,23 +70,38 @@ private:
 			if (!Texture)
 			{
 				FailedAssets.Add(FString::Printf(TEXT("%s (not_texture2d)"), *AssetPath));
-				continue;
+				return;
 			}
 
 			if (Texture->MaxTextureSize == MaxSize)
 			{
-				continue;
+				return;
 			}
 
 			if (!bIsDryRun)
 			{
-				Texture->Modify();
-				Texture->MaxTextureSize = MaxSize;
+				FHCICommitUndoScope::RecordPropertyChange(
+					Texture,
+					GET_MEMBER_NAME_CHECKED(UTexture, MaxTextureSize),
+					[Texture, MaxSize]()
+					{
+						Texture->MaxTextureSize = MaxSize;
+					});
 				Texture->PostEditChange();
 				UEditorAssetLibrary::SaveAsset(AssetPath, false);
 			}
 
 			ModifiedAssets.Add(AssetPath);
+		};
+		for (const FString& Path : AssetPaths)
+		{
+			ProcessAsset(Path);
+			++ProcessedCount;
+			if (Request.ShouldStopAfterAsset(ProcessedCount, AssetPaths.Num()))
+			{
+				bCancelled = true;
+				break;
+			}
 		}
 
 		OutResult = FHCIAgentToolActionResult();
@@ -105,6 +124,10 @@ private:
 		}
 		
 		OutResult.Evidence.Add(TEXT("result"), OutResult.Reason);
+		if (bCancelled)
+		{
+			FHCIToolActionEvidenceBuilder::MarkCancelled(OutResult, ProcessedCount, AssetPaths.Num());
+		}
 		return OutResult.bSucceeded;
 	}
 };
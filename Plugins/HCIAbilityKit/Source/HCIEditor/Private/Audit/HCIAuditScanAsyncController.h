@@ -70,4 +70,5 @@ private:
 	FString LastFailureReason;
 };
 
-
+// Whether the HCI.AuditScanAsync run owned by HCIEditorModule.cpp is still ticking (benchmark commandlet polls this).
+bool HCI_IsAuditScanAsyncRunning();
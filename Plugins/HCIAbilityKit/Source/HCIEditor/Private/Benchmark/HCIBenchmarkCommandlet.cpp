@@ -0,0 +1,644 @@
+#include "Benchmark/HCIBenchmarkCommandlet.h"
+
+#include "Agent/Bridges/HCIAgentExecutorApplyConfirmBridge.h"
+#include "Agent/Bridges/HCIAgentExecutorApplyRequestBridge.h"
+#include "Agent/Bridges/HCIAgentExecutorExecuteTicketBridge.h"
+#include "Agent/Bridges/HCIAgentExecutorSimulateExecuteArchiveBundleBridge.h"
+#include "Agent/Bridges/HCIAgentExecutorSimulateExecuteFinalReportBridge.h"
+#include "Agent/Bridges/HCIAgentExecutorSimulateExecuteHandoffEnvelopeBridge.h"
+#include "Agent/Bridges/HCIAgentExecutorSimulateExecuteReceiptBridge.h"
+#include "Agent/Bridges/HCIAgentExecutorStageGExecuteIntentBridge.h"
+#include "Agent/Contracts/HCIAgentContractDigest.h"
+#include "Agent/Contracts/StageF/HCIAgentApplyConfirmRequest.h"
+#include "Agent/Contracts/StageF/HCIAgentApplyRequest.h"
+#include "Agent/Contracts/StageF/HCIAgentExecuteTicket.h"
+#include "Agent/Contracts/StageF/HCIAgentSimulateExecuteArchiveBundle.h"
+#include "Agent/Contracts/StageF/HCIAgentSimulateExecuteFinalReport.h"
+#include "Agent/Contracts/StageF/HCIAgentSimulateExecuteHandoffEnvelope.h"
+#include "Agent/Contracts/StageF/HCIAgentSimulateExecuteReceipt.h"
+#include "Agent/Contracts/StageG/HCIAgentStageGExecuteIntent.h"
+#include "Agent/Executor/HCIAgentExecutor.h"
+#include "Agent/Executor/HCIDryRunDiff.h"
+#include "Agent/Planner/HCIAgentPlan.h"
+#include "Agent/Planner/HCIAgentPlanValidator.h"
+#include "Agent/Tools/HCIToolRegistry.h"
+#include "AgentActions/HCIAgentToolActions.h"
+#include "Audit/HCIAuditScanAsyncController.h"
+#include "Audit/HCIAuditScanService.h"
+#include "Benchmark/HCIBenchmarkReport.h"
+#include "Commands/HCISyntheticFixtureGenerator.h"
+#include "Common/HCITimeFormat.h"
+#include "Containers/Ticker.h"
+#include "Dom/JsonObject.h"
+#include "HAL/IConsoleManager.h"
+#include "HCIAsset.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Search/HCISearchIndexService.h"
+#include "Search/HCISearchQueryService.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/UObjectGlobals.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogHCIBenchmark, Log, All);
+
+namespace
+{
+static const TCHAR* const HCIBenchmarkAllCases[] = {
+	TEXT("scan"),
+	TEXT("deep_scan"),
+	TEXT("search_rebuild"),
+	TEXT("search_query"),
+	TEXT("plan_validate"),
+	TEXT("executor_dry_run"),
+	TEXT("stageg_chain")};
+
+// Mixes the synthetic generator's theme keywords, aliases and damage hints so every query shape is hit.
+static const TCHAR* const HCIBenchmarkQueries[] = {
+	TEXT("fire"),
+	TEXT("frost nova"),
+	TEXT("forest vine trail"),
+	TEXT("Red Lotus"),
+	TEXT("ice blade low damage"),
+	TEXT("inferno burst high damage"),
+	TEXT("Moon Glass"),
+	TEXT("glacier shrine")};
+
+struct FHCIBenchmarkSettings
+{
+	FHCISyntheticFixtureOptions Fixture;
+	bool bSkipFixture = false;
+	int32 Iterations = 5;
+	int32 WarmupIterations = 1;
+	int32 PlanSteps = 200;
+	int32 ExecSteps = 20;
+	int32 ReviewRows = 2000;
+	int32 DeepScanBatchSize = 256;
+	double DeepScanTimeoutSeconds = 600.0;
+	TSet<FString> Cases;
+	FString OutputPath;
+	FString BaselinePath;
+	bool bUpdateBaseline = false;
+	FHCIBenchmarkThresholds Thresholds;
+};
+
+static FString HCI_GetBenchmarkDir()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("HCI/Benchmark"));
+}
+
+static bool HCI_ParseBenchmarkSettings(const FString& Params, FHCIBenchmarkSettings& OutSettings, FString& OutError)
+{
+	// Smaller default than the fixture command so a plain -run=HCIBenchmark stays a quick gate.
+	OutSettings.Fixture.Count = 1000;
+	FString CountText;
+	if (FParse::Value(*Params, TEXT("count="), CountText)
+		&& !FHCISyntheticFixtureGenerator::TryParseCountPreset(CountText, OutSettings.Fixture.Count))
+	{
+		OutError = FString::Printf(TEXT("count must be 1k|10k|100k or a positive integer (got %s)"), *CountText);
+		return false;
+	}
+	FParse::Value(*Params, TEXT("seed="), OutSettings.Fixture.Seed);
+	FParse::Value(*Params, TEXT("iterations="), OutSettings.Iterations);
+	FParse::Value(*Params, TEXT("warmup="), OutSettings.WarmupIterations);
+	FParse::Value(*Params, TEXT("plan_steps="), OutSettings.PlanSteps);
+	FParse::Value(*Params, TEXT("exec_steps="), OutSettings.ExecSteps);
+	FParse::Value(*Params, TEXT("review_rows="), OutSettings.ReviewRows);
+	FParse::Value(*Params, TEXT("deep_scan_batch="), OutSettings.DeepScanBatchSize);
+	FParse::Value(*Params, TEXT("max_p50_ratio="), OutSettings.Thresholds.MaxP50Ratio);
+	FParse::Value(*Params, TEXT("max_p95_ratio="), OutSettings.Thresholds.MaxP95Ratio);
+	FParse::Value(*Params, TEXT("min_throughput_ratio="), OutSettings.Thresholds.MinThroughputRatio);
+	FParse::Value(*Params, TEXT("noise_floor_ms="), OutSettings.Thresholds.NoiseFloorMs);
+	OutSettings.bSkipFixture = FParse::Param(*Params, TEXT("skip_fixture"));
+	OutSettings.bUpdateBaseline = FParse::Param(*Params, TEXT("update_baseline"));
+
+	if (OutSettings.Iterations < 1 || OutSettings.WarmupIterations < 0 || OutSettings.PlanSteps < 1
+		|| OutSettings.ExecSteps < 1 || OutSettings.ReviewRows < 1 || OutSettings.DeepScanBatchSize < 1)
+	{
+		OutError = TEXT("iterations/plan_steps/exec_steps/review_rows/deep_scan_batch must be >= 1 and warmup >= 0");
+		return false;
+	}
+
+	FString CasesText;
+	if (FParse::Value(*Params, TEXT("cases="), CasesText, false))
+	{
+		TArray<FString> Parts;
+		CasesText.ParseIntoArray(Parts, TEXT(","), true);
+		for (FString& Part : Parts)
+		{
+			Part.TrimStartAndEndInline();
+			bool bKnown = false;
+			for (const TCHAR* Name : HCIBenchmarkAllCases)
+			{
+				bKnown |= Part == Name;
+			}
+			if (!bKnown)
+			{
+				OutError = FString::Printf(TEXT("unknown case %s"), *Part);
+				return false;
+			}
+			OutSettings.Cases.Add(Part);
+		}
+	}
+	if (OutSettings.Cases.Num() == 0)
+	{
+		for (const TCHAR* Name : HCIBenchmarkAllCases)
+		{
+			OutSettings.Cases.Add(Name);
+		}
+	}
+
+	OutSettings.Fixture.TargetRoot = FHCISyntheticFixtureGenerator::MakeDefaultRoot(OutSettings.Fixture.Count, OutSettings.Fixture.Seed);
+	if (!FParse::Value(*Params, TEXT("out="), OutSettings.OutputPath))
+	{
+		OutSettings.OutputPath = FPaths::Combine(
+			HCI_GetBenchmarkDir(),
+			FString::Printf(TEXT("hci_benchmark_%s.json"), *FDateTime::UtcNow().ToString(TEXT("%Y%m%d_%H%M%S"))));
+	}
+	if (!FParse::Value(*Params, TEXT("baseline="), OutSettings.BaselinePath))
+	{
+		OutSettings.BaselinePath = FPaths::Combine(
+			HCI_GetBenchmarkDir(),
+			FString::Printf(TEXT("baseline_%d_s%d.json"), OutSettings.Fixture.Count, OutSettings.Fixture.Seed));
+	}
+	return true;
+}
+
+static int32 HCI_CountRegistryAssetsUnder(IAssetRegistry& AssetRegistry, const FString& RootPath)
+{
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UHCIAsset::StaticClass()->GetClassPathName());
+	Filter.bRecursiveClasses = true;
+	Filter.PackagePaths.Add(FName(*RootPath));
+	Filter.bRecursivePaths = true;
+	TArray<FAssetData> AssetDatas;
+	AssetRegistry.GetAssets(Filter, AssetDatas);
+	return AssetDatas.Num();
+}
+
+// Reuses fixtures left by a previous run with the same (count, seed); generates them otherwise.
+static bool HCI_EnsureBenchmarkFixture(FHCIBenchmarkSettings& Settings, FHCIBenchmarkReport& Report, FString& OutError)
+{
+	FHCISyntheticFixtureOptions& Options = Settings.Fixture;
+	const FString ManifestPath = FPaths::Combine(FPaths::ProjectDir(), TEXT("SourceData/AbilityKits/seed_mesh_manifest.json"));
+	FString ManifestError;
+	if (FPaths::FileExists(ManifestPath) && !FHCISyntheticFixtureGenerator::LoadSeedMeshManifest(ManifestPath, Options.RepresentingMeshPool, ManifestError))
+	{
+		UE_LOG(LogHCIBenchmark, Warning, TEXT("[HCI][Benchmark] seed_mesh_manifest_ignored reason=%s"), *ManifestError);
+	}
+
+	TArray<FHCISyntheticAssetRecord> Records;
+	if (!FHCISyntheticFixtureGenerator::BuildDataset(Options, Records, OutError))
+	{
+		return false;
+	}
+
+	Report.FixtureRoot = Options.TargetRoot;
+	Report.FixtureCount = Options.Count;
+	Report.FixtureSeed = Options.Seed;
+	Report.DatasetDigest = FString::Printf(TEXT("%08x"), FHCISyntheticFixtureGenerator::ComputeDatasetDigest(Records));
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	AssetRegistry.SearchAllAssets(true);
+	const int32 ExistingCount = HCI_CountRegistryAssetsUnder(AssetRegistry, Options.TargetRoot);
+	if (Settings.bSkipFixture || ExistingCount >= Options.Count)
+	{
+		UE_LOG(
+			LogHCIBenchmark,
+			Display,
+			TEXT("[HCI][Benchmark] fixture_reused root=%s existing=%d expected=%d"),
+			*Options.TargetRoot,
+			ExistingCount,
+			Options.Count);
+		return true;
+	}
+
+	FHCISyntheticFixtureStats Stats;
+	if (!FHCISyntheticFixtureGenerator::Generate(Options, Records, Stats, OutError))
+	{
+		return false;
+	}
+	UE_LOG(
+		LogHCIBenchmark,
+		Display,
+		TEXT("[HCI][Benchmark] fixture_generated root=%s created=%d saved=%d create_ms=%.1f save_ms=%.1f"),
+		*Options.TargetRoot,
+		Stats.CreatedCount,
+		Stats.SavedCount,
+		Stats.CreateMs,
+		Stats.SaveMs);
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	return true;
+}
+
+// Runs Body for warmup + measured iterations. Body returns false with OutFailure to abort the case.
+static FHCIBenchmarkCaseResult HCI_RunBenchmarkCase(
+	const FString& CaseName,
+	const FHCIBenchmarkSettings& Settings,
+	TFunctionRef<bool(int32& OutItems, FString& OutFailure)> Body)
+{
+	FHCIBenchmarkCaseResult Result;
+	Result.Name = CaseName;
+	Result.SamplesMs.Reserve(Settings.Iterations);
+	// UsedPhysical is only sampled between iterations, so the growth figure misses spikes inside Body;
+	// the process high-water mark below catches those.
+	const uint64 StartUsedPhysicalBytes = FPlatformMemory::GetStats().UsedPhysical;
+	uint64 MaxUsedPhysicalBytes = StartUsedPhysicalBytes;
+
+	const int32 TotalIterations = Settings.WarmupIterations + Settings.Iterations;
+	for (int32 Iteration = 0; Iteration < TotalIterations; ++Iteration)
+	{
+		int32 Items = 0;
+		FString Failure;
+		const double StartSeconds = FPlatformTime::Seconds();
+		const bool bOk = Body(Items, Failure);
+		const double DurationMs = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+		MaxUsedPhysicalBytes = FMath::Max<uint64>(MaxUsedPhysicalBytes, FPlatformMemory::GetStats().UsedPhysical);
+		if (!bOk)
+		{
+			Result.bSucceeded = false;
+			Result.FailureReason = Failure.IsEmpty() ? TEXT("unknown") : Failure;
+			break;
+		}
+		if (Iteration >= Settings.WarmupIterations)
+		{
+			Result.SamplesMs.Add(DurationMs);
+			Result.ItemsPerIteration = Items;
+		}
+	}
+
+	Result.Finalize();
+	Result.PeakUsedPhysicalMiB = static_cast<double>(FPlatformMemory::GetStats().PeakUsedPhysical) / (1024.0 * 1024.0);
+	Result.UsedPhysicalDeltaMiB = static_cast<double>(MaxUsedPhysicalBytes - StartUsedPhysicalBytes) / (1024.0 * 1024.0);
+	UE_LOG(
+		LogHCIBenchmark,
+		Display,
+		TEXT("[HCI][Benchmark] case=%s ok=%s iterations=%d items=%d p50_ms=%.3f p95_ms=%.3f max_ms=%.3f throughput_per_sec=%.1f peak_used_physical_mib=%.1f used_physical_delta_mib=%.1f%s%s"),
+		*Result.Name,
+		Result.bSucceeded ? TEXT("true") : TEXT("false"),
+		Result.Iterations,
+		Result.ItemsPerIteration,
+		Result.P50Ms,
+		Result.P95Ms,
+		Result.MaxMs,
+		Result.ThroughputPerSec,
+		Result.PeakUsedPhysicalMiB,
+		Result.UsedPhysicalDeltaMiB,
+		Result.bSucceeded ? TEXT("") : TEXT(" reason="),
+		*Result.FailureReason);
+	return Result;
+}
+
+static bool HCI_RunDeepScanToCompletion(const FHCIBenchmarkSettings& Settings, int32& OutItems, FString& OutFailure)
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	OutItems = HCI_CountRegistryAssetsUnder(AssetRegistry, TEXT("/Game"));
+
+	// Same path as the editor console: batch_size log_top_n=0 deep_mesh_check=1 gc_every_n_batches=0.
+	const FString Command = FString::Printf(TEXT("HCI.AuditScanAsync %d 0 1 0"), Settings.DeepScanBatchSize);
+	IConsoleManager::Get().ProcessUserConsoleInput(*Command, *GLog, nullptr);
+	if (!HCI_IsAuditScanAsyncRunning())
+	{
+		OutFailure = OutItems == 0 ? TEXT("no_hci_assets") : TEXT("deep_scan_not_started");
+		return false;
+	}
+
+	const double DeadlineSeconds = FPlatformTime::Seconds() + Settings.DeepScanTimeoutSeconds;
+	while (HCI_IsAuditScanAsyncRunning())
+	{
+		FTSTicker::GetCoreTicker().Tick(0.0f);
+		if (FPlatformTime::Seconds() > DeadlineSeconds)
+		{
+			IConsoleManager::Get().ProcessUserConsoleInput(TEXT("HCI.AuditScanAsyncStop"), *GLog, nullptr);
+			OutFailure = TEXT("deep_scan_timeout");
+			return false;
+		}
+	}
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	return true;
+}
+
+static FHCIAgentPlanStep& HCI_AddBenchmarkSearchStep(FHCIAgentPlan& Plan, const int32 StepIndex)
+{
+	FHCIAgentPlanStep& Step = Plan.Steps.AddDefaulted_GetRef();
+	Step.StepId = FString::Printf(TEXT("s%d_search"), StepIndex);
+	Step.ToolName = TEXT("SearchPath");
+	Step.RiskLevel = EHCIAgentPlanRiskLevel::ReadOnly;
+	Step.ExpectedEvidence = {TEXT("matched_directories"), TEXT("best_directory"), TEXT("result")};
+	Step.Args = MakeShared<FJsonObject>();
+	Step.Args->SetStringField(TEXT("keyword"), TEXT("Synthetic"));
+	return Step;
+}
+
+static FHCIAgentPlanStep& HCI_AddBenchmarkScanStep(FHCIAgentPlan& Plan, const int32 StepIndex, const FString& Directory)
+{
+	FHCIAgentPlanStep& Step = Plan.Steps.AddDefaulted_GetRef();
+	Step.StepId = FString::Printf(TEXT("s%d_scan"), StepIndex);
+	Step.ToolName = TEXT("ScanAssets");
+	Step.RiskLevel = EHCIAgentPlanRiskLevel::ReadOnly;
+	Step.ExpectedEvidence = {TEXT("asset_paths"), TEXT("asset_count"), TEXT("result")};
+	Step.Args = MakeShared<FJsonObject>();
+	Step.Args->SetStringField(TEXT("directory"), Directory);
+	return Step;
+}
+
+// Alternating read-only SearchPath / ScanAssets steps over the fixture root.
+static FHCIAgentPlan HCI_MakeBenchmarkPlan(const FString& RequestId, const int32 StepCount, const FString& FixtureRoot)
+{
+	FHCIAgentPlan Plan;
+	Plan.PlanVersion = 1;
+	Plan.RequestId = RequestId;
+	Plan.Intent = TEXT("scan_assets");
+	Plan.Steps.Reserve(StepCount);
+	for (int32 StepIndex = 0; StepIndex < StepCount; ++StepIndex)
+	{
+		if ((StepIndex % 2) == 0)
+		{
+			HCI_AddBenchmarkSearchStep(Plan, StepIndex);
+		}
+		else
+		{
+			HCI_AddBenchmarkScanStep(Plan, StepIndex, FixtureRoot);
+		}
+	}
+	return Plan;
+}
+
+static FHCIDryRunDiffReport HCI_MakeBenchmarkReviewReport(const int32 RowCount, const FString& FixtureRoot)
+{
+	FHCIDryRunDiffReport Report;
+	Report.RequestId = TEXT("req_benchmark_stageg");
+	Report.DiffItems.Reserve(RowCount);
+	for (int32 Index = 0; Index < RowCount; ++Index)
+	{
+		FHCIDryRunDiffItem& Item = Report.DiffItems.AddDefaulted_GetRef();
+		Item.AssetPath = FString::Printf(TEXT("%s/HCI_Bench_%d.HCI_Bench_%d"), *FixtureRoot, Index, Index);
+		Item.Field = FString::Printf(TEXT("step:s%d"), Index % 8);
+		Item.ToolName = TEXT("SetTextureMaxSize");
+		Item.Risk = EHCIDryRunRisk::Write;
+		Item.ObjectType = EHCIDryRunObjectType::Asset;
+		Item.LocateStrategy = EHCIDryRunLocateStrategy::SyncBrowser;
+		Item.EvidenceKey = TEXT("asset_path");
+	}
+	FHCIDryRunDiff::NormalizeAndFinalize(Report);
+	return Report;
+}
+
+// Review -> F-stage contracts -> Stage G execute intent; every hop re-verifies the selection digest.
+static bool HCI_RunStageGChain(const FHCIDryRunDiffReport& Review, FString& OutFailure)
+{
+	FHCIAgentSelectionDigestScope DigestScope;
+	FHCIAgentApplyRequest ApplyRequest;
+	FHCIAgentApplyConfirmRequest ConfirmRequest;
+	FHCIAgentExecuteTicket ExecuteTicket;
+	FHCIAgentSimulateExecuteReceipt Receipt;
+	FHCIAgentSimulateExecuteFinalReport FinalReport;
+	FHCIAgentSimulateExecuteArchiveBundle ArchiveBundle;
+	FHCIAgentSimulateExecuteHandoffEnvelope HandoffEnvelope;
+	FHCIAgentStageGExecuteIntent Intent;
+	const bool bBuilt =
+		FHCIAgentExecutorApplyRequestBridge::BuildApplyRequest(Review, ApplyRequest)
+		&& FHCIAgentExecutorApplyConfirmBridge::BuildConfirmRequest(ApplyRequest, Review, true, ConfirmRequest)
+		&& FHCIAgentExecutorExecuteTicketBridge::BuildExecuteTicket(ConfirmRequest, ApplyRequest, Review, ExecuteTicket)
+		&& FHCIAgentExecutorSimulateExecuteReceiptBridge::BuildSimulateExecuteReceipt(ExecuteTicket, ConfirmRequest, ApplyRequest, Review, Receipt)
+		&& FHCIAgentExecutorSimulateExecuteFinalReportBridge::BuildSimulateExecuteFinalReport(Receipt, ExecuteTicket, ConfirmRequest, ApplyRequest, Review, FinalReport)
+		&& FHCIAgentExecutorSimulateExecuteArchiveBundleBridge::BuildSimulateExecuteArchiveBundle(FinalReport, Receipt, ExecuteTicket, ConfirmRequest, ApplyRequest, Review, ArchiveBundle)
+		&& FHCIAgentExecutorSimulateExecuteHandoffEnvelopeBridge::BuildSimulateExecuteHandoffEnvelope(ArchiveBundle, FinalReport, Receipt, ExecuteTicket, ConfirmRequest, ApplyRequest, Review, HandoffEnvelope)
+		&& FHCIAgentExecutorStageGExecuteIntentBridge::BuildStageGExecuteIntent(HandoffEnvelope, ArchiveBundle, FinalReport, Receipt, ExecuteTicket, ConfirmRequest, ApplyRequest, Review, Intent);
+	if (!bBuilt)
+	{
+		OutFailure = TEXT("stageg_chain_bridge_failed");
+		return false;
+	}
+	if (!Intent.bReadyForStageGEntry)
+	{
+		OutFailure = FString::Printf(TEXT("stageg_not_ready error_code=%s reason=%s"), *Intent.ErrorCode, *Intent.Reason);
+		return false;
+	}
+	return true;
+}
+
+static void HCI_RunBenchmarkCases(const FHCIBenchmarkSettings& Settings, FHCIBenchmarkReport& Report)
+{
+	const FString& FixtureRoot = Settings.Fixture.TargetRoot;
+	FHCIToolRegistry& ToolRegistry = FHCIToolRegistry::Get();
+	ToolRegistry.ResetToDefaults();
+
+	if (Settings.Cases.Contains(TEXT("scan")))
+	{
+		Report.Cases.Add(HCI_RunBenchmarkCase(TEXT("scan"), Settings, [](int32& OutItems, FString& OutFailure)
+		{
+			const FHCIAuditScanSnapshot Snapshot = FHCIAuditScanService::Get().ScanFromAssetRegistry();
+			OutItems = Snapshot.Stats.AssetCount;
+			OutFailure = TEXT("no_hci_assets");
+			return OutItems > 0;
+		}));
+	}
+
+	if (Settings.Cases.Contains(TEXT("deep_scan")))
+	{
+		Report.Cases.Add(HCI_RunBenchmarkCase(TEXT("deep_scan"), Settings, [&Settings](int32& OutItems, FString& OutFailure)
+		{
+			return HCI_RunDeepScanToCompletion(Settings, OutItems, OutFailure);
+		}));
+	}
+
+	if (Settings.Cases.Contains(TEXT("search_rebuild")))
+	{
+		Report.Cases.Add(HCI_RunBenchmarkCase(TEXT("search_rebuild"), Settings, [](int32& OutItems, FString& OutFailure)
+		{
+			FHCISearchIndexService& SearchIndex = FHCISearchIndexService::Get();
+			SearchIndex.RebuildFromAssetRegistry();
+			OutItems = SearchIndex.GetStats().IndexedDocumentCount;
+			OutFailure = TEXT("search_index_empty");
+			return OutItems > 0;
+		}));
+	}
+
+	if (Settings.Cases.Contains(TEXT("search_query")))
+	{
+		FHCISearchIndexService& SearchIndex = FHCISearchIndexService::Get();
+		if (SearchIndex.GetStats().IndexedDocumentCount == 0)
+		{
+			SearchIndex.RebuildFromAssetRegistry();
+		}
+		Report.Cases.Add(HCI_RunBenchmarkCase(TEXT("search_query"), Settings, [&SearchIndex](int32& OutItems, FString& OutFailure)
+		{
+			int32 HitQueries = 0;
+			for (const TCHAR* Query : HCIBenchmarkQueries)
+			{
+				const FHCIAbilitySearchResult Result = FHCISearchQueryService::RunQuery(Query, 5, SearchIndex.GetIndex());
+				HitQueries += Result.HasResults() ? 1 : 0;
+			}
+			OutItems = UE_ARRAY_COUNT(HCIBenchmarkQueries);
+			OutFailure = TEXT("no_query_hits");
+			return HitQueries > 0;
+		}));
+	}
+
+	if (Settings.Cases.Contains(TEXT("plan_validate")))
+	{
+		const FHCIAgentPlan Plan = HCI_MakeBenchmarkPlan(TEXT("req_benchmark_validate"), Settings.PlanSteps, FixtureRoot);
+		Report.Cases.Add(HCI_RunBenchmarkCase(TEXT("plan_validate"), Settings, [&Plan, &ToolRegistry](int32& OutItems, FString& OutFailure)
+		{
+			FHCIAgentPlanValidationResult Result;
+			const bool bValid = FHCIAgentPlanValidator::ValidatePlan(Plan, ToolRegistry, Result);
+			OutItems = Result.ValidatedStepCount;
+			OutFailure = FString::Printf(TEXT("%s:%s"), *Result.ErrorCode, *Result.Reason);
+			return bValid;
+		}));
+	}
+
+	if (Settings.Cases.Contains(TEXT("executor_dry_run")))
+	{
+		const FHCIAgentPlan Plan = HCI_MakeBenchmarkPlan(TEXT("req_benchmark_execute"), Settings.ExecSteps, FixtureRoot);
+		FHCIAgentExecutorOptions Options;
+		Options.bDryRun = true;
+		HCIAgentToolActions::BuildStageIDraftActions(Options.ToolActions);
+		Report.Cases.Add(HCI_RunBenchmarkCase(TEXT("executor_dry_run"), Settings, [&Plan, &Options, &ToolRegistry](int32& OutItems, FString& OutFailure)
+		{
+			FHCIAgentExecutorRunResult Result;
+			const bool bAccepted = FHCIAgentExecutor::ExecutePlan(Plan, ToolRegistry, FHCIAgentPlanValidationContext(), Options, Result);
+			OutItems = Result.SucceededSteps;
+			OutFailure = FString::Printf(TEXT("%s:%s"), *Result.ErrorCode, *Result.Reason);
+			return bAccepted && Result.bCompleted && Result.FailedSteps == 0;
+		}));
+	}
+
+	if (Settings.Cases.Contains(TEXT("stageg_chain")))
+	{
+		const FHCIDryRunDiffReport Review = HCI_MakeBenchmarkReviewReport(Settings.ReviewRows, FixtureRoot);
+		Report.Cases.Add(HCI_RunBenchmarkCase(TEXT("stageg_chain"), Settings, [&Review](int32& OutItems, FString& OutFailure)
+		{
+			OutItems = Review.DiffItems.Num();
+			return HCI_RunStageGChain(Review, OutFailure);
+		}));
+	}
+}
+
+static int32 HCI_CompareWithBaseline(const FHCIBenchmarkSettings& Settings, const FHCIBenchmarkReport& Report)
+{
+	int32 FailedCases = 0;
+	for (const FHCIBenchmarkCaseResult& Case : Report.Cases)
+	{
+		FailedCases += Case.bSucceeded ? 0 : 1;
+	}
+
+	if (!FPaths::FileExists(Settings.BaselinePath))
+	{
+		UE_LOG(
+			LogHCIBenchmark,
+			Display,
+			TEXT("[HCI][Benchmark] baseline_missing path=%s hint=rerun with -update_baseline to record one"),
+			*Settings.BaselinePath);
+		return FailedCases;
+	}
+
+	FHCIBenchmarkReport Baseline;
+	FString LoadError;
+	if (!FHCIBenchmarkReport::LoadFromFile(Settings.BaselinePath, Baseline, LoadError))
+	{
+		UE_LOG(LogHCIBenchmark, Error, TEXT("[HCI][Benchmark] baseline_invalid path=%s reason=%s"), *Settings.BaselinePath, *LoadError);
+		return FailedCases + 1;
+	}
+	if (Baseline.DatasetDigest != Report.DatasetDigest)
+	{
+		UE_LOG(
+			LogHCIBenchmark,
+			Warning,
+			TEXT("[HCI][Benchmark] baseline_skipped reason=dataset_digest_mismatch baseline=%s current=%s"),
+			*Baseline.DatasetDigest,
+			*Report.DatasetDigest);
+		return FailedCases;
+	}
+
+	TArray<FHCIBenchmarkRegression> Regressions;
+	FHCIBenchmarkReport::CompareToBaseline(Baseline, Report, Settings.Thresholds, Regressions);
+	for (const FHCIBenchmarkRegression& Regression : Regressions)
+	{
+		// -update_baseline records a slower run on purpose; failed cases still fail the run.
+		if (Settings.bUpdateBaseline && !Regression.Metric.StartsWith(TEXT("failed:")))
+		{
+			UE_LOG(LogHCIBenchmark, Warning, TEXT("[HCI][Benchmark] baseline_accepted_regression %s"), *Regression.ToString());
+		}
+		else
+		{
+			UE_LOG(LogHCIBenchmark, Error, TEXT("[HCI][Benchmark] regression %s"), *Regression.ToString());
+		}
+	}
+	UE_LOG(
+		LogHCIBenchmark,
+		Display,
+		TEXT("[HCI][Benchmark] baseline_compared path=%s regressions=%d"),
+		*Settings.BaselinePath,
+		Regressions.Num());
+	return Regressions.Num();
+}
+} // namespace
+
+UHCIBenchmarkCommandlet::UHCIBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UHCIBenchmarkCommandlet::Main(const FString& Params)
+{
+	FHCIBenchmarkSettings Settings;
+	FString Error;
+	if (!HCI_ParseBenchmarkSettings(Params, Settings, Error))
+	{
+		UE_LOG(LogHCIBenchmark, Error, TEXT("[HCI][Benchmark] invalid_args reason=%s"), *Error);
+		return 1;
+	}
+
+	FHCIBenchmarkReport Report;
+	Report.RunId = FString::Printf(TEXT("bench_%s"), *FDateTime::UtcNow().ToString(TEXT("%Y%m%d_%H%M%S")));
+	Report.GeneratedAt = FHCITimeFormat::FormatNowBeijingIso8601();
+	if (!HCI_EnsureBenchmarkFixture(Settings, Report, Error))
+	{
+		UE_LOG(LogHCIBenchmark, Error, TEXT("[HCI][Benchmark] fixture_failed reason=%s"), *Error);
+		return 1;
+	}
+
+	HCI_RunBenchmarkCases(Settings, Report);
+
+	if (!Report.SaveToFile(Settings.OutputPath, Error))
+	{
+		UE_LOG(LogHCIBenchmark, Error, TEXT("[HCI][Benchmark] report_write_failed reason=%s"), *Error);
+		return 1;
+	}
+	UE_LOG(LogHCIBenchmark, Display, TEXT("[HCI][Benchmark] report_written path=%s cases=%d"), *Settings.OutputPath, Report.Cases.Num());
+
+	const int32 ProblemCount = HCI_CompareWithBaseline(Settings, Report);
+	if (Settings.bUpdateBaseline)
+	{
+		int32 FailedCases = 0;
+		for (const FHCIBenchmarkCaseResult& Case : Report.Cases)
+		{
+			FailedCases += Case.bSucceeded ? 0 : 1;
+		}
+		// A failed case has no usable figures, so it never becomes the baseline; regressions do.
+		if (FailedCases > 0)
+		{
+			UE_LOG(LogHCIBenchmark, Warning, TEXT("[HCI][Benchmark] baseline_not_updated reason=failed_cases count=%d"), FailedCases);
+			return 1;
+		}
+		if (!Report.SaveToFile(Settings.BaselinePath, Error))
+		{
+			UE_LOG(LogHCIBenchmark, Error, TEXT("[HCI][Benchmark] baseline_write_failed reason=%s"), *Error);
+			return 1;
+		}
+		UE_LOG(
+			LogHCIBenchmark,
+			Display,
+			TEXT("[HCI][Benchmark] baseline_updated path=%s accepted_problems=%d"),
+			*Settings.BaselinePath,
+			ProblemCount);
+		return 0;
+	}
+	return ProblemCount > 0 ? 1 : 0;
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "HCIBenchmarkCommandlet.generated.h"
+
+/**
+ * Headless perf gate for the scan / search / plan / execute hot paths.
+ *
+ * UnrealEditor-Cmd <Project>.uproject -run=HCIBenchmark -nullrhi [-count=1k] [-seed=42] [-iterations=5] [-warmup=1]
+ *     [-cases=scan,deep_scan,search_rebuild,search_query,plan_validate,executor_dry_run,stageg_chain]
+ *     [-plan_steps=200] [-exec_steps=20] [-review_rows=2000]
+ *     [-out=<json>] [-baseline=<json>] [-update_baseline] [-max_p50_ratio=1.25] [-max_p95_ratio=1.5] [-min_throughput_ratio=0.75]
+ *
+ * Returns non-zero when a case fails or regresses against the baseline. -update_baseline overwrites the
+ * baseline even when cases regressed (each accepted regression is logged); only failed cases block it.
+ */
+UCLASS()
+class UHCIBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UHCIBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
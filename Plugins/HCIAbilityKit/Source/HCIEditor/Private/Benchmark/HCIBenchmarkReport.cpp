@@ -0,0 +1,255 @@
+#include "Benchmark/HCIBenchmarkReport.h"
+
+#include "Audit/HCIAuditPerfMetrics.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+static const TCHAR* HCIBenchmarkSchema = TEXT("hci.benchmark.v1");
+
+static void HCI_AddLatencyRegressionIfNeeded(
+	const FString& CaseName,
+	const TCHAR* Metric,
+	const double BaselineMs,
+	const double CurrentMs,
+	const double MaxRatio,
+	const double NoiseFloorMs,
+	TArray<FHCIBenchmarkRegression>& OutRegressions)
+{
+	if (BaselineMs <= 0.0)
+	{
+		return;
+	}
+
+	const double LimitMs = BaselineMs * MaxRatio;
+	if (CurrentMs > LimitMs && (CurrentMs - BaselineMs) > NoiseFloorMs)
+	{
+		FHCIBenchmarkRegression& Regression = OutRegressions.AddDefaulted_GetRef();
+		Regression.CaseName = CaseName;
+		Regression.Metric = Metric;
+		Regression.BaselineValue = BaselineMs;
+		Regression.CurrentValue = CurrentMs;
+		Regression.Limit = LimitMs;
+	}
+}
+} // namespace
+
+void FHCIBenchmarkCaseResult::Finalize()
+{
+	Iterations = SamplesMs.Num();
+	P50Ms = FHCIAuditPerfMetrics::PercentileNearestRank(SamplesMs, 50.0);
+	P95Ms = FHCIAuditPerfMetrics::PercentileNearestRank(SamplesMs, 95.0);
+	MaxMs = 0.0;
+	double TotalMs = 0.0;
+	for (const double Sample : SamplesMs)
+	{
+		MaxMs = FMath::Max(MaxMs, Sample);
+		TotalMs += Sample;
+	}
+	MeanMs = Iterations > 0 ? TotalMs / Iterations : 0.0;
+	ThroughputPerSec = FHCIAuditPerfMetrics::AssetsPerSecond(ItemsPerIteration, P50Ms);
+}
+
+FString FHCIBenchmarkRegression::ToString() const
+{
+	return FString::Printf(
+		TEXT("case=%s metric=%s baseline=%.3f current=%.3f limit=%.3f"),
+		*CaseName,
+		*Metric,
+		BaselineValue,
+		CurrentValue,
+		Limit);
+}
+
+const FHCIBenchmarkCaseResult* FHCIBenchmarkReport::FindCase(const FString& CaseName) const
+{
+	return Cases.FindByPredicate([&CaseName](const FHCIBenchmarkCaseResult& Case)
+	{
+		return Case.Name == CaseName;
+	});
+}
+
+TSharedRef<FJsonObject> FHCIBenchmarkReport::ToJson() const
+{
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetStringField(TEXT("schema"), HCIBenchmarkSchema);
+	Root->SetStringField(TEXT("run_id"), RunId);
+	Root->SetStringField(TEXT("generated_at"), GeneratedAt);
+
+	TSharedRef<FJsonObject> Fixture = MakeShared<FJsonObject>();
+	Fixture->SetStringField(TEXT("root"), FixtureRoot);
+	Fixture->SetNumberField(TEXT("count"), FixtureCount);
+	Fixture->SetNumberField(TEXT("seed"), FixtureSeed);
+	Fixture->SetStringField(TEXT("dataset_digest"), DatasetDigest);
+	Root->SetObjectField(TEXT("fixture"), Fixture);
+
+	TArray<TSharedPtr<FJsonValue>> CaseValues;
+	CaseValues.Reserve(Cases.Num());
+	for (const FHCIBenchmarkCaseResult& Case : Cases)
+	{
+		TSharedRef<FJsonObject> CaseObject = MakeShared<FJsonObject>();
+		CaseObject->SetStringField(TEXT("name"), Case.Name);
+		CaseObject->SetBoolField(TEXT("succeeded"), Case.bSucceeded);
+		if (!Case.FailureReason.IsEmpty())
+		{
+			CaseObject->SetStringField(TEXT("failure_reason"), Case.FailureReason);
+		}
+		CaseObject->SetNumberField(TEXT("iterations"), Case.Iterations);
+		CaseObject->SetNumberField(TEXT("items_per_iteration"), Case.ItemsPerIteration);
+		CaseObject->SetNumberField(TEXT("p50_ms"), Case.P50Ms);
+		CaseObject->SetNumberField(TEXT("p95_ms"), Case.P95Ms);
+		CaseObject->SetNumberField(TEXT("max_ms"), Case.MaxMs);
+		CaseObject->SetNumberField(TEXT("mean_ms"), Case.MeanMs);
+		CaseObject->SetNumberField(TEXT("throughput_per_sec"), Case.ThroughputPerSec);
+		CaseObject->SetNumberField(TEXT("peak_used_physical_mib"), Case.PeakUsedPhysicalMiB);
+		CaseObject->SetNumberField(TEXT("used_physical_delta_mib"), Case.UsedPhysicalDeltaMiB);
+		CaseValues.Emplace(MakeShared<FJsonValueObject>(CaseObject));
+	}
+	Root->SetArrayField(TEXT("cases"), CaseValues);
+	return Root;
+}
+
+bool FHCIBenchmarkReport::FromJson(const FJsonObject& Root, FHCIBenchmarkReport& OutReport, FString& OutError)
+{
+	OutReport = FHCIBenchmarkReport();
+	FString Schema;
+	if (!Root.TryGetStringField(TEXT("schema"), Schema) || Schema != HCIBenchmarkSchema)
+	{
+		OutError = FString::Printf(TEXT("unsupported_schema schema=%s"), *Schema);
+		return false;
+	}
+
+	Root.TryGetStringField(TEXT("run_id"), OutReport.RunId);
+	Root.TryGetStringField(TEXT("generated_at"), OutReport.GeneratedAt);
+	const TSharedPtr<FJsonObject>* Fixture = nullptr;
+	if (Root.TryGetObjectField(TEXT("fixture"), Fixture) && Fixture != nullptr && Fixture->IsValid())
+	{
+		(*Fixture)->TryGetStringField(TEXT("root"), OutReport.FixtureRoot);
+		(*Fixture)->TryGetNumberField(TEXT("count"), OutReport.FixtureCount);
+		(*Fixture)->TryGetNumberField(TEXT("seed"), OutReport.FixtureSeed);
+		(*Fixture)->TryGetStringField(TEXT("dataset_digest"), OutReport.DatasetDigest);
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* CaseValues = nullptr;
+	if (!Root.TryGetArrayField(TEXT("cases"), CaseValues) || CaseValues == nullptr)
+	{
+		OutError = TEXT("cases_missing");
+		return false;
+	}
+
+	OutReport.Cases.Reserve(CaseValues->Num());
+	for (const TSharedPtr<FJsonValue>& Value : *CaseValues)
+	{
+		const TSharedPtr<FJsonObject>* CaseObject = nullptr;
+		if (!Value.IsValid() || !Value->TryGetObject(CaseObject) || CaseObject == nullptr || !CaseObject->IsValid())
+		{
+			OutError = TEXT("case_not_object");
+			return false;
+		}
+
+		FHCIBenchmarkCaseResult& Case = OutReport.Cases.AddDefaulted_GetRef();
+		if (!(*CaseObject)->TryGetStringField(TEXT("name"), Case.Name) || Case.Name.IsEmpty())
+		{
+			OutError = TEXT("case_name_missing");
+			return false;
+		}
+		(*CaseObject)->TryGetBoolField(TEXT("succeeded"), Case.bSucceeded);
+		(*CaseObject)->TryGetStringField(TEXT("failure_reason"), Case.FailureReason);
+		(*CaseObject)->TryGetNumberField(TEXT("iterations"), Case.Iterations);
+		(*CaseObject)->TryGetNumberField(TEXT("items_per_iteration"), Case.ItemsPerIteration);
+		(*CaseObject)->TryGetNumberField(TEXT("p50_ms"), Case.P50Ms);
+		(*CaseObject)->TryGetNumberField(TEXT("p95_ms"), Case.P95Ms);
+		(*CaseObject)->TryGetNumberField(TEXT("max_ms"), Case.MaxMs);
+		(*CaseObject)->TryGetNumberField(TEXT("mean_ms"), Case.MeanMs);
+		(*CaseObject)->TryGetNumberField(TEXT("throughput_per_sec"), Case.ThroughputPerSec);
+		(*CaseObject)->TryGetNumberField(TEXT("peak_used_physical_mib"), Case.PeakUsedPhysicalMiB);
+		(*CaseObject)->TryGetNumberField(TEXT("used_physical_delta_mib"), Case.UsedPhysicalDeltaMiB);
+	}
+	return true;
+}
+
+bool FHCIBenchmarkReport::SaveToFile(const FString& FilePath, FString& OutError) const
+{
+	FString JsonText;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonText);
+	if (!FJsonSerializer::Serialize(ToJson(), Writer))
+	{
+		OutError = TEXT("serialize_failed");
+		return false;
+	}
+
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(FilePath), true);
+	if (!FFileHelper::SaveStringToFile(JsonText, *FilePath))
+	{
+		OutError = FString::Printf(TEXT("write_failed path=%s"), *FilePath);
+		return false;
+	}
+	return true;
+}
+
+bool FHCIBenchmarkReport::LoadFromFile(const FString& FilePath, FHCIBenchmarkReport& OutReport, FString& OutError)
+{
+	FString JsonText;
+	if (!FFileHelper::LoadFileToString(JsonText, *FilePath))
+	{
+		OutError = FString::Printf(TEXT("read_failed path=%s"), *FilePath);
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> Root;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonText);
+	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid())
+	{
+		OutError = FString::Printf(TEXT("invalid_json path=%s"), *FilePath);
+		return false;
+	}
+	return FromJson(*Root, OutReport, OutError);
+}
+
+void FHCIBenchmarkReport::CompareToBaseline(
+	const FHCIBenchmarkReport& Baseline,
+	const FHCIBenchmarkReport& Current,
+	const FHCIBenchmarkThresholds& Thresholds,
+	TArray<FHCIBenchmarkRegression>& OutRegressions)
+{
+	OutRegressions.Reset();
+	for (const FHCIBenchmarkCaseResult& Case : Current.Cases)
+	{
+		if (!Case.bSucceeded)
+		{
+			FHCIBenchmarkRegression& Regression = OutRegressions.AddDefaulted_GetRef();
+			Regression.CaseName = Case.Name;
+			Regression.Metric = FString::Printf(TEXT("failed:%s"), *Case.FailureReason);
+			continue;
+		}
+
+		const FHCIBenchmarkCaseResult* BaselineCase = Baseline.FindCase(Case.Name);
+		if (BaselineCase == nullptr || !BaselineCase->bSucceeded)
+		{
+			continue;
+		}
+
+		HCI_AddLatencyRegressionIfNeeded(Case.Name, TEXT("p50_ms"), BaselineCase->P50Ms, Case.P50Ms, Thresholds.MaxP50Ratio, Thresholds.NoiseFloorMs, OutRegressions);
+		HCI_AddLatencyRegressionIfNeeded(Case.Name, TEXT("p95_ms"), BaselineCase->P95Ms, Case.P95Ms, Thresholds.MaxP95Ratio, Thresholds.NoiseFloorMs, OutRegressions);
+
+		// Throughput is derived from p50, so only flag it when the latency delta is above the noise floor too.
+		const double MinThroughput = BaselineCase->ThroughputPerSec * Thresholds.MinThroughputRatio;
+		if (BaselineCase->ThroughputPerSec > 0.0
+			&& Case.ThroughputPerSec < MinThroughput
+			&& (Case.P50Ms - BaselineCase->P50Ms) > Thresholds.NoiseFloorMs)
+		{
+			FHCIBenchmarkRegression& Regression = OutRegressions.AddDefaulted_GetRef();
+			Regression.CaseName = Case.Name;
+			Regression.Metric = TEXT("throughput_per_sec");
+			Regression.BaselineValue = BaselineCase->ThroughputPerSec;
+			Regression.CurrentValue = Case.ThroughputPerSec;
+			Regression.Limit = MinThroughput;
+		}
+	}
+}
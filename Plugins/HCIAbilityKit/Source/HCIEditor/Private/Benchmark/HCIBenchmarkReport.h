@@ -0,0 +1,75 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FJsonObject;
+
+struct HCIEDITOR_API FHCIBenchmarkCaseResult
+{
+	FString Name;
+	bool bSucceeded = true;
+	FString FailureReason;
+	int32 ItemsPerIteration = 0;
+	TArray<double> SamplesMs;
+
+	// Filled by Finalize() (or read back from a stored report).
+	int32 Iterations = 0;
+	double P50Ms = 0.0;
+	double P95Ms = 0.0;
+	double MaxMs = 0.0;
+	double MeanMs = 0.0;
+	double ThroughputPerSec = 0.0;
+	// Process high-water mark when the case finished.
+	double PeakUsedPhysicalMiB = 0.0;
+	// Largest UsedPhysical growth over the case's starting footprint.
+	double UsedPhysicalDeltaMiB = 0.0;
+
+	void Finalize();
+};
+
+struct HCIEDITOR_API FHCIBenchmarkThresholds
+{
+	double MaxP50Ratio = 1.25;
+	double MaxP95Ratio = 1.5;
+	double MinThroughputRatio = 0.75;
+	// Latency deltas below this are treated as timer noise, whatever the ratio.
+	double NoiseFloorMs = 1.0;
+};
+
+struct HCIEDITOR_API FHCIBenchmarkRegression
+{
+	FString CaseName;
+	FString Metric;
+	double BaselineValue = 0.0;
+	double CurrentValue = 0.0;
+	double Limit = 0.0;
+
+	FString ToString() const;
+};
+
+// One HCIBenchmark run: fixture identity plus per-case latency/throughput/memory figures.
+struct HCIEDITOR_API FHCIBenchmarkReport
+{
+	FString RunId;
+	FString GeneratedAt;
+	FString FixtureRoot;
+	int32 FixtureCount = 0;
+	int32 FixtureSeed = 0;
+	FString DatasetDigest;
+	TArray<FHCIBenchmarkCaseResult> Cases;
+
+	const FHCIBenchmarkCaseResult* FindCase(const FString& CaseName) const;
+
+	TSharedRef<FJsonObject> ToJson() const;
+	static bool FromJson(const FJsonObject& Root, FHCIBenchmarkReport& OutReport, FString& OutError);
+
+	bool SaveToFile(const FString& FilePath, FString& OutError) const;
+	static bool LoadFromFile(const FString& FilePath, FHCIBenchmarkReport& OutReport, FString& OutError);
+
+	// Cases present in both reports are compared; failed current cases always count as regressions.
+	static void CompareToBaseline(
+		const FHCIBenchmarkReport& Baseline,
+		const FHCIBenchmarkReport& Current,
+		const FHCIBenchmarkThresholds& Thresholds,
+		TArray<FHCIBenchmarkRegression>& OutRegressions);
+};
@@ -23,6 +23,7 @@ void HCI_RunAbilityKitAgentPlanDemoCommand(const TArray<FString>& Args);
 void HCI_RunAbilityKitAgentPlanDemoJsonCommand(const TArray<FString>& Args);
 void HCI_RunAbilityKitAgentPlanPreviewUiCommand(const TArray<FString>& Args);
 void HCI_RunAbilityKitAgentChatUiCommand(const TArray<FString>& Args);
+void HCI_RunAbilityKitTraceLatencyHistogramCommand(const TArray<FString>& Args);
 void HCI_RunAbilityKitIngestDumpLatestCommand(const TArray<FString>& Args);
 void HCI_RunAbilityKitIngestImportLatestCommand(const TArray<FString>& Args);
 bool HCI_IsAgentPlanPreviewRequestInFlight();
@@ -1,6 +1,7 @@
 #include "Commands/HCIAgentCommandHandlers.h"
 
 #include "Commands/HCIAgentDemoState.h"
+#include "Commands/HCIPlannerEnvContextProvider.h"
 #include "UI/HCIAgentPlanPreviewWindow.h"
 
 #include "Agent/LLM/HCIAgentLlmClient.h"
@@ -14,6 +15,8 @@
 #include "EditorAssetLibrary.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Interfaces/IHttpResponse.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
 #include "Modules/ModuleManager.h"
 #include "Policies/CondensedJsonPrintPolicy.h"
 #include "Serialization/JsonSerializer.h"
@@ -91,76 +94,6 @@ static bool HCI_Llm_TryParseLlmMockModeArg(const FString& InMode, EHCIAgentPlann
 	return false;
 }
 
-static int64 HCI_Llm_TryExtractAssetSizeFromTags(const FAssetData& AssetData)
-{
-	int64 SizeBytes = -1;
-	if (AssetData.GetTagValue(FName(TEXT("DiskSize")), SizeBytes))
-	{
-		return SizeBytes;
-	}
-	if (AssetData.GetTagValue(FName(TEXT("FileSize")), SizeBytes))
-	{
-		return SizeBytes;
-	}
-
-	FString SizeText;
-	if (AssetData.GetTagValue(FName(TEXT("DiskSize")), SizeText) && LexTryParseString(SizeBytes, *SizeText))
-	{
-		return SizeBytes;
-	}
-	if (AssetData.GetTagValue(FName(TEXT("FileSize")), SizeText) && LexTryParseString(SizeBytes, *SizeText))
-	{
-		return SizeBytes;
-	}
-	return -1;
-}
-
-static bool HCI_Llm_ScanAssetsForPlannerEnvContext(
-	const FString& ScanRoot,
-	TArray<FHCIAgentPlannerEnvAssetEntry>& OutAssets,
-	FString& OutError)
-{
-	OutAssets.Reset();
-	OutError.Reset();
-
-	FString SafeRoot = ScanRoot.TrimStartAndEnd();
-	if (SafeRoot.IsEmpty() || !SafeRoot.StartsWith(TEXT("/Game/")))
-	{
-		SafeRoot = TEXT("/Game/Temp");
-	}
-
-	const TArray<FString> AssetPaths = UEditorAssetLibrary::ListAssets(SafeRoot, true, false);
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
-	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-
-	OutAssets.Reserve(AssetPaths.Num());
-	for (const FString& ObjectPath : AssetPaths)
-	{
-		FHCIAgentPlannerEnvAssetEntry Entry;
-		Entry.ObjectPath = ObjectPath;
-
-		FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(ObjectPath));
-		if (AssetData.IsValid())
-		{
-			Entry.AssetClass = AssetData.AssetClassPath.GetAssetName().ToString();
-			Entry.SizeBytes = HCI_Llm_TryExtractAssetSizeFromTags(AssetData);
-		}
-		else
-		{
-			Entry.AssetClass = TEXT("Unknown");
-			Entry.SizeBytes = -1;
-		}
-
-		OutAssets.Add(MoveTemp(Entry));
-	}
-
-	OutAssets.Sort([](const FHCIAgentPlannerEnvAssetEntry& Lhs, const FHCIAgentPlannerEnvAssetEntry& Rhs)
-	{
-		return Lhs.ObjectPath < Rhs.ObjectPath;
-	});
-	return true;
-}
-
 static bool HCI_Llm_BuildAgentPlanWithLlmPreferred(
 	const FString& UserText,
 	const FString& RequestId,
@@ -208,7 +141,7 @@ static FHCIAgentPlannerBuildOptions HCI_Llm_MakeRealHttpPlannerOptions()
 	PlannerOptions.LlmMockMode = EHCIAgentPlannerLlmMockMode::None;
 	PlannerOptions.LlmRetryCount = 1;
 	PlannerOptions.bEnableAutoEnvContextScan = true;
-	PlannerOptions.ScanAssetsForEnvContext = HCI_Llm_ScanAssetsForPlannerEnvContext;
+	PlannerOptions.ScanAssetsForEnvContext = &FHCIPlannerEnvContextProvider::ScanAssetsForPlannerEnvContext;
 	PlannerOptions.bLlmEnableThinking = false;
 	PlannerOptions.bLlmStream = false;
 	PlannerOptions.LlmHttpTimeoutMs = 30000;
@@ -316,6 +249,48 @@ static void HCI_Llm_LogAgentPlannerMetrics()
 		Metrics.RetryAttempts,
 		Metrics.CircuitOpenFallbackRequests,
 		Metrics.ConsecutiveLlmFailures);
+
+	for (const FHCIAgentLlmRouterModelMetrics& RouterMetrics : FHCIAgentLlmClient::GetRouterMetricsSnapshot())
+	{
+		UE_LOG(
+			LogHCIAgentDemo,
+			Display,
+			TEXT("[HCI][AgentPlanLLM][RouterMetrics] model=%s strategy=%s static_weight=%.2f effective_weight=%.2f ewma_latency_ms=%.1f p90_ms=%.1f p95_ms=%.1f ewma_error_rate=%.3f samples=%d success=%d failure=%d selected=%d hedge_launch=%d hedge_win=%d ejected=%s"),
+			*RouterMetrics.Model,
+			*RouterMetrics.Strategy,
+			RouterMetrics.StaticWeight,
+			RouterMetrics.EffectiveWeight,
+			RouterMetrics.EwmaLatencyMs,
+			RouterMetrics.P90LatencyMs,
+			RouterMetrics.P95LatencyMs,
+			RouterMetrics.EwmaErrorRate,
+			RouterMetrics.SampleCount,
+			RouterMetrics.SuccessCount,
+			RouterMetrics.FailureCount,
+			RouterMetrics.SelectedCount,
+			RouterMetrics.HedgeLaunchCount,
+			RouterMetrics.HedgeWinCount,
+			RouterMetrics.bEjected ? TEXT("true") : TEXT("false"));
+	}
+}
+
+static void HCI_Llm_ExportRouterMetricsJson()
+{
+	FString JsonText;
+	if (!FHCIAgentLlmClient::SerializeRouterMetricsToJson(JsonText))
+	{
+		UE_LOG(LogHCIAgentDemo, Warning, TEXT("[HCI][AgentPlanLLM][RouterMetrics] export_failed reason=serialize_failed"));
+		return;
+	}
+
+	const FString OutPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("HCI/Metrics/llm_router_metrics.json"));
+	if (!FFileHelper::SaveStringToFile(JsonText, *OutPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogHCIAgentDemo, Warning, TEXT("[HCI][AgentPlanLLM][RouterMetrics] export_failed path=%s"), *OutPath);
+		return;
+	}
+
+	UE_LOG(LogHCIAgentDemo, Display, TEXT("[HCI][AgentPlanLLM][RouterMetrics] exported path=%s"), *OutPath);
 }
 
 void HCI_RunAbilityKitAgentPlanWithRealLLMProbeCommand(const TArray<FString>& Args)
@@ -352,13 +327,22 @@ void HCI_RunAbilityKitAgentPlanWithRealLLMProbeCommand(const TArray<FString>& Ar
 		UE_LOG(LogHCIAgentDemo, Error, TEXT("[HCI][AgentPlanLLM][Probe] create_request_failed"));
 		return;
 	}
+	FHCIAgentLlmModelOutcome Outcome;
+	Outcome.RouterConfigPath = ProviderConfig.RouterConfigPath;
+	Outcome.Model = ProviderConfig.Model;
+	const double StartSeconds = FPlatformTime::Seconds();
 	Request->OnProcessRequestComplete().BindLambda(
-		[UserText](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded)
+		[UserText, Outcome, StartSeconds](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded) mutable
 		{
 			HCI_Llm_RemoveRealLlmProbeRequest(HttpRequest);
 			const int32 StatusCode = HttpResponse.IsValid() ? HttpResponse->GetResponseCode() : 0;
 			const FString Raw = HttpResponse.IsValid() ? HttpResponse->GetContentAsString() : FString(TEXT("<no_response_body>"));
 
+			// Timeouts and cancellations arrive here as bSucceeded=false and count against the model too.
+			Outcome.bSucceeded = bSucceeded && StatusCode >= 200 && StatusCode < 300;
+			Outcome.LatencyMs = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+			FHCIAgentLlmClient::ReportModelOutcome(Outcome);
+
 			UE_LOG(
 				LogHCIAgentDemo,
 				Display,
@@ -776,8 +760,11 @@ void HCI_RunAbilityKitAgentPlanWithLLMStabilityDemoCommand(const TArray<FString>
 
 void HCI_RunAbilityKitAgentPlanWithLLMMetricsDumpCommand(const TArray<FString>& Args)
 {
-	(void)Args;
 	HCI_Llm_LogAgentPlannerMetrics();
+	if (Args.Num() > 0 && Args[0].Equals(TEXT("json"), ESearchCase::IgnoreCase))
+	{
+		HCI_Llm_ExportRouterMetricsJson();
+	}
 }
 
 #undef LogHCIAgentDemo
@@ -1,6 +1,7 @@
 #include "Commands/HCIAgentCommandHandlers.h"
 #include "Commands/HCIAgentDemoState.h"
 
+#include "Agent/Contracts/HCIAgentContractDigest.h"
 #include "Agent/Contracts/StageF/HCIAgentApplyConfirmRequest.h"
 #include "Agent/Contracts/StageF/HCIAgentApplyRequest.h"
 #include "Agent/Contracts/StageF/HCIAgentExecuteTicket.h"
@@ -1569,7 +1570,7 @@ static bool HCI_TryBuildAgentExecutorStageGExecuteCommitReceiptFromLatestPreview
 	const FHCIAgentExecuteTicket ExecuteTicket = HCI_StageG_State().AgentExecuteTicketPreviewState;
 	const FHCIAgentApplyConfirmRequest ConfirmRequest = HCI_StageG_State().AgentApplyConfirmRequestPreviewState;
 	const FHCIAgentApplyRequest ApplyRequest = HCI_StageG_State().AgentApplyRequestPreviewState;
-	const FHCIDryRunDiffReport Review = HCI_StageG_State().AgentExecutorReviewDiffPreviewState;
+	const FHCIDryRunDiffReport& Review = HCI_StageG_State().AgentExecutorReviewDiffPreviewState;
 
 	FString ExpectedCommitRequestId = CommitRequest.RequestId;
 	if (TamperMode == TEXT("digest"))
@@ -1786,7 +1787,7 @@ static bool HCI_TryBuildAgentExecutorStageGExecuteFinalReportFromLatestPreview(
 	const FHCIAgentExecuteTicket ExecuteTicket = HCI_StageG_State().AgentExecuteTicketPreviewState;
 	const FHCIAgentApplyConfirmRequest ConfirmRequest = HCI_StageG_State().AgentApplyConfirmRequestPreviewState;
 	const FHCIAgentApplyRequest ApplyRequest = HCI_StageG_State().AgentApplyRequestPreviewState;
-	const FHCIDryRunDiffReport Review = HCI_StageG_State().AgentExecutorReviewDiffPreviewState;
+	const FHCIDryRunDiffReport& Review = HCI_StageG_State().AgentExecutorReviewDiffPreviewState;
 
 	FString ExpectedCommitReceiptId = CommitReceipt.RequestId;
 	FString ExpectedCommitRequestId = CommitRequest.RequestId;
@@ -2019,7 +2020,7 @@ static bool HCI_TryBuildAgentExecutorStageGExecuteArchiveBundleFromLatestPreview
 	const FHCIAgentExecuteTicket ExecuteTicket = HCI_StageG_State().AgentExecuteTicketPreviewState;
 	const FHCIAgentApplyConfirmRequest ConfirmRequest = HCI_StageG_State().AgentApplyConfirmRequestPreviewState;
 	const FHCIAgentApplyRequest ApplyRequest = HCI_StageG_State().AgentApplyRequestPreviewState;
-	const FHCIDryRunDiffReport Review = HCI_StageG_State().AgentExecutorReviewDiffPreviewState;
+	const FHCIDryRunDiffReport& Review = HCI_StageG_State().AgentExecutorReviewDiffPreviewState;
 
 	FString ExpectedFinalReportId = FinalReportReceipt.RequestId;
 	FString ExpectedCommitReceiptId = CommitReceipt.RequestId;
@@ -2237,6 +2238,9 @@ static bool HCI_TryWarmupPreviewStateForStageGExecutionReadiness()
 		return false;
 	}
 
+	// Every hop below re-verifies the seeded review; hash its selection digest once for the whole chain.
+	FHCIAgentSelectionDigestScope DigestScope;
+
 	FHCIAgentApplyRequest ApplyRequest;
 	if (HCI_StageG_State().AgentApplyRequestPreviewState.Items.Num() <= 0 &&
 		!HCI_TryBuildAgentExecutorApplyRequestFromLatestReview(ApplyRequest))
@@ -2369,6 +2373,8 @@ static bool HCI_TryBuildAgentExecutorStageGExecutionReadinessFromLatestPreview(
 		UE_LOG(LogHCIAgentDemo, Display, TEXT("[HCI][AgentExecutorStageGExecutionReadiness] warmup=done source=auto_bootstrap_chain"));
 	}
 
+	FHCIAgentSelectionDigestScope DigestScope;
+
 	FHCIAgentStageGExecuteArchiveBundle WorkingArchive = HCI_StageG_State().AgentStageGExecuteArchiveBundlePreviewState;
 	FString ExpectedArchiveBundleId = WorkingArchive.RequestId;
 
@@ -176,6 +176,10 @@ static void HCI_RequestChatSummaryFromPromptAsync(
 		FCriticalSection Mutex;
 		bool bCompleted = false;
 		TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> Request;
+		// Set once the request is on the wire; every way the race ends is then fed back to the router.
+		FString RouterConfigPath;
+		FString Model;
+		double StartSeconds = 0.0;
 	};
 	const TSharedRef<FHCIChatSummaryRaceState, ESPMode::ThreadSafe> RaceState = MakeShared<FHCIChatSummaryRaceState, ESPMode::ThreadSafe>();
 	const TSharedRef<TFunction<void(bool, const FString&)>, ESPMode::ThreadSafe> CompleteRef =
@@ -191,6 +195,16 @@ static void HCI_RequestChatSummaryFromPromptAsync(
 			RaceState->bCompleted = true;
 		}
 
+		if (!RaceState->Model.IsEmpty())
+		{
+			FHCIAgentLlmModelOutcome Outcome;
+			Outcome.RouterConfigPath = RaceState->RouterConfigPath;
+			Outcome.Model = RaceState->Model;
+			Outcome.bSucceeded = bOk;
+			Outcome.LatencyMs = (FPlatformTime::Seconds() - RaceState->StartSeconds) * 1000.0;
+			FHCIAgentLlmClient::ReportModelOutcome(Outcome);
+		}
+
 		if (*CompleteRef)
 		{
 			(*CompleteRef)(bOk, Message);
@@ -247,6 +261,8 @@ static void HCI_RequestChatSummaryFromPromptAsync(
 		return;
 	}
 	RaceState->Request = Request;
+	RaceState->RouterConfigPath = ProviderConfig.RouterConfigPath;
+	RaceState->Model = ProviderConfig.Model;
 
 	UE_LOG(
 		LogTemp,
@@ -335,6 +351,7 @@ static void HCI_RequestChatSummaryFromPromptAsync(
 		}),
 		SummaryTimeoutSeconds);
 
+	RaceState->StartSeconds = FPlatformTime::Seconds();
 	if (!Request->ProcessRequest())
 	{
 		CompleteOnce(false, TEXT("summary_process_request_failed"));
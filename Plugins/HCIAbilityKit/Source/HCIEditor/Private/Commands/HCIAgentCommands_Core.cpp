@@ -115,10 +115,19 @@ void FHCIAgentDemoConsoleCommands::StartupCoreCommands()
 			TEXT("F5 Executor preflight gate-chain demo (Confirm/BlastRadius/RBAC/SourceControl/LOD Safety). Usage: HCI.AgentExecutePlanPreflightDemo [ok|fail_confirm|fail_blast|fail_rbac|fail_sc|fail_lod]"),
 			FConsoleCommandWithArgsDelegate::CreateStatic(&HCI_RunAbilityKitAgentExecutePlanPreflightDemoCommand));
 	}
+
+	if (!TraceLatencyHistogramCommand.IsValid())
+	{
+		TraceLatencyHistogramCommand = MakeUnique<FAutoConsoleCommand>(
+			TEXT("HCI.TraceLatencyHistogram"),
+			TEXT("Dump per-stage latency (p50/p95/max + histogram) for the last N agent requests. Usage: HCI.TraceLatencyHistogram [last_n=20] [reset]"),
+			FConsoleCommandWithArgsDelegate::CreateStatic(&HCI_RunAbilityKitTraceLatencyHistogramCommand));
+	}
 }
 
 void FHCIAgentDemoConsoleCommands::ShutdownCoreCommands()
 {
+	TraceLatencyHistogramCommand.Reset();
 	AgentExecutePlanPreflightDemoCommand.Reset();
 	AgentExecutePlanFailDemoCommand.Reset();
 	AgentExecutePlanDemoCommand.Reset();
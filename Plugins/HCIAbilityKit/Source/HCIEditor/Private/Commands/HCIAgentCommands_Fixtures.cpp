@@ -1,5 +1,8 @@
 #include "Commands/HCIAgentDemoConsoleCommands.h"
 
+#include "Commands/HCISyntheticFixtureGenerator.h"
+#include "AgentActions/Support/HCINameContractIndex.h"
+
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "AssetToolsModule.h"
 #include "Dom/JsonObject.h"
@@ -33,6 +36,9 @@ static const TCHAR* HCI_MatLinkMastersRoot = TEXT("/Game/__HCI_Test/Masters");
 static const TCHAR* HCI_MatLinkChaosRoot = TEXT("/Game/__HCI_Test/Incoming/MatLinkChaos");
 static const TCHAR* HCI_MatLinkCleanRoot = TEXT("/Game/__HCI_Test/Organized/MatLinkClean");
 
+// Duplicate stages keep going within one tick until this budget is spent, instead of one package per tick.
+constexpr double HCI_FixtureTickBudgetSeconds = 0.025;
+
 static bool HCI_IsAllowedTestRoot(const FString& Path)
 {
 	return Path.StartsWith(TEXT("/Game/__HCI_Test/"), ESearchCase::CaseSensitive)
@@ -403,7 +409,11 @@ static bool HCI_TickSeedChaosJob(float DeltaTime)
 	{
 	case EHCISeedChaosJobStage::Build_Duplicate:
 	{
-		DuplicateOne(HCI_SnapshotRoot, TEXT("seed"));
+		const double BudgetEndSeconds = FPlatformTime::Seconds() + HCI_FixtureTickBudgetSeconds;
+		do
+		{
+			DuplicateOne(HCI_SnapshotRoot, TEXT("seed"));
+		} while (GSeedChaosJob.Index < GSeedChaosJob.Packages.Num() && FPlatformTime::Seconds() < BudgetEndSeconds);
 		const FString Msg = FString::Printf(TEXT("SeedChaos：生成快照中 %d/%d（成功 %d）"), GSeedChaosJob.Index, GSeedChaosJob.Packages.Num(), GSeedChaosJob.SuccessCount);
 		HCI_UpdateSeedChaosNotification(Msg, SNotificationItem::CS_Pending, false);
 		if (GSeedChaosJob.Index >= GSeedChaosJob.Packages.Num())
@@ -421,7 +431,11 @@ static bool HCI_TickSeedChaosJob(float DeltaTime)
 	}
 	case EHCISeedChaosJobStage::Reset_Duplicate:
 	{
-		DuplicateOne(HCI_IncomingRoot, TEXT("copy"));
+		const double BudgetEndSeconds = FPlatformTime::Seconds() + HCI_FixtureTickBudgetSeconds;
+		do
+		{
+			DuplicateOne(HCI_IncomingRoot, TEXT("copy"));
+		} while (GSeedChaosJob.Index < GSeedChaosJob.Packages.Num() && FPlatformTime::Seconds() < BudgetEndSeconds);
 		const FString Msg = FString::Printf(TEXT("SeedChaos：复制快照到 Incoming %d/%d（成功 %d）"), GSeedChaosJob.Index, GSeedChaosJob.Packages.Num(), GSeedChaosJob.SuccessCount);
 		HCI_UpdateSeedChaosNotification(Msg, SNotificationItem::CS_Pending, false);
 		if (GSeedChaosJob.Index >= GSeedChaosJob.Packages.Num())
@@ -698,96 +712,12 @@ static void HCI_RunSeedChaosResetCommand(const TArray<FString>& Args)
 	UE_LOG(LogHCIFixtures, Display, TEXT("[HCI][Fixtures] reset started snapshot_pkgs=%d incoming=%s organized=%s"), GSeedChaosJob.Packages.Num(), HCI_IncomingRoot, HCI_OrganizedRoot);
 }
 
-enum class EHCIMatLinkRole : uint8
-{
-	Unknown = 0,
-	BC,
-	N,
-	ORM
-};
+// Role heuristics live in the shared name-contract index so the fixtures and AutoMaterialSetup agree.
+using EHCIMatLinkRole = EHCITextureRole;
 
 static FString HCI_MatLinkRoleToString(const EHCIMatLinkRole Role)
 {
-	switch (Role)
-	{
-	case EHCIMatLinkRole::BC:
-		return TEXT("BC");
-	case EHCIMatLinkRole::N:
-		return TEXT("N");
-	case EHCIMatLinkRole::ORM:
-		return TEXT("ORM");
-	default:
-		return TEXT("Unknown");
-	}
-}
-
-static EHCIMatLinkRole HCI_DetectTextureRoleFromName(const FString& InName)
-{
-	const FString Name = InName.ToLower();
-
-	auto HasToken = [&Name](const TCHAR* Token)
-	{
-		return Name.Contains(Token);
-	};
-
-	// Prefer explicit suffix-like tokens.
-	if (HasToken(TEXT("_orm")) || HasToken(TEXT("occlusionroughnessmetallic")) || HasToken(TEXT("_rma")) || HasToken(TEXT("_mrao")) || HasToken(TEXT("_aorm")))
-	{
-		return EHCIMatLinkRole::ORM;
-	}
-	if (HasToken(TEXT("_bc")) || HasToken(TEXT("basecolor")) || HasToken(TEXT("albedo")) || HasToken(TEXT("diffuse")) || HasToken(TEXT("_col")) || HasToken(TEXT("_color")))
-	{
-		return EHCIMatLinkRole::BC;
-	}
-	if (HasToken(TEXT("_n")) || HasToken(TEXT("normal")) || HasToken(TEXT("_nrm")) || HasToken(TEXT("_nor")))
-	{
-		return EHCIMatLinkRole::N;
-	}
-	return EHCIMatLinkRole::Unknown;
-}
-
-static int32 HCI_TextureRoleMatchQuality(const FString& InName, const EHCIMatLinkRole Role)
-{
-	const FString Name = InName.ToLower();
-	switch (Role)
-	{
-	case EHCIMatLinkRole::BC:
-		if (Name.EndsWith(TEXT("_bc")) || Name.Contains(TEXT("_bc_")))
-		{
-			return 3;
-		}
-		if (Name.Contains(TEXT("basecolor")) || Name.Contains(TEXT("albedo")))
-		{
-			return 2;
-		}
-		if (Name.Contains(TEXT("diffuse")) || Name.Contains(TEXT("color")))
-		{
-			return 1;
-		}
-		return 0;
-	case EHCIMatLinkRole::N:
-		if (Name.EndsWith(TEXT("_n")) || Name.Contains(TEXT("_n_")))
-		{
-			return 3;
-		}
-		if (Name.Contains(TEXT("normal")))
-		{
-			return 2;
-		}
-		return 0;
-	case EHCIMatLinkRole::ORM:
-		if (Name.EndsWith(TEXT("_orm")) || Name.Contains(TEXT("_orm_")))
-		{
-			return 3;
-		}
-		if (Name.Contains(TEXT("occlusionroughnessmetallic")) || Name.Contains(TEXT("_rma")) || Name.Contains(TEXT("_mrao")))
-		{
-			return 2;
-		}
-		return 0;
-	default:
-		return 0;
-	}
+	return FHCINameContractIndex::RoleToString(Role);
 }
 
 static FString HCI_AssetDataToObjectPathString(const FAssetData& Data)
@@ -912,10 +842,11 @@ static bool HCI_SelectBestSeedPbrGroup(
 				if (Prefix == TEXT("T"))
 				{
 					AnyTextures.Add(A);
-					const EHCIMatLinkRole Role = HCI_DetectTextureRoleFromName(A.AssetName.ToString());
+					const FHCINameContractClassification& Classification = FHCINameContractIndex::Get().Classify(A.AssetName.ToString());
+					const EHCIMatLinkRole Role = Classification.LooseRole;
 					if (Role != EHCIMatLinkRole::Unknown)
 					{
-						const int32 Q = HCI_TextureRoleMatchQuality(A.AssetName.ToString(), Role);
+						const int32 Q = Classification.LooseRoleQuality;
 						const int32 Prev = RoleQualities.Contains(Role) ? RoleQualities[Role] : -1;
 						if (Q > Prev)
 						{
@@ -1698,6 +1629,181 @@ static void HCI_RunMatLinkResetFuzzyOkCommand(const TArray<FString>& Args)
 	HCI_RunMatLinkResetImpl(Args, EHCIMatLinkResetPreset::FuzzyOkNoOrphans);
 }
 
+struct FHCISyntheticFixtureJobState
+{
+	FHCISyntheticFixtureOptions Options;
+	FString TargetRoot;
+	TArray<FHCISyntheticAssetRecord> Records;
+	int32 NextIndex = 0;
+	FHCISyntheticFixtureStats Stats;
+	double StartSeconds = 0.0;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+	TSharedPtr<SNotificationItem> Notification;
+
+	void Reset()
+	{
+		Options = FHCISyntheticFixtureOptions();
+		TargetRoot.Reset();
+		Records.Reset();
+		NextIndex = 0;
+		Stats = FHCISyntheticFixtureStats();
+		StartSeconds = 0.0;
+		TickerHandle.Reset();
+		Notification.Reset();
+	}
+
+	bool IsActive() const
+	{
+		return TickerHandle.IsValid();
+	}
+};
+
+static FHCISyntheticFixtureJobState GSyntheticFixtureJob;
+
+static void HCI_UpdateSyntheticFixtureNotification(const FString& Msg, const SNotificationItem::ECompletionState State, const bool bExpire)
+{
+	if (!GSyntheticFixtureJob.Notification.IsValid())
+	{
+		return;
+	}
+	GSyntheticFixtureJob.Notification->SetText(FText::FromString(Msg));
+	GSyntheticFixtureJob.Notification->SetCompletionState(State);
+	if (bExpire)
+	{
+		GSyntheticFixtureJob.Notification->ExpireAndFadeout();
+	}
+}
+
+static bool HCI_TickSyntheticFixtureJob(float)
+{
+	FHCISyntheticFixtureJobState& Job = GSyntheticFixtureJob;
+	if (Job.NextIndex < Job.Records.Num())
+	{
+		// One batch per tick: create, then save with async writes flushed at the end of the batch.
+		const int32 Num = FMath::Min(FMath::Max(1, Job.Options.BatchSize), Job.Records.Num() - Job.NextIndex);
+		TArray<UPackage*> BatchPackages;
+		BatchPackages.Reserve(Num);
+
+		const double CreateStart = FPlatformTime::Seconds();
+		Job.Stats.CreatedCount += FHCISyntheticFixtureGenerator::CreateAssetBatch(
+			Job.TargetRoot,
+			MakeArrayView(Job.Records).Slice(Job.NextIndex, Num),
+			BatchPackages);
+		const double SaveStart = FPlatformTime::Seconds();
+		Job.Stats.SavedCount += FHCISyntheticFixtureGenerator::SavePackageBatch(BatchPackages);
+		Job.Stats.CreateMs += (SaveStart - CreateStart) * 1000.0;
+		Job.Stats.SaveMs += (FPlatformTime::Seconds() - SaveStart) * 1000.0;
+		++Job.Stats.BatchCount;
+		Job.NextIndex += Num;
+
+		HCI_UpdateSyntheticFixtureNotification(
+			FString::Printf(TEXT("SyntheticFixture：生成中 %d/%d（已保存 %d）"), Job.NextIndex, Job.Records.Num(), Job.Stats.SavedCount),
+			SNotificationItem::CS_Pending,
+			false);
+		return true;
+	}
+
+	FString ReportPath;
+	FHCISyntheticFixtureGenerator::WriteReport(Job.Options, Job.TargetRoot, Job.Records, Job.Stats, ReportPath);
+	UE_LOG(
+		LogHCIFixtures,
+		Display,
+		TEXT("[HCI][Fixtures] synthetic_done root=%s count=%d created=%d saved=%d batches=%d create_ms=%.1f save_ms=%.1f total_ms=%.1f report=%s"),
+		*Job.TargetRoot,
+		Job.Records.Num(),
+		Job.Stats.CreatedCount,
+		Job.Stats.SavedCount,
+		Job.Stats.BatchCount,
+		Job.Stats.CreateMs,
+		Job.Stats.SaveMs,
+		(FPlatformTime::Seconds() - Job.StartSeconds) * 1000.0,
+		*ReportPath);
+	HCI_UpdateSyntheticFixtureNotification(
+		FString::Printf(TEXT("SyntheticFixture：完成 %d 个资产（%s）"), Job.Stats.SavedCount, *Job.TargetRoot),
+		Job.Stats.SavedCount == Job.Records.Num() ? SNotificationItem::CS_Success : SNotificationItem::CS_Fail,
+		true);
+	Job.Reset();
+	return false;
+}
+
+static void HCI_RunSyntheticFixtureBuildCommand(const TArray<FString>& Args)
+{
+	if (GSyntheticFixtureJob.IsActive())
+	{
+		UE_LOG(LogHCIFixtures, Warning, TEXT("[HCI][Fixtures] synthetic_job_busy root=%s progress=%d/%d"), *GSyntheticFixtureJob.TargetRoot, GSyntheticFixtureJob.NextIndex, GSyntheticFixtureJob.Records.Num());
+		return;
+	}
+
+	FHCISyntheticFixtureOptions Options;
+	if (Args.Num() >= 1 && !FHCISyntheticFixtureGenerator::TryParseCountPreset(Args[0], Options.Count))
+	{
+		UE_LOG(LogHCIFixtures, Error, TEXT("[HCI][Fixtures] synthetic_invalid_count value=%s (expected 1k|10k|100k|<n>)"), *Args[0]);
+		return;
+	}
+	if (Args.Num() >= 2 && !LexTryParseString(Options.Seed, *Args[1]))
+	{
+		UE_LOG(LogHCIFixtures, Error, TEXT("[HCI][Fixtures] synthetic_invalid_seed value=%s"), *Args[1]);
+		return;
+	}
+	if (Args.Num() >= 3 && (!LexTryParseString(Options.BatchSize, *Args[2]) || Options.BatchSize <= 0))
+	{
+		UE_LOG(LogHCIFixtures, Error, TEXT("[HCI][Fixtures] synthetic_invalid_batch_size value=%s"), *Args[2]);
+		return;
+	}
+
+	const FString ManifestPath = FPaths::Combine(FPaths::ProjectDir(), TEXT("SourceData/AbilityKits/seed_mesh_manifest.json"));
+	FString ManifestError;
+	if (FPaths::FileExists(ManifestPath) && !FHCISyntheticFixtureGenerator::LoadSeedMeshManifest(ManifestPath, Options.RepresentingMeshPool, ManifestError))
+	{
+		UE_LOG(LogHCIFixtures, Warning, TEXT("[HCI][Fixtures] synthetic_manifest_skipped reason=%s"), *ManifestError);
+	}
+
+	const FString TargetRoot = FHCISyntheticFixtureGenerator::MakeDefaultRoot(Options.Count, Options.Seed);
+	if (!HCI_DeleteDirectoryWithConfirm(TargetRoot, TEXT("重建 SyntheticFixture（基准测试资产）")))
+	{
+		return;
+	}
+
+	FHCISyntheticFixtureJobState& Job = GSyntheticFixtureJob;
+	Job.Reset();
+	FString DatasetError;
+	if (!FHCISyntheticFixtureGenerator::BuildDataset(Options, Job.Records, DatasetError))
+	{
+		UE_LOG(LogHCIFixtures, Error, TEXT("[HCI][Fixtures] synthetic_dataset_failed reason=%s"), *DatasetError);
+		Job.Reset();
+		return;
+	}
+	Job.Options = MoveTemp(Options);
+	Job.TargetRoot = TargetRoot;
+	Job.StartSeconds = FPlatformTime::Seconds();
+
+	FNotificationInfo Info(FText::FromString(TEXT("SyntheticFixture：开始...")));
+	Info.bFireAndForget = false;
+	Info.bUseLargeFont = false;
+	Info.FadeInDuration = 0.1f;
+	Info.FadeOutDuration = 0.2f;
+	Info.ExpireDuration = 1.0f;
+	Info.bUseThrobber = true;
+	Job.Notification = FSlateNotificationManager::Get().AddNotification(Info);
+	if (Job.Notification.IsValid())
+	{
+		Job.Notification->SetCompletionState(SNotificationItem::CS_Pending);
+	}
+
+	Job.TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&HCI_TickSyntheticFixtureJob), 0.0f);
+	UE_LOG(
+		LogHCIFixtures,
+		Display,
+		TEXT("[HCI][Fixtures] synthetic_started root=%s count=%d seed=%d batch_size=%d mesh_pool=%d digest=%08x"),
+		*Job.TargetRoot,
+		Job.Records.Num(),
+		Job.Options.Seed,
+		Job.Options.BatchSize,
+		Job.Options.RepresentingMeshPool.Num(),
+		FHCISyntheticFixtureGenerator::ComputeDatasetDigest(Job.Records));
+}
+
 void FHCIAgentDemoConsoleCommands::StartupFixtureCommands()
 {
 	if (!SeedChaosBuildSnapshotCommand.IsValid())
@@ -1739,6 +1845,14 @@ void FHCIAgentDemoConsoleCommands::StartupFixtureCommands()
 			TEXT("Stage O fixtures: reset MatLink chaos + clean, with S2_Fuzzy being contract-compliant (no orphans) but still directory-scattered. Usage: HCI.MatLinkResetFuzzyOk"),
 			FConsoleCommandWithArgsDelegate::CreateStatic(&HCI_RunMatLinkResetFuzzyOkCommand));
 	}
+
+	if (!SyntheticFixtureBuildCommand.IsValid())
+	{
+		SyntheticFixtureBuildCommand = MakeUnique<FAutoConsoleCommand>(
+			TEXT("HCI.SyntheticFixtureBuild"),
+			TEXT("Benchmark fixtures: bulk-create UHCIAsset packages (hci_generate_synthetic_assets.py schema) under /Game/__HCI_Test/Bench/Synthetic_<count>_s<seed>. Usage: HCI.SyntheticFixtureBuild [1k|10k|100k|<count>] [seed=42] [batch_size=500]"),
+			FConsoleCommandWithArgsDelegate::CreateStatic(&HCI_RunSyntheticFixtureBuildCommand));
+	}
 }
 
 void FHCIAgentDemoConsoleCommands::ShutdownFixtureCommands()
@@ -1748,5 +1862,6 @@ void FHCIAgentDemoConsoleCommands::ShutdownFixtureCommands()
 	MatLinkResetCommand.Reset();
 	MatLinkResetFuzzyOkCommand.Reset();
 	MatLinkBuildSnapshotCommand.Reset();
+	SyntheticFixtureBuildCommand.Reset();
 }
 
@@ -48,7 +48,7 @@ void FHCIAgentDemoConsoleCommands::StartupLlmCommands()
 	{
 		AgentPlanWithLLMMetricsDumpCommand = MakeUnique<FAutoConsoleCommand>(
 			TEXT("HCI.AgentPlanWithLLMMetricsDump"),
-			TEXT("H2 dump planner stability metrics snapshot."),
+			TEXT("H2 dump planner stability metrics and per-model router stats. Usage: HCI.AgentPlanWithLLMMetricsDump [json]"),
 			FConsoleCommandWithArgsDelegate::CreateStatic(&HCI_RunAbilityKitAgentPlanWithLLMMetricsDumpCommand));
 	}
 }
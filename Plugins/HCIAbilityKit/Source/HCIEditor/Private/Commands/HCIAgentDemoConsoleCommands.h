@@ -32,6 +32,7 @@ private:
 	TUniquePtr<FAutoConsoleCommand> AgentPlanDemoJsonCommand;
 	TUniquePtr<FAutoConsoleCommand> AgentPlanPreviewUiCommand;
 	TUniquePtr<FAutoConsoleCommand> AgentChatUiCommand;
+	TUniquePtr<FAutoConsoleCommand> TraceLatencyHistogramCommand;
 	TUniquePtr<FAutoConsoleCommand> IngestDumpLatestCommand;
 	TUniquePtr<FAutoConsoleCommand> IngestImportLatestCommand;
 	TUniquePtr<FAutoConsoleCommand> SeedChaosBuildSnapshotCommand;
@@ -39,6 +40,7 @@ private:
 	TUniquePtr<FAutoConsoleCommand> MatLinkBuildSnapshotCommand;
 	TUniquePtr<FAutoConsoleCommand> MatLinkResetCommand;
 	TUniquePtr<FAutoConsoleCommand> MatLinkResetFuzzyOkCommand;
+	TUniquePtr<FAutoConsoleCommand> SyntheticFixtureBuildCommand;
 	TUniquePtr<FAutoConsoleCommand> AgentPlanWithLLMDemoCommand;
 	TUniquePtr<FAutoConsoleCommand> AgentPlanWithRealLLMDemoCommand;
 	TUniquePtr<FAutoConsoleCommand> AgentPlanWithRealLLMProbeCommand;
@@ -0,0 +1,317 @@
+#include "Commands/HCIPlannerEnvContextProvider.h"
+
+#include "AssetRegistry/AssetData.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Misc/StringBuilder.h"
+#include "Modules/ModuleManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogHCIPlannerEnvContext, Log, All);
+
+namespace
+{
+constexpr int32 HCIPlannerEnvContextMaxCachedRoots = 32;
+
+struct FHCIEnvTopKEntry
+{
+	FString ObjectPath;
+	int32 AssetIndex = INDEX_NONE;
+	int32 Score = 0;
+};
+
+static bool HCI_IsObjectPathLess(const FStringView Lhs, const FStringView Rhs)
+{
+	return Lhs.Compare(Rhs, ESearchCase::IgnoreCase) < 0;
+}
+
+// Higher relevance first, then ObjectPath.
+static bool HCI_IsEnvEntryBetter(const int32 LhsScore, const FStringView LhsPath, const int32 RhsScore, const FStringView RhsPath)
+{
+	if (LhsScore != RhsScore)
+	{
+		return LhsScore > RhsScore;
+	}
+	return HCI_IsObjectPathLess(LhsPath, RhsPath);
+}
+
+static int64 HCI_TryExtractAssetSizeFromTags(const FAssetData& AssetData)
+{
+	int64 SizeBytes = -1;
+	if (AssetData.GetTagValue(FName(TEXT("DiskSize")), SizeBytes))
+	{
+		return SizeBytes;
+	}
+	if (AssetData.GetTagValue(FName(TEXT("FileSize")), SizeBytes))
+	{
+		return SizeBytes;
+	}
+
+	FString SizeText;
+	if (AssetData.GetTagValue(FName(TEXT("DiskSize")), SizeText) && LexTryParseString(SizeBytes, *SizeText))
+	{
+		return SizeBytes;
+	}
+	if (AssetData.GetTagValue(FName(TEXT("FileSize")), SizeText) && LexTryParseString(SizeBytes, *SizeText))
+	{
+		return SizeBytes;
+	}
+	return -1;
+}
+
+static FString HCI_NormalizeEnvScanRoot(const FString& ScanRoot)
+{
+	FString SafeRoot = ScanRoot.TrimStartAndEnd();
+	if (SafeRoot.IsEmpty() || !SafeRoot.StartsWith(TEXT("/Game/")))
+	{
+		SafeRoot = TEXT("/Game/Temp");
+	}
+	while (SafeRoot.Len() > 1 && SafeRoot.EndsWith(TEXT("/")))
+	{
+		SafeRoot.LeftChopInline(1, EAllowShrinking::No);
+	}
+	return SafeRoot;
+}
+} // namespace
+
+FHCIPlannerEnvContextProvider& FHCIPlannerEnvContextProvider::Get()
+{
+	static FHCIPlannerEnvContextProvider Instance;
+	return Instance;
+}
+
+bool FHCIPlannerEnvContextProvider::ScanAssetsForPlannerEnvContext(
+	const FString& ScanRoot,
+	const FString& UserText,
+	const int32 MaxAssetRows,
+	FHCIAgentPlannerEnvSnapshot& OutSnapshot,
+	FString& OutError)
+{
+	return Get().GetSnapshot(ScanRoot, UserText, MaxAssetRows, OutSnapshot, OutError);
+}
+
+void FHCIPlannerEnvContextProvider::BuildSnapshotFromAssets(
+	const FString& ScanRoot,
+	const TArray<FAssetData>& Assets,
+	const int32 MaxAssetRows,
+	const FHCIPlannerEnvRelevanceQuery& Relevance,
+	FHCIAgentPlannerEnvSnapshot& OutSnapshot)
+{
+	OutSnapshot = FHCIAgentPlannerEnvSnapshot();
+	OutSnapshot.ScanRoot = ScanRoot;
+	OutSnapshot.TotalAssetCount = Assets.Num();
+
+	const int32 K = FMath::Max(0, MaxAssetRows);
+	// Heap with the worst kept entry on top (lowest score, then largest path), so anything better evicts it.
+	const auto HeapPredicate = [](const FHCIEnvTopKEntry& Lhs, const FHCIEnvTopKEntry& Rhs)
+	{
+		return HCI_IsEnvEntryBetter(Rhs.Score, Rhs.ObjectPath, Lhs.Score, Lhs.ObjectPath);
+	};
+	TArray<FHCIEnvTopKEntry> TopK;
+	TopK.Reserve(K);
+	TMap<FName, int32> CountByClass;
+	TMap<FName, int32> CountByFolder;
+	// Folder and class scores only depend on the folder / class, so each is scored once.
+	const bool bScoreRelevance = K > 0 && !Relevance.IsEmpty();
+	const FString RootPrefix = ScanRoot + TEXT("/");
+	TMap<FName, int32> FolderScoreByPath;
+	TMap<FName, int32> ClassScoreByName;
+
+	TStringBuilder<256> PathBuilder;
+	for (int32 AssetIndex = 0; AssetIndex < Assets.Num(); ++AssetIndex)
+	{
+		const FAssetData& AssetData = Assets[AssetIndex];
+		++CountByClass.FindOrAdd(AssetData.AssetClassPath.GetAssetName());
+		++CountByFolder.FindOrAdd(AssetData.PackagePath);
+
+		const int64 SizeBytes = HCI_TryExtractAssetSizeFromTags(AssetData);
+		if (SizeBytes >= 0)
+		{
+			OutSnapshot.TotalSizeBytes += SizeBytes;
+			++OutSnapshot.SizedAssetCount;
+		}
+
+		if (K == 0)
+		{
+			continue;
+		}
+		int32 Score = 0;
+		if (bScoreRelevance)
+		{
+			int32* FolderScore = FolderScoreByPath.Find(AssetData.PackagePath);
+			if (FolderScore == nullptr)
+			{
+				const FString PackagePath = AssetData.PackagePath.ToString();
+				FolderScore = &FolderScoreByPath.Add(
+					AssetData.PackagePath,
+					Relevance.ScoreFolder(PackagePath.StartsWith(RootPrefix, ESearchCase::IgnoreCase) ? PackagePath.Mid(RootPrefix.Len()) : FString()));
+			}
+			const FName ClassName = AssetData.AssetClassPath.GetAssetName();
+			int32* ClassScore = ClassScoreByName.Find(ClassName);
+			if (ClassScore == nullptr)
+			{
+				ClassScore = &ClassScoreByName.Add(ClassName, Relevance.ScoreClass(ClassName.ToString()));
+			}
+			Score = Relevance.ScoreName(AssetData.AssetName.ToString()) + *FolderScore + *ClassScore;
+		}
+		PathBuilder.Reset();
+		AssetData.AppendObjectPath(PathBuilder);
+		if (TopK.Num() < K)
+		{
+			TopK.HeapPush({FString(PathBuilder.ToView()), AssetIndex, Score}, HeapPredicate);
+		}
+		else if (HCI_IsEnvEntryBetter(Score, PathBuilder.ToView(), TopK.HeapTop().Score, TopK.HeapTop().ObjectPath))
+		{
+			TopK.HeapPopDiscard(HeapPredicate, EAllowShrinking::No);
+			TopK.HeapPush({FString(PathBuilder.ToView()), AssetIndex, Score}, HeapPredicate);
+		}
+	}
+
+	// Kept rows go out in path order; the encoder ranks them again against the same query.
+	TopK.Sort([](const FHCIEnvTopKEntry& Lhs, const FHCIEnvTopKEntry& Rhs)
+	{
+		return HCI_IsObjectPathLess(Lhs.ObjectPath, Rhs.ObjectPath);
+	});
+	OutSnapshot.Assets.Reserve(TopK.Num());
+	for (FHCIEnvTopKEntry& Kept : TopK)
+	{
+		const FAssetData& AssetData = Assets[Kept.AssetIndex];
+		FHCIAgentPlannerEnvAssetEntry& Entry = OutSnapshot.Assets.AddDefaulted_GetRef();
+		Entry.ObjectPath = MoveTemp(Kept.ObjectPath);
+		Entry.AssetClass = AssetData.AssetClassPath.GetAssetName().ToString();
+		Entry.SizeBytes = HCI_TryExtractAssetSizeFromTags(AssetData);
+	}
+
+	OutSnapshot.ClassHistogram.Reserve(CountByClass.Num());
+	for (const TPair<FName, int32>& Pair : CountByClass)
+	{
+		FHCIAgentPlannerEnvClassCount& ClassCount = OutSnapshot.ClassHistogram.AddDefaulted_GetRef();
+		ClassCount.AssetClass = Pair.Key.IsNone() ? TEXT("Unknown") : Pair.Key.ToString();
+		ClassCount.Count = Pair.Value;
+	}
+	OutSnapshot.ClassHistogram.Sort([](const FHCIAgentPlannerEnvClassCount& Lhs, const FHCIAgentPlannerEnvClassCount& Rhs)
+	{
+		if (Lhs.Count != Rhs.Count)
+		{
+			return Lhs.Count > Rhs.Count;
+		}
+		return Lhs.AssetClass < Rhs.AssetClass;
+	});
+
+	OutSnapshot.FolderCounts.Reserve(CountByFolder.Num());
+	for (const TPair<FName, int32>& Pair : CountByFolder)
+	{
+		const FString PackagePath = Pair.Key.ToString();
+		FHCIAgentPlannerEnvFolderCount& FolderCount = OutSnapshot.FolderCounts.AddDefaulted_GetRef();
+		FolderCount.Folder = PackagePath.StartsWith(RootPrefix, ESearchCase::IgnoreCase)
+			? PackagePath.Mid(RootPrefix.Len())
+			: (PackagePath.Equals(ScanRoot, ESearchCase::IgnoreCase) ? FString() : PackagePath);
+		FolderCount.Count = Pair.Value;
+	}
+	OutSnapshot.FolderCounts.Sort([](const FHCIAgentPlannerEnvFolderCount& Lhs, const FHCIAgentPlannerEnvFolderCount& Rhs)
+	{
+		return Lhs.Folder < Rhs.Folder;
+	});
+}
+
+bool FHCIPlannerEnvContextProvider::GetSnapshot(
+	const FString& ScanRoot,
+	const FString& UserText,
+	const int32 MaxAssetRows,
+	FHCIAgentPlannerEnvSnapshot& OutSnapshot,
+	FString& OutError)
+{
+	OutError.Reset();
+	EnsureBoundToAssetRegistry();
+
+	const FString SafeRoot = HCI_NormalizeEnvScanRoot(ScanRoot);
+	const FHCIPlannerEnvRelevanceQuery Relevance = FHCIPlannerEnvRelevanceQuery::Make(UserText, SafeRoot);
+	const FString CacheKey = Relevance.IsEmpty() ? SafeRoot : SafeRoot + TEXT("|") + Relevance.GetCacheKey();
+	if (const FCachedSnapshot* Cached = CacheByRoot.Find(CacheKey))
+	{
+		// Path-ordered rows truncate to a smaller top-K; relevance-ranked rows were re-sorted by path and do not.
+		const bool bRowsReusable = Cached->bRelevanceRanked
+			? Cached->MaxAssetRows == MaxAssetRows
+			: Cached->MaxAssetRows >= MaxAssetRows;
+		if (Cached->Generation == Generation && bRowsReusable)
+		{
+			OutSnapshot = Cached->Snapshot;
+			if (OutSnapshot.Assets.Num() > MaxAssetRows)
+			{
+				OutSnapshot.Assets.SetNum(FMath::Max(0, MaxAssetRows));
+			}
+			OutSnapshot.bFromCache = true;
+			return true;
+		}
+	}
+
+	const double StartSeconds = FPlatformTime::Seconds();
+	IAssetRegistry& Registry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	TArray<FAssetData> Assets;
+	Registry.GetAssetsByPath(FName(*SafeRoot), Assets, true);
+	++QueryCount;
+
+	BuildSnapshotFromAssets(SafeRoot, Assets, MaxAssetRows, Relevance, OutSnapshot);
+
+	// A snapshot taken while discovery is still running is incomplete; serve it but do not keep it.
+	const bool bCacheable = !Registry.IsLoadingAssets();
+	if (bCacheable)
+	{
+		if (CacheByRoot.Num() >= HCIPlannerEnvContextMaxCachedRoots && !CacheByRoot.Contains(CacheKey))
+		{
+			CacheByRoot.Reset();
+		}
+		FCachedSnapshot& Slot = CacheByRoot.FindOrAdd(CacheKey);
+		Slot.Generation = Generation;
+		Slot.MaxAssetRows = MaxAssetRows;
+		Slot.bRelevanceRanked = !Relevance.IsEmpty();
+		Slot.Snapshot = OutSnapshot;
+	}
+
+	UE_LOG(
+		LogHCIPlannerEnvContext,
+		Verbose,
+		TEXT("[HCI][PlannerEnvContext] root=%s assets=%d kept=%d classes=%d total_size_bytes=%lld cached=%s elapsed_ms=%.2f"),
+		*SafeRoot,
+		OutSnapshot.TotalAssetCount,
+		OutSnapshot.Assets.Num(),
+		OutSnapshot.ClassHistogram.Num(),
+		static_cast<long long>(OutSnapshot.TotalSizeBytes),
+		bCacheable ? TEXT("true") : TEXT("false"),
+		(FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+	return true;
+}
+
+void FHCIPlannerEnvContextProvider::Invalidate()
+{
+	BumpGeneration();
+	CacheByRoot.Reset();
+}
+
+void FHCIPlannerEnvContextProvider::EnsureBoundToAssetRegistry()
+{
+	if (bBoundToAssetRegistry)
+	{
+		return;
+	}
+
+	IAssetRegistry& Registry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	AssetAddedHandle = Registry.OnAssetAdded().AddLambda([this](const FAssetData&) { BumpGeneration(); });
+	AssetRemovedHandle = Registry.OnAssetRemoved().AddLambda([this](const FAssetData&) { BumpGeneration(); });
+	AssetRenamedHandle = Registry.OnAssetRenamed().AddLambda([this](const FAssetData&, const FString&) { BumpGeneration(); });
+	AssetUpdatedHandle = Registry.OnAssetUpdated().AddLambda([this](const FAssetData&) { BumpGeneration(); });
+	bBoundToAssetRegistry = true;
+}
+
+void FHCIPlannerEnvContextProvider::Shutdown()
+{
+	if (bBoundToAssetRegistry && FModuleManager::Get().IsModuleLoaded(TEXT("AssetRegistry")))
+	{
+		IAssetRegistry& Registry = FModuleManager::GetModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+		Registry.OnAssetAdded().Remove(AssetAddedHandle);
+		Registry.OnAssetRemoved().Remove(AssetRemovedHandle);
+		Registry.OnAssetRenamed().Remove(AssetRenamedHandle);
+		Registry.OnAssetUpdated().Remove(AssetUpdatedHandle);
+	}
+	bBoundToAssetRegistry = false;
+	CacheByRoot.Reset();
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Agent/Planner/HCIAgentPlanner.h"
+#include "Agent/Planner/HCIPlannerEnvContextEncoder.h"
+
+struct FAssetData;
+
+// Bounded ENV_CONTEXT asset snapshot for the planner. One recursive GetAssetsByPath per scan root feeds a
+// top-K selection (most relevant to the user text first, ObjectPath breaking ties) plus class histogram,
+// per-folder counts and size totals in the same pass. Results are cached per root and relevance query and
+// reused until the AssetRegistry generation (bumped on asset add/remove/rename/update) moves.
+// Game thread only, like the registry queries it wraps.
+class FHCIPlannerEnvContextProvider
+{
+public:
+	static FHCIPlannerEnvContextProvider& Get();
+
+	// Signature matches FHCIAgentPlannerBuildOptions::ScanAssetsForEnvContext.
+	static bool ScanAssetsForPlannerEnvContext(
+		const FString& ScanRoot,
+		const FString& UserText,
+		int32 MaxAssetRows,
+		FHCIAgentPlannerEnvSnapshot& OutSnapshot,
+		FString& OutError);
+
+	static void BuildSnapshotFromAssets(
+		const FString& ScanRoot,
+		const TArray<FAssetData>& Assets,
+		int32 MaxAssetRows,
+		const FHCIPlannerEnvRelevanceQuery& Relevance,
+		FHCIAgentPlannerEnvSnapshot& OutSnapshot);
+
+	bool GetSnapshot(
+		const FString& ScanRoot,
+		const FString& UserText,
+		int32 MaxAssetRows,
+		FHCIAgentPlannerEnvSnapshot& OutSnapshot,
+		FString& OutError);
+	void Invalidate();
+	void Shutdown();
+
+	uint64 GetGeneration() const { return Generation; }
+	int32 GetQueryCount() const { return QueryCount; }
+
+private:
+	struct FCachedSnapshot
+	{
+		uint64 Generation = 0;
+		int32 MaxAssetRows = 0;
+		bool bRelevanceRanked = false;
+		FHCIAgentPlannerEnvSnapshot Snapshot;
+	};
+
+	void EnsureBoundToAssetRegistry();
+	void BumpGeneration() { ++Generation; }
+
+	// Keyed by scan root and relevance query.
+	TMap<FString, FCachedSnapshot> CacheByRoot;
+	uint64 Generation = 1;
+	int32 QueryCount = 0;
+
+	bool bBoundToAssetRegistry = false;
+	FDelegateHandle AssetAddedHandle;
+	FDelegateHandle AssetRemovedHandle;
+	FDelegateHandle AssetRenamedHandle;
+	FDelegateHandle AssetUpdatedHandle;
+};
@@ -0,0 +1,585 @@
+#include "Commands/HCISyntheticFixtureGenerator.h"
+
+#include "HCIAsset.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Dom/JsonObject.h"
+#include "Engine/StaticMesh.h"
+#include "HAL/FileManager.h"
+#include "Math/RandomStream.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogHCISyntheticFixture, Log, All);
+
+namespace
+{
+// Tables below are kept in sync with SourceData/AbilityKits/Python/hci_generate_synthetic_assets.py.
+static const TCHAR* const HCIAssetTypes[] = {TEXT("StaticMesh"), TEXT("Sound"), TEXT("VFX")};
+static const float HCIAssetTypeWeights[] = {0.35f, 0.2f, 0.45f};
+static const TCHAR* const HCIThemes[] = {TEXT("fire"), TEXT("ice"), TEXT("forest")};
+static const float HCIThemeWeights[] = {0.38f, 0.3f, 0.32f};
+
+static const TCHAR* const HCIThemeKeywords[][5] = {
+	{TEXT("fire"), TEXT("flame"), TEXT("burn"), TEXT("ember"), TEXT("inferno")},
+	{TEXT("ice"), TEXT("frost"), TEXT("chill"), TEXT("blizzard"), TEXT("glacier")},
+	{TEXT("forest"), TEXT("nature"), TEXT("jungle"), TEXT("grove"), TEXT("vine")}};
+static const TCHAR* const HCIThemeAliases[][5] = {
+	{TEXT("Red Lotus"), TEXT("Crimson Bloom"), TEXT("Solar Petal"), TEXT("Ash Crown"), TEXT("Scarlet Arc")},
+	{TEXT("Silent Mirror"), TEXT("Pale Prism"), TEXT("Moon Glass"), TEXT("White Shard"), TEXT("Crystal Halo")},
+	{TEXT("Verdant Echo"), TEXT("Green Ward"), TEXT("Canopy Whisper"), TEXT("Leaf Oath"), TEXT("Woodland Pulse")}};
+static const TCHAR* const HCIGapSuffixes[] = {TEXT("Prime"), TEXT("Core"), TEXT("MKII"), TEXT("Variant"), TEXT("Node")};
+static const TCHAR* const HCINounsByType[][6] = {
+	{TEXT("Blade"), TEXT("Totem"), TEXT("Shrine"), TEXT("Orb"), TEXT("Spear"), TEXT("Crown")},
+	{TEXT("Pulse"), TEXT("Chime"), TEXT("Echo"), TEXT("Hum"), TEXT("Roar"), TEXT("Resonance")},
+	{TEXT("Burst"), TEXT("Nova"), TEXT("Trail"), TEXT("Wave"), TEXT("Field"), TEXT("Spark")}};
+static const TCHAR* const HCIScenesByTheme[][3] = {
+	{TEXT("boss phase two"), TEXT("arena"), TEXT("volcanic gate")},
+	{TEXT("frozen keep"), TEXT("control corridor"), TEXT("defense lane")},
+	{TEXT("forest map"), TEXT("jungle route"), TEXT("woodland mission")}};
+static const TCHAR* const HCIDescriptionPatterns[] = {
+	TEXT("Designed for {scene} encounters, this asset channels {kw} behavior in controlled bursts."),
+	TEXT("Used in combat prototypes, it emits {kw} cues and supports layered gameplay feedback."),
+	TEXT("The implementation emphasizes {kw} readability and stable tuning for production maps."),
+	TEXT("It is authored for client-side toolchain tests and references {kw} semantics explicitly.")};
+static const TCHAR* const HCIThemeTags[][3] = {
+	{TEXT("element:fire"), TEXT("status:burn"), TEXT("theme:aggressive")},
+	{TEXT("element:ice"), TEXT("status:slow"), TEXT("theme:control")},
+	{TEXT("element:forest"), TEXT("status:root"), TEXT("theme:sustain")}};
+static const TCHAR* const HCITypeTags[][2] = {
+	{TEXT("class:mesh"), TEXT("pipeline:render")},
+	{TEXT("class:audio"), TEXT("pipeline:acoustics")},
+	{TEXT("class:vfx"), TEXT("pipeline:fx")}};
+static const TCHAR* const HCITypeSegments[] = {TEXT("Meshes"), TEXT("Audio"), TEXT("VFX")};
+static const TCHAR* const HCIQualitySegments[] = {TEXT("Gameplay"), TEXT("Hero"), TEXT("Shared")};
+static const float HCISizeBaseByType[] = {2.4f, 1.2f, 1.9f};
+static const float HCIDamageRangeByTheme[][2] = {{180.0f, 520.0f}, {120.0f, 340.0f}, {70.0f, 260.0f}};
+
+struct FHCISemanticTrapTemplate
+{
+	const TCHAR* Name;
+	const TCHAR* Description;
+	const TCHAR* StyleTag;
+};
+static const FHCISemanticTrapTemplate HCISemanticTraps[] = {
+	{TEXT("Ice_Sword"), TEXT("A physical sword with a cold look, deals physical damage and is not elemental."), TEXT("style:cold")},
+	{TEXT("Fire_Bark_Shield"), TEXT("A wooden defensive prop from forest kits, not elemental, tuned for physical collisions."), TEXT("style:hot")},
+	{TEXT("Forest_Frost_Bell"), TEXT("An audio cue named for art direction only; it is not elemental and drives neutral ambience."), TEXT("style:organic")}};
+
+struct FHCIPerformanceTrapTemplate
+{
+	const TCHAR* Name;
+	const TCHAR* Description;
+	const TCHAR* VirtualPath;
+	int32 TriangleCount;
+};
+static const FHCIPerformanceTrapTemplate HCIPerformanceTraps[] = {
+	{TEXT("Small_Rock"), TEXT("A tiny rock prop intended for low-poly set dressing, but this version is over-detailed."), TEXT("/Game/Art/Env/LowPoly/Rocks/"), 100000},
+	{TEXT("Pebble_Cluster"), TEXT("A pebble cluster designed for distant background usage, but geometry budget is abnormally high."), TEXT("/Game/Art/Env/LowPoly/Pebbles/"), 85000},
+	{TEXT("Sapling_LowPoly"), TEXT("A sapling expected to be cheap filler in low-poly biome sets, but triangle count is extreme."), TEXT("/Game/Art/Env/LowPoly/Trees/"), 120000}};
+
+constexpr int32 HCIForestTheme = 2;
+constexpr int32 HCIStaticMeshType = 0;
+constexpr int32 HCISoundType = 1;
+constexpr int32 HCIVfxType = 2;
+
+template <typename T, int32 N>
+static int32 HCI_PickIndex(FRandomStream& Stream, const T (&)[N])
+{
+	return Stream.RandRange(0, N - 1);
+}
+
+template <int32 N>
+static int32 HCI_PickWeighted(FRandomStream& Stream, const float (&Weights)[N])
+{
+	float Total = 0.0f;
+	for (const float Weight : Weights)
+	{
+		Total += Weight;
+	}
+	float Roll = Stream.GetFraction() * Total;
+	for (int32 Index = 0; Index < N; ++Index)
+	{
+		Roll -= Weights[Index];
+		if (Roll < 0.0f)
+		{
+			return Index;
+		}
+	}
+	return N - 1;
+}
+
+static float HCI_Uniform2(FRandomStream& Stream, const float Low, const float High)
+{
+	return FMath::RoundToFloat(Stream.FRandRange(Low, High) * 100.0f) / 100.0f;
+}
+
+static FString HCI_TitleCase(const FString& Word)
+{
+	return Word.IsEmpty() ? Word : Word.Left(1).ToUpper() + Word.Mid(1);
+}
+
+static FString HCI_SanitizeId(const FString& Text)
+{
+	FString Out;
+	Out.Reserve(Text.Len());
+	bool bPendingUnderscore = false;
+	for (const TCHAR Ch : Text.ToLower())
+	{
+		if (FChar::IsAlnum(Ch) && Ch < 128)
+		{
+			if (bPendingUnderscore && !Out.IsEmpty())
+			{
+				Out.AppendChar(TEXT('_'));
+			}
+			bPendingUnderscore = false;
+			Out.AppendChar(Ch);
+		}
+		else
+		{
+			bPendingUnderscore = true;
+		}
+	}
+	return Out.IsEmpty() ? FString(TEXT("asset")) : Out;
+}
+
+static int32 HCI_TriangleCount(FRandomStream& Stream, const int32 TypeIndex)
+{
+	if (TypeIndex == HCISoundType)
+	{
+		return 0;
+	}
+	if (TypeIndex == HCIVfxType)
+	{
+		return FMath::RoundToInt(Stream.FRandRange(80.0f, 3500.0f));
+	}
+	return FMath::RoundToInt(Stream.FRandRange(300.0f, 18000.0f));
+}
+
+static void HCI_FillParams(FRandomStream& Stream, FHCISyntheticAssetRecord& Record, const int32 ThemeIndex, const int32 TypeIndex, const bool bTrap, const int32 TriangleOverride)
+{
+	Record.Damage = bTrap
+		? HCI_Uniform2(Stream, 60.0f, 180.0f)
+		: HCI_Uniform2(Stream, HCIDamageRangeByTheme[ThemeIndex][0], HCIDamageRangeByTheme[ThemeIndex][1]);
+	Record.TriangleCountLod0 = TriangleOverride != INDEX_NONE ? TriangleOverride : HCI_TriangleCount(Stream, TypeIndex);
+	// Remaining params (size/radius/...) are not stored on UHCIAsset; draw them anyway to keep the stream aligned.
+	const float SizeBase = HCISizeBaseByType[TypeIndex];
+	Stream.FRandRange(SizeBase * 0.5f, SizeBase * 1.6f);
+	Stream.FRandRange(90.0f, 360.0f);
+	Stream.FRandRange(0.3f, 4.0f);
+	Stream.FRandRange(1.0f, 15.0f);
+	Stream.FRandRange(0.75f, 1.35f);
+	Stream.FRandRange(-14.0f, -1.0f);
+}
+
+static void HCI_FillTags(FHCISyntheticAssetRecord& Record, const int32 ThemeIndex, const int32 TypeIndex, const bool bGap, const TCHAR* TrapKind, std::initializer_list<const TCHAR*> ExtraTags)
+{
+	for (const TCHAR* Tag : HCIThemeTags[ThemeIndex])
+	{
+		Record.Tags.AddUnique(Tag);
+	}
+	for (const TCHAR* Tag : HCITypeTags[TypeIndex])
+	{
+		Record.Tags.AddUnique(Tag);
+	}
+	if (bGap)
+	{
+		Record.Tags.AddUnique(TEXT("semantic_gap"));
+	}
+	if (TrapKind)
+	{
+		Record.Tags.AddUnique(TEXT("trap"));
+		Record.Tags.AddUnique(FString::Printf(TEXT("trap:%s"), TrapKind));
+	}
+	for (const TCHAR* Tag : ExtraTags)
+	{
+		Record.Tags.AddUnique(Tag);
+	}
+	Record.Tags.Sort([](const FString& A, const FString& B) { return A.Compare(B, ESearchCase::CaseSensitive) < 0; });
+}
+
+static FString HCI_BuildVirtualPath(FRandomStream& Stream, const int32 ThemeIndex, const int32 TypeIndex)
+{
+	const TCHAR* Quality = HCIQualitySegments[HCI_PickIndex(Stream, HCIQualitySegments)];
+	return FString::Printf(TEXT("/Game/Art/%s/%s/%s/"), *HCI_TitleCase(HCIThemes[ThemeIndex]), Quality, HCITypeSegments[TypeIndex]);
+}
+
+static FHCISyntheticAssetRecord HCI_MakeRegular(FRandomStream& Stream, const int32 Index, const bool bGap)
+{
+	const int32 ThemeIndex = HCI_PickWeighted(Stream, HCIThemeWeights);
+	const int32 TypeIndex = HCI_PickWeighted(Stream, HCIAssetTypeWeights);
+
+	FHCISyntheticAssetRecord Record;
+	Record.Type = HCIAssetTypes[TypeIndex];
+	if (bGap)
+	{
+		const TCHAR* Alias = HCIThemeAliases[ThemeIndex][HCI_PickIndex(Stream, HCIThemeAliases[ThemeIndex])];
+		const TCHAR* Suffix = HCIGapSuffixes[HCI_PickIndex(Stream, HCIGapSuffixes)];
+		Record.DisplayName = FString::Printf(TEXT("%s %s"), Alias, Suffix);
+		Record.Id = HCI_SanitizeId(FString::Printf(TEXT("hci_gap_asset_%05d_%d"), Index, Stream.RandRange(100, 999)));
+	}
+	else
+	{
+		const FString Keyword = HCI_TitleCase(HCIThemeKeywords[ThemeIndex][HCI_PickIndex(Stream, HCIThemeKeywords[ThemeIndex])]);
+		const TCHAR* Noun = HCINounsByType[TypeIndex][HCI_PickIndex(Stream, HCINounsByType[TypeIndex])];
+		switch (Stream.RandRange(0, 2))
+		{
+		case 0: Record.DisplayName = FString::Printf(TEXT("%s_%s"), *Keyword, Noun); break;
+		case 1: Record.DisplayName = FString::Printf(TEXT("%s %s"), *Keyword, Noun); break;
+		default: Record.DisplayName = FString::Printf(TEXT("%s of %s"), Noun, *Keyword); break;
+		}
+		Record.Id = HCI_SanitizeId(FString::Printf(TEXT("hci_%s_%s_%05d"), HCIThemes[ThemeIndex], HCIAssetTypes[TypeIndex], Index));
+	}
+
+	const TCHAR* Keyword = HCIThemeKeywords[ThemeIndex][HCI_PickIndex(Stream, HCIThemeKeywords[ThemeIndex])];
+	FString Sentence = HCIDescriptionPatterns[HCI_PickIndex(Stream, HCIDescriptionPatterns)];
+	Sentence.ReplaceInline(TEXT("{kw}"), Keyword);
+	Sentence.ReplaceInline(TEXT("{scene}"), HCIScenesByTheme[ThemeIndex][HCI_PickIndex(Stream, HCIScenesByTheme[ThemeIndex])]);
+	Record.Description = FString::Printf(
+		TEXT("%s Tags and params are curated for retrieval and audit benchmarks where %s meaning must be inferred from long-form text."),
+		*Sentence,
+		Keyword);
+
+	HCI_FillParams(Stream, Record, ThemeIndex, TypeIndex, false, INDEX_NONE);
+	HCI_FillTags(Record, ThemeIndex, TypeIndex, bGap, nullptr, {});
+	Record.VirtualPath = HCI_BuildVirtualPath(Stream, ThemeIndex, TypeIndex);
+	return Record;
+}
+
+static FHCISyntheticAssetRecord HCI_MakeSemanticTrap(FRandomStream& Stream, const int32 Index)
+{
+	const int32 TypeIndex = HCI_PickWeighted(Stream, HCIAssetTypeWeights);
+	const FHCISemanticTrapTemplate& Template = HCISemanticTraps[HCI_PickIndex(Stream, HCISemanticTraps)];
+
+	FHCISyntheticAssetRecord Record;
+	Record.Type = HCIAssetTypes[TypeIndex];
+	Record.DisplayName = FString::Printf(TEXT("%s_%05d"), Template.Name, Index);
+	Record.Id = HCI_SanitizeId(FString::Printf(TEXT("hci_trap_sem_%s"), *Record.DisplayName));
+	Record.Description = Template.Description;
+	HCI_FillParams(Stream, Record, HCIForestTheme, TypeIndex, true, INDEX_NONE);
+	HCI_FillTags(Record, HCIForestTheme, TypeIndex, false, TEXT("semantic"), {TEXT("misleading_name"), TEXT("actual:physical"), Template.StyleTag});
+	Record.VirtualPath = HCI_BuildVirtualPath(Stream, HCIForestTheme, TypeIndex);
+	return Record;
+}
+
+static FHCISyntheticAssetRecord HCI_MakePerformanceTrap(FRandomStream& Stream, const int32 Index)
+{
+	const FHCIPerformanceTrapTemplate& Template = HCIPerformanceTraps[HCI_PickIndex(Stream, HCIPerformanceTraps)];
+
+	FHCISyntheticAssetRecord Record;
+	Record.Type = HCIAssetTypes[HCIStaticMeshType];
+	Record.DisplayName = FString::Printf(TEXT("%s_%05d"), Template.Name, Index);
+	Record.Id = HCI_SanitizeId(FString::Printf(TEXT("hci_trap_perf_%s"), *Record.DisplayName));
+	Record.VirtualPath = Template.VirtualPath;
+	HCI_FillParams(Stream, Record, HCIForestTheme, HCIStaticMeshType, true, Template.TriangleCount);
+	Record.Description = FString::Printf(
+		TEXT("%s It is categorized as low-poly, but LOD0 triangle count is %d, which should trigger performance mismatch auditing."),
+		Template.Description,
+		Template.TriangleCount);
+	HCI_FillTags(Record, HCIForestTheme, HCIStaticMeshType, false, TEXT("performance"), {TEXT("expected:lowpoly"), TEXT("actual:highpoly")});
+	return Record;
+}
+
+static FString HCI_RecordPackagePath(const FString& TargetRoot, const FHCISyntheticAssetRecord& Record)
+{
+	// Virtual paths are /Game-relative; re-root them so fixtures keep their folder fan-out under TargetRoot.
+	FString Relative = Record.VirtualPath;
+	Relative.RemoveFromStart(TEXT("/Game"));
+	Relative.RemoveFromEnd(TEXT("/"));
+	return TargetRoot + Relative;
+}
+} // namespace
+
+bool FHCISyntheticFixtureGenerator::TryParseCountPreset(const FString& Text, int32& OutCount)
+{
+	const FString Trimmed = Text.TrimStartAndEnd().ToLower();
+	if (Trimmed == TEXT("1k"))
+	{
+		OutCount = 1000;
+		return true;
+	}
+	if (Trimmed == TEXT("10k"))
+	{
+		OutCount = 10000;
+		return true;
+	}
+	if (Trimmed == TEXT("100k"))
+	{
+		OutCount = 100000;
+		return true;
+	}
+	int32 Parsed = 0;
+	if (LexTryParseString(Parsed, *Trimmed) && Parsed > 0)
+	{
+		OutCount = Parsed;
+		return true;
+	}
+	return false;
+}
+
+FString FHCISyntheticFixtureGenerator::MakeDefaultRoot(const int32 Count, const int32 Seed)
+{
+	return FString::Printf(TEXT("%s/Synthetic_%d_s%d"), SyntheticRoot, Count, Seed);
+}
+
+bool FHCISyntheticFixtureGenerator::LoadSeedMeshManifest(const FString& ManifestPath, TArray<FString>& OutObjectPaths, FString& OutError)
+{
+	OutObjectPaths.Reset();
+	FString JsonText;
+	if (!FFileHelper::LoadFileToString(JsonText, *ManifestPath))
+	{
+		OutError = FString::Printf(TEXT("seed_mesh_manifest_unreadable path=%s"), *ManifestPath);
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> Root;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonText);
+	const TArray<TSharedPtr<FJsonValue>>* Entries = nullptr;
+	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid() || !Root->TryGetArrayField(TEXT("entries"), Entries))
+	{
+		OutError = FString::Printf(TEXT("seed_mesh_manifest_invalid path=%s"), *ManifestPath);
+		return false;
+	}
+
+	for (const TSharedPtr<FJsonValue>& Entry : *Entries)
+	{
+		const TSharedPtr<FJsonObject>* EntryObject = nullptr;
+		FString ObjectPath;
+		if (Entry.IsValid() && Entry->TryGetObject(EntryObject) && (*EntryObject)->TryGetStringField(TEXT("object_path"), ObjectPath)
+			&& ObjectPath.StartsWith(TEXT("/Game/")) && FPackageName::IsValidObjectPath(ObjectPath))
+		{
+			OutObjectPaths.AddUnique(ObjectPath);
+		}
+	}
+	return true;
+}
+
+bool FHCISyntheticFixtureGenerator::BuildDataset(const FHCISyntheticFixtureOptions& Options, TArray<FHCISyntheticAssetRecord>& OutRecords, FString& OutError)
+{
+	OutRecords.Reset();
+	if (Options.Count <= 0)
+	{
+		OutError = TEXT("count must be > 0");
+		return false;
+	}
+	if (Options.SemanticGapRatio < 0.0f || Options.TrapRatio < 0.0f || Options.SemanticGapRatio + Options.TrapRatio > 1.0f)
+	{
+		OutError = TEXT("semantic_gap_ratio/trap_ratio must be within [0,1] and sum to <= 1");
+		return false;
+	}
+
+	FRandomStream Stream(Options.Seed);
+	TArray<int32> Shuffled;
+	Shuffled.SetNumUninitialized(Options.Count);
+	for (int32 Index = 0; Index < Options.Count; ++Index)
+	{
+		Shuffled[Index] = Index;
+	}
+	for (int32 Index = Options.Count - 1; Index > 0; --Index)
+	{
+		Shuffled.Swap(Index, Stream.RandRange(0, Index));
+	}
+
+	// 0 = regular, 1 = semantic gap, 2 = semantic trap, 3 = performance trap.
+	TArray<uint8> Kinds;
+	Kinds.SetNumZeroed(Options.Count);
+	const int32 GapTarget = FMath::RoundToInt(Options.Count * Options.SemanticGapRatio);
+	const int32 TrapTarget = FMath::RoundToInt(Options.Count * Options.TrapRatio);
+	const int32 PerfTrapTarget = TrapTarget / 2;
+	for (int32 Rank = 0; Rank < FMath::Min(Options.Count, GapTarget + TrapTarget); ++Rank)
+	{
+		Kinds[Shuffled[Rank]] = Rank < GapTarget ? 1 : (Rank < GapTarget + PerfTrapTarget ? 3 : 2);
+	}
+
+	OutRecords.Reserve(Options.Count);
+	for (int32 Index = 0; Index < Options.Count; ++Index)
+	{
+		switch (Kinds[Index])
+		{
+		case 3: OutRecords.Add(HCI_MakePerformanceTrap(Stream, Index)); break;
+		case 2: OutRecords.Add(HCI_MakeSemanticTrap(Stream, Index)); break;
+		default: OutRecords.Add(HCI_MakeRegular(Stream, Index, Kinds[Index] == 1)); break;
+		}
+		if (Options.RepresentingMeshPool.Num() > 0)
+		{
+			OutRecords.Last().RepresentingMesh = Options.RepresentingMeshPool[Stream.RandRange(0, Options.RepresentingMeshPool.Num() - 1)];
+		}
+	}
+	return true;
+}
+
+uint32 FHCISyntheticFixtureGenerator::ComputeDatasetDigest(const TArray<FHCISyntheticAssetRecord>& Records)
+{
+	uint32 Crc = 0;
+	for (const FHCISyntheticAssetRecord& Record : Records)
+	{
+		Crc = FCrc::StrCrc32(*Record.Id, Crc);
+		Crc = FCrc::StrCrc32(*Record.VirtualPath, Crc);
+		Crc = FCrc::StrCrc32(*Record.RepresentingMesh, Crc);
+		Crc = FCrc::MemCrc32(&Record.Damage, sizeof(Record.Damage), Crc);
+		Crc = FCrc::MemCrc32(&Record.TriangleCountLod0, sizeof(Record.TriangleCountLod0), Crc);
+	}
+	return Crc;
+}
+
+int32 FHCISyntheticFixtureGenerator::CreateAssetBatch(const FString& TargetRoot, TConstArrayView<FHCISyntheticAssetRecord> Records, TArray<UPackage*>& OutPackages)
+{
+	int32 CreatedCount = 0;
+	for (const FHCISyntheticAssetRecord& Record : Records)
+	{
+		const FString PackageName = FString::Printf(TEXT("%s/%s"), *HCI_RecordPackagePath(TargetRoot, Record), *Record.Id);
+		if (FindPackage(nullptr, *PackageName))
+		{
+			UE_LOG(LogHCISyntheticFixture, Warning, TEXT("[HCI][SyntheticFixture] skip_existing package=%s"), *PackageName);
+			continue;
+		}
+
+		UPackage* Package = CreatePackage(*PackageName);
+		UHCIAsset* Asset = NewObject<UHCIAsset>(Package, FName(*Record.Id), RF_Public | RF_Standalone | RF_Transactional);
+		Asset->SchemaVersion = 1;
+		Asset->Id = Record.Id;
+		Asset->DisplayName = Record.DisplayName;
+		Asset->Damage = Record.Damage;
+		Asset->TriangleCountLod0Expected = Record.TriangleCountLod0;
+		if (!Record.RepresentingMesh.IsEmpty())
+		{
+			Asset->RepresentingMesh = TSoftObjectPtr<UStaticMesh>(FSoftObjectPath(Record.RepresentingMesh));
+		}
+
+		FAssetRegistryModule::AssetCreated(Asset);
+		Package->MarkPackageDirty();
+		OutPackages.Add(Package);
+		++CreatedCount;
+	}
+	return CreatedCount;
+}
+
+int32 FHCISyntheticFixtureGenerator::SavePackageBatch(TConstArrayView<UPackage*> Packages)
+{
+	FSavePackageArgs SaveArgs;
+	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+	// Serialization stays on the game thread; file writes run on the async writer and are flushed once per batch.
+	SaveArgs.SaveFlags = SAVE_Async | SAVE_NoError;
+	SaveArgs.Error = GWarn;
+
+	int32 SavedCount = 0;
+	for (UPackage* Package : Packages)
+	{
+		if (!Package)
+		{
+			continue;
+		}
+		const FString Filename = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
+		if (UPackage::SavePackage(Package, nullptr, *Filename, SaveArgs))
+		{
+			++SavedCount;
+		}
+		else
+		{
+			UE_LOG(LogHCISyntheticFixture, Warning, TEXT("[HCI][SyntheticFixture] save_failed package=%s"), *Package->GetName());
+		}
+	}
+	UPackage::WaitForAsyncFileWrites();
+	return SavedCount;
+}
+
+bool FHCISyntheticFixtureGenerator::Generate(
+	const FHCISyntheticFixtureOptions& Options,
+	TArray<FHCISyntheticAssetRecord>& OutRecords,
+	FHCISyntheticFixtureStats& OutStats,
+	FString& OutError)
+{
+	OutStats = FHCISyntheticFixtureStats();
+	if (!BuildDataset(Options, OutRecords, OutError))
+	{
+		return false;
+	}
+
+	const FString TargetRoot = Options.TargetRoot.IsEmpty() ? MakeDefaultRoot(Options.Count, Options.Seed) : Options.TargetRoot;
+	const int32 BatchSize = FMath::Max(1, Options.BatchSize);
+	TArray<UPackage*> BatchPackages;
+	BatchPackages.Reserve(BatchSize);
+	for (int32 Begin = 0; Begin < OutRecords.Num(); Begin += BatchSize)
+	{
+		const int32 Num = FMath::Min(BatchSize, OutRecords.Num() - Begin);
+		BatchPackages.Reset();
+
+		const double CreateStart = FPlatformTime::Seconds();
+		OutStats.CreatedCount += CreateAssetBatch(TargetRoot, MakeArrayView(OutRecords).Slice(Begin, Num), BatchPackages);
+		const double SaveStart = FPlatformTime::Seconds();
+		OutStats.SavedCount += SavePackageBatch(BatchPackages);
+		OutStats.CreateMs += (SaveStart - CreateStart) * 1000.0;
+		OutStats.SaveMs += (FPlatformTime::Seconds() - SaveStart) * 1000.0;
+		++OutStats.BatchCount;
+	}
+	return true;
+}
+
+bool FHCISyntheticFixtureGenerator::WriteReport(
+	const FHCISyntheticFixtureOptions& Options,
+	const FString& TargetRoot,
+	const TArray<FHCISyntheticAssetRecord>& Records,
+	const FHCISyntheticFixtureStats& Stats,
+	FString& OutReportPath)
+{
+	int32 GapCount = 0;
+	int32 TrapCount = 0;
+	int32 PerfTrapCount = 0;
+	int32 HighTriangleCount = 0;
+	int32 MeshAssignedCount = 0;
+	TMap<FString, int32> TypeHistogram;
+	for (const TCHAR* Type : HCIAssetTypes)
+	{
+		TypeHistogram.Add(Type, 0);
+	}
+	for (const FHCISyntheticAssetRecord& Record : Records)
+	{
+		GapCount += Record.Tags.Contains(TEXT("semantic_gap")) ? 1 : 0;
+		TrapCount += Record.Tags.Contains(TEXT("trap")) ? 1 : 0;
+		PerfTrapCount += Record.Tags.Contains(TEXT("trap:performance")) ? 1 : 0;
+		HighTriangleCount += Record.TriangleCountLod0 >= 50000 ? 1 : 0;
+		MeshAssignedCount += Record.RepresentingMesh.IsEmpty() ? 0 : 1;
+		++TypeHistogram.FindOrAdd(Record.Type);
+	}
+
+	TSharedPtr<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetStringField(TEXT("target_root"), TargetRoot);
+	Root->SetNumberField(TEXT("count"), Records.Num());
+	Root->SetNumberField(TEXT("seed"), Options.Seed);
+	Root->SetNumberField(TEXT("semantic_gap_ratio_target"), Options.SemanticGapRatio);
+	Root->SetNumberField(TEXT("semantic_gap_count"), GapCount);
+	Root->SetNumberField(TEXT("trap_ratio_target"), Options.TrapRatio);
+	Root->SetNumberField(TEXT("trap_count"), TrapCount);
+	Root->SetNumberField(TEXT("performance_trap_count"), PerfTrapCount);
+	Root->SetNumberField(TEXT("high_triangle_asset_count"), HighTriangleCount);
+	Root->SetNumberField(TEXT("seed_mesh_pool_size"), Options.RepresentingMeshPool.Num());
+	Root->SetNumberField(TEXT("representing_mesh_assigned_count"), MeshAssignedCount);
+	Root->SetStringField(TEXT("dataset_digest"), FString::Printf(TEXT("%08x"), ComputeDatasetDigest(Records)));
+	TSharedPtr<FJsonObject> Types = MakeShared<FJsonObject>();
+	for (const TPair<FString, int32>& Pair : TypeHistogram)
+	{
+		Types->SetNumberField(Pair.Key, Pair.Value);
+	}
+	Root->SetObjectField(TEXT("asset_types"), Types);
+	Root->SetNumberField(TEXT("created_count"), Stats.CreatedCount);
+	Root->SetNumberField(TEXT("saved_count"), Stats.SavedCount);
+	Root->SetNumberField(TEXT("batch_count"), Stats.BatchCount);
+	Root->SetNumberField(TEXT("create_ms"), Stats.CreateMs);
+	Root->SetNumberField(TEXT("save_ms"), Stats.SaveMs);
+
+	FString JsonText;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonText);
+	FJsonSerializer::Serialize(Root.ToSharedRef(), Writer);
+
+	const FString OutDir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("HCI/TestFixtures/Synthetic"));
+	IFileManager::Get().MakeDirectory(*OutDir, true);
+	OutReportPath = FPaths::Combine(OutDir, FString::Printf(TEXT("%s.json"), *FPaths::GetCleanFilename(TargetRoot)));
+	const bool bOk = FFileHelper::SaveStringToFile(JsonText, *OutReportPath);
+	UE_LOG(LogHCISyntheticFixture, Display, TEXT("[HCI][SyntheticFixture] wrote_report ok=%s path=%s"), bOk ? TEXT("true") : TEXT("false"), *OutReportPath);
+	return bOk;
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UPackage;
+
+// One generated record; mirrors the .hciabilitykit schema of hci_generate_synthetic_assets.py.
+struct FHCISyntheticAssetRecord
+{
+	FString Id;
+	FString DisplayName;
+	FString Type;
+	FString VirtualPath;
+	FString Description;
+	TArray<FString> Tags;
+	float Damage = 0.0f;
+	int32 TriangleCountLod0 = 0;
+	FString RepresentingMesh;
+};
+
+struct FHCISyntheticFixtureOptions
+{
+	int32 Count = 10000;
+	int32 Seed = 42;
+	float SemanticGapRatio = 0.3f;
+	float TrapRatio = 0.12f;
+	// Empty = MakeDefaultRoot(Count, Seed).
+	FString TargetRoot;
+	int32 BatchSize = 500;
+	TArray<FString> RepresentingMeshPool;
+};
+
+struct FHCISyntheticFixtureStats
+{
+	int32 CreatedCount = 0;
+	int32 SavedCount = 0;
+	int32 BatchCount = 0;
+	double CreateMs = 0.0;
+	double SaveMs = 0.0;
+};
+
+// Bulk UHCIAsset fixture generator for benchmark-scale projects. Records are derived from a seeded
+// FRandomStream, so the same (count, seed) always yields the same ids, tags and params. Assets are
+// created straight into new packages (no source load / DuplicateAsset) and saved per batch with async
+// file writes, flushing once per batch.
+class FHCISyntheticFixtureGenerator
+{
+public:
+	static constexpr const TCHAR* SyntheticRoot = TEXT("/Game/__HCI_Test/Bench");
+
+	static bool TryParseCountPreset(const FString& Text, int32& OutCount);
+	static FString MakeDefaultRoot(int32 Count, int32 Seed);
+	static bool LoadSeedMeshManifest(const FString& ManifestPath, TArray<FString>& OutObjectPaths, FString& OutError);
+
+	static bool BuildDataset(const FHCISyntheticFixtureOptions& Options, TArray<FHCISyntheticAssetRecord>& OutRecords, FString& OutError);
+	static uint32 ComputeDatasetDigest(const TArray<FHCISyntheticAssetRecord>& Records);
+
+	// Creates one UHCIAsset package per record and registers it with the AssetRegistry.
+	static int32 CreateAssetBatch(const FString& TargetRoot, TConstArrayView<FHCISyntheticAssetRecord> Records, TArray<UPackage*>& OutPackages);
+	static int32 SavePackageBatch(TConstArrayView<UPackage*> Packages);
+
+	// Blocking create + save of the whole dataset (commandlets / automation).
+	static bool Generate(
+		const FHCISyntheticFixtureOptions& Options,
+		TArray<FHCISyntheticAssetRecord>& OutRecords,
+		FHCISyntheticFixtureStats& OutStats,
+		FString& OutError);
+
+	static bool WriteReport(
+		const FHCISyntheticFixtureOptions& Options,
+		const FString& TargetRoot,
+		const TArray<FHCISyntheticAssetRecord>& Records,
+		const FHCISyntheticFixtureStats& Stats,
+		FString& OutReportPath);
+};
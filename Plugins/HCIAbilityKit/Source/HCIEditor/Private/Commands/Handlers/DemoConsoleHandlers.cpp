@@ -3,9 +3,13 @@
 #include "Commands/HCIAgentCommandHandlers.h"
 #include "Commands/HCIAgentDemoState.h"
 #include "Commands/HCIAgentExecutorReviewLocateUtils.h"
+#include "Commands/HCIPlannerEnvContextProvider.h"
+#include "AgentActions/HCIAgentToolActions.h"
+#include "AgentActions/Support/HCISessionResultCache.h"
 #include "UI/HCIAgentChatWindow.h"
 #include "UI/HCIAgentPlanPreviewWindow.h"
 
+#include "Agent/Executor/HCIAgentAuditLogWriter.h"
 #include "Agent/Executor/HCIAgentExecutionGate.h"
 #include "Agent/Contracts/StageF/HCIAgentApplyConfirmRequest.h"
 #include "Agent/Contracts/StageF/HCIAgentApplyConfirmRequestJsonSerializer.h"
@@ -42,6 +46,7 @@
 #include "Agent/Contracts/StageG/HCIAgentStageGExecutionReadinessReport.h"
 #include "Agent/Contracts/StageG/HCIAgentStageGExecutionReadinessReportJsonSerializer.h"
 #include "Agent/Executor/HCIAgentExecutor.h"
+#include "Agent/Executor/HCIAgentSpeculativeReadOnlyRun.h"
 #include "Agent/Bridges/HCIAgentExecutorApplyConfirmBridge.h"
 #include "Agent/Bridges/HCIAgentExecutorApplyRequestBridge.h"
 #include "Agent/Bridges/HCIAgentExecutorDryRunBridge.h"
@@ -72,9 +77,11 @@
 #include "AssetRegistry/AssetData.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Common/HCITimeFormat.h"
+#include "Common/HCITrace.h"
 #include "Dom/JsonObject.h"
 #include "EditorAssetLibrary.h"
 #include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
 #include "HttpModule.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Interfaces/IHttpResponse.h"
@@ -112,76 +119,6 @@ static FString HCI_JoinConsoleArgsAsText(const TArray<FString>& Args)
 	return Joined;
 }
 
-static int64 HCI_TryExtractAssetSizeFromTags(const FAssetData& AssetData)
-{
-	int64 SizeBytes = -1;
-	if (AssetData.GetTagValue(FName(TEXT("DiskSize")), SizeBytes))
-	{
-		return SizeBytes;
-	}
-	if (AssetData.GetTagValue(FName(TEXT("FileSize")), SizeBytes))
-	{
-		return SizeBytes;
-	}
-
-	FString SizeText;
-	if (AssetData.GetTagValue(FName(TEXT("DiskSize")), SizeText) && LexTryParseString(SizeBytes, *SizeText))
-	{
-		return SizeBytes;
-	}
-	if (AssetData.GetTagValue(FName(TEXT("FileSize")), SizeText) && LexTryParseString(SizeBytes, *SizeText))
-	{
-		return SizeBytes;
-	}
-	return -1;
-}
-
-static bool HCI_ScanAssetsForPlannerEnvContext(
-	const FString& ScanRoot,
-	TArray<FHCIAgentPlannerEnvAssetEntry>& OutAssets,
-	FString& OutError)
-{
-	OutAssets.Reset();
-	OutError.Reset();
-
-	FString SafeRoot = ScanRoot.TrimStartAndEnd();
-	if (SafeRoot.IsEmpty() || !SafeRoot.StartsWith(TEXT("/Game/")))
-	{
-		SafeRoot = TEXT("/Game/Temp");
-	}
-
-	const TArray<FString> AssetPaths = UEditorAssetLibrary::ListAssets(SafeRoot, true, false);
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
-	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-
-	OutAssets.Reserve(AssetPaths.Num());
-	for (const FString& ObjectPath : AssetPaths)
-	{
-		FHCIAgentPlannerEnvAssetEntry Entry;
-		Entry.ObjectPath = ObjectPath;
-
-		FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(ObjectPath));
-		if (AssetData.IsValid())
-		{
-			Entry.AssetClass = AssetData.AssetClassPath.GetAssetName().ToString();
-			Entry.SizeBytes = HCI_TryExtractAssetSizeFromTags(AssetData);
-		}
-		else
-		{
-			Entry.AssetClass = TEXT("Unknown");
-			Entry.SizeBytes = -1;
-		}
-
-		OutAssets.Add(MoveTemp(Entry));
-	}
-
-	OutAssets.Sort([](const FHCIAgentPlannerEnvAssetEntry& Lhs, const FHCIAgentPlannerEnvAssetEntry& Rhs)
-	{
-		return Lhs.ObjectPath < Rhs.ObjectPath;
-	});
-	return true;
-}
-
 static FString HCI_JsonObjectToCompactString(const TSharedPtr<FJsonObject>& JsonObject)
 {
 	if (!JsonObject.IsValid())
@@ -206,11 +143,6 @@ static FString HCI_GetAgentRbacMockConfigPath()
 		TEXT("agent_rbac_mock.json")));
 }
 
-static FString HCI_GetAgentExecAuditLogPath()
-{
-	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("HCI"), TEXT("Audit"), TEXT("agent_exec_log.jsonl"));
-}
-
 
 bool HCI_TryParseBool01Arg(const FString& InValue, bool& OutValue)
 {
@@ -823,6 +755,17 @@ struct FHCIAgentRbacMockUserConfigEntry
 	TArray<FString> AllowedCapabilities;
 };
 
+struct FHCIAgentRbacMockConfigCache
+{
+	bool bValid = false;
+	FString ConfigPath;
+	FDateTime ModificationTime;
+	int64 FileSize = -1;
+	TArray<FHCIAgentRbacMockUserConfigEntry> Entries;
+};
+
+static FHCIAgentRbacMockConfigCache GHCIAgentRbacMockConfigCache;
+
 struct FHCIAgentRbacResolvedUser
 {
 	FString UserName;
@@ -890,6 +833,20 @@ static bool HCI_LoadAgentRbacMockConfigEntries(
 		return false;
 	}
 
+	// Re-parse only when the file changed on disk; every RBAC-gated command goes through here.
+	FHCIAgentRbacMockConfigCache& Cache = GHCIAgentRbacMockConfigCache;
+	const FFileStatData ConfigStat = IFileManager::Get().GetStatData(*OutConfigPath);
+	if (Cache.bValid
+		&& ConfigStat.bIsValid
+		&& Cache.ConfigPath == OutConfigPath
+		&& Cache.ModificationTime == ConfigStat.ModificationTime
+		&& Cache.FileSize == ConfigStat.FileSize)
+	{
+		OutEntries = Cache.Entries;
+		return true;
+	}
+	Cache.bValid = false;
+
 	FString JsonText;
 	if (!FFileHelper::LoadFileToString(JsonText, *OutConfigPath))
 	{
@@ -959,6 +916,14 @@ static bool HCI_LoadAgentRbacMockConfigEntries(
 		}
 	}
 
+	if (ConfigStat.bIsValid)
+	{
+		Cache.ConfigPath = OutConfigPath;
+		Cache.ModificationTime = ConfigStat.ModificationTime;
+		Cache.FileSize = ConfigStat.FileSize;
+		Cache.Entries = OutEntries;
+		Cache.bValid = true;
+	}
 	return true;
 }
 
@@ -993,7 +958,8 @@ static bool HCI_AppendAgentExecAuditLogRecord(
 	FString& OutJsonLine,
 	FString& OutError)
 {
-	OutAuditLogPath = HCI_GetAgentExecAuditLogPath();
+	FHCIAgentAuditLogWriter& Writer = FHCIAgentAuditLogWriter::Get();
+	OutAuditLogPath = Writer.GetFilePath();
 	OutJsonLine.Reset();
 	OutError.Reset();
 
@@ -1002,26 +968,7 @@ static bool HCI_AppendAgentExecAuditLogRecord(
 		return false;
 	}
 
-	const FString Directory = FPaths::GetPath(OutAuditLogPath);
-	if (!IFileManager::Get().MakeDirectory(*Directory, true))
-	{
-		OutError = FString::Printf(TEXT("failed_to_create_audit_log_dir:%s"), *Directory);
-		return false;
-	}
-
-	const FString LineWithNewline = OutJsonLine + LINE_TERMINATOR;
-	if (!FFileHelper::SaveStringToFile(
-			LineWithNewline,
-			*OutAuditLogPath,
-			FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM,
-			&IFileManager::Get(),
-			FILEWRITE_Append))
-	{
-		OutError = FString::Printf(TEXT("failed_to_append_audit_log:%s"), *OutAuditLogPath);
-		return false;
-	}
-
-	return true;
+	return Writer.Append(OutJsonLine, OutError);
 }
 
 static void HCI_LogAgentRbacDecision(
@@ -1216,7 +1163,7 @@ void HCI_RunAbilityKitAgentRbacDemoCommand(const TArray<FString>& Args)
 			Display,
 			TEXT("[HCI][AgentRBAC] paths config_path=%s audit_log_path=%s config_created_default=%s"),
 			*ConfigPath,
-			LastAuditLogPath.IsEmpty() ? *HCI_GetAgentExecAuditLogPath() : *LastAuditLogPath,
+			LastAuditLogPath.IsEmpty() ? *FHCIAgentAuditLogWriter::GetDefaultFilePath() : *LastAuditLogPath,
 			bConfigCreated ? TEXT("true") : TEXT("false"));
 		UE_LOG(
 			LogHCIAgentDemo,
@@ -1430,7 +1377,7 @@ static FHCIAgentPlannerBuildOptions HCI_MakeRealHttpPlannerOptions()
 	PlannerOptions.LlmMockMode = EHCIAgentPlannerLlmMockMode::None;
 	PlannerOptions.LlmRetryCount = 1;
 	PlannerOptions.bEnableAutoEnvContextScan = true;
-	PlannerOptions.ScanAssetsForEnvContext = HCI_ScanAssetsForPlannerEnvContext;
+	PlannerOptions.ScanAssetsForEnvContext = &FHCIPlannerEnvContextProvider::ScanAssetsForPlannerEnvContext;
 	PlannerOptions.bLlmEnableThinking = false;
 	PlannerOptions.bLlmStream = false;
 	PlannerOptions.LlmHttpTimeoutMs = 30000;
@@ -1451,6 +1398,42 @@ static FHCIAgentPlanPreviewContext HCI_MakePlanPreviewContext(
 	return Context;
 }
 
+static TAutoConsoleVariable<int32> CVarHCIPlannerSpeculativeReadOnly(
+	TEXT("HCI.Planner.SpeculativeReadOnly"),
+	0,
+	TEXT("While a UI plan request waits for the LLM, pre-run the keyword plan's read-only scans (ScanAssets/SearchPath/ScanMeshTriangleCount) into the session result cache. 0=off, 1=on."),
+	ECVF_Default);
+
+// Keyword plan of the same text, speculated one read-only step per frame; null when disabled or nothing is speculable.
+static TSharedPtr<FHCIAgentSpeculativeReadOnlyRun> HCI_StartSpeculativeReadOnlyRun(
+	const FString& UserText,
+	const FString& RequestId,
+	const FHCIToolRegistry& ToolRegistry)
+{
+	if (CVarHCIPlannerSpeculativeReadOnly.GetValueOnGameThread() == 0)
+	{
+		return nullptr;
+	}
+
+	FHCIAgentPlan LikelyPlan;
+	FString RouteReason;
+	FString Error;
+	if (!FHCIAgentPlanner::BuildPlanFromNaturalLanguage(UserText, RequestId, ToolRegistry, LikelyPlan, RouteReason, Error))
+	{
+		return nullptr;
+	}
+
+	FHCIAgentExecutorOptions Options;
+	HCIAgentToolActions::BuildStageIDraftActions(Options.ToolActions);
+	Options.ReadOnlyResultCache = FHCISessionResultCache::Get();
+	TSharedPtr<FHCIAgentSpeculativeReadOnlyRun> Run = FHCIAgentSpeculativeReadOnlyRun::Create(LikelyPlan, ToolRegistry, Options);
+	if (Run.IsValid())
+	{
+		Run->StartTicking();
+	}
+	return Run;
+}
+
 static void HCI_LogAgentPlanWithProviderSummary(
 	const TCHAR* CaseName,
 	const FString& UserText,
@@ -1712,12 +1695,14 @@ bool HCI_RequestAgentPlanPreviewFromUi(
 	const FHCIToolRegistry& ToolRegistry = FHCIToolRegistry::GetReadOnly();
 	FHCIAgentPlannerBuildOptions PlannerOptions = HCI_MakeRealHttpPlannerOptions();
 	PlannerOptions.ExtraEnvContextText = ExtraEnvContextText;
+	const TSharedPtr<FHCIAgentSpeculativeReadOnlyRun> SpeculativeRun =
+		HCI_StartSpeculativeReadOnlyRun(SafeUserText, TEXT("req_cli_i1_preview_ui"), ToolRegistry);
 	FHCIAgentPlanner::BuildPlanFromNaturalLanguageWithProviderAsync(
 		SafeUserText,
 		TEXT("req_cli_i1_preview_ui"),
 		ToolRegistry,
 		PlannerOptions,
-			[SafeUserText, SafeSourceTag, bAutoOpenPreviewWindow, ToolRegistryPtr = &ToolRegistry, OnComplete = MoveTemp(OnComplete)](
+			[SafeUserText, SafeSourceTag, bAutoOpenPreviewWindow, ToolRegistryPtr = &ToolRegistry, SpeculativeRun, OnComplete = MoveTemp(OnComplete)](
 				bool bBuilt,
 				FHCIAgentPlan Plan,
 				FString RouteReason,
@@ -1725,6 +1710,18 @@ bool HCI_RequestAgentPlanPreviewFromUi(
 			FString Error) mutable
 		{
 			HCI_State().bRealLlmPlanCommandInFlight.Store(false);
+			if (SpeculativeRun.IsValid())
+			{
+				// Steps the real plan shares keep running (or are already cached); everything else is cancelled.
+				if (bBuilt)
+				{
+					SpeculativeRun->Reconcile(Plan);
+				}
+				else
+				{
+					SpeculativeRun->Cancel();
+				}
+			}
 			if (!bBuilt)
 			{
 				UE_LOG(
@@ -5162,8 +5159,60 @@ void HCI_RunAbilityKitAgentExecutePlanReviewPrepareSimHandoffEnvelopeJsonCommand
 	UE_LOG(LogHCIAgentDemo, Display, TEXT("%s"), *JsonText);
 }
 
+void HCI_RunAbilityKitTraceLatencyHistogramCommand(const TArray<FString>& Args)
+{
+	int32 LastRequestCount = 20;
+	if (Args.Num() > 0 && Args[0].Equals(TEXT("reset"), ESearchCase::IgnoreCase))
+	{
+		FHCIStageLatencyRecorder::Get().Reset();
+		UE_LOG(LogHCIAgentDemo, Display, TEXT("[HCI][TraceLatency] reset"));
+		return;
+	}
+	if (Args.Num() > 0 && (!LexTryParseString(LastRequestCount, *Args[0]) || LastRequestCount <= 0))
+	{
+		UE_LOG(LogHCIAgentDemo, Error, TEXT("[HCI][TraceLatency] invalid_args usage=HCI.TraceLatencyHistogram [last_n=20] [reset]"));
+		return;
+	}
 
+	TArray<FHCIStageLatencySummary> Summaries;
+	FHCIStageLatencyRecorder::Get().Summarize(LastRequestCount, Summaries);
 
+	const TConstArrayView<double> Bounds = FHCIStageLatencyRecorder::GetBucketUpperBoundsMs();
+	TArray<FString> BucketLabels;
+	for (const double Bound : Bounds)
+	{
+		BucketLabels.Add(FString::Printf(TEXT("<=%g"), Bound));
+	}
+	BucketLabels.Add(TEXT(">max"));
 
+	UE_LOG(
+		LogHCIAgentDemo,
+		Display,
+		TEXT("[HCI][TraceLatency] summary last_n=%d latest_request=%llu stages=%d buckets_ms=%s"),
+		LastRequestCount,
+		static_cast<unsigned long long>(FHCIStageLatencyRecorder::Get().GetLatestRequestSerial()),
+		Summaries.Num(),
+		*FString::Join(BucketLabels, TEXT(",")));
 
-
+	for (const FHCIStageLatencySummary& Summary : Summaries)
+	{
+		TArray<FString> Counts;
+		Counts.Reserve(Summary.BucketCounts.Num());
+		for (const int32 Count : Summary.BucketCounts)
+		{
+			Counts.Add(FString::FromInt(Count));
+		}
+		UE_LOG(
+			LogHCIAgentDemo,
+			Display,
+			TEXT("[HCI][TraceLatency] row stage=%s scope=%s samples=%d total_ms=%.3f p50_ms=%.3f p95_ms=%.3f max_ms=%.3f histogram=%s"),
+			*Summary.Stage,
+			Summary.bUnscoped ? TEXT("unscoped") : TEXT("request"),
+			Summary.SampleCount,
+			Summary.TotalMs,
+			Summary.P50Ms,
+			Summary.P95Ms,
+			Summary.MaxMs,
+			*FString::Join(Counts, TEXT(",")));
+	}
+}
@@ -1,6 +1,6 @@
 #include "Factories/HCIFactory.h"
 
-#include "Audit/HCIPreviewActor.h"
+#include "Audit/HCIPreviewRegistrySubsystem.h"
 #include "HCIAsset.h"
 #include "HCIErrorCodes.h"
 #include "Services/HCIParserService.h"
@@ -8,14 +8,12 @@
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "EditorFramework/AssetImportData.h"
 #include "Engine/StaticMesh.h"
-#include "Engine/World.h"
 #include "Framework/Notifications/NotificationManager.h"
 #include "Misc/FeedbackContext.h"
 #include "Misc/PackageName.h"
 #include "Misc/Paths.h"
 #include "Modules/ModuleManager.h"
 #include "Search/HCISearchIndexService.h"
-#include "UObject/UObjectIterator.h"
 #include "Widgets/Notifications/SNotificationList.h"
 
 // 静态日志分类定义
@@ -68,36 +66,9 @@ void RefreshPreviewActorsBoundToAsset(const UHCIAsset* ChangedAsset, const FStri
 		return;
 	}
 
-	int32 RefreshedActorCount = 0;
-	for (TObjectIterator<AHCIPreviewActor> It; It; ++It)
-	{
-		AHCIPreviewActor* PreviewActor = *It;
-		if (!IsValid(PreviewActor) || PreviewActor->HasAnyFlags(RF_ClassDefaultObject))
-		{
-			continue;
-		}
-
-		UWorld* World = PreviewActor->GetWorld();
-		if (!World)
-		{
-			continue;
-		}
-
-		if (World->WorldType != EWorldType::Editor
-			&& World->WorldType != EWorldType::EditorPreview
-			&& World->WorldType != EWorldType::PIE)
-		{
-			continue;
-		}
-
-		if (PreviewActor->AbilityAsset != ChangedAsset)
-		{
-			continue;
-		}
-
-		PreviewActor->RefreshPreview();
-		++RefreshedActorCount;
-	}
+	// Registry lookup by asset instead of walking every AHCIPreviewActor; meshes refresh on the next tick.
+	UHCIPreviewRegistrySubsystem* Registry = UHCIPreviewRegistrySubsystem::Get();
+	const int32 RefreshedActorCount = Registry ? Registry->RequestRefreshForAsset(ChangedAsset) : 0;
 
 	if (RefreshedActorCount > 0)
 	{
@@ -357,7 +328,7 @@ EReimportResult::Type UHCIFactory::Reimport(UObject* Obj)
 		ShowReimportFailureNotification(Asset, ErrorMsg);
 		return EReimportResult::Failed;
 	}
-	if (!ValidateRepresentingMeshPath(FilenameToLoad, ParsedData.RepresentingMeshPath, ParseError))
+	if (!ApplyReimportedData(Asset, FilenameToLoad, ParsedData, ParseError))
 	{
 		const FString ErrorMsg = ParseError.ToContractString();
 		UE_LOG(LogHCIFactory, Error, TEXT("Reimport failed: %s"), *ErrorMsg);
@@ -369,19 +340,52 @@ EReimportResult::Type UHCIFactory::Reimport(UObject* Obj)
 		return EReimportResult::Failed;
 	}
 
+	FHCISearchIndexService::Get().RefreshAsset(Asset);
+	return EReimportResult::Succeeded;
+#else
+	return EReimportResult::Failed;
+#endif
+}
+
+bool UHCIFactory::ApplyReimportedData(
+	UHCIAsset* Asset,
+	const FString& SourceFilename,
+	const FHCIParsedData& Parsed,
+	FHCIParseError& OutError)
+{
+#if WITH_EDITORONLY_DATA
+	if (!Asset || !Asset->AssetImportData)
+	{
+		OutError.Code = HCIErrorCodes::FileReadError;
+		OutError.File = SourceFilename;
+		OutError.Field = TEXT("asset");
+		OutError.Reason = TEXT("AssetImportData is missing");
+		OutError.Hint = TEXT("Re-create the asset by importing the source file");
+		return false;
+	}
+
+	if (!ValidateRepresentingMeshPath(SourceFilename, Parsed.RepresentingMeshPath, OutError))
+	{
+		return false;
+	}
+
 	// 修改资产前记录快照，以支持虚幻引擎的撤销（Undo）系统
 	Asset->Modify();
-	ApplyParsedToAsset(Asset, ParsedData);
-	Asset->AssetImportData->Update(FilenameToLoad);
+	ApplyParsedToAsset(Asset, Parsed);
+	Asset->AssetImportData->Update(SourceFilename);
 	Asset->MarkPackageDirty();
-	
+
 	// 通知编辑器资产已完成更改
 	Asset->PostEditChange();
-	FHCISearchIndexService::Get().RefreshAsset(Asset);
 	RefreshPreviewActorsBoundToAsset(Asset, TEXT("reimport"));
-	return EReimportResult::Succeeded;
+	return true;
 #else
-	return EReimportResult::Failed;
+	(void)Asset;
+	(void)Parsed;
+	OutError.Code = HCIErrorCodes::FileReadError;
+	OutError.File = SourceFilename;
+	OutError.Reason = TEXT("Reimport requires editor-only data");
+	return false;
 #endif
 }
 
@@ -0,0 +1,231 @@
+#include "Factories/HCIKitAutoReimportWatcher.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "DirectoryWatcherModule.h"
+#include "Factories/HCIKitReimportPipeline.h"
+#include "HCIAsset.h"
+#include "IDirectoryWatcher.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogHCIAutoReimport, Log, All);
+
+namespace
+{
+// Quiet period before a batch is flushed; editors often write a file in several steps.
+static constexpr double HCIAutoReimportDebounceSeconds = 0.5;
+static constexpr float HCIAutoReimportTickIntervalSeconds = 0.25f;
+
+static IDirectoryWatcher* HCI_GetDirectoryWatcher()
+{
+	FDirectoryWatcherModule& DirectoryWatcherModule = FModuleManager::LoadModuleChecked<FDirectoryWatcherModule>(TEXT("DirectoryWatcher"));
+	return DirectoryWatcherModule.Get();
+}
+
+static bool HCI_IsKitSourceFile(const FString& Filename)
+{
+	return FPaths::GetExtension(Filename).Equals(TEXT("hciabilitykit"), ESearchCase::IgnoreCase);
+}
+} // namespace
+
+FHCIKitAutoReimportWatcher& FHCIKitAutoReimportWatcher::Get()
+{
+	static FHCIKitAutoReimportWatcher Instance;
+	return Instance;
+}
+
+FString FHCIKitAutoReimportWatcher::NormalizeSourceKey(const FString& Filename)
+{
+	FString Key = FPaths::ConvertRelativePathToFull(Filename);
+	FPaths::NormalizeFilename(Key);
+	return Key;
+}
+
+void FHCIKitAutoReimportWatcher::Enable()
+{
+	if (bEnabled)
+	{
+		return;
+	}
+
+	bEnabled = true;
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	AssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FHCIKitAutoReimportWatcher::MarkSourceMapStale);
+	AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddLambda([this](const FAssetData& AssetData, const FString&) { MarkSourceMapStale(AssetData); });
+	AssetUpdatedHandle = AssetRegistry.OnAssetUpdated().AddRaw(this, &FHCIKitAutoReimportWatcher::MarkSourceMapStale);
+	RebuildSourceMap();
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateRaw(this, &FHCIKitAutoReimportWatcher::Tick),
+		HCIAutoReimportTickIntervalSeconds);
+
+	UE_LOG(
+		LogHCIAutoReimport,
+		Display,
+		TEXT("[HCI][AutoReimport] enabled sources=%d directories=%d"),
+		AssetPathBySourceFile.Num(),
+		WatchHandlesByDirectory.Num());
+}
+
+void FHCIKitAutoReimportWatcher::Disable()
+{
+	if (!bEnabled)
+	{
+		return;
+	}
+
+	bEnabled = false;
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	if (FModuleManager::Get().IsModuleLoaded(TEXT("AssetRegistry")))
+	{
+		IAssetRegistry& AssetRegistry = FModuleManager::GetModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+		AssetRegistry.OnAssetAdded().Remove(AssetAddedHandle);
+		AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+		AssetRegistry.OnAssetUpdated().Remove(AssetUpdatedHandle);
+	}
+
+	if (FModuleManager::Get().IsModuleLoaded(TEXT("DirectoryWatcher")))
+	{
+		if (IDirectoryWatcher* DirectoryWatcher = HCI_GetDirectoryWatcher())
+		{
+			for (const TPair<FString, FDelegateHandle>& Pair : WatchHandlesByDirectory)
+			{
+				DirectoryWatcher->UnregisterDirectoryChangedCallback_Handle(Pair.Key, Pair.Value);
+			}
+		}
+	}
+
+	WatchHandlesByDirectory.Reset();
+	AssetPathBySourceFile.Reset();
+	PendingSourceFiles.Reset();
+	bSourceMapStale = false;
+	UE_LOG(LogHCIAutoReimport, Display, TEXT("[HCI][AutoReimport] disabled"));
+}
+
+void FHCIKitAutoReimportWatcher::RebuildSourceMap()
+{
+	TArray<FHCIKitReimportSource> Sources;
+	FHCIKitReimportPipeline::CollectSourcesUnderPath(FString(), Sources);
+	bSourceMapStale = false;
+
+	AssetPathBySourceFile.Reset();
+	AssetPathBySourceFile.Reserve(Sources.Num());
+	TSet<FString> Directories;
+	for (const FHCIKitReimportSource& Source : Sources)
+	{
+		const FString Key = NormalizeSourceKey(Source.SourceFilename);
+		AssetPathBySourceFile.Add(Key, Source.AssetPath);
+		Directories.Add(FPaths::GetPath(Key));
+	}
+
+	IDirectoryWatcher* DirectoryWatcher = HCI_GetDirectoryWatcher();
+	if (!DirectoryWatcher)
+	{
+		UE_LOG(LogHCIAutoReimport, Warning, TEXT("[HCI][AutoReimport] directory watcher unavailable"));
+		return;
+	}
+
+	for (const FString& Directory : Directories)
+	{
+		if (WatchHandlesByDirectory.Contains(Directory) || !FPaths::DirectoryExists(Directory))
+		{
+			continue;
+		}
+
+		FDelegateHandle Handle;
+		if (DirectoryWatcher->RegisterDirectoryChangedCallback_Handle(
+				Directory,
+				IDirectoryWatcher::FDirectoryChanged::CreateRaw(this, &FHCIKitAutoReimportWatcher::HandleDirectoryChanged),
+				Handle))
+		{
+			WatchHandlesByDirectory.Add(Directory, Handle);
+		}
+	}
+}
+
+void FHCIKitAutoReimportWatcher::MarkSourceMapStale(const FAssetData& AssetData)
+{
+	if (AssetData.IsInstanceOf(UHCIAsset::StaticClass()))
+	{
+		bSourceMapStale = true;
+	}
+}
+
+void FHCIKitAutoReimportWatcher::HandleDirectoryChanged(const TArray<FFileChangeData>& FileChanges)
+{
+	for (const FFileChangeData& Change : FileChanges)
+	{
+		if (Change.Action == FFileChangeData::FCA_Removed || !HCI_IsKitSourceFile(Change.Filename))
+		{
+			continue;
+		}
+
+		PendingSourceFiles.Add(NormalizeSourceKey(Change.Filename));
+		LastChangeSeconds = FPlatformTime::Seconds();
+	}
+}
+
+bool FHCIKitAutoReimportWatcher::Tick(float DeltaTime)
+{
+	if (PendingSourceFiles.Num() > 0 && FPlatformTime::Seconds() - LastChangeSeconds >= HCIAutoReimportDebounceSeconds)
+	{
+		FlushPendingFiles();
+	}
+	return true;
+}
+
+void FHCIKitAutoReimportWatcher::FlushPendingFiles()
+{
+	const TSet<FString> ChangedFiles = MoveTemp(PendingSourceFiles);
+	PendingSourceFiles.Reset();
+
+	// A file we have not seen may belong to a kit imported since the map was built. Rescan at most once
+	// per flush, and only when the registry reported kit changes since the last scan.
+	int32 UnmappedFiles = 0;
+	for (const FString& File : ChangedFiles)
+	{
+		UnmappedFiles += AssetPathBySourceFile.Contains(File) ? 0 : 1;
+	}
+	if (UnmappedFiles > 0 && bSourceMapStale)
+	{
+		RebuildSourceMap();
+	}
+	UE_LOG(
+		LogHCIAutoReimport,
+		Verbose,
+		TEXT("[HCI][AutoReimport] flush changed=%d unmapped=%d"),
+		ChangedFiles.Num(),
+		UnmappedFiles);
+
+	const IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	TArray<FHCIKitReimportSource> Sources;
+	Sources.Reserve(ChangedFiles.Num());
+	for (const FString& File : ChangedFiles)
+	{
+		const FString* AssetPath = AssetPathBySourceFile.Find(File);
+		if (!AssetPath)
+		{
+			continue;
+		}
+
+		FHCIKitReimportSource Source;
+		const FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(*AssetPath));
+		if (AssetData.IsValid() && FHCIKitReimportPipeline::TryDescribeAssetData(AssetData, Source))
+		{
+			Sources.Add(MoveTemp(Source));
+		}
+	}
+
+	if (Sources.Num() == 0)
+	{
+		return;
+	}
+
+	FHCIKitReimportOptions Options;
+	Options.Trigger = TEXT("auto");
+	FHCIKitReimportPipeline::Run(Sources, Options);
+}
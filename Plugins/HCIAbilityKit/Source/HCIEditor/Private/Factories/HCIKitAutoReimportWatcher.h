@@ -0,0 +1,45 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+
+struct FAssetData;
+struct FFileChangeData;
+
+// Watches the source directories of every imported kit and feeds changed .hciabilitykit files into
+// FHCIKitReimportPipeline. Changes are debounced so an editor save or a VCS sync that touches many
+// files lands as one batch (and one search refresh) instead of one reimport per file event.
+class FHCIKitAutoReimportWatcher
+{
+public:
+	static FHCIKitAutoReimportWatcher& Get();
+
+	bool IsEnabled() const { return bEnabled; }
+	void Enable();
+	void Disable();
+
+	int32 GetWatchedDirectoryCount() const { return WatchHandlesByDirectory.Num(); }
+	int32 GetTrackedSourceCount() const { return AssetPathBySourceFile.Num(); }
+
+private:
+	void RebuildSourceMap();
+	void MarkSourceMapStale(const FAssetData& AssetData);
+	void HandleDirectoryChanged(const TArray<FFileChangeData>& FileChanges);
+	bool Tick(float DeltaTime);
+	void FlushPendingFiles();
+
+	static FString NormalizeSourceKey(const FString& Filename);
+
+	bool bEnabled = false;
+	// Set when a kit asset is added, renamed or updated; an unknown changed file only rescans the
+	// registry while the map is stale, so stray .hciabilitykit files never trigger repeated rebuilds.
+	bool bSourceMapStale = false;
+	FDelegateHandle AssetAddedHandle;
+	FDelegateHandle AssetRenamedHandle;
+	FDelegateHandle AssetUpdatedHandle;
+	TMap<FString, FString> AssetPathBySourceFile;
+	TMap<FString, FDelegateHandle> WatchHandlesByDirectory;
+	TSet<FString> PendingSourceFiles;
+	double LastChangeSeconds = 0.0;
+	FTSTicker::FDelegateHandle TickerHandle;
+};
@@ -0,0 +1,397 @@
+#include "Factories/HCIKitReimportPipeline.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/ParallelFor.h"
+#include "Common/HCITrace.h"
+#include "EditorFramework/AssetImportData.h"
+#include "Factories/HCIFactory.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "HAL/FileManager.h"
+#include "HCIAsset.h"
+#include "HCIErrorCodes.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+#include "Search/HCISearchIndexService.h"
+#include "Services/HCIParserService.h"
+#include "Widgets/Notifications/SNotificationList.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogHCIReimport, Log, All);
+
+namespace
+{
+// Failures beyond this are only in the summary count and the log.
+constexpr int32 HCIReimportMaxFailureNotifications = 3;
+
+struct FHCIKitParseSlot
+{
+	int32 SourceIndex = INDEX_NONE;
+	bool bParsed = false;
+	FHCIParsedData Parsed;
+	FHCIParseError Error;
+};
+
+static double HCI_MsSince(const double StartSeconds)
+{
+	return (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+}
+
+// Import data stores filenames relative to the package directory when it can; mirror that lookup
+// without loading the package, then fall back to the project directory like UHCIFactory::Reimport.
+static FString HCI_ResolveSourceFilename(const FString& RecordedFilename, const FString& PackageName)
+{
+	if (!FPaths::IsRelative(RecordedFilename))
+	{
+		return RecordedFilename;
+	}
+
+	FString PackageFilename;
+	if (FPackageName::TryConvertLongPackageNameToFilename(PackageName, PackageFilename))
+	{
+		const FString Candidate = FPaths::ConvertRelativePathToFull(FPaths::GetPath(PackageFilename), RecordedFilename);
+		if (FPaths::FileExists(Candidate))
+		{
+			return Candidate;
+		}
+	}
+	return FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), RecordedFilename);
+}
+
+static void HCI_AddFailure(FHCIKitReimportStats& Stats, const FString& AssetPath, const FString& Reason)
+{
+	++Stats.Failed;
+	Stats.Failures.Add(FString::Printf(TEXT("asset=%s %s"), *AssetPath, *Reason));
+	UE_LOG(LogHCIReimport, Error, TEXT("[HCI][Reimport] failed asset=%s %s"), *AssetPath, *Reason);
+}
+
+static void HCI_ShowReimportSummaryNotification(const FHCIKitReimportStats& Stats)
+{
+	const FText Message = FText::FromString(FString::Printf(
+		TEXT("HCI reimport: %d reimported, %d unchanged, %d failed"),
+		Stats.Reimported,
+		Stats.Unchanged,
+		Stats.Failed));
+
+	FNotificationInfo NotificationInfo(Message);
+	NotificationInfo.bFireAndForget = true;
+	NotificationInfo.ExpireDuration = Stats.Failed > 0 ? 6.0f : 3.0f;
+	NotificationInfo.FadeOutDuration = 0.2f;
+	NotificationInfo.bUseSuccessFailIcons = true;
+
+	const TSharedPtr<SNotificationItem> Notification = FSlateNotificationManager::Get().AddNotification(NotificationInfo);
+	if (Notification.IsValid())
+	{
+		Notification->SetCompletionState(Stats.Failed > 0 ? SNotificationItem::CS_Fail : SNotificationItem::CS_Success);
+	}
+}
+
+// Same shape as the per-asset notification UHCIFactory::Reimport shows, so a failed kit names its reason.
+static void HCI_ShowReimportFailureNotification(const FString& Failure)
+{
+	FNotificationInfo NotificationInfo(FText::FromString(FString::Printf(TEXT("Reimport failed: %s"), *Failure)));
+	NotificationInfo.bFireAndForget = true;
+	NotificationInfo.ExpireDuration = 6.0f;
+	NotificationInfo.FadeOutDuration = 0.2f;
+	NotificationInfo.bUseSuccessFailIcons = true;
+
+	const TSharedPtr<SNotificationItem> Notification = FSlateNotificationManager::Get().AddNotification(NotificationInfo);
+	if (Notification.IsValid())
+	{
+		Notification->SetCompletionState(SNotificationItem::CS_Fail);
+	}
+}
+
+static void HCI_NotifyIfNeeded(const FHCIKitReimportStats& Stats, const FHCIKitReimportOptions& Options)
+{
+	// Watcher-triggered batches that changed nothing stay silent; explicit requests always report.
+	if (Options.bShowNotification && (Stats.Reimported > 0 || Stats.Failed > 0 || Options.Trigger == TEXT("manual")))
+	{
+		HCI_ShowReimportSummaryNotification(Stats);
+		const int32 ShownFailures = FMath::Min(Stats.Failures.Num(), HCIReimportMaxFailureNotifications);
+		for (int32 Index = 0; Index < ShownFailures; ++Index)
+		{
+			HCI_ShowReimportFailureNotification(Stats.Failures[Index]);
+		}
+	}
+}
+} // namespace
+
+FString FHCIKitReimportStats::ToSummaryString() const
+{
+	return FString::Printf(
+		TEXT("requested=%d unchanged=%d hashed=%d parsed=%d reimported=%d failed=%d detect_ms=%.2f parse_ms=%.2f apply_ms=%.2f index_ms=%.2f total_ms=%.2f"),
+		Requested,
+		Unchanged,
+		Hashed,
+		Parsed,
+		Reimported,
+		Failed,
+		DetectMs,
+		ParseMs,
+		ApplyMs,
+		IndexMs,
+		TotalMs);
+}
+
+bool FHCIKitReimportPipeline::TryDescribeAsset(const UHCIAsset* Asset, FHCIKitReimportSource& OutSource)
+{
+#if WITH_EDITORONLY_DATA
+	if (!Asset || !Asset->AssetImportData)
+	{
+		return false;
+	}
+
+	const FAssetImportInfo& ImportInfo = Asset->AssetImportData->GetSourceData();
+	if (ImportInfo.SourceFiles.Num() < 1)
+	{
+		return false;
+	}
+
+	const FAssetImportInfo::FSourceFile& SourceFile = ImportInfo.SourceFiles[0];
+	OutSource.AssetPath = Asset->GetPathName();
+	OutSource.SourceFilename = Asset->AssetImportData->GetFirstFilename();
+	OutSource.RecordedTimestamp = SourceFile.Timestamp;
+	OutSource.RecordedHash = SourceFile.FileHash;
+	return !OutSource.SourceFilename.IsEmpty();
+#else
+	(void)Asset;
+	(void)OutSource;
+	return false;
+#endif
+}
+
+bool FHCIKitReimportPipeline::TryDescribeAssetData(const FAssetData& AssetData, FHCIKitReimportSource& OutSource)
+{
+	if (const UHCIAsset* LoadedAsset = Cast<UHCIAsset>(AssetData.FastGetAsset(false)))
+	{
+		return TryDescribeAsset(LoadedAsset, OutSource);
+	}
+
+#if WITH_EDITORONLY_DATA
+	FString ImportInfoJson;
+	if (!AssetData.GetTagValue(UObject::SourceFileTagName(), ImportInfoJson))
+	{
+		return false;
+	}
+
+	const TOptional<FAssetImportInfo> ImportInfo = FAssetImportInfo::FromJson(ImportInfoJson);
+	if (!ImportInfo.IsSet() || ImportInfo->SourceFiles.Num() < 1)
+	{
+		return false;
+	}
+
+	const FAssetImportInfo::FSourceFile& SourceFile = ImportInfo->SourceFiles[0];
+	OutSource.AssetPath = AssetData.GetObjectPathString();
+	OutSource.SourceFilename = HCI_ResolveSourceFilename(SourceFile.RelativeFilename, AssetData.PackageName.ToString());
+	OutSource.RecordedTimestamp = SourceFile.Timestamp;
+	OutSource.RecordedHash = SourceFile.FileHash;
+	return !OutSource.SourceFilename.IsEmpty();
+#else
+	(void)OutSource;
+	return false;
+#endif
+}
+
+void FHCIKitReimportPipeline::CollectSourcesUnderPath(const FString& PackagePath, TArray<FHCIKitReimportSource>& OutSources)
+{
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UHCIAsset::StaticClass()->GetClassPathName());
+	Filter.bRecursiveClasses = true;
+	if (!PackagePath.IsEmpty())
+	{
+		Filter.PackagePaths.Add(FName(*PackagePath));
+		Filter.bRecursivePaths = true;
+	}
+
+	TArray<FAssetData> AssetDatas;
+	AssetRegistryModule.Get().GetAssets(Filter, AssetDatas);
+
+	OutSources.Reserve(OutSources.Num() + AssetDatas.Num());
+	for (const FAssetData& AssetData : AssetDatas)
+	{
+		FHCIKitReimportSource Source;
+		if (TryDescribeAssetData(AssetData, Source))
+		{
+			OutSources.Add(MoveTemp(Source));
+		}
+	}
+}
+
+EHCIKitSourceChange FHCIKitReimportPipeline::ClassifySourceChange(const FHCIKitReimportSource& Source, bool* bOutHashed)
+{
+	if (bOutHashed)
+	{
+		*bOutHashed = false;
+	}
+
+	const FDateTime CurrentTimestamp = IFileManager::Get().GetTimeStamp(*Source.SourceFilename);
+	if (CurrentTimestamp == FDateTime::MinValue())
+	{
+		return EHCIKitSourceChange::Missing;
+	}
+
+	// Without a recorded hash there is nothing to compare against; treat it as changed.
+	if (!Source.RecordedHash.IsValid())
+	{
+		return EHCIKitSourceChange::Changed;
+	}
+
+	// Registry tags round-trip the timestamp through unix seconds, so an equal timestamp cannot rule out
+	// a rewrite in the same second as the import; the hash decides either way. Touched but identical
+	// content (checkout, branch switch) stays a no-op.
+	if (bOutHashed)
+	{
+		*bOutHashed = true;
+	}
+	const FMD5Hash CurrentHash = FMD5Hash::HashFile(*Source.SourceFilename);
+	return CurrentHash == Source.RecordedHash ? EHCIKitSourceChange::Unchanged : EHCIKitSourceChange::Changed;
+}
+
+FHCIKitReimportStats FHCIKitReimportPipeline::Run(TConstArrayView<FHCIKitReimportSource> Sources, const FHCIKitReimportOptions& Options)
+{
+	check(IsInGameThread());
+	HCI_TRACE_SCOPE(TEXT("HCI.Reimport.Batch"));
+
+	const double StartTime = FPlatformTime::Seconds();
+	FHCIKitReimportStats Stats;
+	Stats.Requested = Sources.Num();
+
+	// 1. Change detection: stat + optional MD5 per source, no UObject access.
+	TArray<EHCIKitSourceChange> Changes;
+	Changes.SetNumUninitialized(Sources.Num());
+	TAtomic<int32> HashedCount{0};
+	{
+		HCI_TRACE_SCOPE(TEXT("HCI.Reimport.Detect"));
+		const double DetectStart = FPlatformTime::Seconds();
+		ParallelFor(Sources.Num(), [&Sources, &Changes, &HashedCount, &Options](const int32 Index)
+		{
+			const FHCIKitReimportSource& Source = Sources[Index];
+			if (Options.bForce)
+			{
+				Changes[Index] = FPaths::FileExists(Source.SourceFilename) ? EHCIKitSourceChange::Changed : EHCIKitSourceChange::Missing;
+				return;
+			}
+
+			bool bHashed = false;
+			Changes[Index] = ClassifySourceChange(Source, &bHashed);
+			if (bHashed)
+			{
+				++HashedCount;
+			}
+		}, EParallelForFlags::Unbalanced);
+		Stats.DetectMs = HCI_MsSince(DetectStart);
+	}
+	Stats.Hashed = HashedCount;
+
+	TArray<FHCIKitParseSlot> Slots;
+	for (int32 Index = 0; Index < Sources.Num(); ++Index)
+	{
+		switch (Changes[Index])
+		{
+		case EHCIKitSourceChange::Unchanged:
+			++Stats.Unchanged;
+			break;
+		case EHCIKitSourceChange::Missing:
+			HCI_AddFailure(
+				Stats,
+				Sources[Index].AssetPath,
+				FString::Printf(TEXT("code=%s file=%s reason=Source file not found"), HCIErrorCodes::FileReadError, *Sources[Index].SourceFilename));
+			break;
+		case EHCIKitSourceChange::Changed:
+			Slots.AddDefaulted_GetRef().SourceIndex = Index;
+			break;
+		}
+	}
+
+	// 2. Parse only the changed files; JSON + field validation is thread-safe, the Python hook is not.
+	{
+		HCI_TRACE_SCOPE(TEXT("HCI.Reimport.Parse"));
+		const double ParseStart = FPlatformTime::Seconds();
+		ParallelFor(Slots.Num(), [&Sources, &Slots](const int32 SlotIndex)
+		{
+			FHCIKitParseSlot& Slot = Slots[SlotIndex];
+			Slot.bParsed = FHCIParserService::TryParseKitFileWithoutHook(Sources[Slot.SourceIndex].SourceFilename, Slot.Parsed, Slot.Error);
+		}, EParallelForFlags::Unbalanced);
+		Stats.Parsed = Slots.Num();
+		Stats.ParseMs = HCI_MsSince(ParseStart);
+	}
+
+	// 3. Game thread: load, hook, write back. Search refresh is deferred to one batch below.
+	TArray<const UHCIAsset*> ReimportedAssets;
+	ReimportedAssets.Reserve(Slots.Num());
+	{
+		HCI_TRACE_SCOPE(TEXT("HCI.Reimport.Apply"));
+		const double ApplyStart = FPlatformTime::Seconds();
+		for (FHCIKitParseSlot& Slot : Slots)
+		{
+			const FHCIKitReimportSource& Source = Sources[Slot.SourceIndex];
+			UHCIAsset* Asset = Slot.bParsed ? Cast<UHCIAsset>(FSoftObjectPath(Source.AssetPath).TryLoad()) : nullptr;
+			if (Slot.bParsed && !Asset)
+			{
+				HCI_AddFailure(Stats, Source.AssetPath, TEXT("reason=Asset could not be loaded"));
+				continue;
+			}
+
+			const bool bApplied = Slot.bParsed
+				&& FHCIParserService::RunPythonHook(Source.SourceFilename, Slot.Parsed, Slot.Error)
+				&& UHCIFactory::ApplyReimportedData(Asset, Source.SourceFilename, Slot.Parsed, Slot.Error);
+			if (!bApplied)
+			{
+				HCI_AddFailure(Stats, Source.AssetPath, Slot.Error.ToContractString());
+				continue;
+			}
+
+			ReimportedAssets.Add(Asset);
+		}
+		Stats.Reimported = ReimportedAssets.Num();
+		Stats.ApplyMs = HCI_MsSince(ApplyStart);
+	}
+
+	if (ReimportedAssets.Num() > 0)
+	{
+		const double IndexStart = FPlatformTime::Seconds();
+		FHCISearchIndexService::Get().RefreshAssets(ReimportedAssets);
+		Stats.IndexMs = HCI_MsSince(IndexStart);
+	}
+
+	Stats.TotalMs = HCI_MsSince(StartTime);
+	UE_LOG(LogHCIReimport, Display, TEXT("[HCI][Reimport] trigger=%s force=%s %s"), *Options.Trigger, Options.bForce ? TEXT("true") : TEXT("false"), *Stats.ToSummaryString());
+	HCI_NotifyIfNeeded(Stats, Options);
+	return Stats;
+}
+
+FHCIKitReimportStats FHCIKitReimportPipeline::RunForAssets(TConstArrayView<UHCIAsset*> Assets, const FHCIKitReimportOptions& Options)
+{
+	TArray<FHCIKitReimportSource> Sources;
+	Sources.Reserve(Assets.Num());
+	TArray<FString> UndescribedAssetPaths;
+	for (const UHCIAsset* Asset : Assets)
+	{
+		if (!Asset)
+		{
+			continue;
+		}
+
+		FHCIKitReimportSource Source;
+		if (TryDescribeAsset(Asset, Source))
+		{
+			Sources.Add(MoveTemp(Source));
+		}
+		else
+		{
+			UndescribedAssetPaths.Add(Asset->GetPathName());
+		}
+	}
+
+	FHCIKitReimportOptions RunOptions = Options;
+	RunOptions.bShowNotification = false;
+	FHCIKitReimportStats Stats = Run(Sources, RunOptions);
+	Stats.Requested += UndescribedAssetPaths.Num();
+	for (const FString& AssetPath : UndescribedAssetPaths)
+	{
+		HCI_AddFailure(Stats, AssetPath, TEXT("reason=No recorded source file path"));
+	}
+	HCI_NotifyIfNeeded(Stats, Options);
+	return Stats;
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/SecureHash.h"
+
+struct FAssetData;
+class UHCIAsset;
+
+enum class EHCIKitSourceChange : uint8
+{
+	Unchanged,
+	Changed,
+	Missing
+};
+
+// Source side of one kit asset, as recorded in its AssetImportData at the last (re)import.
+struct HCIEDITOR_API FHCIKitReimportSource
+{
+	FString AssetPath;
+	FString SourceFilename;
+	FDateTime RecordedTimestamp;
+	FMD5Hash RecordedHash;
+};
+
+struct HCIEDITOR_API FHCIKitReimportOptions
+{
+	// Reparse every source even when its hash still matches the recorded one.
+	bool bForce = false;
+	bool bShowNotification = true;
+	FString Trigger = TEXT("manual");
+};
+
+struct HCIEDITOR_API FHCIKitReimportStats
+{
+	int32 Requested = 0;
+	int32 Unchanged = 0;
+	int32 Hashed = 0;
+	int32 Parsed = 0;
+	int32 Reimported = 0;
+	int32 Failed = 0;
+	double DetectMs = 0.0;
+	double ParseMs = 0.0;
+	double ApplyMs = 0.0;
+	double IndexMs = 0.0;
+	double TotalMs = 0.0;
+	TArray<FString> Failures;
+
+	FString ToSummaryString() const;
+};
+
+// Batch reimport for .hciabilitykit sources. Change detection (MD5 against the recorded hash) and file parsing run in parallel; only kits whose source actually changed are
+// loaded, run through the Python hook and written back on the game thread, and the search index
+// is refreshed once for the whole batch.
+class HCIEDITOR_API FHCIKitReimportPipeline
+{
+public:
+	static bool TryDescribeAsset(const UHCIAsset* Asset, FHCIKitReimportSource& OutSource);
+	// Uses the in-memory import data when the asset is loaded, the registry source-file tag otherwise.
+	static bool TryDescribeAssetData(const FAssetData& AssetData, FHCIKitReimportSource& OutSource);
+	static void CollectSourcesUnderPath(const FString& PackagePath, TArray<FHCIKitReimportSource>& OutSources);
+
+	// Thread-safe. Hashes every present file with a recorded hash: the recorded timestamp only has
+	// second precision, so a matching timestamp cannot prove the content is unchanged.
+	static EHCIKitSourceChange ClassifySourceChange(const FHCIKitReimportSource& Source, bool* bOutHashed = nullptr);
+
+	// Game thread only.
+	static FHCIKitReimportStats Run(TConstArrayView<FHCIKitReimportSource> Sources, const FHCIKitReimportOptions& Options);
+	static FHCIKitReimportStats RunForAssets(TConstArrayView<UHCIAsset*> Assets, const FHCIKitReimportOptions& Options);
+};
@@ -12,6 +12,9 @@
 #include "Agent/Executor/HCIDryRunDiff.h"
 #include "Agent/Executor/HCIDryRunDiffJsonSerializer.h"
 #include "Agent/Tools/HCIToolRegistry.h"
+#include "AgentActions/Support/HCILevelMeshScanIndex.h"
+#include "AgentActions/Support/HCIPathSearchIndex.h"
+#include "AgentActions/Support/HCISessionResultCache.h"
 #include "Audit/HCIAuditPerfMetrics.h"
 #include "Audit/HCIAuditScanAsyncController.h"
 #include "Audit/HCIAuditReport.h"
@@ -19,11 +22,15 @@
 #include "Audit/HCIAuditRuleRegistry.h"
 #include "Audit/HCIAuditTagNames.h"
 #include "Commands/HCIAgentDemoConsoleCommands.h"
+#include "Commands/HCIPlannerEnvContextProvider.h"
 #include "Dom/JsonObject.h"
 #include "Audit/HCIAuditScanService.h"
 #include "Common/HCITimeFormat.h"
+#include "Common/HCITrace.h"
 #include "Containers/Ticker.h"
 #include "Factories/HCIFactory.h"
+#include "Factories/HCIKitAutoReimportWatcher.h"
+#include "Factories/HCIKitReimportPipeline.h"
 #include "Engine/StaticMesh.h"
 #include "Engine/World.h"
 #include "Engine/StreamableManager.h"
@@ -62,6 +69,7 @@
 
 DEFINE_LOG_CATEGORY_STATIC(LogHCISearchQuery, Log, All);
 DEFINE_LOG_CATEGORY_STATIC(LogHCIAuditScan, Log, All);
+DEFINE_LOG_CATEGORY_STATIC(LogHCIReimport, Log, All);
 
 static TObjectPtr<UHCIFactory> GHCIFactory;
 static TUniquePtr<FAutoConsoleCommand> GHCISearchCommand;
@@ -75,6 +83,8 @@ static TUniquePtr<FAutoConsoleCommand> GHCIToolRegistryDumpCommand;
 static TUniquePtr<FAutoConsoleCommand> GHCIDryRunDiffPreviewDemoCommand;
 static TUniquePtr<FAutoConsoleCommand> GHCIDryRunDiffPreviewLocateCommand;
 static TUniquePtr<FAutoConsoleCommand> GHCIDryRunDiffPreviewJsonCommand;
+static TUniquePtr<FAutoConsoleCommand> GHCIReimportChangedKitsCommand;
+static TUniquePtr<FAutoConsoleCommand> GHCIAutoReimportCommand;
 static const TCHAR* GHCIPythonScriptPath = TEXT("SourceData/AbilityKits/Python/hci_abilitykit_hook.py");
 
 namespace
@@ -168,6 +178,12 @@ struct FHCIAuditScanAsyncState
 };
 
 static FHCIAuditScanAsyncState GHCIAuditScanAsyncState;
+
+bool HCI_IsAuditScanAsyncRunning()
+{
+	return GHCIAuditScanAsyncState.Controller.IsRunning();
+}
+
 static FHCIDryRunDiffReport GHCIDryRunDiffPreviewState;
 static FString HCI_ToPythonStringLiteral(const FString& Value)
 {
@@ -300,6 +316,55 @@ static FString HCI_FormatIntArrayForLog(const TArray<int32>& Values)
 	return FString::Join(Tokens, TEXT("|"));
 }
 
+static void HCI_RunReimportChangedKitsCommand(const TArray<FString>& Args)
+{
+	FString PackagePath;
+	FHCIKitReimportOptions Options;
+	for (const FString& Arg : Args)
+	{
+		if (Arg.Equals(TEXT("-force"), ESearchCase::IgnoreCase))
+		{
+			Options.bForce = true;
+		}
+		else
+		{
+			PackagePath = Arg.TrimStartAndEnd();
+		}
+	}
+
+	TArray<FHCIKitReimportSource> Sources;
+	FHCIKitReimportPipeline::CollectSourcesUnderPath(PackagePath, Sources);
+	const FHCIKitReimportStats Stats = FHCIKitReimportPipeline::Run(Sources, Options);
+	for (const FString& Failure : Stats.Failures)
+	{
+		UE_LOG(LogHCIReimport, Warning, TEXT("[HCI][Reimport] failure %s"), *Failure);
+	}
+}
+
+static void HCI_RunAutoReimportCommand(const TArray<FString>& Args)
+{
+	FHCIKitAutoReimportWatcher& Watcher = FHCIKitAutoReimportWatcher::Get();
+	if (Args.Num() >= 1)
+	{
+		if (Args[0].ToBool())
+		{
+			Watcher.Enable();
+		}
+		else
+		{
+			Watcher.Disable();
+		}
+	}
+
+	UE_LOG(
+		LogHCIReimport,
+		Display,
+		TEXT("[HCI][AutoReimport] enabled=%s sources=%d directories=%d"),
+		Watcher.IsEnabled() ? TEXT("true") : TEXT("false"),
+		Watcher.GetTrackedSourceCount(),
+		Watcher.GetWatchedDirectoryCount());
+}
+
 static void HCI_RunAbilityKitToolRegistryDumpCommand(const TArray<FString>& Args)
 {
 	const FString OptionalToolFilter = (Args.Num() >= 1) ? Args[0].TrimStartAndEnd() : FString();
@@ -1232,6 +1297,7 @@ static bool HCI_TickAbilityKitAuditScanAsync(float DeltaSeconds)
 		return false;
 	}
 
+	HCI_TRACE_SCOPE(TEXT("HCI.Audit.DeepScanBatch"));
 	const TArray<FAssetData>& AssetDatas = State.Controller.GetAssetDatas();
 	const double BatchStartSeconds = FPlatformTime::Seconds();
 	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
@@ -1993,6 +2059,22 @@ void FHCIEditorModule::StartupModule()
 			FConsoleCommandWithArgsDelegate::CreateStatic(&HCI_RunAbilityKitDryRunDiffPreviewJsonCommand));
 	}
 
+	if (!GHCIReimportChangedKitsCommand.IsValid())
+	{
+		GHCIReimportChangedKitsCommand = MakeUnique<FAutoConsoleCommand>(
+			TEXT("HCI.ReimportChangedKits"),
+			TEXT("Batch reimport kits whose source file hash changed. Usage: HCI.ReimportChangedKits [/Game/path] [-force]"),
+			FConsoleCommandWithArgsDelegate::CreateStatic(&HCI_RunReimportChangedKitsCommand));
+	}
+
+	if (!GHCIAutoReimportCommand.IsValid())
+	{
+		GHCIAutoReimportCommand = MakeUnique<FAutoConsoleCommand>(
+			TEXT("HCI.AutoReimport"),
+			TEXT("Watch kit source directories and batch reimport changed files. Usage: HCI.AutoReimport [0|1]"),
+			FConsoleCommandWithArgsDelegate::CreateStatic(&HCI_RunAutoReimportCommand));
+	}
+
 	// Business-level Undo listener (toast on Ctrl+Z / Ctrl+Y) for transactions created with Context="HCI".
 	// This must be non-blocking and should not depend on any user UI being open.
 	if (!GHCIBusinessUndoClient.IsValid() && GEditor != nullptr)
@@ -2004,6 +2086,11 @@ void FHCIEditorModule::StartupModule()
 void FHCIEditorModule::ShutdownModule()
 {
 	FHCIParserService::ClearPythonHook();
+	FHCILevelMeshScanIndex::Get().Shutdown();
+	FHCIPathSearchIndex::Get().Shutdown();
+	FHCIPlannerEnvContextProvider::Get().Shutdown();
+	FHCISessionResultCache::Shutdown();
+	FHCIKitAutoReimportWatcher::Get().Disable();
 
 	if (ContentBrowserMenuRegistrar.IsValid())
 	{
@@ -2043,6 +2130,8 @@ void FHCIEditorModule::ShutdownModule()
 	GHCIDryRunDiffPreviewDemoCommand.Reset();
 	GHCIDryRunDiffPreviewLocateCommand.Reset();
 	GHCIDryRunDiffPreviewJsonCommand.Reset();
+	GHCIReimportChangedKitsCommand.Reset();
+	GHCIAutoReimportCommand.Reset();
 	GHCIBusinessUndoClient.Reset();
 }
 
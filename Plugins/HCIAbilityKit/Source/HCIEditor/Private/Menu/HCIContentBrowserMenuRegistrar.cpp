@@ -2,6 +2,7 @@
 
 #include "ContentBrowserMenuContexts.h"
 #include "Factories/HCIFactory.h"
+#include "Factories/HCIKitReimportPipeline.h"
 #include "HCIAsset.h"
 #include "Styling/AppStyle.h"
 #include "ToolMenus.h"
@@ -91,9 +92,11 @@ void FHCIContentBrowserMenuRegistrar::ReimportSelectedAbilityKits(const FToolMen
 		return;
 	}
 
-	for (UHCIAsset* Asset : Context->LoadSelectedObjects<UHCIAsset>())
-	{
-		Factory->Reimport(Asset);
-	}
+	// One batch for the whole selection with a single search index refresh. An explicit Reimport reparses every
+	// selected kit, as it did before batching, instead of skipping sources whose hash still matches.
+	FHCIKitReimportOptions Options;
+	Options.bForce = true;
+	const TArray<UHCIAsset*> Assets = Context->LoadSelectedObjects<UHCIAsset>();
+	FHCIKitReimportPipeline::RunForAssets(Assets, Options);
 }
 
@@ -62,6 +62,11 @@ bool UHCIAgentSubsystem::CanCancelPendingPlanFromChat() const
 	return SessionController ? SessionController->CanCancelPendingPlanFromChat() : false;
 }
 
+bool UHCIAgentSubsystem::CanStopExecutionFromChat() const
+{
+	return SessionController ? SessionController->CanStopExecutionFromChat() : false;
+}
+
 bool UHCIAgentSubsystem::BuildLastPlanCardLines(TArray<FString>& OutLines) const
 {
 	OutLines.Reset();
@@ -116,6 +121,11 @@ bool UHCIAgentSubsystem::CancelPendingPlanFromChat()
 	return SessionController ? SessionController->CancelPendingPlanFromChat() : false;
 }
 
+bool UHCIAgentSubsystem::StopExecutionFromChat()
+{
+	return SessionController ? SessionController->StopExecutionFromChat() : false;
+}
+
 bool UHCIAgentSubsystem::TryLocateLastExecutionTargetByIndex(const int32 TargetIndex)
 {
 	return SessionController ? SessionController->TryLocateLastExecutionTargetByIndex(TargetIndex) : false;
@@ -18,6 +18,7 @@
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 #include "UI/HCIAgentPlanPreviewWindow.h"
+#include "UI/HCIAgentSlicedPlanExecution.h"
 #include "UObject/SoftObjectPath.h"
 
 namespace
@@ -1060,6 +1061,11 @@ void UHCIAgentSessionController::Initialize(UHCIAgentSubsystem& InOwner)
 void UHCIAgentSessionController::Deinitialize()
 {
 	ActiveCommand = nullptr;
+	if (ActiveExecution.IsValid())
+	{
+		ActiveExecution->Shutdown();
+		ActiveExecution.Reset();
+	}
 	CommandRegistry.Reset();
 	QuickCommands.Reset();
 	QuickCommandsLoadError.Reset();
@@ -1083,7 +1089,7 @@ bool UHCIAgentSessionController::SubmitChatInput(const FString& UserInput, const
 		return false;
 	}
 
-	if (ActiveCommand != nullptr)
+	if (IsBusy())
 	{
 		EmitStatus(TEXT("状态：忙碌"));
 		EmitAssistantLine(TEXT("已有请求执行中，请等待当前请求完成后再发送。"));
@@ -1159,7 +1165,7 @@ bool UHCIAgentSessionController::SubmitChatInput(const FString& UserInput, const
 
 bool UHCIAgentSessionController::IsBusy() const
 {
-	return ActiveCommand != nullptr;
+	return ActiveCommand != nullptr || ActiveExecution.IsValid();
 }
 
 bool UHCIAgentSessionController::HasLastPlan() const
@@ -1187,6 +1193,11 @@ bool UHCIAgentSessionController::CanCancelPendingPlanFromChat() const
 	return bHasLastPlan && CurrentState == EHCIAgentSessionState::AwaitUserConfirm;
 }
 
+bool UHCIAgentSessionController::CanStopExecutionFromChat() const
+{
+	return ActiveExecution.IsValid() && ActiveExecution->IsRunning() && !ActiveExecution->IsCancelRequested();
+}
+
 void UHCIAgentSessionController::GetCurrentProgressState(FHCIAgentUiProgressState& OutState) const
 {
 	OutState = CurrentProgressState;
@@ -1693,7 +1704,7 @@ bool UHCIAgentSessionController::OpenLastPlanPreview()
 
 bool UHCIAgentSessionController::CommitLastPlanFromChat()
 {
-	if (ActiveCommand != nullptr)
+	if (IsBusy())
 	{
 		EmitStatus(TEXT("状态：忙碌"));
 		EmitAssistantLine(TEXT("已有请求执行中，请等待当前请求完成后再执行计划。"));
@@ -1718,7 +1729,7 @@ bool UHCIAgentSessionController::CommitLastPlanFromChat()
 
 bool UHCIAgentSessionController::CancelPendingPlanFromChat()
 {
-	if (ActiveCommand != nullptr)
+	if (IsBusy())
 	{
 		EmitStatus(TEXT("状态：忙碌"));
 		EmitAssistantLine(TEXT("已有请求执行中，请等待当前请求完成后再取消。"));
@@ -1743,6 +1754,20 @@ bool UHCIAgentSessionController::CancelPendingPlanFromChat()
 	return true;
 }
 
+bool UHCIAgentSessionController::StopExecutionFromChat()
+{
+	if (!CanStopExecutionFromChat())
+	{
+		return false;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("[HCI][AgentChatStateMachine] trigger=manual_stop state=executing request_id=%s"), *ActiveExecution->GetRequestId());
+	ActiveExecution->RequestCancel();
+	SetActivityHint(TEXT("正在停止，当前批次完成后结束..."));
+	EmitStatus(TEXT("状态：正在停止"));
+	return true;
+}
+
 bool UHCIAgentSessionController::TryLocateLastExecutionTargetByIndex(const int32 TargetIndex)
 {
 	if (!LastExecutionLocateTargets.IsValidIndex(TargetIndex))
@@ -2022,33 +2047,82 @@ bool UHCIAgentSessionController::ExecuteLastPlan(
 		return false;
 	}
 
+	if (ActiveExecution.IsValid())
+	{
+		EmitStatus(TEXT("状态：忙碌"));
+		EmitAssistantLine(TEXT("已有计划执行中，请等待完成或点击停止。"));
+		return false;
+	}
+
 	SetCurrentState(EHCIAgentSessionState::Executing);
+	const int32 PlanStepCount = LastPlan.Steps.Num();
 	SetProgressState(HCI_MakeProgressState(
 		true,
-		true,
+		false,
 		0.60f,
-		FString::Printf(TEXT("进度：执行计划（0/%d 步）..."), LastPlan.Steps.Num())));
-	FHCIAgentPlanExecutionReport Report;
-	const bool bRunOk = FHCIAgentPlanPreviewWindow::ExecutePlan(
+		FString::Printf(TEXT("进度：执行计划（0/%d 步）..."), PlanStepCount)));
+
+	// Callbacks fire from ticker frames after this returns, so hold the controller weakly.
+	TWeakObjectPtr<UHCIAgentSessionController> WeakThis(this);
+	TSharedRef<FString> CurrentStepHint = MakeShared<FString>();
+	const FString TriggerTagText = TriggerTag == nullptr ? TEXT("-") : TriggerTag;
+	ActiveExecution = FHCIAgentSlicedPlanExecution::Start(
 		LastPlan,
 		false,
 		Branch == EHCIAgentPlanExecutionBranch::AwaitUserConfirm,
-		Report,
-		[this](const int32 StepIndex, const int32 TotalSteps, const FHCIAgentPlanStep& Step)
+		[WeakThis, CurrentStepHint](const int32 StepIndex, const int32 TotalSteps, const FHCIAgentPlanStep& Step)
 		{
-			const FString ActionHint = HCI_BuildStepActionHintForChat(Step);
-			// ExecutePlan runs on the game thread; update progress immediately so the UI stays responsive/visible.
-			if (!IsValid(this))
+			UHCIAgentSessionController* Self = WeakThis.Get();
+			if (!Self)
 			{
 				return;
 			}
-			SetActivityHint(ActionHint);
-			SetProgressState(HCI_MakeProgressState(
+			*CurrentStepHint = HCI_BuildStepActionHintForChat(Step);
+			Self->SetActivityHint(*CurrentStepHint);
+			Self->SetProgressState(HCI_MakeProgressState(
 				true,
+				false,
+				0.60f + 0.28f * static_cast<float>(StepIndex) / static_cast<float>(FMath::Max(1, TotalSteps)),
+				FString::Printf(TEXT("进度：执行计划（%d/%d）%s"), StepIndex + 1, TotalSteps, **CurrentStepHint)));
+		},
+		[WeakThis, CurrentStepHint](const int32 StepIndex, const int32 TotalSteps, const int32 ProcessedAssets, const int32 TotalAssets)
+		{
+			UHCIAgentSessionController* Self = WeakThis.Get();
+			if (!Self || TotalAssets <= 0)
+			{
+				return;
+			}
+			const float StepFraction = static_cast<float>(ProcessedAssets) / static_cast<float>(TotalAssets);
+			Self->SetProgressState(HCI_MakeProgressState(
 				true,
-				0.60f,
-				FString::Printf(TEXT("进度：执行计划（%d/%d）%s"), StepIndex + 1, TotalSteps, *ActionHint)));
+				false,
+				0.60f + 0.28f * (static_cast<float>(StepIndex) + StepFraction) / static_cast<float>(FMath::Max(1, TotalSteps)),
+				FString::Printf(
+					TEXT("进度：执行计划（%d/%d）%s（资产 %d/%d）"),
+					StepIndex + 1,
+					TotalSteps,
+					**CurrentStepHint,
+					ProcessedAssets,
+					TotalAssets)));
+		},
+		[WeakThis, Branch, TriggerTagText](const FHCIAgentPlanExecutionReport& Report)
+		{
+			if (UHCIAgentSessionController* Self = WeakThis.Get())
+			{
+				Self->HandlePlanExecutionCompleted(Report, Branch, TriggerTagText);
+			}
 		});
+	return true;
+}
+
+void UHCIAgentSessionController::HandlePlanExecutionCompleted(
+	const FHCIAgentPlanExecutionReport& Report,
+	const EHCIAgentPlanExecutionBranch Branch,
+	const FString& TriggerTag)
+{
+	ActiveExecution.Reset();
+	const bool bRunOk = Report.bRunOk;
+	const bool bCancelled = Report.TerminalStatus == TEXT("cancelled");
 
 	SetLocateTargetsFromExecutionReport(Report);
 	const int32 ExecutedSteps = Report.SucceededSteps + Report.FailedSteps;
@@ -2083,19 +2157,30 @@ bool UHCIAgentSessionController::ExecuteLastPlan(
 	{
 		EmitAssistantLine(FString::Printf(TEXT("已生成 %d 个可定位结果项，可在结果面板点击定位。"), Report.LocateTargets.Num()));
 	}
+	if (bCancelled)
+	{
+		EmitAssistantLine(FString::Printf(
+			TEXT("已停止执行：完成 %d/%d 步，已应用的修改保留在同一条撤销记录中（Ctrl+Z 可整体回退）。"),
+			ExecutedSteps,
+			LastPlan.Steps.Num()));
+	}
 
 	UE_LOG(
 		LogTemp,
 		Display,
 		TEXT("[HCI][AgentChatStateMachine] trigger=%s branch=%s run_ok=%s terminal=%s reason=%s"),
-		TriggerTag == nullptr ? TEXT("-") : TriggerTag,
+		*TriggerTag,
 		Branch == EHCIAgentPlanExecutionBranch::AwaitUserConfirm ? TEXT("await_user_confirm") : TEXT("auto_read_only"),
 		bRunOk ? TEXT("true") : TEXT("false"),
 		*Report.TerminalStatus,
 		*Report.TerminalReason);
 
+	if (bCancelled)
+	{
+		SetCurrentState(EHCIAgentSessionState::Cancelled);
+		return;
+	}
 	SetCurrentState(bRunOk ? EHCIAgentSessionState::Completed : EHCIAgentSessionState::Failed);
-	return bRunOk;
 }
 
 void UHCIAgentSessionController::HandleCommandCompleted(const FHCIAgentCommandResult& Result)
@@ -6,6 +6,8 @@
 
 #include "AgentSessionController.generated.h"
 
+class FHCIAgentSlicedPlanExecution;
+
 /**
  * Agent 会话控制器（深模块）：
  * - 负责聊天会话状态机、命令执行编排、计划执行与结果归档。
@@ -27,6 +29,7 @@ public:
 	FString GetCurrentStateLabel() const;
 	bool CanCommitLastPlanFromChat() const;
 	bool CanCancelPendingPlanFromChat() const;
+	bool CanStopExecutionFromChat() const;
 	bool BuildLastPlanCardLines(TArray<FString>& OutLines) const;
 	bool BuildLastPlanApprovalCard(FHCIAgentUiApprovalCard& OutCard) const;
 	void GetCurrentProgressState(FHCIAgentUiProgressState& OutState) const;
@@ -35,6 +38,7 @@ public:
 	bool OpenLastPlanPreview();
 	bool CommitLastPlanFromChat();
 	bool CancelPendingPlanFromChat();
+	bool StopExecutionFromChat();
 	bool TryLocateLastExecutionTargetByIndex(int32 TargetIndex);
 
 	void ReloadQuickCommands();
@@ -51,7 +55,12 @@ private:
 	void SetActivityHint(const FString& InHint);
 	void ClearLocateTargets();
 	void SetLocateTargetsFromExecutionReport(const struct FHCIAgentPlanExecutionReport& Report);
+	// Starts a time-sliced run of LastPlan; results are reported from HandlePlanExecutionCompleted on a later frame.
 	bool ExecuteLastPlan(EHCIAgentPlanExecutionBranch Branch, const TCHAR* TriggerTag);
+	void HandlePlanExecutionCompleted(
+		const struct FHCIAgentPlanExecutionReport& Report,
+		EHCIAgentPlanExecutionBranch Branch,
+		const FString& TriggerTag);
 
 	void HandleCommandCompleted(const FHCIAgentCommandResult& Result);
 	bool ExecuteRegisteredCommand(const FName& CommandName, const FHCIAgentCommandContext& Context);
@@ -62,6 +71,9 @@ private:
 	UPROPERTY(Transient)
 	TObjectPtr<UHCIAgentCommandBase> ActiveCommand = nullptr;
 
+	// In-flight plan execution; the session counts as busy until it reports completion.
+	TSharedPtr<FHCIAgentSlicedPlanExecution> ActiveExecution;
+
 	// Last chat request snapshot (used for auto-repair retry when ScanAssets returns empty due to dirty path input).
 	FString LastChatTrimmedUserInput;
 	FString LastChatEffectiveInput;
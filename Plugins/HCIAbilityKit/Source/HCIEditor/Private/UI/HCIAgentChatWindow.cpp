@@ -849,6 +849,26 @@ private:
 					.WrapTextAt(560.0f)
 					.ColorAndOpacity(FSlateColor(FLinearColor::White))
 				]
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				.VAlign(VAlign_Center)
+				.Padding(8.0f, 0.0f, 0.0f, 0.0f)
+				[
+					SNew(SButton)
+					.Visibility_Lambda([this]()
+					{
+						const UHCIAgentSubsystem* AgentSubsystem = GetAgentSubsystem();
+						return AgentSubsystem && AgentSubsystem->CanStopExecutionFromChat() ? EVisibility::Visible : EVisibility::Collapsed;
+					})
+					.ButtonColorAndOpacity(FLinearColor(0.56f, 0.16f, 0.16f, 1.0f))
+					.ContentPadding(FMargin(10.0f, 4.0f))
+					.OnClicked(this, &SHCIAgentChatWindow::HandleStopExecutionClicked)
+					[
+						SNew(STextBlock)
+						.Text(FText::FromString(TEXT("停止")))
+						.ColorAndOpacity(FSlateColor(FLinearColor::White))
+					]
+				]
 			];
 
 			if (!Msg.SubText.IsEmpty())
@@ -1172,6 +1192,15 @@ private:
 		return FReply::Handled();
 	}
 
+	FReply HandleStopExecutionClicked()
+	{
+		if (UHCIAgentSubsystem* AgentSubsystem = GetAgentSubsystem())
+		{
+			AgentSubsystem->StopExecutionFromChat();
+		}
+		return FReply::Handled();
+	}
+
 	FReply HandleLocateResultTargetClicked(const int32 TargetIndex)
 	{
 		if (UHCIAgentSubsystem* AgentSubsystem = GetAgentSubsystem())
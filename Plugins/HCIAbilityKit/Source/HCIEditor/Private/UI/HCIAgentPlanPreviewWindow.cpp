@@ -4,6 +4,8 @@
 #include "Agent/Presentation/HCIAgentToolResultSummaryFormatter.h"
 #include "Agent/Tools/HCIToolRegistry.h"
 #include "AgentActions/HCIAgentToolActions.h"
+#include "AgentActions/Support/HCISessionResultCache.h"
+#include "AgentActions/Support/HCISourceControlCheckout.h"
 #include "AssetRegistry/AssetData.h"
 #include "ContentBrowserModule.h"
 #include "Dom/JsonObject.h"
@@ -12,7 +14,6 @@
 #include "IContentBrowserSingleton.h"
 #include "Misc/MessageDialog.h"
 #include "Modules/ModuleManager.h"
-#include "ScopedTransaction.h"
 #include "Styling/AppStyle.h"
 #include "GameFramework/Actor.h"
 #include "UObject/SoftObjectPath.h"
@@ -32,6 +33,14 @@ DEFINE_LOG_CATEGORY_STATIC(LogHCIAgentPlanPreview, Log, All);
 
 namespace
 {
+// Proposal artifacts of the latest dry run, keyed by FHCIAgentExecutor::MakeProposalArtifactKey. The next
+// commit consumes them; keys embed the request id, so a commit of another plan simply finds nothing.
+static TMap<FString, FString>& HCI_GetDryRunProposalArtifacts()
+{
+	static TMap<FString, FString> ArtifactsByKey;
+	return ArtifactsByKey;
+}
+
 static TArray<FString> HCI_ExtractAssetObjectPaths(const FHCIAgentPlanStep& Step)
 {
 	TArray<FString> OutPaths;
@@ -974,54 +983,80 @@ void FHCIAgentPlanPreviewWindow::BuildLocateTargetsFromStepResults(
 	}
 }
 
-bool FHCIAgentPlanPreviewWindow::ExecutePlan(
+void FHCIAgentPlanPreviewWindow::BuildExecutorOptions(
 	const FHCIAgentPlan& Plan,
 	const bool bDryRun,
 	const bool bUserConfirmedWriteSteps,
-	FHCIAgentPlanExecutionReport& OutReport,
-	TFunction<void(int32, int32, const FHCIAgentPlanStep&)> OnStepBegin)
+	TFunction<void(int32, int32, const FHCIAgentPlanStep&)> OnStepBegin,
+	FHCIAgentExecutorOptions& OutOptions)
 {
-	OutReport = FHCIAgentPlanExecutionReport();
-	OutReport.bDryRun = bDryRun;
-
-	const FHCIToolRegistry& ToolRegistry = FHCIToolRegistry::GetReadOnly();
-	FHCIAgentExecutorOptions Options;
-	Options.bDryRun = bDryRun;
-	Options.bValidatePlanBeforeExecute = true;
-	Options.TerminationPolicy = EHCIAgentExecutorTerminationPolicy::ContinueOnFailure;
-	Options.bEnablePreflightGates = true;
-	Options.bUserConfirmedWriteSteps = bUserConfirmedWriteSteps;
+	OutOptions = FHCIAgentExecutorOptions();
+	OutOptions.bDryRun = bDryRun;
+	OutOptions.bValidatePlanBeforeExecute = true;
+	OutOptions.TerminationPolicy = EHCIAgentExecutorTerminationPolicy::ContinueOnFailure;
+	OutOptions.bEnablePreflightGates = true;
+	OutOptions.bUserConfirmedWriteSteps = bUserConfirmedWriteSteps;
 	if (OnStepBegin)
 	{
 		const int32 TotalSteps = Plan.Steps.Num();
-		Options.OnStepBegin = [OnStepBegin, TotalSteps](const int32 StepIndex, const FHCIAgentPlanStep& Step)
+		OutOptions.OnStepBegin = [OnStepBegin, TotalSteps](const int32 StepIndex, const FHCIAgentPlanStep& Step)
 		{
 			OnStepBegin(StepIndex, TotalSteps, Step);
 		};
 	}
-	HCIAgentToolActions::BuildStageIDraftActions(Options.ToolActions);
+	HCIAgentToolActions::BuildStageIDraftActions(OutOptions.ToolActions);
+	OutOptions.ReadOnlyResultCache = FHCISessionResultCache::Get();
+	if (!bDryRun)
+	{
+		OutOptions.ProposalArtifactsByKey = HCI_GetDryRunProposalArtifacts();
+		// Write steps fed by "{{sN.asset_paths}}" are sized for the undo estimate once their targets are known.
+		OutOptions.OnStepArgsResolved = [](const int32 StepIndex, const FHCIAgentPlanStep& ResolvedStep)
+		{
+			FHCICommitUndoScope::NoteResolvedStep(ResolvedStep);
+		};
+	}
 
+	// Confirmed commits check out every package the plan writes in one provider batch before the first step.
+	if (!bDryRun && bUserConfirmedWriteSteps && FHCIEditorSourceControlCheckout::IsProviderAvailable())
+	{
+		OutOptions.bSourceControlEnabled = true;
+		OutOptions.SourceControlCheckout = MakeShared<FHCIEditorSourceControlCheckout>();
+	}
+}
+
+TUniquePtr<FHCICommitUndoScope> FHCIAgentPlanPreviewWindow::BeginBusinessTransaction(
+	const FHCIAgentPlan& Plan,
+	const bool bDryRun,
+	const bool bUserConfirmedWriteSteps)
+{
 	// Business-level Undo: one approved commit == one undo record (Context=HCI).
 	// Keep DryRun free of transactions.
-	TUniquePtr<FScopedTransaction> BusinessTransaction;
-	if (!bDryRun && bUserConfirmedWriteSteps)
+	if (bDryRun || !bUserConfirmedWriteSteps)
 	{
-		const FString SessionName = FString::Printf(TEXT("HCI: %s (%s)"), *Plan.Intent, *Plan.RequestId);
-		BusinessTransaction = MakeUnique<FScopedTransaction>(TEXT("HCI"), FText::FromString(SessionName), nullptr, true);
+		return nullptr;
 	}
 
-	FHCIAgentExecutorRunResult RunResult;
-	OutReport.bRunOk = FHCIAgentExecutor::ExecutePlan(
-		Plan,
-		ToolRegistry,
-		FHCIAgentPlanValidationContext(),
-		Options,
-		RunResult);
+	const FString SessionName = FString::Printf(TEXT("HCI: %s (%s)"), *Plan.Intent, *Plan.RequestId);
+	return MakeUnique<FHCICommitUndoScope>(Plan, FText::FromString(SessionName));
+}
+
+void FHCIAgentPlanPreviewWindow::BuildExecutionReport(
+	const FHCIAgentPlan& Plan,
+	const bool bDryRun,
+	const bool bRunOk,
+	const FHCIAgentExecutorRunResult& RunResult,
+	FHCIAgentPlanExecutionReport& OutReport)
+{
+	OutReport = FHCIAgentPlanExecutionReport();
+	OutReport.bDryRun = bDryRun;
+	OutReport.bRunOk = bRunOk;
 	OutReport.ExecutionMode = RunResult.ExecutionMode;
 	OutReport.TerminalStatus = RunResult.TerminalStatus;
 	OutReport.TerminalReason = RunResult.TerminalReason;
 	OutReport.SucceededSteps = RunResult.SucceededSteps;
 	OutReport.FailedSteps = RunResult.FailedSteps;
+	OutReport.ReadOnlyCacheHits = RunResult.ReadOnlyCacheHits;
+	OutReport.ReadOnlyCacheMisses = RunResult.ReadOnlyCacheMisses;
 
 	int32 ScannedAssets = 0;
 	int32 ScannedLevelActors = 0;
@@ -1051,7 +1086,7 @@ bool FHCIAgentPlanPreviewWindow::ExecutePlan(
 
 	const FString ModeLabel = bDryRun ? TEXT("DryRun") : TEXT("Commit");
 	OutReport.SummaryText = FString::Printf(
-		TEXT("%s: ok=%s execution_mode=%s terminal=%s reason=%s succeeded=%d failed=%d scanned_assets=%d scanned_level_actors=%d risky_level_actors=%d"),
+		TEXT("%s: ok=%s execution_mode=%s terminal=%s reason=%s succeeded=%d failed=%d scanned_assets=%d scanned_level_actors=%d risky_level_actors=%d cache_hits=%d cache_misses=%d"),
 		*ModeLabel,
 		OutReport.bRunOk ? TEXT("true") : TEXT("false"),
 		*OutReport.ExecutionMode,
@@ -1061,15 +1096,29 @@ bool FHCIAgentPlanPreviewWindow::ExecutePlan(
 		OutReport.FailedSteps,
 		OutReport.ScannedAssets,
 		ScannedLevelActors,
-		RiskyLevelActors);
+		RiskyLevelActors,
+		OutReport.ReadOnlyCacheHits,
+		OutReport.ReadOnlyCacheMisses);
 	OutReport.SearchPathEvidenceText = BuildSearchPathEvidenceSummary(RunResult.StepResults);
 	OutReport.StepResults = RunResult.StepResults;
 	BuildLocateTargetsFromStepResults(RunResult.StepResults, OutReport.LocateTargets);
 
+	// A dry run replaces the stored artifacts; a commit has changed the assets they describe, so it drops them.
+	TMap<FString, FString>& DryRunArtifacts = HCI_GetDryRunProposalArtifacts();
+	DryRunArtifacts.Reset();
+	for (FHCIAgentExecutorStepResult& Step : OutReport.StepResults)
+	{
+		if (bDryRun && !Step.ProposalArtifact.IsEmpty())
+		{
+			DryRunArtifacts.Add(Step.ProposalArtifactKey, MoveTemp(Step.ProposalArtifact));
+		}
+		Step.ProposalArtifact.Reset();
+	}
+
 	UE_LOG(
 		LogHCIAgentPlanPreview,
 		Display,
-		TEXT("[HCI][AgentPlanPreview] mode=%s execution_mode=%s executed request_id=%s steps=%d terminal=%s terminal_reason=%s succeeded=%d failed=%d scanned_assets=%d scanned_level_actors=%d risky_level_actors=%d"),
+		TEXT("[HCI][AgentPlanPreview] mode=%s execution_mode=%s executed request_id=%s steps=%d terminal=%s terminal_reason=%s succeeded=%d failed=%d scanned_assets=%d scanned_level_actors=%d risky_level_actors=%d cache_hits=%d cache_misses=%d"),
 		bDryRun ? TEXT("dry_run") : TEXT("execute"),
 		*OutReport.ExecutionMode,
 		*Plan.RequestId,
@@ -1080,7 +1129,9 @@ bool FHCIAgentPlanPreviewWindow::ExecutePlan(
 		OutReport.FailedSteps,
 		OutReport.ScannedAssets,
 		ScannedLevelActors,
-		RiskyLevelActors);
+		RiskyLevelActors,
+		OutReport.ReadOnlyCacheHits,
+		OutReport.ReadOnlyCacheMisses);
 
 	if (OutReport.LocateTargets.Num() > 0)
 	{
@@ -1092,6 +1143,27 @@ bool FHCIAgentPlanPreviewWindow::ExecutePlan(
 			*Plan.RequestId);
 	}
 
+}
+
+bool FHCIAgentPlanPreviewWindow::ExecutePlan(
+	const FHCIAgentPlan& Plan,
+	const bool bDryRun,
+	const bool bUserConfirmedWriteSteps,
+	FHCIAgentPlanExecutionReport& OutReport,
+	TFunction<void(int32, int32, const FHCIAgentPlanStep&)> OnStepBegin)
+{
+	FHCIAgentExecutorOptions Options;
+	BuildExecutorOptions(Plan, bDryRun, bUserConfirmedWriteSteps, MoveTemp(OnStepBegin), Options);
+	TUniquePtr<FHCICommitUndoScope> BusinessTransaction = BeginBusinessTransaction(Plan, bDryRun, bUserConfirmedWriteSteps);
+
+	FHCIAgentExecutorRunResult RunResult;
+	const bool bRunOk = FHCIAgentExecutor::ExecutePlan(
+		Plan,
+		FHCIToolRegistry::GetReadOnly(),
+		FHCIAgentPlanValidationContext(),
+		Options,
+		RunResult);
+	BuildExecutionReport(Plan, bDryRun, bRunOk, RunResult, OutReport);
 	return OutReport.bRunOk;
 }
 
@@ -4,6 +4,7 @@
 
 #include "Agent/Executor/HCIAgentExecutor.h"
 #include "Agent/Planner/HCIAgentPlan.h"
+#include "AgentActions/Support/HCICommitUndo.h"
 
 struct FHCIAgentPlanPreviewRow
 {
@@ -64,6 +65,8 @@ struct FHCIAgentPlanExecutionReport
 	int32 SucceededSteps = 0;
 	int32 FailedSteps = 0;
 	int32 ScannedAssets = 0;
+	int32 ReadOnlyCacheHits = 0;
+	int32 ReadOnlyCacheMisses = 0;
 	FString SummaryText;
 	FString SearchPathEvidenceText;
 	TArray<FHCIAgentExecutorStepResult> StepResults;
@@ -81,6 +84,23 @@ public:
 	static void BuildLocateTargetsFromStepResults(
 		const TArray<FHCIAgentExecutorStepResult>& StepResults,
 		TArray<FHCIAgentExecutionLocateTarget>& OutTargets);
+	static void BuildExecutorOptions(
+		const FHCIAgentPlan& Plan,
+		bool bDryRun,
+		bool bUserConfirmedWriteSteps,
+		TFunction<void(int32 /*StepIndex*/, int32 /*TotalSteps*/, const FHCIAgentPlanStep& /*Step*/)> OnStepBegin,
+		FHCIAgentExecutorOptions& OutOptions);
+	// Null for dry runs and unconfirmed commits. The scope owns the HCI transaction and picks its undo mode.
+	static TUniquePtr<FHCICommitUndoScope> BeginBusinessTransaction(
+		const FHCIAgentPlan& Plan,
+		bool bDryRun,
+		bool bUserConfirmedWriteSteps);
+	static void BuildExecutionReport(
+		const FHCIAgentPlan& Plan,
+		bool bDryRun,
+		bool bRunOk,
+		const FHCIAgentExecutorRunResult& RunResult,
+		FHCIAgentPlanExecutionReport& OutReport);
 	static bool ExecutePlan(
 		const FHCIAgentPlan& Plan,
 		bool bDryRun,
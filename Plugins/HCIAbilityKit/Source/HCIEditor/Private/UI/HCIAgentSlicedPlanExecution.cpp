@@ -0,0 +1,338 @@
+#include "UI/HCIAgentSlicedPlanExecution.h"
+
+#include "Agent/Tools/HCIToolRegistry.h"
+#include "Common/HCITrace.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Framework/Docking/TabManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/SBoxPanel.h"
+#include "Widgets/SWindow.h"
+#include "Widgets/Text/STextBlock.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogHCISlicedExecution, Log, All);
+
+namespace
+{
+static TAutoConsoleVariable<float> CVarHCIExecutorFrameBudgetMs(
+	TEXT("HCI.Executor.FrameBudgetMs"),
+	8.0f,
+	TEXT("Time budget per editor frame for sliced plan execution. At least one step runs per frame; a single long step is not split."),
+	ECVF_Default);
+
+// Minimum gap between Slate pumps issued from inside a long step.
+static constexpr double HCISlicedExecutionPumpIntervalSeconds = 0.05;
+} // namespace
+
+TSharedRef<FHCIAgentSlicedPlanExecution> FHCIAgentSlicedPlanExecution::Start(
+	const FHCIAgentPlan& Plan,
+	const bool bDryRun,
+	const bool bUserConfirmedWriteSteps,
+	FOnStepBegin OnStepBegin,
+	FOnAssetProgress OnAssetProgress,
+	FOnCompleted OnCompleted)
+{
+	check(IsInGameThread());
+
+	TSharedRef<FHCIAgentSlicedPlanExecution> Execution =
+		MakeShareable(new FHCIAgentSlicedPlanExecution(Plan, bDryRun, bUserConfirmedWriteSteps));
+	Execution->OnAssetProgress = MoveTemp(OnAssetProgress);
+	Execution->OnCompleted = MoveTemp(OnCompleted);
+	Execution->Cancellation = MakeShared<FHCIAgentExecutionCancellation>();
+
+	FHCIAgentPlanPreviewWindow::BuildExecutorOptions(
+		Execution->Plan,
+		bDryRun,
+		bUserConfirmedWriteSteps,
+		MoveTemp(OnStepBegin),
+		Execution->Options);
+	Execution->Options.Cancellation = Execution->Cancellation;
+	// The execution owns the run that invokes this callback, so a raw pointer cannot dangle.
+	FHCIAgentSlicedPlanExecution* RawExecution = &Execution.Get();
+	Execution->Options.OnAssetProgress = [RawExecution](const int32 StepIndex, const int32 ProcessedAssets, const int32 TotalAssets)
+	{
+		RawExecution->HandleAssetProgress(StepIndex, ProcessedAssets, TotalAssets);
+	};
+
+	Execution->BusinessTransaction = FHCIAgentPlanPreviewWindow::BeginBusinessTransaction(
+		Execution->Plan,
+		bDryRun,
+		bUserConfirmedWriteSteps);
+	Execution->OpenCommitGuardWindow();
+	Execution->Run = MakeUnique<FHCIAgentExecutorRun>(
+		Execution->Plan,
+		FHCIToolRegistry::GetReadOnly(),
+		Execution->ValidationContext,
+		Execution->Options);
+	Execution->StartSeconds = FPlatformTime::Seconds();
+	{
+		HCI_TRACE_REQUEST_SCOPE(Execution->Plan.RequestId);
+		Execution->Run->Start();
+	}
+
+	// The ticker keeps the execution alive until Tick returns false.
+	Execution->TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+		[Execution](const float DeltaTime)
+		{
+			return Execution->Tick(DeltaTime);
+		}));
+
+	UE_LOG(
+		LogHCISlicedExecution,
+		Display,
+		TEXT("[HCI][SlicedExecution] start request_id=%s steps=%d dry_run=%s budget_ms=%.1f"),
+		*Plan.RequestId,
+		Plan.Steps.Num(),
+		bDryRun ? TEXT("true") : TEXT("false"),
+		CVarHCIExecutorFrameBudgetMs.GetValueOnGameThread());
+	return Execution;
+}
+
+FHCIAgentSlicedPlanExecution::FHCIAgentSlicedPlanExecution(
+	const FHCIAgentPlan& InPlan,
+	const bool bInDryRun,
+	const bool bInUserConfirmedWriteSteps)
+	: Plan(InPlan)
+	, bDryRun(bInDryRun)
+	, bUserConfirmedWriteSteps(bInUserConfirmedWriteSteps)
+{
+}
+
+void FHCIAgentSlicedPlanExecution::RequestCancel()
+{
+	if (bCompleted || !Cancellation.IsValid() || Cancellation->IsRequested())
+	{
+		return;
+	}
+
+	Cancellation->Request();
+	UE_LOG(
+		LogHCISlicedExecution,
+		Display,
+		TEXT("[HCI][SlicedExecution] cancel_requested request_id=%s next_step=%d"),
+		*Plan.RequestId,
+		Run.IsValid() ? Run->GetNextStepIndex() : 0);
+}
+
+void FHCIAgentSlicedPlanExecution::Shutdown()
+{
+	if (bCompleted)
+	{
+		return;
+	}
+
+	RequestCancel();
+	OnCompleted = nullptr;
+	OnAssetProgress = nullptr;
+	if (bPumpingSlate)
+	{
+		// Called from a Slate pump inside a step: the running Tick finishes the cancelled run and
+		// returns false, which drops the ticker's reference.
+		return;
+	}
+
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	}
+	// With cancellation requested the executor stops at the next step boundary.
+	while (!Run->IsFinished())
+	{
+		Run->ExecuteNextStep();
+	}
+	Complete();
+}
+
+bool FHCIAgentSlicedPlanExecution::IsCancelRequested() const
+{
+	return Cancellation.IsValid() && Cancellation->IsRequested();
+}
+
+bool FHCIAgentSlicedPlanExecution::Tick(float DeltaTime)
+{
+	if (bCompleted)
+	{
+		return false;
+	}
+
+	HCI_TRACE_REQUEST_SCOPE(Plan.RequestId);
+	HCI_TRACE_SCOPE(TEXT("HCI.Executor.Slice"));
+	++TickCount;
+
+	const double BudgetSeconds = FMath::Max(0.0f, CVarHCIExecutorFrameBudgetMs.GetValueOnGameThread()) / 1000.0;
+	const double SliceStartSeconds = FPlatformTime::Seconds();
+	while (!Run->IsFinished())
+	{
+		Run->ExecuteNextStep();
+		if (FPlatformTime::Seconds() - SliceStartSeconds >= BudgetSeconds)
+		{
+			break;
+		}
+	}
+
+	if (!Run->IsFinished())
+	{
+		return true;
+	}
+
+	Complete();
+	return false;
+}
+
+void FHCIAgentSlicedPlanExecution::HandleAssetProgress(const int32 StepIndex, const int32 ProcessedAssets, const int32 TotalAssets)
+{
+	LastProgressStepIndex = StepIndex;
+	LastProcessedAssets = ProcessedAssets;
+	LastTotalAssets = TotalAssets;
+	if (OnAssetProgress)
+	{
+		OnAssetProgress(StepIndex, Plan.Steps.Num(), ProcessedAssets, TotalAssets);
+	}
+
+	// A single step over thousands of assets would otherwise freeze the UI for its whole duration.
+	// Pump Slate the same way FScopedSlowTask does so the progress bar repaints and the stop button
+	// can be clicked; the executor and tool actions poll the cancellation token afterwards. During a
+	// commit the guard window is modal, so the pump delivers input to it alone.
+	const double NowSeconds = FPlatformTime::Seconds();
+	if (bPumpingSlate
+		|| NowSeconds - LastPumpSeconds < HCISlicedExecutionPumpIntervalSeconds
+		|| IsRunningCommandlet()
+		|| !FSlateApplication::IsInitialized())
+	{
+		return;
+	}
+
+	TGuardValue<bool> PumpGuard(bPumpingSlate, true);
+	LastPumpSeconds = NowSeconds;
+	FSlateApplication::Get().PumpMessages();
+	FSlateApplication::Get().Tick();
+}
+
+void FHCIAgentSlicedPlanExecution::Complete()
+{
+	bCompleted = true;
+	TickerHandle.Reset();
+	CloseCommitGuardWindow();
+	// End the undo record before anyone reacts to the result; a cancelled commit keeps its partial
+	// changes inside it, so a single Ctrl+Z still reverts everything that was applied.
+	BusinessTransaction.Reset();
+
+	const bool bRunOk = Run->WasRunOk();
+	const FHCIAgentExecutorRunResult RunResult = Run->ConsumeResult();
+	FHCIAgentPlanExecutionReport Report;
+	FHCIAgentPlanPreviewWindow::BuildExecutionReport(Plan, bDryRun, bRunOk, RunResult, Report);
+
+	UE_LOG(
+		LogHCISlicedExecution,
+		Display,
+		TEXT("[HCI][SlicedExecution] done request_id=%s terminal=%s executed=%d/%d ticks=%d wall_ms=%.1f"),
+		*Plan.RequestId,
+		*RunResult.TerminalStatus,
+		RunResult.ExecutedSteps,
+		Plan.Steps.Num(),
+		TickCount,
+		(FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+
+	const FOnCompleted Callback = MoveTemp(OnCompleted);
+	OnCompleted = nullptr;
+	if (Callback)
+	{
+		Callback(Report);
+	}
+}
+
+void FHCIAgentSlicedPlanExecution::OpenCommitGuardWindow()
+{
+	if (!BusinessTransaction.IsValid()
+		|| IsRunningCommandlet()
+		|| FApp::IsUnattended()
+		|| !FSlateApplication::IsInitialized())
+	{
+		return;
+	}
+
+	// Closed by Complete(), which runs before the execution is released, so a weak pointer is only a guard.
+	const TWeakPtr<FHCIAgentSlicedPlanExecution> WeakExecution = AsShared();
+	CommitGuardWindow = SNew(SWindow)
+		.Title(FText::FromString(TEXT("HCI：正在提交计划")))
+		.SizingRule(ESizingRule::Autosized)
+		.SupportsMinimize(false)
+		.SupportsMaximize(false)
+		.HasCloseButton(false)
+		[
+			SNew(SVerticalBox)
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(16.0f, 12.0f)
+			[
+				SNew(STextBlock)
+				.MinDesiredWidth(360.0f)
+				.Text_Lambda([WeakExecution]()
+				{
+					const TSharedPtr<FHCIAgentSlicedPlanExecution> Execution = WeakExecution.Pin();
+					return Execution.IsValid() ? Execution->GetCommitGuardText() : FText::GetEmpty();
+				})
+			]
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.HAlign(HAlign_Right)
+			.Padding(16.0f, 0.0f, 16.0f, 12.0f)
+			[
+				SNew(SButton)
+				.Text(FText::FromString(TEXT("停止")))
+				.IsEnabled_Lambda([WeakExecution]()
+				{
+					const TSharedPtr<FHCIAgentSlicedPlanExecution> Execution = WeakExecution.Pin();
+					return Execution.IsValid() && !Execution->IsCancelRequested();
+				})
+				.OnClicked_Lambda([WeakExecution]()
+				{
+					if (const TSharedPtr<FHCIAgentSlicedPlanExecution> Execution = WeakExecution.Pin())
+					{
+						Execution->RequestCancel();
+					}
+					return FReply::Handled();
+				})
+			]
+		];
+
+	// The slow-task flavour of AddModalWindow returns immediately; while the window is open Slate routes
+	// keyboard and mouse input to it only.
+	FSlateApplication::Get().AddModalWindow(
+		CommitGuardWindow.ToSharedRef(),
+		FGlobalTabmanager::Get()->GetRootWindow(),
+		/*bSlowTaskWindow=*/true);
+}
+
+void FHCIAgentSlicedPlanExecution::CloseCommitGuardWindow()
+{
+	if (CommitGuardWindow.IsValid())
+	{
+		CommitGuardWindow->RequestDestroyWindow();
+		CommitGuardWindow.Reset();
+	}
+}
+
+FText FHCIAgentSlicedPlanExecution::GetCommitGuardText() const
+{
+	// The executor advances NextStepIndex before running a step, so it is the 1-based number of the current one.
+	const int32 StepNumber = Run.IsValid() ? FMath::Clamp(Run->GetNextStepIndex(), 1, Plan.Steps.Num()) : 0;
+	if (IsCancelRequested())
+	{
+		return FText::FromString(TEXT("正在停止：当前资产批次完成后结束，已应用的修改可一次撤销。"));
+	}
+	if (LastTotalAssets > 0 && LastProgressStepIndex + 1 == StepNumber)
+	{
+		return FText::FromString(FString::Printf(
+			TEXT("正在执行第 %d/%d 步（资产 %d/%d），完成前编辑器暂不接受其他操作。"),
+			StepNumber,
+			Plan.Steps.Num(),
+			LastProcessedAssets,
+			LastTotalAssets));
+	}
+	return FText::FromString(FString::Printf(
+		TEXT("正在执行第 %d/%d 步，完成前编辑器暂不接受其他操作。"),
+		StepNumber,
+		Plan.Steps.Num()));
+}
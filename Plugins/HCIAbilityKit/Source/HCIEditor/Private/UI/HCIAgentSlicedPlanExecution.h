@@ -0,0 +1,73 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Agent/Executor/HCIAgentExecutor.h"
+#include "Containers/Ticker.h"
+#include "UI/HCIAgentPlanPreviewWindow.h"
+
+class SWindow;
+
+// Runs a plan through FHCIAgentExecutorRun from the core ticker, a few steps per frame, so the editor
+// stays responsive while a long commit is applied. Steps are never split across frames; inside a step,
+// per-asset progress callbacks pump Slate so the progress bar and the stop button keep working.
+// Cancellation is cooperative: the executor stops before the next step, and write tool actions poll
+// FHCIAgentToolActionRequest::ShouldStopAfterAsset and stop after the current asset batch.
+// A confirmed commit keeps its undo transaction open across frames, so for its whole duration a small
+// modal window takes all editor input; user edits and Ctrl+Z cannot land inside the HCI undo record.
+class HCIEDITOR_API FHCIAgentSlicedPlanExecution : public TSharedFromThis<FHCIAgentSlicedPlanExecution>
+{
+public:
+	using FOnStepBegin = TFunction<void(int32 /*StepIndex*/, int32 /*TotalSteps*/, const FHCIAgentPlanStep& /*Step*/)>;
+	using FOnAssetProgress = TFunction<void(int32 /*StepIndex*/, int32 /*TotalSteps*/, int32 /*ProcessedAssets*/, int32 /*TotalAssets*/)>;
+	using FOnCompleted = TFunction<void(const FHCIAgentPlanExecutionReport& /*Report*/)>;
+
+	// Game thread only. OnCompleted fires exactly once, from a later ticker callback (never re-entrantly from Start).
+	static TSharedRef<FHCIAgentSlicedPlanExecution> Start(
+		const FHCIAgentPlan& Plan,
+		bool bDryRun,
+		bool bUserConfirmedWriteSteps,
+		FOnStepBegin OnStepBegin,
+		FOnAssetProgress OnAssetProgress,
+		FOnCompleted OnCompleted);
+
+	void RequestCancel();
+	// Owner teardown: cancels, finishes the run at the current step boundary and closes the transaction
+	// without invoking OnCompleted, then removes the ticker so nothing keeps the execution alive.
+	void Shutdown();
+	bool IsCancelRequested() const;
+	bool IsRunning() const { return !bCompleted; }
+	const FString& GetRequestId() const { return Plan.RequestId; }
+
+private:
+	FHCIAgentSlicedPlanExecution(const FHCIAgentPlan& InPlan, bool bInDryRun, bool bInUserConfirmedWriteSteps);
+
+	bool Tick(float DeltaTime);
+	void HandleAssetProgress(int32 StepIndex, int32 ProcessedAssets, int32 TotalAssets);
+	void Complete();
+	void OpenCommitGuardWindow();
+	void CloseCommitGuardWindow();
+	FText GetCommitGuardText() const;
+
+	const FHCIAgentPlan Plan;
+	const bool bDryRun;
+	const bool bUserConfirmedWriteSteps;
+	const FHCIAgentPlanValidationContext ValidationContext;
+	FHCIAgentExecutorOptions Options;
+	TSharedPtr<FHCIAgentExecutionCancellation> Cancellation;
+	TUniquePtr<FHCIAgentExecutorRun> Run;
+	// Held across frames so the whole commit still lands as one undo record.
+	TUniquePtr<FHCICommitUndoScope> BusinessTransaction;
+
+	FOnAssetProgress OnAssetProgress;
+	FOnCompleted OnCompleted;
+	FTSTicker::FDelegateHandle TickerHandle;
+	TSharedPtr<SWindow> CommitGuardWindow;
+	int32 LastProgressStepIndex = 0;
+	int32 LastProcessedAssets = 0;
+	int32 LastTotalAssets = 0;
+	double LastPumpSeconds = 0.0;
+	int32 TickCount = 0;
+	double StartSeconds = 0.0;
+	bool bCompleted = false;
+	bool bPumpingSlate = false;
+};
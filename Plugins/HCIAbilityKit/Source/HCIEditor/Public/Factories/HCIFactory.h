@@ -6,6 +6,7 @@
 #include "HCIFactory.generated.h"
 
 struct FHCIParsedData;
+struct FHCIParseError;
 
 /**
  * HCI 技能组件工厂类
@@ -42,6 +43,16 @@ public:
 	/** 获取重导入处理器的优先级，数值越大优先级越高 */
 	virtual int32 GetPriority() const override { return 0; }
 
+	/**
+	 * 将已解析（含 Python 钩子）的数据写回资产：校验 representing_mesh、记录撤销快照、
+	 * 更新 AssetImportData 并刷新绑定的预览 Actor。不刷新搜索索引，由调用方单个或批量刷新。
+	 */
+	static bool ApplyReimportedData(
+		class UHCIAsset* Asset,
+		const FString& SourceFilename,
+		const FHCIParsedData& Parsed,
+		FHCIParseError& OutError);
+
 private:
 	/** 将解析后的数据应用到资产对象上 */
 	static void ApplyParsedToAsset(class UHCIAsset* Asset, const FHCIParsedData& Parsed);
@@ -99,6 +99,7 @@ public:
 	FString GetCurrentStateLabel() const;
 	bool CanCommitLastPlanFromChat() const;
 	bool CanCancelPendingPlanFromChat() const;
+	bool CanStopExecutionFromChat() const;
 	bool BuildLastPlanCardLines(TArray<FString>& OutLines) const;
 	bool BuildLastPlanApprovalCard(FHCIAgentUiApprovalCard& OutCard) const;
 	void GetCurrentProgressState(FHCIAgentUiProgressState& OutState) const;
@@ -107,6 +108,7 @@ public:
 	bool OpenLastPlanPreview();
 	bool CommitLastPlanFromChat();
 	bool CancelPendingPlanFromChat();
+	bool StopExecutionFromChat();
 	bool TryLocateLastExecutionTargetByIndex(int32 TargetIndex);
 
 	void ReloadQuickCommands();
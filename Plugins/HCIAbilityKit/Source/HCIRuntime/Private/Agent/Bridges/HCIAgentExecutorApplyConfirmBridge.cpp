@@ -1,37 +1,14 @@
 #include "Agent/Bridges/HCIAgentExecutorApplyConfirmBridge.h"
 
+#include "Agent/Contracts/HCIAgentContractDigest.h"
 #include "Agent/Contracts/StageF/HCIAgentApplyConfirmRequest.h"
 #include "Agent/Contracts/StageF/HCIAgentApplyRequest.h"
 #include "Agent/Executor/HCIDryRunDiff.h"
 #include "Common/HCITimeFormat.h"
-#include "Misc/Crc.h"
 #include "Misc/Guid.h"
 
 namespace
 {
-static FString HCI_BuildSelectionDigestFromReviewReport(const FHCIDryRunDiffReport& Report)
-{
-	FString Canonical;
-	Canonical.Reserve(Report.DiffItems.Num() * 96);
-	for (int32 RowIndex = 0; RowIndex < Report.DiffItems.Num(); ++RowIndex)
-	{
-		const FHCIDryRunDiffItem& Item = Report.DiffItems[RowIndex];
-		Canonical += FString::Printf(
-			TEXT("%d|%s|%s|%s|%s|%s|%s|%s\n"),
-			RowIndex,
-			*Item.ToolName,
-			*Item.AssetPath,
-			*Item.Field,
-			*FHCIDryRunDiff::RiskToString(Item.Risk),
-			*Item.SkipReason,
-			*FHCIDryRunDiff::ObjectTypeToString(Item.ObjectType),
-			*FHCIDryRunDiff::LocateStrategyToString(Item.LocateStrategy));
-	}
-
-	const uint32 Crc = FCrc::StrCrc32(*Canonical);
-	return FString::Printf(TEXT("crc32_%08X"), Crc);
-}
-
 static void HCI_CopyApplyRequestToConfirmRequest(
 	const FHCIAgentApplyRequest& ApplyRequest,
 	const bool bUserConfirmed,
@@ -85,8 +62,7 @@ bool FHCIAgentExecutorApplyConfirmBridge::BuildConfirmRequest(
 		return true;
 	}
 
-	const FString CurrentSelectionDigest = HCI_BuildSelectionDigestFromReviewReport(CurrentReviewReport);
-	if (ApplyRequest.SelectionDigest != CurrentSelectionDigest)
+	if (!FHCIAgentContractDigest::MatchesSelectionDigest(ApplyRequest.SelectionDigest, CurrentReviewReport))
 	{
 		OutConfirmRequest.bReadyToExecute = false;
 		OutConfirmRequest.ErrorCode = TEXT("E4202");
@@ -1,38 +1,15 @@
 #include "Agent/Bridges/HCIAgentExecutorExecuteTicketBridge.h"
 
+#include "Agent/Contracts/HCIAgentContractDigest.h"
 #include "Agent/Contracts/StageF/HCIAgentApplyConfirmRequest.h"
 #include "Agent/Contracts/StageF/HCIAgentApplyRequest.h"
 #include "Agent/Contracts/StageF/HCIAgentExecuteTicket.h"
 #include "Agent/Executor/HCIDryRunDiff.h"
 #include "Common/HCITimeFormat.h"
-#include "Misc/Crc.h"
 #include "Misc/Guid.h"
 
 namespace
 {
-static FString HCI_BuildSelectionDigestFromReviewReport_F11(const FHCIDryRunDiffReport& Report)
-{
-	FString Canonical;
-	Canonical.Reserve(Report.DiffItems.Num() * 96);
-	for (int32 RowIndex = 0; RowIndex < Report.DiffItems.Num(); ++RowIndex)
-	{
-		const FHCIDryRunDiffItem& Item = Report.DiffItems[RowIndex];
-		Canonical += FString::Printf(
-			TEXT("%d|%s|%s|%s|%s|%s|%s|%s\n"),
-			RowIndex,
-			*Item.ToolName,
-			*Item.AssetPath,
-			*Item.Field,
-			*FHCIDryRunDiff::RiskToString(Item.Risk),
-			*Item.SkipReason,
-			*FHCIDryRunDiff::ObjectTypeToString(Item.ObjectType),
-			*FHCIDryRunDiff::LocateStrategyToString(Item.LocateStrategy));
-	}
-
-	const uint32 Crc = FCrc::StrCrc32(*Canonical);
-	return FString::Printf(TEXT("crc32_%08X"), Crc);
-}
-
 static void HCI_CopyConfirmRequestToExecuteTicket(
 	const FHCIAgentApplyConfirmRequest& ConfirmRequest,
 	FHCIAgentExecuteTicket& OutExecuteTicket)
@@ -104,8 +81,7 @@ bool FHCIAgentExecutorExecuteTicketBridge::BuildExecuteTicket(
 		return true;
 	}
 
-	const FString CurrentSelectionDigest = HCI_BuildSelectionDigestFromReviewReport_F11(CurrentReviewReport);
-	if (ConfirmRequest.SelectionDigest != CurrentSelectionDigest)
+	if (!FHCIAgentContractDigest::MatchesSelectionDigest(ConfirmRequest.SelectionDigest, CurrentReviewReport))
 	{
 		OutExecuteTicket.bReadyToSimulateExecute = false;
 		OutExecuteTicket.ErrorCode = TEXT("E4202");
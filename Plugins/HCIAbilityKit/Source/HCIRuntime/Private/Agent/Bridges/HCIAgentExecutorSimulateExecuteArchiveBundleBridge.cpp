@@ -1,5 +1,6 @@
 #include "Agent/Bridges/HCIAgentExecutorSimulateExecuteArchiveBundleBridge.h"
 
+#include "Agent/Contracts/HCIAgentContractDigest.h"
 #include "Agent/Contracts/StageF/HCIAgentApplyConfirmRequest.h"
 #include "Agent/Contracts/StageF/HCIAgentApplyRequest.h"
 #include "Agent/Contracts/StageF/HCIAgentExecuteTicket.h"
@@ -8,72 +9,45 @@
 #include "Agent/Contracts/StageF/HCIAgentSimulateExecuteReceipt.h"
 #include "Agent/Executor/HCIDryRunDiff.h"
 #include "Common/HCITimeFormat.h"
-#include "Misc/Crc.h"
 #include "Misc/Guid.h"
 
 namespace
 {
-static FString HCI_BuildSelectionDigestFromReviewReport_F14(const FHCIDryRunDiffReport& Report)
-{
-	FString Canonical;
-	Canonical.Reserve(Report.DiffItems.Num() * 96);
-	for (int32 RowIndex = 0; RowIndex < Report.DiffItems.Num(); ++RowIndex)
-	{
-		const FHCIDryRunDiffItem& Item = Report.DiffItems[RowIndex];
-		Canonical += FString::Printf(
-			TEXT("%d|%s|%s|%s|%s|%s|%s|%s\n"),
-			RowIndex,
-			*Item.ToolName,
-			*Item.AssetPath,
-			*Item.Field,
-			*FHCIDryRunDiff::RiskToString(Item.Risk),
-			*Item.SkipReason,
-			*FHCIDryRunDiff::ObjectTypeToString(Item.ObjectType),
-			*FHCIDryRunDiff::LocateStrategyToString(Item.LocateStrategy));
-	}
-
-	const uint32 Crc = FCrc::StrCrc32(*Canonical);
-	return FString::Printf(TEXT("crc32_%08X"), Crc);
-}
-
 static FString HCI_BuildArchiveDigest_F14(const FHCIAgentSimulateExecuteArchiveBundle& Bundle)
 {
-	FString Canonical;
-	Canonical += FString::Printf(
-		TEXT("%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s\n"),
-		*Bundle.SimFinalReportId,
-		*Bundle.SimExecuteReceiptId,
-		*Bundle.ExecuteTicketId,
-		*Bundle.ConfirmRequestId,
-		*Bundle.ApplyRequestId,
-		*Bundle.ReviewRequestId,
-		*Bundle.SelectionDigest,
-		*Bundle.TerminalStatus,
-		*Bundle.ArchiveStatus,
-		Bundle.bUserConfirmed ? TEXT("1") : TEXT("0"),
-		Bundle.bReadyToSimulateExecute ? TEXT("1") : TEXT("0"),
-		Bundle.bSimulatedDispatchAccepted ? TEXT("1") : TEXT("0"),
-		Bundle.bSimulationCompleted ? TEXT("1") : TEXT("0"),
-		Bundle.bArchiveReady ? TEXT("1") : TEXT("0"));
+	FHCIAgentDigestBuilder Digest;
+	Digest.Field(Bundle.SimFinalReportId)
+		.Field(Bundle.SimExecuteReceiptId)
+		.Field(Bundle.ExecuteTicketId)
+		.Field(Bundle.ConfirmRequestId)
+		.Field(Bundle.ApplyRequestId)
+		.Field(Bundle.ReviewRequestId)
+		.Field(Bundle.SelectionDigest)
+		.Field(Bundle.TerminalStatus)
+		.Field(Bundle.ArchiveStatus)
+		.Field(Bundle.bUserConfirmed)
+		.Field(Bundle.bReadyToSimulateExecute)
+		.Field(Bundle.bSimulatedDispatchAccepted)
+		.Field(Bundle.bSimulationCompleted)
+		.Field(Bundle.bArchiveReady)
+		.EndRow();
 
 	for (const FHCIAgentApplyRequestItem& Item : Bundle.Items)
 	{
-		Canonical += FString::Printf(
-			TEXT("%d|%s|%s|%s|%s|%s|%s|%s|%s|%s\n"),
-			Item.RowIndex,
-			*Item.ToolName,
-			*Item.AssetPath,
-			*Item.Field,
-			*Item.SkipReason,
-			Item.bBlocked ? TEXT("1") : TEXT("0"),
-			*FHCIDryRunDiff::RiskToString(Item.Risk),
-			*FHCIDryRunDiff::ObjectTypeToString(Item.ObjectType),
-			*FHCIDryRunDiff::LocateStrategyToString(Item.LocateStrategy),
-			*Item.EvidenceKey);
+		Digest.Field(Item.RowIndex)
+			.Field(Item.ToolName)
+			.Field(Item.AssetPath)
+			.Field(Item.Field)
+			.Field(Item.SkipReason)
+			.Field(Item.bBlocked)
+			.Field(FHCIDryRunDiff::RiskToString(Item.Risk))
+			.Field(FHCIDryRunDiff::ObjectTypeToString(Item.ObjectType))
+			.Field(FHCIDryRunDiff::LocateStrategyToString(Item.LocateStrategy))
+			.Field(Item.EvidenceKey)
+			.EndRow();
 	}
 
-	const uint32 Crc = FCrc::StrCrc32(*Canonical);
-	return FString::Printf(TEXT("crc32_%08X"), Crc);
+	return Digest.Finalize();
 }
 
 static void HCI_CopyFinalReportToArchiveBundle(
@@ -217,8 +191,7 @@ bool FHCIAgentExecutorSimulateExecuteArchiveBundleBridge::BuildSimulateExecuteAr
 		return true;
 	}
 
-	const FString CurrentSelectionDigest = HCI_BuildSelectionDigestFromReviewReport_F14(CurrentReviewReport);
-	if (SimFinalReport.SelectionDigest != CurrentSelectionDigest)
+	if (!FHCIAgentContractDigest::MatchesSelectionDigest(SimFinalReport.SelectionDigest, CurrentReviewReport))
 	{
 		OutBundle.ErrorCode = TEXT("E4202");
 		OutBundle.Reason = TEXT("selection_digest_mismatch");
@@ -1,5 +1,6 @@
 #include "Agent/Bridges/HCIAgentExecutorSimulateExecuteFinalReportBridge.h"
 
+#include "Agent/Contracts/HCIAgentContractDigest.h"
 #include "Agent/Contracts/StageF/HCIAgentApplyConfirmRequest.h"
 #include "Agent/Contracts/StageF/HCIAgentApplyRequest.h"
 #include "Agent/Contracts/StageF/HCIAgentExecuteTicket.h"
@@ -7,34 +8,10 @@
 #include "Agent/Contracts/StageF/HCIAgentSimulateExecuteReceipt.h"
 #include "Agent/Executor/HCIDryRunDiff.h"
 #include "Common/HCITimeFormat.h"
-#include "Misc/Crc.h"
 #include "Misc/Guid.h"
 
 namespace
 {
-static FString HCI_BuildSelectionDigestFromReviewReport_F13(const FHCIDryRunDiffReport& Report)
-{
-	FString Canonical;
-	Canonical.Reserve(Report.DiffItems.Num() * 96);
-	for (int32 RowIndex = 0; RowIndex < Report.DiffItems.Num(); ++RowIndex)
-	{
-		const FHCIDryRunDiffItem& Item = Report.DiffItems[RowIndex];
-		Canonical += FString::Printf(
-			TEXT("%d|%s|%s|%s|%s|%s|%s|%s\n"),
-			RowIndex,
-			*Item.ToolName,
-			*Item.AssetPath,
-			*Item.Field,
-			*FHCIDryRunDiff::RiskToString(Item.Risk),
-			*Item.SkipReason,
-			*FHCIDryRunDiff::ObjectTypeToString(Item.ObjectType),
-			*FHCIDryRunDiff::LocateStrategyToString(Item.LocateStrategy));
-	}
-
-	const uint32 Crc = FCrc::StrCrc32(*Canonical);
-	return FString::Printf(TEXT("crc32_%08X"), Crc);
-}
-
 static void HCI_CopyReceiptToFinalReport(
 	const FHCIAgentSimulateExecuteReceipt& Receipt,
 	FHCIAgentSimulateExecuteFinalReport& OutReport)
@@ -145,8 +122,7 @@ bool FHCIAgentExecutorSimulateExecuteFinalReportBridge::BuildSimulateExecuteFina
 		return true;
 	}
 
-	const FString CurrentSelectionDigest = HCI_BuildSelectionDigestFromReviewReport_F13(CurrentReviewReport);
-	if (SimExecuteReceipt.SelectionDigest != CurrentSelectionDigest)
+	if (!FHCIAgentContractDigest::MatchesSelectionDigest(SimExecuteReceipt.SelectionDigest, CurrentReviewReport))
 	{
 		OutReport.ErrorCode = TEXT("E4202");
 		OutReport.Reason = TEXT("selection_digest_mismatch");
@@ -1,5 +1,6 @@
 #include "Agent/Bridges/HCIAgentExecutorSimulateExecuteHandoffEnvelopeBridge.h"
 
+#include "Agent/Contracts/HCIAgentContractDigest.h"
 #include "Agent/Contracts/StageF/HCIAgentApplyConfirmRequest.h"
 #include "Agent/Contracts/StageF/HCIAgentApplyRequest.h"
 #include "Agent/Contracts/StageF/HCIAgentExecuteTicket.h"
@@ -9,77 +10,50 @@
 #include "Agent/Contracts/StageF/HCIAgentSimulateExecuteReceipt.h"
 #include "Agent/Executor/HCIDryRunDiff.h"
 #include "Common/HCITimeFormat.h"
-#include "Misc/Crc.h"
 #include "Misc/Guid.h"
 
 namespace
 {
-static FString HCI_BuildSelectionDigestFromReviewReport_F15(const FHCIDryRunDiffReport& Report)
-{
-	FString Canonical;
-	Canonical.Reserve(Report.DiffItems.Num() * 96);
-	for (int32 RowIndex = 0; RowIndex < Report.DiffItems.Num(); ++RowIndex)
-	{
-		const FHCIDryRunDiffItem& Item = Report.DiffItems[RowIndex];
-		Canonical += FString::Printf(
-			TEXT("%d|%s|%s|%s|%s|%s|%s|%s\n"),
-			RowIndex,
-			*Item.ToolName,
-			*Item.AssetPath,
-			*Item.Field,
-			*FHCIDryRunDiff::RiskToString(Item.Risk),
-			*Item.SkipReason,
-			*FHCIDryRunDiff::ObjectTypeToString(Item.ObjectType),
-			*FHCIDryRunDiff::LocateStrategyToString(Item.LocateStrategy));
-	}
-
-	const uint32 Crc = FCrc::StrCrc32(*Canonical);
-	return FString::Printf(TEXT("crc32_%08X"), Crc);
-}
-
 static FString HCI_BuildHandoffDigest_F15(const FHCIAgentSimulateExecuteHandoffEnvelope& Envelope)
 {
-	FString Canonical;
-	Canonical += FString::Printf(
-		TEXT("%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s\n"),
-		*Envelope.SimArchiveBundleId,
-		*Envelope.SimFinalReportId,
-		*Envelope.SimExecuteReceiptId,
-		*Envelope.ExecuteTicketId,
-		*Envelope.ConfirmRequestId,
-		*Envelope.ApplyRequestId,
-		*Envelope.ReviewRequestId,
-		*Envelope.SelectionDigest,
-		*Envelope.ArchiveDigest,
-		*Envelope.TerminalStatus,
-		*Envelope.ArchiveStatus,
-		*Envelope.HandoffStatus,
-		Envelope.bUserConfirmed ? TEXT("1") : TEXT("0"),
-		Envelope.bReadyToSimulateExecute ? TEXT("1") : TEXT("0"),
-		Envelope.bSimulatedDispatchAccepted ? TEXT("1") : TEXT("0"),
-		Envelope.bSimulationCompleted ? TEXT("1") : TEXT("0"),
-		Envelope.bArchiveReady ? TEXT("1") : TEXT("0"));
-
-	Canonical += FString::Printf(TEXT("%s|%s\n"), Envelope.bHandoffReady ? TEXT("1") : TEXT("0"), *Envelope.HandoffTarget);
+	FHCIAgentDigestBuilder Digest;
+	Digest.Field(Envelope.SimArchiveBundleId)
+		.Field(Envelope.SimFinalReportId)
+		.Field(Envelope.SimExecuteReceiptId)
+		.Field(Envelope.ExecuteTicketId)
+		.Field(Envelope.ConfirmRequestId)
+		.Field(Envelope.ApplyRequestId)
+		.Field(Envelope.ReviewRequestId)
+		.Field(Envelope.SelectionDigest)
+		.Field(Envelope.ArchiveDigest)
+		.Field(Envelope.TerminalStatus)
+		.Field(Envelope.ArchiveStatus)
+		.Field(Envelope.HandoffStatus)
+		.Field(Envelope.bUserConfirmed)
+		.Field(Envelope.bReadyToSimulateExecute)
+		.Field(Envelope.bSimulatedDispatchAccepted)
+		.Field(Envelope.bSimulationCompleted)
+		.Field(Envelope.bArchiveReady)
+		.EndRow();
+
+	Digest.Field(Envelope.bHandoffReady).Field(Envelope.HandoffTarget).EndRow();
 
 	for (const FHCIAgentApplyRequestItem& Item : Envelope.Items)
 	{
-		Canonical += FString::Printf(
-			TEXT("%d|%s|%s|%s|%s|%s|%s|%s|%s|%s\n"),
-			Item.RowIndex,
-			*Item.ToolName,
-			*Item.AssetPath,
-			*Item.Field,
-			*Item.SkipReason,
-			Item.bBlocked ? TEXT("1") : TEXT("0"),
-			*FHCIDryRunDiff::RiskToString(Item.Risk),
-			*FHCIDryRunDiff::ObjectTypeToString(Item.ObjectType),
-			*FHCIDryRunDiff::LocateStrategyToString(Item.LocateStrategy),
-			*Item.EvidenceKey);
+		Digest.Field(Item.RowIndex)
+			.Field(Item.ToolName)
+			.Field(Item.AssetPath)
+			.Field(Item.Field)
+			.Field(Item.SkipReason)
+			.Field(Item.bBlocked)
+			.Field(FHCIDryRunDiff::RiskToString(Item.Risk))
+			.Field(FHCIDryRunDiff::ObjectTypeToString(Item.ObjectType))
+			.Field(FHCIDryRunDiff::LocateStrategyToString(Item.LocateStrategy))
+			.Field(Item.EvidenceKey)
+			.EndRow();
 	}
 
-	const uint32 Crc = FCrc::StrCrc32(*Canonical);
-	return FString::Printf(TEXT("crc32_%08X"), Crc);
+	return Digest.Finalize();
 }
 
 static void HCI_CopyArchiveBundleToHandoffEnvelope(
@@ -246,8 +220,7 @@ bool FHCIAgentExecutorSimulateExecuteHandoffEnvelopeBridge::BuildSimulateExecute
 		return true;
 	}
 
-	const FString CurrentSelectionDigest = HCI_BuildSelectionDigestFromReviewReport_F15(CurrentReviewReport);
-	if (SimArchiveBundle.SelectionDigest != CurrentSelectionDigest)
+	if (!FHCIAgentContractDigest::MatchesSelectionDigest(SimArchiveBundle.SelectionDigest, CurrentReviewReport))
 	{
 		OutEnvelope.ErrorCode = TEXT("E4202");
 		OutEnvelope.Reason = TEXT("selection_digest_mismatch");
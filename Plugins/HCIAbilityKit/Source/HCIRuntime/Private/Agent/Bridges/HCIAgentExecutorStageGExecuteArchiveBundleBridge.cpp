@@ -1,5 +1,6 @@
 #include "Agent/Bridges/HCIAgentExecutorStageGExecuteArchiveBundleBridge.h"
 
+#include "Agent/Contracts/HCIAgentContractDigest.h"
 #include "Agent/Contracts/StageF/HCIAgentApplyConfirmRequest.h"
 #include "Agent/Contracts/StageF/HCIAgentApplyRequest.h"
 #include "Agent/Contracts/StageF/HCIAgentExecuteTicket.h"
@@ -18,117 +19,93 @@
 #include "Agent/Contracts/StageG/HCIAgentStageGWriteEnableRequest.h"
 #include "Agent/Executor/HCIDryRunDiff.h"
 #include "Common/HCITimeFormat.h"
-#include "Misc/Crc.h"
+#include "Common/HCITrace.h"
 #include "Misc/Guid.h"
 
 namespace
 {
-static FString HCI_BuildSelectionDigestFromReviewReport_G9(const FHCIDryRunDiffReport& Report)
-{
-	FString Canonical;
-	Canonical.Reserve(Report.DiffItems.Num() * 96);
-	for (int32 RowIndex = 0; RowIndex < Report.DiffItems.Num(); ++RowIndex)
-	{
-		const FHCIDryRunDiffItem& Item = Report.DiffItems[RowIndex];
-		Canonical += FString::Printf(
-			TEXT("%d|%s|%s|%s|%s|%s|%s|%s\n"),
-			RowIndex,
-			*Item.ToolName,
-			*Item.AssetPath,
-			*Item.Field,
-			*FHCIDryRunDiff::RiskToString(Item.Risk),
-			*Item.SkipReason,
-			*FHCIDryRunDiff::ObjectTypeToString(Item.ObjectType),
-			*FHCIDryRunDiff::LocateStrategyToString(Item.LocateStrategy));
-	}
-	return FString::Printf(TEXT("crc32_%08X"), FCrc::StrCrc32(*Canonical));
-}
-
 static FString HCI_BuildStageGExecuteArchiveBundleDigest_G9(const FHCIAgentStageGExecuteArchiveBundle& Bundle)
 {
-	FString Canonical;
-	Canonical += FString::Printf(
-		TEXT("%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s\n"),
-		*Bundle.StageGExecuteFinalReportId,
-		*Bundle.StageGExecuteCommitReceiptId,
-		*Bundle.StageGExecuteCommitRequestId,
-		*Bundle.StageGExecuteDispatchReceiptId,
-		*Bundle.StageGExecuteDispatchRequestId,
-		*Bundle.StageGExecutePermitTicketId,
-		*Bundle.StageGWriteEnableRequestId,
-		*Bundle.StageGExecuteIntentId,
-		*Bundle.SimHandoffEnvelopeId,
-		*Bundle.SimArchiveBundleId,
-		*Bundle.SimFinalReportId,
-		*Bundle.SimExecuteReceiptId,
-		*Bundle.ExecuteTicketId,
-		*Bundle.ConfirmRequestId,
-		*Bundle.ApplyRequestId,
-		*Bundle.ReviewRequestId,
-		*Bundle.SelectionDigest,
-		*Bundle.ArchiveDigest,
-		*Bundle.HandoffDigest,
-		*Bundle.ExecuteIntentDigest,
-		*Bundle.StageGWriteEnableDigest,
-		*Bundle.StageGExecutePermitDigest,
-		*Bundle.StageGExecuteDispatchDigest,
-		*Bundle.StageGExecuteDispatchReceiptDigest,
-		*Bundle.StageGExecuteCommitRequestDigest,
-		*Bundle.StageGExecuteCommitReceiptDigest,
-		*Bundle.StageGExecuteFinalReportDigest,
-		*Bundle.TerminalStatus,
-		*Bundle.ArchiveStatus,
-		*Bundle.HandoffStatus,
-		*Bundle.StageGStatus,
-		*Bundle.StageGWriteStatus,
-		*Bundle.StageGExecuteFinalReportStatus,
-		*Bundle.StageGExecuteArchiveBundleStatus);
+	FHCIAgentDigestBuilder Digest;
+	Digest.Field(Bundle.StageGExecuteFinalReportId)
+		.Field(Bundle.StageGExecuteCommitReceiptId)
+		.Field(Bundle.StageGExecuteCommitRequestId)
+		.Field(Bundle.StageGExecuteDispatchReceiptId)
+		.Field(Bundle.StageGExecuteDispatchRequestId)
+		.Field(Bundle.StageGExecutePermitTicketId)
+		.Field(Bundle.StageGWriteEnableRequestId)
+		.Field(Bundle.StageGExecuteIntentId)
+		.Field(Bundle.SimHandoffEnvelopeId)
+		.Field(Bundle.SimArchiveBundleId)
+		.Field(Bundle.SimFinalReportId)
+		.Field(Bundle.SimExecuteReceiptId)
+		.Field(Bundle.ExecuteTicketId)
+		.Field(Bundle.ConfirmRequestId)
+		.Field(Bundle.ApplyRequestId)
+		.Field(Bundle.ReviewRequestId)
+		.Field(Bundle.SelectionDigest)
+		.Field(Bundle.ArchiveDigest)
+		.Field(Bundle.HandoffDigest)
+		.Field(Bundle.ExecuteIntentDigest)
+		.Field(Bundle.StageGWriteEnableDigest)
+		.Field(Bundle.StageGExecutePermitDigest)
+		.Field(Bundle.StageGExecuteDispatchDigest)
+		.Field(Bundle.StageGExecuteDispatchReceiptDigest)
+		.Field(Bundle.StageGExecuteCommitRequestDigest)
+		.Field(Bundle.StageGExecuteCommitReceiptDigest)
+		.Field(Bundle.StageGExecuteFinalReportDigest)
+		.Field(Bundle.TerminalStatus)
+		.Field(Bundle.ArchiveStatus)
+		.Field(Bundle.HandoffStatus)
+		.Field(Bundle.StageGStatus)
+		.Field(Bundle.StageGWriteStatus)
+		.Field(Bundle.StageGExecuteFinalReportStatus)
+		.Field(Bundle.StageGExecuteArchiveBundleStatus)
+		.EndRow();
 
-	Canonical += FString::Printf(
-		TEXT("%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s\n"),
-		Bundle.bUserConfirmed ? TEXT("1") : TEXT("0"),
-		Bundle.bReadyToSimulateExecute ? TEXT("1") : TEXT("0"),
-		Bundle.bSimulatedDispatchAccepted ? TEXT("1") : TEXT("0"),
-		Bundle.bSimulationCompleted ? TEXT("1") : TEXT("0"),
-		Bundle.bArchiveReady ? TEXT("1") : TEXT("0"),
-		Bundle.bHandoffReady ? TEXT("1") : TEXT("0"),
-		Bundle.bWriteEnabled ? TEXT("1") : TEXT("0"),
-		Bundle.bReadyForStageGEntry ? TEXT("1") : TEXT("0"),
-		Bundle.bWriteEnableConfirmed ? TEXT("1") : TEXT("0"),
-		Bundle.bReadyForStageGExecute ? TEXT("1") : TEXT("0"),
-		Bundle.bStageGExecutePermitReady ? TEXT("1") : TEXT("0"),
-		Bundle.bExecuteDispatchConfirmed ? TEXT("1") : TEXT("0"),
-		Bundle.bStageGExecuteDispatchReady ? TEXT("1") : TEXT("0"),
-		Bundle.bStageGExecuteDispatchAccepted ? TEXT("1") : TEXT("0"),
-		Bundle.bStageGExecuteDispatchReceiptReady ? TEXT("1") : TEXT("0"),
-		Bundle.bExecuteCommitConfirmed ? TEXT("1") : TEXT("0"),
-		Bundle.bStageGExecuteCommitRequestReady ? TEXT("1") : TEXT("0"),
-		Bundle.bStageGExecuteCommitAccepted ? TEXT("1") : TEXT("0"),
-		Bundle.bStageGExecuteCommitReceiptReady ? TEXT("1") : TEXT("0"),
-		Bundle.bStageGExecuteFinalized ? TEXT("1") : TEXT("0"),
-		Bundle.bStageGExecuteFinalReportReady ? TEXT("1") : TEXT("0"),
-		Bundle.bStageGExecuteArchived ? TEXT("1") : TEXT("0"),
-		Bundle.bStageGExecuteArchiveBundleReady ? TEXT("1") : TEXT("0"));
+	Digest.Field(Bundle.bUserConfirmed)
+		.Field(Bundle.bReadyToSimulateExecute)
+		.Field(Bundle.bSimulatedDispatchAccepted)
+		.Field(Bundle.bSimulationCompleted)
+		.Field(Bundle.bArchiveReady)
+		.Field(Bundle.bHandoffReady)
+		.Field(Bundle.bWriteEnabled)
+		.Field(Bundle.bReadyForStageGEntry)
+		.Field(Bundle.bWriteEnableConfirmed)
+		.Field(Bundle.bReadyForStageGExecute)
+		.Field(Bundle.bStageGExecutePermitReady)
+		.Field(Bundle.bExecuteDispatchConfirmed)
+		.Field(Bundle.bStageGExecuteDispatchReady)
+		.Field(Bundle.bStageGExecuteDispatchAccepted)
+		.Field(Bundle.bStageGExecuteDispatchReceiptReady)
+		.Field(Bundle.bExecuteCommitConfirmed)
+		.Field(Bundle.bStageGExecuteCommitRequestReady)
+		.Field(Bundle.bStageGExecuteCommitAccepted)
+		.Field(Bundle.bStageGExecuteCommitReceiptReady)
+		.Field(Bundle.bStageGExecuteFinalized)
+		.Field(Bundle.bStageGExecuteFinalReportReady)
+		.Field(Bundle.bStageGExecuteArchived)
+		.Field(Bundle.bStageGExecuteArchiveBundleReady)
+		.EndRow();
 
-	Canonical += FString::Printf(TEXT("%s|%s|%s\n"), *Bundle.ExecuteTarget, *Bundle.HandoffTarget, *Bundle.Reason);
+	Digest.Field(Bundle.ExecuteTarget).Field(Bundle.HandoffTarget).Field(Bundle.Reason).EndRow();
 
 	for (const FHCIAgentApplyRequestItem& Item : Bundle.Items)
 	{
-		Canonical += FString::Printf(
-			TEXT("%d|%s|%s|%s|%s|%s|%s|%s|%s|%s\n"),
-			Item.RowIndex,
-			*Item.ToolName,
-			*Item.AssetPath,
-			*Item.Field,
-			*Item.SkipReason,
-			Item.bBlocked ? TEXT("1") : TEXT("0"),
-			*FHCIDryRunDiff::RiskToString(Item.Risk),
-			*FHCIDryRunDiff::ObjectTypeToString(Item.ObjectType),
-			*FHCIDryRunDiff::LocateStrategyToString(Item.LocateStrategy),
-			*Item.EvidenceKey);
+		Digest.Field(Item.RowIndex)
+			.Field(Item.ToolName)
+			.Field(Item.AssetPath)
+			.Field(Item.Field)
+			.Field(Item.SkipReason)
+			.Field(Item.bBlocked)
+			.Field(FHCIDryRunDiff::RiskToString(Item.Risk))
+			.Field(FHCIDryRunDiff::ObjectTypeToString(Item.ObjectType))
+			.Field(FHCIDryRunDiff::LocateStrategyToString(Item.LocateStrategy))
+			.Field(Item.EvidenceKey)
+			.EndRow();
 	}
 
-	return FString::Printf(TEXT("crc32_%08X"), FCrc::StrCrc32(*Canonical));
+	return Digest.Finalize();
 }
 
 static void HCI_CopyFinalReportToArchiveBundle_G9(
@@ -234,6 +211,7 @@ bool FHCIAgentExecutorStageGExecuteArchiveBundleBridge::BuildStageGExecuteArchiv
 	const FHCIDryRunDiffReport& CurrentReviewReport,
 	FHCIAgentStageGExecuteArchiveBundle& OutBundle)
 {
+	HCI_TRACE_SCOPE(TEXT("HCI.StageG.BuildStageGExecuteArchiveBundle"));
 	HCI_CopyFinalReportToArchiveBundle_G9(StageGExecuteFinalReport, OutBundle);
 
 	auto FinalizeAndReturn = [&OutBundle]() -> bool
@@ -447,7 +425,7 @@ bool FHCIAgentExecutorStageGExecuteArchiveBundleBridge::BuildStageGExecuteArchiv
 		OutBundle.Reason = TEXT("selection_digest_mismatch");
 		return FinalizeAndReturn();
 	}
-	if (StageGExecuteFinalReport.SelectionDigest != HCI_BuildSelectionDigestFromReviewReport_G9(CurrentReviewReport))
+	if (!FHCIAgentContractDigest::MatchesSelectionDigest(StageGExecuteFinalReport.SelectionDigest, CurrentReviewReport))
 	{
 		OutBundle.ErrorCode = TEXT("E4202");
 		OutBundle.Reason = TEXT("selection_digest_mismatch");
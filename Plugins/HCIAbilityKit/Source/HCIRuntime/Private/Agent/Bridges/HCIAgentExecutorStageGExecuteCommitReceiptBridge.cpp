@@ -1,5 +1,6 @@
 #include "Agent/Bridges/HCIAgentExecutorStageGExecuteCommitReceiptBridge.h"
 
+#include "Agent/Contracts/HCIAgentContractDigest.h"
 #include "Agent/Contracts/StageF/HCIAgentApplyConfirmRequest.h"
 #include "Agent/Contracts/StageF/HCIAgentApplyRequest.h"
 #include "Agent/Contracts/StageF/HCIAgentExecuteTicket.h"
@@ -16,109 +17,85 @@
 #include "Agent/Contracts/StageG/HCIAgentStageGWriteEnableRequest.h"
 #include "Agent/Executor/HCIDryRunDiff.h"
 #include "Common/HCITimeFormat.h"
-#include "Misc/Crc.h"
+#include "Common/HCITrace.h"
 #include "Misc/Guid.h"
 
 namespace
 {
-static FString HCI_BuildSelectionDigestFromReviewReport_G7(const FHCIDryRunDiffReport& Report)
-{
-	FString Canonical;
-	Canonical.Reserve(Report.DiffItems.Num() * 96);
-	for (int32 RowIndex = 0; RowIndex < Report.DiffItems.Num(); ++RowIndex)
-	{
-		const FHCIDryRunDiffItem& Item = Report.DiffItems[RowIndex];
-		Canonical += FString::Printf(
-			TEXT("%d|%s|%s|%s|%s|%s|%s|%s\n"),
-			RowIndex,
-			*Item.ToolName,
-			*Item.AssetPath,
-			*Item.Field,
-			*FHCIDryRunDiff::RiskToString(Item.Risk),
-			*Item.SkipReason,
-			*FHCIDryRunDiff::ObjectTypeToString(Item.ObjectType),
-			*FHCIDryRunDiff::LocateStrategyToString(Item.LocateStrategy));
-	}
-	return FString::Printf(TEXT("crc32_%08X"), FCrc::StrCrc32(*Canonical));
-}
-
 static FString HCI_BuildStageGExecuteCommitReceiptDigest_G7(const FHCIAgentStageGExecuteCommitReceipt& Receipt)
 {
-	FString Canonical;
-	Canonical += FString::Printf(
-		TEXT("%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s\n"),
-		*Receipt.StageGExecuteCommitRequestId,
-		*Receipt.StageGExecuteDispatchReceiptId,
-		*Receipt.StageGExecuteDispatchRequestId,
-		*Receipt.StageGExecutePermitTicketId,
-		*Receipt.StageGWriteEnableRequestId,
-		*Receipt.StageGExecuteIntentId,
-		*Receipt.SimHandoffEnvelopeId,
-		*Receipt.SimArchiveBundleId,
-		*Receipt.SimFinalReportId,
-		*Receipt.SimExecuteReceiptId,
-		*Receipt.ExecuteTicketId,
-		*Receipt.ConfirmRequestId,
-		*Receipt.ApplyRequestId,
-		*Receipt.ReviewRequestId,
-		*Receipt.SelectionDigest,
-		*Receipt.ArchiveDigest,
-		*Receipt.HandoffDigest,
-		*Receipt.ExecuteIntentDigest,
-		*Receipt.StageGWriteEnableDigest,
-		*Receipt.StageGExecutePermitDigest,
-		*Receipt.StageGExecuteDispatchDigest,
-		*Receipt.StageGExecuteDispatchReceiptDigest,
-		*Receipt.StageGExecuteCommitRequestDigest,
-		*Receipt.TerminalStatus,
-		*Receipt.ArchiveStatus,
-		*Receipt.HandoffStatus,
-		*Receipt.StageGStatus,
-		*Receipt.StageGWriteStatus,
-		*Receipt.StageGExecuteCommitRequestStatus,
-		*Receipt.StageGExecuteCommitReceiptStatus);
+	FHCIAgentDigestBuilder Digest;
+	Digest.Field(Receipt.StageGExecuteCommitRequestId)
+		.Field(Receipt.StageGExecuteDispatchReceiptId)
+		.Field(Receipt.StageGExecuteDispatchRequestId)
+		.Field(Receipt.StageGExecutePermitTicketId)
+		.Field(Receipt.StageGWriteEnableRequestId)
+		.Field(Receipt.StageGExecuteIntentId)
+		.Field(Receipt.SimHandoffEnvelopeId)
+		.Field(Receipt.SimArchiveBundleId)
+		.Field(Receipt.SimFinalReportId)
+		.Field(Receipt.SimExecuteReceiptId)
+		.Field(Receipt.ExecuteTicketId)
+		.Field(Receipt.ConfirmRequestId)
+		.Field(Receipt.ApplyRequestId)
+		.Field(Receipt.ReviewRequestId)
+		.Field(Receipt.SelectionDigest)
+		.Field(Receipt.ArchiveDigest)
+		.Field(Receipt.HandoffDigest)
+		.Field(Receipt.ExecuteIntentDigest)
+		.Field(Receipt.StageGWriteEnableDigest)
+		.Field(Receipt.StageGExecutePermitDigest)
+		.Field(Receipt.StageGExecuteDispatchDigest)
+		.Field(Receipt.StageGExecuteDispatchReceiptDigest)
+		.Field(Receipt.StageGExecuteCommitRequestDigest)
+		.Field(Receipt.TerminalStatus)
+		.Field(Receipt.ArchiveStatus)
+		.Field(Receipt.HandoffStatus)
+		.Field(Receipt.StageGStatus)
+		.Field(Receipt.StageGWriteStatus)
+		.Field(Receipt.StageGExecuteCommitRequestStatus)
+		.Field(Receipt.StageGExecuteCommitReceiptStatus)
+		.EndRow();
 
-	Canonical += FString::Printf(
-		TEXT("%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s\n"),
-		Receipt.bUserConfirmed ? TEXT("1") : TEXT("0"),
-		Receipt.bReadyToSimulateExecute ? TEXT("1") : TEXT("0"),
-		Receipt.bSimulatedDispatchAccepted ? TEXT("1") : TEXT("0"),
-		Receipt.bSimulationCompleted ? TEXT("1") : TEXT("0"),
-		Receipt.bArchiveReady ? TEXT("1") : TEXT("0"),
-		Receipt.bHandoffReady ? TEXT("1") : TEXT("0"),
-		Receipt.bWriteEnabled ? TEXT("1") : TEXT("0"),
-		Receipt.bReadyForStageGEntry ? TEXT("1") : TEXT("0"),
-		Receipt.bWriteEnableConfirmed ? TEXT("1") : TEXT("0"),
-		Receipt.bReadyForStageGExecute ? TEXT("1") : TEXT("0"),
-		Receipt.bStageGExecutePermitReady ? TEXT("1") : TEXT("0"),
-		Receipt.bExecuteDispatchConfirmed ? TEXT("1") : TEXT("0"),
-		Receipt.bStageGExecuteDispatchReady ? TEXT("1") : TEXT("0"),
-		Receipt.bStageGExecuteDispatchAccepted ? TEXT("1") : TEXT("0"),
-		Receipt.bStageGExecuteDispatchReceiptReady ? TEXT("1") : TEXT("0"),
-		Receipt.bExecuteCommitConfirmed ? TEXT("1") : TEXT("0"),
-		Receipt.bStageGExecuteCommitRequestReady ? TEXT("1") : TEXT("0"),
-		Receipt.bStageGExecuteCommitAccepted ? TEXT("1") : TEXT("0"),
-		Receipt.bStageGExecuteCommitReceiptReady ? TEXT("1") : TEXT("0"));
+	Digest.Field(Receipt.bUserConfirmed)
+		.Field(Receipt.bReadyToSimulateExecute)
+		.Field(Receipt.bSimulatedDispatchAccepted)
+		.Field(Receipt.bSimulationCompleted)
+		.Field(Receipt.bArchiveReady)
+		.Field(Receipt.bHandoffReady)
+		.Field(Receipt.bWriteEnabled)
+		.Field(Receipt.bReadyForStageGEntry)
+		.Field(Receipt.bWriteEnableConfirmed)
+		.Field(Receipt.bReadyForStageGExecute)
+		.Field(Receipt.bStageGExecutePermitReady)
+		.Field(Receipt.bExecuteDispatchConfirmed)
+		.Field(Receipt.bStageGExecuteDispatchReady)
+		.Field(Receipt.bStageGExecuteDispatchAccepted)
+		.Field(Receipt.bStageGExecuteDispatchReceiptReady)
+		.Field(Receipt.bExecuteCommitConfirmed)
+		.Field(Receipt.bStageGExecuteCommitRequestReady)
+		.Field(Receipt.bStageGExecuteCommitAccepted)
+		.Field(Receipt.bStageGExecuteCommitReceiptReady)
+		.EndRow();
 
-	Canonical += FString::Printf(TEXT("%s|%s|%s\n"), *Receipt.ExecuteTarget, *Receipt.HandoffTarget, *Receipt.Reason);
+	Digest.Field(Receipt.ExecuteTarget).Field(Receipt.HandoffTarget).Field(Receipt.Reason).EndRow();
 
 	for (const FHCIAgentApplyRequestItem& Item : Receipt.Items)
 	{
-		Canonical += FString::Printf(
-			TEXT("%d|%s|%s|%s|%s|%s|%s|%s|%s|%s\n"),
-			Item.RowIndex,
-			*Item.ToolName,
-			*Item.AssetPath,
-			*Item.Field,
-			*Item.SkipReason,
-			Item.bBlocked ? TEXT("1") : TEXT("0"),
-			*FHCIDryRunDiff::RiskToString(Item.Risk),
-			*FHCIDryRunDiff::ObjectTypeToString(Item.ObjectType),
-			*FHCIDryRunDiff::LocateStrategyToString(Item.LocateStrategy),
-			*Item.EvidenceKey);
+		Digest.Field(Item.RowIndex)
+			.Field(Item.ToolName)
+			.Field(Item.AssetPath)
+			.Field(Item.Field)
+			.Field(Item.SkipReason)
+			.Field(Item.bBlocked)
+			.Field(FHCIDryRunDiff::RiskToString(Item.Risk))
+			.Field(FHCIDryRunDiff::ObjectTypeToString(Item.ObjectType))
+			.Field(FHCIDryRunDiff::LocateStrategyToString(Item.LocateStrategy))
+			.Field(Item.EvidenceKey)
+			.EndRow();
 	}
 
-	return FString::Printf(TEXT("crc32_%08X"), FCrc::StrCrc32(*Canonical));
+	return Digest.Finalize();
 }
 
 static void HCI_CopyCommitRequestToCommitReceipt_G7(
@@ -210,6 +187,7 @@ bool FHCIAgentExecutorStageGExecuteCommitReceiptBridge::BuildStageGExecuteCommit
 	const FHCIDryRunDiffReport& CurrentReviewReport,
 	FHCIAgentStageGExecuteCommitReceipt& OutReceipt)
 {
+	HCI_TRACE_SCOPE(TEXT("HCI.StageG.BuildStageGExecuteCommitReceipt"));
 	HCI_CopyCommitRequestToCommitReceipt_G7(StageGExecuteCommitRequest, OutReceipt);
 
 	auto FinalizeAndReturn = [&OutReceipt]() -> bool
@@ -405,7 +383,7 @@ bool FHCIAgentExecutorStageGExecuteCommitReceiptBridge::BuildStageGExecuteCommit
 		OutReceipt.Reason = TEXT("selection_digest_mismatch");
 		return FinalizeAndReturn();
 	}
-	if (StageGExecuteCommitRequest.SelectionDigest != HCI_BuildSelectionDigestFromReviewReport_G7(CurrentReviewReport))
+	if (!FHCIAgentContractDigest::MatchesSelectionDigest(StageGExecuteCommitRequest.SelectionDigest, CurrentReviewReport))
 	{
 		OutReceipt.ErrorCode = TEXT("E4202");
 		OutReceipt.Reason = TEXT("selection_digest_mismatch");
@@ -1,5 +1,6 @@
 #include "Agent/Bridges/HCIAgentExecutorStageGExecuteCommitRequestBridge.h"
 
+#include "Agent/Contracts/HCIAgentContractDigest.h"
 #include "Agent/Contracts/StageF/HCIAgentApplyConfirmRequest.h"
 #include "Agent/Contracts/StageF/HCIAgentApplyRequest.h"
 #include "Agent/Contracts/StageF/HCIAgentExecuteTicket.h"
@@ -15,105 +16,81 @@
 #include "Agent/Contracts/StageG/HCIAgentStageGWriteEnableRequest.h"
 #include "Agent/Executor/HCIDryRunDiff.h"
 #include "Common/HCITimeFormat.h"
-#include "Misc/Crc.h"
+#include "Common/HCITrace.h"
 #include "Misc/Guid.h"
 
 namespace
 {
-static FString HCI_BuildSelectionDigestFromReviewReport_G6(const FHCIDryRunDiffReport& Report)
-{
-	FString Canonical;
-	Canonical.Reserve(Report.DiffItems.Num() * 96);
-	for (int32 RowIndex = 0; RowIndex < Report.DiffItems.Num(); ++RowIndex)
-	{
-		const FHCIDryRunDiffItem& Item = Report.DiffItems[RowIndex];
-		Canonical += FString::Printf(
-			TEXT("%d|%s|%s|%s|%s|%s|%s|%s\n"),
-			RowIndex,
-			*Item.ToolName,
-			*Item.AssetPath,
-			*Item.Field,
-			*FHCIDryRunDiff::RiskToString(Item.Risk),
-			*Item.SkipReason,
-			*FHCIDryRunDiff::ObjectTypeToString(Item.ObjectType),
-			*FHCIDryRunDiff::LocateStrategyToString(Item.LocateStrategy));
-	}
-	return FString::Printf(TEXT("crc32_%08X"), FCrc::StrCrc32(*Canonical));
-}
-
 static FString HCI_BuildStageGExecuteCommitRequestDigest_G6(const FHCIAgentStageGExecuteCommitRequest& Request)
 {
-	FString Canonical;
-	Canonical += FString::Printf(
-		TEXT("%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s\n"),
-		*Request.StageGExecuteDispatchReceiptId,
-		*Request.StageGExecuteDispatchRequestId,
-		*Request.StageGExecutePermitTicketId,
-		*Request.StageGWriteEnableRequestId,
-		*Request.StageGExecuteIntentId,
-		*Request.SimHandoffEnvelopeId,
-		*Request.SimArchiveBundleId,
-		*Request.SimFinalReportId,
-		*Request.SimExecuteReceiptId,
-		*Request.ExecuteTicketId,
-		*Request.ConfirmRequestId,
-		*Request.ApplyRequestId,
-		*Request.ReviewRequestId,
-		*Request.SelectionDigest,
-		*Request.ArchiveDigest,
-		*Request.HandoffDigest,
-		*Request.ExecuteIntentDigest,
-		*Request.StageGWriteEnableDigest,
-		*Request.StageGExecutePermitDigest,
-		*Request.TerminalStatus,
-		*Request.ArchiveStatus,
-		*Request.HandoffStatus,
-		*Request.StageGStatus,
-		*Request.StageGWriteStatus,
-		*Request.StageGExecuteDispatchStatus,
-		*Request.StageGExecuteDispatchReceiptDigest,
-		*Request.StageGExecuteDispatchReceiptStatus,
-		*Request.StageGExecuteCommitRequestStatus);
+	FHCIAgentDigestBuilder Digest;
+	Digest.Field(Request.StageGExecuteDispatchReceiptId)
+		.Field(Request.StageGExecuteDispatchRequestId)
+		.Field(Request.StageGExecutePermitTicketId)
+		.Field(Request.StageGWriteEnableRequestId)
+		.Field(Request.StageGExecuteIntentId)
+		.Field(Request.SimHandoffEnvelopeId)
+		.Field(Request.SimArchiveBundleId)
+		.Field(Request.SimFinalReportId)
+		.Field(Request.SimExecuteReceiptId)
+		.Field(Request.ExecuteTicketId)
+		.Field(Request.ConfirmRequestId)
+		.Field(Request.ApplyRequestId)
+		.Field(Request.ReviewRequestId)
+		.Field(Request.SelectionDigest)
+		.Field(Request.ArchiveDigest)
+		.Field(Request.HandoffDigest)
+		.Field(Request.ExecuteIntentDigest)
+		.Field(Request.StageGWriteEnableDigest)
+		.Field(Request.StageGExecutePermitDigest)
+		.Field(Request.TerminalStatus)
+		.Field(Request.ArchiveStatus)
+		.Field(Request.HandoffStatus)
+		.Field(Request.StageGStatus)
+		.Field(Request.StageGWriteStatus)
+		.Field(Request.StageGExecuteDispatchStatus)
+		.Field(Request.StageGExecuteDispatchReceiptDigest)
+		.Field(Request.StageGExecuteDispatchReceiptStatus)
+		.Field(Request.StageGExecuteCommitRequestStatus)
+		.EndRow();
 
-	Canonical += FString::Printf(
-		TEXT("%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s\n"),
-		Request.bUserConfirmed ? TEXT("1") : TEXT("0"),
-		Request.bReadyToSimulateExecute ? TEXT("1") : TEXT("0"),
-		Request.bSimulatedDispatchAccepted ? TEXT("1") : TEXT("0"),
-		Request.bSimulationCompleted ? TEXT("1") : TEXT("0"),
-		Request.bArchiveReady ? TEXT("1") : TEXT("0"),
-		Request.bHandoffReady ? TEXT("1") : TEXT("0"),
-		Request.bWriteEnabled ? TEXT("1") : TEXT("0"),
-		Request.bReadyForStageGEntry ? TEXT("1") : TEXT("0"),
-		Request.bWriteEnableConfirmed ? TEXT("1") : TEXT("0"),
-		Request.bReadyForStageGExecute ? TEXT("1") : TEXT("0"),
-		Request.bStageGExecutePermitReady ? TEXT("1") : TEXT("0"),
-		Request.bExecuteDispatchConfirmed ? TEXT("1") : TEXT("0"),
-		Request.bStageGExecuteDispatchReady ? TEXT("1") : TEXT("0"),
-		Request.bStageGExecuteDispatchAccepted ? TEXT("1") : TEXT("0"),
-		Request.bStageGExecuteDispatchReceiptReady ? TEXT("1") : TEXT("0"),
-		Request.bExecuteCommitConfirmed ? TEXT("1") : TEXT("0"),
-		Request.bStageGExecuteCommitRequestReady ? TEXT("1") : TEXT("0"));
+	Digest.Field(Request.bUserConfirmed)
+		.Field(Request.bReadyToSimulateExecute)
+		.Field(Request.bSimulatedDispatchAccepted)
+		.Field(Request.bSimulationCompleted)
+		.Field(Request.bArchiveReady)
+		.Field(Request.bHandoffReady)
+		.Field(Request.bWriteEnabled)
+		.Field(Request.bReadyForStageGEntry)
+		.Field(Request.bWriteEnableConfirmed)
+		.Field(Request.bReadyForStageGExecute)
+		.Field(Request.bStageGExecutePermitReady)
+		.Field(Request.bExecuteDispatchConfirmed)
+		.Field(Request.bStageGExecuteDispatchReady)
+		.Field(Request.bStageGExecuteDispatchAccepted)
+		.Field(Request.bStageGExecuteDispatchReceiptReady)
+		.Field(Request.bExecuteCommitConfirmed)
+		.Field(Request.bStageGExecuteCommitRequestReady)
+		.EndRow();
 
-	Canonical += FString::Printf(TEXT("%s|%s|%s\n"), *Request.ExecuteTarget, *Request.HandoffTarget, *Request.Reason);
+	Digest.Field(Request.ExecuteTarget).Field(Request.HandoffTarget).Field(Request.Reason).EndRow();
 
 	for (const FHCIAgentApplyRequestItem& Item : Request.Items)
 	{
-		Canonical += FString::Printf(
-			TEXT("%d|%s|%s|%s|%s|%s|%s|%s|%s|%s\n"),
-			Item.RowIndex,
-			*Item.ToolName,
-			*Item.AssetPath,
-			*Item.Field,
-			*Item.SkipReason,
-			Item.bBlocked ? TEXT("1") : TEXT("0"),
-			*FHCIDryRunDiff::RiskToString(Item.Risk),
-			*FHCIDryRunDiff::ObjectTypeToString(Item.ObjectType),
-			*FHCIDryRunDiff::LocateStrategyToString(Item.LocateStrategy),
-			*Item.EvidenceKey);
+		Digest.Field(Item.RowIndex)
+			.Field(Item.ToolName)
+			.Field(Item.AssetPath)
+			.Field(Item.Field)
+			.Field(Item.SkipReason)
+			.Field(Item.bBlocked)
+			.Field(FHCIDryRunDiff::RiskToString(Item.Risk))
+			.Field(FHCIDryRunDiff::ObjectTypeToString(Item.ObjectType))
+			.Field(FHCIDryRunDiff::LocateStrategyToString(Item.LocateStrategy))
+			.Field(Item.EvidenceKey)
+			.EndRow();
 	}
 
-	return FString::Printf(TEXT("crc32_%08X"), FCrc::StrCrc32(*Canonical));
+	return Digest.Finalize();
 }
 
 static void HCI_CopyDispatchReceiptToCommitRequest_G6(
@@ -200,6 +177,7 @@ bool FHCIAgentExecutorStageGExecuteCommitRequestBridge::BuildStageGExecuteCommit
 	bool bExecuteCommitConfirmed,
 	FHCIAgentStageGExecuteCommitRequest& OutRequest)
 {
+	HCI_TRACE_SCOPE(TEXT("HCI.StageG.BuildStageGExecuteCommitRequest"));
 	HCI_CopyDispatchReceiptToCommitRequest_G6(StageGExecuteDispatchReceipt, OutRequest);
 	OutRequest.bExecuteCommitConfirmed = bExecuteCommitConfirmed;
 
@@ -392,7 +370,7 @@ bool FHCIAgentExecutorStageGExecuteCommitRequestBridge::BuildStageGExecuteCommit
 		OutRequest.Reason = TEXT("selection_digest_mismatch");
 		return FinalizeAndReturn();
 	}
-	if (StageGExecuteDispatchReceipt.SelectionDigest != HCI_BuildSelectionDigestFromReviewReport_G6(CurrentReviewReport))
+	if (!FHCIAgentContractDigest::MatchesSelectionDigest(StageGExecuteDispatchReceipt.SelectionDigest, CurrentReviewReport))
 	{
 		OutRequest.ErrorCode = TEXT("E4202");
 		OutRequest.Reason = TEXT("selection_digest_mismatch");
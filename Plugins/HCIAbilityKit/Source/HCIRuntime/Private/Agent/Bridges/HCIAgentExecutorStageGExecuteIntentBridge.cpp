@@ -1,5 +1,6 @@
 #include "Agent/Bridges/HCIAgentExecutorStageGExecuteIntentBridge.h"
 
+#include "Agent/Contracts/HCIAgentContractDigest.h"
 #include "Agent/Contracts/StageF/HCIAgentApplyConfirmRequest.h"
 #include "Agent/Contracts/StageF/HCIAgentApplyRequest.h"
 #include "Agent/Contracts/StageF/HCIAgentExecuteTicket.h"
@@ -10,86 +11,59 @@
 #include "Agent/Contracts/StageF/HCIAgentSimulateExecuteReceipt.h"
 #include "Agent/Executor/HCIDryRunDiff.h"
 #include "Common/HCITimeFormat.h"
-#include "Misc/Crc.h"
+#include "Common/HCITrace.h"
 #include "Misc/Guid.h"
 
 namespace
 {
-static FString HCI_BuildSelectionDigestFromReviewReport_G1(const FHCIDryRunDiffReport& Report)
-{
-	FString Canonical;
-	Canonical.Reserve(Report.DiffItems.Num() * 96);
-	for (int32 RowIndex = 0; RowIndex < Report.DiffItems.Num(); ++RowIndex)
-	{
-		const FHCIDryRunDiffItem& Item = Report.DiffItems[RowIndex];
-		Canonical += FString::Printf(
-			TEXT("%d|%s|%s|%s|%s|%s|%s|%s\n"),
-			RowIndex,
-			*Item.ToolName,
-			*Item.AssetPath,
-			*Item.Field,
-			*FHCIDryRunDiff::RiskToString(Item.Risk),
-			*Item.SkipReason,
-			*FHCIDryRunDiff::ObjectTypeToString(Item.ObjectType),
-			*FHCIDryRunDiff::LocateStrategyToString(Item.LocateStrategy));
-	}
-
-	const uint32 Crc = FCrc::StrCrc32(*Canonical);
-	return FString::Printf(TEXT("crc32_%08X"), Crc);
-}
-
 static FString HCI_BuildStageGExecuteIntentDigest_G1(const FHCIAgentStageGExecuteIntent& Intent)
 {
-	FString Canonical;
-	Canonical += FString::Printf(
-		TEXT("%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s\n"),
-		*Intent.SimHandoffEnvelopeId,
-		*Intent.SimArchiveBundleId,
-		*Intent.SimFinalReportId,
-		*Intent.SimExecuteReceiptId,
-		*Intent.ExecuteTicketId,
-		*Intent.ConfirmRequestId,
-		*Intent.ApplyRequestId,
-		*Intent.ReviewRequestId,
-		*Intent.SelectionDigest,
-		*Intent.ArchiveDigest,
-		*Intent.HandoffDigest,
-		*Intent.TerminalStatus,
-		*Intent.ArchiveStatus,
-		*Intent.HandoffStatus,
-		*Intent.StageGStatus,
-		Intent.bUserConfirmed ? TEXT("1") : TEXT("0"),
-		Intent.bReadyToSimulateExecute ? TEXT("1") : TEXT("0"),
-		Intent.bSimulatedDispatchAccepted ? TEXT("1") : TEXT("0"),
-		Intent.bSimulationCompleted ? TEXT("1") : TEXT("0"),
-		Intent.bArchiveReady ? TEXT("1") : TEXT("0"));
+	FHCIAgentDigestBuilder Digest;
+	Digest.Field(Intent.SimHandoffEnvelopeId)
+		.Field(Intent.SimArchiveBundleId)
+		.Field(Intent.SimFinalReportId)
+		.Field(Intent.SimExecuteReceiptId)
+		.Field(Intent.ExecuteTicketId)
+		.Field(Intent.ConfirmRequestId)
+		.Field(Intent.ApplyRequestId)
+		.Field(Intent.ReviewRequestId)
+		.Field(Intent.SelectionDigest)
+		.Field(Intent.ArchiveDigest)
+		.Field(Intent.HandoffDigest)
+		.Field(Intent.TerminalStatus)
+		.Field(Intent.ArchiveStatus)
+		.Field(Intent.HandoffStatus)
+		.Field(Intent.StageGStatus)
+		.Field(Intent.bUserConfirmed)
+		.Field(Intent.bReadyToSimulateExecute)
+		.Field(Intent.bSimulatedDispatchAccepted)
+		.Field(Intent.bSimulationCompleted)
+		.Field(Intent.bArchiveReady)
+		.EndRow();
 
-	Canonical += FString::Printf(
-		TEXT("%s|%s|%s|%s|%s\n"),
-		Intent.bHandoffReady ? TEXT("1") : TEXT("0"),
-		Intent.bWriteEnabled ? TEXT("1") : TEXT("0"),
-		Intent.bReadyForStageGEntry ? TEXT("1") : TEXT("0"),
-		*Intent.HandoffTarget,
-		*Intent.ExecuteTarget);
+	Digest.Field(Intent.bHandoffReady)
+		.Field(Intent.bWriteEnabled)
+		.Field(Intent.bReadyForStageGEntry)
+		.Field(Intent.HandoffTarget)
+		.Field(Intent.ExecuteTarget)
+		.EndRow();
 
 	for (const FHCIAgentApplyRequestItem& Item : Intent.Items)
 	{
-		Canonical += FString::Printf(
-			TEXT("%d|%s|%s|%s|%s|%s|%s|%s|%s|%s\n"),
-			Item.RowIndex,
-			*Item.ToolName,
-			*Item.AssetPath,
-			*Item.Field,
-			*Item.SkipReason,
-			Item.bBlocked ? TEXT("1") : TEXT("0"),
-			*FHCIDryRunDiff::RiskToString(Item.Risk),
-			*FHCIDryRunDiff::ObjectTypeToString(Item.ObjectType),
-			*FHCIDryRunDiff::LocateStrategyToString(Item.LocateStrategy),
-			*Item.EvidenceKey);
+		Digest.Field(Item.RowIndex)
+			.Field(Item.ToolName)
+			.Field(Item.AssetPath)
+			.Field(Item.Field)
+			.Field(Item.SkipReason)
+			.Field(Item.bBlocked)
+			.Field(FHCIDryRunDiff::RiskToString(Item.Risk))
+			.Field(FHCIDryRunDiff::ObjectTypeToString(Item.ObjectType))
+			.Field(FHCIDryRunDiff::LocateStrategyToString(Item.LocateStrategy))
+			.Field(Item.EvidenceKey)
+			.EndRow();
 	}
 
-	const uint32 Crc = FCrc::StrCrc32(*Canonical);
-	return FString::Printf(TEXT("crc32_%08X"), Crc);
+	return Digest.Finalize();
 }
 
 static void HCI_CopyHandoffEnvelopeToStageGIntent(
@@ -145,6 +119,7 @@ bool FHCIAgentExecutorStageGExecuteIntentBridge::BuildStageGExecuteIntent(
 	const FHCIDryRunDiffReport& CurrentReviewReport,
 	FHCIAgentStageGExecuteIntent& OutIntent)
 {
+	HCI_TRACE_SCOPE(TEXT("HCI.StageG.BuildStageGExecuteIntent"));
 	HCI_CopyHandoffEnvelopeToStageGIntent(SimHandoffEnvelope, OutIntent);
 
 	if (!SimHandoffEnvelope.bUserConfirmed)
@@ -280,8 +255,7 @@ bool FHCIAgentExecutorStageGExecuteIntentBridge::BuildStageGExecuteIntent(
 		return true;
 	}
 
-	const FString CurrentSelectionDigest = HCI_BuildSelectionDigestFromReviewReport_G1(CurrentReviewReport);
-	if (SimHandoffEnvelope.SelectionDigest != CurrentSelectionDigest)
+	if (!FHCIAgentContractDigest::MatchesSelectionDigest(SimHandoffEnvelope.SelectionDigest, CurrentReviewReport))
 	{
 		OutIntent.ErrorCode = TEXT("E4202");
 		OutIntent.Reason = TEXT("selection_digest_mismatch");
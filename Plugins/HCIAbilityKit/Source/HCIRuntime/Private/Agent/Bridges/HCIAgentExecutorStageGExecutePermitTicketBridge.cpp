@@ -1,5 +1,6 @@
 #include "Agent/Bridges/HCIAgentExecutorStageGExecutePermitTicketBridge.h"
 
+#include "Agent/Contracts/HCIAgentContractDigest.h"
 #include "Agent/Contracts/StageF/HCIAgentApplyConfirmRequest.h"
 #include "Agent/Contracts/StageF/HCIAgentApplyRequest.h"
 #include "Agent/Contracts/StageF/HCIAgentExecuteTicket.h"
@@ -12,93 +13,68 @@
 #include "Agent/Contracts/StageG/HCIAgentStageGExecutePermitTicket.h"
 #include "Agent/Executor/HCIDryRunDiff.h"
 #include "Common/HCITimeFormat.h"
-#include "Misc/Crc.h"
+#include "Common/HCITrace.h"
 #include "Misc/Guid.h"
 
 namespace
 {
-static FString HCI_BuildSelectionDigestFromReviewReport_G3(const FHCIDryRunDiffReport& Report)
-{
-	FString Canonical;
-	Canonical.Reserve(Report.DiffItems.Num() * 96);
-	for (int32 RowIndex = 0; RowIndex < Report.DiffItems.Num(); ++RowIndex)
-	{
-		const FHCIDryRunDiffItem& Item = Report.DiffItems[RowIndex];
-		Canonical += FString::Printf(
-			TEXT("%d|%s|%s|%s|%s|%s|%s|%s\n"),
-			RowIndex,
-			*Item.ToolName,
-			*Item.AssetPath,
-			*Item.Field,
-			*FHCIDryRunDiff::RiskToString(Item.Risk),
-			*Item.SkipReason,
-			*FHCIDryRunDiff::ObjectTypeToString(Item.ObjectType),
-			*FHCIDryRunDiff::LocateStrategyToString(Item.LocateStrategy));
-	}
-
-	return FString::Printf(TEXT("crc32_%08X"), FCrc::StrCrc32(*Canonical));
-}
-
 static FString HCI_BuildStageGExecutePermitDigest_G3(const FHCIAgentStageGExecutePermitTicket& Ticket)
 {
-	FString Canonical;
-	Canonical += FString::Printf(
-		TEXT("%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s\n"),
-		*Ticket.StageGWriteEnableRequestId,
-		*Ticket.StageGExecuteIntentId,
-		*Ticket.SimHandoffEnvelopeId,
-		*Ticket.SimArchiveBundleId,
-		*Ticket.SimFinalReportId,
-		*Ticket.SimExecuteReceiptId,
-		*Ticket.ExecuteTicketId,
-		*Ticket.ConfirmRequestId,
-		*Ticket.ApplyRequestId,
-		*Ticket.ReviewRequestId,
-		*Ticket.SelectionDigest,
-		*Ticket.ArchiveDigest,
-		*Ticket.HandoffDigest,
-		*Ticket.ExecuteIntentDigest,
-		*Ticket.StageGWriteEnableDigest,
-		*Ticket.TerminalStatus,
-		*Ticket.ArchiveStatus,
-		*Ticket.HandoffStatus,
-		*Ticket.StageGStatus,
-		*Ticket.StageGWriteStatus,
-		*Ticket.StageGExecutePermitStatus);
+	FHCIAgentDigestBuilder Digest;
+	Digest.Field(Ticket.StageGWriteEnableRequestId)
+		.Field(Ticket.StageGExecuteIntentId)
+		.Field(Ticket.SimHandoffEnvelopeId)
+		.Field(Ticket.SimArchiveBundleId)
+		.Field(Ticket.SimFinalReportId)
+		.Field(Ticket.SimExecuteReceiptId)
+		.Field(Ticket.ExecuteTicketId)
+		.Field(Ticket.ConfirmRequestId)
+		.Field(Ticket.ApplyRequestId)
+		.Field(Ticket.ReviewRequestId)
+		.Field(Ticket.SelectionDigest)
+		.Field(Ticket.ArchiveDigest)
+		.Field(Ticket.HandoffDigest)
+		.Field(Ticket.ExecuteIntentDigest)
+		.Field(Ticket.StageGWriteEnableDigest)
+		.Field(Ticket.TerminalStatus)
+		.Field(Ticket.ArchiveStatus)
+		.Field(Ticket.HandoffStatus)
+		.Field(Ticket.StageGStatus)
+		.Field(Ticket.StageGWriteStatus)
+		.Field(Ticket.StageGExecutePermitStatus)
+		.EndRow();
 
-	Canonical += FString::Printf(
-		TEXT("%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s\n"),
-		Ticket.bUserConfirmed ? TEXT("1") : TEXT("0"),
-		Ticket.bReadyToSimulateExecute ? TEXT("1") : TEXT("0"),
-		Ticket.bSimulatedDispatchAccepted ? TEXT("1") : TEXT("0"),
-		Ticket.bSimulationCompleted ? TEXT("1") : TEXT("0"),
-		Ticket.bArchiveReady ? TEXT("1") : TEXT("0"),
-		Ticket.bHandoffReady ? TEXT("1") : TEXT("0"),
-		Ticket.bWriteEnabled ? TEXT("1") : TEXT("0"),
-		Ticket.bReadyForStageGEntry ? TEXT("1") : TEXT("0"),
-		Ticket.bWriteEnableConfirmed ? TEXT("1") : TEXT("0"),
-		Ticket.bReadyForStageGExecute ? TEXT("1") : TEXT("0"),
-		Ticket.bStageGExecutePermitReady ? TEXT("1") : TEXT("0"));
+	Digest.Field(Ticket.bUserConfirmed)
+		.Field(Ticket.bReadyToSimulateExecute)
+		.Field(Ticket.bSimulatedDispatchAccepted)
+		.Field(Ticket.bSimulationCompleted)
+		.Field(Ticket.bArchiveReady)
+		.Field(Ticket.bHandoffReady)
+		.Field(Ticket.bWriteEnabled)
+		.Field(Ticket.bReadyForStageGEntry)
+		.Field(Ticket.bWriteEnableConfirmed)
+		.Field(Ticket.bReadyForStageGExecute)
+		.Field(Ticket.bStageGExecutePermitReady)
+		.EndRow();
 
-	Canonical += FString::Printf(TEXT("%s|%s|%s\n"), *Ticket.ExecuteTarget, *Ticket.HandoffTarget, *Ticket.Reason);
+	Digest.Field(Ticket.ExecuteTarget).Field(Ticket.HandoffTarget).Field(Ticket.Reason).EndRow();
 
 	for (const FHCIAgentApplyRequestItem& Item : Ticket.Items)
 	{
-		Canonical += FString::Printf(
-			TEXT("%d|%s|%s|%s|%s|%s|%s|%s|%s|%s\n"),
-			Item.RowIndex,
-			*Item.ToolName,
-			*Item.AssetPath,
-			*Item.Field,
-			*Item.SkipReason,
-			Item.bBlocked ? TEXT("1") : TEXT("0"),
-			*FHCIDryRunDiff::RiskToString(Item.Risk),
-			*FHCIDryRunDiff::ObjectTypeToString(Item.ObjectType),
-			*FHCIDryRunDiff::LocateStrategyToString(Item.LocateStrategy),
-			*Item.EvidenceKey);
+		Digest.Field(Item.RowIndex)
+			.Field(Item.ToolName)
+			.Field(Item.AssetPath)
+			.Field(Item.Field)
+			.Field(Item.SkipReason)
+			.Field(Item.bBlocked)
+			.Field(FHCIDryRunDiff::RiskToString(Item.Risk))
+			.Field(FHCIDryRunDiff::ObjectTypeToString(Item.ObjectType))
+			.Field(FHCIDryRunDiff::LocateStrategyToString(Item.LocateStrategy))
+			.Field(Item.EvidenceKey)
+			.EndRow();
 	}
 
-	return FString::Printf(TEXT("crc32_%08X"), FCrc::StrCrc32(*Canonical));
+	return Digest.Finalize();
 }
 
 static void HCI_CopyStageGWriteEnableRequestToExecutePermitTicket_G3(
@@ -166,6 +142,7 @@ bool FHCIAgentExecutorStageGExecutePermitTicketBridge::BuildStageGExecutePermitT
 	const FHCIDryRunDiffReport& CurrentReviewReport,
 	FHCIAgentStageGExecutePermitTicket& OutTicket)
 {
+	HCI_TRACE_SCOPE(TEXT("HCI.StageG.BuildStageGExecutePermitTicket"));
 	HCI_CopyStageGWriteEnableRequestToExecutePermitTicket_G3(StageGWriteEnableRequest, OutTicket);
 
 	auto FinalizeAndReturn = [&OutTicket]() -> bool
@@ -324,7 +301,7 @@ bool FHCIAgentExecutorStageGExecutePermitTicketBridge::BuildStageGExecutePermitT
 		return FinalizeAndReturn();
 	}
 
-	if (StageGWriteEnableRequest.SelectionDigest != HCI_BuildSelectionDigestFromReviewReport_G3(CurrentReviewReport))
+	if (!FHCIAgentContractDigest::MatchesSelectionDigest(StageGWriteEnableRequest.SelectionDigest, CurrentReviewReport))
 	{
 		OutTicket.ErrorCode = TEXT("E4202");
 		OutTicket.Reason = TEXT("selection_digest_mismatch");
@@ -1,66 +1,44 @@
 #include "Agent/Bridges/HCIAgentExecutorStageGExecutionReadinessReportBridge.h"
 
+#include "Agent/Contracts/HCIAgentContractDigest.h"
 #include "Agent/Contracts/StageF/HCIAgentApplyRequest.h"
 #include "Agent/Contracts/StageG/HCIAgentStageGExecuteArchiveBundle.h"
 #include "Agent/Contracts/StageG/HCIAgentStageGExecutionReadinessReport.h"
 #include "Agent/Executor/HCIDryRunDiff.h"
-#include "Misc/Crc.h"
+#include "Common/HCITrace.h"
 #include "Misc/Guid.h"
 
 namespace
 {
-static FString HCI_BuildSelectionDigestFromReviewReport_G10(const FHCIDryRunDiffReport& Report)
-{
-	FString Canonical;
-	Canonical.Reserve(Report.DiffItems.Num() * 96);
-	for (int32 RowIndex = 0; RowIndex < Report.DiffItems.Num(); ++RowIndex)
-	{
-		const FHCIDryRunDiffItem& Item = Report.DiffItems[RowIndex];
-		Canonical += FString::Printf(
-			TEXT("%d|%s|%s|%s|%s|%s|%s|%s\n"),
-			RowIndex,
-			*Item.ToolName,
-			*Item.AssetPath,
-			*Item.Field,
-			*FHCIDryRunDiff::RiskToString(Item.Risk),
-			*Item.SkipReason,
-			*FHCIDryRunDiff::ObjectTypeToString(Item.ObjectType),
-			*FHCIDryRunDiff::LocateStrategyToString(Item.LocateStrategy));
-	}
-	return FString::Printf(TEXT("crc32_%08X"), FCrc::StrCrc32(*Canonical));
-}
-
 static FString HCI_BuildStageGExecutionReadinessDigest_G10(const FHCIAgentStageGExecutionReadinessReport& Report)
 {
-	FString Canonical;
-	Canonical += FString::Printf(
-		TEXT("%s|%s|%s|%s|%s|%s|%s|%s\n"),
-		*Report.StageGExecuteArchiveBundleId,
-		*Report.SelectionDigest,
-		*Report.StageGExecutionReadinessStatus,
-		Report.bReadyForH1PlannerIntegration ? TEXT("1") : TEXT("0"),
-		*Report.ExecutionMode,
-		*Report.ErrorCode,
-		*Report.Reason,
-		Report.Items.Num() > 0 ? TEXT("has_items") : TEXT("no_items"));
+	FHCIAgentDigestBuilder Digest;
+	Digest.Field(Report.StageGExecuteArchiveBundleId)
+		.Field(Report.SelectionDigest)
+		.Field(Report.StageGExecutionReadinessStatus)
+		.Field(Report.bReadyForH1PlannerIntegration)
+		.Field(Report.ExecutionMode)
+		.Field(Report.ErrorCode)
+		.Field(Report.Reason)
+		.Field(Report.Items.Num() > 0 ? TEXT("has_items") : TEXT("no_items"))
+		.EndRow();
 
 	for (const FHCIAgentApplyRequestItem& Item : Report.Items)
 	{
-		Canonical += FString::Printf(
-			TEXT("%d|%s|%s|%s|%s|%s|%s|%s|%s|%s\n"),
-			Item.RowIndex,
-			*Item.ToolName,
-			*Item.AssetPath,
-			*Item.Field,
-			*Item.SkipReason,
-			Item.bBlocked ? TEXT("1") : TEXT("0"),
-			*FHCIDryRunDiff::RiskToString(Item.Risk),
-			*FHCIDryRunDiff::ObjectTypeToString(Item.ObjectType),
-			*FHCIDryRunDiff::LocateStrategyToString(Item.LocateStrategy),
-			*Item.EvidenceKey);
+		Digest.Field(Item.RowIndex)
+			.Field(Item.ToolName)
+			.Field(Item.AssetPath)
+			.Field(Item.Field)
+			.Field(Item.SkipReason)
+			.Field(Item.bBlocked)
+			.Field(FHCIDryRunDiff::RiskToString(Item.Risk))
+			.Field(FHCIDryRunDiff::ObjectTypeToString(Item.ObjectType))
+			.Field(FHCIDryRunDiff::LocateStrategyToString(Item.LocateStrategy))
+			.Field(Item.EvidenceKey)
+			.EndRow();
 	}
 
-	return FString::Printf(TEXT("crc32_%08X"), FCrc::StrCrc32(*Canonical));
+	return Digest.Finalize();
 }
 } // namespace
 
@@ -71,6 +49,7 @@ bool FHCIAgentExecutorStageGExecutionReadinessReportBridge::BuildStageGExecution
 	const bool bUserConfirmed,
 	FHCIAgentStageGExecutionReadinessReport& OutReport)
 {
+	HCI_TRACE_SCOPE(TEXT("HCI.StageG.BuildStageGExecutionReadinessReport"));
 	OutReport = FHCIAgentStageGExecutionReadinessReport();
 	OutReport.RequestId = FString::Printf(TEXT("stagegreadiness_%s"), *FGuid::NewGuid().ToString(EGuidFormats::Digits));
 	OutReport.StageGExecuteArchiveBundleId = StageGExecuteArchiveBundle.RequestId;
@@ -103,8 +82,7 @@ bool FHCIAgentExecutorStageGExecutionReadinessReportBridge::BuildStageGExecution
 		return FinalizeAndReturn();
 	}
 
-	const FString ExpectedSelectionDigest = HCI_BuildSelectionDigestFromReviewReport_G10(CurrentReviewReport);
-	if (!ExpectedSelectionDigest.IsEmpty() && StageGExecuteArchiveBundle.SelectionDigest != ExpectedSelectionDigest)
+	if (!FHCIAgentContractDigest::MatchesSelectionDigest(StageGExecuteArchiveBundle.SelectionDigest, CurrentReviewReport))
 	{
 		OutReport.ErrorCode = TEXT("E4202");
 		OutReport.Reason = TEXT("selection_digest_mismatch");
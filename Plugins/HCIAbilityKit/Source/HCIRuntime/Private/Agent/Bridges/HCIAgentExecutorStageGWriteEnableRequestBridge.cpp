@@ -1,5 +1,6 @@
 #include "Agent/Bridges/HCIAgentExecutorStageGWriteEnableRequestBridge.h"
 
+#include "Agent/Contracts/HCIAgentContractDigest.h"
 #include "Agent/Contracts/StageF/HCIAgentApplyConfirmRequest.h"
 #include "Agent/Contracts/StageF/HCIAgentApplyRequest.h"
 #include "Agent/Contracts/StageF/HCIAgentExecuteTicket.h"
@@ -11,90 +12,65 @@
 #include "Agent/Contracts/StageG/HCIAgentStageGWriteEnableRequest.h"
 #include "Agent/Executor/HCIDryRunDiff.h"
 #include "Common/HCITimeFormat.h"
-#include "Misc/Crc.h"
+#include "Common/HCITrace.h"
 #include "Misc/Guid.h"
 
 namespace
 {
-static FString HCI_BuildSelectionDigestFromReviewReport_G2(const FHCIDryRunDiffReport& Report)
-{
-	FString Canonical;
-	Canonical.Reserve(Report.DiffItems.Num() * 96);
-	for (int32 RowIndex = 0; RowIndex < Report.DiffItems.Num(); ++RowIndex)
-	{
-		const FHCIDryRunDiffItem& Item = Report.DiffItems[RowIndex];
-		Canonical += FString::Printf(
-			TEXT("%d|%s|%s|%s|%s|%s|%s|%s\n"),
-			RowIndex,
-			*Item.ToolName,
-			*Item.AssetPath,
-			*Item.Field,
-			*FHCIDryRunDiff::RiskToString(Item.Risk),
-			*Item.SkipReason,
-			*FHCIDryRunDiff::ObjectTypeToString(Item.ObjectType),
-			*FHCIDryRunDiff::LocateStrategyToString(Item.LocateStrategy));
-	}
-
-	return FString::Printf(TEXT("crc32_%08X"), FCrc::StrCrc32(*Canonical));
-}
-
 static FString HCI_BuildStageGWriteEnableDigest_G2(const FHCIAgentStageGWriteEnableRequest& Request)
 {
-	FString Canonical;
-	Canonical += FString::Printf(
-		TEXT("%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s|%s\n"),
-		*Request.StageGExecuteIntentId,
-		*Request.SimHandoffEnvelopeId,
-		*Request.SimArchiveBundleId,
-		*Request.SimFinalReportId,
-		*Request.SimExecuteReceiptId,
-		*Request.ExecuteTicketId,
-		*Request.ConfirmRequestId,
-		*Request.ApplyRequestId,
-		*Request.ReviewRequestId,
-		*Request.SelectionDigest,
-		*Request.ArchiveDigest,
-		*Request.HandoffDigest,
-		*Request.ExecuteIntentDigest,
-		*Request.TerminalStatus,
-		*Request.ArchiveStatus,
-		*Request.HandoffStatus,
-		*Request.StageGStatus,
-		*Request.StageGWriteStatus,
-		Request.bUserConfirmed ? TEXT("1") : TEXT("0"),
-		Request.bWriteEnableConfirmed ? TEXT("1") : TEXT("0"));
+	FHCIAgentDigestBuilder Digest;
+	Digest.Field(Request.StageGExecuteIntentId)
+		.Field(Request.SimHandoffEnvelopeId)
+		.Field(Request.SimArchiveBundleId)
+		.Field(Request.SimFinalReportId)
+		.Field(Request.SimExecuteReceiptId)
+		.Field(Request.ExecuteTicketId)
+		.Field(Request.ConfirmRequestId)
+		.Field(Request.ApplyRequestId)
+		.Field(Request.ReviewRequestId)
+		.Field(Request.SelectionDigest)
+		.Field(Request.ArchiveDigest)
+		.Field(Request.HandoffDigest)
+		.Field(Request.ExecuteIntentDigest)
+		.Field(Request.TerminalStatus)
+		.Field(Request.ArchiveStatus)
+		.Field(Request.HandoffStatus)
+		.Field(Request.StageGStatus)
+		.Field(Request.StageGWriteStatus)
+		.Field(Request.bUserConfirmed)
+		.Field(Request.bWriteEnableConfirmed)
+		.EndRow();
 
-	Canonical += FString::Printf(
-		TEXT("%s|%s|%s|%s|%s|%s|%s|%s|%s\n"),
-		Request.bReadyToSimulateExecute ? TEXT("1") : TEXT("0"),
-		Request.bSimulatedDispatchAccepted ? TEXT("1") : TEXT("0"),
-		Request.bSimulationCompleted ? TEXT("1") : TEXT("0"),
-		Request.bArchiveReady ? TEXT("1") : TEXT("0"),
-		Request.bHandoffReady ? TEXT("1") : TEXT("0"),
-		Request.bWriteEnabled ? TEXT("1") : TEXT("0"),
-		Request.bReadyForStageGEntry ? TEXT("1") : TEXT("0"),
-		Request.bReadyForStageGExecute ? TEXT("1") : TEXT("0"),
-		*Request.ExecuteTarget);
+	Digest.Field(Request.bReadyToSimulateExecute)
+		.Field(Request.bSimulatedDispatchAccepted)
+		.Field(Request.bSimulationCompleted)
+		.Field(Request.bArchiveReady)
+		.Field(Request.bHandoffReady)
+		.Field(Request.bWriteEnabled)
+		.Field(Request.bReadyForStageGEntry)
+		.Field(Request.bReadyForStageGExecute)
+		.Field(Request.ExecuteTarget)
+		.EndRow();
 
-	Canonical += FString::Printf(TEXT("%s|%s\n"), *Request.HandoffTarget, *Request.Reason);
+	Digest.Field(Request.HandoffTarget).Field(Request.Reason).EndRow();
 
 	for (const FHCIAgentApplyRequestItem& Item : Request.Items)
 	{
-		Canonical += FString::Printf(
-			TEXT("%d|%s|%s|%s|%s|%s|%s|%s|%s|%s\n"),
-			Item.RowIndex,
-			*Item.ToolName,
-			*Item.AssetPath,
-			*Item.Field,
-			*Item.SkipReason,
-			Item.bBlocked ? TEXT("1") : TEXT("0"),
-			*FHCIDryRunDiff::RiskToString(Item.Risk),
-			*FHCIDryRunDiff::ObjectTypeToString(Item.ObjectType),
-			*FHCIDryRunDiff::LocateStrategyToString(Item.LocateStrategy),
-			*Item.EvidenceKey);
+		Digest.Field(Item.RowIndex)
+			.Field(Item.ToolName)
+			.Field(Item.AssetPath)
+			.Field(Item.Field)
+			.Field(Item.SkipReason)
+			.Field(Item.bBlocked)
+			.Field(FHCIDryRunDiff::RiskToString(Item.Risk))
+			.Field(FHCIDryRunDiff::ObjectTypeToString(Item.ObjectType))
+			.Field(FHCIDryRunDiff::LocateStrategyToString(Item.LocateStrategy))
+			.Field(Item.EvidenceKey)
+			.EndRow();
 	}
 
-	return FString::Printf(TEXT("crc32_%08X"), FCrc::StrCrc32(*Canonical));
+	return Digest.Finalize();
 }
 
 static void HCI_CopyStageGIntentToWriteEnableRequest_G2(
@@ -159,6 +135,7 @@ bool FHCIAgentExecutorStageGWriteEnableRequestBridge::BuildStageGWriteEnableRequ
 	const bool bWriteEnableConfirmed,
 	FHCIAgentStageGWriteEnableRequest& OutRequest)
 {
+	HCI_TRACE_SCOPE(TEXT("HCI.StageG.BuildStageGWriteEnableRequest"));
 	HCI_CopyStageGIntentToWriteEnableRequest_G2(StageGExecuteIntent, bWriteEnableConfirmed, OutRequest);
 
 	if (!ExpectedStageGExecuteIntentId.IsEmpty() && StageGExecuteIntent.RequestId != ExpectedStageGExecuteIntentId)
@@ -320,7 +297,7 @@ bool FHCIAgentExecutorStageGWriteEnableRequestBridge::BuildStageGWriteEnableRequ
 		return true;
 	}
 
-	if (StageGExecuteIntent.SelectionDigest != HCI_BuildSelectionDigestFromReviewReport_G2(CurrentReviewReport))
+	if (!FHCIAgentContractDigest::MatchesSelectionDigest(StageGExecuteIntent.SelectionDigest, CurrentReviewReport))
 	{
 		OutRequest.ErrorCode = TEXT("E4202");
 		OutRequest.Reason = TEXT("selection_digest_mismatch");
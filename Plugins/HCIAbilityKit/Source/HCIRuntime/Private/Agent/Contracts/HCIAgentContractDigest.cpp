@@ -0,0 +1,230 @@
+#include "Agent/Contracts/HCIAgentContractDigest.h"
+
+#include "Agent/Executor/HCIDryRunDiff.h"
+#include "Misc/Crc.h"
+
+namespace
+{
+static thread_local FHCIAgentSelectionDigestScope* GHCIActiveSelectionDigestScope = nullptr;
+static TAtomic<int32> GHCISelectionDigestComputeCount(0);
+
+static int32 HCI_FormatInt32(const int32 Value, TCHAR (&OutBuffer)[16])
+{
+	TCHAR Reversed[16];
+	int32 ReversedLen = 0;
+	int64 Magnitude = Value < 0 ? -static_cast<int64>(Value) : static_cast<int64>(Value);
+	do
+	{
+		Reversed[ReversedLen++] = static_cast<TCHAR>(TEXT('0') + (Magnitude % 10));
+		Magnitude /= 10;
+	} while (Magnitude > 0);
+
+	int32 Len = 0;
+	if (Value < 0)
+	{
+		OutBuffer[Len++] = TEXT('-');
+	}
+	while (ReversedLen > 0)
+	{
+		OutBuffer[Len++] = Reversed[--ReversedLen];
+	}
+	OutBuffer[Len] = TEXT('\0');
+	return Len;
+}
+
+template <int32 N>
+static const FString& HCI_LookupLabel(const FString (&Labels)[N], const uint8 Index)
+{
+	return Labels[Index < N - 1 ? Index : N - 1];
+}
+
+static FString HCI_ComputeSelectionDigest(const FHCIDryRunDiffReport& Report, const EHCIAgentDigestAlgorithm Algorithm)
+{
+	// Enum labels are resolved once per digest instead of once per row; the last slot holds the
+	// fallback label so out-of-range values hash exactly like the *ToString helpers.
+	const FString RiskLabels[] = {
+		FHCIDryRunDiff::RiskToString(EHCIDryRunRisk::ReadOnly),
+		FHCIDryRunDiff::RiskToString(EHCIDryRunRisk::Write),
+		FHCIDryRunDiff::RiskToString(EHCIDryRunRisk::Destructive),
+		FHCIDryRunDiff::RiskToString(static_cast<EHCIDryRunRisk>(0xFF))};
+	const FString ObjectTypeLabels[] = {
+		FHCIDryRunDiff::ObjectTypeToString(EHCIDryRunObjectType::Asset),
+		FHCIDryRunDiff::ObjectTypeToString(EHCIDryRunObjectType::Actor),
+		FHCIDryRunDiff::ObjectTypeToString(static_cast<EHCIDryRunObjectType>(0xFF))};
+	const FString LocateStrategyLabels[] = {
+		FHCIDryRunDiff::LocateStrategyToString(EHCIDryRunLocateStrategy::SyncBrowser),
+		FHCIDryRunDiff::LocateStrategyToString(EHCIDryRunLocateStrategy::CameraFocus),
+		FHCIDryRunDiff::LocateStrategyToString(static_cast<EHCIDryRunLocateStrategy>(0xFF))};
+
+	++GHCISelectionDigestComputeCount;
+
+	FHCIAgentDigestBuilder Digest(Algorithm);
+	for (int32 RowIndex = 0; RowIndex < Report.DiffItems.Num(); ++RowIndex)
+	{
+		const FHCIDryRunDiffItem& Item = Report.DiffItems[RowIndex];
+		Digest.Field(RowIndex)
+			.Field(Item.ToolName)
+			.Field(Item.AssetPath)
+			.Field(Item.Field)
+			.Field(HCI_LookupLabel(RiskLabels, static_cast<uint8>(Item.Risk)))
+			.Field(Item.SkipReason)
+			.Field(HCI_LookupLabel(ObjectTypeLabels, static_cast<uint8>(Item.ObjectType)))
+			.Field(HCI_LookupLabel(LocateStrategyLabels, static_cast<uint8>(Item.LocateStrategy)))
+			.EndRow();
+	}
+
+	return Digest.Finalize();
+}
+} // namespace
+
+FHCIAgentDigestBuilder::FHCIAgentDigestBuilder(const EHCIAgentDigestAlgorithm InAlgorithm)
+	: Algorithm(InAlgorithm)
+{
+}
+
+void FHCIAgentDigestBuilder::Append(const TCHAR* Data, const int32 Len)
+{
+	if (Len <= 0)
+	{
+		return;
+	}
+
+	if (Algorithm == EHCIAgentDigestAlgorithm::Crc32)
+	{
+		// Same per-character update as FCrc::StrCrc32 (every char fed as four little-endian bytes, inverted
+		// on entry and exit), bounded by Len instead of a terminator so views and embedded NULs hash exactly
+		// the characters passed. Chaining segments equals hashing their concatenation.
+		uint32 Value = ~Crc;
+		for (int32 Index = 0; Index < Len; ++Index)
+		{
+			uint32 Ch = static_cast<uint32>(Data[Index]);
+			for (int32 Byte = 0; Byte < 4; ++Byte)
+			{
+				Value = (Value >> 8) ^ FCrc::CRCTablesSB8[0][(Value ^ Ch) & 0xFF];
+				Ch >>= 8;
+			}
+		}
+		Crc = ~Value;
+	}
+	else
+	{
+		XxHash.Update(Data, static_cast<uint64>(Len) * sizeof(TCHAR));
+	}
+}
+
+void FHCIAgentDigestBuilder::BeginField()
+{
+	if (bRowHasFields)
+	{
+		Append(TEXT("|"), 1);
+	}
+	bRowHasFields = true;
+}
+
+FHCIAgentDigestBuilder& FHCIAgentDigestBuilder::Field(const FString& Value)
+{
+	BeginField();
+	Append(*Value, Value.Len());
+	return *this;
+}
+
+FHCIAgentDigestBuilder& FHCIAgentDigestBuilder::Field(const TCHAR* Value)
+{
+	BeginField();
+	if (Value != nullptr)
+	{
+		Append(Value, FCString::Strlen(Value));
+	}
+	return *this;
+}
+
+FHCIAgentDigestBuilder& FHCIAgentDigestBuilder::Field(const int32 Value)
+{
+	TCHAR Buffer[16];
+	const int32 Len = HCI_FormatInt32(Value, Buffer);
+	BeginField();
+	Append(Buffer, Len);
+	return *this;
+}
+
+FHCIAgentDigestBuilder& FHCIAgentDigestBuilder::Field(const bool bValue)
+{
+	BeginField();
+	Append(bValue ? TEXT("1") : TEXT("0"), 1);
+	return *this;
+}
+
+FHCIAgentDigestBuilder& FHCIAgentDigestBuilder::EndRow()
+{
+	Append(TEXT("\n"), 1);
+	bRowHasFields = false;
+	return *this;
+}
+
+FString FHCIAgentDigestBuilder::Finalize() const
+{
+	if (Algorithm == EHCIAgentDigestAlgorithm::Crc32)
+	{
+		return FString::Printf(TEXT("%s%08X"), FHCIAgentContractDigest::Crc32Prefix, Crc);
+	}
+
+	return FString::Printf(TEXT("%s%016llx"), FHCIAgentContractDigest::XxHash64Prefix, XxHash.Finalize().Hash);
+}
+
+const TCHAR* FHCIAgentContractDigest::Crc32Prefix = TEXT("crc32_");
+const TCHAR* FHCIAgentContractDigest::XxHash64Prefix = TEXT("xxh64_");
+
+EHCIAgentDigestAlgorithm FHCIAgentContractDigest::DetectAlgorithm(const FString& Digest)
+{
+	return Digest.StartsWith(Crc32Prefix, ESearchCase::CaseSensitive)
+		? EHCIAgentDigestAlgorithm::Crc32
+		: EHCIAgentDigestAlgorithm::XxHash64;
+}
+
+FString FHCIAgentContractDigest::BuildSelectionDigest(const FHCIDryRunDiffReport& Report, const EHCIAgentDigestAlgorithm Algorithm)
+{
+	FHCIAgentSelectionDigestScope* Scope = GHCIActiveSelectionDigestScope;
+	if (Scope == nullptr)
+	{
+		return HCI_ComputeSelectionDigest(Report, Algorithm);
+	}
+
+	const TTuple<const FHCIDryRunDiffReport*, uint8> Key(&Report, static_cast<uint8>(Algorithm));
+	if (const FString* Cached = Scope->Cache.Find(Key))
+	{
+		return *Cached;
+	}
+
+	return Scope->Cache.Add(Key, HCI_ComputeSelectionDigest(Report, Algorithm));
+}
+
+bool FHCIAgentContractDigest::MatchesSelectionDigest(const FString& ExpectedDigest, const FHCIDryRunDiffReport& Report)
+{
+	if (ExpectedDigest.IsEmpty())
+	{
+		return false;
+	}
+
+	return ExpectedDigest == BuildSelectionDigest(Report, DetectAlgorithm(ExpectedDigest));
+}
+
+int32 FHCIAgentContractDigest::GetSelectionDigestComputeCount()
+{
+	return GHCISelectionDigestComputeCount.Load();
+}
+
+void FHCIAgentContractDigest::ResetSelectionDigestComputeCount()
+{
+	GHCISelectionDigestComputeCount.Store(0);
+}
+
+FHCIAgentSelectionDigestScope::FHCIAgentSelectionDigestScope()
+	: Previous(GHCIActiveSelectionDigestScope)
+{
+	GHCIActiveSelectionDigestScope = this;
+}
+
+FHCIAgentSelectionDigestScope::~FHCIAgentSelectionDigestScope()
+{
+	GHCIActiveSelectionDigestScope = Previous;
+}
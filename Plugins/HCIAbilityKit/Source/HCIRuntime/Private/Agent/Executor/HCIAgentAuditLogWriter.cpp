@@ -0,0 +1,328 @@
+#include "Agent/Executor/HCIAgentAuditLogWriter.h"
+
+#include "Containers/StringConv.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogHCIAgentAuditLog, Log, All);
+
+namespace
+{
+static FHCIAgentAuditLogWriterConfig HCI_MakeDefaultAuditLogWriterConfig()
+{
+	FHCIAgentAuditLogWriterConfig Config;
+	Config.FilePath = FHCIAgentAuditLogWriter::GetDefaultFilePath();
+	return Config;
+}
+} // namespace
+
+FHCIAgentAuditLogWriter& FHCIAgentAuditLogWriter::Get()
+{
+	static FHCIAgentAuditLogWriter Instance(HCI_MakeDefaultAuditLogWriterConfig());
+	return Instance;
+}
+
+FString FHCIAgentAuditLogWriter::GetDefaultFilePath()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("HCI"), TEXT("Audit"), TEXT("agent_exec_log.jsonl"));
+}
+
+FHCIAgentAuditLogWriter::FHCIAgentAuditLogWriter(const FHCIAgentAuditLogWriterConfig& InConfig)
+	: Config(InConfig)
+{
+	Config.MaxFileBytes = FMath::Max<int64>(1, Config.MaxFileBytes);
+	Config.MaxRotatedFiles = FMath::Max(0, Config.MaxRotatedFiles);
+	Config.FlushThresholdBytes = FMath::Max(1, Config.FlushThresholdBytes);
+	Config.MaxBufferedBytes = FMath::Max(Config.FlushThresholdBytes, Config.MaxBufferedBytes);
+	PendingBytes.Reserve(Config.FlushThresholdBytes);
+	WriteBuffer.Reserve(Config.FlushThresholdBytes);
+}
+
+FHCIAgentAuditLogWriter::~FHCIAgentAuditLogWriter()
+{
+	Shutdown();
+}
+
+FString FHCIAgentAuditLogWriter::GetRotatedFilePath(const int32 Generation) const
+{
+	return FPaths::Combine(
+		FPaths::GetPath(Config.FilePath),
+		FString::Printf(TEXT("%s.%d%s"), *FPaths::GetBaseFilename(Config.FilePath), Generation, *FPaths::GetExtension(Config.FilePath, true)));
+}
+
+FHCIAgentAuditLogWriterStats FHCIAgentAuditLogWriter::GetStats() const
+{
+	FScopeLock Lock(&StatsLock);
+	return Stats;
+}
+
+bool FHCIAgentAuditLogWriter::EnsureStarted(FString& OutError)
+{
+	if (bStarted)
+	{
+		return true;
+	}
+
+	FScopeLock FileScope(&FileLock);
+	if (bStarted)
+	{
+		return true;
+	}
+	if (!FileHandle.IsValid() && !OpenFileLocked(OutError))
+	{
+		return false;
+	}
+
+	// After Shutdown the writer stays usable but writes through on the caller thread.
+	if (!bShutdown && Config.bUseBackgroundThread && FPlatformProcess::SupportsMultithreading())
+	{
+		bStopping = false;
+		WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+		Thread = FRunnableThread::Create(this, TEXT("HCIAuditLogWriter"), 0, TPri_BelowNormal);
+		if (Thread == nullptr)
+		{
+			FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+			WakeEvent = nullptr;
+		}
+	}
+	if (!SystemErrorHandle.IsValid())
+	{
+		SystemErrorHandle = FCoreDelegates::OnHandleSystemError.AddRaw(this, &FHCIAgentAuditLogWriter::HandleSystemError);
+	}
+
+	bStarted = true;
+	return true;
+}
+
+bool FHCIAgentAuditLogWriter::Append(const FString& JsonLine, FString& OutError)
+{
+	OutError.Reset();
+	if (!EnsureStarted(OutError))
+	{
+		return false;
+	}
+
+	const FTCHARToUTF8 Utf8Line(*JsonLine, JsonLine.Len());
+	bool bReachedThreshold = false;
+	bool bOverflow = false;
+	{
+		FScopeLock BufferScope(&BufferLock);
+		PendingBytes.Append(reinterpret_cast<const uint8*>(Utf8Line.Get()), Utf8Line.Length());
+		PendingBytes.Append(reinterpret_cast<const uint8*>(LINE_TERMINATOR_ANSI), UE_ARRAY_COUNT(LINE_TERMINATOR_ANSI) - 1);
+		++PendingRecords;
+		bReachedThreshold = PendingBytes.Num() >= Config.FlushThresholdBytes;
+		bOverflow = PendingBytes.Num() >= Config.MaxBufferedBytes;
+	}
+	{
+		FScopeLock StatsScope(&StatsLock);
+		++Stats.AppendedRecords;
+		if (bOverflow && Thread != nullptr)
+		{
+			++Stats.SyncDrainCount;
+		}
+	}
+
+	if (Thread == nullptr || bOverflow)
+	{
+		return DrainPending(OutError);
+	}
+	if (bReachedThreshold)
+	{
+		WakeEvent->Trigger();
+	}
+	return true;
+}
+
+bool FHCIAgentAuditLogWriter::Flush(FString& OutError)
+{
+	OutError.Reset();
+	return DrainPending(OutError);
+}
+
+bool FHCIAgentAuditLogWriter::DrainPending(FString& OutError)
+{
+	FScopeLock FileScope(&FileLock);
+	int64 BatchRecords = 0;
+	{
+		FScopeLock BufferScope(&BufferLock);
+		if (PendingBytes.Num() == 0)
+		{
+			return true;
+		}
+		Swap(PendingBytes, WriteBuffer);
+		BatchRecords = PendingRecords;
+		PendingRecords = 0;
+	}
+
+	if (FileHandle.IsValid() && FileSize > 0 && FileSize + WriteBuffer.Num() > Config.MaxFileBytes)
+	{
+		RotateLocked();
+	}
+
+	const bool bWritten = (FileHandle.IsValid() || OpenFileLocked(OutError))
+		&& FileHandle->Write(WriteBuffer.GetData(), WriteBuffer.Num())
+		&& FileHandle->Flush();
+	if (!bWritten)
+	{
+		if (OutError.IsEmpty())
+		{
+			OutError = FString::Printf(TEXT("failed_to_append_audit_log:%s"), *Config.FilePath);
+		}
+		// Keep the batch ahead of anything appended meanwhile so the next drain retries it in order.
+		FScopeLock BufferScope(&BufferLock);
+		PendingBytes.Insert(WriteBuffer, 0);
+		PendingRecords += BatchRecords;
+		WriteBuffer.Reset();
+		FileHandle.Reset();
+		return false;
+	}
+
+	FileSize += WriteBuffer.Num();
+	{
+		FScopeLock StatsScope(&StatsLock);
+		Stats.WrittenBytes += WriteBuffer.Num();
+		++Stats.FlushCount;
+	}
+	WriteBuffer.Reset();
+	return true;
+}
+
+bool FHCIAgentAuditLogWriter::OpenFileLocked(FString& OutError)
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	const FString Directory = FPaths::GetPath(Config.FilePath);
+	if (!PlatformFile.CreateDirectoryTree(*Directory))
+	{
+		OutError = FString::Printf(TEXT("failed_to_create_audit_log_dir:%s"), *Directory);
+		return false;
+	}
+
+	FileHandle.Reset(PlatformFile.OpenWrite(*Config.FilePath, true, true));
+	if (!FileHandle.IsValid())
+	{
+		OutError = FString::Printf(TEXT("failed_to_open_audit_log:%s"), *Config.FilePath);
+		return false;
+	}
+
+	FileSize = FileHandle->Size();
+	return true;
+}
+
+void FHCIAgentAuditLogWriter::RotateLocked()
+{
+	FileHandle.Reset();
+	FileSize = 0;
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	if (Config.MaxRotatedFiles == 0)
+	{
+		PlatformFile.DeleteFile(*Config.FilePath);
+	}
+	else
+	{
+		PlatformFile.DeleteFile(*GetRotatedFilePath(Config.MaxRotatedFiles));
+		for (int32 Generation = Config.MaxRotatedFiles - 1; Generation >= 1; --Generation)
+		{
+			const FString From = GetRotatedFilePath(Generation);
+			if (PlatformFile.FileExists(*From))
+			{
+				PlatformFile.MoveFile(*GetRotatedFilePath(Generation + 1), *From);
+			}
+		}
+		PlatformFile.MoveFile(*GetRotatedFilePath(1), *Config.FilePath);
+	}
+
+	FString OpenError;
+	if (!OpenFileLocked(OpenError))
+	{
+		UE_LOG(LogHCIAgentAuditLog, Warning, TEXT("[HCI][AgentAuditLog] rotate_reopen_failed reason=%s"), *OpenError);
+	}
+
+	FScopeLock StatsScope(&StatsLock);
+	++Stats.RotationCount;
+}
+
+uint32 FHCIAgentAuditLogWriter::Run()
+{
+	const uint32 WaitMs = static_cast<uint32>(FMath::Max(1, FMath::RoundToInt(Config.FlushIntervalSeconds * 1000.0f)));
+	while (!bStopping)
+	{
+		WakeEvent->Wait(WaitMs);
+
+		FString Error;
+		if (!DrainPending(Error))
+		{
+			UE_LOG(LogHCIAgentAuditLog, Warning, TEXT("[HCI][AgentAuditLog] background_flush_failed reason=%s"), *Error);
+		}
+	}
+	return 0;
+}
+
+void FHCIAgentAuditLogWriter::Stop()
+{
+	bStopping = true;
+	if (WakeEvent != nullptr)
+	{
+		WakeEvent->Trigger();
+	}
+}
+
+void FHCIAgentAuditLogWriter::Shutdown()
+{
+	if (Thread != nullptr)
+	{
+		Thread->Kill(true);
+		delete Thread;
+		Thread = nullptr;
+	}
+	if (WakeEvent != nullptr)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+		WakeEvent = nullptr;
+	}
+	bShutdown = true;
+
+	FString Error;
+	if (!DrainPending(Error))
+	{
+		UE_LOG(LogHCIAgentAuditLog, Error, TEXT("[HCI][AgentAuditLog] shutdown_flush_failed reason=%s"), *Error);
+	}
+	{
+		FScopeLock FileScope(&FileLock);
+		FileHandle.Reset();
+	}
+
+	if (SystemErrorHandle.IsValid())
+	{
+		FCoreDelegates::OnHandleSystemError.Remove(SystemErrorHandle);
+		SystemErrorHandle.Reset();
+	}
+	bStarted = false;
+}
+
+void FHCIAgentAuditLogWriter::HandleSystemError()
+{
+	// Crash path: never block on a lock the faulting thread may hold, just write what is reachable.
+	if (!FileLock.TryLock())
+	{
+		return;
+	}
+	if (BufferLock.TryLock())
+	{
+		if (FileHandle.IsValid() && PendingBytes.Num() > 0)
+		{
+			FileHandle->Write(PendingBytes.GetData(), PendingBytes.Num());
+			FileHandle->Flush(true);
+			PendingBytes.Reset();
+			PendingRecords = 0;
+		}
+		BufferLock.Unlock();
+	}
+	FileLock.Unlock();
+}
@@ -3,13 +3,22 @@
 #include "Agent/Executor/HCIAgentExecutionGate.h"
 #include "Agent/Executor/Resolver/HCIEvidenceContext_Default.h"
 #include "Agent/Executor/Resolver/HCIEvidenceResolver_Default.h"
+#include "Common/HCIRequestArena.h"
 #include "Common/HCITimeFormat.h"
+#include "Common/HCITrace.h"
 #include "Dom/JsonObject.h"
 #include "Dom/JsonValue.h"
 #include "Internationalization/Regex.h"
+#include "Misc/PackageName.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogHCIAgentExecutor, Log, All);
 
+TRACE_DECLARE_INT_COUNTER(HCIExecutorStepCount, TEXT("HCI/Executor/Steps"));
+TRACE_DECLARE_INT_COUNTER(HCIExecutorFailedStepCount, TEXT("HCI/Executor/FailedSteps"));
+
 namespace
 {
 static bool HCI_TextMayContainVariableTemplate(const FString& InText)
@@ -75,6 +84,48 @@ static bool HCI_IsWriteLike(const FHCIToolDescriptor* Tool)
 	return Tool && FHCIAgentExecutionGate::IsWriteLikeCapability(Tool->Capability);
 }
 
+// Long package names a write step will touch, from its asset_path / asset_paths args. Unresolved
+// variable templates are skipped; they are picked up again once the step's args are resolved.
+static void HCI_CollectStepPackageNames(const FHCIAgentPlanStep& Step, THCIArenaArray<FString>& OutPackageNames)
+{
+	if (!Step.Args.IsValid())
+	{
+		return;
+	}
+
+	auto AddObjectPath = [&OutPackageNames](const FString& ObjectPath)
+	{
+		if (ObjectPath.IsEmpty() || HCI_TextMayContainVariableTemplate(ObjectPath))
+		{
+			return;
+		}
+		const FString PackageName = FPackageName::ObjectPathToPackageName(ObjectPath);
+		if (FPackageName::IsValidLongPackageName(PackageName))
+		{
+			OutPackageNames.AddUnique(PackageName);
+		}
+	};
+
+	const TArray<TSharedPtr<FJsonValue>>* AssetPaths = nullptr;
+	if (Step.Args->TryGetArrayField(TEXT("asset_paths"), AssetPaths) && AssetPaths)
+	{
+		for (const TSharedPtr<FJsonValue>& Value : *AssetPaths)
+		{
+			FString ObjectPath;
+			if (Value.IsValid() && Value->TryGetString(ObjectPath))
+			{
+				AddObjectPath(ObjectPath);
+			}
+		}
+	}
+
+	FString AssetPath;
+	if (Step.Args->TryGetStringField(TEXT("asset_path"), AssetPath))
+	{
+		AddObjectPath(AssetPath);
+	}
+}
+
 static FString HCI_TerminationPolicyToString(const EHCIAgentExecutorTerminationPolicy Policy)
 {
 	switch (Policy)
@@ -210,7 +261,8 @@ static FHCIAgentExecutorPreflightDecision HCI_EvaluateExecutorPreflight(
 	const FHCIAgentPlanStep& Step,
 	const FHCIAgentExecutorStepResult& StepResult,
 	const FHCIToolRegistry& ToolRegistry,
-	const FHCIAgentExecutorOptions& Options)
+	const FHCIAgentExecutorOptions& Options,
+	const bool bSourceControlCheckoutSucceeded)
 {
 	FHCIAgentExecutorPreflightDecision Preflight;
 	if (!Options.bEnablePreflightGates)
@@ -262,7 +314,7 @@ static FHCIAgentExecutorPreflightDecision HCI_EvaluateExecutorPreflight(
 	}
 
 	const FHCIAgentSourceControlDecision SourceControlDecision = FHCIAgentExecutionGate::EvaluateSourceControlFailFast(
-		{Plan.RequestId, Step.ToolName, Options.bSourceControlEnabled, Options.bSourceControlCheckoutSucceeded},
+		{Plan.RequestId, Step.ToolName, Options.bSourceControlEnabled, bSourceControlCheckoutSucceeded},
 		ToolRegistry);
 	if (!SourceControlDecision.bAllowed)
 	{
@@ -290,6 +342,7 @@ static FHCIAgentExecutorPreflightDecision HCI_EvaluateExecutorPreflight(
 
 static bool HCI_TryRunToolAction(
 	const FHCIAgentPlan& Plan,
+	const int32 StepIndex,
 	const FHCIAgentPlanStep& Step,
 	const FHCIAgentExecutorOptions& Options,
 	FHCIAgentExecutorStepResult& OutStepResult)
@@ -305,11 +358,31 @@ static bool HCI_TryRunToolAction(
 	ActionRequest.StepId = Step.StepId;
 	ActionRequest.ToolName = Step.ToolName;
 	ActionRequest.Args = Step.Args;
+	ActionRequest.Cancellation = Options.Cancellation;
+	if (!Options.bDryRun && Options.ProposalArtifactsByKey.Num() > 0)
+	{
+		if (const FString* Artifact = Options.ProposalArtifactsByKey.Find(FHCIAgentExecutor::MakeProposalArtifactKey(Plan.RequestId, Step)))
+		{
+			ActionRequest.ProposalArtifact = *Artifact;
+		}
+	}
+	if (Options.OnAssetProgress)
+	{
+		ActionRequest.OnAssetProgress = [&Options, StepIndex](const int32 ProcessedAssets, const int32 TotalAssets)
+		{
+			Options.OnAssetProgress(StepIndex, ProcessedAssets, TotalAssets);
+		};
+	}
 
 	FHCIAgentToolActionResult ActionResult;
-	const bool bCallOk = Options.bDryRun
-		? (*FoundAction)->DryRun(ActionRequest, ActionResult)
-		: (*FoundAction)->Execute(ActionRequest, ActionResult);
+	bool bCallOk = false;
+	{
+		const FString StageName = FString::Printf(TEXT("HCI.Tool.%s.%s"), *Step.ToolName.ToString(), Options.bDryRun ? TEXT("DryRun") : TEXT("Execute"));
+		HCI_TRACE_SCOPE_DYNAMIC(StageName);
+		bCallOk = Options.bDryRun
+			? (*FoundAction)->DryRun(ActionRequest, ActionResult)
+			: (*FoundAction)->Execute(ActionRequest, ActionResult);
+	}
 
 	OutStepResult.TargetCountEstimate = FMath::Max(OutStepResult.TargetCountEstimate, ActionResult.EstimatedAffectedCount);
 	OutStepResult.Evidence = MoveTemp(ActionResult.Evidence);
@@ -318,6 +391,11 @@ static bool HCI_TryRunToolAction(
 	OutStepResult.ErrorCode = ActionResult.ErrorCode;
 	OutStepResult.Reason = ActionResult.Reason;
 	OutStepResult.FailurePhase = OutStepResult.bSucceeded ? TEXT("-") : TEXT("execute");
+	if (Options.bDryRun && !ActionResult.ProposalArtifact.IsEmpty())
+	{
+		OutStepResult.ProposalArtifactKey = FHCIAgentExecutor::MakeProposalArtifactKey(Plan.RequestId, Step);
+		OutStepResult.ProposalArtifact = MoveTemp(ActionResult.ProposalArtifact);
+	}
 	return true;
 }
 
@@ -481,278 +559,573 @@ bool FHCIAgentExecutor::ExecutePlan(
 	const FHCIAgentExecutorOptions& Options,
 	FHCIAgentExecutorRunResult& OutResult)
 {
-	HCI_InitRunResultBase(Plan, OutResult);
-	OutResult.ExecutionMode = Options.bDryRun ? TEXT("simulate_dry_run") : TEXT("execute_apply");
-	OutResult.TerminationPolicy = HCI_TerminationPolicyToString(Options.TerminationPolicy);
-	OutResult.bPreflightEnabled = Options.bEnablePreflightGates;
-	OutResult.StartedAtUtc = FHCITimeFormat::FormatNowBeijingIso8601();
+	HCI_TRACE_REQUEST_SCOPE(Plan.RequestId);
+	HCI_TRACE_SCOPE(TEXT("HCI.Executor.ExecutePlan"));
+	FHCIAgentExecutorRun Run(Plan, ToolRegistry, ValidationContext, Options);
+	if (Run.Start())
+	{
+		while (Run.ExecuteNextStep())
+		{
+		}
+	}
+	OutResult = Run.ConsumeResult();
+	return Run.WasRunOk();
+}
+
+FString FHCIAgentExecutor::MakeProposalArtifactKey(const FString& RequestId, const FHCIAgentPlanStep& ResolvedStep)
+{
+	FString ArgsText;
+	if (ResolvedStep.Args.IsValid())
+	{
+		const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+			TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&ArgsText);
+		FJsonSerializer::Serialize(ResolvedStep.Args.ToSharedRef(), Writer);
+	}
+	return FString::Printf(
+		TEXT("%s|%s|%s|%08x"),
+		*RequestId,
+		*ResolvedStep.StepId,
+		*ResolvedStep.ToolName.ToString(),
+		FCrc::StrCrc32(*ArgsText));
+}
+
+FHCIAgentExecutorRun::FHCIAgentExecutorRun(
+	const FHCIAgentPlan& InPlan,
+	const FHCIToolRegistry& InToolRegistry,
+	const FHCIAgentPlanValidationContext& InValidationContext,
+	const FHCIAgentExecutorOptions& InOptions)
+	: Plan(InPlan)
+	, ToolRegistry(InToolRegistry)
+	, ValidationContext(InValidationContext)
+	, Options(InOptions)
+{
+}
+
+bool FHCIAgentExecutorRun::Start()
+{
+	check(!bStarted);
+	bStarted = true;
+
+	HCI_InitRunResultBase(Plan, Result);
+	Result.ExecutionMode = Options.bDryRun ? TEXT("simulate_dry_run") : TEXT("execute_apply");
+	Result.TerminationPolicy = HCI_TerminationPolicyToString(Options.TerminationPolicy);
+	Result.bPreflightEnabled = Options.bEnablePreflightGates;
+	Result.StartedAtUtc = FHCITimeFormat::FormatNowBeijingIso8601();
 
 	const FHCIEvidenceResolver_Default EvidenceResolver;
 	const bool bContainsVariableTemplate = HCI_PlanContainsVariableTemplate(Plan, EvidenceResolver);
-	const bool bUsePerStepValidation = Options.bValidatePlanBeforeExecute && bContainsVariableTemplate;
+	bUsePerStepValidation = Options.bValidatePlanBeforeExecute && bContainsVariableTemplate;
 
 	if (Options.bValidatePlanBeforeExecute && !bUsePerStepValidation)
 	{
 		FHCIAgentPlanValidationResult ValidationResult;
 		if (!FHCIAgentPlanValidator::ValidatePlan(Plan, ToolRegistry, ValidationContext, ValidationResult))
 		{
-			OutResult.bAccepted = false;
-			OutResult.bCompleted = false;
-			OutResult.ErrorCode = ValidationResult.ErrorCode;
-			OutResult.Reason = ValidationResult.Reason;
-			OutResult.TerminalStatus = TEXT("rejected_precheck");
-			OutResult.TerminalReason = TEXT("validator_rejected_plan");
-			OutResult.FailedStepIndex = ValidationResult.FailedStepIndex;
-			OutResult.FailedStepId = ValidationResult.FailedStepId;
-			OutResult.FailedToolName = ValidationResult.FailedToolName;
-			OutResult.FinishedAtUtc = FHCITimeFormat::FormatNowBeijingIso8601();
+			Result.bAccepted = false;
+			Result.bCompleted = false;
+			Result.ErrorCode = ValidationResult.ErrorCode;
+			Result.Reason = ValidationResult.Reason;
+			Result.TerminalStatus = TEXT("rejected_precheck");
+			Result.TerminalReason = TEXT("validator_rejected_plan");
+			Result.FailedStepIndex = ValidationResult.FailedStepIndex;
+			Result.FailedStepId = ValidationResult.FailedStepId;
+			Result.FailedToolName = ValidationResult.FailedToolName;
+			Finish(false);
 			return false;
 		}
 	}
 
-	OutResult.bAccepted = true;
-	OutResult.StepResults.Reserve(Plan.Steps.Num());
-	bool bSawFailure = false;
-	bool bAnySimulatedStep = false;
-	bool bAnyToolActionExecuted = false;
-	TMap<FString, TMap<FString, FString>> StepEvidenceContext;
-	TArray<FHCIAgentPlanStep> ResolvedValidatedPrefixSteps;
+	Result.bAccepted = true;
+	Result.StepResults.Reserve(Plan.Steps.Num());
 	ResolvedValidatedPrefixSteps.Reserve(Plan.Steps.Num());
+	if (Plan.Steps.Num() == 0)
+	{
+		FinishAllStepsExecuted();
+		return true;
+	}
 
-	for (int32 StepIndex = 0; StepIndex < Plan.Steps.Num(); ++StepIndex)
+	PreflightSourceControlCheckout();
+	return true;
+}
+
+bool FHCIAgentExecutorRun::UsesSourceControlCheckout() const
+{
+	// Only a confirmed, gated commit may touch source control; dry runs keep the legacy boolean seam.
+	return Options.SourceControlCheckout.IsValid()
+		&& Options.bSourceControlEnabled
+		&& Options.bEnablePreflightGates
+		&& Options.bUserConfirmedWriteSteps
+		&& !Options.bDryRun;
+}
+
+void FHCIAgentExecutorRun::CheckOutPackages(const TConstArrayView<FString> PackageNames)
+{
+	HCI_REQUEST_ARENA_SCOPE(Plan.RequestId);
+	THCIArenaArray<FString> NewPackageNames;
+	NewPackageNames.Reserve(PackageNames.Num());
+	for (const FString& PackageName : PackageNames)
 	{
-		const FHCIAgentPlanStep& Step = Plan.Steps[StepIndex];
-		if (Options.OnStepBegin)
+		bool bAlreadyRequested = false;
+		CheckoutRequestedPackages.Add(PackageName, &bAlreadyRequested);
+		if (!bAlreadyRequested)
 		{
-			Options.OnStepBegin(StepIndex, Step);
+			NewPackageNames.Add(PackageName);
 		}
-		FHCIAgentPlanStep ResolvedStep;
-		const FHCIEvidenceContext_Default EvidenceContext(StepEvidenceContext);
-		FHCIEvidenceResolveError ResolveError;
-		const bool bResolveOk = EvidenceResolver.ResolveStepArgs(Step, EvidenceContext, ResolvedStep, ResolveError);
-
-		const FHCIToolDescriptor* Tool = ToolRegistry.FindTool(Step.ToolName);
-		FHCIAgentExecutorStepResult& StepResult = HCI_AddStepResultSkeleton(ResolvedStep, StepIndex, ToolRegistry, OutResult);
-		StepResult.bAttempted = true;
-		bool bHasPipelineBypassWarning = false;
-		FString PipelineBypassWarningDetail;
-		if (bResolveOk)
+	}
+	if (NewPackageNames.Num() == 0)
+	{
+		return;
+	}
+
+	TMap<FString, FString> Failures;
+	{
+		HCI_TRACE_SCOPE(TEXT("HCI.Executor.SourceControlCheckout"));
+		// The provider may hold on to the list (e.g. a queued SCC operation), so it gets a heap copy.
+		Options.SourceControlCheckout->CheckOutPackages(FHCIRequestArena::Promote(NewPackageNames), Failures);
+	}
+	Result.SourceControlCheckoutBatches += 1;
+	Result.SourceControlCheckedOutPackages += NewPackageNames.Num() - Failures.Num();
+	CheckoutFailureByPackage.Append(Failures);
+
+	UE_LOG(
+		LogHCIAgentExecutor,
+		Display,
+		TEXT("[HCI][AgentExecutor] source_control_checkout request_id=%s batch=%d packages=%d failed=%d"),
+		*Plan.RequestId,
+		Result.SourceControlCheckoutBatches,
+		NewPackageNames.Num(),
+		Failures.Num());
+}
+
+void FHCIAgentExecutorRun::PreflightSourceControlCheckout()
+{
+	if (!UsesSourceControlCheckout())
+	{
+		return;
+	}
+
+	HCI_REQUEST_ARENA_SCOPE(Plan.RequestId);
+	THCIArenaArray<FString> PackageNames;
+	for (const FHCIAgentPlanStep& Step : Plan.Steps)
+	{
+		if (HCI_IsWriteLike(ToolRegistry.FindTool(Step.ToolName)))
 		{
-			bHasPipelineBypassWarning = HCI_TryDetectPipelineBypassWarning(
-				Plan,
-				StepIndex,
-				Step,
-				ResolvedStep,
-				StepEvidenceContext,
-				PipelineBypassWarningDetail);
+			HCI_CollectStepPackageNames(Step, PackageNames);
+		}
+	}
+	CheckOutPackages(PackageNames);
+}
+
+bool FHCIAgentExecutorRun::ResolveStepCheckout(const FHCIAgentPlanStep& ResolvedStep, FHCIAgentExecutorStepResult& StepResult)
+{
+	if (!UsesSourceControlCheckout())
+	{
+		return Options.bSourceControlCheckoutSucceeded;
+	}
+	if (!StepResult.bWriteLike)
+	{
+		return true;
+	}
+
+	// Args resolved from earlier evidence were not known at Start(); they go out as one batch for this step.
+	HCI_REQUEST_ARENA_SCOPE(Plan.RequestId);
+	THCIArenaArray<FString> PackageNames;
+	HCI_CollectStepPackageNames(ResolvedStep, PackageNames);
+	CheckOutPackages(PackageNames);
+
+	THCIArenaArray<FString> FailedPackages;
+	FString FirstFailureReason;
+	for (const FString& PackageName : PackageNames)
+	{
+		if (const FString* FailureReason = CheckoutFailureByPackage.Find(PackageName))
+		{
+			FailedPackages.Add(PackageName);
+			if (FirstFailureReason.IsEmpty())
+			{
+				FirstFailureReason = *FailureReason;
+			}
 		}
+	}
+	if (FailedPackages.Num() == 0)
+	{
+		return true;
+	}
+
+	StepResult.Evidence.Add(TEXT("checkout_failed_count"), FString::FromInt(FailedPackages.Num()));
+	StepResult.Evidence.Add(TEXT("checkout_failed_packages"), FString::Join(FailedPackages, TEXT("|")));
+	StepResult.Evidence.Add(TEXT("checkout_failure_reason"), FirstFailureReason);
+	return false;
+}
+
+bool FHCIAgentExecutorRun::TryRunToolActionMemoized(
+	const int32 StepIndex,
+	const FHCIToolDescriptor& Tool,
+	const FHCIAgentPlanStep& ResolvedStep,
+	FHCIAgentExecutorStepResult& StepResult)
+{
+	FHCIAgentReadOnlyResultCache* Cache = Options.ReadOnlyResultCache.Get();
+	const TSharedPtr<IHCIAgentToolAction>* FoundAction = Options.ToolActions.Find(ResolvedStep.ToolName);
+	if (Cache == nullptr || FoundAction == nullptr || !FoundAction->IsValid() || HCI_IsWriteLike(&Tool) ||
+		!FHCIAgentReadOnlyResultCache::IsMemoizableTool(ResolvedStep.ToolName))
+	{
+		return HCI_TryRunToolAction(Plan, StepIndex, ResolvedStep, Options, StepResult);
+	}
+
+	const FString CacheKey = FHCIAgentReadOnlyResultCache::MakeKey(ResolvedStep.ToolName, ResolvedStep.Args);
+	if (const FHCIAgentReadOnlyResultCache::FEntry* Cached = Cache->Find(CacheKey))
+	{
+		Result.ReadOnlyCacheHits += 1;
+		StepResult.TargetCountEstimate = FMath::Max(StepResult.TargetCountEstimate, Cached->TargetCountEstimate);
+		StepResult.Evidence = Cached->Evidence;
+		StepResult.bSucceeded = true;
+		StepResult.Status = TEXT("succeeded");
+		StepResult.ErrorCode.Reset();
+		StepResult.Reason = Cached->Reason;
+		StepResult.FailurePhase = TEXT("-");
+		StepResult.bFromReadOnlyCache = true;
+		return true;
+	}
+
+	Result.ReadOnlyCacheMisses += 1;
+	const bool bHandled = HCI_TryRunToolAction(Plan, StepIndex, ResolvedStep, Options, StepResult);
+	if (bHandled && StepResult.bSucceeded)
+	{
+		FHCIAgentReadOnlyResultCache::FEntry Entry;
+		Entry.Reason = StepResult.Reason;
+		Entry.TargetCountEstimate = StepResult.TargetCountEstimate;
+		Entry.Evidence = StepResult.Evidence;
+		Cache->Store(CacheKey, MoveTemp(Entry));
+	}
+	return bHandled;
+}
+
+bool FHCIAgentExecutorRun::IsCancellationRequested() const
+{
+	return Options.Cancellation.IsValid() && Options.Cancellation->IsRequested();
+}
+
+bool FHCIAgentExecutorRun::ExecuteNextStep()
+{
+	check(bStarted);
+	if (bFinished)
+	{
+		return false;
+	}
+
+	if (IsCancellationRequested())
+	{
+		FinishCancelled(NextStepIndex);
+		return false;
+	}
 
-		if (!bResolveOk)
+	const int32 StepIndex = NextStepIndex++;
+	const FHCIAgentPlanStep& Step = Plan.Steps[StepIndex];
+	if (Options.OnStepBegin)
+	{
+		Options.OnStepBegin(StepIndex, Step);
+	}
+	const FHCIEvidenceResolver_Default EvidenceResolver;
+	FHCIAgentPlanStep ResolvedStep;
+	const FHCIEvidenceContext_Default EvidenceContext(StepEvidenceContext);
+	FHCIEvidenceResolveError ResolveError;
+	TRACE_COUNTER_INCREMENT(HCIExecutorStepCount);
+	bool bResolveOk = false;
+	{
+		HCI_TRACE_SCOPE(TEXT("HCI.Executor.ResolveStepArgs"));
+		bResolveOk = EvidenceResolver.ResolveStepArgs(Step, EvidenceContext, ResolvedStep, ResolveError);
+	}
+
+	const FHCIToolDescriptor* Tool = ToolRegistry.FindTool(Step.ToolName);
+	FHCIAgentExecutorStepResult& StepResult = HCI_AddStepResultSkeleton(ResolvedStep, StepIndex, ToolRegistry, Result);
+	StepResult.bAttempted = true;
+	bool bHasPipelineBypassWarning = false;
+	FString PipelineBypassWarningDetail;
+	if (bResolveOk)
+	{
+		bHasPipelineBypassWarning = HCI_TryDetectPipelineBypassWarning(
+			Plan,
+			StepIndex,
+			Step,
+			ResolvedStep,
+			StepEvidenceContext,
+			PipelineBypassWarningDetail);
+	}
+
+	if (!bResolveOk)
+	{
+		StepResult.bSucceeded = false;
+		StepResult.Status = TEXT("failed");
+		StepResult.ErrorCode = ResolveError.ErrorCode.IsEmpty() ? TEXT("E4311") : ResolveError.ErrorCode;
+		StepResult.Reason = ResolveError.Reason.IsEmpty() ? TEXT("resolve_arguments_failed") : ResolveError.Reason;
+		StepResult.FailurePhase = TEXT("precheck");
+	}
+	else if (bUsePerStepValidation)
+	{
+		FHCIAgentPlanValidationResult ValidationResult;
+		if (!HCI_TryValidateStepWithResolvedPrefix(
+				Plan,
+				ResolvedValidatedPrefixSteps,
+				ResolvedStep,
+				ToolRegistry,
+				ValidationContext,
+				ValidationResult))
 		{
 			StepResult.bSucceeded = false;
 			StepResult.Status = TEXT("failed");
-			StepResult.ErrorCode = ResolveError.ErrorCode.IsEmpty() ? TEXT("E4311") : ResolveError.ErrorCode;
-			StepResult.Reason = ResolveError.Reason.IsEmpty() ? TEXT("resolve_arguments_failed") : ResolveError.Reason;
+			StepResult.ErrorCode = ValidationResult.ErrorCode;
+			StepResult.Reason = ValidationResult.Reason;
 			StepResult.FailurePhase = TEXT("precheck");
 		}
-		else if (bUsePerStepValidation)
+		else
 		{
-			FHCIAgentPlanValidationResult ValidationResult;
-			if (!HCI_TryValidateStepWithResolvedPrefix(
-					Plan,
-					ResolvedValidatedPrefixSteps,
-					ResolvedStep,
-					ToolRegistry,
-					ValidationContext,
-					ValidationResult))
-			{
-				StepResult.bSucceeded = false;
-				StepResult.Status = TEXT("failed");
-				StepResult.ErrorCode = ValidationResult.ErrorCode;
-				StepResult.Reason = ValidationResult.Reason;
-				StepResult.FailurePhase = TEXT("precheck");
-			}
-			else
-			{
-				ResolvedValidatedPrefixSteps.Add(ResolvedStep);
-			}
+			ResolvedValidatedPrefixSteps.Add(ResolvedStep);
 		}
+	}
 
-		if (StepResult.Status == TEXT("failed"))
+	if (StepResult.Status == TEXT("failed"))
+	{
+		// precheck failed; continue to unified failure convergence branch below
+	}
+	else if (Tool == nullptr)
+	{
+		StepResult.bSucceeded = false;
+		StepResult.Status = TEXT("failed");
+		StepResult.ErrorCode = TEXT("E4002");
+		StepResult.Reason = TEXT("tool_not_whitelisted");
+		StepResult.FailurePhase = TEXT("execute");
+	}
+	else
+	{
+		const bool bCheckoutSucceeded = ResolveStepCheckout(ResolvedStep, StepResult);
+		const FHCIAgentExecutorPreflightDecision PreflightDecision =
+			HCI_EvaluateExecutorPreflight(Plan, ResolvedStep, StepResult, ToolRegistry, Options, bCheckoutSucceeded);
+		if (!PreflightDecision.bAllowed)
 		{
-			// precheck failed; continue to unified failure convergence branch below
+			StepResult.bSucceeded = false;
+			StepResult.Status = TEXT("failed");
+			StepResult.ErrorCode = PreflightDecision.ErrorCode;
+			StepResult.Reason = PreflightDecision.Reason;
+			StepResult.FailurePhase = TEXT("preflight");
+			StepResult.PreflightGate = PreflightDecision.FailedGate.IsEmpty() ? TEXT("-") : PreflightDecision.FailedGate;
+			Result.PreflightBlockedSteps += 1;
 		}
-		else if (Tool == nullptr)
+		else if (Options.SimulatedFailureStepIndex == StepIndex)
 		{
 			StepResult.bSucceeded = false;
 			StepResult.Status = TEXT("failed");
-			StepResult.ErrorCode = TEXT("E4002");
-			StepResult.Reason = TEXT("tool_not_whitelisted");
+			StepResult.ErrorCode = Options.SimulatedFailureErrorCode.IsEmpty() ? TEXT("E4101") : Options.SimulatedFailureErrorCode;
+			StepResult.Reason = Options.SimulatedFailureReason.IsEmpty() ? TEXT("simulated_tool_execution_failed") : Options.SimulatedFailureReason;
 			StepResult.FailurePhase = TEXT("execute");
+			StepResult.PreflightGate = Options.bEnablePreflightGates ? TEXT("passed") : TEXT("-");
 		}
-			else
+		else
+		{
+			if (Options.OnStepArgsResolved)
 			{
-				const FHCIAgentExecutorPreflightDecision PreflightDecision =
-					HCI_EvaluateExecutorPreflight(Plan, ResolvedStep, StepResult, ToolRegistry, Options);
-			if (!PreflightDecision.bAllowed)
+				Options.OnStepArgsResolved(StepIndex, ResolvedStep);
+			}
+			const bool bHandledByAction = TryRunToolActionMemoized(StepIndex, *Tool, ResolvedStep, StepResult);
+			if (bHandledByAction && !Options.bDryRun)
 			{
-				StepResult.bSucceeded = false;
-				StepResult.Status = TEXT("failed");
-				StepResult.ErrorCode = PreflightDecision.ErrorCode;
-				StepResult.Reason = PreflightDecision.Reason;
-				StepResult.FailurePhase = TEXT("preflight");
-				StepResult.PreflightGate = PreflightDecision.FailedGate.IsEmpty() ? TEXT("-") : PreflightDecision.FailedGate;
-				OutResult.PreflightBlockedSteps += 1;
+				bAnyToolActionExecuted = true;
 			}
-			else if (Options.SimulatedFailureStepIndex == StepIndex)
+			if (bHandledByAction && !StepResult.bSucceeded)
 			{
-				StepResult.bSucceeded = false;
-				StepResult.Status = TEXT("failed");
-				StepResult.ErrorCode = Options.SimulatedFailureErrorCode.IsEmpty() ? TEXT("E4101") : Options.SimulatedFailureErrorCode;
-				StepResult.Reason = Options.SimulatedFailureReason.IsEmpty() ? TEXT("simulated_tool_execution_failed") : Options.SimulatedFailureReason;
-				StepResult.FailurePhase = TEXT("execute");
-				StepResult.PreflightGate = Options.bEnablePreflightGates ? TEXT("passed") : TEXT("-");
+				// Action returned a failed dry-run/execute result.
 			}
-			else
+			else if (bHandledByAction)
 			{
-					const bool bHandledByAction = HCI_TryRunToolAction(Plan, ResolvedStep, Options, StepResult);
-					if (bHandledByAction && !Options.bDryRun)
-					{
-						bAnyToolActionExecuted = true;
-					}
-					if (bHandledByAction && !StepResult.bSucceeded)
-					{
-						// Action returned a failed dry-run/execute result.
-				}
-				else if (bHandledByAction)
-				{
-					if (StepResult.Reason.IsEmpty())
-					{
-						StepResult.Reason = Options.bDryRun ? TEXT("tool_action_dry_run_success") : TEXT("tool_action_execute_success");
-					}
-					StepResult.PreflightGate = Options.bEnablePreflightGates ? TEXT("passed") : TEXT("-");
-				}
-				else
+				if (StepResult.Reason.IsEmpty())
 				{
-					for (const FString& EvidenceKey : Step.ExpectedEvidence)
-					{
-						StepResult.Evidence.Add(EvidenceKey, HCI_BuildEvidenceValue(EvidenceKey, ResolvedStep));
-					}
-
-						StepResult.bSucceeded = true;
-						StepResult.Status = TEXT("succeeded");
-						StepResult.Reason = Options.bDryRun ? TEXT("simulated_dry_run_success") : TEXT("simulated_apply_success");
-						StepResult.PreflightGate = Options.bEnablePreflightGates ? TEXT("passed") : TEXT("-");
-						bAnySimulatedStep = true;
-					}
-					}
+					StepResult.Reason = Options.bDryRun ? TEXT("tool_action_dry_run_success") : TEXT("tool_action_execute_success");
 				}
-
-			if (bHasPipelineBypassWarning)
+				StepResult.PreflightGate = Options.bEnablePreflightGates ? TEXT("passed") : TEXT("-");
+			}
+			else
 			{
-				StepResult.Evidence.Add(TEXT("planning_warning_code"), TEXT("W5101"));
-				StepResult.Evidence.Add(TEXT("planning_warning_reason"), TEXT("planner_pipeline_variable_not_used_after_search"));
-				StepResult.Evidence.Add(
-					TEXT("planning_warning_detail"),
-					PipelineBypassWarningDetail.IsEmpty()
-						? TEXT("Pipe variable from previous SearchPath step is defined but not consumed.")
-						: PipelineBypassWarningDetail);
-				if (StepResult.bSucceeded)
+				for (const FString& EvidenceKey : Step.ExpectedEvidence)
 				{
-					StepResult.bSucceeded = false;
-					StepResult.Status = TEXT("failed");
-					StepResult.ErrorCode = TEXT("E4009");
-					StepResult.Reason = TEXT("planner_pipeline_variable_not_used_after_search");
-					StepResult.FailurePhase = TEXT("precheck");
+					StepResult.Evidence.Add(EvidenceKey, HCI_BuildEvidenceValue(EvidenceKey, ResolvedStep));
 				}
-				UE_LOG(
-					LogHCIAgentExecutor,
-					Warning,
-					TEXT("[HCI][AgentExecutor] error_code=E4009 warning_code=W5101 step_id=%s tool=%s reason=planner_pipeline_variable_not_used_after_search detail=%s"),
-					*StepResult.StepId,
-					*StepResult.ToolName,
-					PipelineBypassWarningDetail.IsEmpty()
-						? TEXT("Pipe variable from previous SearchPath step is defined but not consumed.")
-						: *PipelineBypassWarningDetail);
-			}
 
-			if (StepResult.bSucceeded)
-			{
-			if (!StepResult.StepId.IsEmpty())
-			{
-				StepEvidenceContext.Add(StepResult.StepId, StepResult.Evidence);
+				StepResult.bSucceeded = true;
+				StepResult.Status = TEXT("succeeded");
+				StepResult.Reason = Options.bDryRun ? TEXT("simulated_dry_run_success") : TEXT("simulated_apply_success");
+				StepResult.PreflightGate = Options.bEnablePreflightGates ? TEXT("passed") : TEXT("-");
+				bAnySimulatedStep = true;
 			}
-			OutResult.SucceededSteps += 1;
-			continue;
 		}
+	}
+
+	if (bHasPipelineBypassWarning)
+	{
+		StepResult.Evidence.Add(TEXT("planning_warning_code"), TEXT("W5101"));
+		StepResult.Evidence.Add(TEXT("planning_warning_reason"), TEXT("planner_pipeline_variable_not_used_after_search"));
+		StepResult.Evidence.Add(
+			TEXT("planning_warning_detail"),
+			PipelineBypassWarningDetail.IsEmpty()
+				? TEXT("Pipe variable from previous SearchPath step is defined but not consumed.")
+				: PipelineBypassWarningDetail);
+		if (StepResult.bSucceeded)
+		{
+			StepResult.bSucceeded = false;
+			StepResult.Status = TEXT("failed");
+			StepResult.ErrorCode = TEXT("E4009");
+			StepResult.Reason = TEXT("planner_pipeline_variable_not_used_after_search");
+			StepResult.FailurePhase = TEXT("precheck");
+		}
+		UE_LOG(
+			LogHCIAgentExecutor,
+			Warning,
+			TEXT("[HCI][AgentExecutor] error_code=E4009 warning_code=W5101 step_id=%s tool=%s reason=planner_pipeline_variable_not_used_after_search detail=%s"),
+			*StepResult.StepId,
+			*StepResult.ToolName,
+			PipelineBypassWarningDetail.IsEmpty()
+				? TEXT("Pipe variable from previous SearchPath step is defined but not consumed.")
+				: *PipelineBypassWarningDetail);
+	}
 
+	// A tool action that stopped between asset batches keeps its partial evidence; the run ends as cancelled.
+	if (StepResult.ErrorCode == HCIAgentExecutorCancelledErrorCode)
+	{
+		StepResult.Status = TEXT("cancelled");
+		Result.ExecutedSteps = StepIndex + 1;
+		FinishCancelled(StepIndex + 1);
+		return false;
+	}
+
+	if (StepResult.bSucceeded)
+	{
+		if (!StepResult.StepId.IsEmpty())
+		{
+			StepEvidenceContext.Add(StepResult.StepId, StepResult.Evidence);
+		}
+		Result.SucceededSteps += 1;
+	}
+	else
+	{
 		bSawFailure = true;
-		OutResult.FailedSteps += 1;
-		if (OutResult.FailedStepIndex == INDEX_NONE)
+		Result.FailedSteps += 1;
+		TRACE_COUNTER_INCREMENT(HCIExecutorFailedStepCount);
+		if (Result.FailedStepIndex == INDEX_NONE)
 		{
-			OutResult.FailedStepIndex = StepIndex;
-			OutResult.FailedStepId = Step.StepId;
-			OutResult.FailedToolName = Step.ToolName.ToString();
-			OutResult.FailedGate = StepResult.FailurePhase == TEXT("preflight") ? StepResult.PreflightGate : FString(TEXT("-"));
-			OutResult.ErrorCode = StepResult.ErrorCode;
-			OutResult.Reason = StepResult.Reason;
+			Result.FailedStepIndex = StepIndex;
+			Result.FailedStepId = Step.StepId;
+			Result.FailedToolName = Step.ToolName.ToString();
+			Result.FailedGate = StepResult.FailurePhase == TEXT("preflight") ? StepResult.PreflightGate : FString(TEXT("-"));
+			Result.ErrorCode = StepResult.ErrorCode;
+			Result.Reason = StepResult.Reason;
 		}
 
 		if (Options.TerminationPolicy == EHCIAgentExecutorTerminationPolicy::StopOnFirstFailure)
 		{
-			OutResult.ExecutedSteps = StepIndex + 1;
-			OutResult.SkippedSteps = FMath::Max(0, Plan.Steps.Num() - OutResult.ExecutedSteps);
-
-			for (int32 RemainingIndex = StepIndex + 1; RemainingIndex < Plan.Steps.Num(); ++RemainingIndex)
-			{
-				const FHCIAgentPlanStep& RemainingStep = Plan.Steps[RemainingIndex];
-				FHCIAgentExecutorStepResult& SkippedRow =
-					HCI_AddStepResultSkeleton(RemainingStep, RemainingIndex, ToolRegistry, OutResult);
-				SkippedRow.bAttempted = false;
-				SkippedRow.bSucceeded = false;
-				SkippedRow.Status = TEXT("skipped");
-				SkippedRow.Reason = TEXT("terminated_by_stop_on_first_failure");
-			}
-
-			OutResult.bCompleted = false;
-			OutResult.TerminalStatus = TEXT("failed");
-			OutResult.TerminalReason =
-				(StepResult.FailurePhase == TEXT("preflight"))
-					? TEXT("executor_preflight_gate_failed_stop_on_first_failure")
-					: TEXT("executor_step_failed_stop_on_first_failure");
-			OutResult.FinishedAtUtc = FHCITimeFormat::FormatNowBeijingIso8601();
+			const bool bPreflightFailure = StepResult.FailurePhase == TEXT("preflight");
+			Result.ExecutedSteps = StepIndex + 1;
+			Result.SkippedSteps = FMath::Max(0, Plan.Steps.Num() - Result.ExecutedSteps);
+			AddSkippedRows(StepIndex + 1, TEXT("terminated_by_stop_on_first_failure"));
+
+			Result.bCompleted = false;
+			Result.TerminalStatus = TEXT("failed");
+			Result.TerminalReason = bPreflightFailure
+				? TEXT("executor_preflight_gate_failed_stop_on_first_failure")
+				: TEXT("executor_step_failed_stop_on_first_failure");
+			Finish(false);
 			return false;
 		}
 	}
 
-	OutResult.ExecutedSteps = OutResult.TotalSteps;
-	OutResult.SkippedSteps = 0;
-	if (bSawFailure)
+	if (NextStepIndex >= Plan.Steps.Num())
 	{
-		OutResult.bCompleted = false;
-		OutResult.TerminalStatus = TEXT("completed_with_failures");
-		OutResult.TerminalReason = (OutResult.PreflightBlockedSteps > 0)
-									 ? TEXT("executor_preflight_gate_failed_continue_on_failure")
-									 : TEXT("executor_step_failed_continue_on_failure");
-		OutResult.FinishedAtUtc = FHCITimeFormat::FormatNowBeijingIso8601();
+		FinishAllStepsExecuted();
 		return false;
 	}
+	return true;
+}
+
+void FHCIAgentExecutorRun::AddSkippedRows(const int32 FromIndex, const TCHAR* Reason)
+{
+	for (int32 RemainingIndex = FromIndex; RemainingIndex < Plan.Steps.Num(); ++RemainingIndex)
+	{
+		const FHCIAgentPlanStep& RemainingStep = Plan.Steps[RemainingIndex];
+		FHCIAgentExecutorStepResult& SkippedRow = HCI_AddStepResultSkeleton(RemainingStep, RemainingIndex, ToolRegistry, Result);
+		SkippedRow.bAttempted = false;
+		SkippedRow.bSucceeded = false;
+		SkippedRow.Status = TEXT("skipped");
+		SkippedRow.Reason = Reason;
+	}
+}
+
+void FHCIAgentExecutorRun::FinishCancelled(const int32 FirstUnexecutedStepIndex)
+{
+	Result.ExecutedSteps = FirstUnexecutedStepIndex;
+	Result.SkippedSteps = FMath::Max(0, Plan.Steps.Num() - FirstUnexecutedStepIndex);
+	AddSkippedRows(FirstUnexecutedStepIndex, TEXT("cancelled_by_user"));
+
+	Result.bCompleted = false;
+	if (Result.ErrorCode.IsEmpty())
+	{
+		Result.ErrorCode = HCIAgentExecutorCancelledErrorCode;
+		Result.Reason = TEXT("executor_cancelled_by_user");
+	}
+	Result.TerminalStatus = TEXT("cancelled");
+	Result.TerminalReason = TEXT("executor_cancelled_by_user");
+	UE_LOG(
+		LogHCIAgentExecutor,
+		Display,
+		TEXT("[HCI][AgentExecutor] cancelled request_id=%s executed_steps=%d skipped_steps=%d"),
+		*Plan.RequestId,
+		Result.ExecutedSteps,
+		Result.SkippedSteps);
+	Finish(false);
+}
+
+void FHCIAgentExecutorRun::FinishAllStepsExecuted()
+{
+	Result.ExecutedSteps = Result.TotalSteps;
+	Result.SkippedSteps = 0;
+	if (bSawFailure)
+	{
+		Result.bCompleted = false;
+		Result.TerminalStatus = TEXT("completed_with_failures");
+		Result.TerminalReason = (Result.PreflightBlockedSteps > 0)
+			? TEXT("executor_preflight_gate_failed_continue_on_failure")
+			: TEXT("executor_step_failed_continue_on_failure");
+		Finish(false);
+		return;
+	}
 
-	OutResult.bCompleted = true;
-	OutResult.TerminalStatus = TEXT("completed");
+	Result.bCompleted = true;
+	Result.TerminalStatus = TEXT("completed");
 	if (Options.bDryRun)
 	{
-		OutResult.TerminalReason = TEXT("executor_simulated_dry_run_completed");
+		Result.TerminalReason = TEXT("executor_simulated_dry_run_completed");
 	}
 	else if (bAnySimulatedStep || !bAnyToolActionExecuted)
 	{
-		OutResult.TerminalReason = TEXT("executor_execute_completed_with_simulated_steps");
+		Result.TerminalReason = TEXT("executor_execute_completed_with_simulated_steps");
 	}
 	else
 	{
-		OutResult.TerminalReason = TEXT("executor_execute_completed");
+		Result.TerminalReason = TEXT("executor_execute_completed");
+	}
+	Finish(true);
+}
+
+void FHCIAgentExecutorRun::Finish(const bool bInRunOk)
+{
+	bRunOk = bInRunOk;
+	bFinished = true;
+	Result.FinishedAtUtc = FHCITimeFormat::FormatNowBeijingIso8601();
+
+	FHCIRequestArenaStats ArenaStats;
+	if (FHCIRequestArena::GetRequestStats(Plan.RequestId, ArenaStats))
+	{
+		Result.TransientArenaAllocations = ArenaStats.AllocationCount;
+		Result.TransientArenaPeakBytes = ArenaStats.PeakBytes;
 	}
-	OutResult.FinishedAtUtc = FHCITimeFormat::FormatNowBeijingIso8601();
-	return true;
 }
 
+FHCIAgentExecutorRunResult FHCIAgentExecutorRun::ConsumeResult()
+{
+	return MoveTemp(Result);
+}
@@ -0,0 +1,155 @@
+#include "Agent/Executor/HCIAgentReadOnlyResultCache.h"
+
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+namespace
+{
+static void HCI_AppendCanonicalJson(const TSharedPtr<FJsonValue>& Value, FString& Out);
+
+static void HCI_AppendCanonicalJsonObject(const TSharedPtr<FJsonObject>& Object, FString& Out)
+{
+	if (!Object.IsValid())
+	{
+		Out += TEXT("null");
+		return;
+	}
+
+	TArray<FString> Keys;
+	Object->Values.GetKeys(Keys);
+	Keys.Sort();
+
+	Out += TEXT("{");
+	for (int32 Index = 0; Index < Keys.Num(); ++Index)
+	{
+		if (Index > 0)
+		{
+			Out += TEXT(",");
+		}
+		Out += FString::Printf(TEXT("\"%s\":"), *Keys[Index].ReplaceCharWithEscapedChar());
+		HCI_AppendCanonicalJson(Object->Values.FindRef(Keys[Index]), Out);
+	}
+	Out += TEXT("}");
+}
+
+static void HCI_AppendCanonicalJson(const TSharedPtr<FJsonValue>& Value, FString& Out)
+{
+	if (!Value.IsValid())
+	{
+		Out += TEXT("null");
+		return;
+	}
+
+	switch (Value->Type)
+	{
+	case EJson::String:
+		Out += FString::Printf(TEXT("\"%s\""), *Value->AsString().ReplaceCharWithEscapedChar());
+		break;
+	case EJson::Number:
+		Out += FString::SanitizeFloat(Value->AsNumber());
+		break;
+	case EJson::Boolean:
+		Out += Value->AsBool() ? TEXT("true") : TEXT("false");
+		break;
+	case EJson::Array:
+	{
+		// Element order is kept: asset_paths order can change which asset a step reports first.
+		Out += TEXT("[");
+		const TArray<TSharedPtr<FJsonValue>>& Items = Value->AsArray();
+		for (int32 Index = 0; Index < Items.Num(); ++Index)
+		{
+			if (Index > 0)
+			{
+				Out += TEXT(",");
+			}
+			HCI_AppendCanonicalJson(Items[Index], Out);
+		}
+		Out += TEXT("]");
+		break;
+	}
+	case EJson::Object:
+		HCI_AppendCanonicalJsonObject(Value->AsObject(), Out);
+		break;
+	default:
+		Out += TEXT("null");
+		break;
+	}
+}
+} // namespace
+
+FHCIAgentReadOnlyResultCache::FHCIAgentReadOnlyResultCache(const int32 InMaxEntries)
+	: MaxEntries(FMath::Max(1, InMaxEntries))
+{
+}
+
+bool FHCIAgentReadOnlyResultCache::IsMemoizableTool(const FName ToolName)
+{
+	return ToolName == TEXT("ScanAssets") || ToolName == TEXT("ScanMeshTriangleCount") || ToolName == TEXT("SearchPath");
+}
+
+FString FHCIAgentReadOnlyResultCache::MakeKey(const FName ToolName, const TSharedPtr<FJsonObject>& Args)
+{
+	FString Key = ToolName.ToString();
+	Key += TEXT("|");
+	HCI_AppendCanonicalJsonObject(Args, Key);
+	return Key;
+}
+
+const FHCIAgentReadOnlyResultCache::FEntry* FHCIAgentReadOnlyResultCache::Find(const FString& Key)
+{
+	FSlot* Slot = EntriesByKey.Find(Key);
+	if (Slot != nullptr && Slot->Generation != Generation)
+	{
+		EntriesByKey.Remove(Key);
+		Slot = nullptr;
+	}
+	if (Slot == nullptr)
+	{
+		++MissCount;
+		return nullptr;
+	}
+
+	++HitCount;
+	Slot->LastUsed = ++UseCounter;
+	return &Slot->Entry;
+}
+
+void FHCIAgentReadOnlyResultCache::Store(const FString& Key, FEntry Entry)
+{
+	if (!EntriesByKey.Contains(Key) && EntriesByKey.Num() >= MaxEntries)
+	{
+		// Prefer dropping entries an asset change already invalidated, then the least recently used one.
+		const uint64 CurrentGeneration = Generation;
+		const FString* Victim = nullptr;
+		uint64 VictimLastUsed = MAX_uint64;
+		for (const TPair<FString, FSlot>& Pair : EntriesByKey)
+		{
+			if (Pair.Value.Generation != CurrentGeneration)
+			{
+				Victim = &Pair.Key;
+				break;
+			}
+			if (Pair.Value.LastUsed < VictimLastUsed)
+			{
+				Victim = &Pair.Key;
+				VictimLastUsed = Pair.Value.LastUsed;
+			}
+		}
+		if (Victim != nullptr)
+		{
+			EntriesByKey.Remove(FString(*Victim));
+		}
+	}
+
+	FSlot& Slot = EntriesByKey.FindOrAdd(Key);
+	Slot.Entry = MoveTemp(Entry);
+	Slot.Generation = Generation;
+	Slot.LastUsed = ++UseCounter;
+}
+
+void FHCIAgentReadOnlyResultCache::Reset()
+{
+	EntriesByKey.Reset();
+	HitCount = 0;
+	MissCount = 0;
+}
@@ -0,0 +1,28 @@
+#include "Agent/Executor/HCIAgentSourceControlCheckout.h"
+
+void FHCIInMemorySourceControlCheckout::LockPackage(const FString& PackageName, const FString& Reason)
+{
+	LockReasonByPackage.Add(PackageName, Reason);
+}
+
+bool FHCIInMemorySourceControlCheckout::IsCheckedOut(const FString& PackageName) const
+{
+	return CheckedOutPackages.Contains(PackageName);
+}
+
+void FHCIInMemorySourceControlCheckout::CheckOutPackages(
+	const TArray<FString>& PackageNames,
+	TMap<FString, FString>& OutFailureReasonByPackage)
+{
+	++BatchCount;
+	RequestedPackageCount += PackageNames.Num();
+	for (const FString& PackageName : PackageNames)
+	{
+		if (const FString* LockReason = LockReasonByPackage.Find(PackageName))
+		{
+			OutFailureReasonByPackage.Add(PackageName, *LockReason);
+			continue;
+		}
+		CheckedOutPackages.Add(PackageName);
+	}
+}
@@ -0,0 +1,238 @@
+#include "Agent/Executor/HCIAgentSpeculativeReadOnlyRun.h"
+
+#include "Agent/Executor/HCIAgentExecutionGate.h"
+#include "Common/HCITrace.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogHCISpeculativeRun, Log, All);
+
+namespace
+{
+static bool HCI_IsSpeculableStep(const FHCIAgentPlanStep& Step, const FHCIToolRegistry& ToolRegistry)
+{
+	if (Step.RiskLevel != EHCIAgentPlanRiskLevel::ReadOnly || Step.bRequiresConfirm ||
+		!FHCIAgentReadOnlyResultCache::IsMemoizableTool(Step.ToolName))
+	{
+		return false;
+	}
+	const FHCIToolDescriptor* Tool = ToolRegistry.FindTool(Step.ToolName);
+	return Tool != nullptr && !FHCIAgentExecutionGate::IsWriteLikeCapability(Tool->Capability);
+}
+
+// Args that bind an earlier step's evidence ({{step.key}}) only resolve inside the real run.
+static bool HCI_KeyHasPipelineVariable(const FString& Key)
+{
+	return Key.Contains(TEXT("{{")) && Key.Contains(TEXT("}}"));
+}
+} // namespace
+
+TArray<FHCIAgentPlanStep> FHCIAgentSpeculativeReadOnlyRun::SelectSpeculativeSteps(
+	const FHCIAgentPlan& LikelyPlan,
+	const FHCIToolRegistry& ToolRegistry)
+{
+	TArray<FHCIAgentPlanStep> Selected;
+	TSet<FString> SeenKeys;
+	for (const FHCIAgentPlanStep& Step : LikelyPlan.Steps)
+	{
+		if (!HCI_IsSpeculableStep(Step, ToolRegistry))
+		{
+			continue;
+		}
+		const FString Key = FHCIAgentReadOnlyResultCache::MakeKey(Step.ToolName, Step.Args);
+		bool bAlreadySeen = false;
+		SeenKeys.Add(Key, &bAlreadySeen);
+		if (!bAlreadySeen && !HCI_KeyHasPipelineVariable(Key))
+		{
+			Selected.Add(Step);
+		}
+	}
+	return Selected;
+}
+
+TSharedPtr<FHCIAgentSpeculativeReadOnlyRun> FHCIAgentSpeculativeReadOnlyRun::Create(
+	const FHCIAgentPlan& LikelyPlan,
+	const FHCIToolRegistry& ToolRegistry,
+	const FHCIAgentExecutorOptions& Options)
+{
+	if (!Options.ReadOnlyResultCache.IsValid())
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<FHCIAgentSpeculativeReadOnlyRun> Run = MakeShareable(new FHCIAgentSpeculativeReadOnlyRun(LikelyPlan, ToolRegistry, Options));
+	if (Run->PendingSteps.Num() == 0)
+	{
+		return nullptr;
+	}
+
+	UE_LOG(
+		LogHCISpeculativeRun,
+		Display,
+		TEXT("[HCI][SpeculativeRun] started request_id=%s intent=%s likely_steps=%d speculated_steps=%d"),
+		*Run->RequestId,
+		*Run->Intent,
+		LikelyPlan.Steps.Num(),
+		Run->PendingSteps.Num());
+	return Run;
+}
+
+FHCIAgentSpeculativeReadOnlyRun::FHCIAgentSpeculativeReadOnlyRun(
+	const FHCIAgentPlan& LikelyPlan,
+	const FHCIToolRegistry& InToolRegistry,
+	const FHCIAgentExecutorOptions& InOptions)
+	: ToolRegistry(InToolRegistry)
+	, Options(InOptions)
+	, RequestId(FString::Printf(TEXT("%s_speculative"), *LikelyPlan.RequestId))
+	, Intent(LikelyPlan.Intent)
+	, PlanVersion(LikelyPlan.PlanVersion)
+{
+	// Whatever the caller's options say, speculation never commits, never prompts and never fails a gate.
+	Options.bDryRun = true;
+	Options.bValidatePlanBeforeExecute = false;
+	Options.bEnablePreflightGates = false;
+	Options.bUserConfirmedWriteSteps = false;
+	Options.TerminationPolicy = EHCIAgentExecutorTerminationPolicy::StopOnFirstFailure;
+	Options.SourceControlCheckout.Reset();
+	Options.ProposalArtifactsByKey.Reset();
+	Options.OnStepBegin = nullptr;
+	Options.OnAssetProgress = nullptr;
+	Options.Cancellation = MakeShared<FHCIAgentExecutionCancellation>();
+
+	PendingSteps = SelectSpeculativeSteps(LikelyPlan, ToolRegistry);
+	for (const FHCIAgentPlanStep& Step : PendingSteps)
+	{
+		SpeculatedKeys.Add(FHCIAgentReadOnlyResultCache::MakeKey(Step.ToolName, Step.Args));
+	}
+	Stats.SpeculatedSteps = PendingSteps.Num();
+}
+
+FHCIAgentSpeculativeReadOnlyRun::~FHCIAgentSpeculativeReadOnlyRun()
+{
+	StopTicking();
+}
+
+void FHCIAgentSpeculativeReadOnlyRun::StartTicking()
+{
+	if (TickerHandle.IsValid() || IsFinished())
+	{
+		return;
+	}
+
+	// The ticker holds the run alive until its last step; Cancel()/Reconcile() remove it early.
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateLambda([Run = AsShared()](float)
+		{
+			if (Run->ExecuteNextStep())
+			{
+				return true;
+			}
+			Run->TickerHandle.Reset();
+			return false;
+		}));
+}
+
+void FHCIAgentSpeculativeReadOnlyRun::StopTicking()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+}
+
+bool FHCIAgentSpeculativeReadOnlyRun::ExecuteNextStep()
+{
+	if (IsFinished())
+	{
+		return false;
+	}
+
+	HCI_TRACE_SCOPE(TEXT("HCI.Executor.SpeculativeStep"));
+	FHCIAgentPlan StepPlan;
+	StepPlan.PlanVersion = PlanVersion;
+	StepPlan.RequestId = RequestId;
+	StepPlan.Intent = Intent;
+	StepPlan.Steps.Add(PendingSteps[0]);
+	PendingSteps.RemoveAt(0);
+
+	FHCIAgentExecutorRunResult RunResult;
+	FHCIAgentExecutor::ExecutePlan(StepPlan, ToolRegistry, FHCIAgentPlanValidationContext(), Options, RunResult);
+	Stats.ExecutedSteps += 1;
+
+	const FHCIAgentExecutorStepResult* StepResult = RunResult.StepResults.Num() > 0 ? &RunResult.StepResults[0] : nullptr;
+	UE_LOG(
+		LogHCISpeculativeRun,
+		Verbose,
+		TEXT("[HCI][SpeculativeRun] step request_id=%s tool=%s status=%s from_cache=%s pending=%d"),
+		*RequestId,
+		*StepPlan.Steps[0].ToolName.ToString(),
+		StepResult != nullptr ? *StepResult->Status : TEXT("-"),
+		StepResult != nullptr && StepResult->bFromReadOnlyCache ? TEXT("true") : TEXT("false"),
+		PendingSteps.Num());
+	return !IsFinished();
+}
+
+int32 FHCIAgentSpeculativeReadOnlyRun::Reconcile(const FHCIAgentPlan& RealPlan)
+{
+	TSet<FString> RealKeys;
+	int32 MatchedSteps = 0;
+	for (const FHCIAgentPlanStep& Step : RealPlan.Steps)
+	{
+		if (!FHCIAgentReadOnlyResultCache::IsMemoizableTool(Step.ToolName))
+		{
+			continue;
+		}
+		const FString Key = FHCIAgentReadOnlyResultCache::MakeKey(Step.ToolName, Step.Args);
+		RealKeys.Add(Key);
+		MatchedSteps += SpeculatedKeys.Contains(Key) ? 1 : 0;
+	}
+	Stats.MatchedSteps = MatchedSteps;
+
+	const int32 Dropped = PendingSteps.RemoveAll([&RealKeys](const FHCIAgentPlanStep& Step)
+	{
+		return !RealKeys.Contains(FHCIAgentReadOnlyResultCache::MakeKey(Step.ToolName, Step.Args));
+	});
+	Stats.DroppedSteps += Dropped;
+
+	UE_LOG(
+		LogHCISpeculativeRun,
+		Display,
+		TEXT("[HCI][SpeculativeRun] reconciled request_id=%s real_request_id=%s speculated=%d executed=%d matched=%d dropped=%d pending=%d"),
+		*RequestId,
+		*RealPlan.RequestId,
+		Stats.SpeculatedSteps,
+		Stats.ExecutedSteps,
+		MatchedSteps,
+		Dropped,
+		PendingSteps.Num());
+
+	if (PendingSteps.Num() == 0)
+	{
+		StopTicking();
+		if (Dropped > 0)
+		{
+			Cancel();
+		}
+	}
+	return MatchedSteps;
+}
+
+void FHCIAgentSpeculativeReadOnlyRun::Cancel()
+{
+	StopTicking();
+	if (Stats.bCancelled)
+	{
+		return;
+	}
+
+	Options.Cancellation->Request();
+	Stats.bCancelled = true;
+	Stats.DroppedSteps += PendingSteps.Num();
+	UE_LOG(
+		LogHCISpeculativeRun,
+		Display,
+		TEXT("[HCI][SpeculativeRun] cancelled request_id=%s executed=%d dropped=%d"),
+		*RequestId,
+		Stats.ExecutedSteps,
+		PendingSteps.Num());
+	PendingSteps.Reset();
+}
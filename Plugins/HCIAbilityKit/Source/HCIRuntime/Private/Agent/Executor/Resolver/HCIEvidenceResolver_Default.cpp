@@ -5,6 +5,7 @@
 #include "Dom/JsonObject.h"
 #include "Dom/JsonValue.h"
 #include "Internationalization/Regex.h"
+#include "String/ParseTokens.h"
 
 namespace
 {
@@ -128,16 +129,23 @@ static bool HCI_TryResolveEvidenceReference(
 			return !OutValue.IsEmpty();
 		}
 
+		// Walk the pipe list in place instead of splitting it: only the selected token is copied out.
 		FString BaseValue;
-		if (EvidenceContext.TryGetEvidenceValue(StepId, EvidenceKey, BaseValue))
+		if (Index >= 0 && EvidenceContext.TryGetEvidenceValue(StepId, EvidenceKey, BaseValue))
 		{
-			TArray<FString> Tokens;
-			BaseValue.ParseIntoArray(Tokens, TEXT("|"), true);
-			if (Tokens.IsValidIndex(Index))
-			{
-				OutValue = Tokens[Index];
-				return !OutValue.IsEmpty();
-			}
+			int32 TokenIndex = 0;
+			UE::String::ParseTokens(
+				BaseValue,
+				TEXT('|'),
+				[&TokenIndex, Index, &OutValue](const FStringView Token)
+				{
+					if (TokenIndex++ == Index)
+					{
+						OutValue = FString(Token);
+					}
+				},
+				UE::String::EParseTokensOptions::SkipEmpty);
+			return !OutValue.IsEmpty();
 		}
 
 		return false;
@@ -154,16 +162,14 @@ static void HCI_ParsePipeDelimitedEvidenceList(const FString& InText, TArray<FSt
 		return;
 	}
 
-	TArray<FString> Tokens;
-	InText.ParseIntoArray(Tokens, TEXT("|"), true);
-	for (FString& Token : Tokens)
-	{
-		Token.TrimStartAndEndInline();
-		if (!Token.IsEmpty())
+	UE::String::ParseTokens(
+		InText,
+		TEXT('|'),
+		[&OutValues](const FStringView Token)
 		{
-			OutValues.Add(Token);
-		}
-	}
+			OutValues.Emplace(Token);
+		},
+		UE::String::EParseTokensOptions::Trim | UE::String::EParseTokensOptions::SkipEmpty);
 }
 
 static bool HCI_ResolveJsonValueInternal(
@@ -21,11 +21,30 @@ DEFINE_LOG_CATEGORY_STATIC(LogHCIAgentLlmClient, Log, All);
 
 namespace
 {
+static constexpr int32 HCI_LlmRouterLatencyWindowSize = 64;
+
+struct FHCILlmRouterModelStats
+{
+	double EwmaLatencyMs = 0.0;
+	double EwmaErrorRate = 0.0;
+	int32 SampleCount = 0;
+	int32 SuccessCount = 0;
+	int32 FailureCount = 0;
+	int32 SelectedCount = 0;
+	int32 HedgeLaunchCount = 0;
+	int32 HedgeWinCount = 0;
+	// Ring buffer of recent successful latencies, used for p90/p95.
+	TArray<double> RecentLatenciesMs;
+	int32 NextLatencySlot = 0;
+};
+
 struct FHCILlmRouterEntry
 {
 	FString Model;
+	FString ApiUrl;
 	double Weight = 0.0;
 	double Current = 0.0;
+	FHCILlmRouterModelStats Stats;
 };
 
 struct FHCILlmRouterState
@@ -35,11 +54,86 @@ struct FHCILlmRouterState
 	double MinSuccessRate = 0.5;
 	FDateTime SourceTimestamp = FDateTime::MinValue();
 	TArray<FHCILlmRouterEntry> Entries;
+
+	bool bAdaptive = false;
+	double EwmaAlpha = 0.2;
+	int32 AdaptiveMinSamples = 5;
+	// Ejected models keep this fraction of their weight so they are still probed and can recover.
+	double EjectedWeightFloor = 0.05;
+
+	bool bHedgeEnabled = false;
+	int32 HedgeDefaultDelayMs = 3000;
+	int32 HedgeMinDelayMs = 500;
+	int32 HedgeMaxDelayMs = 10000;
 };
 
 static FCriticalSection GHCILlmRouterStateMutex;
 static TMap<FString, FHCILlmRouterState> GHCILlmRouterStates;
 
+static double HCI_ComputeLatencyPercentile(const FHCILlmRouterModelStats& Stats, const double Percentile)
+{
+	if (Stats.RecentLatenciesMs.Num() <= 0)
+	{
+		return 0.0;
+	}
+
+	TArray<double> Sorted = Stats.RecentLatenciesMs;
+	Sorted.Sort();
+	const int32 Index = FMath::Clamp(
+		FMath::CeilToInt(Percentile * static_cast<double>(Sorted.Num())) - 1,
+		0,
+		Sorted.Num() - 1);
+	return Sorted[Index];
+}
+
+static bool HCI_IsRouterEntryEjected(const FHCILlmRouterState& State, const FHCILlmRouterEntry& Entry)
+{
+	return State.bAdaptive &&
+		Entry.Stats.SampleCount >= State.AdaptiveMinSamples &&
+		(1.0 - Entry.Stats.EwmaErrorRate) < State.MinSuccessRate;
+}
+
+static double HCI_GetBestObservedEwmaLatencyMs(const FHCILlmRouterState& State)
+{
+	double Best = 0.0;
+	for (const FHCILlmRouterEntry& Entry : State.Entries)
+	{
+		if (Entry.Stats.SampleCount < State.AdaptiveMinSamples || Entry.Stats.EwmaLatencyMs <= 0.0)
+		{
+			continue;
+		}
+		if (Best <= 0.0 || Entry.Stats.EwmaLatencyMs < Best)
+		{
+			Best = Entry.Stats.EwmaLatencyMs;
+		}
+	}
+	return Best;
+}
+
+// Static weight scaled by observed health: (1 - error_rate)^2 * (best_latency / own_latency).
+// Models without enough samples keep their static weight so new entries are explored first.
+static double HCI_ComputeEffectiveWeight(const FHCILlmRouterState& State, const FHCILlmRouterEntry& Entry, const double BestLatencyMs)
+{
+	if (!State.bAdaptive || Entry.Stats.SampleCount < State.AdaptiveMinSamples)
+	{
+		return Entry.Weight;
+	}
+
+	if (HCI_IsRouterEntryEjected(State, Entry))
+	{
+		return Entry.Weight * State.EjectedWeightFloor;
+	}
+
+	const double Health = FMath::Square(FMath::Clamp(1.0 - Entry.Stats.EwmaErrorRate, 0.0, 1.0));
+	double LatencyFactor = 1.0;
+	if (BestLatencyMs > 0.0 && Entry.Stats.EwmaLatencyMs > 0.0)
+	{
+		LatencyFactor = FMath::Clamp(BestLatencyMs / Entry.Stats.EwmaLatencyMs, 0.05, 1.0);
+	}
+
+	return FMath::Max(Entry.Weight * Health * LatencyFactor, Entry.Weight * State.EjectedWeightFloor);
+}
+
 static FString HCI_ResolvePathFromProviderConfig(const FString& ProviderConfigPath, const FString& InPath)
 {
 	FString ResolvedPath = InPath.TrimStartAndEnd();
@@ -116,6 +210,33 @@ static bool HCI_LoadRouterStateFromJsonFile(
 	RouterRoot->TryGetNumberField(TEXT("min_success_rate"), OutState.MinSuccessRate);
 	OutState.MinSuccessRate = FMath::Clamp(OutState.MinSuccessRate, 0.0, 1.0);
 
+	// "adaptive"/"adaptive_wrr" = smooth WRR over weights re-scaled by observed latency and error rate.
+	OutState.bAdaptive =
+		OutState.Strategy.Equals(TEXT("adaptive"), ESearchCase::IgnoreCase) ||
+		OutState.Strategy.Equals(TEXT("adaptive_wrr"), ESearchCase::IgnoreCase);
+	const TSharedPtr<FJsonObject>* AdaptiveObject = nullptr;
+	if (RouterRoot->TryGetObjectField(TEXT("adaptive"), AdaptiveObject) && AdaptiveObject != nullptr && AdaptiveObject->IsValid())
+	{
+		(*AdaptiveObject)->TryGetNumberField(TEXT("ewma_alpha"), OutState.EwmaAlpha);
+		(*AdaptiveObject)->TryGetNumberField(TEXT("min_samples"), OutState.AdaptiveMinSamples);
+		(*AdaptiveObject)->TryGetNumberField(TEXT("ejected_weight_floor"), OutState.EjectedWeightFloor);
+	}
+	OutState.EwmaAlpha = FMath::Clamp(OutState.EwmaAlpha, 0.01, 1.0);
+	OutState.AdaptiveMinSamples = FMath::Max(1, OutState.AdaptiveMinSamples);
+	OutState.EjectedWeightFloor = FMath::Clamp(OutState.EjectedWeightFloor, 0.0, 1.0);
+
+	const TSharedPtr<FJsonObject>* HedgeObject = nullptr;
+	if (RouterRoot->TryGetObjectField(TEXT("hedge"), HedgeObject) && HedgeObject != nullptr && HedgeObject->IsValid())
+	{
+		(*HedgeObject)->TryGetBoolField(TEXT("enabled"), OutState.bHedgeEnabled);
+		(*HedgeObject)->TryGetNumberField(TEXT("default_delay_ms"), OutState.HedgeDefaultDelayMs);
+		(*HedgeObject)->TryGetNumberField(TEXT("min_delay_ms"), OutState.HedgeMinDelayMs);
+		(*HedgeObject)->TryGetNumberField(TEXT("max_delay_ms"), OutState.HedgeMaxDelayMs);
+	}
+	OutState.HedgeMinDelayMs = FMath::Max(0, OutState.HedgeMinDelayMs);
+	OutState.HedgeMaxDelayMs = FMath::Max(OutState.HedgeMinDelayMs, OutState.HedgeMaxDelayMs);
+	OutState.HedgeDefaultDelayMs = FMath::Clamp(OutState.HedgeDefaultDelayMs, OutState.HedgeMinDelayMs, OutState.HedgeMaxDelayMs);
+
 	const TArray<TSharedPtr<FJsonValue>>* Models = nullptr;
 	if (!RouterRoot->TryGetArrayField(TEXT("models"), Models) || Models == nullptr || Models->Num() <= 0)
 	{
@@ -160,47 +281,58 @@ static bool HCI_LoadRouterStateFromJsonFile(
 		Entry.Model = ModelName.TrimStartAndEnd();
 		Entry.Weight = Weight;
 		Entry.Current = 0.0;
+		// Per-model endpoint override (e.g. a local stub with injected delays in tests).
+		FString ModelApiUrl;
+		if (ModelObject->TryGetStringField(TEXT("api_url"), ModelApiUrl))
+		{
+			Entry.ApiUrl = ModelApiUrl.TrimStartAndEnd();
+		}
 		OutState.Entries.Add(MoveTemp(Entry));
 	}
 
 	return true;
 }
 
-static bool HCI_SelectModelFromRouterState(FHCILlmRouterState& State, FString& OutModel)
+static int32 HCI_SelectModelFromRouterState(FHCILlmRouterState& State)
 {
-	OutModel.Reset();
 	if (State.Entries.Num() <= 0)
 	{
-		return false;
+		return INDEX_NONE;
+	}
+
+	const double BestLatencyMs = HCI_GetBestObservedEwmaLatencyMs(State);
+	TArray<double, TInlineAllocator<8>> EffectiveWeights;
+	EffectiveWeights.Reserve(State.Entries.Num());
+	for (const FHCILlmRouterEntry& Entry : State.Entries)
+	{
+		EffectiveWeights.Add(HCI_ComputeEffectiveWeight(State, Entry, BestLatencyMs));
 	}
 
 	if (State.Strategy.Equals(TEXT("random"), ESearchCase::IgnoreCase) ||
 		State.Strategy.Equals(TEXT("weighted_random"), ESearchCase::IgnoreCase))
 	{
 		double WeightSum = 0.0;
-		for (const FHCILlmRouterEntry& Entry : State.Entries)
+		for (const double Weight : EffectiveWeights)
 		{
-			WeightSum += Entry.Weight;
+			WeightSum += Weight;
 		}
 		if (WeightSum <= 0.0)
 		{
-			return false;
+			return INDEX_NONE;
 		}
 
 		const double Pick = FMath::FRandRange(0.0, static_cast<float>(WeightSum));
 		double Running = 0.0;
-		for (const FHCILlmRouterEntry& Entry : State.Entries)
+		for (int32 Index = 0; Index < State.Entries.Num(); ++Index)
 		{
-			Running += Entry.Weight;
+			Running += EffectiveWeights[Index];
 			if (Pick <= Running)
 			{
-				OutModel = Entry.Model;
-				return true;
+				return Index;
 			}
 		}
 
-		OutModel = State.Entries.Last().Model;
-		return true;
+		return State.Entries.Num() - 1;
 	}
 
 	double TotalWeight = 0.0;
@@ -209,8 +341,8 @@ static bool HCI_SelectModelFromRouterState(FHCILlmRouterState& State, FString& O
 	for (int32 Index = 0; Index < State.Entries.Num(); ++Index)
 	{
 		FHCILlmRouterEntry& Entry = State.Entries[Index];
-		Entry.Current += Entry.Weight;
-		TotalWeight += Entry.Weight;
+		Entry.Current += EffectiveWeights[Index];
+		TotalWeight += EffectiveWeights[Index];
 		if (Entry.Current > BestScore)
 		{
 			BestScore = Entry.Current;
@@ -220,22 +352,83 @@ static bool HCI_SelectModelFromRouterState(FHCILlmRouterState& State, FString& O
 
 	if (BestIndex == INDEX_NONE || TotalWeight <= 0.0)
 	{
-		return false;
+		return INDEX_NONE;
 	}
 
-	FHCILlmRouterEntry& Selected = State.Entries[BestIndex];
-	Selected.Current -= TotalWeight;
-	OutModel = Selected.Model;
-	return true;
+	State.Entries[BestIndex].Current -= TotalWeight;
+	return BestIndex;
+}
+
+// Hedge target = healthiest other model; delay = primary p90 once it has enough samples.
+static int32 HCI_SelectHedgeEntryFromRouterState(const FHCILlmRouterState& State, const int32 PrimaryIndex, int32& OutDelayMs)
+{
+	OutDelayMs = State.HedgeDefaultDelayMs;
+	if (!State.bHedgeEnabled || !State.Entries.IsValidIndex(PrimaryIndex) || State.Entries.Num() < 2)
+	{
+		return INDEX_NONE;
+	}
+
+	const double BestLatencyMs = HCI_GetBestObservedEwmaLatencyMs(State);
+	int32 HedgeIndex = INDEX_NONE;
+	double HedgeWeight = 0.0;
+	for (int32 Index = 0; Index < State.Entries.Num(); ++Index)
+	{
+		const FHCILlmRouterEntry& Entry = State.Entries[Index];
+		if (Index == PrimaryIndex || HCI_IsRouterEntryEjected(State, Entry))
+		{
+			continue;
+		}
+
+		const double Weight = HCI_ComputeEffectiveWeight(State, Entry, BestLatencyMs);
+		if (Weight > HedgeWeight)
+		{
+			HedgeWeight = Weight;
+			HedgeIndex = Index;
+		}
+	}
+
+	const FHCILlmRouterModelStats& PrimaryStats = State.Entries[PrimaryIndex].Stats;
+	if (PrimaryStats.RecentLatenciesMs.Num() >= State.AdaptiveMinSamples)
+	{
+		OutDelayMs = FMath::RoundToInt(HCI_ComputeLatencyPercentile(PrimaryStats, 0.90));
+	}
+	OutDelayMs = FMath::Clamp(OutDelayMs, State.HedgeMinDelayMs, State.HedgeMaxDelayMs);
+	return HedgeIndex;
+}
+
+static void HCI_CarryOverRouterStats(const FHCILlmRouterState& PreviousState, FHCILlmRouterState& InOutState)
+{
+	for (FHCILlmRouterEntry& Entry : InOutState.Entries)
+	{
+		for (const FHCILlmRouterEntry& PreviousEntry : PreviousState.Entries)
+		{
+			if (PreviousEntry.Model.Equals(Entry.Model, ESearchCase::CaseSensitive))
+			{
+				Entry.Stats = PreviousEntry.Stats;
+				break;
+			}
+		}
+	}
 }
 
+struct FHCILlmRouterSelection
+{
+	FString RouterConfigPath;
+	FString Model;
+	FString ApiUrl;
+	bool bHedgeEnabled = false;
+	FString HedgeModel;
+	FString HedgeApiUrl;
+	int32 HedgeDelayMs = 0;
+};
+
 static bool HCI_TrySelectModelByRouter(
 	const TSharedPtr<FJsonObject>& ProviderConfigRoot,
 	const FString& ProviderConfigPath,
-	FString& OutModel,
+	FHCILlmRouterSelection& OutSelection,
 	FString& OutReason)
 {
-	OutModel.Reset();
+	OutSelection = FHCILlmRouterSelection();
 	OutReason.Reset();
 
 	const FString RouterConfigPath = HCI_GetRouterConfigPathFromProviderConfig(ProviderConfigRoot, ProviderConfigPath);
@@ -265,6 +458,11 @@ static bool HCI_TrySelectModelByRouter(
 			return false;
 		}
 
+		// Editing weights in the router file must not throw away what was learned online.
+		if (State != nullptr)
+		{
+			HCI_CarryOverRouterStats(*State, LoadedState);
+		}
 		GHCILlmRouterStates.Add(RouterConfigPath, MoveTemp(LoadedState));
 		State = GHCILlmRouterStates.Find(RouterConfigPath);
 	}
@@ -275,20 +473,65 @@ static bool HCI_TrySelectModelByRouter(
 		return false;
 	}
 
-	if (!HCI_SelectModelFromRouterState(*State, OutModel) || OutModel.IsEmpty())
+	const int32 SelectedIndex = HCI_SelectModelFromRouterState(*State);
+	if (!State->Entries.IsValidIndex(SelectedIndex) || State->Entries[SelectedIndex].Model.IsEmpty())
 	{
 		OutReason = TEXT("router_select_failed");
 		return false;
 	}
 
+	FHCILlmRouterEntry& Selected = State->Entries[SelectedIndex];
+	Selected.Stats.SelectedCount += 1;
+	OutSelection.RouterConfigPath = RouterConfigPath;
+	OutSelection.Model = Selected.Model;
+	OutSelection.ApiUrl = Selected.ApiUrl;
+
+	int32 HedgeDelayMs = 0;
+	const int32 HedgeIndex = HCI_SelectHedgeEntryFromRouterState(*State, SelectedIndex, HedgeDelayMs);
+	if (State->Entries.IsValidIndex(HedgeIndex))
+	{
+		OutSelection.bHedgeEnabled = true;
+		OutSelection.HedgeModel = State->Entries[HedgeIndex].Model;
+		OutSelection.HedgeApiUrl = State->Entries[HedgeIndex].ApiUrl;
+		OutSelection.HedgeDelayMs = HedgeDelayMs;
+	}
+
 	OutReason = FString::Printf(
-		TEXT("router_selected strategy=%s min_success_rate=%.2f pool=%d config=%s"),
+		TEXT("router_selected strategy=%s min_success_rate=%.2f pool=%d ewma_latency_ms=%.1f ewma_error_rate=%.3f hedge=%s hedge_delay_ms=%d config=%s"),
 		*State->Strategy,
 		State->MinSuccessRate,
 		State->Entries.Num(),
+		Selected.Stats.EwmaLatencyMs,
+		Selected.Stats.EwmaErrorRate,
+		OutSelection.bHedgeEnabled ? *OutSelection.HedgeModel : TEXT("-"),
+		OutSelection.HedgeDelayMs,
 		*RouterConfigPath);
 	return true;
 }
+
+static void HCI_FillRouterModelMetrics(
+	const FHCILlmRouterState& State,
+	const FHCILlmRouterEntry& Entry,
+	const double BestLatencyMs,
+	FHCIAgentLlmRouterModelMetrics& OutMetrics)
+{
+	OutMetrics.RouterConfigPath = State.RouterConfigPath;
+	OutMetrics.Strategy = State.Strategy;
+	OutMetrics.Model = Entry.Model;
+	OutMetrics.StaticWeight = Entry.Weight;
+	OutMetrics.EffectiveWeight = HCI_ComputeEffectiveWeight(State, Entry, BestLatencyMs);
+	OutMetrics.EwmaLatencyMs = Entry.Stats.EwmaLatencyMs;
+	OutMetrics.EwmaErrorRate = Entry.Stats.EwmaErrorRate;
+	OutMetrics.P90LatencyMs = HCI_ComputeLatencyPercentile(Entry.Stats, 0.90);
+	OutMetrics.P95LatencyMs = HCI_ComputeLatencyPercentile(Entry.Stats, 0.95);
+	OutMetrics.SampleCount = Entry.Stats.SampleCount;
+	OutMetrics.SuccessCount = Entry.Stats.SuccessCount;
+	OutMetrics.FailureCount = Entry.Stats.FailureCount;
+	OutMetrics.SelectedCount = Entry.Stats.SelectedCount;
+	OutMetrics.HedgeLaunchCount = Entry.Stats.HedgeLaunchCount;
+	OutMetrics.HedgeWinCount = Entry.Stats.HedgeWinCount;
+	OutMetrics.bEjected = HCI_IsRouterEntryEjected(State, Entry);
+}
 }
 
 bool FHCIAgentLlmClient::LoadProviderConfigFromJsonFile(
@@ -356,11 +599,20 @@ bool FHCIAgentLlmClient::LoadProviderConfigFromJsonFile(
 		OutConfig.Model = OverrideModel;
 	}
 
-	FString RoutedModel;
+	FHCILlmRouterSelection RouterSelection;
 	FString RouterReason;
-	if (HCI_TrySelectModelByRouter(Root, ResolvedConfigPath, RoutedModel, RouterReason))
+	if (HCI_TrySelectModelByRouter(Root, ResolvedConfigPath, RouterSelection, RouterReason))
 	{
-		OutConfig.Model = RoutedModel;
+		OutConfig.Model = RouterSelection.Model;
+		OutConfig.RouterConfigPath = RouterSelection.RouterConfigPath;
+		if (!RouterSelection.ApiUrl.IsEmpty())
+		{
+			OutConfig.ApiUrl = RouterSelection.ApiUrl;
+		}
+		OutConfig.bHedgeEnabled = RouterSelection.bHedgeEnabled;
+		OutConfig.HedgeModel = RouterSelection.HedgeModel;
+		OutConfig.HedgeApiUrl = RouterSelection.HedgeApiUrl.IsEmpty() ? OutConfig.ApiUrl : RouterSelection.HedgeApiUrl;
+		OutConfig.HedgeDelayMs = RouterSelection.HedgeDelayMs;
 		UE_LOG(
 			LogHCIAgentLlmClient,
 			Display,
@@ -519,6 +771,126 @@ bool FHCIAgentLlmClient::TryExtractMessageContentFromResponse(
 	return true;
 }
 
+void FHCIAgentLlmClient::ReportModelOutcome(const FHCIAgentLlmModelOutcome& Outcome)
+{
+	if (Outcome.RouterConfigPath.IsEmpty() || Outcome.Model.IsEmpty())
+	{
+		return;
+	}
+
+	FScopeLock Lock(&GHCILlmRouterStateMutex);
+	FHCILlmRouterState* State = GHCILlmRouterStates.Find(Outcome.RouterConfigPath);
+	if (State == nullptr)
+	{
+		return;
+	}
+
+	FHCILlmRouterEntry* Entry = State->Entries.FindByPredicate([&Outcome](const FHCILlmRouterEntry& Candidate)
+	{
+		return Candidate.Model.Equals(Outcome.Model, ESearchCase::CaseSensitive);
+	});
+	if (Entry == nullptr)
+	{
+		return;
+	}
+
+	FHCILlmRouterModelStats& Stats = Entry->Stats;
+	const double Alpha = State->EwmaAlpha;
+	const double LatencyMs = FMath::Max(0.0, Outcome.LatencyMs);
+	const double ErrorSample = Outcome.bSucceeded ? 0.0 : 1.0;
+	if (Stats.SampleCount <= 0)
+	{
+		Stats.EwmaLatencyMs = LatencyMs;
+		Stats.EwmaErrorRate = ErrorSample;
+	}
+	else
+	{
+		Stats.EwmaLatencyMs = Alpha * LatencyMs + (1.0 - Alpha) * Stats.EwmaLatencyMs;
+		Stats.EwmaErrorRate = Alpha * ErrorSample + (1.0 - Alpha) * Stats.EwmaErrorRate;
+	}
+
+	Stats.SampleCount += 1;
+	if (Outcome.bSucceeded)
+	{
+		Stats.SuccessCount += 1;
+		if (Stats.RecentLatenciesMs.Num() < HCI_LlmRouterLatencyWindowSize)
+		{
+			Stats.RecentLatenciesMs.Add(LatencyMs);
+		}
+		else
+		{
+			Stats.RecentLatenciesMs[Stats.NextLatencySlot] = LatencyMs;
+		}
+		Stats.NextLatencySlot = (Stats.NextLatencySlot + 1) % HCI_LlmRouterLatencyWindowSize;
+	}
+	else
+	{
+		Stats.FailureCount += 1;
+	}
+
+	if (Outcome.bHedgeLeg)
+	{
+		Stats.HedgeLaunchCount += 1;
+		if (Outcome.bWonRace)
+		{
+			Stats.HedgeWinCount += 1;
+		}
+	}
+}
+
+TArray<FHCIAgentLlmRouterModelMetrics> FHCIAgentLlmClient::GetRouterMetricsSnapshot()
+{
+	TArray<FHCIAgentLlmRouterModelMetrics> Snapshot;
+
+	FScopeLock Lock(&GHCILlmRouterStateMutex);
+	for (const TPair<FString, FHCILlmRouterState>& Pair : GHCILlmRouterStates)
+	{
+		const FHCILlmRouterState& State = Pair.Value;
+		const double BestLatencyMs = HCI_GetBestObservedEwmaLatencyMs(State);
+		for (const FHCILlmRouterEntry& Entry : State.Entries)
+		{
+			HCI_FillRouterModelMetrics(State, Entry, BestLatencyMs, Snapshot.AddDefaulted_GetRef());
+		}
+	}
+
+	return Snapshot;
+}
+
+bool FHCIAgentLlmClient::SerializeRouterMetricsToJson(FString& OutJsonText)
+{
+	OutJsonText.Reset();
+
+	TArray<TSharedPtr<FJsonValue>> Models;
+	for (const FHCIAgentLlmRouterModelMetrics& Metrics : GetRouterMetricsSnapshot())
+	{
+		TSharedPtr<FJsonObject> ModelObject = MakeShared<FJsonObject>();
+		ModelObject->SetStringField(TEXT("router_config_path"), Metrics.RouterConfigPath);
+		ModelObject->SetStringField(TEXT("strategy"), Metrics.Strategy);
+		ModelObject->SetStringField(TEXT("model"), Metrics.Model);
+		ModelObject->SetNumberField(TEXT("static_weight"), Metrics.StaticWeight);
+		ModelObject->SetNumberField(TEXT("effective_weight"), Metrics.EffectiveWeight);
+		ModelObject->SetNumberField(TEXT("ewma_latency_ms"), Metrics.EwmaLatencyMs);
+		ModelObject->SetNumberField(TEXT("ewma_error_rate"), Metrics.EwmaErrorRate);
+		ModelObject->SetNumberField(TEXT("p90_latency_ms"), Metrics.P90LatencyMs);
+		ModelObject->SetNumberField(TEXT("p95_latency_ms"), Metrics.P95LatencyMs);
+		ModelObject->SetNumberField(TEXT("sample_count"), Metrics.SampleCount);
+		ModelObject->SetNumberField(TEXT("success_count"), Metrics.SuccessCount);
+		ModelObject->SetNumberField(TEXT("failure_count"), Metrics.FailureCount);
+		ModelObject->SetNumberField(TEXT("selected_count"), Metrics.SelectedCount);
+		ModelObject->SetNumberField(TEXT("hedge_launch_count"), Metrics.HedgeLaunchCount);
+		ModelObject->SetNumberField(TEXT("hedge_win_count"), Metrics.HedgeWinCount);
+		ModelObject->SetBoolField(TEXT("ejected"), Metrics.bEjected);
+		Models.Add(MakeShared<FJsonValueObject>(ModelObject));
+	}
+
+	TSharedPtr<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetStringField(TEXT("generated_utc"), FDateTime::UtcNow().ToIso8601());
+	Root->SetArrayField(TEXT("models"), Models);
+
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutJsonText);
+	return FJsonSerializer::Serialize(Root.ToSharedRef(), Writer);
+}
+
 void FHCIAgentLlmClient::ResetRoutingStateForTesting()
 {
 	FScopeLock Lock(&GHCILlmRouterStateMutex);
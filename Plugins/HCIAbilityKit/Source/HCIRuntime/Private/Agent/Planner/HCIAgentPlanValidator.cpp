@@ -1,6 +1,8 @@
 #include "Agent/Planner/HCIAgentPlanValidator.h"
 
 #include "Agent/Executor/HCIAgentExecutionGate.h"
+#include "Common/HCIRequestArena.h"
+#include "Common/HCITrace.h"
 #include "Dom/JsonObject.h"
 #include "Dom/JsonValue.h"
 #include "Internationalization/Regex.h"
@@ -131,7 +133,7 @@ static FString HCI_MakeArgFieldPath(const int32 StepIndex, const FString& ArgNam
 	return FString::Printf(TEXT("steps[%d].args.%s"), StepIndex, *ArgName);
 }
 
-static void HCI_AddEvidenceKeys(TSet<FString>& OutSet, std::initializer_list<const TCHAR*> Keys)
+static void HCI_AddEvidenceKeys(THCIArenaSet<FString>& OutSet, std::initializer_list<const TCHAR*> Keys)
 {
 	for (const TCHAR* Key : Keys)
 	{
@@ -141,7 +143,7 @@ static void HCI_AddEvidenceKeys(TSet<FString>& OutSet, std::initializer_list<con
 
 static bool HCI_GetAllowedExpectedEvidenceSet(
 	const FName ToolName,
-	TSet<FString>& OutAllowedSet)
+	THCIArenaSet<FString>& OutAllowedSet)
 {
 	OutAllowedSet.Reset();
 
@@ -263,13 +265,14 @@ static bool HCI_ValidateExpectedEvidence(
 			&Step);
 	}
 
-	TSet<FString> AllowedEvidence;
+	HCI_REQUEST_ARENA_SCOPE(OutResult.RequestId);
+	THCIArenaSet<FString> AllowedEvidence;
 	if (!HCI_GetAllowedExpectedEvidenceSet(Step.ToolName, AllowedEvidence))
 	{
 		return true;
 	}
 
-	TSet<FString> SeenEvidence;
+	THCIArenaSet<FString> SeenEvidence;
 	for (int32 EvidenceIndex = 0; EvidenceIndex < Step.ExpectedEvidence.Num(); ++EvidenceIndex)
 	{
 		const FString EvidenceKey = Step.ExpectedEvidence[EvidenceIndex].TrimStartAndEnd();
@@ -439,6 +442,7 @@ static bool HCI_ValidateArgsAgainstSchema(
 		return HCI_Fail(OutResult, TEXT("E4001"), FString::Printf(TEXT("steps[%d].args"), StepIndex), TEXT("args_missing"), StepIndex, &Step);
 	}
 
+	HCI_REQUEST_ARENA_SCOPE(OutResult.RequestId);
 	for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Step.Args->Values)
 	{
 		if (!HCI_FindArgSchema(Tool, Pair.Key))
@@ -531,7 +535,7 @@ static bool HCI_ValidateArgsAgainstSchema(
 			}
 
 			const TArray<TSharedPtr<FJsonValue>>& ArrayValues = Value->AsArray();
-			TSet<FString> SeenStringValues;
+			THCIArenaSet<FString> SeenStringValues;
 			if (Schema.MinArrayLength != INDEX_NONE && ArrayValues.Num() < Schema.MinArrayLength)
 			{
 				return HCI_Fail(
@@ -1089,6 +1093,8 @@ bool FHCIAgentPlanValidator::ValidatePlan(
 	const FHCIAgentPlanValidationContext& Context,
 	FHCIAgentPlanValidationResult& OutResult)
 {
+	HCI_TRACE_SCOPE(TEXT("HCI.Validator.ValidatePlan"));
+	HCI_REQUEST_ARENA_SCOPE(Plan.RequestId);
 	HCI_InitResultFromPlan(Plan, OutResult);
 
 	FString MinimalContractError;
@@ -5,6 +5,8 @@
 #include "Agent/Planner/Interfaces/IHCIPlannerProvider.h"
 #include "Agent/Planner/Interfaces/IHCIPlannerRouter.h"
 #include "Agent/Planner/Providers/HCIKeywordPlannerProvider.h"
+#include "Common/HCIRequestArena.h"
+#include "Common/HCITrace.h"
 
 bool FHCIAgentPlanner::BuildPlanFromNaturalLanguage(
 	const FString& UserText,
@@ -14,6 +16,9 @@ bool FHCIAgentPlanner::BuildPlanFromNaturalLanguage(
 	FString& OutRouteReason,
 	FString& OutError)
 {
+	HCI_TRACE_REQUEST_SCOPE(RequestId);
+	HCI_TRACE_SCOPE(TEXT("HCI.Planner.BuildPlan"));
+	HCI_REQUEST_ARENA_SCOPE(RequestId);
 	FHCIKeywordPlannerProvider KeywordProvider;
 	FHCIAgentPlannerBuildOptions Options;
 	FHCIAgentPlannerResultMetadata Metadata;
@@ -30,6 +35,9 @@ bool FHCIAgentPlanner::BuildPlanFromNaturalLanguageWithProvider(
 	FHCIAgentPlannerResultMetadata& OutMetadata,
 	FString& OutError)
 {
+	HCI_TRACE_REQUEST_SCOPE(RequestId);
+	HCI_TRACE_SCOPE(TEXT("HCI.Planner.BuildPlan"));
+	HCI_REQUEST_ARENA_SCOPE(RequestId);
 	const TSharedRef<IHCIPlannerProvider> Provider = FHCIRuntimeModule::Get().GetPlannerRouter()->SelectProvider(Options);
 	return Provider->BuildPlan(UserText, RequestId, ToolRegistry, Options, OutPlan, OutRouteReason, OutMetadata, OutError);
 }
@@ -46,8 +54,23 @@ void FHCIAgentPlanner::BuildPlanFromNaturalLanguageWithProviderAsync(
 		return;
 	}
 
+	HCI_TRACE_REQUEST_SCOPE(RequestId);
+	HCI_TRACE_SCOPE(TEXT("HCI.Planner.BuildPlanAsyncDispatch"));
 	const TSharedRef<IHCIPlannerProvider> Provider = FHCIRuntimeModule::Get().GetPlannerRouter()->SelectProvider(Options);
-	Provider->BuildPlanAsync(UserText, RequestId, ToolRegistry, Options, MoveTemp(OnComplete));
+
+	// The async stage spans dispatch to completion; only the wall time is recorded (no CPU scope across frames).
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	Provider->BuildPlanAsync(
+		UserText,
+		RequestId,
+		ToolRegistry,
+		Options,
+		[StartCycles, OnComplete = MoveTemp(OnComplete)](bool bOk, FHCIAgentPlan Plan, FString RouteReason, FHCIAgentPlannerResultMetadata Metadata, FString Error)
+		{
+			static const FName AsyncStageName(TEXT("HCI.Planner.BuildPlanAsync"));
+			FHCIStageLatencyRecorder::Get().Record(AsyncStageName, FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles));
+			OnComplete(bOk, MoveTemp(Plan), MoveTemp(RouteReason), MoveTemp(Metadata), MoveTemp(Error));
+		});
 }
 
 FHCIAgentPlannerMetricsSnapshot FHCIAgentPlanner::GetMetricsSnapshot()
@@ -0,0 +1,504 @@
+#include "Agent/Planner/HCIKeywordIntentMatcher.h"
+
+#include "Agent/LLM/HCIAgentPromptBuilder.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogHCIKeywordIntentMatcher, Log, All);
+
+namespace
+{
+// Internal output bit for the "game/" anchor that opens a path token; never reported as a group.
+constexpr uint64 HCIPathAnchorBit = uint64(1) << 63;
+constexpr int32 HCIPathAnchorLength = 5; // "game/"
+
+static const TCHAR* const GHCIKeywordIntentGroupNames[] = {
+	TEXT("organize_verb"),
+	TEXT("normalize_verb"),
+	TEXT("temp_scope"),
+	TEXT("folder_noun"),
+	TEXT("scan_verb"),
+	TEXT("level_noun"),
+	TEXT("level_issue"),
+	TEXT("triangle_noun"),
+	TEXT("inspect_verb"),
+	TEXT("texture_noun"),
+	TEXT("lod_noun"),
+	TEXT("identity"),
+	TEXT("capability"),
+	TEXT("greeting"),
+	TEXT("character_noun"),
+	TEXT("art_noun"),
+	TEXT("size_keyword"),
+	TEXT("size_connector"),
+};
+static_assert(UE_ARRAY_COUNT(GHCIKeywordIntentGroupNames) == static_cast<int32>(EHCIKeywordIntentGroup::Count), "Group name table out of sync");
+
+static uint64 HCI_GroupBit(const EHCIKeywordIntentGroup Group)
+{
+	return uint64(1) << static_cast<uint8>(Group);
+}
+
+// Groups whose hits are reported with offsets, not just as a mask bit.
+static const uint64 GHCIKeywordPositionalGroupMask =
+	HCI_GroupBit(EHCIKeywordIntentGroup::SizeKeyword) | HCI_GroupBit(EHCIKeywordIntentGroup::SizeConnector);
+
+static uint64 HCI_TransitionKey(const int32 State, const TCHAR Ch)
+{
+	return (static_cast<uint64>(State) << 32) | static_cast<uint64>(static_cast<uint32>(Ch));
+}
+
+static bool HCI_IsGamePathTerminalChar(const TCHAR Ch)
+{
+	return FChar::IsWhitespace(Ch) ||
+		   Ch == TCHAR('"') ||
+		   Ch == TCHAR('\'') ||
+		   Ch == TCHAR(',') ||
+		   Ch == TCHAR(0xFF0C) || // '，'
+		   Ch == TCHAR(';') ||
+		   Ch == TCHAR(0xFF1B) || // '；'
+		   Ch == TCHAR(':') ||
+		   Ch == TCHAR(0xFF1A) || // '：'
+		   Ch == TCHAR(0x3002) || // '。'
+		   Ch == TCHAR(')') ||
+		   Ch == TCHAR('(') ||
+		   Ch == TCHAR(']') ||
+		   Ch == TCHAR('[');
+}
+
+template <typename ResultType>
+static void HCI_EmitPathToken(const FString& Text, const int32 Start, const int32 End, ResultType& OutResult)
+{
+	FString Token = Text.Mid(Start, End - Start).TrimStartAndEnd();
+	if (Token.StartsWith(TEXT("Game/"), ESearchCase::IgnoreCase))
+	{
+		Token = FString::Printf(TEXT("/%s"), *Token);
+	}
+	if (!Token.IsEmpty())
+	{
+		OutResult.PathTokens.Add(MoveTemp(Token));
+	}
+}
+
+template <typename ResultType>
+static void HCI_EmitNumber(const FString& Text, const int32 Start, const int32 End, ResultType& OutResult)
+{
+	// Longer runs (ids, timestamps) cannot be a tool parameter and would overflow.
+	if (End - Start > 18)
+	{
+		return;
+	}
+	int64 Value = 0;
+	for (int32 Index = Start; Index < End; ++Index)
+	{
+		Value = Value * 10 + (Text[Index] - TCHAR('0'));
+	}
+	OutResult.Numbers.Add(Value);
+	OutResult.NumberSpans.Add(FHCIKeywordSpan{Start, End});
+}
+
+static FString HCI_GetLocalVocabularyPath()
+{
+	return FPaths::ConvertRelativePathToFull(
+		FPaths::Combine(FPaths::ProjectDir(), TEXT("Saved/HCIAbilityKit/Config/keyword_vocabulary.local.json")));
+}
+
+static FString HCI_GetBundleVocabularyPath()
+{
+	FString BundleDir;
+	FString BundleError;
+	if (!FHCIAgentPromptBuilder::ResolveSkillBundleDirectory(FHCIAgentPromptBundleOptions(), BundleDir, BundleError))
+	{
+		return FString();
+	}
+	return FPaths::Combine(BundleDir, TEXT("keyword_vocabulary.json"));
+}
+
+static FDateTime HCI_GetVocabularyTimestamp(const FString& Path)
+{
+	return Path.IsEmpty() ? FDateTime::MinValue() : IFileManager::Get().GetTimeStamp(*Path);
+}
+
+static void HCI_AddVocabularyFile(FHCIKeywordIntentMatcher& Matcher, const FString& Path, const FDateTime Timestamp)
+{
+	if (Timestamp == FDateTime::MinValue())
+	{
+		return;
+	}
+
+	FString JsonText;
+	FString Error;
+	if (!FFileHelper::LoadFileToString(JsonText, *Path))
+	{
+		Error = TEXT("vocabulary_file_read_failed");
+	}
+	else
+	{
+		Matcher.AddTermsFromJson(JsonText, Error);
+	}
+	if (!Error.IsEmpty())
+	{
+		UE_LOG(LogHCIKeywordIntentMatcher, Warning, TEXT("[HCI][KeywordIntentMatcher] vocabulary_skipped path=%s reason=%s"), *Path, *Error);
+	}
+}
+
+struct FHCISharedKeywordIntentMatcher
+{
+	FCriticalSection Lock;
+	TSharedPtr<const FHCIKeywordIntentMatcher> Matcher;
+	FString BundlePath;
+	FDateTime BundleTimestamp = FDateTime::MinValue();
+	FDateTime LocalTimestamp = FDateTime::MinValue();
+};
+
+static FHCISharedKeywordIntentMatcher& HCI_GetSharedKeywordIntentMatcher()
+{
+	static FHCISharedKeywordIntentMatcher Shared;
+	return Shared;
+}
+} // namespace
+
+FHCIKeywordIntentMatcher::FHCIKeywordIntentMatcher()
+{
+	States.AddDefaulted();
+}
+
+TSharedRef<const FHCIKeywordIntentMatcher> FHCIKeywordIntentMatcher::GetShared()
+{
+	FHCISharedKeywordIntentMatcher& Shared = HCI_GetSharedKeywordIntentMatcher();
+	FScopeLock ScopeLock(&Shared.Lock);
+
+	if (!Shared.Matcher.IsValid())
+	{
+		Shared.BundlePath = HCI_GetBundleVocabularyPath();
+	}
+	const FString LocalPath = HCI_GetLocalVocabularyPath();
+	const FDateTime BundleTimestamp = HCI_GetVocabularyTimestamp(Shared.BundlePath);
+	const FDateTime LocalTimestamp = HCI_GetVocabularyTimestamp(LocalPath);
+	if (Shared.Matcher.IsValid() && BundleTimestamp == Shared.BundleTimestamp && LocalTimestamp == Shared.LocalTimestamp)
+	{
+		return Shared.Matcher.ToSharedRef();
+	}
+
+	const TSharedRef<FHCIKeywordIntentMatcher> Matcher = MakeShared<FHCIKeywordIntentMatcher>();
+	Matcher->AddBuiltInVocabulary();
+	HCI_AddVocabularyFile(*Matcher, Shared.BundlePath, BundleTimestamp);
+	HCI_AddVocabularyFile(*Matcher, LocalPath, LocalTimestamp);
+	Matcher->Compile();
+
+	Shared.Matcher = Matcher;
+	Shared.BundleTimestamp = BundleTimestamp;
+	Shared.LocalTimestamp = LocalTimestamp;
+	UE_LOG(
+		LogHCIKeywordIntentMatcher,
+		Display,
+		TEXT("[HCI][KeywordIntentMatcher] compiled terms=%d states=%d bundle_file=%s local_file=%s"),
+		Matcher->GetTermCount(),
+		Matcher->GetStateCount(),
+		BundleTimestamp == FDateTime::MinValue() ? TEXT("missing") : TEXT("loaded"),
+		LocalTimestamp == FDateTime::MinValue() ? TEXT("missing") : TEXT("loaded"));
+	return Matcher;
+}
+
+const TCHAR* FHCIKeywordIntentMatcher::GetGroupName(const EHCIKeywordIntentGroup Group)
+{
+	const int32 Index = static_cast<int32>(Group);
+	return (Index >= 0 && Index < UE_ARRAY_COUNT(GHCIKeywordIntentGroupNames)) ? GHCIKeywordIntentGroupNames[Index] : TEXT("unknown");
+}
+
+bool FHCIKeywordIntentMatcher::TryParseGroupName(const FString& Name, EHCIKeywordIntentGroup& OutGroup)
+{
+	for (int32 Index = 0; Index < UE_ARRAY_COUNT(GHCIKeywordIntentGroupNames); ++Index)
+	{
+		if (Name.Equals(GHCIKeywordIntentGroupNames[Index], ESearchCase::IgnoreCase))
+		{
+			OutGroup = static_cast<EHCIKeywordIntentGroup>(Index);
+			return true;
+		}
+	}
+	return false;
+}
+
+void FHCIKeywordIntentMatcher::AddBuiltInVocabulary()
+{
+	struct FBuiltInGroup
+	{
+		EHCIKeywordIntentGroup Group;
+		TArray<const TCHAR*> Terms;
+	};
+
+	// Routing baseline of the offline planner; data files only ever add to it.
+	const FBuiltInGroup BuiltInGroups[] = {
+		{EHCIKeywordIntentGroup::OrganizeVerb, {TEXT("整理"), TEXT("归档"), TEXT("重命名"), TEXT("命名"), TEXT("organize"), TEXT("archive"), TEXT("rename"), TEXT("naming")}},
+		{EHCIKeywordIntentGroup::NormalizeVerb, {TEXT("规范"), TEXT("规范化")}},
+		{EHCIKeywordIntentGroup::TempScope, {TEXT("临时"), TEXT("temp"), TEXT("tmp")}},
+		{EHCIKeywordIntentGroup::FolderNoun, {TEXT("目录"), TEXT("文件夹"), TEXT("folder"), TEXT("directory")}},
+		{EHCIKeywordIntentGroup::ScanVerb, {TEXT("扫描"), TEXT("scan"), TEXT("inspect")}},
+		{EHCIKeywordIntentGroup::LevelNoun, {TEXT("关卡"), TEXT("场景"), TEXT("level")}},
+		{EHCIKeywordIntentGroup::LevelIssue, {TEXT("碰撞"), TEXT("collision"), TEXT("材质丢失"), TEXT("默认材质"), TEXT("default material")}},
+		{EHCIKeywordIntentGroup::TriangleNoun, {TEXT("面数"), TEXT("triangle"), TEXT("triangles"), TEXT("poly")}},
+		{EHCIKeywordIntentGroup::InspectVerb, {TEXT("检查"), TEXT("扫描"), TEXT("统计"), TEXT("分析"), TEXT("查看"), TEXT("check"), TEXT("scan"), TEXT("inspect"), TEXT("analyze")}},
+		{EHCIKeywordIntentGroup::TextureNoun, {TEXT("贴图"), TEXT("texture"), TEXT("分辨率"), TEXT("npot")}},
+		{EHCIKeywordIntentGroup::LodNoun, {TEXT("面数"), TEXT("lod")}},
+		{EHCIKeywordIntentGroup::Identity, {TEXT("你是谁"), TEXT("你是哪个"), TEXT("你是哪位"), TEXT("你是做什么"), TEXT("你是什么"), TEXT("who are you"), TEXT("what are you")}},
+		{EHCIKeywordIntentGroup::Capability, {TEXT("你能做什么"), TEXT("你有哪些能力"), TEXT("有什么能力"), TEXT("有啥能力"), TEXT("能做什么"), TEXT("可以做什么"), TEXT("会什么"), TEXT("what can you do"), TEXT("capability"), TEXT("abilities")}},
+		{EHCIKeywordIntentGroup::Greeting, {TEXT("你好"), TEXT("早上好"), TEXT("晚上好"), TEXT("嗨"), TEXT("hello"), TEXT("hi")}},
+		{EHCIKeywordIntentGroup::CharacterNoun, {TEXT("角色"), TEXT("character")}},
+		{EHCIKeywordIntentGroup::ArtNoun, {TEXT("美术"), TEXT("艺术"), TEXT("art")}},
+		{EHCIKeywordIntentGroup::SizeKeyword, {TEXT("尺寸"), TEXT("max_size"), TEXT("maxsize"), TEXT("max size")}},
+		{EHCIKeywordIntentGroup::SizeConnector, {TEXT("设置为"), TEXT("设为"), TEXT("改为"), TEXT("改成"), TEXT("为"), TEXT("到"), TEXT("成"), TEXT("是"), TEXT("to")}},
+	};
+
+	for (const FBuiltInGroup& BuiltIn : BuiltInGroups)
+	{
+		for (const TCHAR* Term : BuiltIn.Terms)
+		{
+			AddTerm(BuiltIn.Group, Term);
+		}
+	}
+}
+
+void FHCIKeywordIntentMatcher::AddTerm(const EHCIKeywordIntentGroup Group, const FString& Term)
+{
+	const FString Normalized = Term.TrimStartAndEnd().ToLower();
+	if (Normalized.IsEmpty() || Group >= EHCIKeywordIntentGroup::Count)
+	{
+		return;
+	}
+
+	int32 State = 0;
+	for (const TCHAR Ch : Normalized)
+	{
+		const int32 Next = FindTransition(State, Ch);
+		State = (Next == INDEX_NONE) ? AddState(State, Ch) : Next;
+	}
+
+	FState& Terminal = States[State];
+	if ((Terminal.TermMask & HCI_GroupBit(Group)) == 0)
+	{
+		Terminal.TermMask |= HCI_GroupBit(Group);
+		Terminal.TermCount += 1;
+		TermCount += 1;
+	}
+	bCompiled = false;
+}
+
+bool FHCIKeywordIntentMatcher::AddTermsFromJson(const FString& JsonText, FString& OutError)
+{
+	OutError.Reset();
+
+	TSharedPtr<FJsonObject> Root;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonText);
+	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid())
+	{
+		OutError = TEXT("vocabulary_invalid_json");
+		return false;
+	}
+
+	const TSharedPtr<FJsonObject>* Groups = nullptr;
+	if (!Root->TryGetObjectField(TEXT("groups"), Groups) || Groups == nullptr || !Groups->IsValid())
+	{
+		OutError = TEXT("vocabulary_groups_missing");
+		return false;
+	}
+
+	TArray<FString> UnknownGroups;
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*Groups)->Values)
+	{
+		EHCIKeywordIntentGroup Group;
+		const TArray<TSharedPtr<FJsonValue>>* Terms = nullptr;
+		if (!TryParseGroupName(Pair.Key, Group) || !Pair.Value.IsValid() || !Pair.Value->TryGetArray(Terms) || Terms == nullptr)
+		{
+			UnknownGroups.Add(Pair.Key);
+			continue;
+		}
+		for (const TSharedPtr<FJsonValue>& TermValue : *Terms)
+		{
+			FString Term;
+			if (TermValue.IsValid() && TermValue->TryGetString(Term))
+			{
+				AddTerm(Group, Term);
+			}
+		}
+	}
+
+	if (UnknownGroups.Num() > 0)
+	{
+		OutError = FString::Printf(TEXT("vocabulary_unknown_groups=%s"), *FString::Join(UnknownGroups, TEXT("|")));
+		return false;
+	}
+	return true;
+}
+
+void FHCIKeywordIntentMatcher::Compile()
+{
+	if (bCompiled)
+	{
+		return;
+	}
+
+	// The path anchor lives in the same automaton so directory tokens come out of the same pass.
+	int32 AnchorState = 0;
+	for (const TCHAR Ch : FStringView(TEXT("game/")))
+	{
+		const int32 Next = FindTransition(AnchorState, Ch);
+		AnchorState = (Next == INDEX_NONE) ? AddState(AnchorState, Ch) : Next;
+	}
+	States[AnchorState].TermMask |= HCIPathAnchorBit;
+
+	for (FState& State : States)
+	{
+		State.OutputMask = State.TermMask;
+		State.OutputCount = State.TermCount;
+	}
+
+	TArray<TArray<TPair<TCHAR, int32>>> Children;
+	Children.SetNum(States.Num());
+	for (const TPair<uint64, int32>& Transition : Transitions)
+	{
+		const int32 Parent = static_cast<int32>(Transition.Key >> 32);
+		Children[Parent].Emplace(static_cast<TCHAR>(Transition.Key & 0xFFFFFFFFull), Transition.Value);
+	}
+
+	// Breadth-first so every fail target is finished before the states that point at it.
+	TArray<int32> Queue;
+	Queue.Reserve(States.Num());
+	for (const TPair<TCHAR, int32>& Child : Children[0])
+	{
+		States[Child.Value].Fail = 0;
+		Queue.Add(Child.Value);
+	}
+	for (int32 QueueIndex = 0; QueueIndex < Queue.Num(); ++QueueIndex)
+	{
+		const int32 State = Queue[QueueIndex];
+		for (const TPair<TCHAR, int32>& Child : Children[State])
+		{
+			int32 Fallback = States[State].Fail;
+			int32 FailTarget = FindTransition(Fallback, Child.Key);
+			while (FailTarget == INDEX_NONE && Fallback != 0)
+			{
+				Fallback = States[Fallback].Fail;
+				FailTarget = FindTransition(Fallback, Child.Key);
+			}
+			FState& ChildState = States[Child.Value];
+			ChildState.Fail = (FailTarget == INDEX_NONE || FailTarget == Child.Value) ? 0 : FailTarget;
+			ChildState.OutputMask |= States[ChildState.Fail].OutputMask;
+			ChildState.OutputCount += States[ChildState.Fail].OutputCount;
+			Queue.Add(Child.Value);
+		}
+	}
+
+	bCompiled = true;
+}
+
+int32 FHCIKeywordIntentMatcher::FindTransition(const int32 State, const TCHAR Ch) const
+{
+	const int32* Next = Transitions.Find(HCI_TransitionKey(State, Ch));
+	return Next ? *Next : INDEX_NONE;
+}
+
+int32 FHCIKeywordIntentMatcher::AddState(const int32 Parent, const TCHAR Ch)
+{
+	const int32 NewState = States.AddDefaulted();
+	States[NewState].Depth = States[Parent].Depth + 1;
+	Transitions.Add(HCI_TransitionKey(Parent, Ch), NewState);
+	return NewState;
+}
+
+void FHCIKeywordIntentMatcher::Match(const FString& Text, FHCIKeywordMatchResult& OutResult) const
+{
+	MatchInto(Text, OutResult);
+}
+
+void FHCIKeywordIntentMatcher::Match(const FString& Text, FHCIKeywordArenaMatchResult& OutResult) const
+{
+	MatchInto(Text, OutResult);
+}
+
+template <typename ResultType>
+void FHCIKeywordIntentMatcher::MatchInto(const FString& Text, ResultType& OutResult) const
+{
+	OutResult.Reset();
+	if (!ensureMsgf(bCompiled, TEXT("FHCIKeywordIntentMatcher::Match called before Compile")))
+	{
+		return;
+	}
+
+	int32 State = 0;
+	int32 PathTokenStart = INDEX_NONE;
+	int32 NumberStart = INDEX_NONE;
+	const int32 Len = Text.Len();
+	for (int32 Index = 0; Index < Len; ++Index)
+	{
+		const TCHAR Raw = Text[Index];
+
+		if (PathTokenStart != INDEX_NONE && HCI_IsGamePathTerminalChar(Raw))
+		{
+			HCI_EmitPathToken(Text, PathTokenStart, Index, OutResult);
+			PathTokenStart = INDEX_NONE;
+		}
+		if (PathTokenStart == INDEX_NONE && Raw >= TCHAR('0') && Raw <= TCHAR('9'))
+		{
+			NumberStart = (NumberStart == INDEX_NONE) ? Index : NumberStart;
+		}
+		else if (NumberStart != INDEX_NONE)
+		{
+			HCI_EmitNumber(Text, NumberStart, Index, OutResult);
+			NumberStart = INDEX_NONE;
+		}
+
+		const TCHAR Ch = FChar::ToLower(Raw);
+		int32 Next = FindTransition(State, Ch);
+		while (Next == INDEX_NONE && State != 0)
+		{
+			State = States[State].Fail;
+			Next = FindTransition(State, Ch);
+		}
+		State = (Next == INDEX_NONE) ? 0 : Next;
+
+		const FState& Current = States[State];
+		if (Current.OutputMask == 0)
+		{
+			continue;
+		}
+		OutResult.GroupMask |= (Current.OutputMask & ~HCIPathAnchorBit);
+		OutResult.TermHitCount += Current.OutputCount;
+		if ((Current.OutputMask & GHCIKeywordPositionalGroupMask) != 0)
+		{
+			// Rare enough to walk the fail chain: every state on it whose own terms are positional is one hit.
+			for (int32 HitState = State; HitState != 0; HitState = States[HitState].Fail)
+			{
+				const FState& Candidate = States[HitState];
+				for (uint64 Bits = Candidate.TermMask & GHCIKeywordPositionalGroupMask; Bits != 0; Bits &= Bits - 1)
+				{
+					FHCIKeywordHit& Hit = OutResult.PositionalHits.AddDefaulted_GetRef();
+					Hit.Group = static_cast<EHCIKeywordIntentGroup>(FMath::CountTrailingZeros64(Bits));
+					Hit.Span = FHCIKeywordSpan{Index + 1 - Candidate.Depth, Index + 1};
+				}
+			}
+		}
+		if ((Current.OutputMask & HCIPathAnchorBit) != 0 && PathTokenStart == INDEX_NONE)
+		{
+			PathTokenStart = Index - (HCIPathAnchorLength - 1);
+			if (PathTokenStart > 0 && Text[PathTokenStart - 1] == TCHAR('/'))
+			{
+				--PathTokenStart;
+			}
+		}
+	}
+
+	if (PathTokenStart != INDEX_NONE)
+	{
+		HCI_EmitPathToken(Text, PathTokenStart, Len, OutResult);
+	}
+	if (NumberStart != INDEX_NONE)
+	{
+		HCI_EmitNumber(Text, NumberStart, Len, OutResult);
+	}
+}
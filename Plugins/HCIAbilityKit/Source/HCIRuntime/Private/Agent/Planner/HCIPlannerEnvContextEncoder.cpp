@@ -0,0 +1,595 @@
+#include "Agent/Planner/HCIPlannerEnvContextEncoder.h"
+
+#include "Agent/Planner/HCIKeywordIntentMatcher.h"
+
+namespace
+{
+// Tokens kept back for the trailing "omitted:" line while admitting assets and folder summaries.
+constexpr int32 HCIEnvContextOmittedLineReserve = 12;
+
+struct FHCIEnvFolderNode
+{
+	FString Name;
+	FString RelativePath;
+	int32 Parent = INDEX_NONE;
+	TArray<int32> Children;
+	// Assets directly in / anywhere under this folder, over the whole scan (not only the candidate rows).
+	int32 DirectCount = 0;
+	int32 TotalCount = 0;
+	// Best relevance score of the folder name, its candidates and its subfolders.
+	int32 Score = 0;
+};
+
+struct FHCIEnvCandidate
+{
+	int32 AssetIndex = INDEX_NONE;
+	int32 Folder = 0;
+	FString Name;
+	int32 Score = 0;
+};
+
+struct FHCIEnvTree
+{
+	// Node 0 is the scan root. A parent is always added before its children, so parents have lower indices.
+	TArray<FHCIEnvFolderNode> Nodes;
+	TMap<FString, int32> NodeByPath;
+
+	FHCIEnvTree()
+	{
+		Nodes.AddDefaulted();
+		NodeByPath.Add(FString(), 0);
+	}
+
+	int32 FindOrAddFolder(const FString& RelativePath)
+	{
+		if (const int32* Existing = NodeByPath.Find(RelativePath))
+		{
+			return *Existing;
+		}
+
+		int32 LastSlash = INDEX_NONE;
+		RelativePath.FindLastChar(TEXT('/'), LastSlash);
+		const int32 Parent = FindOrAddFolder(LastSlash == INDEX_NONE ? FString() : RelativePath.Left(LastSlash));
+		const int32 Index = Nodes.Num();
+		FHCIEnvFolderNode& Node = Nodes.AddDefaulted_GetRef();
+		Node.Name = LastSlash == INDEX_NONE ? RelativePath : RelativePath.Mid(LastSlash + 1);
+		Node.RelativePath = RelativePath;
+		Node.Parent = Parent;
+		Nodes[Parent].Children.Add(Index);
+		NodeByPath.Add(RelativePath, Index);
+		return Index;
+	}
+};
+
+static FString HCI_LeafNameFromObjectPath(const FString& ObjectPath)
+{
+	FString Token = ObjectPath;
+	const int32 SlashIndex = Token.Find(TEXT("/"), ESearchCase::CaseSensitive, ESearchDir::FromEnd);
+	if (SlashIndex != INDEX_NONE && SlashIndex + 1 < Token.Len())
+	{
+		Token = Token.Mid(SlashIndex + 1);
+	}
+
+	const int32 DotIndex = Token.Find(TEXT("."), ESearchCase::CaseSensitive, ESearchDir::FromStart);
+	if (DotIndex != INDEX_NONE)
+	{
+		Token = Token.Left(DotIndex);
+	}
+	return Token;
+}
+
+static FString HCI_RelativeFolderFromObjectPath(const FString& ObjectPath, const FString& ScanRoot)
+{
+	FString PackageName = ObjectPath;
+	const int32 DotIndex = PackageName.Find(TEXT("."), ESearchCase::CaseSensitive, ESearchDir::FromStart);
+	if (DotIndex != INDEX_NONE)
+	{
+		PackageName.LeftInline(DotIndex, EAllowShrinking::No);
+	}
+	const int32 LastSlash = PackageName.Find(TEXT("/"), ESearchCase::CaseSensitive, ESearchDir::FromEnd);
+	const FString Directory = LastSlash > 0 ? PackageName.Left(LastSlash) : FString();
+
+	if (Directory.Equals(ScanRoot, ESearchCase::IgnoreCase))
+	{
+		return FString();
+	}
+	if (Directory.StartsWith(ScanRoot + TEXT("/"), ESearchCase::IgnoreCase))
+	{
+		return Directory.Mid(ScanRoot.Len() + 1);
+	}
+	// Rows outside the root (foreign snapshot producers) keep their full directory as the folder key.
+	return Directory.StartsWith(TEXT("/")) ? Directory.Mid(1) : Directory;
+}
+
+static int32 HCI_CountTermHits(const FString& LowerText, const TArray<FString>& Terms)
+{
+	int32 Hits = 0;
+	for (const FString& Term : Terms)
+	{
+		Hits += LowerText.Contains(Term, ESearchCase::CaseSensitive) ? 1 : 0;
+	}
+	return Hits;
+}
+
+// MaxTokens caps the header itself: a scan with hundreds of classes would otherwise spend the whole budget on the
+// histogram. Classes are sorted by count, so the tail that does not fit is folded into one "other=" bucket.
+static void HCI_AppendEnvHeader(const FHCIAgentPlannerEnvSnapshot& Snapshot, FString& Out, const int32 MaxTokens = MAX_int32)
+{
+	Out += FString::Printf(
+		TEXT("scan_root: %s\nasset_count: %d\n"),
+		*Snapshot.ScanRoot,
+		Snapshot.TotalAssetCount);
+	if (Snapshot.TotalAssetCount > 0)
+	{
+		Out += FString::Printf(
+			TEXT("total_size_bytes: %lld (sized_assets=%d)\n"),
+			static_cast<long long>(Snapshot.TotalSizeBytes),
+			Snapshot.SizedAssetCount);
+		Out += TEXT("class_histogram:");
+		constexpr int32 OtherBucketTokens = 6;
+		int32 UsedTokens = FHCIPlannerEnvContextEncoder::EstimateTokens(Out);
+		int32 OtherCount = 0;
+		for (const FHCIAgentPlannerEnvClassCount& ClassCount : Snapshot.ClassHistogram)
+		{
+			const FString Entry = FString::Printf(TEXT(" %s=%d"), ClassCount.AssetClass.IsEmpty() ? TEXT("Unknown") : *ClassCount.AssetClass, ClassCount.Count);
+			const int32 EntryTokens = FHCIPlannerEnvContextEncoder::EstimateTokens(Entry);
+			if (OtherCount > 0 || UsedTokens + EntryTokens + OtherBucketTokens > MaxTokens)
+			{
+				OtherCount += ClassCount.Count;
+				continue;
+			}
+			Out += Entry;
+			UsedTokens += EntryTokens;
+		}
+		if (OtherCount > 0)
+		{
+			Out += FString::Printf(TEXT(" other=%d"), OtherCount);
+		}
+		Out += TEXT("\n");
+	}
+}
+
+struct FHCIEnvRenderContext
+{
+	const FHCIAgentPlannerEnvSnapshot& Snapshot;
+	const FHCIEnvTree& Tree;
+	const TArray<FHCIEnvCandidate>& Candidates;
+	// Per node: admitted candidate indices directly in it, and admitted candidates anywhere below it.
+	TArray<TArray<int32>> AdmittedByNode;
+	TArray<int32> AdmittedInSubtree;
+	int32 EmittedFolders = 0;
+};
+
+static void HCI_SortChildrenByRelevance(const FHCIEnvTree& Tree, TArray<int32>& InOutChildren)
+{
+	InOutChildren.Sort([&Tree](const int32 Lhs, const int32 Rhs)
+	{
+		const FHCIEnvFolderNode& L = Tree.Nodes[Lhs];
+		const FHCIEnvFolderNode& R = Tree.Nodes[Rhs];
+		if (L.Score != R.Score)
+		{
+			return L.Score > R.Score;
+		}
+		return L.Name.Compare(R.Name, ESearchCase::IgnoreCase) < 0;
+	});
+}
+
+static void HCI_RenderEnvFolder(FHCIEnvRenderContext& Context, const int32 NodeIndex, const int32 Depth, FString& Out)
+{
+	const FHCIEnvFolderNode& Node = Context.Tree.Nodes[NodeIndex];
+	if (NodeIndex != 0)
+	{
+		Out.Appendf(TEXT("%s%s/ %d\n"), *FString::ChrN(Depth - 1, TEXT(' ')), *Node.Name, Node.TotalCount);
+		++Context.EmittedFolders;
+	}
+
+	const TArray<int32>& Admitted = Context.AdmittedByNode[NodeIndex];
+	if (Admitted.Num() > 0)
+	{
+		// One line per class keeps the class name out of every row.
+		TMap<FString, TArray<int32>> ByClass;
+		for (const int32 CandidateIndex : Admitted)
+		{
+			const FHCIAgentPlannerEnvAssetEntry& Entry = Context.Snapshot.Assets[Context.Candidates[CandidateIndex].AssetIndex];
+			ByClass.FindOrAdd(Entry.AssetClass.IsEmpty() ? TEXT("Unknown") : Entry.AssetClass).Add(CandidateIndex);
+		}
+		ByClass.KeySort([](const FString& Lhs, const FString& Rhs) { return Lhs < Rhs; });
+
+		const FString Indent = FString::ChrN(Depth, TEXT(' '));
+		for (TPair<FString, TArray<int32>>& Pair : ByClass)
+		{
+			Pair.Value.Sort([&Context](const int32 Lhs, const int32 Rhs)
+			{
+				return Context.Candidates[Lhs].AssetIndex < Context.Candidates[Rhs].AssetIndex;
+			});
+			Out += Indent;
+			Out += Pair.Key;
+			Out += TEXT(":");
+			for (const int32 CandidateIndex : Pair.Value)
+			{
+				const FHCIEnvCandidate& Candidate = Context.Candidates[CandidateIndex];
+				const int64 SizeBytes = Context.Snapshot.Assets[Candidate.AssetIndex].SizeBytes;
+				Out += TEXT(" ");
+				Out += Candidate.Name.IsEmpty() ? TEXT("-") : Candidate.Name;
+				if (SizeBytes >= 0)
+				{
+					Out.Appendf(TEXT("[%lld]"), static_cast<long long>(SizeBytes));
+				}
+			}
+			Out += TEXT("\n");
+		}
+		if (Node.DirectCount > Admitted.Num())
+		{
+			Out.Appendf(TEXT("%s+%d more\n"), *Indent, Node.DirectCount - Admitted.Num());
+		}
+	}
+
+	TArray<int32> Children;
+	for (const int32 Child : Node.Children)
+	{
+		if (Context.AdmittedInSubtree[Child] > 0)
+		{
+			Children.Add(Child);
+		}
+	}
+	HCI_SortChildrenByRelevance(Context.Tree, Children);
+	for (const int32 Child : Children)
+	{
+		HCI_RenderEnvFolder(Context, Child, Depth + 1, Out);
+	}
+}
+
+static FString HCI_RenderEnvTree(
+	const FHCIAgentPlannerEnvSnapshot& Snapshot,
+	const FHCIEnvTree& Tree,
+	const TArray<FHCIEnvCandidate>& Candidates,
+	const TArray<int32>& RankedCandidates,
+	const int32 AdmitCount,
+	TArray<int32>& OutAdmittedInSubtree,
+	int32& OutEmittedFolders)
+{
+	FHCIEnvRenderContext Context{Snapshot, Tree, Candidates};
+	Context.AdmittedByNode.SetNum(Tree.Nodes.Num());
+	Context.AdmittedInSubtree.SetNumZeroed(Tree.Nodes.Num());
+	for (int32 Rank = 0; Rank < AdmitCount; ++Rank)
+	{
+		const int32 CandidateIndex = RankedCandidates[Rank];
+		int32 NodeIndex = Candidates[CandidateIndex].Folder;
+		Context.AdmittedByNode[NodeIndex].Add(CandidateIndex);
+		for (; NodeIndex != INDEX_NONE; NodeIndex = Tree.Nodes[NodeIndex].Parent)
+		{
+			++Context.AdmittedInSubtree[NodeIndex];
+		}
+	}
+
+	FString Out;
+	Out += TEXT("tree: (folder/ total_assets; assets as Class: Name[size_bytes]; object path = scan_root/folder/.../Name.Name)\n");
+	HCI_RenderEnvFolder(Context, 0, 0, Out);
+	OutAdmittedInSubtree = MoveTemp(Context.AdmittedInSubtree);
+	OutEmittedFolders = Context.EmittedFolders;
+	return Out;
+}
+} // namespace
+
+FHCIPlannerEnvRelevanceQuery FHCIPlannerEnvRelevanceQuery::Make(const FString& UserText, const FString& ScanRoot)
+{
+	FHCIPlannerEnvRelevanceQuery Query;
+
+	// Words that are part of the scan root match every row, so they carry no ranking signal.
+	TSet<FString> RootSegments;
+	TArray<FString> Segments;
+	ScanRoot.ToLower().ParseIntoArray(Segments, TEXT("/"), true);
+	RootSegments.Append(Segments);
+	RootSegments.Add(TEXT("game"));
+
+	const FString Lower = UserText.ToLower();
+	int32 RunStart = INDEX_NONE;
+	for (int32 Index = 0; Index <= Lower.Len(); ++Index)
+	{
+		const TCHAR Ch = Index < Lower.Len() ? Lower[Index] : TEXT(' ');
+		const bool bWordChar = Ch < 128 && FChar::IsAlnum(Ch);
+		if (bWordChar)
+		{
+			if (RunStart == INDEX_NONE)
+			{
+				RunStart = Index;
+			}
+			continue;
+		}
+		if (RunStart != INDEX_NONE && Index - RunStart >= 3)
+		{
+			FString Term = Lower.Mid(RunStart, Index - RunStart);
+			if (!RootSegments.Contains(Term))
+			{
+				Query.Terms.AddUnique(MoveTemp(Term));
+			}
+		}
+		RunStart = INDEX_NONE;
+	}
+
+	FHCIKeywordMatchResult Match;
+	FHCIKeywordIntentMatcher::GetShared()->Match(UserText, Match);
+	if (Match.Has(EHCIKeywordIntentGroup::TextureNoun))
+	{
+		Query.ClassHints.Add(TEXT("texture"));
+	}
+	if (Match.Has(EHCIKeywordIntentGroup::TriangleNoun) || Match.Has(EHCIKeywordIntentGroup::LodNoun))
+	{
+		Query.ClassHints.Add(TEXT("mesh"));
+	}
+	if (Match.Has(EHCIKeywordIntentGroup::CharacterNoun))
+	{
+		Query.ClassHints.Add(TEXT("skeletal"));
+	}
+	if (Match.Has(EHCIKeywordIntentGroup::LevelNoun))
+	{
+		Query.ClassHints.Add(TEXT("world"));
+	}
+	return Query;
+}
+
+FString FHCIPlannerEnvRelevanceQuery::GetCacheKey() const
+{
+	TArray<FString> SortedTerms = Terms;
+	SortedTerms.Sort();
+	TArray<FString> SortedHints = ClassHints;
+	SortedHints.Sort();
+	return FString::Join(SortedTerms, TEXT(",")) + TEXT("#") + FString::Join(SortedHints, TEXT(","));
+}
+
+int32 FHCIPlannerEnvRelevanceQuery::ScoreName(const FString& AssetName) const
+{
+	return Terms.Num() > 0 ? 4 * HCI_CountTermHits(AssetName.ToLower(), Terms) : 0;
+}
+
+int32 FHCIPlannerEnvRelevanceQuery::ScoreFolder(const FString& RelativeFolder) const
+{
+	return Terms.Num() > 0 ? 2 * HCI_CountTermHits(RelativeFolder.ToLower(), Terms) : 0;
+}
+
+int32 FHCIPlannerEnvRelevanceQuery::ScoreClass(const FString& AssetClass) const
+{
+	if (ClassHints.Num() == 0)
+	{
+		return 0;
+	}
+	const FString LowerClass = AssetClass.ToLower();
+	return ClassHints.ContainsByPredicate([&LowerClass](const FString& Hint)
+	{
+		return LowerClass.Contains(Hint, ESearchCase::CaseSensitive);
+	}) ? 1 : 0;
+}
+
+int32 FHCIPlannerEnvContextEncoder::EstimateTokens(const FStringView Text)
+{
+	int32 Tokens = 0;
+	int32 WordRun = 0;
+	for (const TCHAR Ch : Text)
+	{
+		if (Ch < 128 && FChar::IsAlnum(Ch))
+		{
+			++WordRun;
+			continue;
+		}
+		Tokens += (WordRun + 3) / 4;
+		WordRun = 0;
+		if (!FChar::IsWhitespace(Ch))
+		{
+			++Tokens;
+		}
+	}
+	return Tokens + (WordRun + 3) / 4;
+}
+
+FString FHCIPlannerEnvContextEncoder::SerializeFlat(const FHCIAgentPlannerEnvSnapshot& Snapshot)
+{
+	FString Out;
+	HCI_AppendEnvHeader(Snapshot, Out);
+	Out += TEXT("file_list:\n");
+	for (const FHCIAgentPlannerEnvAssetEntry& Entry : Snapshot.Assets)
+	{
+		const FString Name = HCI_LeafNameFromObjectPath(Entry.ObjectPath);
+		const FString SizeField = Entry.SizeBytes >= 0
+			? FString::Printf(TEXT("size_bytes=%lld"), static_cast<long long>(Entry.SizeBytes))
+			: TEXT("size_bytes=-");
+		Out += FString::Printf(
+			TEXT("- %s (%s, %s, path=%s)\n"),
+			Name.IsEmpty() ? TEXT("-") : *Name,
+			Entry.AssetClass.IsEmpty() ? TEXT("Unknown") : *Entry.AssetClass,
+			*SizeField,
+			Entry.ObjectPath.IsEmpty() ? TEXT("-") : *Entry.ObjectPath);
+	}
+	if (Snapshot.TotalAssetCount > Snapshot.Assets.Num())
+	{
+		Out += FString::Printf(TEXT("- ... and %d more\n"), Snapshot.TotalAssetCount - Snapshot.Assets.Num());
+	}
+	if (Snapshot.TotalAssetCount == 0)
+	{
+		Out += TEXT("- (empty)\n");
+	}
+	return Out;
+}
+
+FHCIPlannerEnvContextEncodeResult FHCIPlannerEnvContextEncoder::Encode(
+	const FHCIAgentPlannerEnvSnapshot& Snapshot,
+	const FString& UserText,
+	const int32 TokenBudget)
+{
+	FHCIPlannerEnvContextEncodeResult Result;
+
+	// The header is charged first; only what it leaves is spent on rows and folder summaries.
+	const int32 Budget = FMath::Max(0, TokenBudget - HCIEnvContextOmittedLineReserve);
+	FString Header;
+	HCI_AppendEnvHeader(Snapshot, Header, Budget);
+	if (Snapshot.TotalAssetCount == 0 || Snapshot.Assets.Num() == 0)
+	{
+		Result.FlatTokenEstimate = EstimateTokens(SerializeFlat(Snapshot));
+		Result.Text = Header + (Snapshot.TotalAssetCount == 0
+			? FString(TEXT("tree: (empty)\n"))
+			: FString::Printf(TEXT("omitted: assets=%d folders=%d\n"), Snapshot.TotalAssetCount, Snapshot.FolderCounts.Num()));
+		Result.TokenEstimate = EstimateTokens(Result.Text);
+		return Result;
+	}
+
+	const FString ScanRoot = Snapshot.ScanRoot.EndsWith(TEXT("/")) ? Snapshot.ScanRoot.LeftChop(1) : Snapshot.ScanRoot;
+	FHCIEnvTree Tree;
+	for (const FHCIAgentPlannerEnvFolderCount& FolderCount : Snapshot.FolderCounts)
+	{
+		Tree.Nodes[Tree.FindOrAddFolder(FolderCount.Folder)].DirectCount += FolderCount.Count;
+	}
+
+	TArray<FHCIEnvCandidate> Candidates;
+	Candidates.Reserve(Snapshot.Assets.Num());
+	for (int32 AssetIndex = 0; AssetIndex < Snapshot.Assets.Num(); ++AssetIndex)
+	{
+		FHCIEnvCandidate& Candidate = Candidates.AddDefaulted_GetRef();
+		Candidate.AssetIndex = AssetIndex;
+		Candidate.Folder = Tree.FindOrAddFolder(HCI_RelativeFolderFromObjectPath(Snapshot.Assets[AssetIndex].ObjectPath, ScanRoot));
+		Candidate.Name = HCI_LeafNameFromObjectPath(Snapshot.Assets[AssetIndex].ObjectPath);
+	}
+	// Producers without folder counts only tell us about the candidate rows.
+	if (Snapshot.FolderCounts.Num() == 0)
+	{
+		for (const FHCIEnvCandidate& Candidate : Candidates)
+		{
+			++Tree.Nodes[Candidate.Folder].DirectCount;
+		}
+	}
+
+	const FHCIPlannerEnvRelevanceQuery Relevance = FHCIPlannerEnvRelevanceQuery::Make(UserText, ScanRoot);
+	TArray<int32> FolderTermScores;
+	FolderTermScores.Reserve(Tree.Nodes.Num());
+	for (FHCIEnvFolderNode& Node : Tree.Nodes)
+	{
+		Node.Score = Relevance.ScoreFolder(Node.RelativePath);
+		FolderTermScores.Add(Node.Score);
+	}
+	for (FHCIEnvCandidate& Candidate : Candidates)
+	{
+		Candidate.Score =
+			Relevance.ScoreName(Candidate.Name) +
+			FolderTermScores[Candidate.Folder] +
+			Relevance.ScoreClass(Snapshot.Assets[Candidate.AssetIndex].AssetClass);
+		Tree.Nodes[Candidate.Folder].Score = FMath::Max(Tree.Nodes[Candidate.Folder].Score, Candidate.Score);
+	}
+	for (int32 NodeIndex = Tree.Nodes.Num() - 1; NodeIndex > 0; --NodeIndex)
+	{
+		FHCIEnvFolderNode& Node = Tree.Nodes[NodeIndex];
+		Node.TotalCount += Node.DirectCount;
+		FHCIEnvFolderNode& Parent = Tree.Nodes[Node.Parent];
+		Parent.TotalCount += Node.TotalCount;
+		Parent.Score = FMath::Max(Parent.Score, Node.Score);
+	}
+	Tree.Nodes[0].TotalCount += Tree.Nodes[0].DirectCount;
+
+	// Best first; the snapshot's path order breaks ties so equal scores keep a stable, readable order.
+	TArray<int32> Ranked;
+	Ranked.Reserve(Candidates.Num());
+	for (int32 Index = 0; Index < Candidates.Num(); ++Index)
+	{
+		Ranked.Add(Index);
+	}
+	Ranked.Sort([&Candidates](const int32 Lhs, const int32 Rhs)
+	{
+		if (Candidates[Lhs].Score != Candidates[Rhs].Score)
+		{
+			return Candidates[Lhs].Score > Candidates[Rhs].Score;
+		}
+		return Candidates[Lhs].AssetIndex < Candidates[Rhs].AssetIndex;
+	});
+
+	// Largest admitted prefix of the ranking that fits the budget. Tree cost only grows with the prefix, so
+	// a binary search over the prefix length needs O(log n) renders.
+	const int32 HeaderTokens = EstimateTokens(Header);
+	TArray<int32> AdmittedInSubtree;
+	int32 EmittedFolders = 0;
+	int32 Low = 0;
+	int32 High = Ranked.Num();
+	while (Low < High)
+	{
+		const int32 Mid = Low + (High - Low + 1) / 2;
+		const FString Trial = HCI_RenderEnvTree(Snapshot, Tree, Candidates, Ranked, Mid, AdmittedInSubtree, EmittedFolders);
+		if (HeaderTokens + EstimateTokens(Trial) <= Budget)
+		{
+			Low = Mid;
+		}
+		else
+		{
+			High = Mid - 1;
+		}
+	}
+	const FString TreeText = HCI_RenderEnvTree(Snapshot, Tree, Candidates, Ranked, Low, AdmittedInSubtree, EmittedFolders);
+	int32 UsedTokens = HeaderTokens + EstimateTokens(TreeText);
+
+	// Compare like with like: the flat list carrying exactly the admitted rows, in snapshot order.
+	FHCIAgentPlannerEnvSnapshot FlatSnapshot = Snapshot;
+	FlatSnapshot.Assets.Reset(Low);
+	TArray<int32> AdmittedAssetIndices;
+	AdmittedAssetIndices.Reserve(Low);
+	for (int32 RankIndex = 0; RankIndex < Low; ++RankIndex)
+	{
+		AdmittedAssetIndices.Add(Candidates[Ranked[RankIndex]].AssetIndex);
+	}
+	AdmittedAssetIndices.Sort();
+	for (const int32 AssetIndex : AdmittedAssetIndices)
+	{
+		FlatSnapshot.Assets.Add(Snapshot.Assets[AssetIndex]);
+	}
+	Result.FlatTokenEstimate = EstimateTokens(SerializeFlat(FlatSnapshot));
+
+	// Folders with nothing admitted, directly below an expanded folder: summarized by count, best first.
+	TArray<int32> Frontier;
+	for (int32 NodeIndex = 1; NodeIndex < Tree.Nodes.Num(); ++NodeIndex)
+	{
+		const FHCIEnvFolderNode& Node = Tree.Nodes[NodeIndex];
+		if (AdmittedInSubtree[NodeIndex] == 0 && (Node.Parent == 0 || AdmittedInSubtree[Node.Parent] > 0) && Node.TotalCount > 0)
+		{
+			Frontier.Add(NodeIndex);
+		}
+	}
+	Frontier.Sort([&Tree](const int32 Lhs, const int32 Rhs)
+	{
+		const FHCIEnvFolderNode& L = Tree.Nodes[Lhs];
+		const FHCIEnvFolderNode& R = Tree.Nodes[Rhs];
+		if (L.Score != R.Score)
+		{
+			return L.Score > R.Score;
+		}
+		if (L.TotalCount != R.TotalCount)
+		{
+			return L.TotalCount > R.TotalCount;
+		}
+		return L.RelativePath.Compare(R.RelativePath, ESearchCase::IgnoreCase) < 0;
+	});
+
+	FString OtherFolders;
+	int32 SummarizedFolders = 0;
+	for (const int32 NodeIndex : Frontier)
+	{
+		const FString Entry = FString::Printf(TEXT(" %s/ %d"), *Tree.Nodes[NodeIndex].RelativePath, Tree.Nodes[NodeIndex].TotalCount);
+		const int32 EntryTokens = EstimateTokens(Entry) + (SummarizedFolders == 0 ? EstimateTokens(TEXT("other_folders:\n")) : 1);
+		if (UsedTokens + EntryTokens > Budget)
+		{
+			break;
+		}
+		OtherFolders += SummarizedFolders == 0 ? Entry : TEXT(",") + Entry;
+		UsedTokens += EntryTokens;
+		++SummarizedFolders;
+	}
+
+	Result.Text = Header + TreeText;
+	if (SummarizedFolders > 0)
+	{
+		Result.Text += TEXT("other_folders:") + OtherFolders + TEXT("\n");
+	}
+	const int32 OmittedAssets = Snapshot.TotalAssetCount - Low;
+	const int32 OmittedFolders = Frontier.Num() - SummarizedFolders;
+	if (OmittedAssets > 0 || OmittedFolders > 0)
+	{
+		Result.Text += FString::Printf(TEXT("omitted: assets=%d folders=%d\n"), OmittedAssets, OmittedFolders);
+	}
+	Result.TokenEstimate = EstimateTokens(Result.Text);
+	Result.EmittedAssetCount = Low;
+	Result.EmittedFolderCount = EmittedFolders + SummarizedFolders;
+	return Result;
+}
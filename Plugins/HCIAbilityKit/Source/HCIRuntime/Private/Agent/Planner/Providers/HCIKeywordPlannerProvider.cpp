@@ -1,7 +1,9 @@
 #include "Agent/Planner/Providers/HCIKeywordPlannerProvider.h"
 
 #include "Agent/Planner/HCIAgentPlan.h"
+#include "Agent/Planner/HCIKeywordIntentMatcher.h"
 #include "Agent/Tools/HCIToolRegistry.h"
+#include "Common/HCIRequestArena.h"
 #include "Dom/JsonObject.h"
 #include "Dom/JsonValue.h"
 
@@ -66,26 +68,6 @@ static bool HCI_StepFromTool(
 	return HCI_StepFromTool(ToolRegistry, StepId, ToolName, Args, ExpectedEvidence, nullptr, OutStep, OutError);
 }
 
-static FString HCI_NormalizeText(const FString& InText)
-{
-	FString Text = InText;
-	Text.TrimStartAndEndInline();
-	Text.ToLowerInline();
-	return Text;
-}
-
-static bool HCI_TextContainsAny(const FString& Text, std::initializer_list<const TCHAR*> Keywords)
-{
-	for (const TCHAR* Keyword : Keywords)
-	{
-		if (Text.Contains(Keyword))
-		{
-			return true;
-		}
-	}
-	return false;
-}
-
 static bool HCI_BuildPreparedMessageOnlyPlan(
 	const FString& RequestId,
 	const FString& Intent,
@@ -110,89 +92,6 @@ static bool HCI_BuildPreparedMessageOnlyPlan(
 	return true;
 }
 
-static bool HCI_IsGamePathTerminalChar(const TCHAR Ch)
-{
-	return FChar::IsWhitespace(Ch) ||
-		   Ch == TCHAR('"') ||
-		   Ch == TCHAR('\'') ||
-		   Ch == TCHAR(',') ||
-		   Ch == TCHAR(0xFF0C) || // '，'
-		   Ch == TCHAR(';') ||
-		   Ch == TCHAR(0xFF1B) || // '；'
-		   Ch == TCHAR(':') ||
-		   Ch == TCHAR(0xFF1A) || // '：'
-		   Ch == TCHAR(0x3002) || // '。'
-		   Ch == TCHAR(')') ||
-		   Ch == TCHAR('(') ||
-		   Ch == TCHAR(']') ||
-		   Ch == TCHAR('[');
-}
-
-static bool HCI_TryExtractFirstGamePathToken(const FString& UserText, FString& OutToken)
-{
-	OutToken.Reset();
-	int32 Start = UserText.Find(TEXT("/Game/"), ESearchCase::IgnoreCase);
-	if (Start == INDEX_NONE)
-	{
-		// Accept common user typo: missing leading slash ("Game/...").
-		Start = UserText.Find(TEXT("Game/"), ESearchCase::IgnoreCase);
-		if (Start == INDEX_NONE)
-		{
-			return false;
-		}
-	}
-
-	int32 End = Start;
-	while (End < UserText.Len() && !HCI_IsGamePathTerminalChar(UserText[End]))
-	{
-		++End;
-	}
-
-	OutToken = UserText.Mid(Start, End - Start).TrimStartAndEnd();
-	if (OutToken.StartsWith(TEXT("Game/"), ESearchCase::IgnoreCase))
-	{
-		OutToken = FString::Printf(TEXT("/%s"), *OutToken);
-	}
-	return !OutToken.IsEmpty();
-}
-
-static void HCI_ExtractAllGamePathTokens(const FString& UserText, TArray<FString>& OutTokens)
-{
-	OutTokens.Reset();
-
-	int32 SearchFrom = 0;
-	while (SearchFrom < UserText.Len())
-	{
-		int32 Start = UserText.Find(TEXT("/Game/"), ESearchCase::IgnoreCase, ESearchDir::FromStart, SearchFrom);
-		if (Start == INDEX_NONE)
-		{
-			Start = UserText.Find(TEXT("Game/"), ESearchCase::IgnoreCase, ESearchDir::FromStart, SearchFrom);
-			if (Start == INDEX_NONE)
-			{
-				return;
-			}
-		}
-
-		int32 End = Start;
-		while (End < UserText.Len() && !HCI_IsGamePathTerminalChar(UserText[End]))
-		{
-			++End;
-		}
-
-		FString Token = UserText.Mid(Start, End - Start).TrimStartAndEnd();
-		if (Token.StartsWith(TEXT("Game/"), ESearchCase::IgnoreCase))
-		{
-			Token = FString::Printf(TEXT("/%s"), *Token);
-		}
-		if (!Token.IsEmpty())
-		{
-			OutTokens.Add(MoveTemp(Token));
-		}
-
-		SearchFrom = FMath::Max(End, Start + 5);
-	}
-}
-
 static FString HCI_DeriveDirectoryFromPathToken(const FString& PathToken)
 {
 	FString Candidate = PathToken;
@@ -226,14 +125,8 @@ static FString HCI_DeriveDirectoryFromPathToken(const FString& PathToken)
 	return Candidate;
 }
 
-static FString HCI_DetermineEnvScanRoot(const FString& UserText)
+static FString HCI_DetermineEnvScanRoot(const FString& PathToken)
 {
-	FString PathToken;
-	if (!HCI_TryExtractFirstGamePathToken(UserText, PathToken))
-	{
-		return FString();
-	}
-
 	const FString Derived = HCI_DeriveDirectoryFromPathToken(PathToken);
 	if (Derived.StartsWith(TEXT("/Game/")))
 	{
@@ -268,13 +161,13 @@ static TSharedPtr<FJsonObject> HCI_MakeLevelRiskArgs()
 	return Args;
 }
 
-static TSharedPtr<FJsonObject> HCI_MakeTextureComplianceArgs()
+static TSharedPtr<FJsonObject> HCI_MakeTextureComplianceArgs(const int32 MaxSize)
 {
 	TSharedPtr<FJsonObject> Args = MakeShared<FJsonObject>();
 	TArray<TSharedPtr<FJsonValue>> AssetPaths;
 	AssetPaths.Add(MakeShared<FJsonValueString>(TEXT("/Game/Art/Trees/T_Tree_01_D.T_Tree_01_D")));
 	Args->SetArrayField(TEXT("asset_paths"), AssetPaths);
-	Args->SetNumberField(TEXT("max_size"), 1024);
+	Args->SetNumberField(TEXT("max_size"), MaxSize);
 	return Args;
 }
 
@@ -316,21 +209,95 @@ static TSharedPtr<FJsonObject> HCI_MakeSearchPathArgs(const FString& Keyword)
 	return Args;
 }
 
-static FString HCI_PickSearchKeywordForFolderIntent(const FString& NormalizedText)
+static FString HCI_PickSearchKeywordForFolderIntent(const FHCIKeywordArenaMatchResult& Match)
 {
-	if (HCI_TextContainsAny(NormalizedText, {TEXT("角色"), TEXT("character")}))
+	if (Match.Has(EHCIKeywordIntentGroup::CharacterNoun))
 	{
 		return TEXT("角色");
 	}
-	if (HCI_TextContainsAny(NormalizedText, {TEXT("美术"), TEXT("艺术"), TEXT("art")}))
+	if (Match.Has(EHCIKeywordIntentGroup::ArtNoun))
 	{
 		return TEXT("Art");
 	}
-	if (HCI_TextContainsAny(NormalizedText, {TEXT("临时"), TEXT("temp"), TEXT("tmp")}))
+	return TEXT("Temp");
+}
+
+static bool HCI_IsSizeBindingSeparator(const TCHAR Ch)
+{
+	return FChar::IsWhitespace(Ch) || Ch == TEXT(':') || Ch == TEXT('=') || Ch == TEXT('：');
+}
+
+static int32 HCI_SkipSizeBindingSeparators(const FString& UserText, int32 Cursor)
+{
+	while (Cursor < UserText.Len() && HCI_IsSizeBindingSeparator(UserText[Cursor]))
 	{
-		return TEXT("Temp");
+		++Cursor;
 	}
-	return TEXT("Temp");
+	return Cursor;
+}
+
+// Number bound to a size keyword ("贴图最大尺寸设为 2048", "max_size=512"): the keyword, then only separators or one
+// size connector, then the digits. Other numbers ("检查 512 张贴图", "把 4096 的贴图压到 1024") are counts or source
+// sizes and are left alone. INDEX_NONE when no number is bound.
+static int64 HCI_FindNumberAfterSizeKeyword(const FString& UserText, const FHCIKeywordArenaMatchResult& Match)
+{
+	for (const FHCIKeywordHit& Keyword : Match.PositionalHits)
+	{
+		if (Keyword.Group != EHCIKeywordIntentGroup::SizeKeyword)
+		{
+			continue;
+		}
+
+		int32 Cursor = HCI_SkipSizeBindingSeparators(UserText, Keyword.Span.End);
+		int32 ConnectorEnd = INDEX_NONE;
+		for (const FHCIKeywordHit& Connector : Match.PositionalHits)
+		{
+			if (Connector.Group == EHCIKeywordIntentGroup::SizeConnector && Connector.Span.Start == Cursor)
+			{
+				ConnectorEnd = FMath::Max(ConnectorEnd, Connector.Span.End);
+			}
+		}
+		if (ConnectorEnd != INDEX_NONE)
+		{
+			Cursor = HCI_SkipSizeBindingSeparators(UserText, ConnectorEnd);
+		}
+
+		for (int32 NumberIndex = 0; NumberIndex < Match.Numbers.Num(); ++NumberIndex)
+		{
+			if (Match.NumberSpans[NumberIndex].Start == Cursor)
+			{
+				return Match.Numbers[NumberIndex];
+			}
+		}
+	}
+	return INDEX_NONE;
+}
+
+// Number bound to a size keyword when the tool's max_size enum accepts it; 1024 otherwise.
+static int32 HCI_PickTextureMaxSize(
+	const FHCIToolRegistry& ToolRegistry,
+	const FString& UserText,
+	const FHCIKeywordArenaMatchResult& Match)
+{
+	constexpr int32 DefaultMaxSize = 1024;
+	const int64 Requested = HCI_FindNumberAfterSizeKeyword(UserText, Match);
+	if (Requested == INDEX_NONE || Requested > MAX_int32)
+	{
+		return DefaultMaxSize;
+	}
+	const FHCIToolDescriptor* Tool = ToolRegistry.FindTool(FName(TEXT("SetTextureMaxSize")));
+	if (Tool == nullptr)
+	{
+		return DefaultMaxSize;
+	}
+	for (const FHCIToolArgSchema& ArgSchema : Tool->ArgsSchema)
+	{
+		if (ArgSchema.ArgName == TEXT("max_size") && ArgSchema.AllowedIntValues.Contains(static_cast<int32>(Requested)))
+		{
+			return static_cast<int32>(Requested);
+		}
+	}
+	return DefaultMaxSize;
 }
 
 
@@ -342,45 +309,39 @@ static bool HCI_BuildKeywordPlan(
 	FString& OutRouteReason,
 	FString& OutError)
 {
+	HCI_REQUEST_ARENA_SCOPE(RequestId);
 	OutPlan = FHCIAgentPlan();
 	OutPlan.RequestId = RequestId;
 	OutRouteReason.Reset();
 	OutError.Reset();
 
-	const FString Text = HCI_NormalizeText(UserText);
-	if (Text.IsEmpty())
+	if (UserText.TrimStartAndEnd().IsEmpty())
 	{
 		OutError = TEXT("empty_input");
 		return false;
 	}
 
-	const bool bNamingIntent =
-		HCI_TextContainsAny(Text, {TEXT("整理"), TEXT("归档"), TEXT("重命名"), TEXT("命名"), TEXT("organize"), TEXT("archive"), TEXT("rename"), TEXT("naming")}) &&
-		HCI_TextContainsAny(Text, {TEXT("临时"), TEXT("temp"), TEXT("tmp")});
-	const bool bDirectoryNamingIntent =
-		HCI_TextContainsAny(Text, {TEXT("整理"), TEXT("归档"), TEXT("重命名"), TEXT("命名"), TEXT("organize"), TEXT("archive"), TEXT("rename"), TEXT("naming")}) &&
-		HCI_TextContainsAny(Text, {TEXT("目录"), TEXT("文件夹"), TEXT("folder"), TEXT("directory")});
-	const bool bExplicitPathNamingIntent =
-		HCI_TextContainsAny(Text, {TEXT("整理"), TEXT("归档"), TEXT("重命名"), TEXT("命名"), TEXT("规范"), TEXT("规范化"), TEXT("organize"), TEXT("archive"), TEXT("rename"), TEXT("naming")}) &&
-		(HCI_TextContainsAny(Text, {TEXT("扫描"), TEXT("scan"), TEXT("inspect")}) || UserText.Contains(TEXT("/Game/"), ESearchCase::IgnoreCase) || UserText.Contains(TEXT("Game/"), ESearchCase::IgnoreCase)) &&
-		(UserText.Contains(TEXT("/Game/"), ESearchCase::IgnoreCase) || UserText.Contains(TEXT("Game/"), ESearchCase::IgnoreCase));
-
-	const bool bLevelRiskIntent =
-		HCI_TextContainsAny(Text, {TEXT("关卡"), TEXT("场景"), TEXT("level")}) &&
-		HCI_TextContainsAny(Text, {TEXT("碰撞"), TEXT("collision"), TEXT("材质丢失"), TEXT("默认材质"), TEXT("default material")});
+	// One pass labels every vocabulary group, path token and number in the text.
+	FHCIKeywordArenaMatchResult Match;
+	FHCIKeywordIntentMatcher::GetShared()->Match(UserText, Match);
+	const bool bHasGamePath = Match.PathTokens.Num() > 0;
+	const bool bOrganizeVerb = Match.Has(EHCIKeywordIntentGroup::OrganizeVerb);
+
+	const bool bNamingIntent = bOrganizeVerb && Match.Has(EHCIKeywordIntentGroup::TempScope);
+	const bool bDirectoryNamingIntent = bOrganizeVerb && Match.Has(EHCIKeywordIntentGroup::FolderNoun);
+	const bool bExplicitPathNamingIntent = (bOrganizeVerb || Match.Has(EHCIKeywordIntentGroup::NormalizeVerb)) && bHasGamePath;
+
+	const bool bLevelRiskIntent = Match.Has(EHCIKeywordIntentGroup::LevelNoun) && Match.Has(EHCIKeywordIntentGroup::LevelIssue);
 
 	const bool bMeshTriangleCountIntent =
-		HCI_TextContainsAny(Text, {TEXT("面数"), TEXT("triangle"), TEXT("triangles"), TEXT("poly")}) &&
-		HCI_TextContainsAny(Text, {TEXT("检查"), TEXT("扫描"), TEXT("统计"), TEXT("分析"), TEXT("查看"), TEXT("check"), TEXT("scan"), TEXT("inspect"), TEXT("analyze")});
-
-	const bool bAssetComplianceIntent =
-		HCI_TextContainsAny(Text, {TEXT("贴图"), TEXT("texture"), TEXT("分辨率"), TEXT("npot"), TEXT("面数"), TEXT("lod")});
-	const bool bIdentityIntent =
-		HCI_TextContainsAny(Text, {TEXT("你是谁"), TEXT("你是哪个"), TEXT("你是哪位"), TEXT("你是做什么"), TEXT("你是什么"), TEXT("who are you"), TEXT("what are you")});
-	const bool bCapabilityIntent =
-		HCI_TextContainsAny(Text, {TEXT("你能做什么"), TEXT("你有哪些能力"), TEXT("有什么能力"), TEXT("有啥能力"), TEXT("能做什么"), TEXT("可以做什么"), TEXT("会什么"), TEXT("what can you do"), TEXT("capability"), TEXT("abilities")});
-	const bool bGreetingIntent =
-		HCI_TextContainsAny(Text, {TEXT("你好"), TEXT("早上好"), TEXT("晚上好"), TEXT("嗨"), TEXT("hello"), TEXT("hi")});
+		Match.Has(EHCIKeywordIntentGroup::TriangleNoun) && Match.Has(EHCIKeywordIntentGroup::InspectVerb);
+
+	const bool bTextureIntent = Match.Has(EHCIKeywordIntentGroup::TextureNoun);
+	const bool bLodIntent = Match.Has(EHCIKeywordIntentGroup::LodNoun);
+	const bool bAssetComplianceIntent = bTextureIntent || bLodIntent;
+	const bool bIdentityIntent = Match.Has(EHCIKeywordIntentGroup::Identity);
+	const bool bCapabilityIntent = Match.Has(EHCIKeywordIntentGroup::Capability);
+	const bool bGreetingIntent = Match.Has(EHCIKeywordIntentGroup::Greeting);
 	const bool bLikelyChitchatIntent = bIdentityIntent || bCapabilityIntent || bGreetingIntent;
 
 	if (bLikelyChitchatIntent)
@@ -424,8 +385,7 @@ static bool HCI_BuildKeywordPlan(
 		OutRouteReason = bNamingIntent ? TEXT("naming_traceability_temp_assets") : TEXT("naming_traceability_explicit_paths");
 
 		// If user provided explicit /Game/... paths, prefer them over the default /Game/Temp.
-		TArray<FString> PathTokens;
-		HCI_ExtractAllGamePathTokens(UserText, PathTokens);
+		const THCIArenaArray<FString>& PathTokens = Match.PathTokens;
 		const FString ScanRoot = PathTokens.Num() > 0 ? HCI_DetermineEnvScanRoot(PathTokens[0]) : FString();
 		FString TargetRoot;
 		if (PathTokens.Num() > 1)
@@ -468,7 +428,7 @@ static bool HCI_BuildKeywordPlan(
 			OutPlan.Intent = TEXT("scan_assets");
 			OutRouteReason = TEXT("naming_traceability_search_then_scan");
 
-			const FString SearchKeyword = HCI_PickSearchKeywordForFolderIntent(Text);
+			const FString SearchKeyword = HCI_PickSearchKeywordForFolderIntent(Match);
 
 				FHCIAgentPlanStep& SearchStep = OutPlan.Steps.AddDefaulted_GetRef();
 				if (!HCI_StepFromTool(
@@ -519,11 +479,10 @@ static bool HCI_BuildKeywordPlan(
 		OutPlan.Intent = TEXT("scan_mesh_triangle_count");
 		OutRouteReason = TEXT("mesh_triangle_count_analysis");
 
-		FString PathToken;
 		FString Directory = TEXT("/Game/Temp");
-		if (HCI_TryExtractFirstGamePathToken(UserText, PathToken))
+		if (bHasGamePath)
 		{
-			const FString DerivedDirectory = HCI_DeriveDirectoryFromPathToken(PathToken);
+			const FString DerivedDirectory = HCI_DeriveDirectoryFromPathToken(Match.PathTokens[0]);
 			if (DerivedDirectory.StartsWith(TEXT("/Game/")))
 			{
 				Directory = DerivedDirectory;
@@ -549,14 +508,14 @@ static bool HCI_BuildKeywordPlan(
 		OutRouteReason = TEXT("asset_compliance_texture_lod");
 
 		FHCIAgentPlanStep* TextureStep = nullptr;
-		if (HCI_TextContainsAny(Text, {TEXT("贴图"), TEXT("texture"), TEXT("分辨率"), TEXT("npot")}))
+		if (bTextureIntent)
 		{
 			TextureStep = &OutPlan.Steps.AddDefaulted_GetRef();
 			if (!HCI_StepFromTool(
 					ToolRegistry,
 					TEXT("s1"),
 						TEXT("SetTextureMaxSize"),
-						HCI_MakeTextureComplianceArgs(),
+						HCI_MakeTextureComplianceArgs(HCI_PickTextureMaxSize(ToolRegistry, UserText, Match)),
 						{TEXT("target_max_size"), TEXT("scanned_count"), TEXT("modified_count"), TEXT("failed_count"), TEXT("modified_assets"), TEXT("failed_assets"), TEXT("result")},
 						*TextureStep,
 						OutError))
@@ -565,7 +524,7 @@ static bool HCI_BuildKeywordPlan(
 			}
 		}
 
-		if (HCI_TextContainsAny(Text, {TEXT("面数"), TEXT("lod")}))
+		if (bLodIntent)
 		{
 			const TCHAR* StepId = TextureStep ? TEXT("s2") : TEXT("s1");
 			FHCIAgentPlanStep& LodStep = OutPlan.Steps.AddDefaulted_GetRef();
@@ -3,15 +3,21 @@
 #include "Agent/LLM/HCIAgentLlmClient.h"
 #include "Agent/Planner/HCIAgentPlan.h"
 #include "Agent/Planner/HCIAgentPlanValidator.h"
+#include "Agent/Planner/HCIPlannerEnvContextEncoder.h"
 #include "Agent/LLM/HCIAgentPromptBuilder.h"
 #include "Agent/Planner/Providers/HCIKeywordPlannerProvider.h"
+#include "Agent/Tools/HCIAgentToolAction.h"
 #include "Agent/Tools/HCIToolRegistry.h"
 #include "Containers/Ticker.h"
 #include "Dom/JsonObject.h"
+#include "HAL/PlatformTime.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Interfaces/IHttpResponse.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "String/ParseTokens.h"
 #include "Templates/Atomic.h"
 #include "Internationalization/Regex.h"
 
@@ -296,32 +302,30 @@ static void HCI_ParseLooseStringList(const FString& InText, TArray<FString>& Out
 		return;
 	}
 
-	FString Delimiter;
+	TCHAR Delimiter = TEXT('\0');
 	if (Trimmed.Contains(TEXT("|")))
 	{
-		Delimiter = TEXT("|");
+		Delimiter = TEXT('|');
 	}
 	else if (Trimmed.Contains(TEXT(",")))
 	{
-		Delimiter = TEXT(",");
+		Delimiter = TEXT(',');
 	}
 
-	if (Delimiter.IsEmpty())
+	if (Delimiter == TEXT('\0'))
 	{
 		OutValues.Add(Trimmed);
 		return;
 	}
 
-	TArray<FString> Tokens;
-	Trimmed.ParseIntoArray(Tokens, *Delimiter, true);
-	for (FString& Token : Tokens)
-	{
-		Token.TrimStartAndEndInline();
-		if (!Token.IsEmpty())
+	UE::String::ParseTokens(
+		Trimmed,
+		Delimiter,
+		[&OutValues](const FStringView Token)
 		{
-			OutValues.Add(Token);
-		}
-	}
+			OutValues.Emplace(Token);
+		},
+		UE::String::EParseTokensOptions::Trim | UE::String::EParseTokensOptions::SkipEmpty);
 }
 
 static TSharedPtr<FJsonValue> HCI_NormalizeJsonValueForArgSchema(
@@ -498,68 +502,21 @@ static FString HCI_DetermineEnvScanRoot(const FString& UserText)
 	return FString();
 }
 
-static FString HCI_LeafNameFromObjectPath(const FString& ObjectPath)
-{
-	FString Token = ObjectPath;
-	const int32 SlashIndex = Token.Find(TEXT("/"), ESearchCase::CaseSensitive, ESearchDir::FromEnd);
-	if (SlashIndex != INDEX_NONE && SlashIndex + 1 < Token.Len())
-	{
-		Token = Token.Mid(SlashIndex + 1);
-	}
-
-	const int32 DotIndex = Token.Find(TEXT("."), ESearchCase::CaseSensitive, ESearchDir::FromStart);
-	if (DotIndex != INDEX_NONE)
-	{
-		Token = Token.Left(DotIndex);
-	}
-	return Token;
-}
-
-static FString HCI_SerializeEnvContext(
-	const FString& ScanRoot,
-	const TArray<FHCIAgentPlannerEnvAssetEntry>& Assets)
-{
-	const int32 MaxRows = 40;
-	FString Out = FString::Printf(TEXT("scan_root: %s\nasset_count: %d\nfile_list:\n"), *ScanRoot, Assets.Num());
-
-	const int32 EmitCount = FMath::Min(MaxRows, Assets.Num());
-	for (int32 Index = 0; Index < EmitCount; ++Index)
-	{
-		const FHCIAgentPlannerEnvAssetEntry& Entry = Assets[Index];
-		const FString Name = HCI_LeafNameFromObjectPath(Entry.ObjectPath);
-		const FString ClassName = Entry.AssetClass.IsEmpty() ? TEXT("Unknown") : Entry.AssetClass;
-		const FString SizeField = Entry.SizeBytes >= 0
-			? FString::Printf(TEXT("size_bytes=%lld"), static_cast<long long>(Entry.SizeBytes))
-			: TEXT("size_bytes=-");
-		Out += FString::Printf(
-			TEXT("- %s (%s, %s, path=%s)\n"),
-			Name.IsEmpty() ? TEXT("-") : *Name,
-			*ClassName,
-			*SizeField,
-			Entry.ObjectPath.IsEmpty() ? TEXT("-") : *Entry.ObjectPath);
-	}
-	if (Assets.Num() > MaxRows)
-	{
-		Out += FString::Printf(TEXT("- ... and %d more\n"), Assets.Num() - MaxRows);
-	}
-	if (Assets.Num() == 0)
-	{
-		Out += TEXT("- (empty)\n");
-	}
-	return Out;
-}
-
 static bool HCI_TryBuildAutoEnvContext(
 	const FString& UserText,
 	const FHCIAgentPlannerBuildOptions& Options,
 	FString& OutScanRoot,
 	FString& OutEnvContext,
 	int32& OutAssetCount,
+	int32& OutTokenEstimate,
+	int32& OutFlatTokenEstimate,
 	bool& bOutInjected)
 {
 	OutScanRoot.Reset();
 	OutEnvContext.Reset();
 	OutAssetCount = 0;
+	OutTokenEstimate = 0;
+	OutFlatTokenEstimate = 0;
 	bOutInjected = false;
 
 	if (!Options.bEnableAutoEnvContextScan)
@@ -581,17 +538,35 @@ static bool HCI_TryBuildAutoEnvContext(
 		return true;
 	}
 
-	TArray<FHCIAgentPlannerEnvAssetEntry> ScannedAssets;
+	const int32 MaxRows = FMath::Max(1, Options.EnvContextMaxAssetRows);
+	FHCIAgentPlannerEnvSnapshot Snapshot;
 	FString ScanError;
-	if (!Options.ScanAssetsForEnvContext(ScanRoot, ScannedAssets, ScanError))
+	if (!Options.ScanAssetsForEnvContext(ScanRoot, UserText, MaxRows, Snapshot, ScanError))
 	{
 		OutScanRoot = ScanRoot;
 		return true;
 	}
 
+	Snapshot.ScanRoot = ScanRoot;
 	OutScanRoot = ScanRoot;
-	OutAssetCount = ScannedAssets.Num();
-	OutEnvContext = HCI_SerializeEnvContext(ScanRoot, ScannedAssets);
+	OutAssetCount = Snapshot.TotalAssetCount;
+
+	FHCIPlannerEnvContextEncodeResult Encoded = FHCIPlannerEnvContextEncoder::Encode(Snapshot, UserText, Options.EnvContextTokenBudget);
+	UE_LOG(
+		LogHCIAgentPlanner,
+		Display,
+		TEXT("[HCI][PlannerEnvContext] scan_root=%s assets=%d candidates=%d emitted_assets=%d emitted_folders=%d tokens_flat=%d tokens_encoded=%d budget=%d"),
+		*ScanRoot,
+		Snapshot.TotalAssetCount,
+		Snapshot.Assets.Num(),
+		Encoded.EmittedAssetCount,
+		Encoded.EmittedFolderCount,
+		Encoded.FlatTokenEstimate,
+		Encoded.TokenEstimate,
+		Options.EnvContextTokenBudget);
+	OutEnvContext = MoveTemp(Encoded.Text);
+	OutTokenEstimate = Encoded.TokenEstimate;
+	OutFlatTokenEstimate = Encoded.FlatTokenEstimate;
 	bOutInjected = true;
 	return true;
 }
@@ -1320,6 +1295,25 @@ static bool HCI_IsRetryableLlmFailure(const FString& FallbackReason)
 
 using FHCIPlannerAsyncCallback = TFunction<void(bool, FHCIAgentPlan, FString, FHCIAgentPlannerResultMetadata, FString)>;
 
+// One HTTP request inside an attempt: the primary model, or the hedge model fired after the p90 delay.
+struct FHCIAsyncLlmLeg
+{
+	TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> Request;
+	FString Model;
+	double StartSeconds = 0.0;
+	bool bHedge = false;
+	bool bResolved = false;
+};
+
+// One caller of an in-flight attempt. The first caller starts the attempt; identical requests join as extra waiters.
+struct FHCIAsyncPlanWaiter
+{
+	FString RequestId;
+	TSharedPtr<FHCIAgentExecutionCancellation> Cancellation;
+	FHCIPlannerAsyncCallback OnComplete;
+	bool bJoined = false;
+};
+
 struct FHCIAsyncPlanBuildState : public TSharedFromThis<FHCIAsyncPlanBuildState, ESPMode::ThreadSafe>
 {
 	FString UserText;
@@ -1335,15 +1329,25 @@ struct FHCIAsyncPlanBuildState : public TSharedFromThis<FHCIAsyncPlanBuildState,
 	bool bEnvContextPrepared = false;
 	bool bEnvContextInjected = false;
 	int32 EnvContextAssetCount = 0;
+	int32 EnvContextTokenEstimate = 0;
+	int32 EnvContextFlatTokenEstimate = 0;
 	FString EnvContextScanRoot;
 	FString EnvContextText;
-	TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> ActiveRequest;
+	FString RouterConfigPath;
+	TArray<FHCIAsyncLlmLeg> Legs;
+	bool bHedgeLaunched = false;
 	FTSTicker::FDelegateHandle TimeoutHandle;
+	FTSTicker::FDelegateHandle HedgeHandle;
+	FTSTicker::FDelegateHandle CancellationHandle;
 	TAtomic<bool> bAttemptResolved{false};
 	TAtomic<bool> bCompleted{false};
-	FHCIPlannerAsyncCallback OnComplete;
+	FString CoalesceKey;
+	TArray<FHCIAsyncPlanWaiter> Waiters;
+	int32 CoalescedCallerCount = 1;
 };
 
+static constexpr float HCI_AsyncCancellationPollSeconds = 0.1f;
+
 static TArray<TSharedRef<FHCIAsyncPlanBuildState, ESPMode::ThreadSafe>> GHCIPlannerAsyncInFlightStates;
 
 static void HCI_RegisterAsyncPlanBuildState(const TSharedRef<FHCIAsyncPlanBuildState, ESPMode::ThreadSafe>& State)
@@ -1363,6 +1367,134 @@ static void HCI_UnregisterAsyncPlanBuildState(const TSharedRef<FHCIAsyncPlanBuil
 	}
 }
 
+// Requests with the same key would send the same prompt to the same provider, so they share one attempt.
+// The user text is kept verbatim (normalized); env and provider settings are folded into digests.
+static FString HCI_MakeAsyncCoalesceKey(
+	const FString& UserText,
+	const FHCIToolRegistry& ToolRegistry,
+	const FHCIAgentPlannerBuildOptions& Options)
+{
+	const FString EnvContextText = FString::Printf(
+		TEXT("%d|%s|%d|%d|%s"),
+		Options.bEnableAutoEnvContextScan ? 1 : 0,
+		*Options.EnvContextDefaultScanRoot,
+		Options.EnvContextMaxAssetRows,
+		Options.EnvContextTokenBudget,
+		*Options.ExtraEnvContextText.TrimStartAndEnd());
+	const FString ProviderText = FString::Printf(
+		TEXT("%s|%s|%s|%s|%s|%s|%d|%d|%d|%d|%d|%d"),
+		*Options.LlmApiKeyConfigPath,
+		*Options.LlmApiUrl,
+		*Options.LlmModel,
+		*Options.PromptBundleRelativeDir,
+		*Options.PromptTemplateFileName,
+		*Options.PromptToolsSchemaFileName,
+		Options.LlmHttpTimeoutMs,
+		Options.LlmRetryCount,
+		Options.bLlmEnableThinking ? 1 : 0,
+		Options.bLlmStream ? 1 : 0,
+		Options.bLlmEnableHedging ? 1 : 0,
+		Options.bForceDirectoryScanFirst ? 1 : 0);
+	return FString::Printf(
+		TEXT("%08x|%08x|%llx|%s"),
+		FCrc::StrCrc32(*EnvContextText),
+		FCrc::StrCrc32(*ProviderText),
+		static_cast<uint64>(reinterpret_cast<UPTRINT>(&ToolRegistry)),
+		*UserText.TrimStartAndEnd().ToLower());
+}
+
+static TSharedPtr<FHCIAsyncPlanBuildState, ESPMode::ThreadSafe> HCI_FindCoalescableAsyncPlanBuildState(const FString& CoalesceKey)
+{
+	for (const TSharedRef<FHCIAsyncPlanBuildState, ESPMode::ThreadSafe>& State : GHCIPlannerAsyncInFlightStates)
+	{
+		if (!State->bCompleted.Load() && State->CoalesceKey.Equals(CoalesceKey, ESearchCase::CaseSensitive))
+		{
+			return State;
+		}
+	}
+	return nullptr;
+}
+
+static TSharedPtr<FJsonObject> HCI_CloneJsonObject(const TSharedPtr<FJsonObject>& Source)
+{
+	if (!Source.IsValid())
+	{
+		return nullptr;
+	}
+
+	FString JsonText;
+	const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+		TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&JsonText);
+	FJsonSerializer::Serialize(Source.ToSharedRef(), Writer);
+
+	TSharedPtr<FJsonObject> Clone;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonText);
+	if (!FJsonSerializer::Deserialize(Reader, Clone) || !Clone.IsValid())
+	{
+		return MakeShared<FJsonObject>(*Source);
+	}
+	return Clone;
+}
+
+// Joined callers get their own plan: their request id, and step args they can edit without touching the others.
+static FHCIAgentPlan HCI_ClonePlanForWaiter(const FHCIAgentPlan& Plan, const FString& RequestId)
+{
+	FHCIAgentPlan Clone = Plan;
+	Clone.RequestId = RequestId;
+	for (FHCIAgentPlanStep& Step : Clone.Steps)
+	{
+		Step.Args = HCI_CloneJsonObject(Step.Args);
+	}
+	return Clone;
+}
+
+static void HCI_ReportAsyncLegOutcome(
+	const FHCIAsyncPlanBuildState& State,
+	const FHCIAsyncLlmLeg& Leg,
+	const bool bSucceeded,
+	const bool bWonRace)
+{
+	FHCIAgentLlmModelOutcome Outcome;
+	Outcome.RouterConfigPath = State.RouterConfigPath;
+	Outcome.Model = Leg.Model;
+	Outcome.bSucceeded = bSucceeded;
+	Outcome.LatencyMs = (FPlatformTime::Seconds() - Leg.StartSeconds) * 1000.0;
+	Outcome.bHedgeLeg = Leg.bHedge;
+	Outcome.bWonRace = bWonRace;
+	FHCIAgentLlmClient::ReportModelOutcome(Outcome);
+}
+
+// Detaches every leg still on the wire. Unresolved legs are reported as failures so a model that
+// keeps losing to the timeout (or to its hedge) loses weight.
+static void HCI_CancelAsyncAttemptLegs(FHCIAsyncPlanBuildState& State, const bool bReportUnresolvedAsFailure)
+{
+	if (State.HedgeHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(State.HedgeHandle);
+		State.HedgeHandle.Reset();
+	}
+
+	for (FHCIAsyncLlmLeg& Leg : State.Legs)
+	{
+		if (Leg.bResolved)
+		{
+			continue;
+		}
+
+		Leg.bResolved = true;
+		if (bReportUnresolvedAsFailure)
+		{
+			HCI_ReportAsyncLegOutcome(State, Leg, false, false);
+		}
+		if (Leg.Request.IsValid())
+		{
+			Leg.Request->OnProcessRequestComplete().Unbind();
+			Leg.Request->CancelRequest();
+		}
+	}
+	State.Legs.Reset();
+}
+
 static void HCI_CompleteAsyncPlanBuild(
 	const TSharedRef<FHCIAsyncPlanBuildState, ESPMode::ThreadSafe>& State,
 	const bool bBuilt,
@@ -1384,16 +1516,137 @@ static void HCI_CompleteAsyncPlanBuild(
 		State->TimeoutHandle.Reset();
 	}
 
-	if (State->ActiveRequest.IsValid())
+	if (State->CancellationHandle.IsValid())
 	{
-		State->ActiveRequest->OnProcessRequestComplete().Unbind();
-		State->ActiveRequest.Reset();
+		FTSTicker::GetCoreTicker().RemoveTicker(State->CancellationHandle);
+		State->CancellationHandle.Reset();
 	}
 
-	if (State->OnComplete)
+	HCI_CancelAsyncAttemptLegs(State.Get(), false);
+
+	TArray<FHCIAsyncPlanWaiter> Waiters = MoveTemp(State->Waiters);
+	State->Waiters.Reset();
+	Waiters.RemoveAll([](const FHCIAsyncPlanWaiter& Waiter)
 	{
-		State->OnComplete(bBuilt, MoveTemp(Plan), MoveTemp(RouteReason), MoveTemp(Metadata), MoveTemp(Error));
+		return !Waiter.OnComplete || (Waiter.Cancellation.IsValid() && Waiter.Cancellation->IsRequested());
+	});
+
+	if (State->CoalescedCallerCount > 1)
+	{
+		UE_LOG(
+			LogHCIAgentPlanner,
+			Display,
+			TEXT("[HCI][LlmPlanner] coalesced_complete leader_request_id=%s callers=%d delivered=%d detached=%d built=%s"),
+			*State->RequestId,
+			State->CoalescedCallerCount,
+			Waiters.Num(),
+			State->CoalescedCallerCount - Waiters.Num(),
+			bBuilt ? TEXT("true") : TEXT("false"));
 	}
+
+	Metadata.LlmCoalescedCallerCount = State->CoalescedCallerCount;
+	for (int32 Index = 0; Index < Waiters.Num(); ++Index)
+	{
+		FHCIAsyncPlanWaiter& Waiter = Waiters[Index];
+		FHCIAgentPlannerResultMetadata WaiterMetadata = Metadata;
+		WaiterMetadata.bLlmRequestCoalesced = Waiter.bJoined;
+		if (Index == Waiters.Num() - 1)
+		{
+			if (bBuilt)
+			{
+				Plan.RequestId = Waiter.RequestId;
+			}
+			Waiter.OnComplete(bBuilt, MoveTemp(Plan), MoveTemp(RouteReason), MoveTemp(WaiterMetadata), MoveTemp(Error));
+		}
+		else
+		{
+			Waiter.OnComplete(bBuilt, bBuilt ? HCI_ClonePlanForWaiter(Plan, Waiter.RequestId) : FHCIAgentPlan(), RouteReason, MoveTemp(WaiterMetadata), Error);
+		}
+	}
+}
+
+// Drops callers whose cancellation was requested. Once nobody is left the attempt itself is abandoned:
+// legs are cancelled without being reported against the model, since nothing went wrong on its side.
+static void HCI_DetachCancelledAsyncWaiters(const TSharedRef<FHCIAsyncPlanBuildState, ESPMode::ThreadSafe>& State)
+{
+	const int32 Detached = State->Waiters.RemoveAll([](const FHCIAsyncPlanWaiter& Waiter)
+	{
+		return Waiter.Cancellation.IsValid() && Waiter.Cancellation->IsRequested();
+	});
+	if (Detached <= 0)
+	{
+		return;
+	}
+
+	UE_LOG(
+		LogHCIAgentPlanner,
+		Display,
+		TEXT("[HCI][LlmPlanner] callers_detached leader_request_id=%s detached=%d remaining=%d"),
+		*State->RequestId,
+		Detached,
+		State->Waiters.Num());
+
+	if (State->Waiters.Num() > 0 || State->bCompleted.Exchange(true))
+	{
+		return;
+	}
+
+	HCI_UnregisterAsyncPlanBuildState(State);
+	if (State->TimeoutHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(State->TimeoutHandle);
+		State->TimeoutHandle.Reset();
+	}
+	if (State->CancellationHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(State->CancellationHandle);
+		State->CancellationHandle.Reset();
+	}
+	HCI_CancelAsyncAttemptLegs(State.Get(), false);
+	UE_LOG(
+		LogHCIAgentPlanner,
+		Display,
+		TEXT("[HCI][LlmPlanner] attempt_abandoned leader_request_id=%s attempts=%d"),
+		*State->RequestId,
+		State->AttemptsUsed);
+}
+
+static void HCI_EnsureAsyncCancellationPoll(const TSharedRef<FHCIAsyncPlanBuildState, ESPMode::ThreadSafe>& State)
+{
+	if (State->CancellationHandle.IsValid())
+	{
+		return;
+	}
+
+	TWeakPtr<FHCIAsyncPlanBuildState, ESPMode::ThreadSafe> WeakState = State;
+	State->CancellationHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateLambda([WeakState](float DeltaSeconds)
+		{
+			const TSharedPtr<FHCIAsyncPlanBuildState, ESPMode::ThreadSafe> Pinned = WeakState.Pin();
+			if (!Pinned.IsValid() || Pinned->bCompleted.Load())
+			{
+				return false;
+			}
+
+			// Hand the handle back only if this ticker keeps running, so an abandon never removes the running ticker.
+			const FTSTicker::FDelegateHandle Handle = Pinned->CancellationHandle;
+			Pinned->CancellationHandle.Reset();
+			HCI_DetachCancelledAsyncWaiters(Pinned.ToSharedRef());
+			if (Pinned->bCompleted.Load())
+			{
+				return false;
+			}
+			const bool bAnyCancellable = Pinned->Waiters.ContainsByPredicate([](const FHCIAsyncPlanWaiter& Waiter)
+			{
+				return Waiter.Cancellation.IsValid();
+			});
+			if (bAnyCancellable)
+			{
+				Pinned->CancellationHandle = Handle;
+			}
+			return bAnyCancellable;
+		}),
+		HCI_AsyncCancellationPollSeconds);
 }
 
 static void HCI_FinishAsyncWithFailure(const TSharedRef<FHCIAsyncPlanBuildState, ESPMode::ThreadSafe>& State)
@@ -1406,17 +1659,325 @@ static void HCI_FinishAsyncWithFailure(const TSharedRef<FHCIAsyncPlanBuildState,
 	Metadata.ErrorCode = State->LastErrorCode;
 	Metadata.LlmAttemptCount = State->AttemptsUsed;
 	Metadata.bRetryUsed = State->AttemptsUsed > 1;
+	Metadata.bLlmHedgeLaunched = State->bHedgeLaunched;
 	Metadata.bEnvContextInjected = State->bEnvContextInjected;
 	Metadata.EnvContextAssetCount = State->EnvContextAssetCount;
 	Metadata.EnvContextScanRoot = State->EnvContextScanRoot;
+	Metadata.EnvContextTokenEstimate = State->EnvContextTokenEstimate;
+	Metadata.EnvContextFlatTokenEstimate = State->EnvContextFlatTokenEstimate;
 
 	HCI_CompleteAsyncPlanBuild(State, false, FHCIAgentPlan(), FString(), MoveTemp(Metadata), MoveTemp(State->LastError));
 }
 
+static bool HCI_TryBuildPlanFromAsyncHttpResponse(
+	const FHCIAsyncPlanBuildState& State,
+	const FHttpResponsePtr& HttpResponse,
+	const bool bSucceeded,
+	FHCIAgentPlan& OutPlan,
+	FString& OutRouteReason,
+	FString& OutFallbackReason,
+	FString& OutErrorCode,
+	FString& OutError)
+{
+	if (!bSucceeded || !HttpResponse.IsValid() || HttpResponse->GetResponseCode() < 200 || HttpResponse->GetResponseCode() >= 300)
+	{
+		OutFallbackReason = HCI_FallbackReasonHttpError;
+		OutErrorCode = TEXT("E4306");
+		OutError = HttpResponse.IsValid()
+			? FString::Printf(TEXT("llm_http_status_not_ok status=%d"), HttpResponse->GetResponseCode())
+			: TEXT("llm_http_request_failed_no_response");
+		return false;
+	}
+
+	FString Content;
+	FString LlmErrorCode;
+	FString LlmError;
+	if (!FHCIAgentLlmClient::TryExtractMessageContentFromResponse(HttpResponse->GetContentAsString(), Content, LlmErrorCode, LlmError))
+	{
+		OutErrorCode = LlmErrorCode.IsEmpty() ? TEXT("E4303") : LlmErrorCode;
+		OutError = LlmError;
+		if (OutErrorCode == TEXT("E4302"))
+		{
+			OutFallbackReason = HCI_FallbackReasonInvalidJson;
+		}
+		else if (OutErrorCode == TEXT("E4304"))
+		{
+			OutFallbackReason = HCI_FallbackReasonEmptyResponse;
+		}
+		else
+		{
+			OutFallbackReason = HCI_FallbackReasonContractInvalid;
+		}
+		return false;
+	}
+
+	FString LlmPlanJsonText;
+	if (!HCI_TryExtractJsonObjectString(Content, LlmPlanJsonText))
+	{
+		OutFallbackReason = HCI_FallbackReasonInvalidJson;
+		OutErrorCode = TEXT("E4302");
+		OutError = TEXT("llm_content_no_json_object");
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> LlmPlanObject;
+	{
+		const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(LlmPlanJsonText);
+		if (!FJsonSerializer::Deserialize(Reader, LlmPlanObject) || !LlmPlanObject.IsValid())
+		{
+			OutFallbackReason = HCI_FallbackReasonInvalidJson;
+			OutErrorCode = TEXT("E4302");
+			OutError = TEXT("llm_plan_invalid_json");
+			return false;
+		}
+	}
+
+	FString BuildError;
+	if (!HCI_TryBuildPlanFromLlmPlanJson(LlmPlanObject, State.RequestId, *State.ToolRegistry, OutPlan, OutRouteReason, BuildError) ||
+		!HCI_EnsureScanAssetsFirstForDirectoryIntent(
+			State.UserText,
+			*State.ToolRegistry,
+			State.Options.bForceDirectoryScanFirst,
+			OutPlan,
+			OutRouteReason,
+			BuildError))
+	{
+		OutFallbackReason = HCI_FallbackReasonContractInvalid;
+		OutErrorCode = TEXT("E4303");
+		OutError = BuildError;
+		return false;
+	}
+
+	bool bStepOrderReordered = false;
+	if (!HCI_ReorderPlanStepsByVariableDependencies(OutPlan, bStepOrderReordered, BuildError))
+	{
+		OutFallbackReason = HCI_FallbackReasonContractInvalid;
+		OutErrorCode = TEXT("E4303");
+		OutError = BuildError;
+		return false;
+	}
+	if (bStepOrderReordered && !OutRouteReason.Contains(TEXT("step_order_normalized")))
+	{
+		OutRouteReason = OutRouteReason.IsEmpty()
+			? TEXT("llm_step_order_normalized")
+			: OutRouteReason + TEXT("_step_order_normalized");
+	}
+	if (!HCI_ValidateBuiltPlanOrSetError(OutPlan, *State.ToolRegistry, BuildError))
+	{
+		OutFallbackReason = HCI_FallbackReasonContractInvalid;
+		OutErrorCode = TEXT("E4303");
+		OutError = BuildError;
+		return false;
+	}
+
+	HCI_TryOverrideLlmPlanWithKeywordMessageOnlyGuard(
+		State.UserText,
+		State.RequestId,
+		*State.ToolRegistry,
+		OutPlan,
+		OutRouteReason,
+		BuildError);
+	return true;
+}
+
+static void HCI_StartAsyncRealHttpAttempt(const TSharedRef<FHCIAsyncPlanBuildState, ESPMode::ThreadSafe>& State);
+
+static void HCI_RetryOrFinishAsyncAttempt(const TSharedRef<FHCIAsyncPlanBuildState, ESPMode::ThreadSafe>& State)
+{
+	if (State->TimeoutHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(State->TimeoutHandle);
+		State->TimeoutHandle.Reset();
+	}
+	HCI_CancelAsyncAttemptLegs(State.Get(), false);
+
+	if (State->AttemptsUsed < State->MaxAttempts && HCI_IsRetryableLlmFailure(State->LastFallbackReason))
+	{
+		HCI_StartAsyncRealHttpAttempt(State);
+		return;
+	}
+
+	HCI_FinishAsyncWithFailure(State);
+}
+
+static void HCI_OnAsyncLlmLegComplete(
+	const TWeakPtr<FHCIAsyncPlanBuildState, ESPMode::ThreadSafe>& WeakState,
+	const int32 AttemptIndex,
+	const int32 LegIndex,
+	const FHttpResponsePtr& HttpResponse,
+	const bool bSucceeded)
+{
+	const TSharedPtr<FHCIAsyncPlanBuildState, ESPMode::ThreadSafe> Pinned = WeakState.Pin();
+	if (!Pinned.IsValid() || Pinned->bCompleted.Load() || Pinned->bAttemptResolved.Load())
+	{
+		return;
+	}
+	if (AttemptIndex != Pinned->AttemptsUsed || !Pinned->Legs.IsValidIndex(LegIndex) || Pinned->Legs[LegIndex].bResolved)
+	{
+		return;
+	}
+
+	FHCIAsyncLlmLeg& Leg = Pinned->Legs[LegIndex];
+	Leg.bResolved = true;
+
+	FHCIAgentPlan Plan;
+	FString RouteReason;
+	FString FallbackReason;
+	FString ErrorCode;
+	FString Error;
+	const bool bBuilt = HCI_TryBuildPlanFromAsyncHttpResponse(
+		*Pinned,
+		HttpResponse,
+		bSucceeded,
+		Plan,
+		RouteReason,
+		FallbackReason,
+		ErrorCode,
+		Error);
+	HCI_ReportAsyncLegOutcome(*Pinned, Leg, bBuilt, bBuilt && Leg.bHedge);
+
+	if (bBuilt)
+	{
+		Pinned->bAttemptResolved.Store(true);
+
+		FHCIAgentPlannerResultMetadata Metadata;
+		Metadata.PlannerProvider = HCI_LlmProviderName;
+		Metadata.ProviderMode = Pinned->ProviderMode;
+		Metadata.bFallbackUsed = false;
+		Metadata.FallbackReason = HCI_FallbackReasonNone;
+		Metadata.ErrorCode = TEXT("-");
+		Metadata.LlmAttemptCount = Pinned->AttemptsUsed;
+		Metadata.bRetryUsed = Pinned->AttemptsUsed > 1;
+		Metadata.bCircuitBreakerOpen = false;
+		Metadata.ConsecutiveLlmFailures = 0;
+		Metadata.LlmModel = Leg.Model;
+		Metadata.bLlmHedgeLaunched = Pinned->bHedgeLaunched;
+		Metadata.bLlmHedgeWon = Leg.bHedge;
+		Metadata.bEnvContextInjected = Pinned->bEnvContextInjected;
+		Metadata.EnvContextAssetCount = Pinned->EnvContextAssetCount;
+		Metadata.EnvContextScanRoot = Pinned->EnvContextScanRoot;
+		Metadata.EnvContextTokenEstimate = Pinned->EnvContextTokenEstimate;
+		Metadata.EnvContextFlatTokenEstimate = Pinned->EnvContextFlatTokenEstimate;
+
+		HCI_CompleteAsyncPlanBuild(Pinned.ToSharedRef(), true, MoveTemp(Plan), MoveTemp(RouteReason), MoveTemp(Metadata), FString());
+		return;
+	}
+
+	Pinned->LastFallbackReason = FallbackReason;
+	Pinned->LastErrorCode = ErrorCode;
+	Pinned->LastError = Error;
+
+	// The other leg may still produce a valid plan; only give up on the attempt once every leg failed.
+	const bool bOtherLegPending = Pinned->Legs.ContainsByPredicate([](const FHCIAsyncLlmLeg& Candidate)
+	{
+		return !Candidate.bResolved;
+	});
+	if (bOtherLegPending)
+	{
+		return;
+	}
+
+	// Invalid plans from every leg are final; only transport-level failures are retried.
+	Pinned->bAttemptResolved.Store(true);
+	HCI_RetryOrFinishAsyncAttempt(Pinned.ToSharedRef());
+}
+
+static bool HCI_LaunchAsyncLlmLeg(
+	const TSharedRef<FHCIAsyncPlanBuildState, ESPMode::ThreadSafe>& State,
+	const FHCIAgentLlmProviderConfig& ProviderConfig,
+	const FString& RequestBody,
+	const bool bHedge)
+{
+	TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> Request = FHCIAgentLlmClient::CreateChatCompletionsHttpRequest(ProviderConfig, RequestBody);
+	if (!Request.IsValid())
+	{
+		return false;
+	}
+
+	const int32 LegIndex = State->Legs.Num();
+	FHCIAsyncLlmLeg& Leg = State->Legs.AddDefaulted_GetRef();
+	Leg.Request = Request;
+	Leg.Model = ProviderConfig.Model;
+	Leg.StartSeconds = FPlatformTime::Seconds();
+	Leg.bHedge = bHedge;
+
+	TWeakPtr<FHCIAsyncPlanBuildState, ESPMode::ThreadSafe> WeakState = State;
+	const int32 AttemptIndex = State->AttemptsUsed;
+	Request->OnProcessRequestComplete().BindLambda(
+		[WeakState, AttemptIndex, LegIndex](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded)
+		{
+			HCI_OnAsyncLlmLegComplete(WeakState, AttemptIndex, LegIndex, HttpResponse, bSucceeded);
+		});
+
+	if (!Request->ProcessRequest())
+	{
+		Request->OnProcessRequestComplete().Unbind();
+		State->Legs.RemoveAt(LegIndex);
+		return false;
+	}
+
+	return true;
+}
+
+static void HCI_ScheduleAsyncHedgeLeg(
+	const TSharedRef<FHCIAsyncPlanBuildState, ESPMode::ThreadSafe>& State,
+	const FHCIAgentLlmProviderConfig& PrimaryConfig,
+	const FString& SystemPrompt)
+{
+	if (!PrimaryConfig.bHedgeEnabled ||
+		PrimaryConfig.HedgeModel.IsEmpty() ||
+		PrimaryConfig.HedgeModel.Equals(PrimaryConfig.Model, ESearchCase::CaseSensitive) ||
+		PrimaryConfig.HedgeDelayMs >= State->Options.LlmHttpTimeoutMs)
+	{
+		return;
+	}
+
+	FHCIAgentLlmProviderConfig HedgeConfig = PrimaryConfig;
+	HedgeConfig.Model = PrimaryConfig.HedgeModel;
+	HedgeConfig.ApiUrl = PrimaryConfig.HedgeApiUrl.IsEmpty() ? PrimaryConfig.ApiUrl : PrimaryConfig.HedgeApiUrl;
+
+	FString HedgeRequestBody;
+	FString HedgeBodyError;
+	if (!FHCIAgentLlmClient::BuildChatCompletionsRequestBody(SystemPrompt, State->UserText, HedgeConfig, HedgeRequestBody, HedgeBodyError))
+	{
+		return;
+	}
+
+	TWeakPtr<FHCIAsyncPlanBuildState, ESPMode::ThreadSafe> WeakState = State;
+	const int32 AttemptIndex = State->AttemptsUsed;
+	const float HedgeDelaySeconds = FMath::Max(0.0f, static_cast<float>(PrimaryConfig.HedgeDelayMs) / 1000.0f);
+	State->HedgeHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateLambda([WeakState, AttemptIndex, HedgeConfig, HedgeRequestBody](float DeltaSeconds)
+		{
+			const TSharedPtr<FHCIAsyncPlanBuildState, ESPMode::ThreadSafe> Pinned = WeakState.Pin();
+			if (!Pinned.IsValid() || Pinned->bCompleted.Load() || Pinned->bAttemptResolved.Load() || Pinned->AttemptsUsed != AttemptIndex)
+			{
+				return false;
+			}
+
+			Pinned->HedgeHandle.Reset();
+			if (HCI_LaunchAsyncLlmLeg(Pinned.ToSharedRef(), HedgeConfig, HedgeRequestBody, true))
+			{
+				Pinned->bHedgeLaunched = true;
+				UE_LOG(
+					LogHCIAgentPlanner,
+					Display,
+					TEXT("[HCI][LlmRouter] hedge_launched request_id=%s attempt=%d hedge_model=%s delay_ms=%d"),
+					*Pinned->RequestId,
+					AttemptIndex,
+					*HedgeConfig.Model,
+					HedgeConfig.HedgeDelayMs);
+			}
+			return false;
+		}),
+		HedgeDelaySeconds);
+}
+
 static void HCI_StartAsyncRealHttpAttempt(const TSharedRef<FHCIAsyncPlanBuildState, ESPMode::ThreadSafe>& State)
 {
 	State->AttemptsUsed += 1;
 	State->bAttemptResolved.Store(false);
+	State->Legs.Reset();
 
 	FHCIAgentLlmProviderConfig ProviderConfig;
 	FString ConfigError;
@@ -1436,6 +1997,8 @@ static void HCI_StartAsyncRealHttpAttempt(const TSharedRef<FHCIAsyncPlanBuildSta
 	ProviderConfig.bEnableThinking = State->Options.bLlmEnableThinking;
 	ProviderConfig.bStream = State->Options.bLlmStream;
 	ProviderConfig.HttpTimeoutMs = State->Options.LlmHttpTimeoutMs;
+	ProviderConfig.bHedgeEnabled = ProviderConfig.bHedgeEnabled && State->Options.bLlmEnableHedging;
+	State->RouterConfigPath = ProviderConfig.RouterConfigPath;
 
 	if (!State->bEnvContextPrepared)
 	{
@@ -1446,6 +2009,8 @@ static void HCI_StartAsyncRealHttpAttempt(const TSharedRef<FHCIAsyncPlanBuildSta
 			State->EnvContextScanRoot,
 			State->EnvContextText,
 			State->EnvContextAssetCount,
+			State->EnvContextTokenEstimate,
+			State->EnvContextFlatTokenEstimate,
 			State->bEnvContextInjected);
 
 		const FString Extra = State->Options.ExtraEnvContextText.TrimStartAndEnd();
@@ -1487,174 +2052,7 @@ static void HCI_StartAsyncRealHttpAttempt(const TSharedRef<FHCIAsyncPlanBuildSta
 		return;
 	}
 
-	State->ActiveRequest = FHCIAgentLlmClient::CreateChatCompletionsHttpRequest(ProviderConfig, RequestBody);
-	if (!State->ActiveRequest.IsValid())
-	{
-		State->LastFallbackReason = HCI_FallbackReasonHttpError;
-		State->LastErrorCode = TEXT("E4306");
-		State->LastError = TEXT("llm_http_create_request_failed");
-		HCI_FinishAsyncWithFailure(State);
-		return;
-	}
-
-	TWeakPtr<FHCIAsyncPlanBuildState, ESPMode::ThreadSafe> WeakState = State;
-	State->ActiveRequest->OnProcessRequestComplete().BindLambda(
-		[WeakState](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded)
-		{
-			const TSharedPtr<FHCIAsyncPlanBuildState, ESPMode::ThreadSafe> Pinned = WeakState.Pin();
-			if (!Pinned.IsValid() || Pinned->bCompleted.Load())
-			{
-				return;
-			}
-			if (Pinned->bAttemptResolved.Exchange(true))
-			{
-				return;
-			}
-
-			if (Pinned->TimeoutHandle.IsValid())
-			{
-				FTSTicker::GetCoreTicker().RemoveTicker(Pinned->TimeoutHandle);
-				Pinned->TimeoutHandle.Reset();
-			}
-
-			if (!bSucceeded || !HttpResponse.IsValid() || HttpResponse->GetResponseCode() < 200 || HttpResponse->GetResponseCode() >= 300)
-			{
-				Pinned->LastFallbackReason = HCI_FallbackReasonHttpError;
-				Pinned->LastErrorCode = TEXT("E4306");
-				Pinned->LastError = HttpResponse.IsValid()
-					? FString::Printf(TEXT("llm_http_status_not_ok status=%d"), HttpResponse->GetResponseCode())
-					: TEXT("llm_http_request_failed_no_response");
-
-				if (Pinned->AttemptsUsed < Pinned->MaxAttempts && HCI_IsRetryableLlmFailure(Pinned->LastFallbackReason))
-				{
-					HCI_StartAsyncRealHttpAttempt(Pinned.ToSharedRef());
-					return;
-				}
-
-				HCI_FinishAsyncWithFailure(Pinned.ToSharedRef());
-				return;
-			}
-
-				FString Content;
-				FString LlmErrorCode;
-				FString LlmError;
-				if (!FHCIAgentLlmClient::TryExtractMessageContentFromResponse(HttpResponse->GetContentAsString(), Content, LlmErrorCode, LlmError))
-				{
-					Pinned->LastErrorCode = LlmErrorCode.IsEmpty() ? TEXT("E4303") : LlmErrorCode;
-					Pinned->LastError = LlmError;
-					if (Pinned->LastErrorCode == TEXT("E4302"))
-					{
-						Pinned->LastFallbackReason = HCI_FallbackReasonInvalidJson;
-					}
-					else if (Pinned->LastErrorCode == TEXT("E4304"))
-					{
-						Pinned->LastFallbackReason = HCI_FallbackReasonEmptyResponse;
-					}
-					else
-					{
-						Pinned->LastFallbackReason = HCI_FallbackReasonContractInvalid;
-					}
-					HCI_FinishAsyncWithFailure(Pinned.ToSharedRef());
-					return;
-				}
-
-			FString LlmPlanJsonText;
-			if (!HCI_TryExtractJsonObjectString(Content, LlmPlanJsonText))
-			{
-				Pinned->LastFallbackReason = HCI_FallbackReasonInvalidJson;
-				Pinned->LastErrorCode = TEXT("E4302");
-				Pinned->LastError = TEXT("llm_content_no_json_object");
-				HCI_FinishAsyncWithFailure(Pinned.ToSharedRef());
-				return;
-			}
-
-			TSharedPtr<FJsonObject> LlmPlanObject;
-			{
-				const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(LlmPlanJsonText);
-				if (!FJsonSerializer::Deserialize(Reader, LlmPlanObject) || !LlmPlanObject.IsValid())
-				{
-					Pinned->LastFallbackReason = HCI_FallbackReasonInvalidJson;
-					Pinned->LastErrorCode = TEXT("E4302");
-					Pinned->LastError = TEXT("llm_plan_invalid_json");
-					HCI_FinishAsyncWithFailure(Pinned.ToSharedRef());
-					return;
-				}
-			}
-
-			FHCIAgentPlan Plan;
-			FString RouteReason;
-			FString BuildError;
-				if (!HCI_TryBuildPlanFromLlmPlanJson(LlmPlanObject, Pinned->RequestId, *Pinned->ToolRegistry, Plan, RouteReason, BuildError))
-				{
-					Pinned->LastFallbackReason = HCI_FallbackReasonContractInvalid;
-					Pinned->LastErrorCode = TEXT("E4303");
-					Pinned->LastError = BuildError;
-					HCI_FinishAsyncWithFailure(Pinned.ToSharedRef());
-					return;
-				}
-					if (!HCI_EnsureScanAssetsFirstForDirectoryIntent(
-							Pinned->UserText,
-							*Pinned->ToolRegistry,
-							Pinned->Options.bForceDirectoryScanFirst,
-							Plan,
-							RouteReason,
-							BuildError))
-					{
-						Pinned->LastFallbackReason = HCI_FallbackReasonContractInvalid;
-						Pinned->LastErrorCode = TEXT("E4303");
-						Pinned->LastError = BuildError;
-						HCI_FinishAsyncWithFailure(Pinned.ToSharedRef());
-						return;
-					}
-					bool bStepOrderReordered = false;
-					if (!HCI_ReorderPlanStepsByVariableDependencies(Plan, bStepOrderReordered, BuildError))
-					{
-						Pinned->LastFallbackReason = HCI_FallbackReasonContractInvalid;
-						Pinned->LastErrorCode = TEXT("E4303");
-						Pinned->LastError = BuildError;
-						HCI_FinishAsyncWithFailure(Pinned.ToSharedRef());
-						return;
-					}
-					if (bStepOrderReordered && !RouteReason.Contains(TEXT("step_order_normalized")))
-					{
-						RouteReason = RouteReason.IsEmpty()
-							? TEXT("llm_step_order_normalized")
-							: RouteReason + TEXT("_step_order_normalized");
-					}
-					if (!HCI_ValidateBuiltPlanOrSetError(Plan, *Pinned->ToolRegistry, BuildError))
-					{
-						Pinned->LastFallbackReason = HCI_FallbackReasonContractInvalid;
-						Pinned->LastErrorCode = TEXT("E4303");
-					Pinned->LastError = BuildError;
-					HCI_FinishAsyncWithFailure(Pinned.ToSharedRef());
-					return;
-				}
-				HCI_TryOverrideLlmPlanWithKeywordMessageOnlyGuard(
-					Pinned->UserText,
-					Pinned->RequestId,
-					*Pinned->ToolRegistry,
-					Plan,
-					RouteReason,
-					BuildError);
-
-			FHCIAgentPlannerResultMetadata Metadata;
-			Metadata.PlannerProvider = HCI_LlmProviderName;
-			Metadata.ProviderMode = Pinned->ProviderMode;
-			Metadata.bFallbackUsed = false;
-			Metadata.FallbackReason = HCI_FallbackReasonNone;
-			Metadata.ErrorCode = TEXT("-");
-				Metadata.LlmAttemptCount = Pinned->AttemptsUsed;
-				Metadata.bRetryUsed = Pinned->AttemptsUsed > 1;
-				Metadata.bCircuitBreakerOpen = false;
-				Metadata.ConsecutiveLlmFailures = 0;
-				Metadata.bEnvContextInjected = Pinned->bEnvContextInjected;
-				Metadata.EnvContextAssetCount = Pinned->EnvContextAssetCount;
-				Metadata.EnvContextScanRoot = Pinned->EnvContextScanRoot;
-
-			HCI_CompleteAsyncPlanBuild(Pinned.ToSharedRef(), true, MoveTemp(Plan), MoveTemp(RouteReason), MoveTemp(Metadata), FString());
-		});
-
-	if (!State->ActiveRequest->ProcessRequest())
+	if (!HCI_LaunchAsyncLlmLeg(State, ProviderConfig, RequestBody, false))
 	{
 		State->LastFallbackReason = HCI_FallbackReasonHttpError;
 		State->LastErrorCode = TEXT("E4306");
@@ -1663,6 +2061,9 @@ static void HCI_StartAsyncRealHttpAttempt(const TSharedRef<FHCIAsyncPlanBuildSta
 		return;
 	}
 
+	HCI_ScheduleAsyncHedgeLeg(State, ProviderConfig, SystemPrompt);
+
+	TWeakPtr<FHCIAsyncPlanBuildState, ESPMode::ThreadSafe> WeakState = State;
 	const float TimeoutSeconds = FMath::Max(1.0f, static_cast<float>(State->Options.LlmHttpTimeoutMs) / 1000.0f);
 	State->TimeoutHandle = FTSTicker::GetCoreTicker().AddTicker(
 		FTickerDelegate::CreateLambda([WeakState](float DeltaSeconds)
@@ -1677,24 +2078,13 @@ static void HCI_StartAsyncRealHttpAttempt(const TSharedRef<FHCIAsyncPlanBuildSta
 				return false;
 			}
 
-			if (Pinned->ActiveRequest.IsValid())
-			{
-				Pinned->ActiveRequest->OnProcessRequestComplete().Unbind();
-				Pinned->ActiveRequest->CancelRequest();
-			}
 			Pinned->TimeoutHandle.Reset();
+			HCI_CancelAsyncAttemptLegs(*Pinned, true);
 			Pinned->LastFallbackReason = HCI_FallbackReasonTimeout;
 			Pinned->LastErrorCode = TEXT("E4301");
 			Pinned->LastError = TEXT("llm_request_timeout");
 
-			if (Pinned->AttemptsUsed < Pinned->MaxAttempts && HCI_IsRetryableLlmFailure(Pinned->LastFallbackReason))
-			{
-				HCI_StartAsyncRealHttpAttempt(Pinned.ToSharedRef());
-			}
-			else
-			{
-				HCI_FinishAsyncWithFailure(Pinned.ToSharedRef());
-			}
+			HCI_RetryOrFinishAsyncAttempt(Pinned.ToSharedRef());
 			return false;
 		}),
 		TimeoutSeconds);
@@ -1823,17 +2213,50 @@ void FHCILlmPlannerProvider::BuildPlanAsync(
 		return;
 	}
 
+	FHCIAsyncPlanWaiter Waiter;
+	Waiter.RequestId = RequestId;
+	Waiter.Cancellation = Options.Cancellation;
+	Waiter.OnComplete = MoveTemp(OnComplete);
+
+	const FString CoalesceKey = HCI_MakeAsyncCoalesceKey(UserText, ToolRegistry, Options);
+	if (const TSharedPtr<FHCIAsyncPlanBuildState, ESPMode::ThreadSafe> InFlight = HCI_FindCoalescableAsyncPlanBuildState(CoalesceKey))
+	{
+		Waiter.bJoined = true;
+		InFlight->Waiters.Add(MoveTemp(Waiter));
+		InFlight->CoalescedCallerCount += 1;
+		UE_LOG(
+			LogHCIAgentPlanner,
+			Display,
+			TEXT("[HCI][LlmPlanner] coalesced request_id=%s leader_request_id=%s waiters=%d callers=%d"),
+			*RequestId,
+			*InFlight->RequestId,
+			InFlight->Waiters.Num(),
+			InFlight->CoalescedCallerCount);
+		if (Options.Cancellation.IsValid())
+		{
+			HCI_EnsureAsyncCancellationPoll(InFlight.ToSharedRef());
+		}
+		return;
+	}
+
 	TSharedRef<FHCIAsyncPlanBuildState, ESPMode::ThreadSafe> State =
 		MakeShared<FHCIAsyncPlanBuildState, ESPMode::ThreadSafe>();
 	State->UserText = UserText;
 	State->RequestId = RequestId;
 	State->ToolRegistry = &ToolRegistry;
 	State->Options = Options;
+	// Cancellation is per caller (see FHCIAsyncPlanWaiter), never a property of the shared attempt.
+	State->Options.Cancellation.Reset();
 	State->ProviderMode = TEXT("real_http");
 	State->MaxAttempts = 1 + FMath::Max(0, Options.LlmRetryCount);
-	State->OnComplete = MoveTemp(OnComplete);
+	State->CoalesceKey = CoalesceKey;
+	State->Waiters.Add(MoveTemp(Waiter));
 
 	HCI_RegisterAsyncPlanBuildState(State);
+	if (Options.Cancellation.IsValid())
+	{
+		HCI_EnsureAsyncCancellationPoll(State);
+	}
 	HCI_StartAsyncRealHttpAttempt(State);
 }
 
@@ -359,6 +359,8 @@ public:
 		OutMetadata.bEnvContextInjected = LlmMetadata.bEnvContextInjected;
 		OutMetadata.EnvContextAssetCount = LlmMetadata.EnvContextAssetCount;
 		OutMetadata.EnvContextScanRoot = LlmMetadata.EnvContextScanRoot;
+		OutMetadata.EnvContextTokenEstimate = LlmMetadata.EnvContextTokenEstimate;
+		OutMetadata.EnvContextFlatTokenEstimate = LlmMetadata.EnvContextFlatTokenEstimate;
 		return true;
 	}
 
@@ -506,6 +508,8 @@ public:
 					Metadata.bEnvContextInjected = LlmMetadata.bEnvContextInjected;
 					Metadata.EnvContextAssetCount = LlmMetadata.EnvContextAssetCount;
 					Metadata.EnvContextScanRoot = LlmMetadata.EnvContextScanRoot;
+					Metadata.EnvContextTokenEstimate = LlmMetadata.EnvContextTokenEstimate;
+					Metadata.EnvContextFlatTokenEstimate = LlmMetadata.EnvContextFlatTokenEstimate;
 					OnComplete(false, FHCIAgentPlan(), FString(), MoveTemp(Metadata), MoveTemp(KeywordError));
 					return;
 				}
@@ -523,6 +527,8 @@ public:
 				Metadata.bEnvContextInjected = LlmMetadata.bEnvContextInjected;
 				Metadata.EnvContextAssetCount = LlmMetadata.EnvContextAssetCount;
 				Metadata.EnvContextScanRoot = LlmMetadata.EnvContextScanRoot;
+				Metadata.EnvContextTokenEstimate = LlmMetadata.EnvContextTokenEstimate;
+				Metadata.EnvContextFlatTokenEstimate = LlmMetadata.EnvContextFlatTokenEstimate;
 
 				OnComplete(true, MoveTemp(KeywordPlan), MoveTemp(KeywordRouteReason), MoveTemp(Metadata), FString());
 			});
@@ -177,6 +177,24 @@ void FHCIToolRegistry::ResetToDefaults()
 		FHCIToolArgSchema ActorNamesArg = MakeStringArrayArg(TEXT("actor_names"), 1, 50);
 		ActorNamesArg.bRequired = false;
 		Tool.ArgsSchema.Add(MoveTemp(ActorNamesArg));
+
+		// World Partition maps: "chunked" also scans unloaded actors in bounded load/scan/unload batches.
+		FHCIToolArgSchema PartitionModeArg = MakeStringArg(TEXT("partition_mode"));
+		PartitionModeArg.bRequired = false;
+		PartitionModeArg.AllowedStringValues = {TEXT("loaded_only"), TEXT("chunked")};
+		Tool.ArgsSchema.Add(MoveTemp(PartitionModeArg));
+
+		FHCIToolArgSchema BatchSizeArg = MakeIntArg(TEXT("wp_batch_size"));
+		BatchSizeArg.bRequired = false;
+		BatchSizeArg.MinIntValue = 16;
+		BatchSizeArg.MaxIntValue = 2048;
+		Tool.ArgsSchema.Add(MoveTemp(BatchSizeArg));
+
+		FHCIToolArgSchema MemoryCeilingArg = MakeIntArg(TEXT("memory_ceiling_mb"));
+		MemoryCeilingArg.bRequired = false;
+		MemoryCeilingArg.MinIntValue = 1024;
+		MemoryCeilingArg.MaxIntValue = 262144;
+		Tool.ArgsSchema.Add(MoveTemp(MemoryCeilingArg));
 		RegisterDefault(MoveTemp(Tool));
 	}
 
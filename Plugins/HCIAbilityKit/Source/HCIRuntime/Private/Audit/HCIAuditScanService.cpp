@@ -4,6 +4,7 @@
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Audit/HCIAuditTagNames.h"
 #include "Common/HCITimeFormat.h"
+#include "Common/HCITrace.h"
 #include "HAL/FileManager.h"
 #include "HCIAsset.h"
 #include "Misc/PackageName.h"
@@ -12,6 +13,8 @@
 #include "UObject/SoftObjectPath.h"
 #include "UObject/UObjectGlobals.h"
 
+TRACE_DECLARE_INT_COUNTER(HCIAuditScannedAssetCount, TEXT("HCI/Audit/ScannedAssets"));
+
 namespace
 {
 void TryFillGenericAssetSignalsFromTags(const FAssetData& AssetData, FHCIAuditAssetRow& OutRow)
@@ -214,6 +217,7 @@ FHCIAuditScanService& FHCIAuditScanService::Get()
 
 FHCIAuditScanSnapshot FHCIAuditScanService::ScanFromAssetRegistry() const
 {
+	HCI_TRACE_SCOPE(TEXT("HCI.Audit.ScanFromAssetRegistry"));
 	const double StartTime = FPlatformTime::Seconds();
 	FHCIAuditScanSnapshot Snapshot;
 	Snapshot.Stats.Source = TEXT("asset_registry_fassetdata");
@@ -282,6 +286,7 @@ FHCIAuditScanSnapshot FHCIAuditScanService::ScanFromAssetRegistry() const
 	Snapshot.Stats.AssetCount = Snapshot.Rows.Num();
 	Snapshot.Stats.UpdatedUtc = FDateTime::UtcNow();
 	Snapshot.Stats.DurationMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	TRACE_COUNTER_SET(HCIAuditScannedAssetCount, Snapshot.Rows.Num());
 	return Snapshot;
 }
 
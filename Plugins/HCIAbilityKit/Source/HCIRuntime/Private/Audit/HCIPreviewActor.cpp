@@ -1,9 +1,9 @@
 #include "Audit/HCIPreviewActor.h"
 
+#include "Audit/HCIPreviewRegistrySubsystem.h"
 #include "Components/StaticMeshComponent.h"
 #include "Engine/StaticMesh.h"
 #include "HCIAsset.h"
-#include "UObject/UObjectGlobals.h"
 
 AHCIPreviewActor::AHCIPreviewActor()
 {
@@ -17,77 +17,37 @@ AHCIPreviewActor::AHCIPreviewActor()
 void AHCIPreviewActor::OnConstruction(const FTransform& Transform)
 {
 	Super::OnConstruction(Transform);
-#if WITH_EDITOR
-	RebindObservedAbilityAsset();
-#endif
 	ApplyPreviewMesh();
 }
 
 void AHCIPreviewActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-#if WITH_EDITOR
-	if (ObservedAssetPropertyChangedHandle.IsValid())
+	if (UHCIPreviewRegistrySubsystem* Registry = UHCIPreviewRegistrySubsystem::Get())
 	{
-		FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObservedAssetPropertyChangedHandle);
-		ObservedAssetPropertyChangedHandle.Reset();
+		Registry->UnregisterActor(this);
 	}
-#endif
 	Super::EndPlay(EndPlayReason);
 }
 
-void AHCIPreviewActor::RefreshPreview()
+void AHCIPreviewActor::Destroyed()
 {
-	ApplyPreviewMesh();
-}
-
-#if WITH_EDITOR
-void AHCIPreviewActor::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
-{
-	Super::PostEditChangeProperty(PropertyChangedEvent);
-
-	const FName ChangedPropertyName = PropertyChangedEvent.GetPropertyName();
-	if (ChangedPropertyName == GET_MEMBER_NAME_CHECKED(AHCIPreviewActor, AbilityAsset))
+	if (UHCIPreviewRegistrySubsystem* Registry = UHCIPreviewRegistrySubsystem::Get())
 	{
-		RebindObservedAbilityAsset();
+		Registry->UnregisterActor(this);
 	}
-
-	ApplyPreviewMesh();
+	Super::Destroyed();
 }
 
-void AHCIPreviewActor::RebindObservedAbilityAsset()
+void AHCIPreviewActor::RefreshPreview()
 {
-	if (ObservedAssetPropertyChangedHandle.IsValid())
-	{
-		FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObservedAssetPropertyChangedHandle);
-		ObservedAssetPropertyChangedHandle.Reset();
-	}
-
-	ObservedAbilityAsset = AbilityAsset;
-	if (ObservedAbilityAsset.IsValid())
-	{
-		ObservedAssetPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddUObject(
-			this,
-			&AHCIPreviewActor::HandleObservedObjectPropertyChanged);
-	}
+	ApplyPreviewMesh();
 }
 
-void AHCIPreviewActor::HandleObservedObjectPropertyChanged(
-	UObject* ChangedObject,
-	FPropertyChangedEvent& PropertyChangedEvent)
+#if WITH_EDITOR
+void AHCIPreviewActor::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
-	if (ChangedObject != ObservedAbilityAsset.Get())
-	{
-		return;
-	}
-
-	const FProperty* ChangedProperty = PropertyChangedEvent.Property
-		? PropertyChangedEvent.Property
-		: PropertyChangedEvent.MemberProperty;
-	if (ChangedProperty && ChangedProperty->GetFName() != GET_MEMBER_NAME_CHECKED(UHCIAsset, RepresentingMesh))
-	{
-		return;
-	}
-
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	// Re-keys the registry entry when AbilityAsset changed.
 	ApplyPreviewMesh();
 }
 #endif
@@ -99,6 +59,14 @@ void AHCIPreviewActor::ApplyPreviewMesh()
 		return;
 	}
 
+	if (UHCIPreviewRegistrySubsystem* Registry = UHCIPreviewRegistrySubsystem::Get())
+	{
+		if (!HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject) && Registry->RegisterActor(this))
+		{
+			return;
+		}
+	}
+
 	UStaticMesh* PreviewMesh = nullptr;
 	if (AbilityAsset && !AbilityAsset->RepresentingMesh.IsNull())
 	{
@@ -107,4 +75,3 @@ void AHCIPreviewActor::ApplyPreviewMesh()
 
 	PreviewMeshComponent->SetStaticMesh(PreviewMesh);
 }
-
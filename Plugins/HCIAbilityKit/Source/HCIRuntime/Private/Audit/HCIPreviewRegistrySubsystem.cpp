@@ -0,0 +1,519 @@
+#include "Audit/HCIPreviewRegistrySubsystem.h"
+
+#include "Audit/HCIPreviewActor.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/SceneComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "HCIAsset.h"
+#include "UObject/UObjectGlobals.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogHCIPreviewRegistry, Log, All);
+
+namespace
+{
+static TAutoConsoleVariable<int32> CVarHCIPreviewInstancedThreshold(
+	TEXT("HCI.Preview.InstancedThreshold"),
+	0,
+	TEXT("Worlds with at least this many AHCIPreviewActors draw previews through one ISM component per mesh. 0 disables instancing."),
+	ECVF_Default);
+
+static bool HCI_ShouldInstanceWorld(const int32 ActorCount)
+{
+	const int32 Threshold = CVarHCIPreviewInstancedThreshold.GetValueOnGameThread();
+	return Threshold > 0 && ActorCount >= Threshold;
+}
+
+// Same worlds the reimport refresh used to sweep; game and inactive worlds are left alone.
+static bool HCI_IsTrackedWorld(const UWorld* World)
+{
+	return World
+		&& (World->WorldType == EWorldType::Editor
+			|| World->WorldType == EWorldType::EditorPreview
+			|| World->WorldType == EWorldType::PIE);
+}
+
+static TSoftObjectPtr<UStaticMesh> HCI_GetRepresentingMesh(const AHCIPreviewActor* Actor)
+{
+	return (Actor && Actor->AbilityAsset) ? Actor->AbilityAsset->RepresentingMesh : TSoftObjectPtr<UStaticMesh>();
+}
+} // namespace
+
+UHCIPreviewRegistrySubsystem* UHCIPreviewRegistrySubsystem::Get()
+{
+	return GEngine ? GEngine->GetEngineSubsystem<UHCIPreviewRegistrySubsystem>() : nullptr;
+}
+
+void UHCIPreviewRegistrySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+#if WITH_EDITOR
+	PropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddUObject(this, &UHCIPreviewRegistrySubsystem::HandleObjectPropertyChanged);
+#endif
+	WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddUObject(this, &UHCIPreviewRegistrySubsystem::HandleWorldCleanup);
+}
+
+void UHCIPreviewRegistrySubsystem::Deinitialize()
+{
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(PropertyChangedHandle);
+	PropertyChangedHandle.Reset();
+#endif
+	FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+	WorldCleanupHandle.Reset();
+	if (FlushTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(FlushTickerHandle);
+		FlushTickerHandle.Reset();
+	}
+	for (TPair<FSoftObjectPath, TSharedPtr<FStreamableHandle>>& Pair : InFlightLoads)
+	{
+		if (Pair.Value.IsValid())
+		{
+			Pair.Value->CancelHandle();
+		}
+	}
+	InFlightLoads.Reset();
+	ActorsWaitingOnMesh.Reset();
+	PendingRefresh.Reset();
+	WorldsPendingRebuild.Reset();
+	Records.Reset();
+	ActorsByAsset.Reset();
+	ActorCountByWorld.Reset();
+	InstancingByWorld.Reset();
+	Super::Deinitialize();
+}
+
+bool UHCIPreviewRegistrySubsystem::RegisterActor(AHCIPreviewActor* Actor)
+{
+	if (!IsValid(Actor) || Actor->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject) || !HCI_IsTrackedWorld(Actor->GetWorld()))
+	{
+		return false;
+	}
+
+	const TObjectKey<AHCIPreviewActor> ActorKey(Actor);
+	const TObjectKey<UHCIAsset> AssetKey(Actor->AbilityAsset.Get());
+	const TObjectKey<UWorld> WorldKey(Actor->GetWorld());
+	if (const FActorRecord* Existing = Records.Find(ActorKey))
+	{
+		if (Existing->Asset == AssetKey && Existing->World == WorldKey)
+		{
+			RequestRefresh(Actor);
+			return true;
+		}
+		RemoveRecord(ActorKey);
+	}
+
+	FActorRecord& Record = Records.Add(ActorKey);
+	Record.Actor = Actor;
+	Record.Asset = AssetKey;
+	Record.World = WorldKey;
+	if (Actor->AbilityAsset)
+	{
+		ActorsByAsset.FindOrAdd(AssetKey).Add(ActorKey);
+	}
+	++ActorCountByWorld.FindOrAdd(WorldKey);
+	RequestRefresh(Actor);
+	return true;
+}
+
+void UHCIPreviewRegistrySubsystem::UnregisterActor(AHCIPreviewActor* Actor)
+{
+	if (!Actor)
+	{
+		return;
+	}
+	const TObjectKey<AHCIPreviewActor> ActorKey(Actor);
+	const FActorRecord* Record = Records.Find(ActorKey);
+	if (!Record)
+	{
+		return;
+	}
+
+	const TObjectKey<UWorld> WorldKey = Record->World;
+	RemoveRecord(ActorKey);
+	PendingRefresh.Remove(ActorKey);
+	// Deleting a selection of N actors would otherwise rebuild the world's ISMs N times.
+	if (InstancingByWorld.Contains(WorldKey))
+	{
+		WorldsPendingRebuild.Add(WorldKey);
+		ScheduleFlush();
+	}
+}
+
+void UHCIPreviewRegistrySubsystem::RemoveRecord(const TObjectKey<AHCIPreviewActor>& ActorKey)
+{
+	FActorRecord Record;
+	if (!Records.RemoveAndCopyValue(ActorKey, Record))
+	{
+		return;
+	}
+
+	if (TArray<TObjectKey<AHCIPreviewActor>>* Dependents = ActorsByAsset.Find(Record.Asset))
+	{
+		Dependents->RemoveSingleSwap(ActorKey, EAllowShrinking::No);
+		if (Dependents->Num() == 0)
+		{
+			ActorsByAsset.Remove(Record.Asset);
+		}
+	}
+	if (int32* Count = ActorCountByWorld.Find(Record.World))
+	{
+		if (--(*Count) <= 0)
+		{
+			ActorCountByWorld.Remove(Record.World);
+		}
+	}
+}
+
+void UHCIPreviewRegistrySubsystem::RequestRefresh(AHCIPreviewActor* Actor)
+{
+	if (!Actor)
+	{
+		return;
+	}
+	PendingRefresh.Add(TObjectKey<AHCIPreviewActor>(Actor));
+	ScheduleFlush();
+}
+
+int32 UHCIPreviewRegistrySubsystem::RequestRefreshForAsset(const UHCIAsset* Asset)
+{
+	const TArray<TObjectKey<AHCIPreviewActor>>* Dependents = ActorsByAsset.Find(TObjectKey<UHCIAsset>(Asset));
+	if (!Dependents || Dependents->Num() == 0)
+	{
+		return 0;
+	}
+	PendingRefresh.Append(*Dependents);
+	ScheduleFlush();
+	return Dependents->Num();
+}
+
+int32 UHCIPreviewRegistrySubsystem::GetDependentActorCount(const UHCIAsset* Asset) const
+{
+	const TArray<TObjectKey<AHCIPreviewActor>>* Dependents = ActorsByAsset.Find(TObjectKey<UHCIAsset>(Asset));
+	return Dependents ? Dependents->Num() : 0;
+}
+
+bool UHCIPreviewRegistrySubsystem::IsWorldInstanced(const UWorld* World) const
+{
+	return InstancingByWorld.Contains(TObjectKey<UWorld>(World));
+}
+
+AActor* UHCIPreviewRegistrySubsystem::GetWorldInstanceHost(const UWorld* World) const
+{
+	const FWorldInstancing* Instancing = InstancingByWorld.Find(TObjectKey<UWorld>(World));
+	return Instancing ? Instancing->HostActor.Get() : nullptr;
+}
+
+void UHCIPreviewRegistrySubsystem::ScheduleFlush()
+{
+	if (!FlushTickerHandle.IsValid())
+	{
+		FlushTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &UHCIPreviewRegistrySubsystem::HandleFlushTick),
+			0.0f);
+	}
+}
+
+bool UHCIPreviewRegistrySubsystem::HandleFlushTick(float DeltaTime)
+{
+	FlushTickerHandle.Reset();
+	FlushPendingRefreshes();
+	return false;
+}
+
+void UHCIPreviewRegistrySubsystem::FlushPendingRefreshes()
+{
+	if (PendingRefresh.Num() == 0 && WorldsPendingRebuild.Num() == 0)
+	{
+		return;
+	}
+
+	TSet<TObjectKey<AHCIPreviewActor>> Batch = MoveTemp(PendingRefresh);
+	PendingRefresh.Reset();
+
+	TSet<TObjectKey<UWorld>> WorldsToRebuild = MoveTemp(WorldsPendingRebuild);
+	WorldsPendingRebuild.Reset();
+	int32 AppliedCount = 0;
+	int32 DeferredCount = 0;
+	for (const TObjectKey<AHCIPreviewActor>& ActorKey : Batch)
+	{
+		AHCIPreviewActor* Actor = ActorKey.ResolveObjectPtr();
+		if (!IsValid(Actor))
+		{
+			RemoveRecord(ActorKey);
+			continue;
+		}
+
+		const TObjectKey<UWorld> WorldKey(Actor->GetWorld());
+		const int32* WorldCount = ActorCountByWorld.Find(WorldKey);
+		const bool bInstancedWorld = WorldCount && HCI_ShouldInstanceWorld(*WorldCount);
+		if (bInstancedWorld || InstancingByWorld.Contains(WorldKey))
+		{
+			WorldsToRebuild.Add(WorldKey);
+		}
+
+		const TSoftObjectPtr<UStaticMesh> SoftMesh = HCI_GetRepresentingMesh(Actor);
+		if (SoftMesh.IsNull())
+		{
+			ApplyMesh(Actor, nullptr, bInstancedWorld);
+			++AppliedCount;
+		}
+		else if (UStaticMesh* LoadedMesh = SoftMesh.Get())
+		{
+			ApplyMesh(Actor, LoadedMesh, bInstancedWorld);
+			++AppliedCount;
+		}
+		else
+		{
+			RequestMeshLoad(SoftMesh.ToSoftObjectPath(), Actor);
+			++DeferredCount;
+		}
+	}
+
+	for (const TObjectKey<UWorld>& WorldKey : WorldsToRebuild)
+	{
+		if (UWorld* World = WorldKey.ResolveObjectPtr())
+		{
+			RebuildWorldInstances(World);
+		}
+	}
+
+	UE_LOG(
+		LogHCIPreviewRegistry,
+		Verbose,
+		TEXT("[HCI][PreviewRegistry] flush batch=%d applied=%d deferred_loads=%d rebuilt_worlds=%d registered=%d instanced_worlds=%d"),
+		Batch.Num(),
+		AppliedCount,
+		DeferredCount,
+		WorldsToRebuild.Num(),
+		Records.Num(),
+		InstancingByWorld.Num());
+}
+
+void UHCIPreviewRegistrySubsystem::ApplyMesh(AHCIPreviewActor* Actor, UStaticMesh* Mesh, const bool bInstancedWorld)
+{
+	UStaticMeshComponent* Component = Actor ? Actor->PreviewMeshComponent.Get() : nullptr;
+	if (!Component)
+	{
+		return;
+	}
+	Component->SetStaticMesh(Mesh);
+	// In instanced worlds the actor keeps its mesh (bounds, selection) but the ISM draws it.
+	Component->SetVisibility(!bInstancedWorld);
+}
+
+void UHCIPreviewRegistrySubsystem::RequestMeshLoad(const FSoftObjectPath& MeshPath, AHCIPreviewActor* Actor)
+{
+	ActorsWaitingOnMesh.FindOrAdd(MeshPath).AddUnique(TObjectKey<AHCIPreviewActor>(Actor));
+	if (InFlightLoads.Contains(MeshPath))
+	{
+		return;
+	}
+
+	TSharedPtr<FStreamableHandle> Handle = StreamableManager.RequestAsyncLoad(
+		MeshPath,
+		FStreamableDelegate::CreateUObject(this, &UHCIPreviewRegistrySubsystem::HandleMeshLoaded, MeshPath));
+	if (Handle.IsValid() && !Handle->HasLoadCompleted())
+	{
+		InFlightLoads.Add(MeshPath, Handle);
+	}
+}
+
+void UHCIPreviewRegistrySubsystem::HandleMeshLoaded(FSoftObjectPath MeshPath)
+{
+	InFlightLoads.Remove(MeshPath);
+	TArray<TObjectKey<AHCIPreviewActor>> Waiting;
+	if (!ActorsWaitingOnMesh.RemoveAndCopyValue(MeshPath, Waiting))
+	{
+		return;
+	}
+
+	if (!MeshPath.ResolveObject())
+	{
+		UE_LOG(LogHCIPreviewRegistry, Warning, TEXT("[HCI][PreviewRegistry] mesh_load_failed path=%s waiting=%d"), *MeshPath.ToString(), Waiting.Num());
+	}
+
+	// Re-queue instead of applying directly: the actor may point at another asset by now.
+	for (const TObjectKey<AHCIPreviewActor>& ActorKey : Waiting)
+	{
+		AHCIPreviewActor* Actor = ActorKey.ResolveObjectPtr();
+		if (!IsValid(Actor))
+		{
+			continue;
+		}
+		const TSoftObjectPtr<UStaticMesh> SoftMesh = HCI_GetRepresentingMesh(Actor);
+		if (SoftMesh.ToSoftObjectPath() == MeshPath && !SoftMesh.Get())
+		{
+			// Load failed; show nothing rather than retrying every tick.
+			const TObjectKey<UWorld> WorldKey(Actor->GetWorld());
+			ApplyMesh(Actor, nullptr, InstancingByWorld.Contains(WorldKey));
+			continue;
+		}
+		PendingRefresh.Add(ActorKey);
+	}
+	if (PendingRefresh.Num() > 0)
+	{
+		ScheduleFlush();
+	}
+}
+
+void UHCIPreviewRegistrySubsystem::RebuildWorldInstances(UWorld* World)
+{
+	const TObjectKey<UWorld> WorldKey(World);
+	const int32* WorldCount = ActorCountByWorld.Find(WorldKey);
+	if (!World || !WorldCount || !HCI_ShouldInstanceWorld(*WorldCount))
+	{
+		if (InstancingByWorld.Contains(WorldKey))
+		{
+			DestroyWorldInstancing(WorldKey);
+			// Dropping below the threshold hands drawing back to the per-actor components.
+			for (const TPair<TObjectKey<AHCIPreviewActor>, FActorRecord>& Pair : Records)
+			{
+				if (Pair.Value.World == WorldKey)
+				{
+					PendingRefresh.Add(Pair.Key);
+				}
+			}
+			ScheduleFlush();
+		}
+		return;
+	}
+
+	const bool bNewlyInstanced = !InstancingByWorld.Contains(WorldKey);
+	FWorldInstancing& Instancing = InstancingByWorld.FindOrAdd(WorldKey);
+	AActor* Host = Instancing.HostActor.Get();
+	if (!Host)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.ObjectFlags = RF_Transient;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+#if WITH_EDITOR
+		SpawnParams.bHideFromSceneOutliner = true;
+		SpawnParams.bTemporaryEditorActor = true;
+#endif
+		Host = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+		if (!Host)
+		{
+			InstancingByWorld.Remove(WorldKey);
+			return;
+		}
+		USceneComponent* HostRoot = NewObject<USceneComponent>(Host, TEXT("HCIPreviewInstancesRoot"), RF_Transient);
+		Host->SetRootComponent(HostRoot);
+		HostRoot->RegisterComponent();
+		Instancing.HostActor = Host;
+		Instancing.ComponentsByMesh.Reset();
+	}
+
+	TMap<TObjectKey<UStaticMesh>, TArray<FTransform>> TransformsByMesh;
+	for (const TPair<TObjectKey<AHCIPreviewActor>, FActorRecord>& Pair : Records)
+	{
+		if (Pair.Value.World != WorldKey)
+		{
+			continue;
+		}
+		AHCIPreviewActor* Actor = Pair.Value.Actor.Get();
+		UStaticMeshComponent* Component = Actor ? Actor->PreviewMeshComponent.Get() : nullptr;
+		if (!Component)
+		{
+			continue;
+		}
+		if (bNewlyInstanced)
+		{
+			Component->SetVisibility(false);
+		}
+		if (UStaticMesh* Mesh = Component->GetStaticMesh())
+		{
+			TransformsByMesh.FindOrAdd(TObjectKey<UStaticMesh>(Mesh)).Add(Component->GetComponentTransform());
+		}
+	}
+
+	for (auto It = Instancing.ComponentsByMesh.CreateIterator(); It; ++It)
+	{
+		if (!TransformsByMesh.Contains(It.Key()))
+		{
+			if (UInstancedStaticMeshComponent* Stale = It.Value().Get())
+			{
+				Stale->DestroyComponent();
+			}
+			It.RemoveCurrent();
+		}
+	}
+
+	for (TPair<TObjectKey<UStaticMesh>, TArray<FTransform>>& Pair : TransformsByMesh)
+	{
+		UInstancedStaticMeshComponent* Ism = Instancing.ComponentsByMesh.FindRef(Pair.Key).Get();
+		if (!Ism)
+		{
+			Ism = NewObject<UInstancedStaticMeshComponent>(Host, NAME_None, RF_Transient);
+			Ism->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+			Ism->SetStaticMesh(Pair.Key.ResolveObjectPtr());
+			Ism->SetupAttachment(Host->GetRootComponent());
+			Ism->RegisterComponent();
+			Host->AddInstanceComponent(Ism);
+			Instancing.ComponentsByMesh.Add(Pair.Key, Ism);
+		}
+		Ism->ClearInstances();
+		Ism->AddInstances(Pair.Value, false, true);
+	}
+}
+
+void UHCIPreviewRegistrySubsystem::DestroyWorldInstancing(const TObjectKey<UWorld>& WorldKey)
+{
+	FWorldInstancing Instancing;
+	if (!InstancingByWorld.RemoveAndCopyValue(WorldKey, Instancing))
+	{
+		return;
+	}
+	if (AActor* Host = Instancing.HostActor.Get())
+	{
+		Host->Destroy();
+	}
+}
+
+void UHCIPreviewRegistrySubsystem::HandleWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+	const TObjectKey<UWorld> WorldKey(World);
+	// The host is transient but still an actor of World; destroy it with the instancing state.
+	DestroyWorldInstancing(WorldKey);
+	WorldsPendingRebuild.Remove(WorldKey);
+
+	TArray<TObjectKey<AHCIPreviewActor>> Stale;
+	for (const TPair<TObjectKey<AHCIPreviewActor>, FActorRecord>& Pair : Records)
+	{
+		if (Pair.Value.World == WorldKey)
+		{
+			Stale.Add(Pair.Key);
+		}
+	}
+	for (const TObjectKey<AHCIPreviewActor>& ActorKey : Stale)
+	{
+		RemoveRecord(ActorKey);
+		PendingRefresh.Remove(ActorKey);
+	}
+}
+
+#if WITH_EDITOR
+void UHCIPreviewRegistrySubsystem::HandleObjectPropertyChanged(UObject* ChangedObject, FPropertyChangedEvent& PropertyChangedEvent)
+{
+	// One pointer-keyed lookup per edit, regardless of how many preview actors exist.
+	const UHCIAsset* ChangedAsset = Cast<UHCIAsset>(ChangedObject);
+	if (!ChangedAsset || !ActorsByAsset.Contains(TObjectKey<UHCIAsset>(ChangedAsset)))
+	{
+		return;
+	}
+
+	const FProperty* ChangedProperty = PropertyChangedEvent.Property
+		? PropertyChangedEvent.Property
+		: PropertyChangedEvent.MemberProperty;
+	if (ChangedProperty && ChangedProperty->GetFName() != GET_MEMBER_NAME_CHECKED(UHCIAsset, RepresentingMesh))
+	{
+		return;
+	}
+
+	RequestRefreshForAsset(ChangedAsset);
+}
+#endif
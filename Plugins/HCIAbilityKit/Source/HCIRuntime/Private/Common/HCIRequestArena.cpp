@@ -0,0 +1,113 @@
+#include "Common/HCIRequestArena.h"
+
+#include "Misc/ScopeLock.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogHCIRequestArena, Log, All);
+
+namespace
+{
+static thread_local FHCIRequestArenaScope* GHCIOutermostArenaScope = nullptr;
+}
+
+FCriticalSection FHCIRequestArena::Lock;
+TMap<FString, FHCIRequestArenaStats> FHCIRequestArena::StatsByRequestId;
+TArray<FString> FHCIRequestArena::RequestOrder;
+
+bool FHCIRequestArena::GetRequestStats(const FString& RequestId, FHCIRequestArenaStats& OutStats)
+{
+	FScopeLock ScopeLock(&Lock);
+	if (const FHCIRequestArenaStats* Stats = StatsByRequestId.Find(RequestId))
+	{
+		OutStats = *Stats;
+		return true;
+	}
+	OutStats = FHCIRequestArenaStats();
+	OutStats.RequestId = RequestId;
+	return false;
+}
+
+void FHCIRequestArena::Reset()
+{
+	FScopeLock ScopeLock(&Lock);
+	StatsByRequestId.Reset();
+	RequestOrder.Reset();
+}
+
+void FHCIRequestArena::NoteAllocation(const SIZE_T NumBytes)
+{
+	FHCIRequestArenaScope* Scope = GHCIOutermostArenaScope;
+	if (Scope == nullptr)
+	{
+		return;
+	}
+	Scope->AllocationCount += 1;
+	Scope->AllocatedBytes += static_cast<int64>(NumBytes);
+	Scope->PeakBytes = FMath::Max(Scope->PeakBytes, static_cast<int64>(FMemStack::Get().GetByteCount()) - Scope->BaseBytes);
+}
+
+void FHCIRequestArena::Commit(
+	const FString& RequestId,
+	const int32 AllocationCount,
+	const int64 AllocatedBytes,
+	const int64 PeakBytes)
+{
+	FScopeLock ScopeLock(&Lock);
+	FHCIRequestArenaStats* Stats = StatsByRequestId.Find(RequestId);
+	if (Stats == nullptr)
+	{
+		if (RequestOrder.Num() >= MaxTrackedRequests)
+		{
+			StatsByRequestId.Remove(RequestOrder[0]);
+			RequestOrder.RemoveAt(0, 1, EAllowShrinking::No);
+		}
+		RequestOrder.Add(RequestId);
+		Stats = &StatsByRequestId.Add(RequestId);
+		Stats->RequestId = RequestId;
+	}
+	Stats->ScopeCount += 1;
+	Stats->AllocationCount += AllocationCount;
+	Stats->AllocatedBytes += AllocatedBytes;
+	Stats->PeakBytes = FMath::Max(Stats->PeakBytes, PeakBytes);
+}
+
+FHCIRequestArenaScope::FHCIRequestArenaScope(const FString& InRequestId)
+	: Mark(FMemStack::Get())
+{
+	if (GHCIOutermostArenaScope == nullptr)
+	{
+		GHCIOutermostArenaScope = this;
+		bOutermost = true;
+		RequestId = InRequestId;
+		BaseBytes = FMemStack::Get().GetByteCount();
+	}
+}
+
+FHCIRequestArenaScope::~FHCIRequestArenaScope()
+{
+	if (!bOutermost)
+	{
+		return;
+	}
+
+	GHCIOutermostArenaScope = nullptr;
+	// Requests without an id (ad-hoc tooling, tests of leaf helpers) still get the arena but no record.
+	if (RequestId.IsEmpty())
+	{
+		return;
+	}
+
+	FHCIRequestArena::Commit(RequestId, AllocationCount, AllocatedBytes, PeakBytes);
+	UE_LOG(
+		LogHCIRequestArena,
+		Verbose,
+		TEXT("[HCI][Arena] request_id=%s allocations=%d allocated_bytes=%lld peak_bytes=%lld"),
+		*RequestId,
+		AllocationCount,
+		AllocatedBytes,
+		PeakBytes);
+}
+
+bool FHCIRequestArenaScope::IsActive()
+{
+	return GHCIOutermostArenaScope != nullptr;
+}
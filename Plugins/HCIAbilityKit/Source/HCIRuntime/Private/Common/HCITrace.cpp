@@ -0,0 +1,172 @@
+#include "Common/HCITrace.h"
+
+#include "HAL/PlatformTLS.h"
+#include "Misc/ScopeLock.h"
+
+UE_TRACE_CHANNEL_DEFINE(HCIChannel)
+
+namespace
+{
+static const double GHCIStageLatencyBucketUpperBoundsMs[] = {0.1, 0.5, 1.0, 5.0, 10.0, 50.0, 100.0, 500.0, 1000.0, 5000.0};
+
+static double HCI_PercentileOfSorted(const TArray<double>& Sorted, const double Percentile)
+{
+	if (Sorted.Num() == 0)
+	{
+		return 0.0;
+	}
+	const int32 Index = FMath::Clamp(FMath::CeilToInt(Percentile * Sorted.Num()) - 1, 0, Sorted.Num() - 1);
+	return Sorted[Index];
+}
+
+static void HCI_AddStageLatencySummary(
+	const FName Stage,
+	const bool bUnscoped,
+	TArray<double>& Durations,
+	TArray<FHCIStageLatencySummary>& OutSummaries)
+{
+	if (Durations.Num() == 0)
+	{
+		return;
+	}
+
+	const TConstArrayView<double> Bounds = FHCIStageLatencyRecorder::GetBucketUpperBoundsMs();
+	FHCIStageLatencySummary& Summary = OutSummaries.AddDefaulted_GetRef();
+	Summary.Stage = Stage.ToString();
+	Summary.bUnscoped = bUnscoped;
+	Summary.SampleCount = Durations.Num();
+	Summary.BucketCounts.SetNumZeroed(Bounds.Num() + 1);
+	for (const double Duration : Durations)
+	{
+		Summary.TotalMs += Duration;
+		int32 Bucket = 0;
+		while (Bucket < Bounds.Num() && Duration > Bounds[Bucket])
+		{
+			++Bucket;
+		}
+		++Summary.BucketCounts[Bucket];
+	}
+
+	Durations.Sort();
+	Summary.P50Ms = HCI_PercentileOfSorted(Durations, 0.50);
+	Summary.P95Ms = HCI_PercentileOfSorted(Durations, 0.95);
+	Summary.MaxMs = Durations.Last();
+}
+} // namespace
+
+FHCIStageLatencyRecorder& FHCIStageLatencyRecorder::Get()
+{
+	static FHCIStageLatencyRecorder Instance;
+	return Instance;
+}
+
+TConstArrayView<double> FHCIStageLatencyRecorder::GetBucketUpperBoundsMs()
+{
+	return MakeArrayView(GHCIStageLatencyBucketUpperBoundsMs);
+}
+
+uint64 FHCIStageLatencyRecorder::EnterRequest(const FString& RequestId)
+{
+	FScopeLock ScopeLock(&Lock);
+	if (RequestId.IsEmpty() || LatestRequestSerial == 0 || !RequestId.Equals(LatestRequestId, ESearchCase::CaseSensitive))
+	{
+		LatestRequestId = RequestId;
+		++LatestRequestSerial;
+	}
+	CurrentRequestSerialByThread.Add(FPlatformTLS::GetCurrentThreadId(), LatestRequestSerial);
+	return LatestRequestSerial;
+}
+
+void FHCIStageLatencyRecorder::LeaveRequest(const uint64 PreviousSerial)
+{
+	FScopeLock ScopeLock(&Lock);
+	if (PreviousSerial == 0)
+	{
+		CurrentRequestSerialByThread.Remove(FPlatformTLS::GetCurrentThreadId());
+		return;
+	}
+	CurrentRequestSerialByThread.Add(FPlatformTLS::GetCurrentThreadId(), PreviousSerial);
+}
+
+uint64 FHCIStageLatencyRecorder::GetCurrentRequestSerial() const
+{
+	FScopeLock ScopeLock(&Lock);
+	const uint64* Serial = CurrentRequestSerialByThread.Find(FPlatformTLS::GetCurrentThreadId());
+	return Serial ? *Serial : 0;
+}
+
+uint64 FHCIStageLatencyRecorder::GetLatestRequestSerial() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return LatestRequestSerial;
+}
+
+void FHCIStageLatencyRecorder::Record(const FName Stage, const double DurationMs)
+{
+	FScopeLock ScopeLock(&Lock);
+	FStageSamples& Samples = SamplesByStage.FindOrAdd(Stage);
+	const uint64* Serial = CurrentRequestSerialByThread.Find(FPlatformTLS::GetCurrentThreadId());
+	const FSample Sample{Serial ? *Serial : 0, DurationMs};
+	if (Samples.Ring.Num() < MaxSamplesPerStage)
+	{
+		Samples.Ring.Add(Sample);
+		return;
+	}
+	Samples.Ring[Samples.NextIndex] = Sample;
+	Samples.NextIndex = (Samples.NextIndex + 1) % MaxSamplesPerStage;
+}
+
+void FHCIStageLatencyRecorder::Summarize(const int32 LastRequestCount, TArray<FHCIStageLatencySummary>& OutSummaries) const
+{
+	OutSummaries.Reset();
+
+	FScopeLock ScopeLock(&Lock);
+	const uint64 WindowSize = static_cast<uint64>(FMath::Max(1, LastRequestCount));
+	const uint64 MinSerial = LatestRequestSerial >= WindowSize ? LatestRequestSerial - WindowSize + 1 : 1;
+
+	TArray<double> Durations;
+	TArray<double> UnscopedDurations;
+	for (const TPair<FName, FStageSamples>& Pair : SamplesByStage)
+	{
+		Durations.Reset();
+		UnscopedDurations.Reset();
+		for (const FSample& Sample : Pair.Value.Ring)
+		{
+			if (Sample.RequestSerial == 0)
+			{
+				UnscopedDurations.Add(Sample.DurationMs);
+			}
+			else if (Sample.RequestSerial >= MinSerial)
+			{
+				Durations.Add(Sample.DurationMs);
+			}
+		}
+		HCI_AddStageLatencySummary(Pair.Key, false, Durations, OutSummaries);
+		HCI_AddStageLatencySummary(Pair.Key, true, UnscopedDurations, OutSummaries);
+	}
+
+	OutSummaries.Sort([](const FHCIStageLatencySummary& Lhs, const FHCIStageLatencySummary& Rhs)
+	{
+		return Lhs.TotalMs > Rhs.TotalMs;
+	});
+}
+
+void FHCIStageLatencyRecorder::Reset()
+{
+	FScopeLock ScopeLock(&Lock);
+	SamplesByStage.Reset();
+	LatestRequestId.Reset();
+	LatestRequestSerial = 0;
+	CurrentRequestSerialByThread.Reset();
+}
+
+FHCIStageLatencyScope::~FHCIStageLatencyScope()
+{
+	const double DurationMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+	FHCIStageLatencyRecorder::Get().Record(Stage, DurationMs);
+}
+
+FHCITraceRequestScope::~FHCITraceRequestScope()
+{
+	FHCIStageLatencyRecorder::Get().LeaveRequest(PreviousSerial);
+}
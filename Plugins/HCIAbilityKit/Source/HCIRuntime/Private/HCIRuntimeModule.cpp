@@ -1,5 +1,6 @@
 #include "HCIRuntimeModule.h"
 
+#include "Agent/Executor/HCIAgentAuditLogWriter.h"
 #include "Agent/Planner/Interfaces/IHCIPlannerRouter.h"
 #include "Agent/Planner/Providers/HCIKeywordPlannerProvider.h"
 #include "Agent/Planner/Providers/HCILlmPlannerProvider.h"
@@ -20,6 +21,9 @@ void FHCIRuntimeModule::StartupModule()
 
 void FHCIRuntimeModule::ShutdownModule()
 {
+	// 审计日志缓冲区必须在模块卸载前落盘。
+	FHCIAgentAuditLogWriter::Get().Shutdown();
+
 	FScopeLock Lock(&PlannerRouterMutex);
 	PlannerRouter.Reset();
 
@@ -3,6 +3,7 @@
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Audit/HCIAuditTagNames.h"
 #include "Common/HCITimeFormat.h"
+#include "Common/HCITrace.h"
 #include "HCIAsset.h"
 #include "Modules/ModuleManager.h"
 
@@ -86,6 +87,7 @@ FHCISearchIndexService& FHCISearchIndexService::Get()
 
 void FHCISearchIndexService::RebuildFromAssetRegistry()
 {
+	HCI_TRACE_SCOPE(TEXT("HCI.Search.RebuildIndex"));
 	const double StartTime = FPlatformTime::Seconds();
 	Reset();
 
@@ -97,6 +99,9 @@ void FHCISearchIndexService::RebuildFromAssetRegistry()
 	TArray<FAssetData> AssetDatas;
 	AssetRegistryModule.Get().GetAssets(Filter, AssetDatas);
 
+	// Build every document first so buckets can be sized once before insertion.
+	TArray<FHCIAbilitySearchDocument> Documents;
+	Documents.Reserve(AssetDatas.Num());
 	for (const FAssetData& AssetData : AssetDatas)
 	{
 		// Try to build parsed data from tags first to avoid loading the asset
@@ -112,15 +117,20 @@ void FHCISearchIndexService::RebuildFromAssetRegistry()
 			ParsedData = BuildParsedDataFromAsset(Asset);
 		}
 
-		const FString AssetPath = AssetData.GetObjectPathString();
-		const FHCIAbilitySearchDocument Document = FHCIAbilitySearchSchema::BuildDocument(ParsedData, AssetPath);
+		Documents.Add(FHCIAbilitySearchSchema::BuildDocument(ParsedData, AssetData.GetObjectPathString()));
+	}
+
+	Index.ReserveForDocuments(Documents);
+	AssetPathToId.Reserve(Documents.Num());
+	for (const FHCIAbilitySearchDocument& Document : Documents)
+	{
 		if (!Index.AddDocument(Document))
 		{
-			UE_LOG(LogHCISearchIndex, Warning, TEXT("Skip duplicated or invalid document: id=%s path=%s"), *Document.Id, *AssetPath);
+			UE_LOG(LogHCISearchIndex, Warning, TEXT("Skip duplicated or invalid document: id=%s path=%s"), *Document.Id, *Document.AssetPath);
 			continue;
 		}
 
-		AssetPathToId.Add(AssetPath, Document.Id);
+		AssetPathToId.Add(Document.AssetPath, Document.Id);
 		UpdateDocumentStats(Document, true);
 	}
 
@@ -131,12 +141,53 @@ void FHCISearchIndexService::RebuildFromAssetRegistry()
 
 bool FHCISearchIndexService::RefreshAsset(const UHCIAsset* Asset)
 {
-	if (!Asset)
+	HCI_TRACE_SCOPE(TEXT("HCI.Search.RefreshAsset"));
+	const double StartTime = FPlatformTime::Seconds();
+	if (!RefreshAssetInternal(Asset))
 	{
 		return false;
 	}
 
+	const double DurationMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	UpdateStatsMetadata(TEXT("incremental_refresh"), DurationMs);
+
+	UE_LOG(LogHCISearchIndex, Verbose, TEXT("[HCI][SearchIndex] %s"), *Stats.ToSummaryString());
+	return true;
+}
+
+int32 FHCISearchIndexService::RefreshAssets(TConstArrayView<const UHCIAsset*> Assets)
+{
+	HCI_TRACE_SCOPE(TEXT("HCI.Search.RefreshAssets"));
 	const double StartTime = FPlatformTime::Seconds();
+
+	int32 RefreshedCount = 0;
+	for (const UHCIAsset* Asset : Assets)
+	{
+		RefreshedCount += RefreshAssetInternal(Asset) ? 1 : 0;
+	}
+
+	if (RefreshedCount > 0)
+	{
+		const double DurationMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+		UpdateStatsMetadata(TEXT("batch_refresh"), DurationMs);
+		UE_LOG(
+			LogHCISearchIndex,
+			Verbose,
+			TEXT("[HCI][SearchIndex] batch_refresh requested=%d refreshed=%d %s"),
+			Assets.Num(),
+			RefreshedCount,
+			*Stats.ToSummaryString());
+	}
+	return RefreshedCount;
+}
+
+bool FHCISearchIndexService::RefreshAssetInternal(const UHCIAsset* Asset)
+{
+	if (!Asset)
+	{
+		return false;
+	}
+
 	const FString AssetPath = Asset->GetPathName();
 	if (AssetPath.IsEmpty())
 	{
@@ -219,11 +270,6 @@ bool FHCISearchIndexService::RefreshAsset(const UHCIAsset* Asset)
 
 	AssetPathToId.Add(AssetPath, NewDocument.Id);
 	UpdateDocumentStats(NewDocument, true);
-
-	const double DurationMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
-	UpdateStatsMetadata(TEXT("incremental_refresh"), DurationMs);
-
-	UE_LOG(LogHCISearchIndex, Display, TEXT("[HCI][SearchIndex] %s"), *Stats.ToSummaryString());
 	return true;
 }
 
@@ -247,18 +293,60 @@ bool FHCISearchIndexService::RemoveAssetByPath(const FString& AssetPath)
 		return false;
 	}
 
+	const FHCIAbilitySearchDocument RemovedDocument = *ExistingDocument;
 	const bool bRemoved = Index.RemoveDocumentById(*ExistingId);
 	if (!bRemoved)
 	{
 		return false;
 	}
 
-	UpdateDocumentStats(*ExistingDocument, false);
+	UpdateDocumentStats(RemovedDocument, false);
 	AssetPathToId.Remove(AssetPath);
 	UpdateStatsMetadata(TEXT("incremental_remove"), 0.0);
 	return true;
 }
 
+int32 FHCISearchIndexService::RemoveAssetsByPaths(const TArray<FString>& AssetPaths)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	TArray<FString> IdsToRemove;
+	IdsToRemove.Reserve(AssetPaths.Num());
+	for (const FString& AssetPath : AssetPaths)
+	{
+		const FString* ExistingId = AssetPathToId.Find(AssetPath);
+		if (!ExistingId)
+		{
+			continue;
+		}
+
+		const FHCIAbilitySearchDocument* ExistingDocument = Index.DocumentsById.Find(*ExistingId);
+		if (!ExistingDocument)
+		{
+			// Same guard as RemoveAssetByPath: keep stale mappings visible instead of silently dropping them.
+			UE_LOG(
+				LogHCISearchIndex,
+				Error,
+				TEXT("RemoveAssetsByPaths skipped stale mapping path=%s id=%s"),
+				*AssetPath,
+				*(*ExistingId));
+			continue;
+		}
+
+		UpdateDocumentStats(*ExistingDocument, false);
+		IdsToRemove.Add(*ExistingId);
+		AssetPathToId.Remove(AssetPath);
+	}
+
+	const int32 RemovedCount = Index.RemoveDocumentsByIds(IdsToRemove);
+	if (RemovedCount > 0)
+	{
+		const double DurationMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+		UpdateStatsMetadata(TEXT("bulk_remove"), DurationMs);
+	}
+	return RemovedCount;
+}
+
 const FHCIAbilitySearchIndex& FHCISearchIndexService::GetIndex() const
 {
 	return Index;
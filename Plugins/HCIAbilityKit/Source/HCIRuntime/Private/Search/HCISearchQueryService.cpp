@@ -1,8 +1,11 @@
 #include "Search/HCISearchQueryService.h"
 
 #include "Algo/Sort.h"
+#include "Common/HCITrace.h"
 #include "Containers/Set.h"
 
+TRACE_DECLARE_INT_COUNTER(HCISearchQueryCount, TEXT("HCI/Search/QueryCount"));
+
 namespace
 {
 constexpr int32 MinTopK = 1;
@@ -58,26 +61,20 @@ TArray<FString> TokenizeQuery(const FString& NormalizedText)
 
 template <typename TEnum>
 void IntersectWithBucket(
-	const TMap<TEnum, TArray<FString>>& Buckets,
+	const TMap<TEnum, FHCIAbilitySearchPostingList>& Buckets,
 	const TEnum Key,
 	TSet<FString>& InOutCandidateIds)
 {
-	const TArray<FString>* Bucket = Buckets.Find(Key);
+	const FHCIAbilitySearchPostingList* Bucket = Buckets.Find(Key);
 	if (!Bucket)
 	{
 		InOutCandidateIds.Reset();
 		return;
 	}
 
-	TSet<FString> BucketSet;
-	BucketSet.Reserve(Bucket->Num());
-	for (const FString& Id : *Bucket)
-	{
-		BucketSet.Add(Id);
-	}
 	for (auto It = InOutCandidateIds.CreateIterator(); It; ++It)
 	{
-		if (!BucketSet.Contains(*It))
+		if (!Bucket->Contains(*It))
 		{
 			It.RemoveCurrent();
 		}
@@ -296,6 +293,8 @@ FHCIAbilitySearchResult FHCISearchQueryService::RunQuery(
 	const int32 TopK,
 	const FHCIAbilitySearchIndex& Index)
 {
+	HCI_TRACE_SCOPE(TEXT("HCI.Search.RunQuery"));
+	TRACE_COUNTER_INCREMENT(HCISearchQueryCount);
 	FHCIAbilitySearchResult Result;
 	Result.ParsedQuery = ParseQuery(UserQuery, TopK, Index);
 
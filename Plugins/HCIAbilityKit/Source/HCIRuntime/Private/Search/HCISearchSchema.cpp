@@ -120,9 +120,9 @@ void AppendUsageSceneTokens(TSet<FString>& OutTokens, const TArray<EHCIAbilityUs
 }
 
 template <typename TKey>
-void RemoveIdFromBuckets(TMap<TKey, TArray<FString>>& Buckets, const TKey& Key, const FString& Id)
+void RemoveIdFromBuckets(TMap<TKey, FHCIAbilitySearchPostingList>& Buckets, const TKey& Key, const FString& Id)
 {
-	if (TArray<FString>* Bucket = Buckets.Find(Key))
+	if (FHCIAbilitySearchPostingList* Bucket = Buckets.Find(Key))
 	{
 		Bucket->Remove(Id);
 		if (Bucket->Num() == 0)
@@ -131,6 +131,22 @@ void RemoveIdFromBuckets(TMap<TKey, TArray<FString>>& Buckets, const TKey& Key,
 		}
 	}
 }
+
+template <typename TKey>
+void AddBucketReservation(TMap<TKey, int32>& Counts, const TKey& Key)
+{
+	++Counts.FindOrAdd(Key);
+}
+
+template <typename TKey>
+void ApplyBucketReservations(TMap<TKey, FHCIAbilitySearchPostingList>& Buckets, const TMap<TKey, int32>& Counts)
+{
+	for (const TPair<TKey, int32>& Pair : Counts)
+	{
+		FHCIAbilitySearchPostingList& Bucket = Buckets.FindOrAdd(Pair.Key);
+		Bucket.Reserve(Bucket.Num() + Pair.Value);
+	}
+}
 }
 
 bool FHCIAbilitySearchDocument::IsValid() const
@@ -138,6 +154,40 @@ bool FHCIAbilitySearchDocument::IsValid() const
 	return !Id.IsEmpty();
 }
 
+void FHCIAbilitySearchPostingList::Reserve(const int32 Count)
+{
+	Ids.Reserve(Count);
+	PositionById.Reserve(Count);
+}
+
+bool FHCIAbilitySearchPostingList::Add(const FString& InId)
+{
+	if (PositionById.Contains(InId))
+	{
+		return false;
+	}
+
+	PositionById.Add(InId, Ids.Add(InId));
+	return true;
+}
+
+bool FHCIAbilitySearchPostingList::Remove(const FString& InId)
+{
+	int32 Position = INDEX_NONE;
+	if (!PositionById.RemoveAndCopyValue(InId, Position))
+	{
+		return false;
+	}
+
+	const int32 LastPosition = Ids.Num() - 1;
+	if (Position != LastPosition)
+	{
+		PositionById.FindChecked(Ids[LastPosition]) = Position;
+	}
+	Ids.RemoveAtSwap(Position, 1, EAllowShrinking::No);
+	return true;
+}
+
 void FHCIAbilitySearchIndex::Reset()
 {
 	DocumentsById.Reset();
@@ -145,7 +195,9 @@ void FHCIAbilitySearchIndex::Reset()
 	IdsByDamageTier.Reset();
 	IdsByControlProfile.Reset();
 	IdsByUsageScene.Reset();
-	IdsByToken.Reset();
+	TokenIdByText.Reset();
+	TokenTexts.Reset();
+	IdsByTokenId.Reset();
 }
 
 int32 FHCIAbilitySearchIndex::GetDocumentCount() const
@@ -177,7 +229,7 @@ bool FHCIAbilitySearchIndex::AddDocument(const FHCIAbilitySearchDocument& InDocu
 
 	for (const FString& Token : InDocument.Tokens)
 	{
-		IdsByToken.FindOrAdd(Token).Add(InDocument.Id);
+		IdsByTokenId[InternToken(Token)].Add(InDocument.Id);
 	}
 
 	return true;
@@ -200,14 +252,157 @@ bool FHCIAbilitySearchIndex::RemoveDocumentById(const FString& InId)
 		RemoveIdFromBuckets(IdsByUsageScene, Scene, InId);
 	}
 
+	// Token slots stay interned after their bucket empties so IDs remain stable until Reset().
 	for (const FString& Token : ExistingDocument.Tokens)
 	{
-		RemoveIdFromBuckets(IdsByToken, Token, InId);
+		const int32 TokenId = FindTokenId(Token);
+		if (TokenId != INDEX_NONE)
+		{
+			IdsByTokenId[TokenId].Remove(InId);
+		}
 	}
 
 	return true;
 }
 
+void FHCIAbilitySearchIndex::ReserveForDocuments(const TArray<FHCIAbilitySearchDocument>& IncomingDocuments)
+{
+	DocumentsById.Reserve(DocumentsById.Num() + IncomingDocuments.Num());
+
+	TArray<const FHCIAbilitySearchDocument*> DocumentPtrs;
+	DocumentPtrs.Reserve(IncomingDocuments.Num());
+	for (const FHCIAbilitySearchDocument& Document : IncomingDocuments)
+	{
+		DocumentPtrs.Add(&Document);
+	}
+	ReserveBuckets(DocumentPtrs);
+}
+
+int32 FHCIAbilitySearchIndex::RemoveDocumentsByIds(const TArray<FString>& InIds)
+{
+	// Below half the index, per-ID swap-removal touches less memory than a full bucket rebuild.
+	if (InIds.Num() * 2 < DocumentsById.Num())
+	{
+		int32 RemovedCount = 0;
+		for (const FString& Id : InIds)
+		{
+			RemovedCount += RemoveDocumentById(Id) ? 1 : 0;
+		}
+		return RemovedCount;
+	}
+
+	int32 RemovedCount = 0;
+	for (const FString& Id : InIds)
+	{
+		RemovedCount += DocumentsById.Remove(Id);
+	}
+	if (RemovedCount > 0)
+	{
+		RebuildBuckets();
+	}
+	return RemovedCount;
+}
+
+int32 FHCIAbilitySearchIndex::FindTokenId(const FString& Token) const
+{
+	const int32* TokenId = TokenIdByText.Find(Token);
+	return TokenId ? *TokenId : INDEX_NONE;
+}
+
+const FHCIAbilitySearchPostingList* FHCIAbilitySearchIndex::FindTokenPostings(const FString& Token) const
+{
+	const int32 TokenId = FindTokenId(Token);
+	return TokenId != INDEX_NONE ? &IdsByTokenId[TokenId] : nullptr;
+}
+
+int32 FHCIAbilitySearchIndex::InternToken(const FString& Token)
+{
+	if (const int32* ExistingId = TokenIdByText.Find(Token))
+	{
+		return *ExistingId;
+	}
+
+	const int32 TokenId = TokenTexts.Add(Token);
+	IdsByTokenId.AddDefaulted();
+	TokenIdByText.Add(Token, TokenId);
+	return TokenId;
+}
+
+void FHCIAbilitySearchIndex::ReserveBuckets(const TArray<const FHCIAbilitySearchDocument*>& Documents)
+{
+	TMap<EHCIAbilityElement, int32> ElementCounts;
+	TMap<EHCIAbilityDamageTier, int32> DamageTierCounts;
+	TMap<EHCIAbilityControlProfile, int32> ControlCounts;
+	TMap<EHCIAbilityUsageScene, int32> SceneCounts;
+	TArray<int32> TokenCounts;
+	for (const FHCIAbilitySearchDocument* Document : Documents)
+	{
+		AddBucketReservation(ElementCounts, Document->Element);
+		AddBucketReservation(DamageTierCounts, Document->DamageTier);
+		AddBucketReservation(ControlCounts, Document->ControlProfile);
+		for (const EHCIAbilityUsageScene Scene : Document->UsageScenes)
+		{
+			AddBucketReservation(SceneCounts, Scene);
+		}
+		for (const FString& Token : Document->Tokens)
+		{
+			const int32 TokenId = InternToken(Token);
+			if (TokenCounts.Num() <= TokenId)
+			{
+				TokenCounts.SetNumZeroed(TokenId + 1);
+			}
+			++TokenCounts[TokenId];
+		}
+	}
+
+	ApplyBucketReservations(IdsByElement, ElementCounts);
+	ApplyBucketReservations(IdsByDamageTier, DamageTierCounts);
+	ApplyBucketReservations(IdsByControlProfile, ControlCounts);
+	ApplyBucketReservations(IdsByUsageScene, SceneCounts);
+	for (int32 TokenId = 0; TokenId < TokenCounts.Num(); ++TokenId)
+	{
+		if (TokenCounts[TokenId] > 0)
+		{
+			FHCIAbilitySearchPostingList& Postings = IdsByTokenId[TokenId];
+			Postings.Reserve(Postings.Num() + TokenCounts[TokenId]);
+		}
+	}
+}
+
+void FHCIAbilitySearchIndex::RebuildBuckets()
+{
+	IdsByElement.Reset();
+	IdsByDamageTier.Reset();
+	IdsByControlProfile.Reset();
+	IdsByUsageScene.Reset();
+	TokenIdByText.Reset();
+	TokenTexts.Reset();
+	IdsByTokenId.Reset();
+
+	TArray<const FHCIAbilitySearchDocument*> Documents;
+	Documents.Reserve(DocumentsById.Num());
+	for (const TPair<FString, FHCIAbilitySearchDocument>& Pair : DocumentsById)
+	{
+		Documents.Add(&Pair.Value);
+	}
+	ReserveBuckets(Documents);
+
+	for (const FHCIAbilitySearchDocument* Document : Documents)
+	{
+		IdsByElement.FindOrAdd(Document->Element).Add(Document->Id);
+		IdsByDamageTier.FindOrAdd(Document->DamageTier).Add(Document->Id);
+		IdsByControlProfile.FindOrAdd(Document->ControlProfile).Add(Document->Id);
+		for (const EHCIAbilityUsageScene Scene : Document->UsageScenes)
+		{
+			IdsByUsageScene.FindOrAdd(Scene).Add(Document->Id);
+		}
+		for (const FString& Token : Document->Tokens)
+		{
+			IdsByTokenId[InternToken(Token)].Add(Document->Id);
+		}
+	}
+}
+
 FHCIAbilitySearchDocument FHCIAbilitySearchSchema::BuildDocument(
 	const FHCIParsedData& ParsedData,
 	const FString& AssetPath)
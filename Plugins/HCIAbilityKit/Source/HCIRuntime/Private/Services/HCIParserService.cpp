@@ -73,6 +73,15 @@ bool FHCIParserService::TryParseKitFile(
 	const FString& FullFilename,
 	FHCIParsedData& OutParsed,
 	FHCIParseError& OutError)
+{
+	return TryParseKitFileWithoutHook(FullFilename, OutParsed, OutError)
+		&& RunPythonHook(FullFilename, OutParsed, OutError);
+}
+
+bool FHCIParserService::TryParseKitFileWithoutHook(
+	const FString& FullFilename,
+	FHCIParsedData& OutParsed,
+	FHCIParseError& OutError)
 {
 	FString FileContent;
 	// 1. 读取物理文件内容
@@ -294,10 +303,20 @@ bool FHCIParserService::TryParseKitFile(
 		OutParsed.TriangleCountLod0Expected = FMath::RoundToInt(TriangleExpectedTmp);
 	}
 
+	return true;
+}
+
+bool FHCIParserService::RunPythonHook(
+	const FString& FullFilename,
+	FHCIParsedData& InOutParsed,
+	FHCIParseError& OutError)
+{
 	// 9. 调用 Python 钩子脚本进行深度处理或校验
 	if (GPythonHook)
 	{
-		if (!GPythonHook(FullFilename, OutParsed, OutError))
+		// 钩子经由 PythonScriptPlugin 执行，只能在游戏线程运行
+		check(IsInGameThread());
+		if (!GPythonHook(FullFilename, InOutParsed, OutError))
 		{
 			// 如果 Python 返回失败且未填充结构化错误，则补充默认错误信息
 			if (!OutError.IsValid())
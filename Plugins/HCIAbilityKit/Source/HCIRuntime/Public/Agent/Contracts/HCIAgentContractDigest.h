@@ -0,0 +1,77 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Hash/xxhash.h"
+
+struct FHCIDryRunDiffReport;
+
+enum class EHCIAgentDigestAlgorithm : uint8
+{
+	// Legacy digests ("crc32_XXXXXXXX"), kept so previously emitted contracts still verify.
+	Crc32,
+	// Default for new digests ("xxh64_xxxxxxxxxxxxxxxx").
+	XxHash64
+};
+
+// Hashes contract fields incrementally in the same "a|b|c\n" canonical layout the bridges used to
+// Printf into a string, so no canonical FString is ever materialized.
+class HCIRUNTIME_API FHCIAgentDigestBuilder
+{
+public:
+	explicit FHCIAgentDigestBuilder(EHCIAgentDigestAlgorithm InAlgorithm = EHCIAgentDigestAlgorithm::XxHash64);
+
+	FHCIAgentDigestBuilder& Field(const FString& Value);
+	FHCIAgentDigestBuilder& Field(const TCHAR* Value);
+	FHCIAgentDigestBuilder& Field(int32 Value);
+	FHCIAgentDigestBuilder& Field(bool bValue);
+	FHCIAgentDigestBuilder& EndRow();
+
+	FString Finalize() const;
+	EHCIAgentDigestAlgorithm GetAlgorithm() const { return Algorithm; }
+
+private:
+	void Append(const TCHAR* Data, int32 Len);
+	void BeginField();
+
+	EHCIAgentDigestAlgorithm Algorithm;
+	uint32 Crc = 0;
+	FXxHash64Builder XxHash;
+	bool bRowHasFields = false;
+};
+
+struct HCIRUNTIME_API FHCIAgentContractDigest
+{
+	static const TCHAR* Crc32Prefix;
+	static const TCHAR* XxHash64Prefix;
+
+	// Picks the algorithm an existing digest was produced with; unknown prefixes map to the default.
+	static EHCIAgentDigestAlgorithm DetectAlgorithm(const FString& Digest);
+
+	static FString BuildSelectionDigest(
+		const FHCIDryRunDiffReport& Report,
+		EHCIAgentDigestAlgorithm Algorithm = EHCIAgentDigestAlgorithm::XxHash64);
+
+	// Recomputes the selection digest with the algorithm encoded in ExpectedDigest and compares.
+	static bool MatchesSelectionDigest(const FString& ExpectedDigest, const FHCIDryRunDiffReport& Report);
+
+	static int32 GetSelectionDigestComputeCount();
+	static void ResetSelectionDigestComputeCount();
+};
+
+// While alive on the current thread, selection digests are memoized per review report instance.
+// Callers must not mutate the reports they digest inside the scope.
+class HCIRUNTIME_API FHCIAgentSelectionDigestScope
+{
+public:
+	FHCIAgentSelectionDigestScope();
+	~FHCIAgentSelectionDigestScope();
+
+	FHCIAgentSelectionDigestScope(const FHCIAgentSelectionDigestScope&) = delete;
+	FHCIAgentSelectionDigestScope& operator=(const FHCIAgentSelectionDigestScope&) = delete;
+
+private:
+	FHCIAgentSelectionDigestScope* Previous = nullptr;
+	TMap<TTuple<const FHCIDryRunDiffReport*, uint8>, FString> Cache;
+
+	friend struct FHCIAgentContractDigest;
+};
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/Runnable.h"
+#include "Templates/Atomic.h"
+#include "Templates/UniquePtr.h"
+
+class FEvent;
+class FRunnableThread;
+class IFileHandle;
+
+struct HCIRUNTIME_API FHCIAgentAuditLogWriterConfig
+{
+	FString FilePath;
+	// Active file is rotated to <base>.1<ext> once the next batch would push it past this size.
+	int64 MaxFileBytes = 8 * 1024 * 1024;
+	// Rotated generations kept (<base>.1 .. <base>.N); 0 = truncate on rotation.
+	int32 MaxRotatedFiles = 5;
+	// Buffered bytes that wake the writer thread before the interval elapses.
+	int32 FlushThresholdBytes = 64 * 1024;
+	float FlushIntervalSeconds = 1.0f;
+	// Upper bound for the in-memory buffer; an Append past it drains synchronously (records are never dropped).
+	int32 MaxBufferedBytes = 4 * 1024 * 1024;
+	bool bUseBackgroundThread = true;
+};
+
+struct HCIRUNTIME_API FHCIAgentAuditLogWriterStats
+{
+	int64 AppendedRecords = 0;
+	int64 WrittenBytes = 0;
+	int32 FlushCount = 0;
+	int32 RotationCount = 0;
+	int32 SyncDrainCount = 0;
+};
+
+/**
+ * Append-only JSONL sink for agent execution audit records.
+ * Append only encodes UTF-8 into a memory buffer; a background thread owns the persistent file handle
+ * and writes the buffer out when it grows past FlushThresholdBytes or every FlushIntervalSeconds.
+ */
+class HCIRUNTIME_API FHCIAgentAuditLogWriter : public FRunnable
+{
+public:
+	// Process-wide writer for Saved/HCI/Audit/agent_exec_log.jsonl.
+	static FHCIAgentAuditLogWriter& Get();
+	static FString GetDefaultFilePath();
+
+	explicit FHCIAgentAuditLogWriter(const FHCIAgentAuditLogWriterConfig& InConfig);
+	virtual ~FHCIAgentAuditLogWriter() override;
+
+	// Queues one JSON line (without terminator). Fails only when the log file cannot be opened.
+	bool Append(const FString& JsonLine, FString& OutError);
+	// Writes everything buffered so far on the calling thread.
+	bool Flush(FString& OutError);
+	// Stops the writer thread, drains the buffer and closes the file. Later Appends write through.
+	void Shutdown();
+
+	const FString& GetFilePath() const { return Config.FilePath; }
+	FString GetRotatedFilePath(int32 Generation) const;
+	FHCIAgentAuditLogWriterStats GetStats() const;
+
+	// FRunnable
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+private:
+	bool EnsureStarted(FString& OutError);
+	bool DrainPending(FString& OutError);
+	bool OpenFileLocked(FString& OutError);
+	void RotateLocked();
+	void HandleSystemError();
+
+	FHCIAgentAuditLogWriterConfig Config;
+
+	// Lock order: FileLock before BufferLock.
+	mutable FCriticalSection BufferLock;
+	TArray<uint8> PendingBytes;
+	int64 PendingRecords = 0;
+
+	FCriticalSection FileLock;
+	TUniquePtr<IFileHandle> FileHandle;
+	int64 FileSize = 0;
+	TArray<uint8> WriteBuffer;
+
+	FEvent* WakeEvent = nullptr;
+	FRunnableThread* Thread = nullptr;
+	TAtomic<bool> bStopping{false};
+	TAtomic<bool> bStarted{false};
+	TAtomic<bool> bShutdown{false};
+
+	mutable FCriticalSection StatsLock;
+	FHCIAgentAuditLogWriterStats Stats;
+
+	FDelegateHandle SystemErrorHandle;
+};
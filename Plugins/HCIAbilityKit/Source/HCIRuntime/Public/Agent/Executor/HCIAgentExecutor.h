@@ -2,6 +2,8 @@
 
 #include "CoreMinimal.h"
 
+#include "Agent/Executor/HCIAgentReadOnlyResultCache.h"
+#include "Agent/Executor/HCIAgentSourceControlCheckout.h"
 #include "Agent/Planner/HCIAgentPlan.h"
 #include "Agent/Tools/HCIAgentToolAction.h"
 #include "Agent/Planner/HCIAgentPlanValidator.h"
@@ -32,6 +34,10 @@ struct HCIRUNTIME_API FHCIAgentExecutorOptions
 	// F5 source control seam (default offline-local mode to avoid requiring SC in demo).
 	bool bSourceControlEnabled = false;
 	bool bSourceControlCheckoutSucceeded = false;
+	// When set (and not a dry run), replaces bSourceControlCheckoutSucceeded: packages named by write steps'
+	// asset_path/asset_paths args are checked out in one batch at Start(), and a step is blocked with E4006
+	// only when one of its own packages failed.
+	TSharedPtr<IHCIAgentSourceControlCheckout> SourceControlCheckout;
 
 	// F5 LOD safety seam used only for SetMeshLODGroup steps.
 	FString SimulatedLodTargetObjectClass = TEXT("UStaticMesh");
@@ -47,6 +53,24 @@ struct HCIRUNTIME_API FHCIAgentExecutorOptions
 
 	// Stage L-SliceL1: optional UI-facing step begin callback (no semantic impact on execution).
 	TFunction<void(int32 /*StepIndex*/, const FHCIAgentPlanStep& /*Step*/)> OnStepBegin;
+
+	// Called with the step's resolved args right before its tool action runs (not for steps that failed precheck
+	// or preflight). Lets callers size work whose targets are only known after pipeline variables resolved.
+	TFunction<void(int32 /*StepIndex*/, const FHCIAgentPlanStep& /*ResolvedStep*/)> OnStepArgsResolved;
+
+	// Optional per-asset progress from tool actions that loop over asset_paths (reported once per asset batch).
+	TFunction<void(int32 /*StepIndex*/, int32 /*ProcessedAssets*/, int32 /*TotalAssets*/)> OnAssetProgress;
+
+	// Checked before every step and between asset batches; a cancelled run ends with TerminalStatus=cancelled.
+	TSharedPtr<FHCIAgentExecutionCancellation> Cancellation;
+
+	// Commit only: proposal artifacts from an earlier dry run, keyed by MakeProposalArtifactKey. A step whose
+	// resolved args differ from the dry run gets a different key and runs its full discovery.
+	TMap<FString, FString> ProposalArtifactsByKey;
+
+	// When set, successful results of memoizable read-only tool actions are served from / stored into this
+	// session cache instead of re-running the action.
+	TSharedPtr<FHCIAgentReadOnlyResultCache> ReadOnlyResultCache;
 };
 
 struct HCIRUNTIME_API FHCIAgentExecutorStepResult
@@ -71,6 +95,12 @@ struct HCIRUNTIME_API FHCIAgentExecutorStepResult
 
 	FString FailurePhase;  // "-", "precheck", "preflight", "execute"
 	FString PreflightGate; // "-", "confirm_gate", "blast_radius", "rbac", "source_control", "lod_safety"
+
+	// Dry run only: the tool action's proposal artifact and the key a later commit looks it up by.
+	FString ProposalArtifactKey;
+	FString ProposalArtifact;
+
+	bool bFromReadOnlyCache = false;
 };
 
 struct HCIRUNTIME_API FHCIAgentExecutorRunResult
@@ -101,6 +131,16 @@ struct HCIRUNTIME_API FHCIAgentExecutorRunResult
 	FString FailedToolName;
 	FString FailedGate;
 
+	int32 SourceControlCheckoutBatches = 0;
+	int32 SourceControlCheckedOutPackages = 0;
+
+	int32 ReadOnlyCacheHits = 0;
+	int32 ReadOnlyCacheMisses = 0;
+
+	// Request arena usage (planning, validation and execution of this RequestId so far), see FHCIRequestArena.
+	int32 TransientArenaAllocations = 0;
+	int64 TransientArenaPeakBytes = 0;
+
 	FString StartedAtUtc;
 	FString FinishedAtUtc;
 
@@ -121,6 +161,69 @@ public:
 		const FHCIAgentPlanValidationContext& ValidationContext,
 		const FHCIAgentExecutorOptions& Options,
 		FHCIAgentExecutorRunResult& OutResult);
+
+	// RequestId + StepId + ToolName + a hash of the resolved args.
+	static FString MakeProposalArtifactKey(const FString& RequestId, const FHCIAgentPlanStep& ResolvedStep);
+};
+
+// Resumable form of ExecutePlan: Start() runs the plan-level precheck and each ExecuteNextStep() runs one step,
+// so an editor ticker can spread a long plan across frames. The plan, registry, validation context and options
+// are held by reference and must outlive the run.
+class HCIRUNTIME_API FHCIAgentExecutorRun
+{
+public:
+	FHCIAgentExecutorRun(
+		const FHCIAgentPlan& InPlan,
+		const FHCIToolRegistry& InToolRegistry,
+		const FHCIAgentPlanValidationContext& InValidationContext,
+		const FHCIAgentExecutorOptions& InOptions);
+
+	// Returns false when the plan is rejected by the validator (the run is then already finished).
+	bool Start();
+	// Returns true while more steps remain.
+	bool ExecuteNextStep();
+
+	bool IsFinished() const { return bFinished; }
+	bool WasRunOk() const { return bRunOk; }
+	int32 GetNextStepIndex() const { return NextStepIndex; }
+	int32 GetTotalSteps() const { return Plan.Steps.Num(); }
+	const FHCIAgentExecutorRunResult& GetResult() const { return Result; }
+	FHCIAgentExecutorRunResult ConsumeResult();
+
+private:
+	bool IsCancellationRequested() const;
+	bool UsesSourceControlCheckout() const;
+	void CheckOutPackages(TConstArrayView<FString> PackageNames);
+	void PreflightSourceControlCheckout();
+	bool ResolveStepCheckout(const FHCIAgentPlanStep& ResolvedStep, FHCIAgentExecutorStepResult& StepResult);
+	bool TryRunToolActionMemoized(
+		int32 StepIndex,
+		const FHCIToolDescriptor& Tool,
+		const FHCIAgentPlanStep& ResolvedStep,
+		FHCIAgentExecutorStepResult& StepResult);
+	void AddSkippedRows(int32 FromIndex, const TCHAR* Reason);
+	void FinishCancelled(int32 FirstUnexecutedStepIndex);
+	void FinishAllStepsExecuted();
+	void Finish(bool bInRunOk);
+
+	const FHCIAgentPlan& Plan;
+	const FHCIToolRegistry& ToolRegistry;
+	const FHCIAgentPlanValidationContext& ValidationContext;
+	const FHCIAgentExecutorOptions& Options;
+
+	FHCIAgentExecutorRunResult Result;
+	TMap<FString, TMap<FString, FString>> StepEvidenceContext;
+	TArray<FHCIAgentPlanStep> ResolvedValidatedPrefixSteps;
+	TSet<FString> CheckoutRequestedPackages;
+	TMap<FString, FString> CheckoutFailureByPackage;
+	int32 NextStepIndex = 0;
+	bool bStarted = false;
+	bool bFinished = false;
+	bool bRunOk = false;
+	bool bUsePerStepValidation = false;
+	bool bSawFailure = false;
+	bool bAnySimulatedStep = false;
+	bool bAnyToolActionExecuted = false;
 };
 
 
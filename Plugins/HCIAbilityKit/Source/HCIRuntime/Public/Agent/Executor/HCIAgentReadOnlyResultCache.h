@@ -0,0 +1,53 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FJsonObject;
+
+// Session memo of read-only tool results. Entries are keyed by tool name and canonicalized args (object
+// keys sorted) and stamped with the owner's change generation; bumping the generation makes every earlier
+// entry a miss. The editor bumps it on AssetRegistry added/removed/renamed/updated events, which is why
+// only tools whose output depends on args and registry state alone are memoizable.
+class HCIRUNTIME_API FHCIAgentReadOnlyResultCache
+{
+public:
+	struct FEntry
+	{
+		FString Reason;
+		int32 TargetCountEstimate = 0;
+		TMap<FString, FString> Evidence;
+	};
+
+	explicit FHCIAgentReadOnlyResultCache(int32 InMaxEntries = 64);
+
+	// ScanAssets, ScanMeshTriangleCount, SearchPath. Level scans depend on actors, not the registry.
+	static bool IsMemoizableTool(FName ToolName);
+	static FString MakeKey(FName ToolName, const TSharedPtr<FJsonObject>& Args);
+
+	void BumpGeneration() { ++Generation; }
+	uint64 GetGeneration() const { return Generation; }
+
+	// Counts a hit or a miss; entries from an older generation are dropped on lookup.
+	const FEntry* Find(const FString& Key);
+	void Store(const FString& Key, FEntry Entry);
+	void Reset();
+
+	int32 Num() const { return EntriesByKey.Num(); }
+	int32 GetHitCount() const { return HitCount; }
+	int32 GetMissCount() const { return MissCount; }
+
+private:
+	struct FSlot
+	{
+		FEntry Entry;
+		uint64 Generation = 0;
+		uint64 LastUsed = 0;
+	};
+
+	TMap<FString, FSlot> EntriesByKey;
+	TAtomic<uint64> Generation{0};
+	uint64 UseCounter = 0;
+	int32 MaxEntries = 64;
+	int32 HitCount = 0;
+	int32 MissCount = 0;
+};
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Checkout seam behind the executor's source_control preflight gate. The executor hands over every
+// package a write step will touch in one call, so a provider can issue a single batched operation
+// instead of one round trip per file. HCIRuntime stays free of editor modules: the editor binds this
+// to ISourceControlProvider, tests and offline tooling use FHCIInMemorySourceControlCheckout.
+class HCIRUNTIME_API IHCIAgentSourceControlCheckout
+{
+public:
+	virtual ~IHCIAgentSourceControlCheckout() = default;
+
+	// PackageNames are long package names (/Game/...). Every package absent from OutFailureReasonByPackage
+	// is writable afterwards (checked out, already checked out, or not under source control).
+	virtual void CheckOutPackages(
+		const TArray<FString>& PackageNames,
+		TMap<FString, FString>& OutFailureReasonByPackage) = 0;
+};
+
+// In-memory provider: every package is checkable-out unless locked. Counts batches so callers can
+// assert that a plan costs one provider operation rather than one per package.
+class HCIRUNTIME_API FHCIInMemorySourceControlCheckout final : public IHCIAgentSourceControlCheckout
+{
+public:
+	void LockPackage(const FString& PackageName, const FString& Reason = TEXT("checked_out_by_other_user"));
+	bool IsCheckedOut(const FString& PackageName) const;
+	int32 GetBatchCount() const { return BatchCount; }
+	int32 GetRequestedPackageCount() const { return RequestedPackageCount; }
+
+	virtual void CheckOutPackages(
+		const TArray<FString>& PackageNames,
+		TMap<FString, FString>& OutFailureReasonByPackage) override;
+
+private:
+	TMap<FString, FString> LockReasonByPackage;
+	TSet<FString> CheckedOutPackages;
+	int32 BatchCount = 0;
+	int32 RequestedPackageCount = 0;
+};
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Agent/Executor/HCIAgentExecutor.h"
+#include "Containers/Ticker.h"
+
+// Speculative pre-execution of a likely plan's read-only steps while the real plan is still being built (the
+// keyword plan while an LLM request is pending). Only steps of memoizable tools that the registry marks read-only
+// and whose args carry no pipeline variables are kept. Each runs as a one-step dry run into the options'
+// ReadOnlyResultCache, so identical steps of the real plan are served from the cache instead of running again.
+// Reconcile() drops pending steps the real plan does not contain and cancels the run once none are left.
+class HCIRUNTIME_API FHCIAgentSpeculativeReadOnlyRun : public TSharedFromThis<FHCIAgentSpeculativeReadOnlyRun>
+{
+public:
+	struct FStats
+	{
+		int32 SpeculatedSteps = 0;
+		int32 ExecutedSteps = 0;
+		// Pending steps dropped because the real plan does not contain them.
+		int32 DroppedSteps = 0;
+		// Real-plan steps whose cache key matches a speculated step.
+		int32 MatchedSteps = 0;
+		bool bCancelled = false;
+	};
+
+	// Speculable subset of LikelyPlan's steps in plan order, one per cache key.
+	static TArray<FHCIAgentPlanStep> SelectSpeculativeSteps(const FHCIAgentPlan& LikelyPlan, const FHCIToolRegistry& ToolRegistry);
+
+	// Null when nothing is speculable or Options has no ReadOnlyResultCache. Options supplies ToolActions and the
+	// cache; the run always executes as a gate-free dry run with its own cancellation token.
+	static TSharedPtr<FHCIAgentSpeculativeReadOnlyRun> Create(
+		const FHCIAgentPlan& LikelyPlan,
+		const FHCIToolRegistry& ToolRegistry,
+		const FHCIAgentExecutorOptions& Options);
+
+	~FHCIAgentSpeculativeReadOnlyRun();
+
+	// Runs the pending steps one per core ticker frame; without it the caller drives ExecuteNextStep().
+	void StartTicking();
+	// Returns true while more steps remain.
+	bool ExecuteNextStep();
+	// Returns the number of real-plan steps that match a speculated step (already cached or still pending).
+	int32 Reconcile(const FHCIAgentPlan& RealPlan);
+	void Cancel();
+
+	bool IsFinished() const { return Stats.bCancelled || PendingSteps.Num() == 0; }
+	const FStats& GetStats() const { return Stats; }
+	const FString& GetRequestId() const { return RequestId; }
+
+private:
+	FHCIAgentSpeculativeReadOnlyRun(const FHCIAgentPlan& LikelyPlan, const FHCIToolRegistry& InToolRegistry, const FHCIAgentExecutorOptions& InOptions);
+
+	void StopTicking();
+
+	const FHCIToolRegistry& ToolRegistry;
+	FHCIAgentExecutorOptions Options;
+	FString RequestId;
+	FString Intent;
+	int32 PlanVersion = 1;
+	TArray<FHCIAgentPlanStep> PendingSteps;
+	TSet<FString> SpeculatedKeys;
+	FStats Stats;
+	FTSTicker::FDelegateHandle TickerHandle;
+};
@@ -13,6 +13,45 @@ struct HCIRUNTIME_API FHCIAgentLlmProviderConfig
 	bool bEnableThinking = false;
 	bool bStream = false;
 	int32 HttpTimeoutMs = 12000;
+
+	// Filled when llm_router.local.json picked the model; outcomes are reported back under this key.
+	FString RouterConfigPath;
+
+	// Optional hedge leg: a second model fired after HedgeDelayMs if the primary has not answered yet.
+	bool bHedgeEnabled = false;
+	FString HedgeModel;
+	FString HedgeApiUrl;
+	int32 HedgeDelayMs = 0;
+};
+
+struct HCIRUNTIME_API FHCIAgentLlmModelOutcome
+{
+	FString RouterConfigPath;
+	FString Model;
+	bool bSucceeded = false;
+	double LatencyMs = 0.0;
+	bool bHedgeLeg = false;
+	bool bWonRace = false;
+};
+
+struct HCIRUNTIME_API FHCIAgentLlmRouterModelMetrics
+{
+	FString RouterConfigPath;
+	FString Strategy;
+	FString Model;
+	double StaticWeight = 0.0;
+	double EffectiveWeight = 0.0;
+	double EwmaLatencyMs = 0.0;
+	double EwmaErrorRate = 0.0;
+	double P90LatencyMs = 0.0;
+	double P95LatencyMs = 0.0;
+	int32 SampleCount = 0;
+	int32 SuccessCount = 0;
+	int32 FailureCount = 0;
+	int32 SelectedCount = 0;
+	int32 HedgeLaunchCount = 0;
+	int32 HedgeWinCount = 0;
+	bool bEjected = false;
 };
 
 class HCIRUNTIME_API FHCIAgentLlmClient
@@ -42,6 +81,12 @@ public:
 		FString& OutErrorCode,
 		FString& OutError);
 
+	// Feeds one finished request (success or failure, with wall-clock latency) into the online router stats.
+	static void ReportModelOutcome(const FHCIAgentLlmModelOutcome& Outcome);
+
+	static TArray<FHCIAgentLlmRouterModelMetrics> GetRouterMetricsSnapshot();
+	static bool SerializeRouterMetricsToJson(FString& OutJsonText);
+
 	static void ResetRoutingStateForTesting();
 };
 
@@ -5,6 +5,7 @@
 
 struct FHCIAgentPlan;
 class FHCIToolRegistry;
+class FHCIAgentExecutionCancellation;
 
 enum class EHCIAgentPlannerLlmMockMode : uint8
 {
@@ -23,6 +24,34 @@ struct HCIRUNTIME_API FHCIAgentPlannerEnvAssetEntry
 	int64 SizeBytes = -1;
 };
 
+struct HCIRUNTIME_API FHCIAgentPlannerEnvClassCount
+{
+	FString AssetClass;
+	int32 Count = 0;
+};
+
+struct HCIRUNTIME_API FHCIAgentPlannerEnvFolderCount
+{
+	// Package path relative to the scan root ("" for the root itself), e.g. "Props/Rocks".
+	FString Folder;
+	// Assets directly in this folder.
+	int32 Count = 0;
+};
+
+// Bounded ENV_CONTEXT view of one scan root: only the first MaxAssetRows assets (by ObjectPath) are kept,
+// while counts, class histogram, folder counts and size totals cover every asset under the root.
+struct HCIRUNTIME_API FHCIAgentPlannerEnvSnapshot
+{
+	FString ScanRoot;
+	int32 TotalAssetCount = 0;
+	int64 TotalSizeBytes = 0;
+	int32 SizedAssetCount = 0;
+	TArray<FHCIAgentPlannerEnvClassCount> ClassHistogram;
+	TArray<FHCIAgentPlannerEnvFolderCount> FolderCounts;
+	TArray<FHCIAgentPlannerEnvAssetEntry> Assets;
+	bool bFromCache = false;
+};
+
 struct HCIRUNTIME_API FHCIAgentPlannerBuildOptions
 {
 	bool bPreferLlm = false;
@@ -45,10 +74,21 @@ struct HCIRUNTIME_API FHCIAgentPlannerBuildOptions
 	// Optional extra context injected into the prompt ENV_CONTEXT. Intended for structured external signals
 	// (e.g. latest ingest batch manifest summary) to reduce user-side "context engineering".
 	FString ExtraEnvContextText;
-	TFunction<bool(const FString&, TArray<FHCIAgentPlannerEnvAssetEntry>&, FString&)> ScanAssetsForEnvContext;
+	// Candidate rows requested from the scan; how many of them reach the prompt is decided by EnvContextTokenBudget.
+	int32 EnvContextMaxAssetRows = 400;
+	// Estimated-token ceiling for the encoded scan snapshot (see FHCIPlannerEnvContextEncoder).
+	int32 EnvContextTokenBudget = 1200;
+	// (ScanRoot, UserText, MaxAssetRows, OutSnapshot, OutError). When the root holds more than MaxAssetRows assets,
+	// the kept rows should be the most relevant to UserText (see FHCIPlannerEnvRelevanceQuery).
+	TFunction<bool(const FString&, const FString&, int32, FHCIAgentPlannerEnvSnapshot&, FString&)> ScanAssetsForEnvContext;
 	int32 LlmHttpTimeoutMs = 12000;
 	bool bLlmEnableThinking = false;
 	bool bLlmStream = false;
+	// Hedged requests still require "hedge": {"enabled": true} in llm_router.local.json; this only allows turning them off per call.
+	bool bLlmEnableHedging = true;
+	// Async real_http only: requesting it detaches this caller from the in-flight request (its callback is not
+	// invoked). Identical requests share one attempt, so the HTTP call is only aborted once every caller detached.
+	TSharedPtr<FHCIAgentExecutionCancellation> Cancellation;
 };
 
 struct HCIRUNTIME_API FHCIAgentPlannerResultMetadata
@@ -62,9 +102,19 @@ struct HCIRUNTIME_API FHCIAgentPlannerResultMetadata
 	bool bRetryUsed = false;
 	bool bCircuitBreakerOpen = false;
 	int32 ConsecutiveLlmFailures = 0;
+	FString LlmModel;
+	bool bLlmHedgeLaunched = false;
+	bool bLlmHedgeWon = false;
 	bool bEnvContextInjected = false;
 	int32 EnvContextAssetCount = 0;
 	FString EnvContextScanRoot;
+	// Estimated prompt tokens of the injected scan snapshot, and of the same rows as a flat path list.
+	int32 EnvContextTokenEstimate = 0;
+	int32 EnvContextFlatTokenEstimate = 0;
+	// Callers served by the same in-flight LLM attempt (1 when it was not shared); bLlmRequestCoalesced marks
+	// callers that joined an attempt started by an earlier identical request.
+	int32 LlmCoalescedCallerCount = 1;
+	bool bLlmRequestCoalesced = false;
 };
 
 struct HCIRUNTIME_API FHCIAgentPlannerMetricsSnapshot
@@ -0,0 +1,138 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Common/HCIRequestArena.h"
+
+// Term groups the keyword planner routes on. Vocabulary files refer to them by snake_case name
+// (see FHCIKeywordIntentMatcher::GetGroupName); new terms can be added without recompiling, new groups cannot.
+enum class EHCIKeywordIntentGroup : uint8
+{
+	OrganizeVerb,
+	NormalizeVerb,
+	TempScope,
+	FolderNoun,
+	ScanVerb,
+	LevelNoun,
+	LevelIssue,
+	TriangleNoun,
+	InspectVerb,
+	TextureNoun,
+	LodNoun,
+	Identity,
+	Capability,
+	Greeting,
+	CharacterNoun,
+	ArtNoun,
+	// Positional groups: their hits are also recorded with offsets so parameters can be bound to them.
+	SizeKeyword,
+	SizeConnector,
+	Count
+};
+
+// Half-open character range [Start, End) in the matched text.
+struct FHCIKeywordSpan
+{
+	int32 Start = 0;
+	int32 End = 0;
+};
+
+struct FHCIKeywordHit
+{
+	EHCIKeywordIntentGroup Group = EHCIKeywordIntentGroup::Count;
+	FHCIKeywordSpan Span;
+};
+
+// Default-allocated for general callers; the planner uses the arena variant inside its request scope.
+template <typename AllocatorType>
+struct THCIKeywordMatchResult
+{
+	uint64 GroupMask = 0;
+	int32 TermHitCount = 0;
+	// "/Game/..." tokens in text order; a bare "Game/..." gets its leading slash restored.
+	TArray<FString, AllocatorType> PathTokens;
+	// Unsigned decimal runs outside path tokens, in text order; NumberSpans[i] locates Numbers[i].
+	TArray<int64, AllocatorType> Numbers;
+	TArray<FHCIKeywordSpan, AllocatorType> NumberSpans;
+	// Hits of the positional groups (SizeKeyword, SizeConnector) in order of their end offset.
+	TArray<FHCIKeywordHit, AllocatorType> PositionalHits;
+
+	bool Has(const EHCIKeywordIntentGroup Group) const
+	{
+		return (GroupMask & (uint64(1) << static_cast<uint8>(Group))) != 0;
+	}
+
+	void Reset()
+	{
+		GroupMask = 0;
+		TermHitCount = 0;
+		PathTokens.Reset();
+		Numbers.Reset();
+		NumberSpans.Reset();
+		PositionalHits.Reset();
+	}
+};
+
+using FHCIKeywordMatchResult = THCIKeywordMatchResult<FDefaultAllocator>;
+// Requires an open FHCIRequestArenaScope for as long as it lives.
+using FHCIKeywordArenaMatchResult = THCIKeywordMatchResult<THCIRequestArenaAllocator<>>;
+
+/**
+ * Aho-Corasick automaton over the keyword planner vocabulary. One pass over the user text labels every
+ * group hit, path token and number, so the per-character cost does not grow with the number of terms.
+ * Matching is case-insensitive substring matching, the same contract as the old Contains cascade.
+ *
+ * The built-in vocabulary is always present so the offline fallback keeps routing without any file;
+ * keyword_vocabulary.json in the planner skill bundle and Saved/HCIAbilityKit/Config/keyword_vocabulary.local.json
+ * add terms on top and are picked up again when their timestamp changes.
+ */
+class HCIRUNTIME_API FHCIKeywordIntentMatcher
+{
+public:
+	FHCIKeywordIntentMatcher();
+
+	// Built-in plus file vocabulary, compiled. Thread-safe; the returned matcher is immutable.
+	static TSharedRef<const FHCIKeywordIntentMatcher> GetShared();
+
+	static const TCHAR* GetGroupName(EHCIKeywordIntentGroup Group);
+	static bool TryParseGroupName(const FString& Name, EHCIKeywordIntentGroup& OutGroup);
+
+	void AddBuiltInVocabulary();
+	// Terms are lowercased and trimmed; empty terms are ignored. Invalidates a compiled automaton.
+	void AddTerm(EHCIKeywordIntentGroup Group, const FString& Term);
+	// {"version": 1, "groups": {"texture_noun": ["纹理", ...], ...}}. Unknown group names are skipped and reported.
+	bool AddTermsFromJson(const FString& JsonText, FString& OutError);
+	void Compile();
+
+	// Requires Compile().
+	void Match(const FString& Text, FHCIKeywordMatchResult& OutResult) const;
+	void Match(const FString& Text, FHCIKeywordArenaMatchResult& OutResult) const;
+
+	bool IsCompiled() const { return bCompiled; }
+	int32 GetTermCount() const { return TermCount; }
+	int32 GetStateCount() const { return States.Num(); }
+
+private:
+	struct FState
+	{
+		int32 Fail = 0;
+		// Length of the path from the root, i.e. of a term ending here.
+		int32 Depth = 0;
+		// Terms ending exactly here.
+		uint64 TermMask = 0;
+		int32 TermCount = 0;
+		// TermMask / TermCount plus everything reached through the fail chain; rebuilt by Compile().
+		uint64 OutputMask = 0;
+		int32 OutputCount = 0;
+	};
+
+	int32 FindTransition(int32 State, TCHAR Ch) const;
+	int32 AddState(int32 Parent, TCHAR Ch);
+	template <typename ResultType>
+	void MatchInto(const FString& Text, ResultType& OutResult) const;
+
+	// Goto function keyed by (state << 32 | char): one hash probe per step regardless of fan-out.
+	TMap<uint64, int32> Transitions;
+	TArray<FState> States;
+	int32 TermCount = 0;
+	bool bCompiled = false;
+};
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Agent/Planner/HCIAgentPlanner.h"
+
+struct HCIRUNTIME_API FHCIPlannerEnvContextEncodeResult
+{
+	FString Text;
+	int32 TokenEstimate = 0;
+	// The admitted rows rendered as the flat one-full-path-per-row list, for before/after comparisons.
+	int32 FlatTokenEstimate = 0;
+	int32 EmittedAssetCount = 0;
+	int32 EmittedFolderCount = 0;
+};
+
+// Relevance of env snapshot rows to the user text: lowercased ASCII terms (3+ characters, scan root segments
+// dropped) and class hints from the keyword vocabulary. Shared by the snapshot producer, which keeps the best
+// rows when the scan has more than MaxAssetRows, and by the encoder, which ranks the rows it was given.
+struct HCIRUNTIME_API FHCIPlannerEnvRelevanceQuery
+{
+	TArray<FString> Terms;
+	TArray<FString> ClassHints;
+
+	static FHCIPlannerEnvRelevanceQuery Make(const FString& UserText, const FString& ScanRoot);
+
+	bool IsEmpty() const { return Terms.Num() == 0 && ClassHints.Num() == 0; }
+	// Order-independent identity of the query, for caches keyed by it.
+	FString GetCacheKey() const;
+
+	// An asset scores ScoreName + ScoreFolder + ScoreClass; zero everywhere for an empty query.
+	int32 ScoreName(const FString& AssetName) const;
+	int32 ScoreFolder(const FString& RelativeFolder) const;
+	int32 ScoreClass(const FString& AssetClass) const;
+};
+
+/**
+ * ENV_CONTEXT encoder for planner snapshots. Paths are emitted as a prefix trie relative to the scan root
+ * (each folder once, with its subtree asset count), assets as "Class: Name[size_bytes]" under their folder.
+ * Candidates are ranked by relevance to the user text (terms hitting asset or folder names, class hints
+ * from the keyword vocabulary) and admitted best-first until the token budget is spent; folders without
+ * admitted assets are still summarized by count while budget remains.
+ */
+class HCIRUNTIME_API FHCIPlannerEnvContextEncoder
+{
+public:
+	static FHCIPlannerEnvContextEncodeResult Encode(
+		const FHCIAgentPlannerEnvSnapshot& Snapshot,
+		const FString& UserText,
+		int32 TokenBudget);
+
+	// Pre-trie format: one "- Name (Class, size_bytes=..., path=...)" row per snapshot asset.
+	static FString SerializeFlat(const FHCIAgentPlannerEnvSnapshot& Snapshot);
+
+	// BPE-style estimate: ~4 characters per ASCII word-run token, one token per punctuation mark and per
+	// non-ASCII character. Only meant to compare encodings against each other and against a budget.
+	static int32 EstimateTokens(FStringView Text);
+};
@@ -4,12 +4,57 @@
 
 class FJsonObject;
 
+// E4013: the run was stopped by the user, between plan steps or between asset batches of a tool action.
+static const TCHAR* const HCIAgentExecutorCancelledErrorCode = TEXT("E4013");
+
+// Cooperative stop flag shared by the UI and a running plan; set from any thread, polled by the executor.
+class HCIRUNTIME_API FHCIAgentExecutionCancellation
+{
+public:
+	void Request() { bRequested = true; }
+	bool IsRequested() const { return bRequested; }
+
+private:
+	TAtomic<bool> bRequested{false};
+};
+
 struct HCIRUNTIME_API FHCIAgentToolActionRequest
 {
+	// Asset loops report progress and poll cancellation once per batch of this many assets.
+	static constexpr int32 AssetBatchSize = 32;
+
 	FString RequestId;
 	FString StepId;
 	FName ToolName;
 	TSharedPtr<FJsonObject> Args;
+
+	// Execute only: the opaque artifact this step's DryRun emitted for the same plan (empty when none).
+	// Actions re-verify each entry against the current asset state and recompute stale ones.
+	FString ProposalArtifact;
+
+	TSharedPtr<const FHCIAgentExecutionCancellation> Cancellation;
+	TFunction<void(int32 /*ProcessedAssets*/, int32 /*TotalAssets*/)> OnAssetProgress;
+
+	// Single-asset write actions poll this once, right before their write.
+	bool IsCancelRequested() const
+	{
+		return Cancellation.IsValid() && Cancellation->IsRequested();
+	}
+
+	// Call after each processed asset, including the last one so progress ends at TotalAssets/TotalAssets;
+	// returns true when the action should stop and report partial results.
+	bool ShouldStopAfterAsset(const int32 ProcessedAssets, const int32 TotalAssets) const
+	{
+		if (ProcessedAssets % AssetBatchSize != 0 && ProcessedAssets != TotalAssets)
+		{
+			return false;
+		}
+		if (OnAssetProgress)
+		{
+			OnAssetProgress(ProcessedAssets, TotalAssets);
+		}
+		return ProcessedAssets < TotalAssets && IsCancelRequested();
+	}
 };
 
 struct HCIRUNTIME_API FHCIAgentToolActionResult
@@ -19,6 +64,9 @@ struct HCIRUNTIME_API FHCIAgentToolActionResult
 	FString Reason;
 	int32 EstimatedAffectedCount = 0;
 	TMap<FString, FString> Evidence;
+
+	// DryRun only: opaque, tool-defined proposal handed back to Execute of the same step.
+	FString ProposalArtifact;
 };
 
 class HCIRUNTIME_API IHCIAgentToolAction
@@ -17,6 +17,7 @@ public:
 
 	virtual void OnConstruction(const FTransform& Transform) override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void Destroyed() override;
 
 	UFUNCTION(CallInEditor, Category = "HCIAudit")
 	void RefreshPreview();
@@ -32,15 +33,9 @@ public:
 	TObjectPtr<UStaticMeshComponent> PreviewMeshComponent;
 
 private:
+	// Routes through UHCIPreviewRegistrySubsystem (next-tick, async mesh load); synchronous without one or in
+	// worlds the registry does not track (game, inactive).
 	void ApplyPreviewMesh();
-
-#if WITH_EDITOR
-	void RebindObservedAbilityAsset();
-	void HandleObservedObjectPropertyChanged(UObject* ChangedObject, struct FPropertyChangedEvent& PropertyChangedEvent);
-
-	TWeakObjectPtr<UHCIAsset> ObservedAbilityAsset;
-	FDelegateHandle ObservedAssetPropertyChangedHandle;
-#endif
 };
 
 
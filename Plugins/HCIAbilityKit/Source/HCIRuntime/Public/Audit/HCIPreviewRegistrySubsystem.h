@@ -0,0 +1,94 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Engine/StreamableManager.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "HCIPreviewRegistrySubsystem.generated.h"
+
+class AActor;
+class AHCIPreviewActor;
+class UHCIAsset;
+class UInstancedStaticMeshComponent;
+class UStaticMesh;
+class UWorld;
+
+/**
+ * 预览 Actor 注册表：全局只订阅一次资产属性变更，按 UHCIAsset 反查依赖的 AHCIPreviewActor。
+ * 刷新请求合并到下一帧统一处理，代表性网格走异步加载；同一 World 内预览数达到
+ * HCI.Preview.InstancedThreshold 时改用每网格一个 ISM 组件集中绘制。
+ */
+UCLASS()
+class HCIRUNTIME_API UHCIPreviewRegistrySubsystem : public UEngineSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UHCIPreviewRegistrySubsystem* Get();
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// Registers (or re-keys after an AbilityAsset change) and queues a refresh. Only actors in editor, editor
+	// preview and PIE worlds are tracked; returns false for any other world, where the actor applies its mesh itself.
+	bool RegisterActor(AHCIPreviewActor* Actor);
+	void UnregisterActor(AHCIPreviewActor* Actor);
+
+	void RequestRefresh(AHCIPreviewActor* Actor);
+	// Queues every actor observing Asset; returns how many were queued.
+	int32 RequestRefreshForAsset(const UHCIAsset* Asset);
+	// Applies queued refreshes and instance rebuilds now instead of waiting for the next tick.
+	void FlushPendingRefreshes();
+
+	int32 GetRegisteredActorCount() const { return Records.Num(); }
+	int32 GetDependentActorCount(const UHCIAsset* Asset) const;
+	bool IsWorldInstanced(const UWorld* World) const;
+	// Transient actor owning the ISM components of an instanced world; null otherwise.
+	AActor* GetWorldInstanceHost(const UWorld* World) const;
+
+private:
+	struct FActorRecord
+	{
+		TWeakObjectPtr<AHCIPreviewActor> Actor;
+		TObjectKey<UHCIAsset> Asset;
+		TObjectKey<UWorld> World;
+	};
+
+	struct FWorldInstancing
+	{
+		TWeakObjectPtr<AActor> HostActor;
+		TMap<TObjectKey<UStaticMesh>, TWeakObjectPtr<UInstancedStaticMeshComponent>> ComponentsByMesh;
+	};
+
+	void RemoveRecord(const TObjectKey<AHCIPreviewActor>& ActorKey);
+	void ScheduleFlush();
+	bool HandleFlushTick(float DeltaTime);
+	void ApplyMesh(AHCIPreviewActor* Actor, UStaticMesh* Mesh, bool bInstancedWorld);
+	void RequestMeshLoad(const FSoftObjectPath& MeshPath, AHCIPreviewActor* Actor);
+	void HandleMeshLoaded(FSoftObjectPath MeshPath);
+	void RebuildWorldInstances(UWorld* World);
+	void DestroyWorldInstancing(const TObjectKey<UWorld>& WorldKey);
+	void HandleWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+
+#if WITH_EDITOR
+	void HandleObjectPropertyChanged(UObject* ChangedObject, struct FPropertyChangedEvent& PropertyChangedEvent);
+	FDelegateHandle PropertyChangedHandle;
+#endif
+
+	TMap<TObjectKey<AHCIPreviewActor>, FActorRecord> Records;
+	TMap<TObjectKey<UHCIAsset>, TArray<TObjectKey<AHCIPreviewActor>>> ActorsByAsset;
+	TMap<TObjectKey<UWorld>, int32> ActorCountByWorld;
+
+	TSet<TObjectKey<AHCIPreviewActor>> PendingRefresh;
+	// Instanced worlds that lost an actor; rebuilt once by the next flush however many actors left.
+	TSet<TObjectKey<UWorld>> WorldsPendingRebuild;
+	FTSTicker::FDelegateHandle FlushTickerHandle;
+
+	FStreamableManager StreamableManager;
+	TMap<FSoftObjectPath, TSharedPtr<FStreamableHandle>> InFlightLoads;
+	TMap<FSoftObjectPath, TArray<TObjectKey<AHCIPreviewActor>>> ActorsWaitingOnMesh;
+
+	TMap<TObjectKey<UWorld>, FWorldInstancing> InstancingByWorld;
+	FDelegateHandle WorldCleanupHandle;
+};
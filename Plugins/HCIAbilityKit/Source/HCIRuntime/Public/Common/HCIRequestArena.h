@@ -0,0 +1,124 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Set.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/MemStack.h"
+
+// Per-request counters for the transient arena. Planning, validation and execution of the same
+// RequestId accumulate into one record, kept apart from other requests that run in between.
+struct HCIRUNTIME_API FHCIRequestArenaStats
+{
+	FString RequestId;
+	// Outermost scopes closed for this request (one per planner / validator / executor entry).
+	int32 ScopeCount = 0;
+	int32 AllocationCount = 0;
+	int64 AllocatedBytes = 0;
+	// Highest arena footprint of any single outermost scope, in bytes.
+	int64 PeakBytes = 0;
+};
+
+/**
+ * Request-scoped linear arena for short-lived scratch containers (package name lists, seen-sets,
+ * token lists). It is a thin layer over the calling thread's FMemStack: an FHCIRequestArenaScope pushes
+ * a mark, THCIArenaArray / THCIArenaSet bump-allocate behind it, and the whole block is released when the
+ * scope closes. Opt-in per call site: every function that declares an arena container opens a scope
+ * first (nested scopes are cheap and roll up into the outermost one), and anything that must outlive the
+ * scope is copied out explicitly with FHCIRequestArena::Promote.
+ */
+class HCIRUNTIME_API FHCIRequestArena
+{
+public:
+	// Records are kept for the last MaxTrackedRequests request ids; false once RequestId was evicted or never closed a scope.
+	static constexpr int32 MaxTrackedRequests = 32;
+
+	static bool GetRequestStats(const FString& RequestId, FHCIRequestArenaStats& OutStats);
+	static void Reset();
+
+	// Arena containers die with their scope: copy into a heap container before handing data to a report,
+	// a provider or anything else that may keep it.
+	template <typename ElementType, typename AllocatorType>
+	static TArray<ElementType> Promote(const TArray<ElementType, AllocatorType>& ArenaArray)
+	{
+		return TArray<ElementType>(ArenaArray);
+	}
+
+	// Called by THCIRequestArenaAllocator; counts toward the outermost open scope on this thread.
+	static void NoteAllocation(SIZE_T NumBytes);
+
+private:
+	friend class FHCIRequestArenaScope;
+
+	static void Commit(const FString& RequestId, int32 AllocationCount, int64 AllocatedBytes, int64 PeakBytes);
+
+	static FCriticalSection Lock;
+	static TMap<FString, FHCIRequestArenaStats> StatsByRequestId;
+	// Request ids oldest first; the front is evicted when a new id would exceed MaxTrackedRequests.
+	static TArray<FString> RequestOrder;
+};
+
+class HCIRUNTIME_API FHCIRequestArenaScope
+{
+public:
+	explicit FHCIRequestArenaScope(const FString& InRequestId);
+	~FHCIRequestArenaScope();
+
+	FHCIRequestArenaScope(const FHCIRequestArenaScope&) = delete;
+	FHCIRequestArenaScope& operator=(const FHCIRequestArenaScope&) = delete;
+
+	static bool IsActive();
+
+private:
+	friend class FHCIRequestArena;
+
+	FMemMark Mark;
+	// Only the outermost scope on a thread keeps counters; nested scopes just release their own block.
+	bool bOutermost = false;
+	FString RequestId;
+	int64 BaseBytes = 0;
+	int32 AllocationCount = 0;
+	int64 AllocatedBytes = 0;
+	int64 PeakBytes = 0;
+};
+
+// FMemStack-backed allocator that reports each growth to the open FHCIRequestArenaScope.
+template <uint32 Alignment = DEFAULT_ALIGNMENT>
+class THCIRequestArenaAllocator : public TMemStackAllocator<Alignment>
+{
+	using Super = TMemStackAllocator<Alignment>;
+
+public:
+	template <typename ElementType>
+	class ForElementType : public Super::template ForElementType<ElementType>
+	{
+		using ElementSuper = typename Super::template ForElementType<ElementType>;
+
+	public:
+		template <typename... ArgTypes>
+		void ResizeAllocation(
+			const int32 PreviousNumElements,
+			const int32 NumElements,
+			const SIZE_T NumBytesPerElement,
+			ArgTypes... Args)
+		{
+			checkSlow(FHCIRequestArenaScope::IsActive());
+			ElementSuper::ResizeAllocation(PreviousNumElements, NumElements, NumBytesPerElement, Args...);
+			if (NumElements > 0)
+			{
+				FHCIRequestArena::NoteAllocation(NumElements * NumBytesPerElement);
+			}
+		}
+	};
+};
+
+template <typename ElementType>
+using THCIArenaArray = TArray<ElementType, THCIRequestArenaAllocator<>>;
+
+template <typename ElementType>
+using THCIArenaSet = TSet<
+	ElementType,
+	DefaultKeyFuncs<ElementType>,
+	TSetAllocator<TSparseArrayAllocator<THCIRequestArenaAllocator<>, THCIRequestArenaAllocator<>>, THCIRequestArenaAllocator<>>>;
+
+#define HCI_REQUEST_ARENA_SCOPE(RequestId) \
+	FHCIRequestArenaScope PREPROCESSOR_JOIN(HCIRequestArenaScope_, __LINE__)(RequestId)
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Trace/Trace.h"
+
+// "HCI" trace channel: enable with -trace=cpu,hci (or Trace.Enable HCI) and open the session in Unreal Insights.
+UE_TRACE_CHANNEL_EXTERN(HCIChannel, HCIRUNTIME_API)
+
+struct HCIRUNTIME_API FHCIStageLatencySummary
+{
+	FString Stage;
+	// Samples recorded outside any request scope (startup scans, console commands, worker threads).
+	bool bUnscoped = false;
+	int32 SampleCount = 0;
+	double TotalMs = 0.0;
+	double P50Ms = 0.0;
+	double P95Ms = 0.0;
+	double MaxMs = 0.0;
+	// One count per FHCIStageLatencyRecorder::GetBucketUpperBoundsMs() entry, plus a trailing overflow bucket.
+	TArray<int32> BucketCounts;
+};
+
+/**
+ * Keeps per-stage wall-clock samples tagged with a request serial, so HCI.TraceLatencyHistogram can
+ * summarize the last N agent requests. Stages recorded outside any request scope share serial 0 and
+ * are summarized in their own rows. The active serial is tracked per thread, so work fanned out to
+ * task-graph workers is not attributed to whatever request the game thread has open.
+ */
+class HCIRUNTIME_API FHCIStageLatencyRecorder
+{
+public:
+	static constexpr int32 MaxSamplesPerStage = 4096;
+
+	static FHCIStageLatencyRecorder& Get();
+	static TConstArrayView<double> GetBucketUpperBoundsMs();
+
+	// A new RequestId opens a new serial; repeating the latest one (plan then execute) reuses it.
+	uint64 EnterRequest(const FString& RequestId);
+	// Makes PreviousSerial the calling thread's active one again; 0 means outside any request.
+	void LeaveRequest(uint64 PreviousSerial);
+	// Serial that samples recorded now on the calling thread are tagged with.
+	uint64 GetCurrentRequestSerial() const;
+	// Most recently opened serial, whether or not its scope is still active.
+	uint64 GetLatestRequestSerial() const;
+
+	void Record(FName Stage, double DurationMs);
+	// Summaries sorted by total time, descending; unscoped rows are always included.
+	void Summarize(int32 LastRequestCount, TArray<FHCIStageLatencySummary>& OutSummaries) const;
+	void Reset();
+
+private:
+	struct FSample
+	{
+		uint64 RequestSerial = 0;
+		double DurationMs = 0.0;
+	};
+
+	struct FStageSamples
+	{
+		TArray<FSample> Ring;
+		int32 NextIndex = 0;
+	};
+
+	mutable FCriticalSection Lock;
+	TMap<FName, FStageSamples> SamplesByStage;
+	FString LatestRequestId;
+	uint64 LatestRequestSerial = 0;
+	TMap<uint32, uint64> CurrentRequestSerialByThread;
+};
+
+class HCIRUNTIME_API FHCIStageLatencyScope
+{
+public:
+	explicit FHCIStageLatencyScope(FName InStage)
+		: Stage(InStage)
+		, StartCycles(FPlatformTime::Cycles64())
+	{
+	}
+	~FHCIStageLatencyScope();
+
+private:
+	FName Stage;
+	uint64 StartCycles = 0;
+};
+
+// Tags samples with RequestId's serial until the scope ends, then restores the enclosing serial.
+class HCIRUNTIME_API FHCITraceRequestScope
+{
+public:
+	explicit FHCITraceRequestScope(const FString& RequestId)
+		: PreviousSerial(FHCIStageLatencyRecorder::Get().GetCurrentRequestSerial())
+	{
+		FHCIStageLatencyRecorder::Get().EnterRequest(RequestId);
+	}
+	~FHCITraceRequestScope();
+
+private:
+	uint64 PreviousSerial = 0;
+};
+
+// Static stage name: an Insights CPU event on the HCI channel plus a latency sample.
+#define HCI_TRACE_SCOPE(StageName) \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(StageName, HCIChannel); \
+	static const FName PREPROCESSOR_JOIN(HCITraceStageName_, __LINE__)(StageName); \
+	FHCIStageLatencyScope PREPROCESSOR_JOIN(HCITraceStageScope_, __LINE__)(PREPROCESSOR_JOIN(HCITraceStageName_, __LINE__))
+
+// Runtime stage name (e.g. per tool): StageText must be an FString.
+#define HCI_TRACE_SCOPE_DYNAMIC(StageText) \
+	TRACE_CPUPROFILER_EVENT_SCOPE_TEXT_ON_CHANNEL(*(StageText), HCIChannel); \
+	FHCIStageLatencyScope PREPROCESSOR_JOIN(HCITraceStageScope_, __LINE__)(FName(*(StageText)))
+
+#define HCI_TRACE_REQUEST_SCOPE(RequestId) \
+	FHCITraceRequestScope PREPROCESSOR_JOIN(HCITraceRequestScope_, __LINE__)(RequestId)
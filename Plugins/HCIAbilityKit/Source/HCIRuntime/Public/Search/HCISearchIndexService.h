@@ -25,13 +25,17 @@ public:
 
 	void RebuildFromAssetRegistry();
 	bool RefreshAsset(const UHCIAsset* Asset);
+	// Batch variant for reimport: one trace scope and one stats update for the whole set.
+	int32 RefreshAssets(TConstArrayView<const UHCIAsset*> Assets);
 	bool RemoveAssetByPath(const FString& AssetPath);
+	int32 RemoveAssetsByPaths(const TArray<FString>& AssetPaths);
 
 	const FHCIAbilitySearchIndex& GetIndex() const;
 	const FHCIAbilitySearchIndexStats& GetStats() const;
 
 private:
 	void Reset();
+	bool RefreshAssetInternal(const UHCIAsset* Asset);
 	void UpdateDocumentStats(const FHCIAbilitySearchDocument& Document, bool bAdd);
 	void UpdateStatsMetadata(const FString& RefreshMode, double DurationMs);
 
@@ -53,22 +53,53 @@ struct HCIRUNTIME_API FHCIAbilitySearchDocument
 };
 
 /**
- * 索引结构：当前只定义结构，不包含资产扫描与刷新流程喵。
+ * 倒排桶：Ids 保持紧凑数组，PositionById 记录下标，删除走 swap-remove 为 O(1)喵。
+ */
+struct HCIRUNTIME_API FHCIAbilitySearchPostingList
+{
+	TArray<FString> Ids;
+	TMap<FString, int32> PositionById;
+
+	int32 Num() const { return Ids.Num(); }
+	bool Contains(const FString& InId) const { return PositionById.Contains(InId); }
+	void Reserve(int32 Count);
+	bool Add(const FString& InId);
+	bool Remove(const FString& InId);
+};
+
+/**
+ * 索引结构：文档表 + 各语义维度倒排桶；token 以驻留 ID 存储喵。
  */
 struct HCIRUNTIME_API FHCIAbilitySearchIndex
 {
 	TMap<FString, FHCIAbilitySearchDocument> DocumentsById;
-	TMap<EHCIAbilityElement, TArray<FString>> IdsByElement;
-	TMap<EHCIAbilityDamageTier, TArray<FString>> IdsByDamageTier;
-	TMap<EHCIAbilityControlProfile, TArray<FString>> IdsByControlProfile;
-	TMap<EHCIAbilityUsageScene, TArray<FString>> IdsByUsageScene;
-	TMap<FString, TArray<FString>> IdsByToken;
+	TMap<EHCIAbilityElement, FHCIAbilitySearchPostingList> IdsByElement;
+	TMap<EHCIAbilityDamageTier, FHCIAbilitySearchPostingList> IdsByDamageTier;
+	TMap<EHCIAbilityControlProfile, FHCIAbilitySearchPostingList> IdsByControlProfile;
+	TMap<EHCIAbilityUsageScene, FHCIAbilitySearchPostingList> IdsByUsageScene;
+	// token 驻留表：TokenIdByText 把文本映射到 TokenTexts/IdsByTokenId 的稳定槽位喵。
+	TMap<FString, int32> TokenIdByText;
+	TArray<FString> TokenTexts;
+	TArray<FHCIAbilitySearchPostingList> IdsByTokenId;
 
 	void Reset();
 	int32 GetDocumentCount() const;
 	bool ContainsId(const FString& InId) const;
 	bool AddDocument(const FHCIAbilitySearchDocument& InDocument);
 	bool RemoveDocumentById(const FString& InId);
+
+	// 批量导入前按待入库文档预留文档表与各倒排桶容量喵。
+	void ReserveForDocuments(const TArray<FHCIAbilitySearchDocument>& IncomingDocuments);
+	// 批量删除：大批量时一次遍历重建倒排桶，而不是逐个 ID 删除喵。
+	int32 RemoveDocumentsByIds(const TArray<FString>& InIds);
+
+	int32 FindTokenId(const FString& Token) const;
+	const FHCIAbilitySearchPostingList* FindTokenPostings(const FString& Token) const;
+
+private:
+	int32 InternToken(const FString& Token);
+	void ReserveBuckets(const TArray<const FHCIAbilitySearchDocument*>& Documents);
+	void RebuildBuckets();
 };
 
 /**
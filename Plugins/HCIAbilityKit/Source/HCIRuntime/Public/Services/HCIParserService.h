@@ -78,6 +78,15 @@ public:
 	 */
 	static bool TryParseKitFile(const FString& FullFilename, FHCIParsedData& OutParsed, FHCIParseError& OutError);
 
+	/**
+	 * 只做文件读取与 JSON/字段校验，不调用 Python 钩子。
+	 * 不触碰 UObject，可在工作线程并行调用（批量重导入的解析阶段）。
+	 */
+	static bool TryParseKitFileWithoutHook(const FString& FullFilename, FHCIParsedData& OutParsed, FHCIParseError& OutError);
+
+	/** 对已解析的数据执行 Python 钩子；未设置钩子时直接返回 true。必须在游戏线程调用。 */
+	static bool RunPythonHook(const FString& FullFilename, FHCIParsedData& InOutParsed, FHCIParseError& OutError);
+
 	/**
 	 * 兼容性接口：将解析错误直接转换为字符串输出
 	 */
@@ -30,6 +30,7 @@ public class HCITests : ModuleRules
 				"Json",
 				"JsonUtilities",
 				"HTTP",
+				"HTTPServer",
 				"Projects",
 				"PythonScriptPlugin"
 			});
@@ -0,0 +1,93 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Agent/Executor/HCIAgentAuditLogWriter.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+static FString HCI_MakeAuditLogWriterTestDir()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("HCI"), TEXT("Tests"), TEXT("AuditLogWriter"), FGuid::NewGuid().ToString(EGuidFormats::Digits));
+}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCIAgentAuditLogWriterOrderTest,
+	"HCI.Editor.AgentExec.AuditLogWriterBuffersInOrderAndFlushesOnShutdown",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCIAgentAuditLogWriterOrderTest::RunTest(const FString& Parameters)
+{
+	const FString TestDir = HCI_MakeAuditLogWriterTestDir();
+	FHCIAgentAuditLogWriterConfig Config;
+	Config.FilePath = FPaths::Combine(TestDir, TEXT("agent_exec_log.jsonl"));
+	Config.FlushIntervalSeconds = 60.0f;
+	Config.FlushThresholdBytes = 1024 * 1024;
+
+	constexpr int32 RecordCount = 200;
+	{
+		FHCIAgentAuditLogWriter Writer(Config);
+		for (int32 Index = 0; Index < RecordCount; ++Index)
+		{
+			FString Error;
+			TestTrue(TEXT("append ok"), Writer.Append(FString::Printf(TEXT("{\"seq\":%d,\"user\":\"美术\"}"), Index), Error));
+		}
+		TestEqual(TEXT("appended records"), Writer.GetStats().AppendedRecords, static_cast<int64>(RecordCount));
+		Writer.Shutdown();
+		TestTrue(TEXT("shutdown drained buffer"), Writer.GetStats().WrittenBytes > 0);
+	}
+
+	TArray<FString> Lines;
+	TestTrue(TEXT("log readable"), FFileHelper::LoadFileToStringArray(Lines, *Config.FilePath));
+	TestEqual(TEXT("line count"), Lines.Num(), RecordCount);
+	for (int32 Index = 0; Index < Lines.Num(); ++Index)
+	{
+		if (!TestEqual(TEXT("line order"), Lines[Index], FString::Printf(TEXT("{\"seq\":%d,\"user\":\"美术\"}"), Index)))
+		{
+			break;
+		}
+	}
+
+	IFileManager::Get().DeleteDirectory(*TestDir, false, true);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCIAgentAuditLogWriterRotationTest,
+	"HCI.Editor.AgentExec.AuditLogWriterRotatesBySize",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCIAgentAuditLogWriterRotationTest::RunTest(const FString& Parameters)
+{
+	const FString TestDir = HCI_MakeAuditLogWriterTestDir();
+	FHCIAgentAuditLogWriterConfig Config;
+	Config.FilePath = FPaths::Combine(TestDir, TEXT("agent_exec_log.jsonl"));
+	Config.MaxFileBytes = 256;
+	Config.MaxRotatedFiles = 2;
+	Config.bUseBackgroundThread = false;
+
+	FHCIAgentAuditLogWriter Writer(Config);
+	const FString Line = FString::ChrN(100, TEXT('x'));
+	for (int32 Index = 0; Index < 12; ++Index)
+	{
+		FString Error;
+		TestTrue(TEXT("append ok"), Writer.Append(Line, Error));
+	}
+	Writer.Shutdown();
+
+	IFileManager& FileManager = IFileManager::Get();
+	TestTrue(TEXT("rotated at least once"), Writer.GetStats().RotationCount >= 3);
+	TestTrue(TEXT("active file within limit"), FileManager.FileSize(*Config.FilePath) <= Config.MaxFileBytes);
+	TestTrue(TEXT("generation 1 kept"), FileManager.FileExists(*Writer.GetRotatedFilePath(1)));
+	TestTrue(TEXT("generation 2 kept"), FileManager.FileExists(*Writer.GetRotatedFilePath(2)));
+	TestFalse(TEXT("generation 3 pruned"), FileManager.FileExists(*Writer.GetRotatedFilePath(3)));
+
+	FileManager.DeleteDirectory(*TestDir, false, true);
+	return true;
+}
+
+#endif
@@ -0,0 +1,138 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Agent/Contracts/HCIAgentContractDigest.h"
+#include "Agent/Executor/HCIDryRunDiff.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Crc.h"
+
+namespace
+{
+static FHCIDryRunDiffReport HCI_MakeDigestReviewReport(const int32 RowCount)
+{
+	FHCIDryRunDiffReport Report;
+	Report.RequestId = TEXT("req_digest_review");
+	for (int32 Index = 0; Index < RowCount; ++Index)
+	{
+		FHCIDryRunDiffItem& Item = Report.DiffItems.AddDefaulted_GetRef();
+		Item.AssetPath = FString::Printf(TEXT("/Game/Art/T_Digest_%d.T_Digest_%d"), Index, Index);
+		Item.Field = FString::Printf(TEXT("step:s%d"), Index);
+		Item.ToolName = (Index % 2) == 0 ? TEXT("SetTextureMaxSize") : TEXT("ScanLevelMeshRisks");
+		Item.Risk = (Index % 3) == 0 ? EHCIDryRunRisk::Write : EHCIDryRunRisk::ReadOnly;
+		Item.ObjectType = (Index % 2) == 0 ? EHCIDryRunObjectType::Asset : EHCIDryRunObjectType::Actor;
+		Item.SkipReason = (Index % 5) == 0 ? TEXT("blocked_by_test") : TEXT("");
+	}
+
+	FHCIDryRunDiff::NormalizeAndFinalize(Report);
+	return Report;
+}
+
+// Reference copy of the canonical-string digest the bridges used before the shared builder.
+static FString HCI_BuildLegacySelectionDigest(const FHCIDryRunDiffReport& Report)
+{
+	FString Canonical;
+	for (int32 RowIndex = 0; RowIndex < Report.DiffItems.Num(); ++RowIndex)
+	{
+		const FHCIDryRunDiffItem& Item = Report.DiffItems[RowIndex];
+		Canonical += FString::Printf(
+			TEXT("%d|%s|%s|%s|%s|%s|%s|%s\n"),
+			RowIndex,
+			*Item.ToolName,
+			*Item.AssetPath,
+			*Item.Field,
+			*FHCIDryRunDiff::RiskToString(Item.Risk),
+			*Item.SkipReason,
+			*FHCIDryRunDiff::ObjectTypeToString(Item.ObjectType),
+			*FHCIDryRunDiff::LocateStrategyToString(Item.LocateStrategy));
+	}
+
+	return FString::Printf(TEXT("crc32_%08X"), FCrc::StrCrc32(*Canonical));
+}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCIAgentContractDigestCrc32CompatTest,
+	"HCI.Editor.AgentContractDigest.Crc32ModeMatchesLegacyCanonicalString",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCIAgentContractDigestCrc32CompatTest::RunTest(const FString& Parameters)
+{
+	const FHCIDryRunDiffReport Report = HCI_MakeDigestReviewReport(64);
+	const FString LegacyDigest = HCI_BuildLegacySelectionDigest(Report);
+
+	TestEqual(
+		TEXT("Crc32 mode should reproduce legacy digests bit-for-bit"),
+		FHCIAgentContractDigest::BuildSelectionDigest(Report, EHCIAgentDigestAlgorithm::Crc32),
+		LegacyDigest);
+	TestTrue(TEXT("Legacy crc32 digests should still verify"), FHCIAgentContractDigest::MatchesSelectionDigest(LegacyDigest, Report));
+
+	FHCIAgentDigestBuilder Builder(EHCIAgentDigestAlgorithm::Crc32);
+	Builder.Field(TEXT("a")).Field(-42).Field(true).Field(FString()).EndRow();
+	TestEqual(
+		TEXT("Builder fields should hash like the Printf canonical row"),
+		Builder.Finalize(),
+		FString::Printf(TEXT("crc32_%08X"), FCrc::StrCrc32(TEXT("a|-42|1|\n"))));
+
+	// Crc32 mode hashes exactly Len characters, so nothing past an embedded NUL is dropped.
+	FHCIAgentDigestBuilder EmbeddedNulA(EHCIAgentDigestAlgorithm::Crc32);
+	EmbeddedNulA.Field(FString(5, TEXT("ab\0cd")));
+	FHCIAgentDigestBuilder EmbeddedNulB(EHCIAgentDigestAlgorithm::Crc32);
+	EmbeddedNulB.Field(FString(5, TEXT("ab\0xy")));
+	TestNotEqual(TEXT("Characters after an embedded NUL should be hashed"), EmbeddedNulA.Finalize(), EmbeddedNulB.Finalize());
+
+	const FHCIDryRunDiffReport EmptyReport;
+	TestEqual(
+		TEXT("Empty selections should keep the legacy zero digest"),
+		FHCIAgentContractDigest::BuildSelectionDigest(EmptyReport, EHCIAgentDigestAlgorithm::Crc32),
+		HCI_BuildLegacySelectionDigest(EmptyReport));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCIAgentContractDigestXxHashDefaultTest,
+	"HCI.Editor.AgentContractDigest.DefaultsToXxHash64AndDetectsTamper",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCIAgentContractDigestXxHashDefaultTest::RunTest(const FString& Parameters)
+{
+	FHCIDryRunDiffReport Report = HCI_MakeDigestReviewReport(32);
+	const FString Digest = FHCIAgentContractDigest::BuildSelectionDigest(Report);
+
+	TestTrue(TEXT("New digests should use the xxh64 prefix"), Digest.StartsWith(TEXT("xxh64_")));
+	TestEqual(TEXT("xxh64 digests should carry 16 hex digits"), Digest.Len(), 6 + 16);
+	TestTrue(TEXT("Digest should verify against its own report"), FHCIAgentContractDigest::MatchesSelectionDigest(Digest, Report));
+	TestFalse(TEXT("Empty digests should never verify"), FHCIAgentContractDigest::MatchesSelectionDigest(FString(), Report));
+
+	Report.DiffItems[7].Field += TEXT("_tampered");
+	TestFalse(TEXT("Row edits should break the digest"), FHCIAgentContractDigest::MatchesSelectionDigest(Digest, Report));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCIAgentContractDigestScopeMemoTest,
+	"HCI.Editor.AgentContractDigest.ScopeMemoizesPerReport",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCIAgentContractDigestScopeMemoTest::RunTest(const FString& Parameters)
+{
+	const FHCIDryRunDiffReport ReportA = HCI_MakeDigestReviewReport(16);
+	const FHCIDryRunDiffReport ReportB = HCI_MakeDigestReviewReport(8);
+
+	FHCIAgentContractDigest::ResetSelectionDigestComputeCount();
+	{
+		FHCIAgentSelectionDigestScope Scope;
+		const FString First = FHCIAgentContractDigest::BuildSelectionDigest(ReportA);
+		for (int32 Stage = 0; Stage < 10; ++Stage)
+		{
+			TestTrue(TEXT("Chain stages should verify against the memoized digest"), FHCIAgentContractDigest::MatchesSelectionDigest(First, ReportA));
+		}
+		FHCIAgentContractDigest::BuildSelectionDigest(ReportB);
+		FHCIAgentContractDigest::BuildSelectionDigest(ReportA, EHCIAgentDigestAlgorithm::Crc32);
+	}
+	TestEqual(TEXT("Each report/algorithm pair should be hashed once inside a scope"), FHCIAgentContractDigest::GetSelectionDigestComputeCount(), 3);
+
+	FHCIAgentContractDigest::BuildSelectionDigest(ReportA);
+	TestEqual(TEXT("Outside a scope digests are recomputed"), FHCIAgentContractDigest::GetSelectionDigestComputeCount(), 4);
+	return true;
+}
+
+#endif
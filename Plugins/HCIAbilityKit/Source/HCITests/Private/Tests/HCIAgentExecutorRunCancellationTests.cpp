@@ -0,0 +1,184 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Agent/Executor/HCIAgentExecutor.h"
+#include "Agent/Planner/HCIAgentPlan.h"
+#include "Agent/Tools/HCIAgentToolAction.h"
+#include "Agent/Tools/HCIToolRegistry.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Misc/AutomationTest.h"
+
+namespace
+{
+static constexpr int32 HCICancellationTestAssetCount = 70;
+
+// Walks asset_paths the way the wired write actions do, polling cancellation once per asset batch.
+class FHCITestBatchedTextureAction final : public IHCIAgentToolAction
+{
+public:
+	virtual FName GetToolName() const override
+	{
+		return TEXT("SetTextureMaxSize");
+	}
+
+	virtual bool DryRun(
+		const FHCIAgentToolActionRequest& Request,
+		FHCIAgentToolActionResult& OutResult) const override
+	{
+		OutResult = FHCIAgentToolActionResult();
+		const int32 Total = Request.Args.IsValid() ? Request.Args->GetArrayField(TEXT("asset_paths")).Num() : 0;
+		int32 Processed = 0;
+		while (Processed < Total)
+		{
+			++Processed;
+			if (Request.ShouldStopAfterAsset(Processed, Total))
+			{
+				OutResult.ErrorCode = HCIAgentExecutorCancelledErrorCode;
+				OutResult.Reason = TEXT("cancelled_by_user");
+				OutResult.Evidence.Add(TEXT("processed_count"), FString::FromInt(Processed));
+				return false;
+			}
+		}
+
+		OutResult.bSucceeded = true;
+		OutResult.Reason = TEXT("test_batched_ok");
+		OutResult.Evidence.Add(TEXT("processed_count"), FString::FromInt(Processed));
+		return true;
+	}
+
+	virtual bool Execute(
+		const FHCIAgentToolActionRequest& Request,
+		FHCIAgentToolActionResult& OutResult) const override
+	{
+		return DryRun(Request, OutResult);
+	}
+};
+
+static FHCIAgentPlan MakeCancellationTestPlan(const int32 StepCount)
+{
+	FHCIAgentPlan Plan;
+	Plan.PlanVersion = 1;
+	Plan.RequestId = TEXT("req_cancel_test");
+	Plan.Intent = TEXT("batch_fix_asset_compliance");
+
+	for (int32 StepIndex = 0; StepIndex < StepCount; ++StepIndex)
+	{
+		FHCIAgentPlanStep& Step = Plan.Steps.AddDefaulted_GetRef();
+		Step.StepId = FString::Printf(TEXT("s%d"), StepIndex + 1);
+		Step.ToolName = TEXT("SetTextureMaxSize");
+		Step.RiskLevel = EHCIAgentPlanRiskLevel::Write;
+		Step.bRequiresConfirm = true;
+		Step.RollbackStrategy = TEXT("all_or_nothing");
+		Step.ExpectedEvidence = {TEXT("processed_count")};
+		Step.Args = MakeShared<FJsonObject>();
+		TArray<TSharedPtr<FJsonValue>> AssetPaths;
+		for (int32 AssetIndex = 0; AssetIndex < HCICancellationTestAssetCount; ++AssetIndex)
+		{
+			AssetPaths.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("/Game/Art/T_Cancel_%d.T_Cancel_%d"), AssetIndex, AssetIndex)));
+		}
+		Step.Args->SetArrayField(TEXT("asset_paths"), AssetPaths);
+		Step.Args->SetNumberField(TEXT("max_size"), 1024);
+	}
+	return Plan;
+}
+
+static FHCIAgentExecutorOptions MakeCancellationTestOptions()
+{
+	FHCIAgentExecutorOptions Options;
+	Options.bDryRun = true;
+	// The fixture exceeds the blast-radius limits on purpose; only step sequencing is under test.
+	Options.bValidatePlanBeforeExecute = false;
+	Options.bEnablePreflightGates = false;
+	Options.TerminationPolicy = EHCIAgentExecutorTerminationPolicy::ContinueOnFailure;
+	Options.ToolActions.Add(TEXT("SetTextureMaxSize"), MakeShared<FHCITestBatchedTextureAction>());
+	Options.Cancellation = MakeShared<FHCIAgentExecutionCancellation>();
+	return Options;
+}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCIAgentExecutorRunCancelBetweenStepsTest,
+	"HCI.Editor.AgentExecutor.RunCancelledBetweenStepsKeepsPartialResult",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCIAgentExecutorRunCancelBetweenStepsTest::RunTest(const FString& Parameters)
+{
+	FHCIToolRegistry& Registry = FHCIToolRegistry::Get();
+	Registry.ResetToDefaults();
+
+	const FHCIAgentPlan Plan = MakeCancellationTestPlan(3);
+	const FHCIAgentPlanValidationContext ValidationContext;
+	const FHCIAgentExecutorOptions Options = MakeCancellationTestOptions();
+
+	FHCIAgentExecutorRun Run(Plan, Registry, ValidationContext, Options);
+	TestTrue(TEXT("run starts"), Run.Start());
+	TestTrue(TEXT("first step leaves more work"), Run.ExecuteNextStep());
+	TestEqual(TEXT("one step executed"), Run.GetNextStepIndex(), 1);
+
+	Options.Cancellation->Request();
+	TestFalse(TEXT("cancelled run reports no more work"), Run.ExecuteNextStep());
+	TestTrue(TEXT("run is finished"), Run.IsFinished());
+	TestFalse(TEXT("cancelled run is not ok"), Run.WasRunOk());
+
+	const FHCIAgentExecutorRunResult Result = Run.ConsumeResult();
+	TestEqual(TEXT("terminal status"), Result.TerminalStatus, FString(TEXT("cancelled")));
+	TestEqual(TEXT("error code"), Result.ErrorCode, FString(HCIAgentExecutorCancelledErrorCode));
+	TestEqual(TEXT("executed steps"), Result.ExecutedSteps, 1);
+	TestEqual(TEXT("skipped steps"), Result.SkippedSteps, 2);
+	TestEqual(TEXT("every step has a row"), Result.StepResults.Num(), Plan.Steps.Num());
+	if (Result.StepResults.Num() == 3)
+	{
+		TestEqual(TEXT("first step kept its evidence"), Result.StepResults[0].Status, FString(TEXT("succeeded")));
+		TestEqual(TEXT("remaining step is skipped"), Result.StepResults[1].Status, FString(TEXT("skipped")));
+		TestEqual(TEXT("skip reason"), Result.StepResults[2].Reason, FString(TEXT("cancelled_by_user")));
+	}
+	TestFalse(TEXT("finish timestamp is set"), Result.FinishedAtUtc.IsEmpty());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCIAgentExecutorRunCancelInsideStepTest,
+	"HCI.Editor.AgentExecutor.RunCancelledInsideStepStopsAfterAssetBatch",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCIAgentExecutorRunCancelInsideStepTest::RunTest(const FString& Parameters)
+{
+	FHCIToolRegistry& Registry = FHCIToolRegistry::Get();
+	Registry.ResetToDefaults();
+
+	const FHCIAgentPlan Plan = MakeCancellationTestPlan(2);
+	FHCIAgentExecutorOptions Options = MakeCancellationTestOptions();
+	TArray<int32> ReportedProgress;
+	const TSharedPtr<FHCIAgentExecutionCancellation> Cancellation = Options.Cancellation;
+	Options.OnAssetProgress = [&ReportedProgress, Cancellation](const int32 StepIndex, const int32 Processed, const int32 Total)
+	{
+		ReportedProgress.Add(Processed);
+		Cancellation->Request();
+	};
+
+	FHCIAgentExecutorRunResult Result;
+	TestFalse(TEXT("cancelled plan is not ok"), FHCIAgentExecutor::ExecutePlan(Plan, Registry, FHCIAgentPlanValidationContext(), Options, Result));
+	TestEqual(TEXT("progress reported once, at the first batch"), ReportedProgress.Num(), 1);
+	if (ReportedProgress.Num() == 1)
+	{
+		TestEqual(TEXT("first batch size"), ReportedProgress[0], FHCIAgentToolActionRequest::AssetBatchSize);
+	}
+
+	TestEqual(TEXT("terminal status"), Result.TerminalStatus, FString(TEXT("cancelled")));
+	TestEqual(TEXT("interrupted step counts as executed"), Result.ExecutedSteps, 1);
+	TestEqual(TEXT("step rows"), Result.StepResults.Num(), 2);
+	if (Result.StepResults.Num() == 2)
+	{
+		const FHCIAgentExecutorStepResult& Interrupted = Result.StepResults[0];
+		TestEqual(TEXT("interrupted step status"), Interrupted.Status, FString(TEXT("cancelled")));
+		TestEqual(TEXT("interrupted step error code"), Interrupted.ErrorCode, FString(HCIAgentExecutorCancelledErrorCode));
+		const FString* ProcessedCount = Interrupted.Evidence.Find(TEXT("processed_count"));
+		TestTrue(TEXT("partial evidence kept"), ProcessedCount != nullptr && *ProcessedCount == FString::FromInt(FHCIAgentToolActionRequest::AssetBatchSize));
+		TestEqual(TEXT("next step skipped"), Result.StepResults[1].Status, FString(TEXT("skipped")));
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,147 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Agent/Executor/HCIAgentExecutor.h"
+#include "Agent/Executor/HCIAgentSourceControlCheckout.h"
+#include "Agent/Planner/HCIAgentPlan.h"
+#include "Agent/Tools/HCIToolRegistry.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Misc/AutomationTest.h"
+
+namespace
+{
+static void HCI_AddCheckoutTestWriteStep(
+	FHCIAgentPlan& Plan,
+	const TCHAR* StepId,
+	const TCHAR* ToolName,
+	const TArray<FString>& ObjectPaths)
+{
+	FHCIAgentPlanStep& Step = Plan.Steps.AddDefaulted_GetRef();
+	Step.StepId = StepId;
+	Step.ToolName = ToolName;
+	Step.RiskLevel = EHCIAgentPlanRiskLevel::Write;
+	Step.bRequiresConfirm = true;
+	Step.RollbackStrategy = TEXT("all_or_nothing");
+	Step.ExpectedEvidence = {TEXT("scanned_count"), TEXT("modified_count"), TEXT("result")};
+	Step.Args = MakeShared<FJsonObject>();
+	TArray<TSharedPtr<FJsonValue>> AssetPaths;
+	for (const FString& ObjectPath : ObjectPaths)
+	{
+		AssetPaths.Add(MakeShared<FJsonValueString>(ObjectPath));
+	}
+	Step.Args->SetArrayField(TEXT("asset_paths"), AssetPaths);
+	if (Step.ToolName == TEXT("SetTextureMaxSize"))
+	{
+		Step.Args->SetNumberField(TEXT("max_size"), 1024);
+	}
+	else
+	{
+		Step.Args->SetStringField(TEXT("lod_group"), TEXT("SmallProp"));
+	}
+}
+
+static FHCIAgentPlan MakeCheckoutTestPlan()
+{
+	FHCIAgentPlan Plan;
+	Plan.PlanVersion = 1;
+	Plan.RequestId = TEXT("req_sc_batch_test");
+	Plan.Intent = TEXT("batch_fix_asset_compliance");
+	HCI_AddCheckoutTestWriteStep(
+		Plan,
+		TEXT("s1"),
+		TEXT("SetTextureMaxSize"),
+		{TEXT("/Game/Art/T_Batch_A.T_Batch_A"), TEXT("/Game/Art/T_Batch_B.T_Batch_B")});
+	HCI_AddCheckoutTestWriteStep(
+		Plan,
+		TEXT("s2"),
+		TEXT("SetMeshLODGroup"),
+		{TEXT("/Game/Art/SM_Batch_C.SM_Batch_C"), TEXT("/Game/Art/SM_Batch_D.SM_Batch_D")});
+	return Plan;
+}
+
+static FHCIAgentExecutorOptions MakeCheckoutTestOptions(const TSharedPtr<FHCIInMemorySourceControlCheckout>& Checkout)
+{
+	FHCIAgentExecutorOptions Options;
+	Options.bDryRun = false;
+	Options.bEnablePreflightGates = true;
+	Options.bUserConfirmedWriteSteps = true;
+	Options.TerminationPolicy = EHCIAgentExecutorTerminationPolicy::ContinueOnFailure;
+	Options.bSourceControlEnabled = true;
+	Options.SourceControlCheckout = Checkout;
+	return Options;
+}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCIAgentExecutorBatchedCheckoutTest,
+	"HCI.Editor.AgentExecutor.SourceControlCheckoutIsOneBatchPerPlan",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCIAgentExecutorBatchedCheckoutTest::RunTest(const FString& Parameters)
+{
+	FHCIToolRegistry& Registry = FHCIToolRegistry::Get();
+	Registry.ResetToDefaults();
+
+	const TSharedPtr<FHCIInMemorySourceControlCheckout> Checkout = MakeShared<FHCIInMemorySourceControlCheckout>();
+	FHCIAgentExecutorRunResult RunResult;
+	TestTrue(TEXT("Plan should run"), FHCIAgentExecutor::ExecutePlan(
+		MakeCheckoutTestPlan(),
+		Registry,
+		FHCIAgentPlanValidationContext(),
+		MakeCheckoutTestOptions(Checkout),
+		RunResult));
+
+	TestEqual(TEXT("One provider batch for the whole plan"), Checkout->GetBatchCount(), 1);
+	TestEqual(TEXT("Every package requested once"), Checkout->GetRequestedPackageCount(), 4);
+	TestTrue(TEXT("Mesh package checked out"), Checkout->IsCheckedOut(TEXT("/Game/Art/SM_Batch_D")));
+	TestEqual(TEXT("Result batch count"), RunResult.SourceControlCheckoutBatches, 1);
+	TestEqual(TEXT("Result checked-out count"), RunResult.SourceControlCheckedOutPackages, 4);
+	TestEqual(TEXT("Both steps succeed"), RunResult.SucceededSteps, 2);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCIAgentExecutorBatchedCheckoutFailureTest,
+	"HCI.Editor.AgentExecutor.SourceControlCheckoutFailureBlocksOnlyOwningStepWithE4006",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCIAgentExecutorBatchedCheckoutFailureTest::RunTest(const FString& Parameters)
+{
+	FHCIToolRegistry& Registry = FHCIToolRegistry::Get();
+	Registry.ResetToDefaults();
+
+	const TSharedPtr<FHCIInMemorySourceControlCheckout> Checkout = MakeShared<FHCIInMemorySourceControlCheckout>();
+	Checkout->LockPackage(TEXT("/Game/Art/SM_Batch_C"), TEXT("checked_out_by_other_user:artist_b"));
+
+	FHCIAgentExecutorRunResult RunResult;
+	TestFalse(TEXT("Plan with a locked package should not be fully ok"), FHCIAgentExecutor::ExecutePlan(
+		MakeCheckoutTestPlan(),
+		Registry,
+		FHCIAgentPlanValidationContext(),
+		MakeCheckoutTestOptions(Checkout),
+		RunResult));
+
+	TestEqual(TEXT("Still one provider batch"), Checkout->GetBatchCount(), 1);
+	TestEqual(TEXT("Top-level error code"), RunResult.ErrorCode, FString(TEXT("E4006")));
+	TestEqual(TEXT("Failed gate"), RunResult.FailedGate, FString(TEXT("source_control")));
+	TestEqual(TEXT("Failed step index"), RunResult.FailedStepIndex, 1);
+	if (RunResult.StepResults.Num() == 2)
+	{
+		TestEqual(TEXT("Texture step unaffected"), RunResult.StepResults[0].Status, FString(TEXT("succeeded")));
+
+		const FHCIAgentExecutorStepResult& Blocked = RunResult.StepResults[1];
+		TestEqual(TEXT("Blocked step error"), Blocked.ErrorCode, FString(TEXT("E4006")));
+		TestEqual(TEXT("Blocked step phase"), Blocked.FailurePhase, FString(TEXT("preflight")));
+		const FString* FailedPackages = Blocked.Evidence.Find(TEXT("checkout_failed_packages"));
+		TestTrue(TEXT("Failed package listed"), FailedPackages != nullptr && *FailedPackages == TEXT("/Game/Art/SM_Batch_C"));
+		const FString* FailureReason = Blocked.Evidence.Find(TEXT("checkout_failure_reason"));
+		TestTrue(TEXT("Provider reason kept"), FailureReason != nullptr && FailureReason->Contains(TEXT("artist_b")));
+	}
+	else
+	{
+		AddError(TEXT("Expected two step results"));
+	}
+	return true;
+}
+
+#endif
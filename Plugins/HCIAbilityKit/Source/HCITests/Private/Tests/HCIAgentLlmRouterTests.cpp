@@ -1,7 +1,16 @@
 #if WITH_DEV_AUTOMATION_TESTS
 
 #include "Agent/LLM/HCIAgentLlmClient.h"
+#include "Agent/Planner/HCIAgentPlan.h"
+#include "Agent/Planner/HCIAgentPlanner.h"
+#include "Agent/Tools/HCIToolRegistry.h"
+#include "Containers/Ticker.h"
 #include "HAL/FileManager.h"
+#include "HttpPath.h"
+#include "HttpServerModule.h"
+#include "HttpServerRequest.h"
+#include "HttpServerResponse.h"
+#include "IHttpRouter.h"
 #include "Misc/AutomationTest.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
@@ -24,6 +33,81 @@ static void HCI_DeleteDirRecursively(const FString& DirPath)
 {
 	IFileManager::Get().DeleteDirectory(*DirPath, false, true);
 }
+
+static bool HCI_WriteRouterFixture(const FString& BaseDir, const FString& RouterJson, FString& OutProviderPath)
+{
+	OutProviderPath = BaseDir / TEXT("llm_provider.local.json");
+	const FString RouterPath = BaseDir / TEXT("llm_router.local.json");
+	const FString ProviderJson = FString::Printf(
+		TEXT("{\n")
+		TEXT("  \"api_key\": \"unit-test-key\",\n")
+		TEXT("  \"model\": \"fallback-model\",\n")
+		TEXT("  \"router_config_path\": \"%s\"\n")
+		TEXT("}\n"),
+		*HCI_NormalizeJsonPath(RouterPath));
+	return HCI_WriteUtf8File(OutProviderPath, ProviderJson) && HCI_WriteUtf8File(RouterPath, RouterJson);
+}
+
+static bool HCI_LoadRoutedConfig(const FString& ProviderPath, FHCIAgentLlmProviderConfig& OutConfig)
+{
+	FString Error;
+	return FHCIAgentLlmClient::LoadProviderConfigFromJsonFile(
+		ProviderPath,
+		TEXT("http://127.0.0.1:18080/v1/chat/completions"),
+		TEXT("qwen3.5-plus"),
+		OutConfig,
+		Error);
+}
+
+static void HCI_ReportInjectedOutcomes(
+	const FString& RouterConfigPath,
+	const FString& Model,
+	const bool bSucceeded,
+	const double BaseLatencyMs,
+	const double StepLatencyMs,
+	const int32 Count)
+{
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		FHCIAgentLlmModelOutcome Outcome;
+		Outcome.RouterConfigPath = RouterConfigPath;
+		Outcome.Model = Model;
+		Outcome.bSucceeded = bSucceeded;
+		Outcome.LatencyMs = BaseLatencyMs + StepLatencyMs * static_cast<double>(Index);
+		FHCIAgentLlmClient::ReportModelOutcome(Outcome);
+	}
+}
+
+constexpr uint32 HCIHedgeStubPort = 18732;
+// The primary stub answers well after the hedge delay; the hedge stub answers at once.
+constexpr float HCIHedgeStubPrimaryDelaySeconds = 3.0f;
+constexpr double HCIHedgeStubTimeoutSeconds = 10.0;
+
+struct FHCIHedgeStubProbe
+{
+	FAutomationTestBase* Test = nullptr;
+	TSharedPtr<IHttpRouter> Router;
+	FHttpRouteHandle PrimaryRouteHandle;
+	FHttpRouteHandle HedgeRouteHandle;
+	FString FixtureDir;
+	int32 PrimaryCalls = 0;
+	int32 HedgeCalls = 0;
+	bool bPrimaryAnswered = false;
+	bool bDelivered = false;
+	bool bBuilt = false;
+	double DispatchSeconds = 0.0;
+	double DeliveredSeconds = 0.0;
+	FHCIAgentPlannerResultMetadata Metadata;
+	double DeadlineSeconds = 0.0;
+};
+
+static TUniquePtr<FHttpServerResponse> HCI_MakeHedgeStubReply()
+{
+	return FHttpServerResponse::Create(
+		TEXT("{\"choices\":[{\"message\":{\"role\":\"assistant\",\"content\":")
+		TEXT("\"{\\\"intent\\\":\\\"chat_reply\\\",\\\"assistant_message\\\":\\\"stub reply\\\",\\\"steps\\\":[]}\"}}]}"),
+		TEXT("application/json"));
+}
 }
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(
@@ -167,4 +251,321 @@ bool FHCILlmRouterSmoothWrrDistributionTest::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCILlmRouterAdaptiveShiftsTowardFastModelTest,
+	"HCI.Editor.AgentPlanLLM.RouterAdaptiveShiftsWeightTowardFastModel",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCILlmRouterAdaptiveShiftsTowardFastModelTest::RunTest(const FString& Parameters)
+{
+	FHCIAgentLlmClient::ResetRoutingStateForTesting();
+
+	const FString BaseDir = FPaths::ConvertRelativePathToFull(
+		FPaths::ProjectSavedDir() / TEXT("Automation/HCI/LlmRouterAdaptive"));
+	const FString RouterJson =
+		TEXT("{\n")
+		TEXT("  \"enabled\": true,\n")
+		TEXT("  \"strategy\": \"adaptive_wrr\",\n")
+		TEXT("  \"min_success_rate\": 0.5,\n")
+		TEXT("  \"adaptive\": {\"ewma_alpha\": 0.5, \"min_samples\": 3},\n")
+		TEXT("  \"models\": [\n")
+		TEXT("    {\"model\": \"slow_model\", \"weight\": 1.0, \"api_url\": \"http://127.0.0.1:18081/v1/chat/completions\"},\n")
+		TEXT("    {\"model\": \"fast_model\", \"weight\": 1.0, \"api_url\": \"http://127.0.0.1:18082/v1/chat/completions\"}\n")
+		TEXT("  ]\n")
+		TEXT("}\n");
+
+	FString ProviderPath;
+	TestTrue(TEXT("Write router fixture"), HCI_WriteRouterFixture(BaseDir, RouterJson, ProviderPath));
+
+	FHCIAgentLlmProviderConfig Config;
+	TestTrue(TEXT("Initial load should succeed"), HCI_LoadRoutedConfig(ProviderPath, Config));
+	TestFalse(TEXT("Routed config should carry router key"), Config.RouterConfigPath.IsEmpty());
+	const FString ExpectedApiUrl = Config.Model.Equals(TEXT("slow_model"), ESearchCase::CaseSensitive)
+		? TEXT("http://127.0.0.1:18081/v1/chat/completions")
+		: TEXT("http://127.0.0.1:18082/v1/chat/completions");
+	TestTrue(
+		TEXT("First pick should be a routed model"),
+		Config.Model.Equals(TEXT("slow_model"), ESearchCase::CaseSensitive) || Config.Model.Equals(TEXT("fast_model"), ESearchCase::CaseSensitive));
+	TestEqual(TEXT("Per-model api_url should override endpoint"), Config.ApiUrl, ExpectedApiUrl);
+
+	// Injected delays: slow stub answers in ~4s, fast stub in ~0.4s.
+	HCI_ReportInjectedOutcomes(Config.RouterConfigPath, TEXT("slow_model"), true, 4000.0, 10.0, 5);
+	HCI_ReportInjectedOutcomes(Config.RouterConfigPath, TEXT("fast_model"), true, 400.0, 10.0, 5);
+
+	int32 SlowCount = 0;
+	int32 FastCount = 0;
+	for (int32 Index = 0; Index < 22; ++Index)
+	{
+		FHCIAgentLlmProviderConfig Routed;
+		if (!HCI_LoadRoutedConfig(ProviderPath, Routed))
+		{
+			AddError(TEXT("Routed load failed"));
+			break;
+		}
+		SlowCount += Routed.Model.Equals(TEXT("slow_model"), ESearchCase::CaseSensitive) ? 1 : 0;
+		FastCount += Routed.Model.Equals(TEXT("fast_model"), ESearchCase::CaseSensitive) ? 1 : 0;
+	}
+
+	TestTrue(TEXT("Fast model should receive the large majority of traffic"), FastCount >= SlowCount * 4);
+	TestTrue(TEXT("Slow model should still be probed"), SlowCount > 0);
+
+	HCI_DeleteDirRecursively(BaseDir);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCILlmRouterHedgeUsesPrimaryP90DelayTest,
+	"HCI.Editor.AgentPlanLLM.RouterHedgeUsesPrimaryP90Delay",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCILlmRouterHedgeUsesPrimaryP90DelayTest::RunTest(const FString& Parameters)
+{
+	FHCIAgentLlmClient::ResetRoutingStateForTesting();
+
+	const FString BaseDir = FPaths::ConvertRelativePathToFull(
+		FPaths::ProjectSavedDir() / TEXT("Automation/HCI/LlmRouterHedge"));
+	const FString RouterJson =
+		TEXT("{\n")
+		TEXT("  \"enabled\": true,\n")
+		TEXT("  \"strategy\": \"smooth_wrr\",\n")
+		TEXT("  \"adaptive\": {\"min_samples\": 5},\n")
+		TEXT("  \"hedge\": {\"enabled\": true, \"default_delay_ms\": 3000, \"min_delay_ms\": 100, \"max_delay_ms\": 10000},\n")
+		TEXT("  \"models\": [\n")
+		TEXT("    {\"model\": \"primary_model\", \"weight\": 100.0},\n")
+		TEXT("    {\"model\": \"backup_model\", \"weight\": 1.0}\n")
+		TEXT("  ]\n")
+		TEXT("}\n");
+
+	FString ProviderPath;
+	TestTrue(TEXT("Write router fixture"), HCI_WriteRouterFixture(BaseDir, RouterJson, ProviderPath));
+
+	FHCIAgentLlmProviderConfig Config;
+	TestTrue(TEXT("Initial load should succeed"), HCI_LoadRoutedConfig(ProviderPath, Config));
+	TestEqual(TEXT("Primary should be the heavy model"), Config.Model, FString(TEXT("primary_model")));
+	TestTrue(TEXT("Hedge should be enabled"), Config.bHedgeEnabled);
+	TestEqual(TEXT("Hedge should target the other model"), Config.HedgeModel, FString(TEXT("backup_model")));
+	TestEqual(TEXT("Without samples hedge delay should be the default"), Config.HedgeDelayMs, 3000);
+
+	// 1000,1100,...,1900ms -> p90 = 1800ms.
+	HCI_ReportInjectedOutcomes(Config.RouterConfigPath, TEXT("primary_model"), true, 1000.0, 100.0, 10);
+
+	FHCIAgentLlmProviderConfig Hedged;
+	TestTrue(TEXT("Second load should succeed"), HCI_LoadRoutedConfig(ProviderPath, Hedged));
+	TestEqual(TEXT("Primary should stay on the heavy model"), Hedged.Model, FString(TEXT("primary_model")));
+	TestEqual(TEXT("Hedge delay should follow primary p90"), Hedged.HedgeDelayMs, 1800);
+
+	HCI_DeleteDirRecursively(BaseDir);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCILlmRouterAdaptiveEjectsFailingModelTest,
+	"HCI.Editor.AgentPlanLLM.RouterAdaptiveEjectsFailingModel",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCILlmRouterAdaptiveEjectsFailingModelTest::RunTest(const FString& Parameters)
+{
+	FHCIAgentLlmClient::ResetRoutingStateForTesting();
+
+	const FString BaseDir = FPaths::ConvertRelativePathToFull(
+		FPaths::ProjectSavedDir() / TEXT("Automation/HCI/LlmRouterEject"));
+	const FString RouterJson =
+		TEXT("{\n")
+		TEXT("  \"enabled\": true,\n")
+		TEXT("  \"strategy\": \"adaptive\",\n")
+		TEXT("  \"min_success_rate\": 0.5,\n")
+		TEXT("  \"adaptive\": {\"ewma_alpha\": 0.3, \"min_samples\": 3},\n")
+		TEXT("  \"models\": [\n")
+		TEXT("    {\"model\": \"flaky_model\", \"weight\": 1.0},\n")
+		TEXT("    {\"model\": \"healthy_model\", \"weight\": 1.0}\n")
+		TEXT("  ]\n")
+		TEXT("}\n");
+
+	FString ProviderPath;
+	TestTrue(TEXT("Write router fixture"), HCI_WriteRouterFixture(BaseDir, RouterJson, ProviderPath));
+
+	FHCIAgentLlmProviderConfig Config;
+	TestTrue(TEXT("Initial load should succeed"), HCI_LoadRoutedConfig(ProviderPath, Config));
+	HCI_ReportInjectedOutcomes(Config.RouterConfigPath, TEXT("flaky_model"), false, 12000.0, 0.0, 6);
+	HCI_ReportInjectedOutcomes(Config.RouterConfigPath, TEXT("healthy_model"), true, 800.0, 0.0, 6);
+
+	bool bFoundFlaky = false;
+	for (const FHCIAgentLlmRouterModelMetrics& Metrics : FHCIAgentLlmClient::GetRouterMetricsSnapshot())
+	{
+		if (Metrics.Model.Equals(TEXT("flaky_model"), ESearchCase::CaseSensitive))
+		{
+			bFoundFlaky = true;
+			TestTrue(TEXT("Flaky model should be ejected"), Metrics.bEjected);
+			TestEqual(TEXT("Flaky model failures should be counted"), Metrics.FailureCount, 6);
+			TestTrue(TEXT("Ejected model keeps only a probe weight"), Metrics.EffectiveWeight < Metrics.StaticWeight * 0.1);
+		}
+		else if (Metrics.Model.Equals(TEXT("healthy_model"), ESearchCase::CaseSensitive))
+		{
+			TestFalse(TEXT("Healthy model should not be ejected"), Metrics.bEjected);
+			TestEqual(TEXT("Healthy model p95 should be tracked"), Metrics.P95LatencyMs, 800.0);
+		}
+	}
+	TestTrue(TEXT("Router metrics should include flaky model"), bFoundFlaky);
+
+	FString MetricsJson;
+	TestTrue(TEXT("Router metrics should serialize"), FHCIAgentLlmClient::SerializeRouterMetricsToJson(MetricsJson));
+	TestTrue(TEXT("Router metrics JSON should expose ejected flag"), MetricsJson.Contains(TEXT("\"ejected\"")));
+
+	HCI_DeleteDirRecursively(BaseDir);
+	return true;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_ONE_PARAMETER(FHCIWaitForHedgedPlan, TSharedPtr<FHCIHedgeStubProbe>, Probe);
+
+bool FHCIWaitForHedgedPlan::Update()
+{
+	// The late primary answer is awaited too, so its deferred reply never outlives the route.
+	if ((!Probe->bDelivered || !Probe->bPrimaryAnswered) && FPlatformTime::Seconds() < Probe->DeadlineSeconds)
+	{
+		return false;
+	}
+
+	FAutomationTestBase& Test = *Probe->Test;
+	if (Test.TestTrue(TEXT("Plan delivered"), Probe->bDelivered))
+	{
+		Test.TestTrue(TEXT("Plan built from a stub reply"), Probe->bBuilt);
+		Test.TestTrue(TEXT("Hedge leg launched"), Probe->Metadata.bLlmHedgeLaunched);
+		Test.TestTrue(TEXT("Hedge leg won"), Probe->Metadata.bLlmHedgeWon);
+		Test.TestEqual(TEXT("Plan comes from the hedge model"), Probe->Metadata.LlmModel, FString(TEXT("backup_model")));
+		Test.TestTrue(
+			TEXT("Plan delivered before the slow primary could answer"),
+			Probe->DeliveredSeconds - Probe->DispatchSeconds < HCIHedgeStubPrimaryDelaySeconds);
+	}
+	Test.TestEqual(TEXT("Primary stub called once"), Probe->PrimaryCalls, 1);
+	Test.TestEqual(TEXT("Hedge stub called once"), Probe->HedgeCalls, 1);
+
+	bool bFoundBackup = false;
+	for (const FHCIAgentLlmRouterModelMetrics& Metrics : FHCIAgentLlmClient::GetRouterMetricsSnapshot())
+	{
+		if (Metrics.Model.Equals(TEXT("backup_model"), ESearchCase::CaseSensitive))
+		{
+			bFoundBackup = true;
+			Test.TestEqual(TEXT("Hedge win counted on the backup model"), Metrics.HedgeWinCount, 1);
+		}
+	}
+	Test.TestTrue(TEXT("Router metrics include the backup model"), bFoundBackup);
+
+	Probe->Router->UnbindRoute(Probe->PrimaryRouteHandle);
+	Probe->Router->UnbindRoute(Probe->HedgeRouteHandle);
+	HCI_DeleteDirRecursively(Probe->FixtureDir);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCILlmRouterHedgeWinsOverSlowPrimaryTest,
+	"HCI.Editor.AgentPlanLLM.RouterHedgeWinsOverSlowPrimary",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCILlmRouterHedgeWinsOverSlowPrimaryTest::RunTest(const FString& Parameters)
+{
+	FHCIAgentLlmClient::ResetRoutingStateForTesting();
+	FHCIAgentPlanner::ResetMetricsForTesting();
+	FHCIToolRegistry& Registry = FHCIToolRegistry::Get();
+	Registry.ResetToDefaults();
+
+	const TSharedPtr<FHCIHedgeStubProbe> Probe = MakeShared<FHCIHedgeStubProbe>();
+	Probe->Test = this;
+	Probe->FixtureDir = FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir() / TEXT("Automation/HCI/LlmRouterHedgeStub"));
+	const FString RouterJson = FString::Printf(
+		TEXT("{\n")
+		TEXT("  \"enabled\": true,\n")
+		TEXT("  \"strategy\": \"smooth_wrr\",\n")
+		TEXT("  \"hedge\": {\"enabled\": true, \"default_delay_ms\": 200, \"min_delay_ms\": 100, \"max_delay_ms\": 10000},\n")
+		TEXT("  \"models\": [\n")
+		TEXT("    {\"model\": \"primary_model\", \"weight\": 100.0, \"api_url\": \"http://127.0.0.1:%u/v1/primary/chat/completions\"},\n")
+		TEXT("    {\"model\": \"backup_model\", \"weight\": 1.0, \"api_url\": \"http://127.0.0.1:%u/v1/backup/chat/completions\"}\n")
+		TEXT("  ]\n")
+		TEXT("}\n"),
+		HCIHedgeStubPort,
+		HCIHedgeStubPort);
+
+	FString ProviderPath;
+	if (!TestTrue(TEXT("Write router fixture"), HCI_WriteRouterFixture(Probe->FixtureDir, RouterJson, ProviderPath)))
+	{
+		return false;
+	}
+
+	Probe->Router = FHttpServerModule::Get().GetHttpRouter(HCIHedgeStubPort);
+	if (!TestTrue(TEXT("Stub HTTP router available"), Probe->Router.IsValid()))
+	{
+		return false;
+	}
+
+	const TWeakPtr<FHCIHedgeStubProbe> WeakProbe = Probe;
+	Probe->PrimaryRouteHandle = Probe->Router->BindRoute(
+		FHttpPath(TEXT("/v1/primary/chat/completions")),
+		EHttpServerRequestVerbs::VERB_POST,
+		FHttpRequestHandler::CreateLambda([WeakProbe](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+		{
+			if (const TSharedPtr<FHCIHedgeStubProbe> Pinned = WeakProbe.Pin())
+			{
+				Pinned->PrimaryCalls += 1;
+			}
+			FTSTicker::GetCoreTicker().AddTicker(
+				FTickerDelegate::CreateLambda([WeakProbe, OnComplete](float DeltaSeconds)
+				{
+					OnComplete(HCI_MakeHedgeStubReply());
+					if (const TSharedPtr<FHCIHedgeStubProbe> Pinned = WeakProbe.Pin())
+					{
+						Pinned->bPrimaryAnswered = true;
+					}
+					return false;
+				}),
+				HCIHedgeStubPrimaryDelaySeconds);
+			return true;
+		}));
+	Probe->HedgeRouteHandle = Probe->Router->BindRoute(
+		FHttpPath(TEXT("/v1/backup/chat/completions")),
+		EHttpServerRequestVerbs::VERB_POST,
+		FHttpRequestHandler::CreateLambda([WeakProbe](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+		{
+			if (const TSharedPtr<FHCIHedgeStubProbe> Pinned = WeakProbe.Pin())
+			{
+				Pinned->HedgeCalls += 1;
+			}
+			OnComplete(HCI_MakeHedgeStubReply());
+			return true;
+		}));
+	if (!TestTrue(TEXT("Stub routes bound"), Probe->PrimaryRouteHandle.IsValid() && Probe->HedgeRouteHandle.IsValid()))
+	{
+		return false;
+	}
+	FHttpServerModule::Get().StartAllListeners();
+
+	FHCIAgentPlannerBuildOptions Options;
+	Options.bPreferLlm = true;
+	Options.bUseRealHttpProvider = true;
+	Options.LlmApiKeyConfigPath = ProviderPath;
+	Options.LlmRetryCount = 0;
+	Options.bEnableAutoEnvContextScan = false;
+	Options.bLlmEnableHedging = true;
+	Options.LlmHttpTimeoutMs = 8000;
+
+	Probe->DispatchSeconds = FPlatformTime::Seconds();
+	FHCIAgentPlanner::BuildPlanFromNaturalLanguageWithProviderAsync(
+		TEXT("介绍一下你自己"),
+		TEXT("req_router_hedge_stub"),
+		Registry,
+		Options,
+		[WeakProbe](bool bBuilt, FHCIAgentPlan Plan, FString RouteReason, FHCIAgentPlannerResultMetadata Metadata, FString Error)
+		{
+			if (const TSharedPtr<FHCIHedgeStubProbe> Pinned = WeakProbe.Pin())
+			{
+				Pinned->bDelivered = true;
+				Pinned->bBuilt = bBuilt;
+				Pinned->DeliveredSeconds = FPlatformTime::Seconds();
+				Pinned->Metadata = MoveTemp(Metadata);
+			}
+		});
+
+	Probe->DeadlineSeconds = FPlatformTime::Seconds() + HCIHedgeStubTimeoutSeconds;
+	ADD_LATENT_AUTOMATION_COMMAND(FHCIWaitForHedgedPlan(Probe));
+	return true;
+}
+
 #endif
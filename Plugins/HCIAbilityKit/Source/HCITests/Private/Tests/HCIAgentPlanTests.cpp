@@ -206,6 +206,51 @@ bool FHCIAgentPlanJsonSerializerCoreFieldsTest::RunTest(const FString& Parameter
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCIAgentPlanTextureMaxSizeBindingTest,
+	"HCI.Editor.AgentPlan.TextureMaxSizeOnlyBindsNumbersAfterSizeKeyword",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCIAgentPlanTextureMaxSizeBindingTest::RunTest(const FString& Parameters)
+{
+	FHCIToolRegistry& Registry = FHCIToolRegistry::Get();
+	Registry.ResetToDefaults();
+
+	struct FCase
+	{
+		const TCHAR* Text;
+		int32 ExpectedMaxSize;
+	};
+	const FCase Cases[] = {
+		{TEXT("把 4096 的贴图压到 1024"), 1024},
+		{TEXT("检查 512 张贴图"), 1024},
+		{TEXT("把 4096 的贴图压到 2048"), 1024},
+		{TEXT("贴图最大尺寸设为 2048"), 2048},
+		{TEXT("texture max_size=512"), 512},
+		{TEXT("texture max size to 2048"), 2048},
+		{TEXT("贴图尺寸：512，共 4096 张"), 512},
+		{TEXT("贴图尺寸检查 2048"), 1024},
+		{TEXT("贴图尺寸设为 3000"), 1024}};
+
+	for (const FCase& Case : Cases)
+	{
+		FHCIAgentPlan Plan;
+		FString RouteReason;
+		FString Error;
+		const bool bOk = FHCIAgentPlanner::BuildPlanFromNaturalLanguage(Case.Text, TEXT("req_texture_max_size"), Registry, Plan, RouteReason, Error);
+		TestTrue(FString::Printf(TEXT("Planner succeeds: %s"), Case.Text), bOk);
+		TestEqual(FString::Printf(TEXT("Compliance route: %s"), Case.Text), RouteReason, FString(TEXT("asset_compliance_texture_lod")));
+
+		const FHCIAgentPlanStep* Step = FindStepByToolName(Plan, TEXT("SetTextureMaxSize"));
+		double MaxSize = 0.0;
+		TestTrue(
+			FString::Printf(TEXT("max_size present: %s"), Case.Text),
+			Step != nullptr && Step->Args.IsValid() && Step->Args->TryGetNumberField(TEXT("max_size"), MaxSize));
+		TestEqual(FString::Printf(TEXT("max_size: %s"), Case.Text), static_cast<int32>(MaxSize), Case.ExpectedMaxSize);
+	}
+	return true;
+}
+
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(
 	FHCIAgentPlanJsonSerializerAssistantMessageTest,
 	"HCI.Editor.AgentPlan.JsonSerializerIncludesAssistantMessageWhenPresent",
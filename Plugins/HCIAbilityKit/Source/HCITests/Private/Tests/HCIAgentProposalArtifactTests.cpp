@@ -0,0 +1,160 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Agent/Executor/HCIAgentExecutor.h"
+#include "Agent/Planner/HCIAgentPlan.h"
+#include "Agent/Tools/HCIAgentToolAction.h"
+#include "Agent/Tools/HCIToolRegistry.h"
+#include "AgentActions/Support/HCIProposalArtifact.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Misc/AutomationTest.h"
+
+namespace
+{
+// DryRun emits an artifact naming its step; Execute echoes whatever artifact it was handed.
+class FHCITestArtifactAction final : public IHCIAgentToolAction
+{
+public:
+	virtual FName GetToolName() const override
+	{
+		return TEXT("SetTextureMaxSize");
+	}
+
+	virtual bool DryRun(
+		const FHCIAgentToolActionRequest& Request,
+		FHCIAgentToolActionResult& OutResult) const override
+	{
+		OutResult = FHCIAgentToolActionResult();
+		OutResult.bSucceeded = true;
+		OutResult.Reason = TEXT("test_artifact_dry_run_ok");
+		OutResult.ProposalArtifact = FString::Printf(TEXT("artifact_%s"), *Request.StepId);
+		return true;
+	}
+
+	virtual bool Execute(
+		const FHCIAgentToolActionRequest& Request,
+		FHCIAgentToolActionResult& OutResult) const override
+	{
+		OutResult = FHCIAgentToolActionResult();
+		OutResult.bSucceeded = true;
+		OutResult.Reason = TEXT("test_artifact_execute_ok");
+		OutResult.Evidence.Add(TEXT("received_artifact"), Request.ProposalArtifact.IsEmpty() ? TEXT("none") : Request.ProposalArtifact);
+		return true;
+	}
+};
+
+static FHCIAgentPlan MakeArtifactTestPlan(const int32 MaxSize)
+{
+	FHCIAgentPlan Plan;
+	Plan.PlanVersion = 1;
+	Plan.RequestId = TEXT("req_artifact_test");
+	Plan.Intent = TEXT("batch_fix_asset_compliance");
+
+	FHCIAgentPlanStep& Step = Plan.Steps.AddDefaulted_GetRef();
+	Step.StepId = TEXT("s1");
+	Step.ToolName = TEXT("SetTextureMaxSize");
+	Step.RiskLevel = EHCIAgentPlanRiskLevel::Write;
+	Step.bRequiresConfirm = true;
+	Step.RollbackStrategy = TEXT("all_or_nothing");
+	Step.ExpectedEvidence = {TEXT("result")};
+	Step.Args = MakeShared<FJsonObject>();
+	TArray<TSharedPtr<FJsonValue>> AssetPaths;
+	AssetPaths.Add(MakeShared<FJsonValueString>(TEXT("/Game/Art/T_Artifact.T_Artifact")));
+	Step.Args->SetArrayField(TEXT("asset_paths"), AssetPaths);
+	Step.Args->SetNumberField(TEXT("max_size"), MaxSize);
+	return Plan;
+}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCIAgentExecutorProposalArtifactRoundTripTest,
+	"HCI.Editor.AgentExecutor.DryRunProposalArtifactReachesCommitOfSameStepOnly",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCIAgentExecutorProposalArtifactRoundTripTest::RunTest(const FString& Parameters)
+{
+	FHCIToolRegistry& Registry = FHCIToolRegistry::Get();
+	Registry.ResetToDefaults();
+
+	FHCIAgentExecutorOptions DryRunOptions;
+	DryRunOptions.bDryRun = true;
+	DryRunOptions.ToolActions.Add(TEXT("SetTextureMaxSize"), MakeShared<FHCITestArtifactAction>());
+
+	const FHCIAgentPlan Plan = MakeArtifactTestPlan(1024);
+	FHCIAgentExecutorRunResult DryRunResult;
+	FHCIAgentExecutor::ExecutePlan(Plan, Registry, FHCIAgentPlanValidationContext(), DryRunOptions, DryRunResult);
+	if (!TestEqual(TEXT("One dry-run step"), DryRunResult.StepResults.Num(), 1))
+	{
+		return false;
+	}
+	const FHCIAgentExecutorStepResult& DryRunStep = DryRunResult.StepResults[0];
+	TestEqual(TEXT("Artifact carried in step result"), DryRunStep.ProposalArtifact, FString(TEXT("artifact_s1")));
+	TestEqual(
+		TEXT("Key matches the plan step"),
+		DryRunStep.ProposalArtifactKey,
+		FHCIAgentExecutor::MakeProposalArtifactKey(Plan.RequestId, Plan.Steps[0]));
+
+	FHCIAgentExecutorOptions CommitOptions = DryRunOptions;
+	CommitOptions.bDryRun = false;
+	CommitOptions.ProposalArtifactsByKey.Add(DryRunStep.ProposalArtifactKey, DryRunStep.ProposalArtifact);
+
+	FHCIAgentExecutorRunResult CommitResult;
+	FHCIAgentExecutor::ExecutePlan(Plan, Registry, FHCIAgentPlanValidationContext(), CommitOptions, CommitResult);
+	if (TestEqual(TEXT("One commit step"), CommitResult.StepResults.Num(), 1))
+	{
+		const FString* Received = CommitResult.StepResults[0].Evidence.Find(TEXT("received_artifact"));
+		TestTrue(TEXT("Commit receives the dry-run artifact"), Received != nullptr && *Received == TEXT("artifact_s1"));
+		TestTrue(TEXT("Commit emits no new artifact"), CommitResult.StepResults[0].ProposalArtifact.IsEmpty());
+	}
+
+	FHCIAgentExecutorRunResult ChangedArgsResult;
+	FHCIAgentExecutor::ExecutePlan(MakeArtifactTestPlan(2048), Registry, FHCIAgentPlanValidationContext(), CommitOptions, ChangedArgsResult);
+	if (TestEqual(TEXT("One changed-args step"), ChangedArgsResult.StepResults.Num(), 1))
+	{
+		const FString* Received = ChangedArgsResult.StepResults[0].Evidence.Find(TEXT("received_artifact"));
+		TestTrue(TEXT("Different args get no artifact"), Received != nullptr && *Received == TEXT("none"));
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCIProposalArtifactStalenessTest,
+	"HCI.Editor.ToolActions.ProposalArtifactReusesFreshEntriesAndRejectsTampering",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCIProposalArtifactStalenessTest::RunTest(const FString& Parameters)
+{
+	FHCIProposalArtifact DryRunArtifact(TEXT("SetMeshLODGroup"), TEXT("SmallProp"));
+	for (const TCHAR* Key : {TEXT("/Game/A.A"), TEXT("/Game/B.B"), TEXT("/Game/C.C")})
+	{
+		const TSharedRef<FJsonObject> Payload = MakeShared<FJsonObject>();
+		Payload->SetStringField(TEXT("verdict"), Key);
+		DryRunArtifact.AddEntry(Key, TEXT("fp_1"), Payload);
+	}
+
+	FHCIAgentToolActionResult DryRunResult;
+	DryRunArtifact.WriteToResult(DryRunResult, true);
+	TestFalse(TEXT("Dry run stores the artifact"), DryRunResult.ProposalArtifact.IsEmpty());
+	TestTrue(TEXT("Dry run reports the hash"), DryRunResult.Evidence.Contains(TEXT("proposal_artifact_hash")));
+
+	FHCIProposalArtifact CommitArtifact(TEXT("SetMeshLODGroup"), TEXT("SmallProp"));
+	TestTrue(TEXT("Artifact loads"), CommitArtifact.Load(DryRunResult.ProposalArtifact));
+	const TSharedPtr<FJsonObject> Fresh = CommitArtifact.FindFresh(TEXT("/Game/A.A"), TEXT("fp_1"));
+	TestTrue(TEXT("Unchanged entry reused"), Fresh.IsValid() && Fresh->GetStringField(TEXT("verdict")) == TEXT("/Game/A.A"));
+	TestFalse(TEXT("Stale entry recomputed"), CommitArtifact.FindFresh(TEXT("/Game/B.B"), TEXT("fp_2")).IsValid());
+	TestFalse(TEXT("Unknown entry recomputed"), CommitArtifact.FindFresh(TEXT("/Game/D.D"), TEXT("fp_1")).IsValid());
+	TestEqual(TEXT("Reused count"), CommitArtifact.GetReusedCount(), 1);
+	TestEqual(TEXT("Recomputed count"), CommitArtifact.GetRecomputedCount(), 2);
+
+	FHCIProposalArtifact OtherContext(TEXT("SetMeshLODGroup"), TEXT("LargeProp"));
+	TestFalse(TEXT("Other context rejected"), OtherContext.Load(DryRunResult.ProposalArtifact));
+
+	FString Tampered = DryRunResult.ProposalArtifact;
+	Tampered.ReplaceInline(TEXT("fp_1"), TEXT("fp_9"));
+	FHCIProposalArtifact TamperedArtifact(TEXT("SetMeshLODGroup"), TEXT("SmallProp"));
+	TestFalse(TEXT("Tampered artifact rejected"), TamperedArtifact.Load(Tampered));
+	TestFalse(TEXT("Rejected artifact reuses nothing"), TamperedArtifact.FindFresh(TEXT("/Game/A.A"), TEXT("fp_9")).IsValid());
+	return true;
+}
+
+#endif
@@ -0,0 +1,153 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Agent/Executor/HCIAgentExecutor.h"
+#include "Agent/Executor/HCIAgentReadOnlyResultCache.h"
+#include "Agent/Planner/HCIAgentPlan.h"
+#include "Agent/Tools/HCIAgentToolAction.h"
+#include "Agent/Tools/HCIToolRegistry.h"
+#include "Dom/JsonObject.h"
+#include "Misc/AutomationTest.h"
+
+namespace
+{
+// ScanAssets stand-in that counts how often it actually runs.
+class FHCITestCountingScanAction final : public IHCIAgentToolAction
+{
+public:
+	explicit FHCITestCountingScanAction(const TSharedRef<int32>& InCallCount)
+		: CallCount(InCallCount)
+	{
+	}
+
+	virtual FName GetToolName() const override
+	{
+		return TEXT("ScanAssets");
+	}
+
+	virtual bool DryRun(
+		const FHCIAgentToolActionRequest& Request,
+		FHCIAgentToolActionResult& OutResult) const override
+	{
+		++(*CallCount);
+		OutResult = FHCIAgentToolActionResult();
+		OutResult.bSucceeded = true;
+		OutResult.Reason = TEXT("scan_assets_ok");
+		OutResult.EstimatedAffectedCount = 3;
+		OutResult.Evidence.Add(TEXT("scan_root"), TEXT("/Game/Temp"));
+		OutResult.Evidence.Add(TEXT("asset_count"), TEXT("3"));
+		OutResult.Evidence.Add(TEXT("result"), OutResult.Reason);
+		return true;
+	}
+
+	virtual bool Execute(
+		const FHCIAgentToolActionRequest& Request,
+		FHCIAgentToolActionResult& OutResult) const override
+	{
+		return DryRun(Request, OutResult);
+	}
+
+private:
+	TSharedRef<int32> CallCount;
+};
+
+static FHCIAgentPlan MakeCacheTestScanPlan(const TCHAR* RequestId)
+{
+	FHCIAgentPlan Plan;
+	Plan.PlanVersion = 1;
+	Plan.RequestId = RequestId;
+	Plan.Intent = TEXT("scan_assets");
+
+	FHCIAgentPlanStep& Step = Plan.Steps.AddDefaulted_GetRef();
+	Step.StepId = TEXT("step_1_scan");
+	Step.ToolName = TEXT("ScanAssets");
+	Step.RiskLevel = EHCIAgentPlanRiskLevel::ReadOnly;
+	Step.bRequiresConfirm = false;
+	Step.RollbackStrategy = TEXT("all_or_nothing");
+	Step.ExpectedEvidence = {TEXT("scan_root"), TEXT("asset_count"), TEXT("result")};
+	Step.Args = MakeShared<FJsonObject>();
+	Step.Args->SetStringField(TEXT("directory"), TEXT("/Game/Temp"));
+	return Plan;
+}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCIAgentReadOnlyResultCacheHitTest,
+	"HCI.Editor.AgentExecutor.ReadOnlyResultCacheServesRepeatScansUntilGenerationBump",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCIAgentReadOnlyResultCacheHitTest::RunTest(const FString& Parameters)
+{
+	FHCIToolRegistry& Registry = FHCIToolRegistry::Get();
+	Registry.ResetToDefaults();
+
+	const TSharedRef<int32> CallCount = MakeShared<int32>(0);
+	FHCIAgentExecutorOptions Options;
+	Options.ToolActions.Add(TEXT("ScanAssets"), MakeShared<FHCITestCountingScanAction>(CallCount));
+	Options.ReadOnlyResultCache = MakeShared<FHCIAgentReadOnlyResultCache>();
+
+	FHCIAgentExecutorRunResult First;
+	FHCIAgentExecutor::ExecutePlan(MakeCacheTestScanPlan(TEXT("req_cache_1")), Registry, FHCIAgentPlanValidationContext(), Options, First);
+	TestEqual(TEXT("First run misses"), First.ReadOnlyCacheMisses, 1);
+	TestEqual(TEXT("First run has no hits"), First.ReadOnlyCacheHits, 0);
+
+	// A later chat request with the same scan is served from the cache.
+	FHCIAgentExecutorRunResult Second;
+	FHCIAgentExecutor::ExecutePlan(MakeCacheTestScanPlan(TEXT("req_cache_2")), Registry, FHCIAgentPlanValidationContext(), Options, Second);
+	TestEqual(TEXT("Second run hits"), Second.ReadOnlyCacheHits, 1);
+	TestEqual(TEXT("Action ran once"), *CallCount, 1);
+	if (TestEqual(TEXT("One step"), Second.StepResults.Num(), 1))
+	{
+		const FHCIAgentExecutorStepResult& Step = Second.StepResults[0];
+		TestTrue(TEXT("Step marked as cached"), Step.bFromReadOnlyCache);
+		TestTrue(TEXT("Cached step succeeded"), Step.bSucceeded);
+		TestEqual(TEXT("Cached evidence"), Step.Evidence.FindRef(TEXT("asset_count")), FString(TEXT("3")));
+		TestEqual(TEXT("Cached target count"), Step.TargetCountEstimate, 3);
+	}
+
+	Options.ReadOnlyResultCache->BumpGeneration();
+	FHCIAgentExecutorRunResult Third;
+	FHCIAgentExecutor::ExecutePlan(MakeCacheTestScanPlan(TEXT("req_cache_3")), Registry, FHCIAgentPlanValidationContext(), Options, Third);
+	TestEqual(TEXT("Asset change forces a miss"), Third.ReadOnlyCacheMisses, 1);
+	TestEqual(TEXT("Action ran again"), *CallCount, 2);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCIAgentReadOnlyResultCacheKeyTest,
+	"HCI.Editor.AgentExecutor.ReadOnlyResultCacheKeyIgnoresArgOrder",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCIAgentReadOnlyResultCacheKeyTest::RunTest(const FString& Parameters)
+{
+	const TSharedPtr<FJsonObject> A = MakeShared<FJsonObject>();
+	A->SetStringField(TEXT("keyword"), TEXT("Rock"));
+	A->SetNumberField(TEXT("max_results"), 5);
+	const TSharedPtr<FJsonObject> B = MakeShared<FJsonObject>();
+	B->SetNumberField(TEXT("max_results"), 5);
+	B->SetStringField(TEXT("keyword"), TEXT("Rock"));
+	const TSharedPtr<FJsonObject> C = MakeShared<FJsonObject>();
+	C->SetStringField(TEXT("keyword"), TEXT("Tree"));
+	C->SetNumberField(TEXT("max_results"), 5);
+
+	TestEqual(
+		TEXT("Key order does not matter"),
+		FHCIAgentReadOnlyResultCache::MakeKey(TEXT("SearchPath"), A),
+		FHCIAgentReadOnlyResultCache::MakeKey(TEXT("SearchPath"), B));
+	TestNotEqual(
+		TEXT("Values matter"),
+		FHCIAgentReadOnlyResultCache::MakeKey(TEXT("SearchPath"), A),
+		FHCIAgentReadOnlyResultCache::MakeKey(TEXT("SearchPath"), C));
+	TestFalse(TEXT("Level scans are not memoized"), FHCIAgentReadOnlyResultCache::IsMemoizableTool(TEXT("ScanLevelMeshRisks")));
+
+	FHCIAgentReadOnlyResultCache Cache(2);
+	Cache.Store(TEXT("k1"), FHCIAgentReadOnlyResultCache::FEntry());
+	Cache.Store(TEXT("k2"), FHCIAgentReadOnlyResultCache::FEntry());
+	Cache.Find(TEXT("k1"));
+	Cache.Store(TEXT("k3"), FHCIAgentReadOnlyResultCache::FEntry());
+	TestEqual(TEXT("Bounded"), Cache.Num(), 2);
+	TestNotNull(TEXT("Recently used entry kept"), Cache.Find(TEXT("k1")));
+	TestNull(TEXT("Least recently used entry evicted"), Cache.Find(TEXT("k2")));
+	return true;
+}
+
+#endif
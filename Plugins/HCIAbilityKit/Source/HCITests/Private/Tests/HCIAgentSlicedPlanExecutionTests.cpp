@@ -0,0 +1,168 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "UI/HCIAgentSlicedPlanExecution.h"
+
+#include "Agent/Planner/HCIAgentPlan.h"
+#include "Dom/JsonObject.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/AutomationTest.h"
+
+namespace
+{
+constexpr int32 HCISlicedTestStepCount = 5;
+// The stop button is pressed as this step begins; it still runs, the ones after it are skipped.
+constexpr int32 HCISlicedTestCancelAtStep = 2;
+constexpr double HCISlicedTestTimeoutSeconds = 10.0;
+
+struct FHCISlicedExecutionProbe
+{
+	FAutomationTestBase* Test = nullptr;
+	TWeakPtr<FHCIAgentSlicedPlanExecution> Execution;
+	TArray<uint64> StepBeginFrames;
+	bool bCompleted = false;
+	FHCIAgentPlanExecutionReport Report;
+	float PreviousBudgetMs = 0.0f;
+	double DeadlineSeconds = 0.0;
+};
+
+static FHCIAgentPlan HCI_MakeSlicedTestPlan(const TCHAR* RequestId, const int32 StepCount)
+{
+	FHCIAgentPlan Plan;
+	Plan.PlanVersion = 1;
+	Plan.RequestId = RequestId;
+	Plan.Intent = TEXT("scan_assets");
+	for (int32 StepIndex = 0; StepIndex < StepCount; ++StepIndex)
+	{
+		FHCIAgentPlanStep& Step = Plan.Steps.AddDefaulted_GetRef();
+		Step.StepId = FString::Printf(TEXT("step_%d_scan"), StepIndex + 1);
+		Step.ToolName = TEXT("ScanAssets");
+		Step.RiskLevel = EHCIAgentPlanRiskLevel::ReadOnly;
+		Step.bRequiresConfirm = false;
+		Step.RollbackStrategy = TEXT("all_or_nothing");
+		Step.ExpectedEvidence = {TEXT("scan_root"), TEXT("asset_count"), TEXT("result")};
+		Step.Args = MakeShared<FJsonObject>();
+		// Distinct roots keep every step out of the session read-only cache.
+		Step.Args->SetStringField(TEXT("directory"), FString::Printf(TEXT("/Game/__HCI_Auto/Sliced_%d"), StepIndex + 1));
+	}
+	return Plan;
+}
+
+static IConsoleVariable* HCI_FindFrameBudgetCVar()
+{
+	return IConsoleManager::Get().FindConsoleVariable(TEXT("HCI.Executor.FrameBudgetMs"));
+}
+} // namespace
+
+DEFINE_LATENT_AUTOMATION_COMMAND_ONE_PARAMETER(FHCIWaitForSlicedExecution, TSharedPtr<FHCISlicedExecutionProbe>, Probe);
+
+bool FHCIWaitForSlicedExecution::Update()
+{
+	if (!Probe->bCompleted && FPlatformTime::Seconds() < Probe->DeadlineSeconds)
+	{
+		return false;
+	}
+
+	if (IConsoleVariable* BudgetCVar = HCI_FindFrameBudgetCVar())
+	{
+		BudgetCVar->Set(Probe->PreviousBudgetMs, ECVF_SetByCode);
+	}
+
+	FAutomationTestBase& Test = *Probe->Test;
+	if (!Test.TestTrue(TEXT("Execution completed through the ticker"), Probe->bCompleted))
+	{
+		return true;
+	}
+	Test.TestEqual(TEXT("Run ends as cancelled"), Probe->Report.TerminalStatus, FString(TEXT("cancelled")));
+	Test.TestEqual(TEXT("Steps after the cancel are never started"), Probe->StepBeginFrames.Num(), HCISlicedTestCancelAtStep + 1);
+	for (int32 Index = 1; Index < Probe->StepBeginFrames.Num(); ++Index)
+	{
+		Test.TestTrue(
+			FString::Printf(TEXT("Step %d starts on a later frame than step %d"), Index + 1, Index),
+			Probe->StepBeginFrames[Index] > Probe->StepBeginFrames[Index - 1]);
+	}
+	Test.TestFalse(TEXT("Execution reports not running"), Probe->Execution.IsValid() && Probe->Execution.Pin()->IsRunning());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCIAgentSlicedPlanExecutionTickerCancelTest,
+	"HCI.Editor.SlicedExecution.TickerRunsStepsAcrossFramesAndStopsOnCancel",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCIAgentSlicedPlanExecutionTickerCancelTest::RunTest(const FString& Parameters)
+{
+	IConsoleVariable* BudgetCVar = HCI_FindFrameBudgetCVar();
+	if (!TestNotNull(TEXT("Frame budget cvar registered"), BudgetCVar))
+	{
+		return false;
+	}
+
+	const TSharedPtr<FHCISlicedExecutionProbe> Probe = MakeShared<FHCISlicedExecutionProbe>();
+	Probe->Test = this;
+	Probe->PreviousBudgetMs = BudgetCVar->GetFloat();
+	// A zero budget runs exactly one step per ticker frame.
+	BudgetCVar->Set(0.0f, ECVF_SetByCode);
+
+	const TSharedRef<FHCIAgentSlicedPlanExecution> Execution = FHCIAgentSlicedPlanExecution::Start(
+		HCI_MakeSlicedTestPlan(TEXT("req_sliced_ticker_cancel"), HCISlicedTestStepCount),
+		true,
+		false,
+		[Probe](const int32 StepIndex, const int32 TotalSteps, const FHCIAgentPlanStep& Step)
+		{
+			Probe->StepBeginFrames.Add(GFrameCounter);
+			if (StepIndex == HCISlicedTestCancelAtStep)
+			{
+				if (const TSharedPtr<FHCIAgentSlicedPlanExecution> Pinned = Probe->Execution.Pin())
+				{
+					Pinned->RequestCancel();
+				}
+			}
+		},
+		nullptr,
+		[Probe](const FHCIAgentPlanExecutionReport& Report)
+		{
+			Probe->bCompleted = true;
+			Probe->Report = Report;
+		});
+	Probe->Execution = Execution;
+
+	TestTrue(TEXT("Execution running after Start"), Execution->IsRunning());
+	TestFalse(TEXT("OnCompleted never fires from Start"), Probe->bCompleted);
+	TestEqual(TEXT("No step runs inside Start"), Probe->StepBeginFrames.Num(), 0);
+
+	Probe->DeadlineSeconds = FPlatformTime::Seconds() + HCISlicedTestTimeoutSeconds;
+	ADD_LATENT_AUTOMATION_COMMAND(FHCIWaitForSlicedExecution(Probe));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCIAgentSlicedPlanExecutionShutdownTest,
+	"HCI.Editor.SlicedExecution.ShutdownRemovesTickerWithoutCallback",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCIAgentSlicedPlanExecutionShutdownTest::RunTest(const FString& Parameters)
+{
+	bool bCallbackFired = false;
+	TSharedPtr<FHCIAgentSlicedPlanExecution> Execution = FHCIAgentSlicedPlanExecution::Start(
+		HCI_MakeSlicedTestPlan(TEXT("req_sliced_shutdown"), 3),
+		true,
+		false,
+		nullptr,
+		nullptr,
+		[&bCallbackFired](const FHCIAgentPlanExecutionReport& Report)
+		{
+			bCallbackFired = true;
+		});
+
+	Execution->Shutdown();
+	TestFalse(TEXT("Execution finished by Shutdown"), Execution->IsRunning());
+	TestFalse(TEXT("Shutdown does not call back into a departing owner"), bCallbackFired);
+
+	// Only the ticker could still hold a reference once the owner lets go.
+	const TWeakPtr<FHCIAgentSlicedPlanExecution> WeakExecution = Execution;
+	Execution.Reset();
+	TestFalse(TEXT("Ticker no longer keeps the execution alive"), WeakExecution.IsValid());
+	return true;
+}
+
+#endif
@@ -0,0 +1,200 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Agent/Executor/HCIAgentExecutor.h"
+#include "Agent/Executor/HCIAgentReadOnlyResultCache.h"
+#include "Agent/Executor/HCIAgentSpeculativeReadOnlyRun.h"
+#include "Agent/Planner/HCIAgentPlan.h"
+#include "Agent/Tools/HCIAgentToolAction.h"
+#include "Agent/Tools/HCIToolRegistry.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Misc/AutomationTest.h"
+
+namespace
+{
+// ScanAssets stand-in that records the directory of every real run.
+class FHCITestRecordingScanAction final : public IHCIAgentToolAction
+{
+public:
+	explicit FHCITestRecordingScanAction(const TSharedRef<TArray<FString>>& InScannedDirectories)
+		: ScannedDirectories(InScannedDirectories)
+	{
+	}
+
+	virtual FName GetToolName() const override
+	{
+		return TEXT("ScanAssets");
+	}
+
+	virtual bool DryRun(
+		const FHCIAgentToolActionRequest& Request,
+		FHCIAgentToolActionResult& OutResult) const override
+	{
+		const FString Directory = Request.Args.IsValid() ? Request.Args->GetStringField(TEXT("directory")) : FString();
+		ScannedDirectories->Add(Directory);
+		OutResult = FHCIAgentToolActionResult();
+		OutResult.bSucceeded = true;
+		OutResult.Reason = TEXT("scan_assets_ok");
+		OutResult.EstimatedAffectedCount = 2;
+		OutResult.Evidence.Add(TEXT("scan_root"), Directory);
+		OutResult.Evidence.Add(TEXT("asset_count"), TEXT("2"));
+		OutResult.Evidence.Add(TEXT("result"), OutResult.Reason);
+		return true;
+	}
+
+	virtual bool Execute(
+		const FHCIAgentToolActionRequest& Request,
+		FHCIAgentToolActionResult& OutResult) const override
+	{
+		return DryRun(Request, OutResult);
+	}
+
+private:
+	TSharedRef<TArray<FString>> ScannedDirectories;
+};
+
+static FHCIAgentPlanStep& HCI_AddSpeculationScanStep(FHCIAgentPlan& Plan, const TCHAR* Directory, const bool bArgsReversed = false)
+{
+	FHCIAgentPlanStep& Step = Plan.Steps.AddDefaulted_GetRef();
+	Step.StepId = FString::Printf(TEXT("step_%d_scan"), Plan.Steps.Num());
+	Step.ToolName = TEXT("ScanAssets");
+	Step.RiskLevel = EHCIAgentPlanRiskLevel::ReadOnly;
+	Step.ExpectedEvidence = {TEXT("scan_root"), TEXT("asset_count"), TEXT("result")};
+	Step.Args = MakeShared<FJsonObject>();
+	if (bArgsReversed)
+	{
+		Step.Args->SetBoolField(TEXT("recursive"), true);
+		Step.Args->SetStringField(TEXT("directory"), Directory);
+	}
+	else
+	{
+		Step.Args->SetStringField(TEXT("directory"), Directory);
+		Step.Args->SetBoolField(TEXT("recursive"), true);
+	}
+	return Step;
+}
+
+static FHCIAgentPlan HCI_MakeSpeculationPlan(const TCHAR* RequestId)
+{
+	FHCIAgentPlan Plan;
+	Plan.PlanVersion = 1;
+	Plan.RequestId = RequestId;
+	Plan.Intent = TEXT("batch_fix_asset_compliance");
+	return Plan;
+}
+
+static FHCIAgentExecutorOptions HCI_MakeSpeculationOptions(const TSharedRef<TArray<FString>>& ScannedDirectories)
+{
+	FHCIAgentExecutorOptions Options;
+	Options.ToolActions.Add(TEXT("ScanAssets"), MakeShared<FHCITestRecordingScanAction>(ScannedDirectories));
+	Options.ReadOnlyResultCache = MakeShared<FHCIAgentReadOnlyResultCache>();
+	return Options;
+}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCIAgentSpeculativeReadOnlyReuseTest,
+	"HCI.Editor.AgentExecutor.SpeculativeReadOnlyScanIsReusedByMatchingRealPlan",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCIAgentSpeculativeReadOnlyReuseTest::RunTest(const FString& Parameters)
+{
+	FHCIToolRegistry& Registry = FHCIToolRegistry::Get();
+	Registry.ResetToDefaults();
+
+	// Likely plan: a scan, a write step fed by it, and a second scan depending on the first one's evidence.
+	FHCIAgentPlan LikelyPlan = HCI_MakeSpeculationPlan(TEXT("req_speculative_reuse"));
+	HCI_AddSpeculationScanStep(LikelyPlan, TEXT("/Game/Temp"));
+	FHCIAgentPlanStep& WriteStep = LikelyPlan.Steps.AddDefaulted_GetRef();
+	WriteStep.StepId = TEXT("step_2_resize");
+	WriteStep.ToolName = TEXT("SetTextureMaxSize");
+	WriteStep.RiskLevel = EHCIAgentPlanRiskLevel::Write;
+	WriteStep.bRequiresConfirm = true;
+	WriteStep.Args = MakeShared<FJsonObject>();
+	WriteStep.Args->SetStringField(TEXT("asset_paths"), TEXT("{{step_1_scan.asset_paths}}"));
+	WriteStep.Args->SetNumberField(TEXT("max_size"), 1024);
+	HCI_AddSpeculationScanStep(LikelyPlan, TEXT("{{step_1_scan.scan_root}}"));
+
+	const TArray<FHCIAgentPlanStep> Speculable = FHCIAgentSpeculativeReadOnlyRun::SelectSpeculativeSteps(LikelyPlan, Registry);
+	TestEqual(TEXT("Write and pipeline-bound steps are never speculated"), Speculable.Num(), 1);
+
+	const TSharedRef<TArray<FString>> ScannedDirectories = MakeShared<TArray<FString>>();
+	const FHCIAgentExecutorOptions Options = HCI_MakeSpeculationOptions(ScannedDirectories);
+	const TSharedPtr<FHCIAgentSpeculativeReadOnlyRun> Run = FHCIAgentSpeculativeReadOnlyRun::Create(LikelyPlan, Registry, Options);
+	if (!TestTrue(TEXT("Speculative run created"), Run.IsValid()))
+	{
+		return false;
+	}
+	TestFalse(TEXT("Single speculated step leaves no more work"), Run->ExecuteNextStep());
+	TestEqual(TEXT("Scan ran once while the real plan was pending"), ScannedDirectories->Num(), 1);
+
+	// The real plan arrives with the same scan, its args in a different order.
+	FHCIAgentPlan RealPlan = HCI_MakeSpeculationPlan(TEXT("req_speculative_reuse"));
+	HCI_AddSpeculationScanStep(RealPlan, TEXT("/Game/Temp"), true);
+	TestEqual(TEXT("Real scan matches the speculated one"), Run->Reconcile(RealPlan), 1);
+	TestFalse(TEXT("Matching plan does not cancel"), Run->GetStats().bCancelled);
+
+	FHCIAgentExecutorRunResult Result;
+	FHCIAgentExecutor::ExecutePlan(RealPlan, Registry, FHCIAgentPlanValidationContext(), Options, Result);
+	TestEqual(TEXT("Real scan is served from the speculated result"), Result.ReadOnlyCacheHits, 1);
+	TestEqual(TEXT("Scan action did not run again"), ScannedDirectories->Num(), 1);
+	if (TestEqual(TEXT("One step row"), Result.StepResults.Num(), 1))
+	{
+		TestTrue(TEXT("Step marked as cached"), Result.StepResults[0].bFromReadOnlyCache);
+		TestEqual(TEXT("Speculated evidence"), Result.StepResults[0].Evidence.FindRef(TEXT("scan_root")), FString(TEXT("/Game/Temp")));
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCIAgentSpeculativeReadOnlyDivergeTest,
+	"HCI.Editor.AgentExecutor.SpeculativeReadOnlyRunIsCancelledWhenRealPlanDiverges",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCIAgentSpeculativeReadOnlyDivergeTest::RunTest(const FString& Parameters)
+{
+	FHCIToolRegistry& Registry = FHCIToolRegistry::Get();
+	Registry.ResetToDefaults();
+
+	FHCIAgentPlan LikelyPlan = HCI_MakeSpeculationPlan(TEXT("req_speculative_diverge"));
+	HCI_AddSpeculationScanStep(LikelyPlan, TEXT("/Game/Temp"));
+	HCI_AddSpeculationScanStep(LikelyPlan, TEXT("/Game/Art"));
+	HCI_AddSpeculationScanStep(LikelyPlan, TEXT("/Game/Temp"));
+
+	const TSharedRef<TArray<FString>> ScannedDirectories = MakeShared<TArray<FString>>();
+	const FHCIAgentExecutorOptions Options = HCI_MakeSpeculationOptions(ScannedDirectories);
+
+	// Partial overlap: only the pending step the real plan shares keeps running.
+	const TSharedPtr<FHCIAgentSpeculativeReadOnlyRun> Partial = FHCIAgentSpeculativeReadOnlyRun::Create(LikelyPlan, Registry, Options);
+	if (!TestTrue(TEXT("Partial run created"), Partial.IsValid()))
+	{
+		return false;
+	}
+	TestEqual(TEXT("Duplicate scans speculated once"), Partial->GetStats().SpeculatedSteps, 2);
+	FHCIAgentPlan PartialPlan = HCI_MakeSpeculationPlan(TEXT("req_speculative_diverge"));
+	HCI_AddSpeculationScanStep(PartialPlan, TEXT("/Game/Art"));
+	TestEqual(TEXT("One shared step"), Partial->Reconcile(PartialPlan), 1);
+	TestEqual(TEXT("Unshared pending step dropped"), Partial->GetStats().DroppedSteps, 1);
+	TestFalse(TEXT("Shared step still pending"), Partial->IsFinished());
+	Partial->ExecuteNextStep();
+	TestTrue(TEXT("Only the shared scan ran"), ScannedDirectories->Num() == 1 && (*ScannedDirectories)[0] == TEXT("/Game/Art"));
+
+	// Full divergence before any step ran: nothing is executed.
+	ScannedDirectories->Reset();
+	Options.ReadOnlyResultCache->Reset();
+	const TSharedPtr<FHCIAgentSpeculativeReadOnlyRun> Diverged = FHCIAgentSpeculativeReadOnlyRun::Create(LikelyPlan, Registry, Options);
+	if (!TestTrue(TEXT("Diverged run created"), Diverged.IsValid()))
+	{
+		return false;
+	}
+	FHCIAgentPlan DivergedPlan = HCI_MakeSpeculationPlan(TEXT("req_speculative_diverge"));
+	HCI_AddSpeculationScanStep(DivergedPlan, TEXT("/Game/Props"));
+	TestEqual(TEXT("No shared step"), Diverged->Reconcile(DivergedPlan), 0);
+	TestTrue(TEXT("Diverged run cancelled"), Diverged->GetStats().bCancelled);
+	TestTrue(TEXT("Diverged run finished"), Diverged->IsFinished());
+	TestFalse(TEXT("No step left to run"), Diverged->ExecuteNextStep());
+	TestEqual(TEXT("No speculative scan ran"), ScannedDirectories->Num(), 0);
+	return true;
+}
+
+#endif
@@ -0,0 +1,98 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Benchmark/HCIBenchmarkReport.h"
+#include "Dom/JsonObject.h"
+#include "Misc/AutomationTest.h"
+
+namespace
+{
+static FHCIBenchmarkCaseResult HCI_MakeBenchmarkCase(const TCHAR* Name, const TArray<double>& SamplesMs, const int32 Items)
+{
+	FHCIBenchmarkCaseResult Case;
+	Case.Name = Name;
+	Case.SamplesMs = SamplesMs;
+	Case.ItemsPerIteration = Items;
+	Case.Finalize();
+	return Case;
+}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCIBenchmarkReportRoundTripTest,
+	"HCI.Editor.Benchmark.ReportJsonRoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCIBenchmarkReportRoundTripTest::RunTest(const FString& Parameters)
+{
+	FHCIBenchmarkReport Report;
+	Report.RunId = TEXT("bench_test");
+	Report.FixtureRoot = TEXT("/Game/__HCI_Test/Bench/Synthetic_1000_s42");
+	Report.FixtureCount = 1000;
+	Report.FixtureSeed = 42;
+	Report.DatasetDigest = TEXT("deadbeef");
+	Report.Cases.Add(HCI_MakeBenchmarkCase(TEXT("scan"), {40.0, 10.0, 20.0, 30.0}, 1000));
+
+	const FHCIBenchmarkCaseResult& Scan = Report.Cases[0];
+	TestEqual(TEXT("p50 nearest rank"), Scan.P50Ms, 20.0);
+	TestEqual(TEXT("p95 nearest rank"), Scan.P95Ms, 40.0);
+	TestEqual(TEXT("mean"), Scan.MeanMs, 25.0);
+	TestEqual(TEXT("throughput from p50"), Scan.ThroughputPerSec, 50000.0);
+
+	FHCIBenchmarkReport Loaded;
+	FString Error;
+	TestTrue(TEXT("round trip parses"), FHCIBenchmarkReport::FromJson(*Report.ToJson(), Loaded, Error));
+	TestEqual(TEXT("digest kept"), Loaded.DatasetDigest, Report.DatasetDigest);
+	TestEqual(TEXT("fixture count kept"), Loaded.FixtureCount, 1000);
+	const FHCIBenchmarkCaseResult* LoadedScan = Loaded.FindCase(TEXT("scan"));
+	TestNotNull(TEXT("case kept"), LoadedScan);
+	if (LoadedScan)
+	{
+		TestEqual(TEXT("p95 kept"), LoadedScan->P95Ms, 40.0);
+		TestEqual(TEXT("iterations kept"), LoadedScan->Iterations, 4);
+	}
+
+	const TSharedRef<FJsonObject> Foreign = MakeShared<FJsonObject>();
+	Foreign->SetStringField(TEXT("schema"), TEXT("other"));
+	TestFalse(TEXT("unknown schema rejected"), FHCIBenchmarkReport::FromJson(*Foreign, Loaded, Error));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCIBenchmarkReportCompareTest,
+	"HCI.Editor.Benchmark.CompareFlagsRegressionsAboveNoiseFloor",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCIBenchmarkReportCompareTest::RunTest(const FString& Parameters)
+{
+	FHCIBenchmarkReport Baseline;
+	Baseline.Cases.Add(HCI_MakeBenchmarkCase(TEXT("scan"), {100.0, 100.0, 100.0}, 1000));
+	Baseline.Cases.Add(HCI_MakeBenchmarkCase(TEXT("plan_validate"), {0.2, 0.2, 0.2}, 200));
+	Baseline.Cases.Add(HCI_MakeBenchmarkCase(TEXT("search_query"), {10.0, 10.0, 10.0}, 8));
+
+	FHCIBenchmarkReport Current;
+	Current.Cases.Add(HCI_MakeBenchmarkCase(TEXT("scan"), {200.0, 200.0, 200.0}, 1000));
+	// 3x slower but far below the 1 ms noise floor.
+	Current.Cases.Add(HCI_MakeBenchmarkCase(TEXT("plan_validate"), {0.6, 0.6, 0.6}, 200));
+	Current.Cases.Add(HCI_MakeBenchmarkCase(TEXT("search_query"), {10.5, 10.5, 10.5}, 8));
+	FHCIBenchmarkCaseResult& Failed = Current.Cases.Add_GetRef(HCI_MakeBenchmarkCase(TEXT("stageg_chain"), {}, 0));
+	Failed.bSucceeded = false;
+	Failed.FailureReason = TEXT("stageg_not_ready");
+
+	TArray<FHCIBenchmarkRegression> Regressions;
+	FHCIBenchmarkReport::CompareToBaseline(Baseline, Current, FHCIBenchmarkThresholds(), Regressions);
+
+	int32 ScanRegressions = 0;
+	bool bFailedCaseReported = false;
+	for (const FHCIBenchmarkRegression& Regression : Regressions)
+	{
+		ScanRegressions += Regression.CaseName == TEXT("scan") ? 1 : 0;
+		bFailedCaseReported |= Regression.CaseName == TEXT("stageg_chain") && Regression.Metric.StartsWith(TEXT("failed:"));
+		TestNotEqual(TEXT("noise floor suppresses tiny cases"), Regression.CaseName, FString(TEXT("plan_validate")));
+		TestNotEqual(TEXT("within ratio is not a regression"), Regression.CaseName, FString(TEXT("search_query")));
+	}
+	TestEqual(TEXT("scan p50, p95 and throughput regress"), ScanRegressions, 3);
+	TestTrue(TEXT("failed case is a regression"), bFailedCaseReported);
+	return true;
+}
+
+#endif
@@ -0,0 +1,177 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AgentActions/Support/HCIChunkedActorLoadDriver.h"
+
+#include "Misc/AutomationTest.h"
+
+namespace
+{
+constexpr uint64 HCIChunkedTestBaselineMB = 100;
+constexpr uint64 HCIChunkedTestActorMB = 10;
+
+// Stand-in for a World Partition map: every load costs HCIChunkedTestActorMB until the batch is released
+// (or, for leaked actors, until garbage collection).
+struct FHCIFakeChunkedWorld
+{
+	uint64 UsedMB = HCIChunkedTestBaselineMB;
+	uint64 LeakedMB = 0;
+	bool bReleaseFreesMemory = true;
+	bool bCollectFreesMemory = true;
+	int32 CancelAfterLoads = INDEX_NONE;
+	int32 MaxActors = 0;
+	int32 CollectCount = 0;
+	TArray<int32> BatchSizes;
+	TArray<FGuid> LoadedGuids;
+
+	static TArray<FGuid> MakeGuids(const int32 Count)
+	{
+		TArray<FGuid> Guids;
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			Guids.Add(FGuid(1, 0, 0, static_cast<uint32>(Index)));
+		}
+		return Guids;
+	}
+
+	FHCIChunkedActorLoadHooks MakeHooks()
+	{
+		FHCIChunkedActorLoadHooks Hooks;
+		Hooks.LoadBatch = [this](const TConstArrayView<FGuid> BatchGuids, const TFunctionRef<bool(const FGuid&)> Visit)
+		{
+			BatchSizes.Add(BatchGuids.Num());
+			uint64 BatchMB = 0;
+			for (const FGuid& Guid : BatchGuids)
+			{
+				UsedMB += HCIChunkedTestActorMB;
+				BatchMB += HCIChunkedTestActorMB;
+				LoadedGuids.Add(Guid);
+				if (!Visit(Guid))
+				{
+					break;
+				}
+			}
+			if (bReleaseFreesMemory)
+			{
+				UsedMB -= BatchMB;
+			}
+			else
+			{
+				LeakedMB += BatchMB;
+			}
+		};
+		Hooks.IsFull = [this]()
+		{
+			return MaxActors > 0 && LoadedGuids.Num() >= MaxActors;
+		};
+		Hooks.ShouldCancel = [this]()
+		{
+			return CancelAfterLoads != INDEX_NONE && LoadedGuids.Num() >= CancelAfterLoads;
+		};
+		Hooks.GetUsedPhysicalMB = [this]()
+		{
+			return UsedMB;
+		};
+		Hooks.ShouldForceCollect = []()
+		{
+			return false;
+		};
+		Hooks.CollectGarbage = [this]()
+		{
+			++CollectCount;
+			if (bCollectFreesMemory)
+			{
+				UsedMB -= LeakedMB;
+				LeakedMB = 0;
+			}
+		};
+		return Hooks;
+	}
+};
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCIChunkedActorLoadBatchBoundaryTest,
+	"HCI.Editor.ChunkedActorLoad.LoadsEveryGuidInBoundedBatches",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCIChunkedActorLoadBatchBoundaryTest::RunTest(const FString& Parameters)
+{
+	FHCIFakeChunkedWorld World;
+	const TArray<FGuid> Guids = FHCIFakeChunkedWorld::MakeGuids(10);
+	FHCIChunkedActorLoadStats Stats;
+	FHCIChunkedActorLoadDriver::Run(Guids, 4, 0, World.MakeHooks(), Stats);
+
+	TestEqual(TEXT("Status"), Stats.Status, FString(TEXT("completed")));
+	TestEqual(TEXT("Three batches"), Stats.LoadedBatchCount, 3);
+	TestTrue(TEXT("Batches of 4, 4 and 2"), World.BatchSizes == TArray<int32>({4, 4, 2}));
+	TestEqual(TEXT("Every actor loaded once"), Stats.LoadedActorCount, 10);
+	TestTrue(TEXT("Loaded in pending order"), World.LoadedGuids == Guids);
+	TestEqual(
+		TEXT("Peak is one full batch over baseline"),
+		static_cast<int64>(Stats.PeakUsedPhysicalMB),
+		static_cast<int64>(HCIChunkedTestBaselineMB + 4 * HCIChunkedTestActorMB));
+	TestEqual(TEXT("No collection without a ceiling"), World.CollectCount, 0);
+
+	FHCIFakeChunkedWorld CappedWorld;
+	CappedWorld.MaxActors = 6;
+	FHCIChunkedActorLoadStats CappedStats;
+	FHCIChunkedActorLoadDriver::Run(Guids, 4, 0, CappedWorld.MakeHooks(), CappedStats);
+	TestEqual(TEXT("Actor cap stops mid-batch"), CappedStats.LoadedActorCount, 6);
+	TestEqual(TEXT("Capped status"), CappedStats.Status, FString(TEXT("max_actor_count_reached")));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCIChunkedActorLoadMemoryCeilingTest,
+	"HCI.Editor.ChunkedActorLoad.MemoryCeilingIsCheckedAfterEveryLoad",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCIChunkedActorLoadMemoryCeilingTest::RunTest(const FString& Parameters)
+{
+	const TArray<FGuid> Guids = FHCIFakeChunkedWorld::MakeGuids(10);
+	// The third load of a batch crosses 125 MB.
+	constexpr int32 CeilingMB = 125;
+
+	// Loads leak until collection, and collection cannot free them: the scan stops inside the first batch.
+	FHCIFakeChunkedWorld LeakingWorld;
+	LeakingWorld.bReleaseFreesMemory = false;
+	LeakingWorld.bCollectFreesMemory = false;
+	FHCIChunkedActorLoadStats LeakingStats;
+	FHCIChunkedActorLoadDriver::Run(Guids, 8, CeilingMB, LeakingWorld.MakeHooks(), LeakingStats);
+	TestEqual(TEXT("Stopped by the ceiling"), LeakingStats.Status, FString(TEXT("memory_ceiling_reached")));
+	TestEqual(TEXT("Stopped right after the crossing load, not at the batch end"), LeakingStats.LoadedActorCount, 3);
+	TestEqual(TEXT("One batch"), LeakingStats.LoadedBatchCount, 1);
+	TestEqual(TEXT("Collection attempted before giving up"), LeakingWorld.CollectCount, 1);
+
+	// Collection frees the leaked loads: the cut batch's remaining guids are loaded next and nothing is skipped.
+	FHCIFakeChunkedWorld CollectableWorld;
+	CollectableWorld.bReleaseFreesMemory = false;
+	FHCIChunkedActorLoadStats CollectableStats;
+	FHCIChunkedActorLoadDriver::Run(Guids, 8, CeilingMB, CollectableWorld.MakeHooks(), CollectableStats);
+	TestEqual(TEXT("Scan completes"), CollectableStats.Status, FString(TEXT("completed")));
+	TestEqual(TEXT("Every actor loaded exactly once"), CollectableStats.LoadedActorCount, 10);
+	TestTrue(TEXT("Cut guids retried in order"), CollectableWorld.LoadedGuids == Guids);
+	TestTrue(TEXT("Peak never passes one load over the ceiling"), CollectableStats.PeakUsedPhysicalMB <= CeilingMB + HCIChunkedTestActorMB);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCIChunkedActorLoadCancelTest,
+	"HCI.Editor.ChunkedActorLoad.CancelStopsAfterTheCurrentLoad",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCIChunkedActorLoadCancelTest::RunTest(const FString& Parameters)
+{
+	FHCIFakeChunkedWorld World;
+	World.CancelAfterLoads = 5;
+	FHCIChunkedActorLoadStats Stats;
+	FHCIChunkedActorLoadDriver::Run(FHCIFakeChunkedWorld::MakeGuids(10), 4, 0, World.MakeHooks(), Stats);
+
+	TestEqual(TEXT("Status"), Stats.Status, FString(TEXT("cancelled")));
+	TestEqual(TEXT("Stopped inside the second batch"), Stats.LoadedActorCount, 5);
+	TestEqual(TEXT("Two batches started"), Stats.LoadedBatchCount, 2);
+	TestEqual(TEXT("Batch memory released"), static_cast<int64>(World.UsedMB), static_cast<int64>(HCIChunkedTestBaselineMB));
+	return true;
+}
+
+#endif
@@ -0,0 +1,309 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AgentActions/Support/HCICommitUndo.h"
+#include "Agent/Planner/HCIAgentPlan.h"
+#include "Agent/Tools/HCIToolRegistry.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Editor.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HCIAsset.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+
+namespace
+{
+static void HCI_AddUndoTestStep(FHCIAgentPlan& Plan, const TCHAR* StepId, const TCHAR* ToolName, const int32 AssetCount)
+{
+	FHCIAgentPlanStep& Step = Plan.Steps.AddDefaulted_GetRef();
+	Step.StepId = StepId;
+	Step.ToolName = ToolName;
+	Step.RiskLevel = EHCIAgentPlanRiskLevel::Write;
+	Step.bRequiresConfirm = true;
+	Step.Args = MakeShared<FJsonObject>();
+	TArray<TSharedPtr<FJsonValue>> AssetPaths;
+	for (int32 Index = 0; Index < AssetCount; ++Index)
+	{
+		AssetPaths.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("/Game/HCIUndoTest/A_%d.A_%d"), Index, Index)));
+	}
+	Step.Args->SetArrayField(TEXT("asset_paths"), AssetPaths);
+}
+
+static void HCI_AddUndoTemplatedStep(FHCIAgentPlan& Plan, const TCHAR* StepId, const TCHAR* ToolName, const TCHAR* SourceStepId)
+{
+	FHCIAgentPlanStep& Step = Plan.Steps.AddDefaulted_GetRef();
+	Step.StepId = StepId;
+	Step.ToolName = ToolName;
+	Step.RiskLevel = EHCIAgentPlanRiskLevel::Write;
+	Step.bRequiresConfirm = true;
+	Step.Args = MakeShared<FJsonObject>();
+	Step.Args->SetStringField(TEXT("asset_paths"), FString::Printf(TEXT("{{%s.asset_paths}}"), SourceStepId));
+}
+
+static UHCIAsset* HCI_CreateUndoTestAsset(const TCHAR* PackageName, const TCHAR* AssetName, const float Damage)
+{
+	UPackage* Package = CreatePackage(PackageName);
+	UHCIAsset* Asset = NewObject<UHCIAsset>(Package, AssetName, RF_Public | RF_Standalone | RF_Transactional);
+	Asset->Damage = Damage;
+	return Asset;
+}
+
+constexpr TCHAR HCIUndoBackupPackageName[] = TEXT("/Game/HCITests/CommitUndo/HCIUndoBackupAsset");
+constexpr TCHAR HCIUndoBackupObjectPath[] = TEXT("/Game/HCITests/CommitUndo/HCIUndoBackupAsset.HCIUndoBackupAsset");
+constexpr double HCIUndoRestoreTimeoutSeconds = 5.0;
+
+struct FHCIUndoBackupProbe
+{
+	FAutomationTestBase* Test = nullptr;
+	FString PackageFilename;
+	float ExpectedDamage = 10.0f;
+	int32 PreviousCeilingMB = 0;
+	double DeadlineSeconds = 0.0;
+};
+
+static void HCI_SetUndoCeilingMB(const int32 CeilingMB)
+{
+	if (IConsoleVariable* CVar = IConsoleManager::Get().FindConsoleVariable(TEXT("HCI.Undo.MemoryCeilingMB")))
+	{
+		CVar->Set(CeilingMB, ECVF_SetByCode);
+	}
+}
+
+static UHCIAsset* HCI_SaveUndoBackupFixture(FAutomationTestBase& Test, FHCIUndoBackupProbe& Probe)
+{
+	Probe.Test = &Test;
+	if (const IConsoleVariable* CVar = IConsoleManager::Get().FindConsoleVariable(TEXT("HCI.Undo.MemoryCeilingMB")))
+	{
+		Probe.PreviousCeilingMB = CVar->GetInt();
+	}
+
+	UHCIAsset* Asset = HCI_CreateUndoTestAsset(HCIUndoBackupPackageName, TEXT("HCIUndoBackupAsset"), 10.0f);
+	Probe.PackageFilename = FPaths::ConvertRelativePathToFull(
+		FPackageName::LongPackageNameToFilename(HCIUndoBackupPackageName, FPackageName::GetAssetPackageExtension()));
+	FSavePackageArgs SaveArgs;
+	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+	if (!Test.TestTrue(TEXT("Fixture package saved"), UPackage::SavePackage(Asset->GetPackage(), Asset, *Probe.PackageFilename, SaveArgs)))
+	{
+		return nullptr;
+	}
+
+	// 1 MB ceiling; 5000 resolved delta targets estimate to 1.25 MB.
+	HCI_SetUndoCeilingMB(1);
+	return Asset;
+}
+
+static FHCIAgentPlanStep HCI_MakeResolvedBackupStep(const FHCIAgentPlanStep& TemplatedStep)
+{
+	FHCIAgentPlanStep ResolvedStep = TemplatedStep;
+	ResolvedStep.Args = MakeShared<FJsonObject>();
+	TArray<TSharedPtr<FJsonValue>> AssetPaths;
+	AssetPaths.Add(MakeShared<FJsonValueString>(HCIUndoBackupObjectPath));
+	for (int32 Index = 1; Index < 5000; ++Index)
+	{
+		AssetPaths.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("/Game/HCIUndoTest/T_%d.T_%d"), Index, Index)));
+	}
+	ResolvedStep.Args->SetArrayField(TEXT("asset_paths"), AssetPaths);
+	return ResolvedStep;
+}
+} // namespace
+
+// The package restore of an undone PackageBackup record runs on a later core ticker frame.
+DEFINE_LATENT_AUTOMATION_COMMAND_ONE_PARAMETER(FHCIWaitForUndoPackageRestore, TSharedPtr<FHCIUndoBackupProbe>, Probe);
+
+bool FHCIWaitForUndoPackageRestore::Update()
+{
+	const UHCIAsset* Reloaded = FindObject<UHCIAsset>(nullptr, HCIUndoBackupObjectPath);
+	const bool bRestored = Reloaded != nullptr && Reloaded->Damage == Probe->ExpectedDamage;
+	if (!bRestored && FPlatformTime::Seconds() < Probe->DeadlineSeconds)
+	{
+		return false;
+	}
+
+	Probe->Test->TestTrue(TEXT("Undo restores the pre-commit package state"), bRestored);
+	HCI_SetUndoCeilingMB(Probe->PreviousCeilingMB);
+	IFileManager::Get().Delete(*Probe->PackageFilename, false, true, true);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCICommitUndoEstimateTest,
+	"HCI.Editor.CommitUndo.EstimatePicksDeltaOrPackageBackup",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCICommitUndoEstimateTest::RunTest(const FString& Parameters)
+{
+	FHCIToolRegistry::Get().ResetToDefaults();
+
+	FHCIAgentPlan DeltaPlan;
+	DeltaPlan.RequestId = TEXT("req_undo_delta");
+	HCI_AddUndoTestStep(DeltaPlan, TEXT("s1"), TEXT("SetTextureMaxSize"), 100);
+	HCI_AddUndoTestStep(DeltaPlan, TEXT("s2"), TEXT("ScanAssets"), 100);
+
+	const FHCICommitUndoEstimate Delta = FHCICommitUndoScope::Estimate(DeltaPlan, 4 * 1024 * 1024);
+	TestEqual(TEXT("Read-only step ignored"), Delta.DeltaAssets, 100);
+	TestEqual(TEXT("No snapshot assets"), Delta.SnapshotAssets, 0);
+	TestEqual(TEXT("Delta records are sized without package files"), Delta.FullSnapshotBytes, static_cast<int64>(0));
+	TestEqual(TEXT("Delta estimate"), Delta.EstimatedBytes, static_cast<int64>(100 * 256));
+	TestTrue(TEXT("Delta mode under ceiling"), Delta.Mode == EHCICommitUndoMode::PropertyDelta);
+
+	FHCIAgentPlan SnapshotPlan;
+	SnapshotPlan.RequestId = TEXT("req_undo_backup");
+	HCI_AddUndoTestStep(SnapshotPlan, TEXT("s1"), TEXT("AutoMaterialSetupByNameContract"), 8);
+
+	const FHCICommitUndoEstimate Backup = FHCICommitUndoScope::Estimate(SnapshotPlan, 4 * 1024 * 1024);
+	TestEqual(TEXT("Snapshot assets counted"), Backup.SnapshotAssets, 8);
+	TestTrue(TEXT("Package backup above ceiling"), Backup.Mode == EHCICommitUndoMode::PackageBackup);
+
+	const FHCICommitUndoEstimate Unbounded = FHCICommitUndoScope::Estimate(SnapshotPlan, 0);
+	TestTrue(TEXT("Zero ceiling disables the fallback"), Unbounded.Mode == EHCICommitUndoMode::PropertyDelta);
+
+	// Scan -> write plans name their targets through a pipeline template; they are sized after resolution.
+	FHCIAgentPlan PipelinePlan;
+	PipelinePlan.RequestId = TEXT("req_undo_pipeline");
+	HCI_AddUndoTestStep(PipelinePlan, TEXT("s1"), TEXT("ScanAssets"), 0);
+	HCI_AddUndoTemplatedStep(PipelinePlan, TEXT("s2"), TEXT("AutoMaterialSetupByNameContract"), TEXT("s1"));
+	const FHCICommitUndoEstimate Pipeline = FHCICommitUndoScope::Estimate(PipelinePlan, 4 * 1024 * 1024);
+	TestEqual(TEXT("Templated write step deferred"), Pipeline.DeferredSteps, 1);
+	TestEqual(TEXT("Template text is not an asset"), Pipeline.SnapshotAssets, 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCICommitUndoPropertyDeltaTest,
+	"HCI.Editor.CommitUndo.PropertyDeltaRevertsAndReapplies",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCICommitUndoPropertyDeltaTest::RunTest(const FString& Parameters)
+{
+	UHCIAsset* Asset = NewObject<UHCIAsset>(GetTransientPackage());
+	Asset->Damage = 10.0f;
+
+	FHCIPropertyDeltaChange Change(GET_MEMBER_NAME_CHECKED(UHCIAsset, Damage), TEXT("10.000000"), TEXT("25.000000"));
+	Change.Apply(Asset);
+	TestEqual(TEXT("Apply writes after value"), Asset->Damage, 25.0f);
+	Change.Revert(Asset);
+	TestEqual(TEXT("Revert restores before value"), Asset->Damage, 10.0f);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCICommitUndoScopeDeltaUndoTest,
+	"HCI.Editor.CommitUndo.ScopeRecordsDeltaThatEditorUndoReverts",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCICommitUndoScopeDeltaUndoTest::RunTest(const FString& Parameters)
+{
+	FHCIToolRegistry::Get().ResetToDefaults();
+	UHCIAsset* Asset = HCI_CreateUndoTestAsset(TEXT("/Game/HCITests/CommitUndo/HCIUndoDeltaAsset"), TEXT("HCIUndoDeltaAsset"), 10.0f);
+
+	FHCIAgentPlan Plan;
+	Plan.RequestId = TEXT("req_undo_scope_delta");
+	HCI_AddUndoTestStep(Plan, TEXT("s1"), TEXT("SetTextureMaxSize"), 1);
+	{
+		FHCICommitUndoScope Scope(Plan, FText::FromString(TEXT("HCI undo delta test")));
+		TestTrue(TEXT("Small plan records deltas"), Scope.GetMode() == EHCICommitUndoMode::PropertyDelta);
+		FHCICommitUndoScope::RecordPropertyChange(Asset, GET_MEMBER_NAME_CHECKED(UHCIAsset, Damage), [Asset]()
+		{
+			Asset->Damage = 25.0f;
+		});
+	}
+	TestEqual(TEXT("Write applied"), Asset->Damage, 25.0f);
+
+	TestTrue(TEXT("Editor undo accepted"), GEditor->UndoTransaction());
+	TestEqual(TEXT("Undo reverts the delta"), Asset->Damage, 10.0f);
+	TestTrue(TEXT("Editor redo accepted"), GEditor->RedoTransaction());
+	TestEqual(TEXT("Redo reapplies the delta"), Asset->Damage, 25.0f);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCICommitUndoScopePackageBackupTest,
+	"HCI.Editor.CommitUndo.ResolvedPipelineStepSwitchesToPackageBackupAndUndoRestores",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCICommitUndoScopePackageBackupTest::RunTest(const FString& Parameters)
+{
+	FHCIToolRegistry::Get().ResetToDefaults();
+
+	TSharedPtr<FHCIUndoBackupProbe> Probe = MakeShared<FHCIUndoBackupProbe>();
+	UHCIAsset* Asset = HCI_SaveUndoBackupFixture(*this, *Probe);
+	if (!Asset)
+	{
+		return false;
+	}
+
+	FHCIAgentPlan Plan;
+	Plan.RequestId = TEXT("req_undo_scope_backup");
+	HCI_AddUndoTestStep(Plan, TEXT("s1"), TEXT("ScanAssets"), 0);
+	HCI_AddUndoTemplatedStep(Plan, TEXT("s2"), TEXT("SetTextureMaxSize"), TEXT("s1"));
+
+	const FHCIAgentPlanStep ResolvedStep = HCI_MakeResolvedBackupStep(Plan.Steps[1]);
+
+	{
+		FHCICommitUndoScope Scope(Plan, FText::FromString(TEXT("HCI undo backup test")));
+		TestTrue(TEXT("Unresolved plan starts in delta mode"), Scope.GetMode() == EHCICommitUndoMode::PropertyDelta);
+		FHCICommitUndoScope::NoteResolvedStep(ResolvedStep);
+		TestTrue(TEXT("Resolved targets exceed the ceiling"), Scope.GetMode() == EHCICommitUndoMode::PackageBackup);
+		FHCICommitUndoScope::RecordPropertyChange(Asset, GET_MEMBER_NAME_CHECKED(UHCIAsset, Damage), [Asset]()
+		{
+			Asset->Damage = 25.0f;
+		});
+	}
+	TestEqual(TEXT("Write applied"), Asset->Damage, 25.0f);
+	TestTrue(TEXT("Editor undo accepted"), GEditor->UndoTransaction());
+
+	Probe->DeadlineSeconds = FPlatformTime::Seconds() + HCIUndoRestoreTimeoutSeconds;
+	ADD_LATENT_AUTOMATION_COMMAND(FHCIWaitForUndoPackageRestore(Probe));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCICommitUndoDirtyPackageBackupTest,
+	"HCI.Editor.CommitUndo.PackageBackupUndoKeepsUnsavedEdits",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCICommitUndoDirtyPackageBackupTest::RunTest(const FString& Parameters)
+{
+	FHCIToolRegistry::Get().ResetToDefaults();
+
+	TSharedPtr<FHCIUndoBackupProbe> Probe = MakeShared<FHCIUndoBackupProbe>();
+	UHCIAsset* Asset = HCI_SaveUndoBackupFixture(*this, *Probe);
+	if (!Asset)
+	{
+		return false;
+	}
+
+	// An edit the user made before the commit and never saved; the file on disk still holds 10.
+	Asset->Damage = 15.0f;
+	Asset->MarkPackageDirty();
+	Probe->ExpectedDamage = 15.0f;
+
+	FHCIAgentPlan Plan;
+	Plan.RequestId = TEXT("req_undo_scope_dirty_backup");
+	HCI_AddUndoTestStep(Plan, TEXT("s1"), TEXT("ScanAssets"), 0);
+	HCI_AddUndoTemplatedStep(Plan, TEXT("s2"), TEXT("SetTextureMaxSize"), TEXT("s1"));
+	const FHCIAgentPlanStep ResolvedStep = HCI_MakeResolvedBackupStep(Plan.Steps[1]);
+
+	{
+		FHCICommitUndoScope Scope(Plan, FText::FromString(TEXT("HCI undo dirty backup test")));
+		FHCICommitUndoScope::NoteResolvedStep(ResolvedStep);
+		TestTrue(TEXT("Resolved targets exceed the ceiling"), Scope.GetMode() == EHCICommitUndoMode::PackageBackup);
+		FHCICommitUndoScope::RecordPropertyChange(Asset, GET_MEMBER_NAME_CHECKED(UHCIAsset, Damage), [Asset]()
+		{
+			Asset->Damage = 25.0f;
+		});
+	}
+	TestEqual(TEXT("Write applied"), Asset->Damage, 25.0f);
+	TestTrue(TEXT("Backup copies leave the package dirty"), Asset->GetPackage()->IsDirty());
+	TestTrue(TEXT("Editor undo accepted"), GEditor->UndoTransaction());
+
+	Probe->DeadlineSeconds = FPlatformTime::Seconds() + HCIUndoRestoreTimeoutSeconds;
+	ADD_LATENT_AUTOMATION_COMMAND(FHCIWaitForUndoPackageRestore(Probe));
+	return true;
+}
+
+#endif
@@ -0,0 +1,147 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Agent/Planner/HCIKeywordIntentMatcher.h"
+#include "Misc/AutomationTest.h"
+
+namespace
+{
+// Timing bound is loose for shared CI machines; a per-term Contains scan grows ~256x between the two
+// vocabularies below, the automaton should stay within a small constant factor.
+constexpr double HCIKeywordMatcherMaxPerCharCostRatio = 8.0;
+constexpr int32 HCIKeywordMatcherBenchIterations = 2000;
+
+static FString HCI_MakeSyntheticTerm(const int32 Index)
+{
+	return FString::Printf(TEXT("term%05dx"), Index);
+}
+
+static double HCI_MeasureNsPerChar(const FHCIKeywordIntentMatcher& Matcher, const FString& Text)
+{
+	FHCIKeywordMatchResult Result;
+	const double Start = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < HCIKeywordMatcherBenchIterations; ++Iteration)
+	{
+		Matcher.Match(Text, Result);
+	}
+	const double Seconds = FPlatformTime::Seconds() - Start;
+	return Seconds * 1.0e9 / (static_cast<double>(HCIKeywordMatcherBenchIterations) * Text.Len());
+}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCIKeywordIntentMatcherLabelsTest,
+	"HCI.Editor.KeywordIntentMatcher.OnePassLabelsGroupsPathsAndNumbers",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCIKeywordIntentMatcherLabelsTest::RunTest(const FString& Parameters)
+{
+	FHCIKeywordIntentMatcher Matcher;
+	Matcher.AddBuiltInVocabulary();
+	Matcher.Compile();
+
+	FHCIKeywordMatchResult Result;
+	Matcher.Match(TEXT("Scan TRIANGLES under /Game/Art/SM_Rock.SM_Rock，然后把 game/Temp 贴图设为 2048"), Result);
+	TestTrue(TEXT("Case-insensitive triangle hit"), Result.Has(EHCIKeywordIntentGroup::TriangleNoun));
+	TestTrue(TEXT("Shared term labels both groups"), Result.Has(EHCIKeywordIntentGroup::ScanVerb) && Result.Has(EHCIKeywordIntentGroup::InspectVerb));
+	TestTrue(TEXT("Chinese term hit"), Result.Has(EHCIKeywordIntentGroup::TextureNoun));
+	TestFalse(TEXT("No level hit"), Result.Has(EHCIKeywordIntentGroup::LevelNoun));
+	if (TestEqual(TEXT("Two path tokens"), Result.PathTokens.Num(), 2))
+	{
+		TestEqual(TEXT("Object path stops at the full-width comma"), Result.PathTokens[0], FString(TEXT("/Game/Art/SM_Rock.SM_Rock")));
+		TestEqual(TEXT("Bare Game/ gets its slash"), Result.PathTokens[1], FString(TEXT("/game/Temp")));
+	}
+	TestEqual(TEXT("Digits inside paths are not numbers"), Result.Numbers.Num(), 1);
+	TestTrue(TEXT("Number labelled"), Result.Numbers.Num() == 1 && Result.Numbers[0] == 2048);
+
+	// Size keywords and connectors come back with offsets so a number can be bound to the keyword before it.
+	const FString SizeText(TEXT("贴图最大尺寸设为 2048"));
+	Matcher.Match(SizeText, Result);
+	const FHCIKeywordHit* SizeHit = Result.PositionalHits.FindByPredicate([](const FHCIKeywordHit& Hit)
+	{
+		return Hit.Group == EHCIKeywordIntentGroup::SizeKeyword;
+	});
+	const FHCIKeywordHit* ConnectorHit = Result.PositionalHits.FindByPredicate([](const FHCIKeywordHit& Hit)
+	{
+		return Hit.Group == EHCIKeywordIntentGroup::SizeConnector && Hit.Span.End - Hit.Span.Start == 2;
+	});
+	if (TestNotNull(TEXT("Size keyword hit"), SizeHit) && TestNotNull(TEXT("Two-character connector hit"), ConnectorHit))
+	{
+		TestEqual(TEXT("Keyword span"), SizeText.Mid(SizeHit->Span.Start, SizeHit->Span.End - SizeHit->Span.Start), FString(TEXT("尺寸")));
+		TestEqual(TEXT("Connector follows the keyword"), ConnectorHit->Span.Start, SizeHit->Span.End);
+	}
+	if (TestEqual(TEXT("Number span recorded"), Result.NumberSpans.Num(), 1))
+	{
+		TestEqual(TEXT("Number start"), Result.NumberSpans[0].Start, SizeText.Len() - 4);
+		TestEqual(TEXT("Number end"), Result.NumberSpans[0].End, SizeText.Len());
+	}
+
+	{
+		HCI_REQUEST_ARENA_SCOPE(FString(TEXT("req_keyword_matcher_arena")));
+		FHCIKeywordArenaMatchResult ArenaResult;
+		Matcher.Match(SizeText, ArenaResult);
+		TestEqual(TEXT("Arena result sees the same groups"), ArenaResult.GroupMask, Result.GroupMask);
+		TestEqual(TEXT("Arena result sees the same hits"), ArenaResult.PositionalHits.Num(), Result.PositionalHits.Num());
+	}
+
+	FString Error;
+	TestTrue(TEXT("Vocabulary file extends a group"), Matcher.AddTermsFromJson(TEXT("{\"version\":1,\"groups\":{\"texture_noun\":[\"Albedo\"]}}"), Error));
+	TestFalse(TEXT("Unknown groups are reported"), Matcher.AddTermsFromJson(TEXT("{\"groups\":{\"no_such_group\":[\"x\"]}}"), Error));
+	TestTrue(TEXT("Reason names the group"), Error.Contains(TEXT("no_such_group")));
+	TestFalse(TEXT("Adding terms invalidates the automaton"), Matcher.IsCompiled());
+	Matcher.Compile();
+	Matcher.Match(TEXT("fix the albedo size"), Result);
+	TestTrue(TEXT("Extended term matches after recompile"), Result.Has(EHCIKeywordIntentGroup::TextureNoun));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCIKeywordIntentMatcherPerCharCostTest,
+	"HCI.Editor.KeywordIntentMatcher.PerCharCostIsFlatAsVocabularyGrows",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCIKeywordIntentMatcherPerCharCostTest::RunTest(const FString& Parameters)
+{
+	FString Text;
+	for (int32 Index = 0; Index < 40; ++Index)
+	{
+		Text += FString::Printf(TEXT("检查 /Game/Art/Props 下 term%05d 的贴图 and scan %s "), Index * 97, *HCI_MakeSyntheticTerm(Index * 53));
+	}
+
+	FHCIKeywordIntentMatcher Small;
+	FHCIKeywordIntentMatcher Large;
+	Small.AddBuiltInVocabulary();
+	Large.AddBuiltInVocabulary();
+	for (int32 Index = 0; Index < 16; ++Index)
+	{
+		Small.AddTerm(EHCIKeywordIntentGroup::TextureNoun, HCI_MakeSyntheticTerm(Index));
+	}
+	for (int32 Index = 0; Index < 4096; ++Index)
+	{
+		Large.AddTerm(static_cast<EHCIKeywordIntentGroup>(Index % static_cast<int32>(EHCIKeywordIntentGroup::Count)), HCI_MakeSyntheticTerm(Index));
+	}
+	Small.Compile();
+	Large.Compile();
+
+	// Warm both once so first-touch costs are not attributed to the small run.
+	HCI_MeasureNsPerChar(Small, Text);
+	HCI_MeasureNsPerChar(Large, Text);
+	const double SmallNsPerChar = HCI_MeasureNsPerChar(Small, Text);
+	const double LargeNsPerChar = HCI_MeasureNsPerChar(Large, Text);
+	const double Ratio = LargeNsPerChar / FMath::Max(SmallNsPerChar, 0.001);
+
+	AddInfo(FString::Printf(
+		TEXT("keyword_matcher chars=%d small_terms=%d large_terms=%d small_ns_per_char=%.2f large_ns_per_char=%.2f ratio=%.2f"),
+		Text.Len(),
+		Small.GetTermCount(),
+		Large.GetTermCount(),
+		SmallNsPerChar,
+		LargeNsPerChar,
+		Ratio));
+	TestTrue(TEXT("Large vocabulary compiled"), Large.GetTermCount() > 4000);
+	TestTrue(
+		FString::Printf(TEXT("Per-char cost ratio should stay under %.1f (was %.2f)"), HCIKeywordMatcherMaxPerCharCostRatio, Ratio),
+		Ratio <= HCIKeywordMatcherMaxPerCharCostRatio);
+	return true;
+}
+
+#endif
@@ -0,0 +1,73 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Factories/HCIKitReimportPipeline.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Services/HCIParserService.h"
+
+namespace
+{
+static const TCHAR* HCIReimportTestKitJson = TEXT("{\"schema_version\":1,\"id\":\"HCI_ReimportTest_01\",\"display_name\":\"Reimport Test\",\"params\":{\"damage\":10.0}}");
+static const TCHAR* HCIReimportTestKitJsonEdited = TEXT("{\"schema_version\":1,\"id\":\"HCI_ReimportTest_01\",\"display_name\":\"Reimport Test\",\"params\":{\"damage\":25.0}}");
+
+static FString HCI_GetReimportTestKitPath()
+{
+	return FPaths::ConvertRelativePathToFull(FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("HCI/Tests/reimport_pipeline_test.hciabilitykit")));
+}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCIKitReimportClassifySourceChangeTest,
+	"HCI.Editor.Reimport.ClassifySourceChangeSkipsUnchangedFiles",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCIKitReimportClassifySourceChangeTest::RunTest(const FString& Parameters)
+{
+	const FString KitPath = HCI_GetReimportTestKitPath();
+	TestTrue(TEXT("fixture written"), FFileHelper::SaveStringToFile(HCIReimportTestKitJson, *KitPath));
+
+	FHCIKitReimportSource Source;
+	Source.AssetPath = TEXT("/Game/__HCI_Test/Reimport/KitA.KitA");
+	Source.SourceFilename = KitPath;
+	Source.RecordedTimestamp = IFileManager::Get().GetTimeStamp(*KitPath);
+	Source.RecordedHash = FMD5Hash::HashFile(*KitPath);
+
+	bool bHashed = false;
+	TestTrue(TEXT("same timestamp is unchanged"), FHCIKitReimportPipeline::ClassifySourceChange(Source, &bHashed) == EHCIKitSourceChange::Unchanged);
+	TestTrue(TEXT("same timestamp still hashes"), bHashed);
+
+	Source.RecordedTimestamp = FDateTime(2000, 1, 1);
+	TestTrue(TEXT("touched but identical content is unchanged"), FHCIKitReimportPipeline::ClassifySourceChange(Source, &bHashed) == EHCIKitSourceChange::Unchanged);
+	TestTrue(TEXT("timestamp mismatch falls back to hashing"), bHashed);
+
+	FHCIKitReimportOptions Options;
+	Options.bShowNotification = false;
+	const FHCIKitReimportStats UnchangedStats = FHCIKitReimportPipeline::Run(MakeArrayView(&Source, 1), Options);
+	TestEqual(TEXT("unchanged batch parses nothing"), UnchangedStats.Parsed, 0);
+	TestEqual(TEXT("unchanged batch counts the skip"), UnchangedStats.Unchanged, 1);
+	TestEqual(TEXT("unchanged batch reimports nothing"), UnchangedStats.Reimported, 0);
+
+	TestTrue(TEXT("fixture edited"), FFileHelper::SaveStringToFile(HCIReimportTestKitJsonEdited, *KitPath));
+	TestTrue(TEXT("edited content is changed"), FHCIKitReimportPipeline::ClassifySourceChange(Source) == EHCIKitSourceChange::Changed);
+
+	// An edit in the same second as the import leaves the recorded timestamp matching.
+	FHCIKitReimportSource SameSecondSource = Source;
+	SameSecondSource.RecordedTimestamp = IFileManager::Get().GetTimeStamp(*KitPath);
+	TestTrue(TEXT("same-second edit is changed"), FHCIKitReimportPipeline::ClassifySourceChange(SameSecondSource) == EHCIKitSourceChange::Changed);
+
+	FHCIParsedData Parsed;
+	FHCIParseError ParseError;
+	TestTrue(TEXT("changed file parses without hook"), FHCIParserService::TryParseKitFileWithoutHook(KitPath, Parsed, ParseError));
+	TestEqual(TEXT("parsed damage reflects edit"), Parsed.Damage, 25.0f);
+
+	FHCIKitReimportSource MissingSource = Source;
+	MissingSource.SourceFilename = KitPath + TEXT(".missing");
+	TestTrue(TEXT("missing file is reported"), FHCIKitReimportPipeline::ClassifySourceChange(MissingSource) == EHCIKitSourceChange::Missing);
+
+	IFileManager::Get().Delete(*KitPath);
+	return true;
+}
+
+#endif
@@ -0,0 +1,64 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AgentActions/Support/HCILevelMeshScanIndex.h"
+#include "Engine/Engine.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCILevelMeshScanIndexIncrementalTest,
+	"HCI.Editor.LevelMeshScanIndex.TracksActorsIncrementally",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCILevelMeshScanIndexIncrementalTest::RunTest(const FString& Parameters)
+{
+	UWorld* World = UWorld::CreateWorld(EWorldType::Editor, false, TEXT("HCILevelMeshScanIndexTestWorld"));
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Editor);
+	WorldContext.SetCurrentWorld(World);
+
+	AStaticMeshActor* ActorA = World->SpawnActor<AStaticMeshActor>();
+	ActorA->SetActorLabel(TEXT("HCI_ScanIndex_A"));
+
+	FHCILevelMeshScanIndex& Index = FHCILevelMeshScanIndex::Get();
+	Index.SyncToWorld(World);
+	const int32 RebuildCount = Index.GetRebuildCount();
+	const int32 InitialActorCount = Index.GetActorCount();
+
+	TArray<AActor*> Matches;
+	Index.FindActorsByNames({TEXT("hci_scanindex_a")}, Matches);
+	TestEqual(TEXT("Label lookup should be case-insensitive"), Matches.Num(), 1);
+
+	TArray<UStaticMeshComponent*> Components;
+	Index.GatherMeshComponents(ActorA, Components);
+	TestEqual(TEXT("Indexed actor should expose its static mesh component"), Components.Num(), 1);
+
+	AStaticMeshActor* ActorB = World->SpawnActor<AStaticMeshActor>();
+	ActorB->SetActorLabel(TEXT("HCI_ScanIndex_B"));
+	Index.SyncToWorld(World);
+	TestEqual(TEXT("Spawned actors should be added without a rebuild"), Index.GetRebuildCount(), RebuildCount);
+	TestEqual(TEXT("Actor count should grow by one"), Index.GetActorCount(), InitialActorCount + 1);
+	Index.FindActorsByNames({TEXT("HCI_ScanIndex_B")}, Matches);
+	TestEqual(TEXT("New actor should be found by label"), Matches.Num(), 1);
+
+	ActorA->SetActorLabel(TEXT("HCI_ScanIndex_Renamed"));
+	Index.SyncToWorld(World);
+	Index.FindActorsByNames({TEXT("HCI_ScanIndex_A")}, Matches);
+	TestEqual(TEXT("Old label should no longer match"), Matches.Num(), 0);
+	Index.FindActorsByNames({TEXT("HCI_ScanIndex_Renamed")}, Matches);
+	TestEqual(TEXT("Relabelled actor should be re-hashed"), Matches.Num(), 1);
+
+	World->DestroyActor(ActorB);
+	Index.SyncToWorld(World);
+	TArray<AActor*> AllActors;
+	Index.GetAllActors(AllActors);
+	TestFalse(TEXT("Destroyed actors should drop out of iteration"), AllActors.Contains(ActorB));
+	TestEqual(TEXT("Incremental updates should not trigger a rebuild"), Index.GetRebuildCount(), RebuildCount);
+
+	Index.Invalidate();
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+	return true;
+}
+
+#endif
@@ -0,0 +1,181 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Agent/Planner/HCIAgentPlan.h"
+#include "Agent/Planner/HCIAgentPlanner.h"
+#include "Agent/Tools/HCIAgentToolAction.h"
+#include "Agent/Tools/HCIToolRegistry.h"
+#include "HAL/FileManager.h"
+#include "HttpPath.h"
+#include "HttpServerModule.h"
+#include "HttpServerRequest.h"
+#include "HttpServerResponse.h"
+#include "IHttpRouter.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+constexpr uint32 HCISingleFlightStubPort = 18731;
+constexpr int32 HCISingleFlightCallerCount = 5;
+// This caller cancels right after dispatch; the other callers must still be served by the shared attempt.
+constexpr int32 HCISingleFlightCancelledCaller = 1;
+constexpr double HCISingleFlightTimeoutSeconds = 10.0;
+
+struct FHCISingleFlightProbe
+{
+	FAutomationTestBase* Test = nullptr;
+	TSharedPtr<IHttpRouter> Router;
+	FHttpRouteHandle RouteHandle;
+	FString FixtureDir;
+	int32 NetworkCalls = 0;
+	int32 Delivered = 0;
+	int32 Coalesced = 0;
+	int32 MaxCallerCount = 0;
+	TArray<FString> CallbackRequestIds;
+	TArray<FString> MismatchedPlanRequestIds;
+	double DeadlineSeconds = 0.0;
+};
+
+static FString HCI_MakeSingleFlightRequestId(const int32 Index)
+{
+	return FString::Printf(TEXT("req_single_flight_%02d"), Index);
+}
+
+static bool HCI_WriteSingleFlightProviderConfig(const FString& FixtureDir, FString& OutProviderPath)
+{
+	OutProviderPath = FixtureDir / TEXT("llm_provider.local.json");
+	const FString ProviderJson = FString::Printf(
+		TEXT("{\n")
+		TEXT("  \"api_key\": \"unit-test-key\",\n")
+		TEXT("  \"api_url\": \"http://127.0.0.1:%u/v1/chat/completions\",\n")
+		TEXT("  \"model\": \"stub-model\"\n")
+		TEXT("}\n"),
+		HCISingleFlightStubPort);
+	IFileManager::Get().MakeDirectory(*FixtureDir, true);
+	return FFileHelper::SaveStringToFile(ProviderJson, *OutProviderPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+}
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_ONE_PARAMETER(FHCIWaitForSingleFlightCallers, TSharedPtr<FHCISingleFlightProbe>, Probe);
+
+bool FHCIWaitForSingleFlightCallers::Update()
+{
+	const int32 ExpectedDelivered = HCISingleFlightCallerCount - 1;
+	if (Probe->Delivered < ExpectedDelivered && FPlatformTime::Seconds() < Probe->DeadlineSeconds)
+	{
+		return false;
+	}
+
+	FAutomationTestBase& Test = *Probe->Test;
+	Test.TestEqual(TEXT("Identical concurrent requests reach the stub exactly once"), Probe->NetworkCalls, 1);
+	Test.TestEqual(TEXT("Every caller that did not cancel is called back"), Probe->Delivered, ExpectedDelivered);
+	Test.TestFalse(
+		TEXT("The cancelled caller is detached"),
+		Probe->CallbackRequestIds.Contains(HCI_MakeSingleFlightRequestId(HCISingleFlightCancelledCaller)));
+	Test.TestEqual(TEXT("Joined callers are marked as coalesced"), Probe->Coalesced, ExpectedDelivered - 1);
+	Test.TestEqual(TEXT("Metadata counts every caller of the attempt"), Probe->MaxCallerCount, HCISingleFlightCallerCount);
+	Test.TestEqual(TEXT("Each caller gets a plan under its own request id"), Probe->MismatchedPlanRequestIds.Num(), 0);
+
+	Probe->Router->UnbindRoute(Probe->RouteHandle);
+	IFileManager::Get().DeleteDirectory(*Probe->FixtureDir, false, true);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCILlmPlannerSingleFlightTest,
+	"HCI.Editor.AgentPlanLLM.IdenticalInFlightRequestsShareOneHttpCall",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCILlmPlannerSingleFlightTest::RunTest(const FString& Parameters)
+{
+	FHCIAgentPlanner::ResetMetricsForTesting();
+	FHCIToolRegistry& Registry = FHCIToolRegistry::Get();
+	Registry.ResetToDefaults();
+
+	TSharedPtr<FHCISingleFlightProbe> Probe = MakeShared<FHCISingleFlightProbe>();
+	Probe->Test = this;
+	Probe->FixtureDir = FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir() / TEXT("HCIAbilityKit/Tests/SingleFlight"));
+
+	FString ProviderPath;
+	if (!TestTrue(TEXT("Provider config fixture written"), HCI_WriteSingleFlightProviderConfig(Probe->FixtureDir, ProviderPath)))
+	{
+		return false;
+	}
+
+	Probe->Router = FHttpServerModule::Get().GetHttpRouter(HCISingleFlightStubPort);
+	if (!TestTrue(TEXT("Stub HTTP router available"), Probe->Router.IsValid()))
+	{
+		return false;
+	}
+
+	TWeakPtr<FHCISingleFlightProbe> WeakProbe = Probe;
+	Probe->RouteHandle = Probe->Router->BindRoute(
+		FHttpPath(TEXT("/v1/chat/completions")),
+		EHttpServerRequestVerbs::VERB_POST,
+		FHttpRequestHandler::CreateLambda([WeakProbe](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+		{
+			if (const TSharedPtr<FHCISingleFlightProbe> Pinned = WeakProbe.Pin())
+			{
+				Pinned->NetworkCalls += 1;
+			}
+			OnComplete(FHttpServerResponse::Create(
+				TEXT("{\"choices\":[{\"message\":{\"role\":\"assistant\",\"content\":")
+				TEXT("\"{\\\"intent\\\":\\\"chat_reply\\\",\\\"assistant_message\\\":\\\"stub reply\\\",\\\"steps\\\":[]}\"}}]}"),
+				TEXT("application/json")));
+			return true;
+		}));
+	if (!TestTrue(TEXT("Stub route bound"), Probe->RouteHandle.IsValid()))
+	{
+		return false;
+	}
+	FHttpServerModule::Get().StartAllListeners();
+
+	FHCIAgentPlannerBuildOptions Options;
+	Options.bPreferLlm = true;
+	Options.bUseRealHttpProvider = true;
+	Options.LlmApiKeyConfigPath = ProviderPath;
+	Options.LlmRetryCount = 0;
+	Options.bEnableAutoEnvContextScan = false;
+	Options.bLlmEnableHedging = false;
+	Options.LlmHttpTimeoutMs = 8000;
+
+	// All callers are dispatched before the game thread can see a response, so they are concurrent by construction.
+	for (int32 Index = 0; Index < HCISingleFlightCallerCount; ++Index)
+	{
+		FHCIAgentPlannerBuildOptions CallerOptions = Options;
+		CallerOptions.Cancellation = MakeShared<FHCIAgentExecutionCancellation>();
+		const FString RequestId = HCI_MakeSingleFlightRequestId(Index);
+		FHCIAgentPlanner::BuildPlanFromNaturalLanguageWithProviderAsync(
+			Index % 2 == 0 ? TEXT("介绍一下你自己") : TEXT("  介绍一下你自己 "),
+			RequestId,
+			Registry,
+			CallerOptions,
+			[WeakProbe, RequestId](bool bBuilt, FHCIAgentPlan Plan, FString RouteReason, FHCIAgentPlannerResultMetadata Metadata, FString Error)
+			{
+				const TSharedPtr<FHCISingleFlightProbe> Pinned = WeakProbe.Pin();
+				if (!Pinned.IsValid())
+				{
+					return;
+				}
+				Pinned->Delivered += 1;
+				Pinned->CallbackRequestIds.Add(RequestId);
+				Pinned->Coalesced += Metadata.bLlmRequestCoalesced ? 1 : 0;
+				Pinned->MaxCallerCount = FMath::Max(Pinned->MaxCallerCount, Metadata.LlmCoalescedCallerCount);
+				if (!bBuilt || Plan.RequestId != RequestId)
+				{
+					Pinned->MismatchedPlanRequestIds.Add(RequestId);
+				}
+			});
+		if (Index == HCISingleFlightCancelledCaller)
+		{
+			CallerOptions.Cancellation->Request();
+		}
+	}
+
+	Probe->DeadlineSeconds = FPlatformTime::Seconds() + HCISingleFlightTimeoutSeconds;
+	ADD_LATENT_AUTOMATION_COMMAND(FHCIWaitForSingleFlightCallers(Probe));
+	return true;
+}
+
+#endif
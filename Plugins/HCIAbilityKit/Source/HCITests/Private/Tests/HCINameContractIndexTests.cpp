@@ -0,0 +1,169 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AgentActions/Support/HCINameContractIndex.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/Texture2D.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+namespace
+{
+static FString HCI_MakeContractTestPath(const FString& AssetName)
+{
+	return FString::Printf(TEXT("/Game/Temp/NameContract/%s.%s"), *AssetName, *AssetName);
+}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCINameContractIndexGroupingTest,
+	"HCI.Editor.NameContractIndex.GroupsStrictContractAndReportsLeftovers",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCINameContractIndexGroupingTest::RunTest(const FString& Parameters)
+{
+	FHCINameContractIndex Index;
+	const TArray<FString> AssetPaths = {
+		HCI_MakeContractTestPath(TEXT("SM_Rock")),
+		HCI_MakeContractTestPath(TEXT("T_Rock_BC")),
+		HCI_MakeContractTestPath(TEXT("T_Rock_N")),
+		HCI_MakeContractTestPath(TEXT("T_Rock_RMA")),
+		HCI_MakeContractTestPath(TEXT("SM_Tree")),
+		HCI_MakeContractTestPath(TEXT("T_Tree_BC")),
+		HCI_MakeContractTestPath(TEXT("T_Lamp_N")),
+		HCI_MakeContractTestPath(TEXT("T_Crate_Color")),
+	};
+
+	bool bFromCache = true;
+	const TSharedRef<const FHCINameContractGrouping> Grouping = Index.GetGrouping(AssetPaths, &bFromCache);
+	TestFalse(TEXT("first grouping is built"), bFromCache);
+	TestEqual(TEXT("ready groups"), Grouping->ReadyGroups.Num(), 1);
+	if (Grouping->ReadyGroups.Num() == 1)
+	{
+		TestEqual(TEXT("ready id"), Grouping->ReadyGroups[0].Id, FString(TEXT("Rock")));
+		TestEqual(TEXT("RMA maps to ORM"), Grouping->ReadyGroups[0].TextureORMObjectPath, HCI_MakeContractTestPath(TEXT("T_Rock_RMA")));
+	}
+	TestEqual(TEXT("missing groups"), Grouping->MissingGroups, TArray<FString>{TEXT("Tree (missing_textures)")});
+	TestEqual(TEXT("unresolved assets"), Grouping->UnresolvedAssets.Num(), 2);
+	TestEqual(TEXT("orphan assets"), Grouping->OrphanAssets.Num(), 2);
+	TestTrue(TEXT("unpaired texture is orphan"), Grouping->OrphanReasonByPath.Contains(HCI_MakeContractTestPath(TEXT("T_Lamp_N"))));
+	const FString* CrateReason = Grouping->OrphanReasonByPath.Find(HCI_MakeContractTestPath(TEXT("T_Crate_Color")));
+	TestTrue(TEXT("suffix reason"), CrateReason != nullptr && CrateReason->Contains(TEXT("_BC")));
+
+	const TSharedRef<const FHCINameContractGrouping> Again = Index.GetGrouping(AssetPaths, &bFromCache);
+	TestTrue(TEXT("same input reuses grouping"), bFromCache);
+	TestTrue(TEXT("same grouping instance"), &Again.Get() == &Grouping.Get());
+	TestEqual(TEXT("built once"), Index.GetGroupingBuildCount(), 1);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCINameContractIndexResolveAssetsTest,
+	"HCI.Editor.NameContractIndex.ResolvesEveryGroupBeforeAnythingIsCreated",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCINameContractIndexResolveAssetsTest::RunTest(const FString& Parameters)
+{
+	const auto MakeGroup = [](const TCHAR* Id)
+	{
+		FHCINameContractGroup Group;
+		Group.Id = Id;
+		Group.MeshObjectPath = HCI_MakeContractTestPath(FString::Printf(TEXT("SM_%s"), Id));
+		Group.TextureBCObjectPath = HCI_MakeContractTestPath(FString::Printf(TEXT("T_%s_BC"), Id));
+		Group.TextureNObjectPath = HCI_MakeContractTestPath(FString::Printf(TEXT("T_%s_N"), Id));
+		Group.TextureORMObjectPath = HCI_MakeContractTestPath(FString::Printf(TEXT("T_%s_ORM"), Id));
+		return Group;
+	};
+	const TArray<FHCINameContractGroup> Groups = {MakeGroup(TEXT("Rock")), MakeGroup(TEXT("Tree"))};
+
+	TMap<FString, UObject*> LoadableAssets;
+	for (const FHCINameContractGroup& Group : Groups)
+	{
+		LoadableAssets.Add(Group.MeshObjectPath, NewObject<UStaticMesh>(GetTransientPackage()));
+		LoadableAssets.Add(Group.TextureBCObjectPath, NewObject<UTexture2D>(GetTransientPackage()));
+		LoadableAssets.Add(Group.TextureNObjectPath, NewObject<UTexture2D>(GetTransientPackage()));
+		LoadableAssets.Add(Group.TextureORMObjectPath, NewObject<UTexture2D>(GetTransientPackage()));
+	}
+	int32 LoadCount = 0;
+	const auto LoadAsset = [&LoadableAssets, &LoadCount](const FString& ObjectPath)
+	{
+		++LoadCount;
+		return LoadableAssets.FindRef(ObjectPath);
+	};
+
+	TArray<FHCINameContractGroupAssets> Assets;
+	FString FailedPath;
+	TestTrue(TEXT("all groups resolve"), FHCINameContractIndex::ResolveGroupAssets(Groups, LoadAsset, Assets, FailedPath));
+	TestEqual(TEXT("one entry per group"), Assets.Num(), 2);
+	TestTrue(TEXT("no failed path"), FailedPath.IsEmpty());
+	if (Assets.Num() == 2)
+	{
+		TestTrue(TEXT("second mesh kept for assignment"), Assets[1].Mesh == LoadableAssets.FindRef(Groups[1].MeshObjectPath));
+		TestTrue(TEXT("second ORM kept for binding"), Assets[1].TextureORM == LoadableAssets.FindRef(Groups[1].TextureORMObjectPath));
+	}
+	TestEqual(TEXT("each asset loaded once"), LoadCount, 8);
+
+	// The last group's mesh does not load as a mesh: nothing is resolved, so the commit creates no instance at all.
+	LoadableAssets.Add(Groups[1].MeshObjectPath, NewObject<UTexture2D>(GetTransientPackage()));
+	TestFalse(TEXT("wrong mesh class fails"), FHCINameContractIndex::ResolveGroupAssets(Groups, LoadAsset, Assets, FailedPath));
+	TestEqual(TEXT("failed path is the mesh"), FailedPath, Groups[1].MeshObjectPath);
+	TestEqual(TEXT("no partial resolution"), Assets.Num(), 0);
+
+	LoadableAssets.Remove(Groups[0].TextureNObjectPath);
+	TestFalse(TEXT("missing texture fails"), FHCINameContractIndex::ResolveGroupAssets(Groups, LoadAsset, Assets, FailedPath));
+	TestEqual(TEXT("first failure reported"), FailedPath, Groups[0].TextureNObjectPath);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCINameContractIndexLooseRoleTest,
+	"HCI.Editor.NameContractIndex.LooseRoleHeuristics",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCINameContractIndexLooseRoleTest::RunTest(const FString& Parameters)
+{
+	const FHCINameContractClassification Orm = FHCINameContractIndex::ClassifyName(TEXT("T_Wall_ORM"));
+	TestEqual(TEXT("orm role"), Orm.LooseRole, EHCITextureRole::ORM);
+	TestEqual(TEXT("orm quality"), Orm.LooseRoleQuality, 3);
+
+	const FHCINameContractClassification Albedo = FHCINameContractIndex::ClassifyName(TEXT("Wall_Albedo"));
+	TestEqual(TEXT("albedo role"), Albedo.LooseRole, EHCITextureRole::BC);
+	TestEqual(TEXT("albedo quality"), Albedo.LooseRoleQuality, 2);
+	TestEqual(TEXT("albedo not strict"), Albedo.Kind, EHCINameContractKind::None);
+
+	const FHCINameContractClassification Normal = FHCINameContractIndex::ClassifyName(TEXT("T_Wall_NormalMap"));
+	TestEqual(TEXT("normal role"), Normal.LooseRole, EHCITextureRole::N);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCINameContractIndexScaleTest,
+	"HCI.Editor.NameContractIndex.Groups20kTexturesInOnePass",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCINameContractIndexScaleTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 GroupCount = 5000;
+	TArray<FString> AssetPaths;
+	AssetPaths.Reserve(GroupCount * 4);
+	for (int32 GroupIndex = 0; GroupIndex < GroupCount; ++GroupIndex)
+	{
+		const FString Id = FString::Printf(TEXT("Prop%05d"), GroupIndex);
+		AssetPaths.Add(HCI_MakeContractTestPath(FString::Printf(TEXT("SM_%s"), *Id)));
+		AssetPaths.Add(HCI_MakeContractTestPath(FString::Printf(TEXT("T_%s_BC"), *Id)));
+		AssetPaths.Add(HCI_MakeContractTestPath(FString::Printf(TEXT("T_%s_N"), *Id)));
+		AssetPaths.Add(HCI_MakeContractTestPath(FString::Printf(TEXT("T_%s_ORM"), *Id)));
+	}
+
+	FHCINameContractIndex Index;
+	const double StartSeconds = FPlatformTime::Seconds();
+	const TSharedRef<const FHCINameContractGrouping> Grouping = Index.GetGrouping(AssetPaths);
+	const double BuildMs = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+	TestEqual(TEXT("all groups ready"), Grouping->ReadyGroups.Num(), GroupCount);
+	TestEqual(TEXT("no orphans"), Grouping->OrphanAssets.Num(), 0);
+	TestEqual(TEXT("names classified once"), Index.GetClassifiedNameCount(), GroupCount * 4);
+
+	AddInfo(FString::Printf(TEXT("name_contract_grouping assets=%d build_ms=%.2f"), AssetPaths.Num(), BuildMs));
+	return true;
+}
+
+#endif
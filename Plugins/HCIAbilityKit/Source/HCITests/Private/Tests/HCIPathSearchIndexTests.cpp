@@ -0,0 +1,138 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AgentActions/Support/HCIPathSearchIndex.h"
+#include "Misc/AutomationTest.h"
+
+namespace
+{
+constexpr int32 HCIPathSearchPerfDirectoryCount = 60000;
+
+static void HCI_BuildSyntheticDirectories(TArray<FString>& OutPaths)
+{
+	static const TCHAR* Roots[] = {TEXT("Art"), TEXT("Maps"), TEXT("Characters"), TEXT("Temp"), TEXT("FX"), TEXT("UI")};
+	static const TCHAR* Leaves[] = {TEXT("Textures"), TEXT("Meshes"), TEXT("Materials"), TEXT("Old_Assets"), TEXT("Hero-Props"), TEXT("Blockout")};
+
+	OutPaths.Reset(HCIPathSearchPerfDirectoryCount);
+	for (int32 Index = 0; OutPaths.Num() < HCIPathSearchPerfDirectoryCount; ++Index)
+	{
+		const TCHAR* Root = Roots[Index % UE_ARRAY_COUNT(Roots)];
+		const TCHAR* Leaf = Leaves[(Index / UE_ARRAY_COUNT(Roots)) % UE_ARRAY_COUNT(Leaves)];
+		OutPaths.Add(FString::Printf(TEXT("/Game/%s/Zone_%04d/%s"), Root, Index / 36, Leaf));
+	}
+}
+
+static void HCI_SortMatches(TArray<FHCIPathSearchMatch>& Matches)
+{
+	Matches.Sort([](const FHCIPathSearchMatch& A, const FHCIPathSearchMatch& B)
+	{
+		if (A.Score != B.Score)
+		{
+			return A.Score > B.Score;
+		}
+		return A.Path.Compare(B.Path, ESearchCase::CaseSensitive) < 0;
+	});
+}
+
+// The pre-index SearchPath loop: normalize and score every path for every keyword on each query.
+static void HCI_QueryLinear(const TArray<FString>& Paths, const TArray<FString>& Keywords, TArray<FHCIPathSearchMatch>& OutMatches)
+{
+	OutMatches.Reset();
+	for (const FString& Path : Paths)
+	{
+		int32 BestScore = 0;
+		FString BestKeyword;
+		for (const FString& Keyword : Keywords)
+		{
+			const int32 Score = FHCIPathSearchIndex::ComputePathKeywordScore(Path, Keyword);
+			if (Score > BestScore)
+			{
+				BestScore = Score;
+				BestKeyword = Keyword;
+			}
+		}
+		if (BestScore > 0)
+		{
+			OutMatches.Add({Path, BestScore, BestKeyword});
+		}
+	}
+}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCIPathSearchIndexMatchesLinearScanTest,
+	"HCI.Editor.PathSearchIndex.MatchesLinearScanAndReportsLatency",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCIPathSearchIndexMatchesLinearScanTest::RunTest(const FString& Parameters)
+{
+	TArray<FString> Paths;
+	HCI_BuildSyntheticDirectories(Paths);
+
+	FHCIPathSearchIndex Index;
+	const double BuildStart = FPlatformTime::Seconds();
+	for (const FString& Path : Paths)
+	{
+		Index.AddPath(Path);
+	}
+	const double BuildMs = (FPlatformTime::Seconds() - BuildStart) * 1000.0;
+	TestEqual(TEXT("Every synthetic directory should be indexed"), Index.GetPathCount(), Paths.Num());
+
+	const TArray<TArray<FString>> Queries = {
+		{TEXT("hero props")},
+		{TEXT("Zone_0042")},
+		{TEXT("old assets folder"), TEXT("old assets")},
+		{TEXT("oldassetsbackup")},
+		{TEXT("fx")},
+		{TEXT("nothing_like_this")}};
+
+	double LinearMs = 0.0;
+	double IndexedMs = 0.0;
+	for (const TArray<FString>& Keywords : Queries)
+	{
+		TArray<FHCIPathSearchMatch> Expected;
+		const double LinearStart = FPlatformTime::Seconds();
+		HCI_QueryLinear(Paths, Keywords, Expected);
+		LinearMs += (FPlatformTime::Seconds() - LinearStart) * 1000.0;
+
+		TArray<FHCIPathSearchMatch> Actual;
+		const double IndexedStart = FPlatformTime::Seconds();
+		Index.Query(Keywords, Actual);
+		IndexedMs += (FPlatformTime::Seconds() - IndexedStart) * 1000.0;
+
+		HCI_SortMatches(Expected);
+		HCI_SortMatches(Actual);
+		const FString QueryLabel = FString::Join(Keywords, TEXT("|"));
+		if (!TestEqual(*FString::Printf(TEXT("Match count for '%s'"), *QueryLabel), Actual.Num(), Expected.Num()))
+		{
+			continue;
+		}
+		for (int32 MatchIndex = 0; MatchIndex < Expected.Num(); ++MatchIndex)
+		{
+			if (Actual[MatchIndex].Path != Expected[MatchIndex].Path || Actual[MatchIndex].Score != Expected[MatchIndex].Score)
+			{
+				AddError(FString::Printf(TEXT("Mismatch for '%s' at %d: %s(%d) vs %s(%d)"), *QueryLabel, MatchIndex, *Actual[MatchIndex].Path, Actual[MatchIndex].Score, *Expected[MatchIndex].Path, Expected[MatchIndex].Score));
+				break;
+			}
+		}
+	}
+
+	Index.RemovePath(TEXT("/Game/Art/Zone_0000/Textures"));
+	TArray<FHCIPathSearchMatch> AfterRemoval;
+	Index.Query({TEXT("Zone_0000")}, AfterRemoval);
+	TestFalse(
+		TEXT("Removed paths should drop out of results"),
+		AfterRemoval.ContainsByPredicate([](const FHCIPathSearchMatch& Match) { return Match.Path == TEXT("/Game/Art/Zone_0000/Textures"); }));
+
+	UE_LOG(
+		LogTemp,
+		Display,
+		TEXT("[HCI][PathSearchIndexPerf] directories=%d queries=%d build_ms=%.2f linear_query_ms=%.2f indexed_query_ms=%.2f"),
+		Paths.Num(),
+		Queries.Num(),
+		BuildMs,
+		LinearMs,
+		IndexedMs);
+	return true;
+}
+
+#endif
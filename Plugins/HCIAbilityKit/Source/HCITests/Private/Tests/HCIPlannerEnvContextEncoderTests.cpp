@@ -0,0 +1,160 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Agent/Planner/HCIPlannerEnvContextEncoder.h"
+#include "AssetRegistry/AssetData.h"
+#include "Commands/HCIPlannerEnvContextProvider.h"
+#include "Misc/AutomationTest.h"
+
+namespace
+{
+constexpr int32 HCIEnvEncoderTokenBudget = 1200;
+constexpr int32 HCIEnvEncoderCandidateRows = 400;
+const TCHAR* const HCIEnvEncoderUserText = TEXT("把 /Game/Art 里 lantern 的模型 LOD 检查一下");
+
+// 4 top-level folders x 5 subfolders x 200 assets under /Game/Art, plus one relevant asset whose path sorts after
+// all of them. Candidates are picked by the provider's top-K, exactly as the planner receives them.
+static FHCIAgentPlannerEnvSnapshot HCI_MakeEncoderSnapshot(const FString& UserText)
+{
+	static const TCHAR* const TopFolders[] = {TEXT("Characters"), TEXT("Environment"), TEXT("Props"), TEXT("Vehicles")};
+	const FTopLevelAssetPath MeshClass(TEXT("/Script/Engine"), TEXT("StaticMesh"));
+	const FTopLevelAssetPath TextureClass(TEXT("/Script/Engine"), TEXT("Texture2D"));
+	const FString ScanRoot = TEXT("/Game/Art");
+
+	TArray<FAssetData> Assets;
+	const auto AddAsset = [&Assets](const FString& Folder, const FString& Name, const FTopLevelAssetPath& ClassPath, const int64 SizeBytes)
+	{
+		FAssetDataTagMap Tags;
+		Tags.Add(TEXT("DiskSize"), LexToString(SizeBytes));
+		Assets.Emplace(
+			FName(*FString::Printf(TEXT("%s/%s"), *Folder, *Name)),
+			FName(*Folder),
+			FName(*Name),
+			ClassPath,
+			MoveTemp(Tags));
+	};
+	for (const TCHAR* Top : TopFolders)
+	{
+		for (int32 Sub = 0; Sub < 5; ++Sub)
+		{
+			const FString Folder = FString::Printf(TEXT("%s/%s/Set_%02d"), *ScanRoot, Top, Sub);
+			for (int32 Index = 0; Index < 200; ++Index)
+			{
+				const bool bTexture = Index % 4 == 0;
+				const FString Name = FString::Printf(TEXT("%s_%s_%02d_%03d"), bTexture ? TEXT("T") : TEXT("SM"), Top, Sub, Index);
+				AddAsset(Folder, Name, bTexture ? TextureClass : MeshClass, 1000 + Index);
+			}
+		}
+	}
+	AddAsset(ScanRoot + TEXT("/Vehicles/Lantern"), TEXT("SM_Lantern_Old"), MeshClass, 4096);
+
+	FHCIAgentPlannerEnvSnapshot Snapshot;
+	FHCIPlannerEnvContextProvider::BuildSnapshotFromAssets(
+		ScanRoot,
+		Assets,
+		HCIEnvEncoderCandidateRows,
+		FHCIPlannerEnvRelevanceQuery::Make(UserText, ScanRoot),
+		Snapshot);
+	return Snapshot;
+}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCIPlannerEnvContextEncoderBudgetTest,
+	"HCI.Editor.PlannerEnvContext.EncoderRanksByRelevanceWithinTokenBudget",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCIPlannerEnvContextEncoderBudgetTest::RunTest(const FString& Parameters)
+{
+	const FHCIAgentPlannerEnvSnapshot Snapshot = HCI_MakeEncoderSnapshot(HCIEnvEncoderUserText);
+	const FHCIPlannerEnvContextEncodeResult Encoded =
+		FHCIPlannerEnvContextEncoder::Encode(Snapshot, HCIEnvEncoderUserText, HCIEnvEncoderTokenBudget);
+
+	AddInfo(FString::Printf(
+		TEXT("env_context candidates=%d emitted_assets=%d emitted_folders=%d tokens_flat=%d tokens_encoded=%d budget=%d"),
+		Snapshot.Assets.Num(),
+		Encoded.EmittedAssetCount,
+		Encoded.EmittedFolderCount,
+		Encoded.FlatTokenEstimate,
+		Encoded.TokenEstimate,
+		HCIEnvEncoderTokenBudget));
+	TestEqual(TEXT("Provider keeps the candidate row cap"), Snapshot.Assets.Num(), HCIEnvEncoderCandidateRows);
+	TestTrue(TEXT("Encoded context stays within the token budget"), Encoded.TokenEstimate <= HCIEnvEncoderTokenBudget);
+	TestTrue(TEXT("Flat estimate reported"), Encoded.FlatTokenEstimate > Encoded.TokenEstimate);
+	TestTrue(TEXT("Relevant asset admitted although it sorts last"), Encoded.Text.Contains(TEXT("SM_Lantern_Old[4096]")));
+	TestTrue(TEXT("Relevant folder is expanded first"), Encoded.Text.Find(TEXT("Vehicles/")) < Encoded.Text.Find(TEXT("Characters/")));
+	TestTrue(TEXT("Folder prefixes are emitted once, not per row"), !Encoded.Text.Contains(TEXT("/Game/Art/Characters/Set_00/")));
+	TestTrue(TEXT("Leftover assets are counted"), Encoded.Text.Contains(TEXT("omitted: assets=")));
+	TestTrue(TEXT("Header keeps the class histogram"), Encoded.Text.Contains(TEXT("class_histogram: StaticMesh=3001 Texture2D=1000")));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCIPlannerEnvContextEncoderCompressionTest,
+	"HCI.Editor.PlannerEnvContext.EncoderTrieIsSmallerThanFlatListForSameRows",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCIPlannerEnvContextEncoderCompressionTest::RunTest(const FString& Parameters)
+{
+	const FHCIAgentPlannerEnvSnapshot Snapshot = HCI_MakeEncoderSnapshot(FString());
+	// Budget large enough to admit every candidate, so both encodings carry the same rows.
+	const FHCIPlannerEnvContextEncodeResult Encoded = FHCIPlannerEnvContextEncoder::Encode(Snapshot, FString(), 1000000);
+	const double Ratio = static_cast<double>(Encoded.TokenEstimate) / FMath::Max(1, Encoded.FlatTokenEstimate);
+
+	AddInfo(FString::Printf(
+		TEXT("env_context rows=%d tokens_flat=%d tokens_encoded=%d ratio=%.2f"),
+		Encoded.EmittedAssetCount,
+		Encoded.FlatTokenEstimate,
+		Encoded.TokenEstimate,
+		Ratio));
+	TestEqual(TEXT("Every candidate admitted"), Encoded.EmittedAssetCount, Snapshot.Assets.Num());
+	TestTrue(FString::Printf(TEXT("Trie encoding should be under half the flat list (was %.2f)"), Ratio), Ratio < 0.5);
+
+	FHCIAgentPlannerEnvSnapshot Empty;
+	Empty.ScanRoot = TEXT("/Game/Empty");
+	TestTrue(TEXT("Empty root is stated"), FHCIPlannerEnvContextEncoder::Encode(Empty, FString(), 100).Text.Contains(TEXT("tree: (empty)")));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCIPlannerEnvContextEncoderHeaderBudgetTest,
+	"HCI.Editor.PlannerEnvContext.EncoderChargesHeaderAndFlatEstimateToAdmittedRows",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCIPlannerEnvContextEncoderHeaderBudgetTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 ClassCount = 300;
+	constexpr int32 SmallBudget = 200;
+	FHCIAgentPlannerEnvSnapshot Snapshot;
+	Snapshot.ScanRoot = TEXT("/Game/Plugins");
+	for (int32 Index = 0; Index < ClassCount; ++Index)
+	{
+		FHCIAgentPlannerEnvClassCount& Class = Snapshot.ClassHistogram.AddDefaulted_GetRef();
+		Class.AssetClass = FString::Printf(TEXT("PluginAssetClass%03d"), Index);
+		Class.Count = ClassCount - Index;
+
+		FHCIAgentPlannerEnvAssetEntry& Entry = Snapshot.Assets.AddDefaulted_GetRef();
+		Entry.ObjectPath = FString::Printf(TEXT("/Game/Plugins/Set_%02d/A_%03d.A_%03d"), Index % 10, Index, Index);
+		Entry.AssetClass = Class.AssetClass;
+		Entry.SizeBytes = 1000 + Index;
+		Snapshot.TotalAssetCount += Class.Count;
+	}
+
+	const FHCIPlannerEnvContextEncodeResult Encoded = FHCIPlannerEnvContextEncoder::Encode(Snapshot, FString(), SmallBudget);
+	AddInfo(FString::Printf(
+		TEXT("env_context classes=%d emitted_assets=%d tokens_flat=%d tokens_encoded=%d budget=%d"),
+		ClassCount,
+		Encoded.EmittedAssetCount,
+		Encoded.FlatTokenEstimate,
+		Encoded.TokenEstimate,
+		SmallBudget));
+	TestTrue(TEXT("A wide class histogram still fits the budget"), Encoded.TokenEstimate <= SmallBudget);
+	TestTrue(TEXT("Largest classes are kept"), Encoded.Text.Contains(TEXT("PluginAssetClass000=300")));
+	TestTrue(TEXT("Classes that do not fit are folded into one bucket"), Encoded.Text.Contains(TEXT(" other=")));
+	TestTrue(TEXT("Not every row fits a small budget"), Encoded.EmittedAssetCount < Snapshot.Assets.Num());
+	TestTrue(
+		TEXT("Flat estimate covers only the admitted rows"),
+		Encoded.FlatTokenEstimate < FHCIPlannerEnvContextEncoder::EstimateTokens(FHCIPlannerEnvContextEncoder::SerializeFlat(Snapshot)));
+	return true;
+}
+
+#endif
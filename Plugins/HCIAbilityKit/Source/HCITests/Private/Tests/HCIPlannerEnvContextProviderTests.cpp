@@ -0,0 +1,138 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Commands/HCIPlannerEnvContextProvider.h"
+#include "AssetRegistry/AssetData.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCIPlannerEnvContextTopKTest,
+	"HCI.Editor.PlannerEnvContext.TopKMatchesFullSortWithTotals",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCIPlannerEnvContextTopKTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 AssetCount = 5000;
+	constexpr int32 MaxRows = 40;
+	const FTopLevelAssetPath MeshClass(TEXT("/Script/Engine"), TEXT("StaticMesh"));
+	const FTopLevelAssetPath TextureClass(TEXT("/Script/Engine"), TEXT("Texture2D"));
+
+	TArray<FAssetData> Assets;
+	Assets.Reserve(AssetCount);
+	int64 ExpectedSizeBytes = 0;
+	int32 ExpectedSizedCount = 0;
+	for (int32 Index = 0; Index < AssetCount; ++Index)
+	{
+		// Scrambled insertion order so the registry order is not already sorted.
+		const int32 Key = (Index * 7919) % AssetCount;
+		const FString AssetName = FString::Printf(TEXT("SM_Env_%05d"), Key);
+		FAssetDataTagMap Tags;
+		if (Key % 3 != 0)
+		{
+			Tags.Add(TEXT("DiskSize"), LexToString(Key + 1));
+			ExpectedSizeBytes += Key + 1;
+			++ExpectedSizedCount;
+		}
+		Assets.Emplace(
+			FName(*FString::Printf(TEXT("/Game/Temp/EnvCtx/%s"), *AssetName)),
+			FName(TEXT("/Game/Temp/EnvCtx")),
+			FName(*AssetName),
+			Key % 4 == 0 ? TextureClass : MeshClass,
+			MoveTemp(Tags));
+	}
+
+	FHCIAgentPlannerEnvSnapshot Snapshot;
+	FHCIPlannerEnvContextProvider::BuildSnapshotFromAssets(TEXT("/Game/Temp/EnvCtx"), Assets, MaxRows, FHCIPlannerEnvRelevanceQuery(), Snapshot);
+
+	TestEqual(TEXT("Total count should cover every asset"), Snapshot.TotalAssetCount, AssetCount);
+	TestEqual(TEXT("Only MaxRows assets should be kept"), Snapshot.Assets.Num(), MaxRows);
+	TestEqual(TEXT("Size total should sum every sized asset"), Snapshot.TotalSizeBytes, ExpectedSizeBytes);
+	TestEqual(TEXT("Sized asset count"), Snapshot.SizedAssetCount, ExpectedSizedCount);
+
+	TArray<FString> SortedPaths;
+	for (const FAssetData& AssetData : Assets)
+	{
+		SortedPaths.Add(AssetData.GetObjectPathString());
+	}
+	SortedPaths.Sort();
+	for (int32 Index = 0; Index < Snapshot.Assets.Num(); ++Index)
+	{
+		if (!TestEqual(*FString::Printf(TEXT("Row %d should match the full sort"), Index), Snapshot.Assets[Index].ObjectPath, SortedPaths[Index]))
+		{
+			break;
+		}
+	}
+
+	if (TestEqual(TEXT("Histogram should have two classes"), Snapshot.ClassHistogram.Num(), 2))
+	{
+		TestEqual(TEXT("Largest class first"), Snapshot.ClassHistogram[0].AssetClass, FString(TEXT("StaticMesh")));
+		TestEqual(TEXT("StaticMesh count"), Snapshot.ClassHistogram[0].Count, AssetCount - AssetCount / 4);
+		TestEqual(TEXT("Texture2D count"), Snapshot.ClassHistogram[1].Count, AssetCount / 4);
+	}
+
+	if (TestEqual(TEXT("All assets share one folder"), Snapshot.FolderCounts.Num(), 1))
+	{
+		TestEqual(TEXT("Folder is relative to the scan root"), Snapshot.FolderCounts[0].Folder, FString());
+		TestEqual(TEXT("Folder count covers every asset"), Snapshot.FolderCounts[0].Count, AssetCount);
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCIPlannerEnvContextRelevanceTopKTest,
+	"HCI.Editor.PlannerEnvContext.TopKKeepsRelevantAssetsBeyondThePathCut",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCIPlannerEnvContextRelevanceTopKTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 MaxRows = 10;
+	const FTopLevelAssetPath MeshClass(TEXT("/Script/Engine"), TEXT("StaticMesh"));
+	const FTopLevelAssetPath TextureClass(TEXT("/Script/Engine"), TEXT("Texture2D"));
+
+	TArray<FAssetData> Assets;
+	for (int32 Index = 0; Index < 200; ++Index)
+	{
+		const FString AssetName = FString::Printf(TEXT("T_Env_%03d"), Index);
+		Assets.Emplace(
+			FName(*FString::Printf(TEXT("/Game/Temp/EnvCtx/Base/%s"), *AssetName)),
+			FName(TEXT("/Game/Temp/EnvCtx/Base")),
+			FName(*AssetName),
+			TextureClass,
+			FAssetDataTagMap());
+	}
+	// Both sort after every Base row, so a path-only top-K would drop them.
+	Assets.Emplace(
+		FName(TEXT("/Game/Temp/EnvCtx/Zone/SM_Lantern_Old")),
+		FName(TEXT("/Game/Temp/EnvCtx/Zone")),
+		FName(TEXT("SM_Lantern_Old")),
+		MeshClass,
+		FAssetDataTagMap());
+	Assets.Emplace(
+		FName(TEXT("/Game/Temp/EnvCtx/Lanterns/SM_Post")),
+		FName(TEXT("/Game/Temp/EnvCtx/Lanterns")),
+		FName(TEXT("SM_Post")),
+		MeshClass,
+		FAssetDataTagMap());
+
+	const FString Root = TEXT("/Game/Temp/EnvCtx");
+	FHCIAgentPlannerEnvSnapshot Snapshot;
+	FHCIPlannerEnvContextProvider::BuildSnapshotFromAssets(
+		Root, Assets, MaxRows, FHCIPlannerEnvRelevanceQuery::Make(TEXT("检查 lantern 资产"), Root), Snapshot);
+
+	TArray<FString> KeptPaths;
+	for (const FHCIAgentPlannerEnvAssetEntry& Entry : Snapshot.Assets)
+	{
+		KeptPaths.Add(Entry.ObjectPath);
+	}
+	TestEqual(TEXT("Only MaxRows assets should be kept"), Snapshot.Assets.Num(), MaxRows);
+	TestTrue(TEXT("Asset whose name matches is kept"), KeptPaths.Contains(TEXT("/Game/Temp/EnvCtx/Zone/SM_Lantern_Old.SM_Lantern_Old")));
+	TestTrue(TEXT("Asset whose folder matches is kept"), KeptPaths.Contains(TEXT("/Game/Temp/EnvCtx/Lanterns/SM_Post.SM_Post")));
+	TestTrue(TEXT("Remaining rows are the first by path"), KeptPaths.Contains(TEXT("/Game/Temp/EnvCtx/Base/T_Env_007.T_Env_007")));
+	TestFalse(TEXT("Rows past the remaining budget are dropped"), KeptPaths.Contains(TEXT("/Game/Temp/EnvCtx/Base/T_Env_008.T_Env_008")));
+
+	TArray<FString> SortedPaths = KeptPaths;
+	SortedPaths.Sort();
+	TestTrue(TEXT("Kept rows are emitted in path order"), SortedPaths == KeptPaths);
+	return true;
+}
+
+#endif
@@ -0,0 +1,147 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Audit/HCIPreviewActor.h"
+#include "Audit/HCIPreviewRegistrySubsystem.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "HCIAsset.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCIPreviewRegistryDependentsTest,
+	"HCI.Editor.PreviewRegistry.TracksDependentsPerAsset",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCIPreviewRegistryDependentsTest::RunTest(const FString& Parameters)
+{
+	UHCIPreviewRegistrySubsystem* Registry = UHCIPreviewRegistrySubsystem::Get();
+	if (!TestNotNull(TEXT("Preview registry subsystem should exist"), Registry))
+	{
+		return false;
+	}
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Editor, false, TEXT("HCIPreviewRegistryTestWorld"));
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Editor);
+	WorldContext.SetCurrentWorld(World);
+
+	UHCIAsset* AssetA = NewObject<UHCIAsset>(GetTransientPackage(), NAME_None, RF_Transient);
+	UHCIAsset* AssetB = NewObject<UHCIAsset>(GetTransientPackage(), NAME_None, RF_Transient);
+	const int32 BaselineRegistered = Registry->GetRegisteredActorCount();
+
+	constexpr int32 ActorCount = 64;
+	TArray<AHCIPreviewActor*> Actors;
+	for (int32 Index = 0; Index < ActorCount; ++Index)
+	{
+		AHCIPreviewActor* Actor = World->SpawnActorDeferred<AHCIPreviewActor>(AHCIPreviewActor::StaticClass(), FTransform::Identity);
+		Actor->AbilityAsset = (Index % 4 == 0) ? AssetB : AssetA;
+		Actor->FinishSpawning(FTransform(FVector(Index * 100.0, 0.0, 0.0)));
+		Actors.Add(Actor);
+	}
+
+	TestEqual(TEXT("Every preview actor should register once"), Registry->GetRegisteredActorCount(), BaselineRegistered + ActorCount);
+	TestEqual(TEXT("AssetA dependents"), Registry->GetDependentActorCount(AssetA), ActorCount - ActorCount / 4);
+	TestEqual(TEXT("AssetB dependents"), Registry->GetDependentActorCount(AssetB), ActorCount / 4);
+	TestEqual(TEXT("Refresh by asset only queues its dependents"), Registry->RequestRefreshForAsset(AssetB), ActorCount / 4);
+	Registry->FlushPendingRefreshes();
+
+	// Re-pointing an actor moves it between dependency lists.
+	Actors[1]->AbilityAsset = AssetB;
+	Actors[1]->RefreshPreview();
+	TestEqual(TEXT("AssetB gains the re-pointed actor"), Registry->GetDependentActorCount(AssetB), ActorCount / 4 + 1);
+	TestEqual(TEXT("AssetA loses the re-pointed actor"), Registry->GetDependentActorCount(AssetA), ActorCount - ActorCount / 4 - 1);
+
+	World->DestroyActor(Actors[0]);
+	TestEqual(TEXT("Destroyed actors should unregister"), Registry->GetRegisteredActorCount(), BaselineRegistered + ActorCount - 1);
+
+	Registry->FlushPendingRefreshes();
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+	TestEqual(TEXT("World cleanup should drop its actors"), Registry->GetDependentActorCount(AssetA), 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCIPreviewRegistryInstancedWorldTest,
+	"HCI.Editor.PreviewRegistry.InstancedWorldDrawsThroughHostAndCleansUp",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCIPreviewRegistryInstancedWorldTest::RunTest(const FString& Parameters)
+{
+	UHCIPreviewRegistrySubsystem* Registry = UHCIPreviewRegistrySubsystem::Get();
+	IConsoleVariable* ThresholdCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("HCI.Preview.InstancedThreshold"));
+	UStaticMesh* Cube = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+	if (!TestNotNull(TEXT("Preview registry subsystem should exist"), Registry)
+		|| !TestNotNull(TEXT("Instanced threshold cvar registered"), ThresholdCVar)
+		|| !TestNotNull(TEXT("Engine cube loads"), Cube))
+	{
+		return false;
+	}
+
+	constexpr int32 ActorCount = 8;
+	const int32 PreviousThreshold = ThresholdCVar->GetInt();
+	ThresholdCVar->Set(ActorCount / 2, ECVF_SetByCode);
+
+	UHCIAsset* Asset = NewObject<UHCIAsset>(GetTransientPackage(), NAME_None, RF_Transient);
+	Asset->RepresentingMesh = Cube;
+	const int32 BaselineRegistered = Registry->GetRegisteredActorCount();
+
+	// Game worlds are not tracked: the actor draws its own mesh and never reaches the registry.
+	UWorld* GameWorld = UWorld::CreateWorld(EWorldType::GamePreview, false, TEXT("HCIPreviewRegistryGameWorld"));
+	AHCIPreviewActor* GameActor = GameWorld->SpawnActorDeferred<AHCIPreviewActor>(AHCIPreviewActor::StaticClass(), FTransform::Identity);
+	GameActor->AbilityAsset = Asset;
+	GameActor->FinishSpawning(FTransform::Identity);
+	TestEqual(TEXT("Game world actor is not registered"), Registry->GetRegisteredActorCount(), BaselineRegistered);
+	TestTrue(TEXT("Game world actor applies its mesh directly"), GameActor->PreviewMeshComponent->GetStaticMesh() == Cube);
+	GameWorld->DestroyWorld(false);
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Editor, false, TEXT("HCIPreviewRegistryInstancedWorld"));
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Editor);
+	WorldContext.SetCurrentWorld(World);
+
+	TArray<AHCIPreviewActor*> Actors;
+	for (int32 Index = 0; Index < ActorCount; ++Index)
+	{
+		AHCIPreviewActor* Actor = World->SpawnActorDeferred<AHCIPreviewActor>(AHCIPreviewActor::StaticClass(), FTransform::Identity);
+		Actor->AbilityAsset = Asset;
+		Actor->FinishSpawning(FTransform(FVector(Index * 100.0, 0.0, 0.0)));
+		Actors.Add(Actor);
+	}
+	Registry->FlushPendingRefreshes();
+
+	TestTrue(TEXT("World reaching the threshold is instanced"), Registry->IsWorldInstanced(World));
+	const TWeakObjectPtr<AActor> Host = Registry->GetWorldInstanceHost(World);
+	if (TestTrue(TEXT("Instanced world has a host actor"), Host.IsValid()))
+	{
+		const UInstancedStaticMeshComponent* Ism = Host->FindComponentByClass<UInstancedStaticMeshComponent>();
+		TestTrue(TEXT("One instance per preview actor"), Ism != nullptr && Ism->GetInstanceCount() == ActorCount);
+	}
+	TestFalse(TEXT("Per-actor component hidden while instanced"), Actors[0]->PreviewMeshComponent->IsVisible());
+	TestTrue(TEXT("Per-actor component keeps its mesh"), Actors[0]->PreviewMeshComponent->GetStaticMesh() == Cube);
+
+	// Deleting several actors queues one rebuild for the next flush instead of one per actor.
+	World->DestroyActor(Actors[ActorCount - 1]);
+	World->DestroyActor(Actors[ActorCount - 2]);
+	if (Host.IsValid())
+	{
+		const UInstancedStaticMeshComponent* Ism = Host->FindComponentByClass<UInstancedStaticMeshComponent>();
+		TestTrue(TEXT("Unregister defers the instance rebuild"), Ism != nullptr && Ism->GetInstanceCount() == ActorCount);
+		Registry->FlushPendingRefreshes();
+		TestTrue(TEXT("Flush rebuilds without the removed actors"), Ism != nullptr && Ism->GetInstanceCount() == ActorCount - 2);
+	}
+	TestTrue(TEXT("World above the threshold stays instanced"), Registry->IsWorldInstanced(World));
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+	TestFalse(TEXT("World cleanup drops the instancing state"), Registry->IsWorldInstanced(World));
+	TestFalse(TEXT("World cleanup destroys the host actor"), Host.IsValid());
+	TestEqual(TEXT("World cleanup drops its actors"), Registry->GetDependentActorCount(Asset), 0);
+
+	ThresholdCVar->Set(PreviousThreshold, ECVF_SetByCode);
+	return true;
+}
+
+#endif
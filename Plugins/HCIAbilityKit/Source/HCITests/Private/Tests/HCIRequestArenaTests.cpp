@@ -0,0 +1,122 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Common/HCIRequestArena.h"
+
+#include "Agent/Executor/HCIAgentExecutor.h"
+#include "Agent/Planner/HCIAgentPlan.h"
+#include "Agent/Planner/HCIAgentPlanner.h"
+#include "Agent/Tools/HCIToolRegistry.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCIRequestArenaStatsAndPromotionTest,
+	"HCI.Editor.RequestArena.NestedScopesRollUpAndPromotedDataOutlivesScope",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCIRequestArenaStatsAndPromotionTest::RunTest(const FString& Parameters)
+{
+	FHCIRequestArena::Reset();
+	const FString RequestId = TEXT("req_arena_test");
+
+	TArray<FString> Promoted;
+	{
+		HCI_REQUEST_ARENA_SCOPE(RequestId);
+		TestTrue(TEXT("Scope is active"), FHCIRequestArenaScope::IsActive());
+
+		THCIArenaArray<FString> Names;
+		Names.Add(TEXT("/Game/Art/SM_A"));
+		Names.Add(TEXT("/Game/Art/SM_B"));
+		{
+			HCI_REQUEST_ARENA_SCOPE(TEXT("ignored_inner_id"));
+			THCIArenaSet<FString> Seen;
+			for (const FString& Name : Names)
+			{
+				Seen.Add(Name);
+			}
+			TestEqual(TEXT("Arena set works"), Seen.Num(), 2);
+		}
+		Promoted = FHCIRequestArena::Promote(Names);
+	}
+
+	TestFalse(TEXT("Scope closed"), FHCIRequestArenaScope::IsActive());
+	TestEqual(TEXT("Promoted copy survives the scope"), Promoted.Num(), 2);
+	TestEqual(TEXT("Promoted content"), Promoted[1], FString(TEXT("/Game/Art/SM_B")));
+
+	FHCIRequestArenaStats Stats;
+	TestTrue(TEXT("Stats recorded for the request"), FHCIRequestArena::GetRequestStats(RequestId, Stats));
+	TestEqual(TEXT("Nested scope rolls into the outermost"), Stats.ScopeCount, 1);
+	TestTrue(TEXT("Allocations counted"), Stats.AllocationCount >= 2);
+	TestTrue(TEXT("Peak bytes sampled"), Stats.PeakBytes > 0);
+	TestFalse(TEXT("Inner id does not open a record"), FHCIRequestArena::GetRequestStats(TEXT("ignored_inner_id"), Stats));
+
+	{
+		HCI_REQUEST_ARENA_SCOPE(RequestId);
+		THCIArenaArray<int32> Values;
+		Values.Add(1);
+	}
+	FHCIRequestArena::GetRequestStats(RequestId, Stats);
+	TestEqual(TEXT("Same request accumulates"), Stats.ScopeCount, 2);
+
+	{
+		HCI_REQUEST_ARENA_SCOPE(TEXT("req_arena_next"));
+	}
+	TestTrue(TEXT("Another request keeps this record"), FHCIRequestArena::GetRequestStats(RequestId, Stats));
+	TestEqual(TEXT("Another request does not add to this record"), Stats.ScopeCount, 2);
+
+	for (int32 Index = 0; Index < FHCIRequestArena::MaxTrackedRequests; ++Index)
+	{
+		HCI_REQUEST_ARENA_SCOPE(FString::Printf(TEXT("req_arena_fill_%d"), Index));
+	}
+	TestFalse(TEXT("Oldest request is evicted past the cap"), FHCIRequestArena::GetRequestStats(RequestId, Stats));
+	TestFalse(TEXT("Every pre-fill request is evicted"), FHCIRequestArena::GetRequestStats(TEXT("req_arena_next"), Stats));
+	TestTrue(TEXT("Oldest surviving request is kept"), FHCIRequestArena::GetRequestStats(TEXT("req_arena_fill_0"), Stats));
+	TestTrue(
+		TEXT("Newest request is kept"),
+		FHCIRequestArena::GetRequestStats(FString::Printf(TEXT("req_arena_fill_%d"), FHCIRequestArena::MaxTrackedRequests - 1), Stats));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCIRequestArenaInterleavedRequestsTest,
+	"HCI.Editor.RequestArena.InterleavedPlannerAndExecutorRequestsKeepSeparateStats",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCIRequestArenaInterleavedRequestsTest::RunTest(const FString& Parameters)
+{
+	FHCIRequestArena::Reset();
+	FHCIToolRegistry& Registry = FHCIToolRegistry::Get();
+	Registry.ResetToDefaults();
+
+	const FString FirstRequestId = TEXT("req_arena_interleave_a");
+	const FString SecondRequestId = TEXT("req_arena_interleave_b");
+	FHCIAgentPlan FirstPlan;
+	FHCIAgentPlan SecondPlan;
+	FString RouteReason;
+	FString Error;
+	TestTrue(
+		TEXT("First plan built"),
+		FHCIAgentPlanner::BuildPlanFromNaturalLanguage(TEXT("检查贴图分辨率并处理LOD"), FirstRequestId, Registry, FirstPlan, RouteReason, Error));
+	FHCIRequestArenaStats AfterPlanning;
+	TestTrue(TEXT("Planner records the first request"), FHCIRequestArena::GetRequestStats(FirstRequestId, AfterPlanning));
+
+	// A second request plans while the first one waits for confirmation.
+	TestTrue(
+		TEXT("Second plan built"),
+		FHCIAgentPlanner::BuildPlanFromNaturalLanguage(TEXT("检查贴图分辨率并处理LOD"), SecondRequestId, Registry, SecondPlan, RouteReason, Error));
+
+	FHCIAgentExecutorRunResult RunResult;
+	TestTrue(TEXT("First plan executes"), FHCIAgentExecutor::ExecutePlan(FirstPlan, Registry, RunResult));
+
+	FHCIRequestArenaStats FirstStats;
+	FHCIRequestArenaStats SecondStats;
+	TestTrue(TEXT("First request still tracked"), FHCIRequestArena::GetRequestStats(FirstRequestId, FirstStats));
+	TestTrue(TEXT("Second request still tracked"), FHCIRequestArena::GetRequestStats(SecondRequestId, SecondStats));
+	TestTrue(TEXT("Validation and execution add to the planner record"), FirstStats.ScopeCount > AfterPlanning.ScopeCount);
+	TestTrue(TEXT("Validator seen-sets use the arena"), FirstStats.AllocationCount > AfterPlanning.AllocationCount);
+	TestEqual(TEXT("Second request only saw its planner scope"), SecondStats.ScopeCount, 1);
+	TestEqual(TEXT("Run result reports the whole request"), RunResult.TransientArenaAllocations, FirstStats.AllocationCount);
+	TestEqual(TEXT("Run result peak"), RunResult.TransientArenaPeakBytes, FirstStats.PeakBytes);
+	return true;
+}
+
+#endif
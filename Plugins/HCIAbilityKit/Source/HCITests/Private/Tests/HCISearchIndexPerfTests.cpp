@@ -5,6 +5,27 @@
 #include "Search/HCISearchIndexService.h"
 #include "UObject/Package.h"
 
+namespace
+{
+constexpr int32 HCISearchPerfDocCount = 50000;
+
+// Upper bounds are deliberately loose for shared CI machines; a per-ID linear bucket scan at 50k docs
+// lands well above them, which is the regression these guard against.
+constexpr double HCISearchPerfMaxAddMs = 30000.0;
+constexpr double HCISearchPerfMaxRefreshMs = 30000.0;
+constexpr double HCISearchPerfMaxRemoveMs = 10000.0;
+constexpr double HCISearchPerfMaxIndexRemoveMs = 3000.0;
+
+FHCIAbilitySearchDocument MakePerfDocument(const int32 Index)
+{
+	FHCIParsedData ParsedData;
+	ParsedData.Id = FString::Printf(TEXT("perf_doc_%d"), Index);
+	ParsedData.DisplayName = FString::Printf(TEXT("Perf %s Skill %d"), (Index % 2) == 0 ? TEXT("Fire") : TEXT("Frost"), Index);
+	ParsedData.Damage = 50.0f + static_cast<float>(Index % 400);
+	return FHCIAbilitySearchSchema::BuildDocument(ParsedData, FString::Printf(TEXT("/Game/Perf/%s"), *ParsedData.Id));
+}
+} // namespace
+
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(
 	FHCISearchIndexPerfTest,
 	"HCI.Editor.SearchIndex.Performance",
@@ -13,13 +34,11 @@ IMPLEMENT_SIMPLE_AUTOMATION_TEST(
 bool FHCISearchIndexPerfTest::RunTest(const FString& Parameters)
 {
 	FHCISearchIndexService& Service = FHCISearchIndexService::Get();
+	const int32 BaselineCount = Service.GetStats().IndexedDocumentCount;
 
-	// Prepare test data
-	const int32 AssetCount = 1000;
 	TArray<UHCIAsset*> Assets;
-	Assets.Reserve(AssetCount);
-
-	for (int32 i = 0; i < AssetCount; ++i)
+	Assets.Reserve(HCISearchPerfDocCount);
+	for (int32 i = 0; i < HCISearchPerfDocCount; ++i)
 	{
 		const FString AssetName = FString::Printf(TEXT("TestAsset_%d"), i);
 		UHCIAsset* Asset = NewObject<UHCIAsset>(GetTransientPackage(), FName(*AssetName), RF_Transient);
@@ -29,47 +48,127 @@ bool FHCISearchIndexPerfTest::RunTest(const FString& Parameters)
 		Assets.Add(Asset);
 	}
 
-	// Benchmark Add/Refresh
 	const double StartTimeAdd = FPlatformTime::Seconds();
 	for (UHCIAsset* Asset : Assets)
 	{
 		Service.RefreshAsset(Asset);
 	}
 	const double DurationAdd = (FPlatformTime::Seconds() - StartTimeAdd) * 1000.0;
+	TestEqual(TEXT("IndexedDocumentCount should grow by the asset count"), Service.GetStats().IndexedDocumentCount, BaselineCount + HCISearchPerfDocCount);
+	TestTrue(FString::Printf(TEXT("Add of %d assets should stay under %.0f ms (took %.2f ms)"), HCISearchPerfDocCount, HCISearchPerfMaxAddMs, DurationAdd), DurationAdd <= HCISearchPerfMaxAddMs);
 
-	// Verify Stats
-	const FHCIAbilitySearchIndexStats& StatsAfterAdd = Service.GetStats();
-	// Note: Existing assets in the index might affect the count if not cleared.
-	// But since we use transient assets with unique names, they are added.
-	// Ideally we should reset service first, but Reset() is private.
-	// Assuming test environment is clean or we are testing incremental updates.
-	// We can check if count increased by AssetCount.
-	// But let's assume we want exact count for this test run.
-	// Since we can't reset, let's just log and check logic.
-	// Actually, we can check relative increase if needed, but TestEqual expects exact.
-	// Given we can't easily reset, let's just ensure it's AT LEAST AssetCount.
-	TestTrue(TEXT("IndexedDocumentCount should be >= AssetCount"), StatsAfterAdd.IndexedDocumentCount >= AssetCount);
-
-	UE_LOG(LogTemp, Display, TEXT("Search Index Add Performance: %d assets took %.2f ms"), AssetCount, DurationAdd);
-
-	// Benchmark Remove
-	const double StartTimeRemove = FPlatformTime::Seconds();
+	// Refresh replaces every document in place (remove + add on a full index).
+	for (int32 i = 0; i < Assets.Num(); ++i)
+	{
+		Assets[i]->Damage = 400.0f + i;
+	}
+	const double StartTimeRefresh = FPlatformTime::Seconds();
 	for (UHCIAsset* Asset : Assets)
 	{
-		Service.RemoveAssetByPath(Asset->GetPathName());
+		Service.RefreshAsset(Asset);
+	}
+	const double DurationRefresh = (FPlatformTime::Seconds() - StartTimeRefresh) * 1000.0;
+	TestEqual(TEXT("Refresh should not change the document count"), Service.GetStats().IndexedDocumentCount, BaselineCount + HCISearchPerfDocCount);
+	TestTrue(FString::Printf(TEXT("Refresh of %d assets should stay under %.0f ms (took %.2f ms)"), HCISearchPerfDocCount, HCISearchPerfMaxRefreshMs, DurationRefresh), DurationRefresh <= HCISearchPerfMaxRefreshMs);
+
+	// Remove half one by one and half through the bulk path.
+	const int32 HalfCount = HCISearchPerfDocCount / 2;
+	TArray<FString> BulkPaths;
+	BulkPaths.Reserve(HCISearchPerfDocCount - HalfCount);
+	const double StartTimeRemove = FPlatformTime::Seconds();
+	for (int32 i = 0; i < Assets.Num(); ++i)
+	{
+		if (i < HalfCount)
+		{
+			Service.RemoveAssetByPath(Assets[i]->GetPathName());
+		}
+		else
+		{
+			BulkPaths.Add(Assets[i]->GetPathName());
+		}
 	}
+	const int32 BulkRemoved = Service.RemoveAssetsByPaths(BulkPaths);
 	const double DurationRemove = (FPlatformTime::Seconds() - StartTimeRemove) * 1000.0;
+	TestEqual(TEXT("Bulk removal should remove every remaining asset"), BulkRemoved, BulkPaths.Num());
+	TestEqual(TEXT("IndexedDocumentCount should return to baseline"), Service.GetStats().IndexedDocumentCount, BaselineCount);
+	TestTrue(FString::Printf(TEXT("Remove of %d assets should stay under %.0f ms (took %.2f ms)"), HCISearchPerfDocCount, HCISearchPerfMaxRemoveMs, DurationRemove), DurationRemove <= HCISearchPerfMaxRemoveMs);
+
+	UE_LOG(
+		LogTemp,
+		Display,
+		TEXT("[HCI][SearchIndexPerf] docs=%d add_ms=%.2f refresh_ms=%.2f remove_ms=%.2f"),
+		HCISearchPerfDocCount,
+		DurationAdd,
+		DurationRefresh,
+		DurationRemove);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCISearchIndexPostingRemovalTest,
+	"HCI.Editor.SearchIndex.PostingRemovalIsConstantTime",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCISearchIndexPostingRemovalTest::RunTest(const FString& Parameters)
+{
+	TArray<FHCIAbilitySearchDocument> Documents;
+	Documents.Reserve(HCISearchPerfDocCount);
+	for (int32 i = 0; i < HCISearchPerfDocCount; ++i)
+	{
+		Documents.Add(MakePerfDocument(i));
+	}
+
+	FHCIAbilitySearchIndex Index;
+	Index.ReserveForDocuments(Documents);
+	for (const FHCIAbilitySearchDocument& Document : Documents)
+	{
+		Index.AddDocument(Document);
+	}
+	TestEqual(TEXT("All documents should be indexed"), Index.GetDocumentCount(), HCISearchPerfDocCount);
+
+	const FHCIAbilitySearchPostingList* FirePostings = Index.FindTokenPostings(TEXT("fire"));
+	TestNotNull(TEXT("fire token should be interned"), FirePostings);
+	if (FirePostings)
+	{
+		TestEqual(TEXT("Half the documents should carry the fire token"), FirePostings->Num(), HCISearchPerfDocCount / 2);
+	}
+
+	// Remove every odd document one at a time; swap-remove must keep positions consistent.
+	const double StartTime = FPlatformTime::Seconds();
+	for (int32 i = 1; i < HCISearchPerfDocCount; i += 2)
+	{
+		Index.RemoveDocumentById(Documents[i].Id);
+	}
+	const double DurationMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	TestTrue(FString::Printf(TEXT("Index-level removal should stay under %.0f ms (took %.2f ms)"), HCISearchPerfMaxIndexRemoveMs, DurationMs), DurationMs <= HCISearchPerfMaxIndexRemoveMs);
 
-	// Verify Stats
-	const FHCIAbilitySearchIndexStats& StatsAfterRemove = Service.GetStats();
-	// After removal, count should decrease by AssetCount.
-	// We can't guarantee 0 if other tests ran.
-	// But we can check if it's consistent.
+	for (const TPair<EHCIAbilityUsageScene, FHCIAbilitySearchPostingList>& Pair : Index.IdsByUsageScene)
+	{
+		const FHCIAbilitySearchPostingList& Postings = Pair.Value;
+		TestEqual(TEXT("Position map should mirror the ID array"), Postings.PositionById.Num(), Postings.Ids.Num());
+		for (int32 Position = 0; Position < Postings.Ids.Num(); ++Position)
+		{
+			const int32* Recorded = Postings.PositionById.Find(Postings.Ids[Position]);
+			if (!Recorded || *Recorded != Position)
+			{
+				AddError(FString::Printf(TEXT("Stale posting position for %s"), *Postings.Ids[Position]));
+				break;
+			}
+		}
+	}
 
-	UE_LOG(LogTemp, Display, TEXT("Search Index Remove Performance: %d assets took %.2f ms"), AssetCount, DurationRemove);
+	if (const FHCIAbilitySearchPostingList* FrostPostings = Index.FindTokenPostings(TEXT("frost")))
+	{
+		TestEqual(TEXT("Odd (frost) documents should all be gone"), FrostPostings->Num(), 0);
+	}
 
+	TArray<FString> RemainingIds;
+	Index.DocumentsById.GetKeys(RemainingIds);
+	TestEqual(TEXT("Bulk removal should drop every remaining document"), Index.RemoveDocumentsByIds(RemainingIds), HCISearchPerfDocCount / 2);
+	TestEqual(TEXT("Index should be empty"), Index.GetDocumentCount(), 0);
+	TestEqual(TEXT("Element buckets should be empty after bulk removal"), Index.IdsByElement.Num(), 0);
 	return true;
 }
 
 #endif
-
@@ -0,0 +1,120 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Async/Async.h"
+#include "Common/HCITrace.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCIStageLatencyRecorderWindowTest,
+	"HCI.Editor.Trace.StageLatencyRecorderSummarizesLastRequests",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCIStageLatencyRecorderWindowTest::RunTest(const FString& Parameters)
+{
+	FHCIStageLatencyRecorder Recorder;
+	const FName PlanStage(TEXT("HCI.Test.Plan"));
+	const FName ExecuteStage(TEXT("HCI.Test.Execute"));
+
+	for (int32 RequestIndex = 0; RequestIndex < 10; ++RequestIndex)
+	{
+		Recorder.EnterRequest(FString::Printf(TEXT("req_%d"), RequestIndex));
+		Recorder.Record(PlanStage, 2.0 * (RequestIndex + 1));
+		// Same request id again (plan -> execute) stays in the same serial.
+		Recorder.EnterRequest(FString::Printf(TEXT("req_%d"), RequestIndex));
+		Recorder.Record(ExecuteStage, 0.05);
+	}
+	TestEqual(TEXT("one serial per request id"), Recorder.GetCurrentRequestSerial(), static_cast<uint64>(10));
+
+	TArray<FHCIStageLatencySummary> Summaries;
+	Recorder.Summarize(4, Summaries);
+	TestEqual(TEXT("two stages"), Summaries.Num(), 2);
+	if (Summaries.Num() != 2)
+	{
+		return false;
+	}
+
+	const FHCIStageLatencySummary& Plan = Summaries[0];
+	TestEqual(TEXT("sorted by total"), Plan.Stage, PlanStage.ToString());
+	TestEqual(TEXT("last 4 requests only"), Plan.SampleCount, 4);
+	TestEqual(TEXT("p50"), Plan.P50Ms, 16.0);
+	TestEqual(TEXT("max"), Plan.MaxMs, 20.0);
+	TestEqual(TEXT("bucket slots"), Plan.BucketCounts.Num(), FHCIStageLatencyRecorder::GetBucketUpperBoundsMs().Num() + 1);
+
+	const FHCIStageLatencySummary& Execute = Summaries[1];
+	TestEqual(TEXT("fast samples land in first bucket"), Execute.BucketCounts[0], 4);
+
+	Recorder.Reset();
+	Recorder.Summarize(4, Summaries);
+	TestEqual(TEXT("reset clears samples"), Summaries.Num(), 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCITraceRequestScopeRestoreTest,
+	"HCI.Editor.Trace.RequestScopeRestoresEnclosingSerial",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCITraceRequestScopeRestoreTest::RunTest(const FString& Parameters)
+{
+	FHCIStageLatencyRecorder& Recorder = FHCIStageLatencyRecorder::Get();
+	Recorder.Reset();
+	const FName Stage(TEXT("HCI.Test.Scoped"));
+
+	{
+		HCI_TRACE_REQUEST_SCOPE(FString(TEXT("req_outer")));
+		TestEqual(TEXT("outer scope opens serial 1"), Recorder.GetCurrentRequestSerial(), static_cast<uint64>(1));
+		{
+			HCI_TRACE_REQUEST_SCOPE(FString(TEXT("req_inner")));
+			TestEqual(TEXT("inner scope opens serial 2"), Recorder.GetCurrentRequestSerial(), static_cast<uint64>(2));
+		}
+		TestEqual(TEXT("outer serial restored"), Recorder.GetCurrentRequestSerial(), static_cast<uint64>(1));
+	}
+	TestEqual(TEXT("outside any scope"), Recorder.GetCurrentRequestSerial(), static_cast<uint64>(0));
+	TestEqual(TEXT("latest serial kept"), Recorder.GetLatestRequestSerial(), static_cast<uint64>(2));
+
+	// Plan then execute under the same id, in separate scopes, still share one serial.
+	{
+		HCI_TRACE_REQUEST_SCOPE(FString(TEXT("req_inner")));
+		TestEqual(TEXT("latest id reuses its serial"), Recorder.GetCurrentRequestSerial(), static_cast<uint64>(2));
+	}
+
+	// A stage recorded after every scope closed lands in serial 0 and gets its own row.
+	Recorder.Record(Stage, 3.0);
+	TArray<FHCIStageLatencySummary> Summaries;
+	Recorder.Summarize(2, Summaries);
+	TestEqual(TEXT("unscoped sample is still summarized"), Summaries.Num(), 1);
+	if (Summaries.Num() == 1)
+	{
+		TestTrue(TEXT("unscoped sample is not attributed to the last request"), Summaries[0].bUnscoped);
+		TestEqual(TEXT("unscoped sample count"), Summaries[0].SampleCount, 1);
+	}
+
+	// Work fanned out to another thread does not inherit the game thread's open request.
+	{
+		HCI_TRACE_REQUEST_SCOPE(FString(TEXT("req_parallel")));
+		const uint64 RequestSerial = Recorder.GetCurrentRequestSerial();
+		uint64 WorkerSerial = RequestSerial;
+		Async(EAsyncExecution::Thread, [&Recorder, &WorkerSerial, Stage]()
+		{
+			WorkerSerial = Recorder.GetCurrentRequestSerial();
+			Recorder.Record(Stage, 4.0);
+		}).Wait();
+		TestEqual(TEXT("worker thread sees no request"), WorkerSerial, static_cast<uint64>(0));
+		Recorder.Record(Stage, 5.0);
+		TestEqual(TEXT("game thread request unchanged"), Recorder.GetCurrentRequestSerial(), RequestSerial);
+	}
+	Recorder.Summarize(1, Summaries);
+	for (const FHCIStageLatencySummary& Summary : Summaries)
+	{
+		TestEqual(
+			Summary.bUnscoped ? TEXT("worker sample lands in the unscoped row") : TEXT("only the game thread sample is in the request row"),
+			Summary.SampleCount,
+			Summary.bUnscoped ? 2 : 1);
+	}
+	TestEqual(TEXT("request and unscoped rows"), Summaries.Num(), 2);
+
+	Recorder.Reset();
+	return true;
+}
+
+#endif
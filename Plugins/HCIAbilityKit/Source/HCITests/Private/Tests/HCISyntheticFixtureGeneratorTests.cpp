@@ -0,0 +1,64 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Commands/HCISyntheticFixtureGenerator.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHCISyntheticFixtureDatasetTest,
+	"HCI.Editor.SyntheticFixture.DatasetIsReproducible",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHCISyntheticFixtureDatasetTest::RunTest(const FString& Parameters)
+{
+	int32 PresetCount = 0;
+	TestTrue(TEXT("10k preset should parse"), FHCISyntheticFixtureGenerator::TryParseCountPreset(TEXT("10k"), PresetCount));
+	TestEqual(TEXT("10k preset value"), PresetCount, 10000);
+
+	FHCISyntheticFixtureOptions Options;
+	Options.Count = 1000;
+	Options.Seed = 7;
+	Options.RepresentingMeshPool = {TEXT("/Game/Seed/SM_A.SM_A"), TEXT("/Game/Seed/SM_B.SM_B")};
+
+	TArray<FHCISyntheticAssetRecord> First;
+	TArray<FHCISyntheticAssetRecord> Second;
+	FString Error;
+	TestTrue(TEXT("Dataset should build"), FHCISyntheticFixtureGenerator::BuildDataset(Options, First, Error));
+	TestTrue(TEXT("Dataset should rebuild"), FHCISyntheticFixtureGenerator::BuildDataset(Options, Second, Error));
+	TestEqual(TEXT("Record count"), First.Num(), Options.Count);
+	TestEqual(
+		TEXT("Same count and seed should produce the same dataset"),
+		FHCISyntheticFixtureGenerator::ComputeDatasetDigest(First),
+		FHCISyntheticFixtureGenerator::ComputeDatasetDigest(Second));
+
+	int32 GapCount = 0;
+	int32 TrapCount = 0;
+	int32 PerfTrapCount = 0;
+	TSet<FString> Ids;
+	for (const FHCISyntheticAssetRecord& Record : First)
+	{
+		GapCount += Record.Tags.Contains(TEXT("semantic_gap")) ? 1 : 0;
+		TrapCount += Record.Tags.Contains(TEXT("trap")) ? 1 : 0;
+		PerfTrapCount += Record.Tags.Contains(TEXT("trap:performance")) ? 1 : 0;
+		Ids.Add(Record.Id);
+		if (Record.RepresentingMesh.IsEmpty() || !Record.VirtualPath.StartsWith(TEXT("/Game/Art/")))
+		{
+			AddError(FString::Printf(TEXT("Incomplete record id=%s"), *Record.Id));
+			break;
+		}
+	}
+	TestEqual(TEXT("Ids should be unique"), Ids.Num(), First.Num());
+	TestEqual(TEXT("Semantic gap count follows the ratio"), GapCount, 300);
+	TestEqual(TEXT("Trap count follows the ratio"), TrapCount, 120);
+	TestEqual(TEXT("Half of the traps are performance traps"), PerfTrapCount, 60);
+
+	Options.Seed = 8;
+	TArray<FHCISyntheticAssetRecord> OtherSeed;
+	FHCISyntheticFixtureGenerator::BuildDataset(Options, OtherSeed, Error);
+	TestNotEqual(
+		TEXT("A different seed should produce a different dataset"),
+		FHCISyntheticFixtureGenerator::ComputeDatasetDigest(OtherSeed),
+		FHCISyntheticFixtureGenerator::ComputeDatasetDigest(First));
+	return true;
+}
+
+#endif
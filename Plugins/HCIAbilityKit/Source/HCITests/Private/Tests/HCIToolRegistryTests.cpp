@@ -167,6 +167,27 @@ bool FHCIToolRegistryArgsSchemaFrozenTest::RunTest(const FString& Parameters)
 		TestEqual(TEXT("actor_names max length"), ActorNamesArg->MaxArrayLength, 50);
 	}
 
+	const FHCIToolArgSchema* PartitionModeArg = FindArg(*LevelRiskTool, TEXT("partition_mode"));
+	const FHCIToolArgSchema* BatchSizeArg = FindArg(*LevelRiskTool, TEXT("wp_batch_size"));
+	const FHCIToolArgSchema* MemoryCeilingArg = FindArg(*LevelRiskTool, TEXT("memory_ceiling_mb"));
+	TestNotNull(TEXT("ScanLevelMeshRisks.partition_mode should exist"), PartitionModeArg);
+	TestNotNull(TEXT("ScanLevelMeshRisks.wp_batch_size should exist"), BatchSizeArg);
+	TestNotNull(TEXT("ScanLevelMeshRisks.memory_ceiling_mb should exist"), MemoryCeilingArg);
+	if (PartitionModeArg)
+	{
+		TestFalse(TEXT("partition_mode should be optional"), PartitionModeArg->bRequired);
+		TestEqual(TEXT("partition_mode enum count"), PartitionModeArg->AllowedStringValues.Num(), 2);
+	}
+	if (BatchSizeArg)
+	{
+		TestFalse(TEXT("wp_batch_size should be optional"), BatchSizeArg->bRequired);
+		TestEqual(TEXT("wp_batch_size max"), BatchSizeArg->MaxIntValue, 2048);
+	}
+	if (MemoryCeilingArg)
+	{
+		TestFalse(TEXT("memory_ceiling_mb should be optional"), MemoryCeilingArg->bRequired);
+	}
+
 	const FHCIToolDescriptor* SearchPathTool = Registry.FindTool(TEXT("SearchPath"));
 	TestNotNull(TEXT("SearchPath should exist"), SearchPathTool);
 	if (SearchPathTool)